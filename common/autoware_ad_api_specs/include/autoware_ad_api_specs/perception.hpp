@@ -29,6 +29,7 @@ struct DynamicObjectArray
   static constexpr size_t depth = 1;
   static constexpr auto reliability = RMW_QOS_POLICY_RELIABILITY_RELIABLE;
   static constexpr auto durability = RMW_QOS_POLICY_DURABILITY_VOLATILE;
+  static constexpr bool use_loaned_message = true;
 };
 
 }  // namespace autoware_ad_api::perception
@@ -72,6 +72,7 @@ struct Route
   static constexpr size_t depth = 1;
   static constexpr auto reliability = RMW_QOS_POLICY_RELIABILITY_RELIABLE;
   static constexpr auto durability = RMW_QOS_POLICY_DURABILITY_TRANSIENT_LOCAL;
+  static constexpr bool use_loaned_message = true;
 };
 
 }  // namespace autoware_ad_api::routing
@@ -24,6 +24,9 @@
 #include <geometry/spatial_hash_config.hpp>
 #include <geometry/visibility_control.hpp>
 
+#include <algorithm>
+#include <iterator>
+#include <numeric>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -323,6 +326,212 @@ template <typename T>
 using SpatialHash2d = SpatialHash<T, Config2d>;
 template <typename T>
 using SpatialHash3d = SpatialHash<T, Config3d>;
+
+/// \brief A spatial hash for a static set of points, where the points are sorted by their bins
+/// \tparam PointT The point type stored in this data structure. Must have float members x, y and z
+/// \tparam ConfigT The configuration type, Config2d or Config3d
+///
+/// The points are sorted by the bin index when the data structure is built, and only the occupied
+/// bins are kept as a sorted array of bin indices with the offsets of their points (compressed
+/// sparse row layout). The points of a bin and of the bins adjacent in x are contiguous in memory,
+/// and no node is allocated per point as in SpatialHash. The points cannot be inserted or erased
+/// after the build, so this is meant for a point set which is queried many times, e.g. to find the
+/// neighbors of every point of a point cloud.
+template <typename PointT, typename ConfigT>
+class GEOMETRY_PUBLIC StaticSpatialHash
+{
+  using Index3 = details::Index3;
+  // lint -e{9131} NOLINT There's no other way to make this work in a static assert
+  static_assert(
+    std::is_same<ConfigT, Config2d>::value || std::is_same<ConfigT, Config3d>::value,
+    "StaticSpatialHash only works with Config2d or Config3d");
+
+public:
+  /// \brief Near neighbors of a batch of reference points
+  ///
+  /// The neighbors of the i-th reference point are in [offsets[i], offsets[i + 1]) of indices and
+  /// distances.
+  struct BatchOutput
+  {
+    /// \brief Offsets of the neighbors of each reference point, followed by the total number
+    std::vector<Index> offsets;
+    /// \brief Indices of the neighbors in the range of points the data structure was built from
+    std::vector<Index> indices;
+    /// \brief Euclidean distances (2d or 3d) from the reference point to the neighbors
+    std::vector<float32_t> distances;
+  };
+
+  /// \brief Constructor
+  /// \param[in] cfg The configuration object for this class
+  explicit StaticSpatialHash(const ConfigT & cfg) : m_config{cfg} {}
+
+  /// \brief Builds the data structure from a range of points, replacing the stored points
+  /// \param[in] begin The start of the range of points
+  /// \param[in] end The end of the range of points
+  /// \tparam IteratorT The iterator type
+  /// \throw std::length_error If the range of points exceeds the data structure's capacity
+  template <typename IteratorT>
+  void build(IteratorT begin, IteratorT end)
+  {
+    const std::vector<PointT> points(begin, end);
+    if (points.size() > capacity()) {
+      throw std::length_error{"StaticSpatialHash: Cannot build past capacity"};
+    }
+    // sort by the bin, keeping the order of the range within a bin
+    std::vector<std::pair<Index, Index>> bin_points;
+    bin_points.reserve(points.size());
+    for (Index idx = 0U; idx < points.size(); ++idx) {
+      const auto & pt = points[idx];
+      bin_points.emplace_back(
+        m_config.bin(point_adapter::x_(pt), point_adapter::y_(pt), point_adapter::z_(pt)), idx);
+    }
+    std::sort(bin_points.begin(), bin_points.end());
+
+    clear();
+    m_points.reserve(points.size());
+    m_indices.reserve(points.size());
+    for (const auto & bin_point : bin_points) {
+      if (m_bins.empty() || (m_bins.back() != bin_point.first)) {
+        m_bins.push_back(bin_point.first);
+        m_offsets.push_back(m_points.size());
+      }
+      m_points.push_back(points[bin_point.second]);
+      m_indices.push_back(bin_point.second);
+    }
+    m_offsets.push_back(m_points.size());
+  }
+
+  /// \brief Finds all points within a fixed radius of each of the reference points
+  /// \param[in] reference_points The reference points. The z members are respected only if the
+  ///                             spatial hash is not 2D.
+  /// \param[in] radius The radius within which to find all near points
+  /// \param[out] output The near points of each reference point, in the order of the reference
+  ///                    points
+  ///
+  /// The reference points are visited in the order of their bins, so that the consecutive queries
+  /// mostly read the same bins, which are still in cache.
+  void near(
+    const std::vector<PointT> & reference_points, const float32_t radius,
+    BatchOutput & output) const
+  {
+    std::vector<std::pair<Index, Index>> order;
+    order.reserve(reference_points.size());
+    for (Index idx = 0U; idx < reference_points.size(); ++idx) {
+      const auto & pt = reference_points[idx];
+      order.emplace_back(
+        m_config.bin(point_adapter::x_(pt), point_adapter::y_(pt), point_adapter::z_(pt)), idx);
+    }
+    std::sort(order.begin(), order.end());
+
+    // collect the neighbors in the visiting order
+    std::vector<Index> begins;
+    std::vector<Index> positions;
+    std::vector<float32_t> distances;
+    begins.reserve(order.size() + 1U);
+    for (const auto & bin_ref : order) {
+      begins.push_back(positions.size());
+      const auto & pt = reference_points[bin_ref.second];
+      near_impl(
+        point_adapter::x_(pt), point_adapter::y_(pt), point_adapter::z_(pt), radius, positions,
+        distances);
+    }
+    begins.push_back(positions.size());
+
+    // rearrange them in the order of the reference points
+    output.offsets.assign(reference_points.size() + 1U, 0U);
+    for (Index odx = 0U; odx < order.size(); ++odx) {
+      output.offsets[order[odx].second + 1U] = begins[odx + 1U] - begins[odx];
+    }
+    std::partial_sum(output.offsets.begin(), output.offsets.end(), output.offsets.begin());
+    output.indices.resize(positions.size());
+    output.distances.resize(distances.size());
+    for (Index odx = 0U; odx < order.size(); ++odx) {
+      const Index offset = output.offsets[order[odx].second];
+      std::transform(
+        positions.begin() + begins[odx], positions.begin() + begins[odx + 1U],
+        output.indices.begin() + offset, [this](const Index pdx) { return m_indices[pdx]; });
+      std::copy(
+        distances.begin() + begins[odx], distances.begin() + begins[odx + 1U],
+        output.distances.begin() + offset);
+    }
+  }
+
+  /// \brief Reset the state of the data structure
+  void clear()
+  {
+    m_points.clear();
+    m_indices.clear();
+    m_bins.clear();
+    m_offsets.clear();
+  }
+  /// \brief Get current number of element stored in this data structure
+  /// \return Number of stored elements
+  Index size() const { return m_points.size(); }
+  /// \brief Get the maximum capacity of the data structure
+  /// \return The capacity of the data structure
+  Index capacity() const { return m_config.get_capacity(); }
+  /// \brief Whether the hash is empty
+  /// \return True if data structure is empty
+  bool8_t empty() const { return m_points.empty(); }
+  /// \brief Get the number of occupied bins
+  /// \return Number of bins which contain at least one point
+  Index bins() const { return m_bins.size(); }
+
+private:
+  /// \brief Finds all points within a fixed radius of a reference point
+  /// \param[in] x The x component of the reference point
+  /// \param[in] y The y component of the reference point
+  /// \param[in] z The z component of the reference point, respected only if the spatial hash is not
+  ///              2D.
+  /// \param[in] radius The radius within which to find all near points
+  /// \param[inout] positions Positions of the near points in m_points are appended
+  /// \param[inout] distances Distances to the near points are appended
+  GEOMETRY_LOCAL void near_impl(
+    const float32_t x, const float32_t y, const float32_t z, const float32_t radius,
+    std::vector<Index> & positions, std::vector<float32_t> & distances) const
+  {
+    const Index3 ref_idx = m_config.index3(x, y, z);
+    const float32_t radius2 = radius * radius;
+    const details::BinRange idx_range = m_config.bin_range(ref_idx, radius);
+    for (Index zdx = idx_range.first.z; zdx <= idx_range.second.z; ++zdx) {
+      for (Index ydx = idx_range.first.y; ydx <= idx_range.second.y; ++ydx) {
+        // The bins in a row along x have consecutive indices, so they are found by one search
+        const Index row_begin = m_config.index({idx_range.first.x, ydx, zdx});
+        const Index row_end = m_config.index({idx_range.second.x, ydx, zdx});
+        auto bin_it = std::lower_bound(m_bins.begin(), m_bins.end(), row_begin);
+        for (; (bin_it != m_bins.end()) && (*bin_it <= row_end); ++bin_it) {
+          const Index3 idx{idx_range.first.x + (*bin_it - row_begin), ydx, zdx};
+          if (!m_config.is_candidate_bin(ref_idx, idx, radius2)) {
+            continue;
+          }
+          const auto bdx = static_cast<Index>(std::distance(m_bins.begin(), bin_it));
+          for (Index pdx = m_offsets[bdx]; pdx < m_offsets[bdx + 1U]; ++pdx) {
+            const float32_t dist2 = m_config.distance_squared(x, y, z, m_points[pdx]);
+            if (dist2 <= radius2) {
+              positions.push_back(pdx);
+              distances.push_back(sqrtf(dist2));
+            }
+          }
+        }
+      }
+    }
+  }
+
+  const ConfigT m_config;
+  /// \brief Points sorted by the bin
+  std::vector<PointT> m_points;
+  /// \brief Index of each of m_points in the range the data structure was built from
+  std::vector<Index> m_indices;
+  /// \brief Sorted indices of the occupied bins
+  std::vector<Index> m_bins;
+  /// \brief Offset of the points of each of m_bins in m_points, followed by the number of points
+  std::vector<Index> m_offsets;
+};  // class StaticSpatialHash
+
+template <typename T>
+using StaticSpatialHash2d = StaticSpatialHash<T, Config2d>;
+template <typename T>
+using StaticSpatialHash3d = StaticSpatialHash<T, Config3d>;
 }  // namespace spatial_hash
 }  // namespace geometry
 }  // namespace common
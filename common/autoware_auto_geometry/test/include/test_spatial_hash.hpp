@@ -21,7 +21,10 @@
 
 #include <geometry_msgs/msg/point32.hpp>
 
+#include <algorithm>
 #include <limits>
+#include <random>
+#include <tuple>
 #include <vector>
 
 using autoware::common::geometry::spatial_hash::Config2d;
@@ -29,6 +32,9 @@ using autoware::common::geometry::spatial_hash::Config3d;
 using autoware::common::geometry::spatial_hash::SpatialHash;
 using autoware::common::geometry::spatial_hash::SpatialHash2d;
 using autoware::common::geometry::spatial_hash::SpatialHash3d;
+using autoware::common::geometry::spatial_hash::StaticSpatialHash;
+using autoware::common::geometry::spatial_hash::StaticSpatialHash2d;
+using autoware::common::geometry::spatial_hash::StaticSpatialHash3d;
 using autoware::common::types::bool8_t;
 using autoware::common::types::float32_t;
 using autoware::common::types::float64_t;
@@ -67,6 +73,34 @@ protected:
       r += dr;
     }
   }
+  /// compare the neighbors of the static spatial hash with the ones of the spatial hash
+  template <typename Cfg>
+  void compare_static(
+    SpatialHash<PointT, Cfg> & hash, const StaticSpatialHash<PointT, Cfg> & static_hash,
+    const std::vector<PointT> & pts, const std::vector<PointT> & refs, const float32_t radius)
+  {
+    using Neighbor = std::tuple<float32_t, float32_t, float32_t, float32_t>;
+    typename StaticSpatialHash<PointT, Cfg>::BatchOutput output;
+    static_hash.near(refs, radius, output);
+    ASSERT_EQ(output.offsets.size(), refs.size() + 1U);
+    ASSERT_EQ(output.indices.size(), output.offsets.back());
+    ASSERT_EQ(output.distances.size(), output.offsets.back());
+    for (std::size_t idx = 0U; idx < refs.size(); ++idx) {
+      std::vector<Neighbor> expected;
+      for (const auto & itd : hash.near(refs[idx], radius)) {
+        const PointT & pt = itd;
+        expected.emplace_back(pt.x, pt.y, pt.z, itd.get_distance());
+      }
+      std::vector<Neighbor> actual;
+      for (auto jdx = output.offsets[idx]; jdx < output.offsets[idx + 1U]; ++jdx) {
+        const PointT & pt = pts[output.indices[jdx]];
+        actual.emplace_back(pt.x, pt.y, pt.z, output.distances[jdx]);
+      }
+      std::sort(expected.begin(), expected.end());
+      std::sort(actual.begin(), actual.end());
+      EXPECT_EQ(actual, expected);
+    }
+  }
   PointT ref;
   const float32_t EPS;
 };  // SpatialHash
@@ -225,6 +259,57 @@ TYPED_TEST(TypedSpatialHashTest, 3d)
   EXPECT_EQ(count, 0U);
 }
 
+/// static spatial hash finds the same neighbors as the spatial hash
+TYPED_TEST(TypedSpatialHashTest, Static)
+{
+  using PointT = TypeParam;
+  std::mt19937 gen(0U);
+  std::uniform_real_distribution<float32_t> dist(-10.0F, 10.0F);
+  std::vector<PointT> pts(1000U);
+  for (auto & pt : pts) {
+    pt.x = dist(gen);
+    pt.y = dist(gen);
+    pt.z = dist(gen);
+  }
+  // reference points on the stored points, and out of bounds
+  std::vector<PointT> refs(pts.begin(), pts.begin() + 100);
+  for (uint32_t idx = 0U; idx < 50U; ++idx) {
+    PointT pt;
+    pt.x = 2.0F * dist(gen);
+    pt.y = 2.0F * dist(gen);
+    pt.z = 2.0F * dist(gen);
+    refs.push_back(pt);
+  }
+
+  Config2d cfg2d{-10.0F, 10.0F, -10.0F, 10.0F, 1.0F, 1024U};
+  SpatialHash2d<PointT> hash2d{cfg2d};
+  StaticSpatialHash2d<PointT> static_hash2d{cfg2d};
+  EXPECT_TRUE(static_hash2d.empty());
+  hash2d.insert(pts.begin(), pts.end());
+  static_hash2d.build(pts.begin(), pts.end());
+  EXPECT_EQ(static_hash2d.size(), pts.size());
+  EXPECT_LE(static_hash2d.bins(), 400U);
+  this->compare_static(hash2d, static_hash2d, pts, refs, 0.5F);
+  this->compare_static(hash2d, static_hash2d, pts, refs, 1.0F);
+  this->compare_static(hash2d, static_hash2d, pts, refs, 2.5F);
+
+  Config3d cfg3d{-10.0F, 10.0F, -10.0F, 10.0F, -10.0F, 10.0F, 2.0F, 1024U};
+  SpatialHash3d<PointT> hash3d{cfg3d};
+  StaticSpatialHash3d<PointT> static_hash3d{cfg3d};
+  hash3d.insert(pts.begin(), pts.end());
+  static_hash3d.build(pts.begin(), pts.end());
+  this->compare_static(hash3d, static_hash3d, pts, refs, 2.0F);
+  this->compare_static(hash3d, static_hash3d, pts, refs, 5.0F);
+
+  // rebuild replaces the points
+  static_hash3d.build(pts.begin(), pts.begin() + 10);
+  EXPECT_EQ(static_hash3d.size(), 10U);
+  static_hash3d.clear();
+  EXPECT_TRUE(static_hash3d.empty());
+  const std::vector<PointT> too_many_pts(1025U);
+  EXPECT_THROW(static_hash3d.build(too_many_pts.begin(), too_many_pts.end()), std::length_error);
+}
+
 /// edge cases
 TEST(SpatialHashConfig, BadCases)
 {
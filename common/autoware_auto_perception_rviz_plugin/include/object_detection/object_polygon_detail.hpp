@@ -133,6 +133,16 @@ get_path_confidence_marker_ptr(
   const autoware_auto_perception_msgs::msg::PredictedPath & predicted_path,
   const std_msgs::msg::ColorRGBA & path_confidence_color);
 
+/// \brief Append the lines of a LINE_LIST marker to a marker which merges the lines of objects
+/// \details The points are transformed by the pose of the marker and colored by the color of the
+///          marker, so that the lines of many objects are drawn as one Ogre object.
+/// \param marker LINE_LIST marker of an object
+/// \param merged_marker_ptr Marker to append to. It is created from the fields of the first marker
+///                          if it is null. Id and header will have to be set by the caller
+AUTOWARE_AUTO_PERCEPTION_RVIZ_PLUGIN_PUBLIC void append_line_list_marker(
+  const visualization_msgs::msg::Marker & marker,
+  visualization_msgs::msg::Marker::SharedPtr & merged_marker_ptr);
+
 AUTOWARE_AUTO_PERCEPTION_RVIZ_PLUGIN_PUBLIC void calc_bounding_box_line_list(
   const autoware_auto_perception_msgs::msg::Shape & shape,
   std::vector<geometry_msgs::msg::Point> & points);
@@ -22,6 +22,7 @@
 #include <boost/uuid/uuid.hpp>
 #include <boost/uuid/uuid_generators.hpp>
 
+#include <algorithm>
 #include <condition_variable>
 #include <list>
 #include <set>
@@ -51,9 +52,10 @@ private:
 
   boost::uuids::uuid to_boost_uuid(const unique_identifier_msgs::msg::UUID & uuid_msg)
   {
-    const std::string uuid_str = uuid_to_string(uuid_msg);
-    boost::uuids::string_generator gen;
-    boost::uuids::uuid uuid = gen(uuid_str);
+    // copy the bytes instead of formatting and parsing the string, as it is called for every
+    // object of every message
+    boost::uuids::uuid uuid;
+    std::copy(uuid_msg.uuid.begin(), uuid_msg.uuid.end(), uuid.begin());
     return uuid;
   }
 
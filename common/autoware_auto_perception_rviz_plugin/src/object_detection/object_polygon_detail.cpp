@@ -306,6 +306,49 @@ visualization_msgs::msg::Marker::SharedPtr get_2d_shape_marker_ptr(
   return marker_ptr;
 }
 
+void append_line_list_marker(const Marker & marker, Marker::SharedPtr & merged_marker_ptr)
+{
+  if (!merged_marker_ptr) {
+    merged_marker_ptr = std::make_shared<Marker>();
+    merged_marker_ptr->type = marker.type;
+    merged_marker_ptr->ns = marker.ns;
+    merged_marker_ptr->action = marker.action;
+    merged_marker_ptr->lifetime = marker.lifetime;
+    merged_marker_ptr->pose = initPose();
+    merged_marker_ptr->scale = marker.scale;
+    merged_marker_ptr->color = marker.color;
+  }
+
+  Eigen::Quaterniond rotation(
+    marker.pose.orientation.w, marker.pose.orientation.x, marker.pose.orientation.y,
+    marker.pose.orientation.z);
+  // rviz shows a marker with an invalid quaternion as identity
+  if (rotation.norm() > 0.0) {
+    rotation.normalize();
+  } else {
+    rotation.setIdentity();
+  }
+  const Eigen::Vector3d translation(
+    marker.pose.position.x, marker.pose.position.y, marker.pose.position.z);
+  const bool has_point_colors = marker.colors.size() == marker.points.size();
+
+  auto & points = merged_marker_ptr->points;
+  auto & colors = merged_marker_ptr->colors;
+  points.reserve(points.size() + marker.points.size());
+  colors.reserve(colors.size() + marker.points.size());
+  for (size_t i = 0; i < marker.points.size(); ++i) {
+    const auto & point = marker.points.at(i);
+    const Eigen::Vector3d merged_point =
+      rotation * Eigen::Vector3d(point.x, point.y, point.z) + translation;
+    geometry_msgs::msg::Point merged_point_msg;
+    merged_point_msg.x = merged_point.x();
+    merged_point_msg.y = merged_point.y();
+    merged_point_msg.z = merged_point.z();
+    points.push_back(merged_point_msg);
+    colors.push_back(has_point_colors ? marker.colors.at(i) : marker.color);
+  }
+}
+
 void calc_bounding_box_line_list(
   const autoware_auto_perception_msgs::msg::Shape & shape,
   std::vector<geometry_msgs::msg::Point> & points)
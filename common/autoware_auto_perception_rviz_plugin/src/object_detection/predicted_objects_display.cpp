@@ -55,17 +55,24 @@ std::vector<visualization_msgs::msg::Marker::SharedPtr> PredictedObjectsDisplay:
 
   std::vector<visualization_msgs::msg::Marker::SharedPtr> markers;
 
+  // The lines of all the objects are merged into one marker for each namespace, since each marker
+  // is a separate Ogre object and rendering hundreds of them is slow. The merged markers keep their
+  // ids between the messages so that the Ogre objects are reused.
+  visualization_msgs::msg::Marker::SharedPtr shape_lines;
+  visualization_msgs::msg::Marker::SharedPtr pose_with_covariance_lines;
+  visualization_msgs::msg::Marker::SharedPtr twist_lines;
+  visualization_msgs::msg::Marker::SharedPtr predicted_path_lines;
+
   for (const auto & object : msg->objects) {
+    const int32_t object_marker_id = uuid_to_marker_id(object.object_id);
+
     // Get marker for shape
     auto shape_marker = get_shape_marker_ptr(
       object.shape, object.kinematics.initial_pose_with_covariance.pose.position,
       object.kinematics.initial_pose_with_covariance.pose.orientation, object.classification,
       get_line_width());
     if (shape_marker) {
-      auto shape_marker_ptr = shape_marker.value();
-      shape_marker_ptr->header = msg->header;
-      shape_marker_ptr->id = uuid_to_marker_id(object.object_id);
-      markers.push_back(shape_marker_ptr);
+      detail::append_line_list_marker(*shape_marker.value(), shape_lines);
     }
 
     // Get marker for label
@@ -75,7 +82,7 @@ std::vector<visualization_msgs::msg::Marker::SharedPtr> PredictedObjectsDisplay:
     if (label_marker) {
       auto label_marker_ptr = label_marker.value();
       label_marker_ptr->header = msg->header;
-      label_marker_ptr->id = uuid_to_marker_id(object.object_id);
+      label_marker_ptr->id = object_marker_id;
       markers.push_back(label_marker_ptr);
     }
 
@@ -90,7 +97,7 @@ std::vector<visualization_msgs::msg::Marker::SharedPtr> PredictedObjectsDisplay:
     if (id_marker) {
       auto id_marker_ptr = id_marker.value();
       id_marker_ptr->header = msg->header;
-      id_marker_ptr->id = uuid_to_marker_id(object.object_id);
+      id_marker_ptr->id = object_marker_id;
       markers.push_back(id_marker_ptr);
     }
 
@@ -98,10 +105,8 @@ std::vector<visualization_msgs::msg::Marker::SharedPtr> PredictedObjectsDisplay:
     auto pose_with_covariance_marker =
       get_pose_with_covariance_marker_ptr(object.kinematics.initial_pose_with_covariance);
     if (pose_with_covariance_marker) {
-      auto pose_with_covariance_marker_ptr = pose_with_covariance_marker.value();
-      pose_with_covariance_marker_ptr->header = msg->header;
-      pose_with_covariance_marker_ptr->id = uuid_to_marker_id(object.object_id);
-      markers.push_back(pose_with_covariance_marker_ptr);
+      detail::append_line_list_marker(
+        *pose_with_covariance_marker.value(), pose_with_covariance_lines);
     }
 
     // Get marker for velocity text
@@ -115,7 +120,7 @@ std::vector<visualization_msgs::msg::Marker::SharedPtr> PredictedObjectsDisplay:
     if (velocity_text_marker) {
       auto velocity_text_marker_ptr = velocity_text_marker.value();
       velocity_text_marker_ptr->header = msg->header;
-      velocity_text_marker_ptr->id = uuid_to_marker_id(object.object_id);
+      velocity_text_marker_ptr->id = object_marker_id;
       markers.push_back(velocity_text_marker_ptr);
     }
 
@@ -130,7 +135,7 @@ std::vector<visualization_msgs::msg::Marker::SharedPtr> PredictedObjectsDisplay:
     if (acceleration_text_marker) {
       auto acceleration_text_marker_ptr = acceleration_text_marker.value();
       acceleration_text_marker_ptr->header = msg->header;
-      acceleration_text_marker_ptr->id = uuid_to_marker_id(object.object_id);
+      acceleration_text_marker_ptr->id = object_marker_id;
       markers.push_back(acceleration_text_marker_ptr);
     }
 
@@ -139,30 +144,21 @@ std::vector<visualization_msgs::msg::Marker::SharedPtr> PredictedObjectsDisplay:
       object.kinematics.initial_pose_with_covariance,
       object.kinematics.initial_twist_with_covariance);
     if (twist_marker) {
-      auto twist_marker_ptr = twist_marker.value();
-      twist_marker_ptr->header = msg->header;
-      twist_marker_ptr->id = uuid_to_marker_id(object.object_id);
-      markers.push_back(twist_marker_ptr);
+      detail::append_line_list_marker(*twist_marker.value(), twist_lines);
     }
 
     // Add marker for each candidate path
-    int32_t path_count = 0;
     for (const auto & predicted_path : object.kinematics.predicted_paths) {
       // Get marker for predicted path
       auto predicted_path_marker =
         get_predicted_path_marker_ptr(object.object_id, object.shape, predicted_path);
       if (predicted_path_marker) {
-        auto predicted_path_marker_ptr = predicted_path_marker.value();
-        predicted_path_marker_ptr->header = msg->header;
-        predicted_path_marker_ptr->id =
-          uuid_to_marker_id(object.object_id) + path_count * PATH_ID_CONSTANT;
-        path_count++;
-        markers.push_back(predicted_path_marker_ptr);
+        detail::append_line_list_marker(*predicted_path_marker.value(), predicted_path_lines);
       }
     }
 
     // Add confidence text marker for each candidate path
-    path_count = 0;
+    int32_t path_count = 0;
     for (const auto & predicted_path : object.kinematics.predicted_paths) {
       if (predicted_path.path.empty()) {
         continue;
@@ -172,14 +168,23 @@ std::vector<visualization_msgs::msg::Marker::SharedPtr> PredictedObjectsDisplay:
       if (path_confidence_marker) {
         auto path_confidence_marker_ptr = path_confidence_marker.value();
         path_confidence_marker_ptr->header = msg->header;
-        path_confidence_marker_ptr->id =
-          uuid_to_marker_id(object.object_id) + path_count * PATH_ID_CONSTANT;
+        path_confidence_marker_ptr->id = object_marker_id + path_count * PATH_ID_CONSTANT;
         path_count++;
         markers.push_back(path_confidence_marker_ptr);
       }
     }
   }
 
+  for (const auto & lines :
+       {shape_lines, pose_with_covariance_lines, twist_lines, predicted_path_lines}) {
+    // an empty marker is not added, so that the marker of the previous message is deleted
+    if (lines && !lines->points.empty()) {
+      lines->header = msg->header;
+      lines->id = 0;
+      markers.push_back(lines);
+    }
+  }
+
   return markers;
 }
 
@@ -0,0 +1,189 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef AUTOWARE_POINT_TYPES__FIELD_ACCESSOR_HPP_
+#define AUTOWARE_POINT_TYPES__FIELD_ACCESSOR_HPP_
+
+#include "autoware_point_types/types.hpp"
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+#include <sensor_msgs/msg/point_field.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <optional>
+#include <string>
+
+// Offset-based readers and writers for the fields of a raw sensor_msgs::msg::PointCloud2 point.
+//
+// A layout is a struct with one accessor member per field, e.g. `layout.x.read(point)`.
+// StaticField bakes the offset into the type, so that a filter templated on the layout compiles
+// every access down to a single load or store. DynamicField holds an offset resolved at runtime
+// from the message fields, and is the fallback for inputs which do not match a static layout.
+
+namespace autoware_point_types
+{
+template <class T>
+struct FieldDatatype;
+
+template <>
+struct FieldDatatype<std::uint8_t>
+{
+  static constexpr std::uint8_t value = sensor_msgs::msg::PointField::UINT8;
+};
+
+template <>
+struct FieldDatatype<std::uint16_t>
+{
+  static constexpr std::uint8_t value = sensor_msgs::msg::PointField::UINT16;
+};
+
+template <>
+struct FieldDatatype<float>
+{
+  static constexpr std::uint8_t value = sensor_msgs::msg::PointField::FLOAT32;
+};
+
+template <>
+struct FieldDatatype<double>
+{
+  static constexpr std::uint8_t value = sensor_msgs::msg::PointField::FLOAT64;
+};
+
+/** \brief Find the field `name` of type T in `msg`. */
+template <class T>
+std::optional<std::size_t> find_field_offset(
+  const sensor_msgs::msg::PointCloud2 & msg, const std::string & name)
+{
+  for (const auto & field : msg.fields) {
+    if (field.name == name) {
+      if (field.datatype != FieldDatatype<T>::value || field.offset + sizeof(T) > msg.point_step) {
+        return std::nullopt;
+      }
+      return field.offset;
+    }
+  }
+  return std::nullopt;
+}
+
+template <class T, std::size_t Offset>
+struct StaticField
+{
+  using type = T;
+  static constexpr std::size_t offset = Offset;
+
+  // memcpy with a constant size is the portable way to do an unaligned load, and is compiled
+  // into a single instruction.
+  static T read(const std::uint8_t * point)
+  {
+    T value;
+    std::memcpy(&value, point + Offset, sizeof(T));
+    return value;
+  }
+
+  static void write(std::uint8_t * point, const T value)
+  {
+    std::memcpy(point + Offset, &value, sizeof(T));
+  }
+
+  static bool matches(const sensor_msgs::msg::PointCloud2 & msg, const std::string & name)
+  {
+    const auto found_offset = find_field_offset<T>(msg, name);
+    return found_offset && *found_offset == Offset;
+  }
+};
+
+template <class T>
+struct DynamicField
+{
+  using type = T;
+  std::size_t offset;
+
+  T read(const std::uint8_t * point) const
+  {
+    T value;
+    std::memcpy(&value, point + offset, sizeof(T));
+    return value;
+  }
+
+  void write(std::uint8_t * point, const T value) const
+  {
+    std::memcpy(point + offset, &value, sizeof(T));
+  }
+
+  /** \brief Resolve the field `name` of `msg`, or nullopt if it is missing or not of type T. */
+  static std::optional<DynamicField> from_msg(
+    const sensor_msgs::msg::PointCloud2 & msg, const std::string & name)
+  {
+    const auto found_offset = find_field_offset<T>(msg, name);
+    if (!found_offset) {
+      return std::nullopt;
+    }
+    return DynamicField{*found_offset};
+  }
+};
+
+#define AUTOWARE_POINT_TYPES__STATIC_FIELD(point_type, member) \
+  StaticField<decltype(point_type::member), offsetof(point_type, member)> member
+
+/** \brief Static layout of PointXYZIRADRT, the output format of the sensor drivers. */
+struct PointXYZIRADRTLayout
+{
+  static constexpr std::size_t point_step = sizeof(PointXYZIRADRT);
+  AUTOWARE_POINT_TYPES__STATIC_FIELD(PointXYZIRADRT, x);
+  AUTOWARE_POINT_TYPES__STATIC_FIELD(PointXYZIRADRT, y);
+  AUTOWARE_POINT_TYPES__STATIC_FIELD(PointXYZIRADRT, z);
+  AUTOWARE_POINT_TYPES__STATIC_FIELD(PointXYZIRADRT, intensity);
+  AUTOWARE_POINT_TYPES__STATIC_FIELD(PointXYZIRADRT, ring);
+  AUTOWARE_POINT_TYPES__STATIC_FIELD(PointXYZIRADRT, azimuth);
+  AUTOWARE_POINT_TYPES__STATIC_FIELD(PointXYZIRADRT, distance);
+  AUTOWARE_POINT_TYPES__STATIC_FIELD(PointXYZIRADRT, return_type);
+  AUTOWARE_POINT_TYPES__STATIC_FIELD(PointXYZIRADRT, time_stamp);
+
+  /** \brief Whether the points of `msg` can be accessed with this layout. */
+  static bool matches(const sensor_msgs::msg::PointCloud2 & msg)
+  {
+    return msg.point_step == point_step && decltype(x)::matches(msg, "x") &&
+           decltype(y)::matches(msg, "y") && decltype(z)::matches(msg, "z") &&
+           decltype(intensity)::matches(msg, "intensity") && decltype(ring)::matches(msg, "ring") &&
+           decltype(azimuth)::matches(msg, "azimuth") &&
+           decltype(distance)::matches(msg, "distance") &&
+           decltype(return_type)::matches(msg, "return_type") &&
+           decltype(time_stamp)::matches(msg, "time_stamp");
+  }
+};
+
+/** \brief Static layout of PointXYZI. */
+struct PointXYZILayout
+{
+  static constexpr std::size_t point_step = sizeof(PointXYZI);
+  AUTOWARE_POINT_TYPES__STATIC_FIELD(PointXYZI, x);
+  AUTOWARE_POINT_TYPES__STATIC_FIELD(PointXYZI, y);
+  AUTOWARE_POINT_TYPES__STATIC_FIELD(PointXYZI, z);
+  AUTOWARE_POINT_TYPES__STATIC_FIELD(PointXYZI, intensity);
+
+  static bool matches(const sensor_msgs::msg::PointCloud2 & msg)
+  {
+    return msg.point_step == point_step && decltype(x)::matches(msg, "x") &&
+           decltype(y)::matches(msg, "y") && decltype(z)::matches(msg, "z") &&
+           decltype(intensity)::matches(msg, "intensity");
+  }
+};
+
+#undef AUTOWARE_POINT_TYPES__STATIC_FIELD
+
+}  // namespace autoware_point_types
+
+#endif  // AUTOWARE_POINT_TYPES__FIELD_ACCESSOR_HPP_
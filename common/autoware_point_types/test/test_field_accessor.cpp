@@ -0,0 +1,105 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "autoware_point_types/field_accessor.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cstdint>
+#include <cstring>
+#include <string>
+#include <vector>
+
+namespace
+{
+sensor_msgs::msg::PointField make_field(
+  const std::string & name, const uint32_t offset, const uint8_t datatype)
+{
+  sensor_msgs::msg::PointField field;
+  field.name = name;
+  field.offset = offset;
+  field.datatype = datatype;
+  field.count = 1;
+  return field;
+}
+
+sensor_msgs::msg::PointCloud2 make_xyziradrt_msg()
+{
+  using autoware_point_types::PointXYZIRADRT;
+  using sensor_msgs::msg::PointField;
+  sensor_msgs::msg::PointCloud2 msg;
+  msg.point_step = sizeof(PointXYZIRADRT);
+  msg.fields = {
+    make_field("x", offsetof(PointXYZIRADRT, x), PointField::FLOAT32),
+    make_field("y", offsetof(PointXYZIRADRT, y), PointField::FLOAT32),
+    make_field("z", offsetof(PointXYZIRADRT, z), PointField::FLOAT32),
+    make_field("intensity", offsetof(PointXYZIRADRT, intensity), PointField::FLOAT32),
+    make_field("ring", offsetof(PointXYZIRADRT, ring), PointField::UINT16),
+    make_field("azimuth", offsetof(PointXYZIRADRT, azimuth), PointField::FLOAT32),
+    make_field("distance", offsetof(PointXYZIRADRT, distance), PointField::FLOAT32),
+    make_field("return_type", offsetof(PointXYZIRADRT, return_type), PointField::UINT8),
+    make_field("time_stamp", offsetof(PointXYZIRADRT, time_stamp), PointField::FLOAT64)};
+  return msg;
+}
+}  // namespace
+
+TEST(FieldAccessor, StaticLayoutMatches)
+{
+  auto msg = make_xyziradrt_msg();
+  EXPECT_TRUE(autoware_point_types::PointXYZIRADRTLayout::matches(msg));
+  EXPECT_FALSE(autoware_point_types::PointXYZILayout::matches(msg));
+
+  msg.fields.at(4).datatype = sensor_msgs::msg::PointField::UINT8;
+  EXPECT_FALSE(autoware_point_types::PointXYZIRADRTLayout::matches(msg));
+}
+
+TEST(FieldAccessor, StaticLayoutReadWrite)
+{
+  using autoware_point_types::PointXYZIRADRT;
+  using autoware_point_types::PointXYZIRADRTLayout;
+
+  const PointXYZIRADRT point{0, 1, 2, 3, 4, 5, 6, 7, 8};
+  std::vector<std::uint8_t> data(sizeof(PointXYZIRADRT));
+  std::memcpy(data.data(), &point, sizeof(PointXYZIRADRT));
+
+  constexpr PointXYZIRADRTLayout layout{};
+  EXPECT_FLOAT_EQ(layout.y.read(data.data()), 1.0F);
+  EXPECT_EQ(layout.ring.read(data.data()), 4U);
+  EXPECT_EQ(layout.return_type.read(data.data()), 7U);
+  EXPECT_DOUBLE_EQ(layout.time_stamp.read(data.data()), 8.0);
+
+  layout.azimuth.write(data.data(), 10.0F);
+  PointXYZIRADRT written;
+  std::memcpy(&written, data.data(), sizeof(PointXYZIRADRT));
+  EXPECT_FLOAT_EQ(written.azimuth, 10.0F);
+  EXPECT_FLOAT_EQ(written.distance, 6.0F);
+}
+
+TEST(FieldAccessor, DynamicField)
+{
+  using autoware_point_types::DynamicField;
+
+  const auto msg = make_xyziradrt_msg();
+  const auto ring = DynamicField<std::uint16_t>::from_msg(msg, "ring");
+  ASSERT_TRUE(ring);
+  EXPECT_EQ(ring->offset, offsetof(autoware_point_types::PointXYZIRADRT, ring));
+
+  // wrong type and missing field
+  EXPECT_FALSE(DynamicField<float>::from_msg(msg, "ring"));
+  EXPECT_FALSE(DynamicField<float>::from_msg(msg, "noise"));
+
+  std::vector<std::uint8_t> data(msg.point_step);
+  ring->write(data.data(), 42);
+  EXPECT_EQ(ring->read(data.data()), 42U);
+}
@@ -15,12 +15,16 @@
 #ifndef COMPONENT_INTERFACE_UTILS__RCLCPP__TOPIC_PUBLISHER_HPP_
 #define COMPONENT_INTERFACE_UTILS__RCLCPP__TOPIC_PUBLISHER_HPP_
 
+#include <component_interface_utils/specs.hpp>
 #include <rclcpp/publisher.hpp>
 
+#include <memory>
+#include <utility>
+
 namespace component_interface_utils
 {
 
-/// The wrapper class of rclcpp::Publisher. This is for future use and no functionality now.
+/// The wrapper class of rclcpp::Publisher.
 template <class SpecT>
 class Publisher
 {
@@ -38,6 +42,31 @@ public:
   /// Publish a message.
   void publish(const typename SpecT::Message & msg) { publisher_->publish(msg); }
 
+  /// Publish a message without a copy when the subscriptions are in the same process.
+  void publish(std::unique_ptr<typename SpecT::Message> msg)
+  {
+    publisher_->publish(std::move(msg));
+  }
+
+  /// Publish a message written by the function, which is called with a reference to the message.
+  /// If the spec declares use_loaned_message and the middleware can loan the message, it is written
+  /// to the memory of the middleware (e.g. shared memory) and is not copied when published.
+  template <class FunctionT>
+  void publish_with(FunctionT && write)
+  {
+    if constexpr (use_loaned_message<SpecT>::value) {
+      if (publisher_->can_loan_messages()) {
+        auto loaned_msg = publisher_->borrow_loaned_message();
+        write(loaned_msg.get());
+        publisher_->publish(std::move(loaned_msg));
+        return;
+      }
+    }
+    auto msg = std::make_unique<typename SpecT::Message>();
+    write(*msg);
+    publisher_->publish(std::move(msg));
+  }
+
 private:
   RCLCPP_DISABLE_COPY(Publisher)
   typename WrapType::SharedPtr publisher_;
@@ -17,9 +17,23 @@
 
 #include <rclcpp/qos.hpp>
 
+#include <type_traits>
+
 namespace component_interface_utils
 {
 
+/// True if the spec declares "static constexpr bool use_loaned_message = true".
+template <class SpecT, class = void>
+struct use_loaned_message : std::false_type
+{
+};
+
+template <class SpecT>
+struct use_loaned_message<SpecT, std::void_t<decltype(SpecT::use_loaned_message)>>
+: std::bool_constant<SpecT::use_loaned_message>
+{
+};
+
 template <class SpecT>
 rclcpp::QoS get_qos()
 {
@@ -17,6 +17,31 @@
 #include "component_interface_utils/status.hpp"
 #include "gtest/gtest.h"
 
+namespace
+{
+struct DefaultSpec
+{
+};
+
+struct LoanedSpec
+{
+  static constexpr bool use_loaned_message = true;
+};
+
+struct NotLoanedSpec
+{
+  static constexpr bool use_loaned_message = false;
+};
+}  // namespace
+
+TEST(interface, use_loaned_message)
+{
+  using component_interface_utils::use_loaned_message;
+  EXPECT_FALSE(use_loaned_message<DefaultSpec>::value);
+  EXPECT_TRUE(use_loaned_message<LoanedSpec>::value);
+  EXPECT_FALSE(use_loaned_message<NotLoanedSpec>::value);
+}
+
 TEST(interface, utils)
 {
   {
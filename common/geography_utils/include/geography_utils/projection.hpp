@@ -19,6 +19,10 @@
 #include <geometry_msgs/msg/point.hpp>
 #include <tier4_map_msgs/msg/map_projector_info.hpp>
 
+#include <lanelet2_io/Projection.h>
+
+#include <vector>
+
 namespace geography_utils
 {
 using MapProjectorInfo = tier4_map_msgs::msg::MapProjectorInfo;
@@ -28,6 +32,20 @@ using LocalPoint = geometry_msgs::msg::Point;
 LocalPoint project_forward(const GeoPoint & geo_point, const MapProjectorInfo & projector_info);
 GeoPoint project_reverse(const LocalPoint & local_point, const MapProjectorInfo & projector_info);
 
+// with the projector from get_lanelet2_projector(projector_info), which is created once and reused
+// for many points instead of for each point
+LocalPoint project_forward(
+  const GeoPoint & geo_point, const MapProjectorInfo & projector_info,
+  const lanelet::Projector & projector);
+GeoPoint project_reverse(
+  const LocalPoint & local_point, const MapProjectorInfo & projector_info,
+  const lanelet::Projector & projector);
+
+// projects the points in parallel with a projector per thread (0: the number of the cores)
+std::vector<LocalPoint> project_forward(
+  const std::vector<GeoPoint> & geo_points, const MapProjectorInfo & projector_info,
+  const size_t num_threads = 0);
+
 }  // namespace geography_utils
 
 #endif  // GEOGRAPHY_UTILS__PROJECTION_HPP_
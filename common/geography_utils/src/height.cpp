@@ -23,18 +23,30 @@
 namespace geography_utils
 {
 
+namespace
+{
+// Loading the geoid model opens and reads its file, which is much heavier than a conversion, so
+// it is loaded once per thread instead of for each conversion. It is per thread since the geoid
+// caches the data around the last conversion and is not thread-safe.
+GeographicLib::Geoid & get_egm2008()
+{
+  thread_local GeographicLib::Geoid egm2008("egm2008-1");
+  return egm2008;
+}
+}  // namespace
+
 double convert_wgs84_to_egm2008(const double height, const double latitude, const double longitude)
 {
-  GeographicLib::Geoid egm2008("egm2008-1");
   // cSpell: ignore ELLIPSOIDTOGEOID
-  return egm2008.ConvertHeight(latitude, longitude, height, GeographicLib::Geoid::ELLIPSOIDTOGEOID);
+  return get_egm2008().ConvertHeight(
+    latitude, longitude, height, GeographicLib::Geoid::ELLIPSOIDTOGEOID);
 }
 
 double convert_egm2008_to_wgs84(const double height, const double latitude, const double longitude)
 {
-  GeographicLib::Geoid egm2008("egm2008-1");
   // cSpell: ignore GEOIDTOELLIPSOID
-  return egm2008.ConvertHeight(latitude, longitude, height, GeographicLib::Geoid::GEOIDTOELLIPSOID);
+  return get_egm2008().ConvertHeight(
+    latitude, longitude, height, GeographicLib::Geoid::GEOIDTOELLIPSOID);
 }
 
 double convert_height(
@@ -44,13 +56,14 @@ double convert_height(
   if (source_vertical_datum == target_vertical_datum) {
     return height;
   }
-  std::map<std::pair<std::string, std::string>, HeightConversionFunction> conversion_map;
-  conversion_map[{"WGS84", "EGM2008"}] = convert_wgs84_to_egm2008;
-  conversion_map[{"EGM2008", "WGS84"}] = convert_egm2008_to_wgs84;
+  static const std::map<std::pair<std::string, std::string>, HeightConversionFunction>
+    conversion_map{
+      {{"WGS84", "EGM2008"}, convert_wgs84_to_egm2008},
+      {{"EGM2008", "WGS84"}, convert_egm2008_to_wgs84}};
 
-  auto key = std::make_pair(source_vertical_datum, target_vertical_datum);
-  if (conversion_map.find(key) != conversion_map.end()) {
-    return conversion_map[key](height, latitude, longitude);
+  const auto it = conversion_map.find({source_vertical_datum, target_vertical_datum});
+  if (it != conversion_map.end()) {
+    return it->second(height, latitude, longitude);
   } else {
     std::string error_message =
       "Invalid conversion types: " + std::string(source_vertical_datum.c_str()) + " to " +
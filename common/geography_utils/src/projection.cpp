@@ -17,6 +17,12 @@
 #include <geography_utils/projection.hpp>
 #include <lanelet2_extension/projection/mgrs_projector.hpp>
 
+#include <algorithm>
+#include <exception>
+#include <memory>
+#include <thread>
+#include <vector>
+
 namespace geography_utils
 {
 
@@ -31,22 +37,30 @@ Eigen::Vector3d to_basic_point_3d_pt(const LocalPoint src)
 
 LocalPoint project_forward(const GeoPoint & geo_point, const MapProjectorInfo & projector_info)
 {
-  std::unique_ptr<lanelet::Projector> projector = get_lanelet2_projector(projector_info);
+  const std::unique_ptr<lanelet::Projector> projector = get_lanelet2_projector(projector_info);
+  return project_forward(geo_point, projector_info, *projector);
+}
+
+LocalPoint project_forward(
+  const GeoPoint & geo_point, const MapProjectorInfo & projector_info,
+  const lanelet::Projector & projector)
+{
   lanelet::GPSPoint position{geo_point.latitude, geo_point.longitude, geo_point.altitude};
 
   lanelet::BasicPoint3d projected_local_point;
   if (projector_info.projector_type == MapProjectorInfo::MGRS) {
     const int mgrs_precision = 9;  // set precision as 100 micro meter
-    const auto mgrs_projector = dynamic_cast<lanelet::projection::MGRSProjector *>(projector.get());
+    const auto & mgrs_projector =
+      dynamic_cast<const lanelet::projection::MGRSProjector &>(projector);
 
     // project x and y using projector
     // note that the altitude is ignored in MGRS projection conventionally
-    projected_local_point = mgrs_projector->forward(position, mgrs_precision);
+    projected_local_point = mgrs_projector.forward(position, mgrs_precision);
   } else {
     // project x and y using projector
     // note that the original projector such as UTM projector does not compensate for the altitude
     // offset
-    projected_local_point = projector->forward(position);
+    projected_local_point = projector.forward(position);
 
     // correct z based on the map origin
     // note that the converted altitude in local point is in the same vertical datum as the geo
@@ -64,20 +78,27 @@ LocalPoint project_forward(const GeoPoint & geo_point, const MapProjectorInfo &
 
 GeoPoint project_reverse(const LocalPoint & local_point, const MapProjectorInfo & projector_info)
 {
-  std::unique_ptr<lanelet::Projector> projector = get_lanelet2_projector(projector_info);
+  const std::unique_ptr<lanelet::Projector> projector = get_lanelet2_projector(projector_info);
+  return project_reverse(local_point, projector_info, *projector);
+}
 
+GeoPoint project_reverse(
+  const LocalPoint & local_point, const MapProjectorInfo & projector_info,
+  const lanelet::Projector & projector)
+{
   lanelet::GPSPoint projected_gps_point;
   if (projector_info.projector_type == MapProjectorInfo::MGRS) {
-    const auto mgrs_projector = dynamic_cast<lanelet::projection::MGRSProjector *>(projector.get());
+    const auto & mgrs_projector =
+      dynamic_cast<const lanelet::projection::MGRSProjector &>(projector);
     // project latitude and longitude using projector
     // note that the z is ignored in MGRS projection conventionally
     projected_gps_point =
-      mgrs_projector->reverse(to_basic_point_3d_pt(local_point), projector_info.mgrs_grid);
+      mgrs_projector.reverse(to_basic_point_3d_pt(local_point), projector_info.mgrs_grid);
   } else {
     // project latitude and longitude using projector
     // note that the original projector such as UTM projector does not compensate for the altitude
     // offset
-    projected_gps_point = projector->reverse(to_basic_point_3d_pt(local_point));
+    projected_gps_point = projector.reverse(to_basic_point_3d_pt(local_point));
 
     // correct altitude based on the map origin
     // note that the converted altitude in local point is in the same vertical datum as the geo
@@ -92,4 +113,56 @@ GeoPoint project_reverse(const LocalPoint & local_point, const MapProjectorInfo
   return geo_point;
 }
 
+std::vector<LocalPoint> project_forward(
+  const std::vector<GeoPoint> & geo_points, const MapProjectorInfo & projector_info,
+  const size_t num_threads)
+{
+  // the projectors are not thread-safe, e.g. MGRSProjector keeps the last projected grid
+  const std::unique_ptr<lanelet::Projector> projector = get_lanelet2_projector(projector_info);
+
+  // a thread for each chunk of the points, which is large enough for the thread to pay off
+  constexpr size_t min_chunk_size = 1024;
+  const size_t max_threads = num_threads == 0 ? std::thread::hardware_concurrency() : num_threads;
+  const size_t thread_num = std::clamp<size_t>(
+    (geo_points.size() + min_chunk_size - 1) / min_chunk_size, 1, std::max<size_t>(max_threads, 1));
+  const size_t chunk_size = (geo_points.size() + thread_num - 1) / thread_num;
+
+  std::vector<LocalPoint> local_points(geo_points.size());
+  const auto project_chunk = [&](const size_t begin, const lanelet::Projector & chunk_projector) {
+    const size_t end = std::min(begin + chunk_size, geo_points.size());
+    for (size_t i = begin; i < end; ++i) {
+      local_points[i] = project_forward(geo_points[i], projector_info, chunk_projector);
+    }
+  };
+
+  // the exceptions of the threads, e.g. of an invalid latitude, are thrown to the caller
+  std::vector<std::exception_ptr> exceptions(thread_num);
+  std::vector<std::thread> threads;
+  for (size_t t = 1; t < thread_num; ++t) {
+    threads.emplace_back([&, t]() {
+      try {
+        const std::unique_ptr<lanelet::Projector> thread_projector =
+          get_lanelet2_projector(projector_info);
+        project_chunk(t * chunk_size, *thread_projector);
+      } catch (...) {
+        exceptions[t] = std::current_exception();
+      }
+    });
+  }
+  try {
+    project_chunk(0, *projector);
+  } catch (...) {
+    exceptions[0] = std::current_exception();
+  }
+  for (auto & thread : threads) {
+    thread.join();
+  }
+  for (const auto & exception : exceptions) {
+    if (exception) {
+      std::rethrow_exception(exception);
+    }
+  }
+  return local_points;
+}
+
 }  // namespace geography_utils
@@ -18,6 +18,7 @@
 
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 TEST(GeographyUtilsProjection, ProjectForwardToMGRS)
 {
@@ -159,3 +160,47 @@ TEST(GeographyUtilsProjection, ProjectForwardAndReverseLocalCartesianUTMOrigin)
   EXPECT_NEAR(converted_geo_point.longitude, geo_point.longitude, 0.0001);
   EXPECT_NEAR(converted_geo_point.altitude, geo_point.altitude, 0.0001);
 }
+
+TEST(GeographyUtilsProjection, ProjectForwardBatchIsSameAsEachPoint)
+{
+  std::vector<geographic_msgs::msg::GeoPoint> geo_points;
+  for (int i = 0; i < 5000; ++i) {
+    geographic_msgs::msg::GeoPoint geo_point;
+    geo_point.latitude = 35.62426 + i * 1e-5;
+    geo_point.longitude = 139.74252 - i * 1e-5;
+    geo_point.altitude = 10.0 + i * 1e-3;
+    geo_points.push_back(geo_point);
+  }
+
+  tier4_map_msgs::msg::MapProjectorInfo mgrs_info;
+  mgrs_info.projector_type = tier4_map_msgs::msg::MapProjectorInfo::MGRS;
+  mgrs_info.mgrs_grid = "54SUE";
+  mgrs_info.vertical_datum = tier4_map_msgs::msg::MapProjectorInfo::WGS84;
+
+  tier4_map_msgs::msg::MapProjectorInfo utm_info;
+  utm_info.projector_type = tier4_map_msgs::msg::MapProjectorInfo::LOCAL_CARTESIAN_UTM;
+  utm_info.vertical_datum = tier4_map_msgs::msg::MapProjectorInfo::WGS84;
+  utm_info.map_origin.latitude = 35.62426;
+  utm_info.map_origin.longitude = 139.74252;
+  utm_info.map_origin.altitude = 10.0;
+
+  for (const auto & projector_info : {mgrs_info, utm_info}) {
+    const auto local_points = geography_utils::project_forward(geo_points, projector_info, 4);
+    ASSERT_EQ(local_points.size(), geo_points.size());
+    for (size_t i = 0; i < geo_points.size(); ++i) {
+      const auto local_point = geography_utils::project_forward(geo_points[i], projector_info);
+      EXPECT_DOUBLE_EQ(local_points[i].x, local_point.x);
+      EXPECT_DOUBLE_EQ(local_points[i].y, local_point.y);
+      EXPECT_DOUBLE_EQ(local_points[i].z, local_point.z);
+    }
+  }
+}
+
+TEST(GeographyUtilsProjection, ProjectForwardBatchWithInvalidProjector)
+{
+  tier4_map_msgs::msg::MapProjectorInfo projector_info;
+  projector_info.projector_type = "INVALID_PROJECTOR";
+  const std::vector<geographic_msgs::msg::GeoPoint> geo_points(1);
+  EXPECT_THROW(
+    geography_utils::project_forward(geo_points, projector_info), std::invalid_argument);
+}
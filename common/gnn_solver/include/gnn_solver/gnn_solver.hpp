@@ -12,11 +12,11 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#ifndef MULTI_OBJECT_TRACKER__DATA_ASSOCIATION__SOLVER__GNN_SOLVER_HPP_
-#define MULTI_OBJECT_TRACKER__DATA_ASSOCIATION__SOLVER__GNN_SOLVER_HPP_
+#ifndef GNN_SOLVER__GNN_SOLVER_HPP_
+#define GNN_SOLVER__GNN_SOLVER_HPP_
 
-#include "multi_object_tracker/data_association/solver/gnn_solver_interface.hpp"
-#include "multi_object_tracker/data_association/solver/mu_successive_shortest_path.hpp"
-#include "multi_object_tracker/data_association/solver/successive_shortest_path.hpp"
+#include "gnn_solver/gnn_solver_interface.hpp"
+#include "gnn_solver/mu_successive_shortest_path.hpp"
+#include "gnn_solver/successive_shortest_path.hpp"
 
-#endif  // MULTI_OBJECT_TRACKER__DATA_ASSOCIATION__SOLVER__GNN_SOLVER_HPP_
+#endif  // GNN_SOLVER__GNN_SOLVER_HPP_
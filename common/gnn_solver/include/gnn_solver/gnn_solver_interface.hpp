@@ -0,0 +1,59 @@
+// Copyright 2021 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GNN_SOLVER__GNN_SOLVER_INTERFACE_HPP_
+#define GNN_SOLVER__GNN_SOLVER_INTERFACE_HPP_
+
+#include <unordered_map>
+#include <vector>
+
+namespace gnn_solver
+{
+/**
+ * Score matrix in CSR form. Only the pairs which may be assigned are stored, in ascending column
+ * order in a row, and the score of the other pairs is 0.
+ */
+struct SparseScoreMatrix
+{
+  int rows{0};
+  int cols{0};
+  std::vector<int> row_offsets;  // rows + 1 offsets into col_indices and values
+  std::vector<int> col_indices;
+  std::vector<double> values;
+};
+
+class GnnSolverInterface
+{
+public:
+  GnnSolverInterface() = default;
+  virtual ~GnnSolverInterface() = default;
+
+  virtual void maximizeLinearAssignment(
+    const std::vector<std::vector<double>> & cost, std::unordered_map<int, int> * direct_assignment,
+    std::unordered_map<int, int> * reverse_assignment) = 0;
+
+  /**
+   * Same assignment as maximizeLinearAssignment() of the dense matrix, up to ties, without the
+   * pairs of a score below score_threshold. Each connected component of the bipartite graph of
+   * the stored pairs is solved on its own, in parallel with num_threads, so
+   * maximizeLinearAssignment() must not modify the solver.
+   */
+  void maximizeSparseLinearAssignment(
+    const SparseScoreMatrix & score, const double score_threshold, const int num_threads,
+    std::unordered_map<int, int> * direct_assignment,
+    std::unordered_map<int, int> * reverse_assignment);
+};
+}  // namespace gnn_solver
+
+#endif  // GNN_SOLVER__GNN_SOLVER_INTERFACE_HPP_
@@ -0,0 +1,50 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GNN_SOLVER__SPATIAL_GRID_HPP_
+#define GNN_SOLVER__SPATIAL_GRID_HPP_
+
+#include <cstdint>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace gnn_solver
+{
+/**
+ * Index of 2D positions in square cells of cell_size. All the positions within cell_size of a
+ * position are in the 3x3 cells around it, so a pair of objects farther than the largest max
+ * distance of the dist gate can be skipped before its score is computed.
+ */
+class SpatialGrid
+{
+public:
+  SpatialGrid(
+    const double cell_size, const std::vector<double> & xs, const std::vector<double> & ys);
+
+  // indices of the positions in the 3x3 cells around (x, y), in ascending order
+  void findNeighbors(const double x, const double y, std::vector<int> & indices) const;
+
+private:
+  std::pair<std::int64_t, std::int64_t> getCell(const double x, const double y) const;
+  static std::uint64_t getCellKey(const std::int64_t cell_x, const std::int64_t cell_y);
+
+  double cell_size_;
+  // the positions sorted by cell, and the range of each cell in them
+  std::vector<int> sorted_indices_;
+  std::unordered_map<std::uint64_t, std::pair<int, int>> cell_ranges_;
+};
+}  // namespace gnn_solver
+
+#endif  // GNN_SOLVER__SPATIAL_GRID_HPP_
@@ -12,7 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
-#include "multi_object_tracker/data_association/solver/mu_successive_shortest_path.hpp"
+#include "gnn_solver/mu_successive_shortest_path.hpp"
 
 #include <mussp/mussp.h>
 
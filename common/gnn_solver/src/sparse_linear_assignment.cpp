@@ -0,0 +1,124 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gnn_solver/gnn_solver_interface.hpp"
+
+#include <algorithm>
+#include <numeric>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace gnn_solver
+{
+void GnnSolverInterface::maximizeSparseLinearAssignment(
+  const SparseScoreMatrix & score, const double score_threshold, const int num_threads,
+  std::unordered_map<int, int> * direct_assignment,
+  std::unordered_map<int, int> * reverse_assignment)
+{
+  // Connected components of the bipartite graph, rows are the nodes [0, rows), columns the nodes
+  // [rows, rows + cols)
+  std::vector<int> parents(score.rows + score.cols);
+  std::iota(parents.begin(), parents.end(), 0);
+  const auto find_root = [&parents](int node) {
+    while (parents[node] != node) {
+      parents[node] = parents[parents[node]];
+      node = parents[node];
+    }
+    return node;
+  };
+  for (int row = 0; row < score.rows; ++row) {
+    for (int k = score.row_offsets[row]; k < score.row_offsets[row + 1]; ++k) {
+      const int a = find_root(row);
+      const int b = find_root(score.rows + score.col_indices[k]);
+      if (a != b) {
+        parents[std::max(a, b)] = std::min(a, b);
+      }
+    }
+  }
+
+  struct Component
+  {
+    std::vector<int> rows;
+    std::vector<int> cols;
+    std::vector<std::pair<int, int>> assignment;  // (row, col)
+  };
+  std::vector<Component> components;
+  std::vector<int> component_ids(score.rows + score.cols, -1);
+  // Index of each column in its component
+  std::vector<int> local_cols(score.cols, -1);
+  for (int node = 0; node < score.rows + score.cols; ++node) {
+    // The root of a component is its smallest node, always a row
+    const int root = find_root(node);
+    const bool is_isolated =
+      root == node &&
+      (score.rows <= node || score.row_offsets[node] == score.row_offsets[node + 1]);
+    if (is_isolated) {
+      continue;
+    }
+    if (component_ids[root] == -1) {
+      component_ids[root] = static_cast<int>(components.size());
+      components.emplace_back();
+    }
+    auto & component = components[component_ids[root]];
+    if (node < score.rows) {
+      component.rows.push_back(node);
+    } else {
+      local_cols[node - score.rows] = static_cast<int>(component.cols.size());
+      component.cols.push_back(node - score.rows);
+    }
+  }
+
+  const int num_components = static_cast<int>(components.size());
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(std::max(num_threads, 1)) schedule(dynamic)
+#else
+  static_cast<void>(num_threads);
+#endif
+  for (int c = 0; c < num_components; ++c) {
+    auto & component = components[c];
+    // A single pair, the most frequent component, needs no solver
+    if (component.rows.size() == 1 && component.cols.size() == 1) {
+      const int row = component.rows.front();
+      if (score_threshold <= score.values[score.row_offsets[row]]) {
+        component.assignment.emplace_back(row, component.cols.front());
+      }
+      continue;
+    }
+
+    std::vector<std::vector<double>> local_score(
+      component.rows.size(), std::vector<double>(component.cols.size(), 0.0));
+    for (std::size_t i = 0; i < component.rows.size(); ++i) {
+      const int row = component.rows[i];
+      for (int k = score.row_offsets[row]; k < score.row_offsets[row + 1]; ++k) {
+        local_score[i][local_cols[score.col_indices[k]]] = score.values[k];
+      }
+    }
+    std::unordered_map<int, int> local_direct_assignment, local_reverse_assignment;
+    maximizeLinearAssignment(local_score, &local_direct_assignment, &local_reverse_assignment);
+    for (const auto & [i, j] : local_direct_assignment) {
+      if (score_threshold <= local_score[i][j]) {
+        component.assignment.emplace_back(component.rows[i], component.cols[j]);
+      }
+    }
+  }
+
+  for (const auto & component : components) {
+    for (const auto & [row, col] : component.assignment) {
+      (*direct_assignment)[row] = col;
+      (*reverse_assignment)[col] = row;
+    }
+  }
+}
+}  // namespace gnn_solver
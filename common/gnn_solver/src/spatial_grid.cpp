@@ -0,0 +1,79 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gnn_solver/spatial_grid.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace gnn_solver
+{
+SpatialGrid::SpatialGrid(
+  const double cell_size, const std::vector<double> & xs, const std::vector<double> & ys)
+: cell_size_(std::max(cell_size, 1e-3))
+{
+  std::vector<std::uint64_t> keys(xs.size());
+  for (std::size_t i = 0; i < xs.size(); ++i) {
+    const auto [cell_x, cell_y] = getCell(xs[i], ys[i]);
+    keys[i] = getCellKey(cell_x, cell_y);
+  }
+  // sorted by cell and then by index, so that the indices of a cell are in ascending order
+  sorted_indices_.resize(xs.size());
+  std::iota(sorted_indices_.begin(), sorted_indices_.end(), 0);
+  std::sort(sorted_indices_.begin(), sorted_indices_.end(), [&keys](const int a, const int b) {
+    return keys[a] < keys[b] || (keys[a] == keys[b] && a < b);
+  });
+  cell_ranges_.reserve(xs.size());
+  for (int begin = 0; begin < static_cast<int>(sorted_indices_.size());) {
+    const std::uint64_t key = keys[sorted_indices_[begin]];
+    int end = begin + 1;
+    while (end < static_cast<int>(sorted_indices_.size()) && keys[sorted_indices_[end]] == key) {
+      ++end;
+    }
+    cell_ranges_.emplace(key, std::make_pair(begin, end));
+    begin = end;
+  }
+}
+
+void SpatialGrid::findNeighbors(const double x, const double y, std::vector<int> & indices) const
+{
+  indices.clear();
+  const auto [cell_x, cell_y] = getCell(x, y);
+  for (std::int64_t dx = -1; dx <= 1; ++dx) {
+    for (std::int64_t dy = -1; dy <= 1; ++dy) {
+      const auto cell_range = cell_ranges_.find(getCellKey(cell_x + dx, cell_y + dy));
+      if (cell_range == cell_ranges_.end()) {
+        continue;
+      }
+      indices.insert(
+        indices.end(), sorted_indices_.begin() + cell_range->second.first,
+        sorted_indices_.begin() + cell_range->second.second);
+    }
+  }
+  std::sort(indices.begin(), indices.end());
+}
+
+std::pair<std::int64_t, std::int64_t> SpatialGrid::getCell(const double x, const double y) const
+{
+  return std::make_pair(
+    static_cast<std::int64_t>(std::floor(x / cell_size_)),
+    static_cast<std::int64_t>(std::floor(y / cell_size_)));
+}
+
+std::uint64_t SpatialGrid::getCellKey(const std::int64_t cell_x, const std::int64_t cell_y)
+{
+  return (static_cast<std::uint64_t>(cell_x) << 32) ^ static_cast<std::uint32_t>(cell_y);
+}
+}  // namespace gnn_solver
@@ -0,0 +1,147 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gnn_solver/spatial_grid.hpp"
+#include "gnn_solver/successive_shortest_path.hpp"
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <unordered_map>
+#include <vector>
+
+namespace
+{
+constexpr double SCORE_THRESHOLD = 0.01;
+
+double sumScores(
+  const std::vector<std::vector<double>> & score,
+  const std::unordered_map<int, int> & direct_assignment)
+{
+  double sum = 0.0;
+  for (const auto & [row, col] : direct_assignment) {
+    if (SCORE_THRESHOLD <= score[row][col]) {
+      sum += score[row][col];
+    }
+  }
+  return sum;
+}
+
+gnn_solver::SparseScoreMatrix toSparse(const std::vector<std::vector<double>> & score)
+{
+  gnn_solver::SparseScoreMatrix sparse;
+  sparse.rows = static_cast<int>(score.size());
+  sparse.cols = score.empty() ? 0 : static_cast<int>(score.front().size());
+  sparse.row_offsets.push_back(0);
+  for (const auto & row : score) {
+    for (int col = 0; col < sparse.cols; ++col) {
+      if (row[col] > 0.0) {
+        sparse.col_indices.push_back(col);
+        sparse.values.push_back(row[col]);
+      }
+    }
+    sparse.row_offsets.push_back(static_cast<int>(sparse.col_indices.size()));
+  }
+  return sparse;
+}
+}  // namespace
+
+TEST(gnn_solver, sparse_assignment_matches_dense)
+{
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> position(0.0, 50.0);
+  for (int trial = 0; trial < 50; ++trial) {
+    const int rows = 1 + trial % 17;
+    const int cols = 1 + (trial * 7) % 13;
+    std::vector<double> row_xs(rows), row_ys(rows), col_xs(cols), col_ys(cols);
+    for (int i = 0; i < rows; ++i) {
+      row_xs[i] = position(engine);
+      row_ys[i] = position(engine);
+    }
+    for (int j = 0; j < cols; ++j) {
+      col_xs[j] = position(engine);
+      col_ys[j] = position(engine);
+    }
+    // the same score as the dist gate of the data associations
+    const double max_dist = 8.0;
+    std::vector<std::vector<double>> score(rows, std::vector<double>(cols, 0.0));
+    for (int i = 0; i < rows; ++i) {
+      for (int j = 0; j < cols; ++j) {
+        const double dist = std::hypot(row_xs[i] - col_xs[j], row_ys[i] - col_ys[j]);
+        if (dist <= max_dist) {
+          score[i][j] = (max_dist - dist) / max_dist;
+        }
+        if (score[i][j] < SCORE_THRESHOLD) {
+          score[i][j] = 0.0;
+        }
+      }
+    }
+
+    gnn_solver::SSP solver;
+    std::unordered_map<int, int> dense_direct, dense_reverse;
+    solver.maximizeLinearAssignment(score, &dense_direct, &dense_reverse);
+    std::unordered_map<int, int> sparse_direct, sparse_reverse;
+    solver.maximizeSparseLinearAssignment(
+      toSparse(score), SCORE_THRESHOLD, 2, &sparse_direct, &sparse_reverse);
+
+    EXPECT_NEAR(sumScores(score, dense_direct), sumScores(score, sparse_direct), 1e-9);
+    EXPECT_EQ(sparse_direct.size(), sparse_reverse.size());
+    for (const auto & [row, col] : sparse_direct) {
+      EXPECT_EQ(sparse_reverse.at(col), row);
+      EXPECT_LE(SCORE_THRESHOLD, score[row][col]);
+    }
+  }
+}
+
+TEST(gnn_solver, sparse_assignment_empty)
+{
+  gnn_solver::SSP solver;
+  gnn_solver::SparseScoreMatrix score;
+  score.rows = 3;
+  score.cols = 2;
+  score.row_offsets = {0, 0, 0, 0};
+  std::unordered_map<int, int> direct_assignment, reverse_assignment;
+  solver.maximizeSparseLinearAssignment(
+    score, SCORE_THRESHOLD, 1, &direct_assignment, &reverse_assignment);
+  EXPECT_TRUE(direct_assignment.empty());
+  EXPECT_TRUE(reverse_assignment.empty());
+}
+
+TEST(gnn_solver, spatial_grid_finds_all_neighbors)
+{
+  std::mt19937 engine(1);
+  std::uniform_real_distribution<double> position(-30.0, 30.0);
+  const double cell_size = 4.0;
+  std::vector<double> xs(200), ys(200);
+  for (std::size_t i = 0; i < xs.size(); ++i) {
+    xs[i] = position(engine);
+    ys[i] = position(engine);
+  }
+  const gnn_solver::SpatialGrid grid(cell_size, xs, ys);
+
+  std::vector<int> indices;
+  for (int query = 0; query < 100; ++query) {
+    const double x = position(engine);
+    const double y = position(engine);
+    grid.findNeighbors(x, y, indices);
+    EXPECT_TRUE(std::is_sorted(indices.begin(), indices.end()));
+    for (std::size_t i = 0; i < xs.size(); ++i) {
+      if (std::hypot(xs[i] - x, ys[i] - y) <= cell_size) {
+        EXPECT_TRUE(std::binary_search(indices.begin(), indices.end(), static_cast<int>(i)));
+      }
+    }
+  }
+}
@@ -21,6 +21,7 @@
 #include <grid_map_core/GridMapMath.hpp>
 #include <grid_map_core/Polygon.hpp>
 
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -42,6 +43,14 @@ struct Edge
   }
 };
 
+/// @brief Run of consecutive cells in a row of the grid map data
+struct IndexSpan
+{
+  int row;        ///< row of the cells in the data matrix
+  int col_begin;  ///< column of the first cell in the data matrix
+  int col_end;    ///< column after the last cell in the data matrix
+};
+
 /** @brief A polygon iterator for grid_map::GridMap based on the scan line algorithm.
     @details This iterator allows to iterate over all cells whose center is inside a polygon. \
              This reproduces the behavior of the original grid_map::PolygonIterator which uses\
@@ -72,6 +81,17 @@ public:
   /// @return true if iterator is out of scope, false if end has not been reached.
   [[nodiscard]] bool isPastEnd() const;
 
+  /** @brief Calculate the cells inside a polygon as runs of consecutive cells of each row.
+      @details The spans cover the same cells as the iterator, in the same order. A run is split
+               where its columns wrap around the circular buffer of the grid map, so that each span
+               is a block of the data matrix of a layer.
+      @param grid_map the grid map.
+      @param polygon the polygonal area.
+      @return the spans of the cells inside the polygon.
+  */
+  static std::vector<IndexSpan> calculateSpans(
+    const grid_map::GridMap & grid_map, const grid_map::Polygon & polygon);
+
 private:
   /** @brief Calculate sorted edges of the given polygon.
       @details Vertices in an edge are ordered from higher to lower x.
@@ -101,29 +121,22 @@ private:
     const std::vector<Edge> & edges, const grid_map::Position & origin,
     const grid_map::GridMap & grid_map);
 
-  // Helper functions
-  /// @brief Increment the current_line_ to the line with intersections
-  void goToNextLine();
-  /// @brief Calculate the initial current_col_ and the current_to_col_ for the current intersection
-  void calculateColumnIndexes();
-  /// @brief Calculate the current_index_ from the current_line_ and current_col_
-  void calculateIndex();
-
-  /// Gridmap info
-  int row_of_first_line_;
-  grid_map::Index map_start_idx_;
-  grid_map::Size map_size_;
-  double map_resolution_;
-  double map_origin_y_;
-  /// Intersections between scan lines and the polygon
-  std::vector<std::vector<double>> intersections_per_line_;
-  std::vector<double>::const_iterator intersection_iter_;
+  /// Spans of the cells inside the polygon
+  std::vector<IndexSpan> spans_;
   /// current indexes
   grid_map::Index current_index_;
-  size_t current_line_;
-  int current_col_;
-  int current_to_col_;
+  size_t current_span_ = 0;
 };
+
+/// @brief Set a value to the cells inside any of the polygons.
+/// @details The cells are set span by span on the data matrix of the layer.
+/// @param grid_map the grid map.
+/// @param layer the layer to set.
+/// @param polygons the polygonal areas.
+/// @param value the value to set.
+void fillPolygons(
+  grid_map::GridMap & grid_map, const std::string & layer,
+  const std::vector<grid_map::Polygon> & polygons, const float value);
 }  // namespace grid_map_utils
 
 #endif  // GRID_MAP_UTILS__POLYGON_ITERATOR_HPP_
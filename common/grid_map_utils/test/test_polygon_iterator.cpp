@@ -278,3 +278,68 @@ TEST(PolygonIterator, SelfCrossingPolygon)
   }
   EXPECT_FALSE(diff);
 }
+
+TEST(PolygonIterator, Spans)
+{
+  GridMap map({"layer"});
+  map.setGeometry(Length(5.0, 8.0), 1.0, Position(0.0, 0.0));  // bufferSize(5, 8)
+  map.move(Position(0.0, 2.0));
+
+  Polygon polygon;
+  polygon.addVertex(Position(1.6, 4.6));
+  polygon.addVertex(Position(-1.6, 4.6));
+  polygon.addVertex(Position(-1.6, -1.6));
+  polygon.addVertex(Position(1.6, -1.6));
+
+  // the spans are split where the columns wrap around the circular buffer
+  const auto spans = grid_map_utils::PolygonIterator::calculateSpans(map, polygon);
+  ASSERT_EQ(spans.size(), 6lu);
+  for (size_t i = 0; i < spans.size(); i += 2) {
+    EXPECT_EQ(spans[i].row, static_cast<int>(i / 2 + 1));
+    EXPECT_EQ(spans[i].col_begin, 7);
+    EXPECT_EQ(spans[i].col_end, 8);
+    EXPECT_EQ(spans[i + 1].row, static_cast<int>(i / 2 + 1));
+    EXPECT_EQ(spans[i + 1].col_begin, 0);
+    EXPECT_EQ(spans[i + 1].col_end, 6);
+  }
+
+  // the spans cover the cells of the iterator in the same order
+  grid_map_utils::PolygonIterator iterator(map, polygon);
+  for (const auto & span : spans) {
+    for (int col = span.col_begin; col < span.col_end; ++col) {
+      ASSERT_FALSE(iterator.isPastEnd());
+      EXPECT_EQ((*iterator)(0), span.row);
+      EXPECT_EQ((*iterator)(1), col);
+      ++iterator;
+    }
+  }
+  EXPECT_TRUE(iterator.isPastEnd());
+}
+
+TEST(PolygonIterator, FillPolygons)
+{
+  GridMap map({"layer"});
+  map.setGeometry(Length(8.0, 5.0), 1.0, Position(0.0, 0.0));  // bufferSize(8, 5)
+  map.move(Position(2.0, 1.0));
+  map["layer"].setConstant(0.0);
+
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<double> dist(-4.0, 6.0);
+  std::vector<Polygon> polygons(3);
+  for (auto & polygon : polygons) {
+    for (int i = 0; i < 5; ++i) polygon.addVertex(Position(dist(gen), dist(gen)));
+  }
+  grid_map_utils::fillPolygons(map, "layer", polygons, 1.0);
+
+  GridMap expected_map({"layer"});
+  expected_map.setGeometry(Length(8.0, 5.0), 1.0, Position(0.0, 0.0));
+  expected_map.move(Position(2.0, 1.0));
+  expected_map["layer"].setConstant(0.0);
+  for (const auto & polygon : polygons) {
+    for (grid_map_utils::PolygonIterator iterator(expected_map, polygon); !iterator.isPastEnd();
+         ++iterator) {
+      expected_map.at("layer", *iterator) = 1.0;
+    }
+  }
+  EXPECT_TRUE(map["layer"].isApprox(expected_map["layer"]));
+}
@@ -31,6 +31,12 @@ double lerp(
   const std::vector<double> & base_keys, const std::vector<double> & base_values,
   const double query_key);
 
+// interpolate several sequences of values which share the same base keys. The query keys are
+// validated and searched once for all the sequences.
+std::vector<std::vector<double>> lerp(
+  const std::vector<double> & base_keys, const std::vector<std::vector<double>> & base_values_list,
+  const std::vector<double> & query_keys);
+
 }  // namespace interpolation
 
 #endif  // INTERPOLATION__LINEAR_INTERPOLATION_HPP_
@@ -19,6 +19,7 @@
 #include "tier4_autoware_utils/geometry/geometry.hpp"
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <iostream>
 #include <numeric>
@@ -65,6 +66,17 @@ std::vector<double> splineByAkima(
 //   base_keys, query_keys1);
 // const auto interpolation_result2 = spline.getSplineInterpolatedValues(
 //   base_keys, query_keys2);
+//
+// // refit in place, reusing the internal buffers
+// spline.calcSplineCoefficients(base_keys, base_values2);
+//
+// // evaluate value, 1st and 2nd differential at once with a forward-walking segment index
+// size_t seg_idx = 0;
+// for (const double query_key : query_keys1) {
+//   seg_idx = spline.getSegmentIndex(query_key, seg_idx);
+//   const auto [value, diff, quad_diff] =
+//     spline.getSplineInterpolatedValueAndDiffs(query_key, seg_idx);
+// }
 // ```
 class SplineInterpolation
 {
@@ -76,6 +88,11 @@ public:
     calcSplineCoefficients(base_keys, base_values);
   }
 
+  //!< @brief calculate spline coefficients. The internal buffers are reused, so that refitting
+  //            splines of the same size does not allocate memory.
+  void calcSplineCoefficients(
+    const std::vector<double> & base_keys, const std::vector<double> & base_values);
+
   //!< @brief get values of spline interpolation on designated sampling points.
   //!< @details Assuming that query_keys are t vector for sampling, and interpolation is for x,
   //            meaning that spline interpolation was applied to x(t),
@@ -95,14 +112,41 @@ public:
   std::vector<double> getSplineInterpolatedQuadDiffValues(
     const std::vector<double> & query_keys) const;
 
+  //!< @brief get index of the spline segment which query_key belongs to.
+  //!< @details The result is same as the one of getSplineInterpolatedValues, and query_key out of
+  //            base_keys is assigned to the first or last segment.
+  size_t getSegmentIndex(const double query_key) const;
+
+  //!< @brief get index of the spline segment which query_key belongs to, walking forward from
+  //            start_idx.
+  //!< @details This is faster than the binary search when query keys are monotonically
+  //            increasing and the previous result is given as start_idx. When query_key is
+  //            behind start_idx, this falls back to the binary search.
+  size_t getSegmentIndex(const double query_key, const size_t start_idx) const;
+
+  //!< @brief get value, 1st and 2nd differential values of spline interpolation at once.
+  //!< @details seg_idx has to be the result of getSegmentIndex for query_key. Unlike
+  //            getSplineInterpolatedValues, query_key is not validated, and the spline is
+  //            extrapolated when query_key is out of base_keys.
+  std::array<double, 3> getSplineInterpolatedValueAndDiffs(
+    const double query_key, const size_t seg_idx) const;
+  std::array<double, 3> getSplineInterpolatedValueAndDiffs(const double query_key) const
+  {
+    return getSplineInterpolatedValueAndDiffs(query_key, getSegmentIndex(query_key));
+  }
+
   size_t getSize() const { return base_keys_.size(); }
 
 private:
   std::vector<double> base_keys_;
   interpolation::MultiSplineCoef multi_spline_coef_;
 
-  void calcSplineCoefficients(
-    const std::vector<double> & base_keys, const std::vector<double> & base_values);
+  // workspace of calcSplineCoefficients
+  std::vector<double> diff_keys_;
+  std::vector<double> diff_values_;
+  std::vector<double> second_diff_values_;
+  std::vector<double> tdma_p_;
+  std::vector<double> tdma_q_;
 };
 
 #endif  // INTERPOLATION__SPLINE_INTERPOLATION_HPP_
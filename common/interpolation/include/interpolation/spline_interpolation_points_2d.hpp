@@ -51,11 +51,18 @@ public:
   template <typename T>
   explicit SplineInterpolationPoints2d(const std::vector<T> & points)
   {
-    std::vector<geometry_msgs::msg::Point> points_inner;
+    calcSplineCoefficients(points);
+  }
+
+  // refit splines in place, reusing the internal buffers
+  template <typename T>
+  void calcSplineCoefficients(const std::vector<T> & points)
+  {
+    points_inner_.clear();
     for (const auto & p : points) {
-      points_inner.push_back(tier4_autoware_utils::getPoint(p));
+      points_inner_.push_back(tier4_autoware_utils::getPoint(p));
     }
-    calcSplineCoefficientsInner(points_inner);
+    calcSplineCoefficientsInner(points_inner_);
   }
 
   // TODO(murooka) implement these functions
@@ -87,6 +94,12 @@ private:
   SplineInterpolation spline_z_;
 
   std::vector<double> base_s_vec_;
+
+  // workspace of calcSplineCoefficients
+  std::vector<geometry_msgs::msg::Point> points_inner_;
+  std::vector<double> base_x_vec_;
+  std::vector<double> base_y_vec_;
+  std::vector<double> base_z_vec_;
 };
 
 #endif  // INTERPOLATION__SPLINE_INTERPOLATION_POINTS_2D_HPP_
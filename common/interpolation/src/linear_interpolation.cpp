@@ -56,4 +56,38 @@ double lerp(
 {
   return lerp(base_keys, base_values, std::vector<double>{query_key}).front();
 }
+
+std::vector<std::vector<double>> lerp(
+  const std::vector<double> & base_keys, const std::vector<std::vector<double>> & base_values_list,
+  const std::vector<double> & query_keys)
+{
+  // throw exception for invalid arguments
+  const auto validated_query_keys = interpolation_utils::validateKeys(base_keys, query_keys);
+  for (const auto & base_values : base_values_list) {
+    interpolation_utils::validateKeysAndValues(base_keys, base_values);
+  }
+
+  // calculate linear interpolation
+  std::vector<std::vector<double>> query_values_list(base_values_list.size());
+  for (auto & query_values : query_values_list) {
+    query_values.reserve(validated_query_keys.size());
+  }
+  size_t key_index = 0;
+  for (const auto query_key : validated_query_keys) {
+    while (base_keys.at(key_index + 1) < query_key) {
+      ++key_index;
+    }
+
+    const double ratio = (query_key - base_keys.at(key_index)) /
+                         (base_keys.at(key_index + 1) - base_keys.at(key_index));
+
+    for (size_t i = 0; i < base_values_list.size(); ++i) {
+      const double src_val = base_values_list.at(i).at(key_index);
+      const double dst_val = base_values_list.at(i).at(key_index + 1);
+      query_values_list.at(i).push_back(lerp(src_val, dst_val, ratio));
+    }
+  }
+
+  return query_values_list;
+}
 }  // namespace interpolation
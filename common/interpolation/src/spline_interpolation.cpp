@@ -14,6 +14,10 @@
 
 #include "interpolation/spline_interpolation.hpp"
 
+#include <algorithm>
+#include <array>
+#include <iterator>
+#include <stdexcept>
 #include <vector>
 
 namespace
@@ -25,57 +29,44 @@ namespace
 // A = [            ...                   ]
 //     [   O         ... a_N-3 b_N-2 c_N-2]
 //     [                   ... a_N-2 b_N-1]
-struct TDMACoef
+// for the second differential values of the spline, where
+//   a_i = c_i = h_i+1, b_i = 2 (h_i + h_i+1), d_i = 6 (dy_i+1 / h_i+1 - dy_i / h_i)
+// with h and dy being diff_keys and diff_values.
+// The solution is written to x[1] ... x[N-1], and p, q are used as workspace.
+void solveTridiagonalMatrixAlgorithm(
+  const std::vector<double> & diff_keys, const std::vector<double> & diff_values,
+  std::vector<double> & p, std::vector<double> & q, std::vector<double> & x)
 {
-  explicit TDMACoef(const size_t num_row)
-  {
-    a.resize(num_row - 1);
-    b.resize(num_row);
-    c.resize(num_row - 1);
-    d.resize(num_row);
-  }
-
-  std::vector<double> a;
-  std::vector<double> b;
-  std::vector<double> c;
-  std::vector<double> d;
-};
-
-inline std::vector<double> solveTridiagonalMatrixAlgorithm(const TDMACoef & tdma_coef)
-{
-  const auto & a = tdma_coef.a;
-  const auto & b = tdma_coef.b;
-  const auto & c = tdma_coef.c;
-  const auto & d = tdma_coef.d;
+  const size_t num_row = diff_keys.size() - 1;
 
-  const size_t num_row = b.size();
+  const auto b = [&](const size_t i) { return 2 * (diff_keys[i] + diff_keys[i + 1]); };
+  const auto d = [&](const size_t i) {
+    return 6.0 * (diff_values[i + 1] / diff_keys[i + 1] - diff_values[i] / diff_keys[i]);
+  };
 
-  std::vector<double> x(num_row);
   if (num_row != 1) {
     // calculate p and q
-    std::vector<double> p;
-    std::vector<double> q;
-    p.push_back(-c[0] / b[0]);
-    q.push_back(d[0] / b[0]);
+    p.resize(num_row);
+    q.resize(num_row);
+    p[0] = -diff_keys[1] / b(0);
+    q[0] = d(0) / b(0);
 
     for (size_t i = 1; i < num_row; ++i) {
-      const double den = b[i] + a[i - 1] * p[i - 1];
-      p.push_back(-c[i - 1] / den);
-      q.push_back((d[i] - a[i - 1] * q[i - 1]) / den);
+      const double den = b(i) + diff_keys[i] * p[i - 1];
+      p[i] = -diff_keys[i] / den;
+      q[i] = (d(i) - diff_keys[i] * q[i - 1]) / den;
     }
 
     // calculate solution
-    x[num_row - 1] = q[num_row - 1];
+    x[num_row] = q[num_row - 1];
 
     for (size_t i = 1; i < num_row; ++i) {
       const size_t j = num_row - 1 - i;
-      x[j] = p[j] * x[j + 1] + q[j];
+      x[j + 1] = p[j] * x[j + 2] + q[j];
     }
   } else {
-    x[0] = (d[0] / b[0]);
+    x[1] = (d(0) / b(0));
   }
-
-  return x;
 }
 }  // namespace
 
@@ -174,46 +165,35 @@ void SplineInterpolation::calcSplineCoefficients(
 
   const size_t num_base = base_keys.size();  // N+1
 
-  std::vector<double> diff_keys;    // N
-  std::vector<double> diff_values;  // N
+  diff_keys_.resize(num_base - 1);    // N
+  diff_values_.resize(num_base - 1);  // N
   for (size_t i = 0; i < num_base - 1; ++i) {
-    diff_keys.push_back(base_keys.at(i + 1) - base_keys.at(i));
-    diff_values.push_back(base_values.at(i + 1) - base_values.at(i));
+    diff_keys_[i] = base_keys[i + 1] - base_keys[i];
+    diff_values_[i] = base_values[i + 1] - base_values[i];
   }
 
-  std::vector<double> v = {0.0};
+  // calculate v
+  auto & v = second_diff_values_;
+  v.assign(num_base, 0.0);
   if (num_base > 2) {
     // solve tridiagonal matrix algorithm
-    TDMACoef tdma_coef(num_base - 2);  // N-1
-
-    for (size_t i = 0; i < num_base - 2; ++i) {
-      tdma_coef.b[i] = 2 * (diff_keys[i] + diff_keys[i + 1]);
-      if (i != num_base - 3) {
-        tdma_coef.a[i] = diff_keys[i + 1];
-        tdma_coef.c[i] = diff_keys[i + 1];
-      }
-      tdma_coef.d[i] =
-        6.0 * (diff_values[i + 1] / diff_keys[i + 1] - diff_values[i] / diff_keys[i]);
-    }
-
-    const std::vector<double> tdma_res = solveTridiagonalMatrixAlgorithm(tdma_coef);
-
-    // calculate v
-    v.insert(v.end(), tdma_res.begin(), tdma_res.end());
+    solveTridiagonalMatrixAlgorithm(diff_keys_, diff_values_, tdma_p_, tdma_q_, v);
   }
-  v.push_back(0.0);
 
   // calculate a, b, c, d of spline coefficients
-  multi_spline_coef_ = interpolation::MultiSplineCoef{num_base - 1};  // N
+  auto & coef = multi_spline_coef_;
+  coef.a.resize(num_base - 1);  // N
+  coef.b.resize(num_base - 1);
+  coef.c.resize(num_base - 1);
+  coef.d.resize(num_base - 1);
   for (size_t i = 0; i < num_base - 1; ++i) {
-    multi_spline_coef_.a[i] = (v[i + 1] - v[i]) / 6.0 / diff_keys[i];
-    multi_spline_coef_.b[i] = v[i] / 2.0;
-    multi_spline_coef_.c[i] =
-      diff_values[i] / diff_keys[i] - diff_keys[i] * (2 * v[i] + v[i + 1]) / 6.0;
-    multi_spline_coef_.d[i] = base_values[i];
+    coef.a[i] = (v[i + 1] - v[i]) / 6.0 / diff_keys_[i];
+    coef.b[i] = v[i] / 2.0;
+    coef.c[i] = diff_values_[i] / diff_keys_[i] - diff_keys_[i] * (2 * v[i] + v[i + 1]) / 6.0;
+    coef.d[i] = base_values[i];
   }
 
-  base_keys_ = base_keys;
+  base_keys_.assign(base_keys.begin(), base_keys.end());
 }
 
 std::vector<double> SplineInterpolation::getSplineInterpolatedValues(
@@ -287,3 +267,45 @@ std::vector<double> SplineInterpolation::getSplineInterpolatedQuadDiffValues(
 
   return res;
 }
+
+size_t SplineInterpolation::getSegmentIndex(const double query_key) const
+{
+  if (base_keys_.size() < 2) {
+    throw std::invalid_argument("The size of points is less than 2.");
+  }
+
+  // the first segment whose end is not less than query_key, as the forward walk in
+  // getSplineInterpolatedValues finds
+  const auto itr = std::lower_bound(base_keys_.begin() + 1, base_keys_.end() - 1, query_key);
+  return static_cast<size_t>(std::distance(base_keys_.begin() + 1, itr));
+}
+
+size_t SplineInterpolation::getSegmentIndex(const double query_key, const size_t start_idx) const
+{
+  if (base_keys_.size() < 2) {
+    throw std::invalid_argument("The size of points is less than 2.");
+  }
+
+  size_t j = std::min(start_idx, base_keys_.size() - 2);
+  if (0 < j && query_key <= base_keys_[j]) {
+    return getSegmentIndex(query_key);
+  }
+
+  while (j < base_keys_.size() - 2 && base_keys_[j + 1] < query_key) {
+    ++j;
+  }
+  return j;
+}
+
+std::array<double, 3> SplineInterpolation::getSplineInterpolatedValueAndDiffs(
+  const double query_key, const size_t seg_idx) const
+{
+  const double a = multi_spline_coef_.a.at(seg_idx);
+  const double b = multi_spline_coef_.b.at(seg_idx);
+  const double c = multi_spline_coef_.c.at(seg_idx);
+  const double d = multi_spline_coef_.d.at(seg_idx);
+
+  const double ds = query_key - base_keys_.at(seg_idx);
+  return {
+    d + (c + (b + a * ds) * ds) * ds, c + (2.0 * b + 3.0 * a * ds) * ds, 2.0 * b + 6.0 * a * ds};
+}
@@ -14,34 +14,36 @@
 
 #include "interpolation/spline_interpolation_points_2d.hpp"
 
+#include <algorithm>
+#include <array>
 #include <vector>
 
 namespace
 {
-std::vector<double> calcEuclidDist(const std::vector<double> & x, const std::vector<double> & y)
+void calcEuclidDist(
+  const std::vector<double> & x, const std::vector<double> & y, std::vector<double> & dist_v)
 {
+  dist_v.clear();
   if (x.size() != y.size()) {
-    return std::vector<double>{};
+    return;
   }
 
-  std::vector<double> dist_v;
   dist_v.push_back(0.0);
   for (size_t i = 0; i < x.size() - 1; ++i) {
     const double dx = x.at(i + 1) - x.at(i);
     const double dy = y.at(i + 1) - y.at(i);
     dist_v.push_back(dist_v.at(i) + std::hypot(dx, dy));
   }
-
-  return dist_v;
 }
 
-std::array<std::vector<double>, 4> getBaseValues(
-  const std::vector<geometry_msgs::msg::Point> & points)
+void getBaseValues(
+  const std::vector<geometry_msgs::msg::Point> & points, std::vector<double> & base_s,
+  std::vector<double> & base_x, std::vector<double> & base_y, std::vector<double> & base_z)
 {
   // calculate x, y
-  std::vector<double> base_x;
-  std::vector<double> base_y;
-  std::vector<double> base_z;
+  base_x.clear();
+  base_y.clear();
+  base_z.clear();
   for (size_t i = 0; i < points.size(); i++) {
     const auto & current_pos = points.at(i);
     if (i > 0) {
@@ -62,9 +64,19 @@ std::array<std::vector<double>, 4> getBaseValues(
     throw std::logic_error("The number of unique points is not enough.");
   }
 
-  const std::vector<double> base_s = calcEuclidDist(base_x, base_y);
+  calcEuclidDist(base_x, base_y, base_s);
+}
 
-  return {base_s, base_x, base_y, base_z};
+// curvature from the value, 1st and 2nd differential values of x and y splines
+double calcCurvature(const std::array<double, 3> & x, const std::array<double, 3> & y)
+{
+  const double diff_x = x.at(1);
+  const double diff_y = y.at(1);
+  const double quad_diff_x = x.at(2);
+  const double quad_diff_y = y.at(2);
+
+  return (diff_x * quad_diff_y - quad_diff_x * diff_y) /
+         std::pow(std::pow(diff_x, 2) + std::pow(diff_y, 2), 1.5);
 }
 }  // namespace
 
@@ -137,14 +149,13 @@ geometry_msgs::msg::Point SplineInterpolationPoints2d::getSplineInterpolatedPoin
     whole_s = base_s_vec_.back();
   }
 
-  const double x = spline_x_.getSplineInterpolatedValues({whole_s}).at(0);
-  const double y = spline_y_.getSplineInterpolatedValues({whole_s}).at(0);
-  const double z = spline_z_.getSplineInterpolatedValues({whole_s}).at(0);
+  // x, y and z splines share the base keys
+  const size_t seg_idx = spline_x_.getSegmentIndex(whole_s);
 
   geometry_msgs::msg::Point geom_point;
-  geom_point.x = x;
-  geom_point.y = y;
-  geom_point.z = z;
+  geom_point.x = spline_x_.getSplineInterpolatedValueAndDiffs(whole_s, seg_idx).at(0);
+  geom_point.y = spline_y_.getSplineInterpolatedValueAndDiffs(whole_s, seg_idx).at(0);
+  geom_point.z = spline_z_.getSplineInterpolatedValueAndDiffs(whole_s, seg_idx).at(0);
   return geom_point;
 }
 
@@ -156,19 +167,25 @@ double SplineInterpolationPoints2d::getSplineInterpolatedYaw(const size_t idx, c
 
   const double whole_s =
     std::clamp(base_s_vec_.at(idx) + s, base_s_vec_.front(), base_s_vec_.back());
+  const size_t seg_idx = spline_x_.getSegmentIndex(whole_s);
 
-  const double diff_x = spline_x_.getSplineInterpolatedDiffValues({whole_s}).at(0);
-  const double diff_y = spline_y_.getSplineInterpolatedDiffValues({whole_s}).at(0);
+  const double diff_x = spline_x_.getSplineInterpolatedValueAndDiffs(whole_s, seg_idx).at(1);
+  const double diff_y = spline_y_.getSplineInterpolatedValueAndDiffs(whole_s, seg_idx).at(1);
 
   return std::atan2(diff_y, diff_x);
 }
 
 std::vector<double> SplineInterpolationPoints2d::getSplineInterpolatedYaws() const
 {
+  // base_s_vec_ is increasing, so the segment index is walked forward
   std::vector<double> yaw_vec;
-  for (size_t i = 0; i < spline_x_.getSize(); ++i) {
-    const double yaw = getSplineInterpolatedYaw(i, 0.0);
-    yaw_vec.push_back(yaw);
+  yaw_vec.reserve(base_s_vec_.size());
+  size_t seg_idx = 0;
+  for (const double s : base_s_vec_) {
+    seg_idx = spline_x_.getSegmentIndex(s, seg_idx);
+    const double diff_x = spline_x_.getSplineInterpolatedValueAndDiffs(s, seg_idx).at(1);
+    const double diff_y = spline_y_.getSplineInterpolatedValueAndDiffs(s, seg_idx).at(1);
+    yaw_vec.push_back(std::atan2(diff_y, diff_x));
   }
   return yaw_vec;
 }
@@ -182,23 +199,24 @@ double SplineInterpolationPoints2d::getSplineInterpolatedCurvature(
 
   const double whole_s =
     std::clamp(base_s_vec_.at(idx) + s, base_s_vec_.front(), base_s_vec_.back());
+  const size_t seg_idx = spline_x_.getSegmentIndex(whole_s);
 
-  const double diff_x = spline_x_.getSplineInterpolatedDiffValues({whole_s}).at(0);
-  const double diff_y = spline_y_.getSplineInterpolatedDiffValues({whole_s}).at(0);
-
-  const double quad_diff_x = spline_x_.getSplineInterpolatedQuadDiffValues({whole_s}).at(0);
-  const double quad_diff_y = spline_y_.getSplineInterpolatedQuadDiffValues({whole_s}).at(0);
-
-  return (diff_x * quad_diff_y - quad_diff_x * diff_y) /
-         std::pow(std::pow(diff_x, 2) + std::pow(diff_y, 2), 1.5);
+  return calcCurvature(
+    spline_x_.getSplineInterpolatedValueAndDiffs(whole_s, seg_idx),
+    spline_y_.getSplineInterpolatedValueAndDiffs(whole_s, seg_idx));
 }
 
 std::vector<double> SplineInterpolationPoints2d::getSplineInterpolatedCurvatures() const
 {
+  // base_s_vec_ is increasing, so the segment index is walked forward
   std::vector<double> curvature_vec;
-  for (size_t i = 0; i < spline_x_.getSize(); ++i) {
-    const double curvature = getSplineInterpolatedCurvature(i, 0.0);
-    curvature_vec.push_back(curvature);
+  curvature_vec.reserve(base_s_vec_.size());
+  size_t seg_idx = 0;
+  for (const double s : base_s_vec_) {
+    seg_idx = spline_x_.getSegmentIndex(s, seg_idx);
+    curvature_vec.push_back(calcCurvature(
+      spline_x_.getSplineInterpolatedValueAndDiffs(s, seg_idx),
+      spline_y_.getSplineInterpolatedValueAndDiffs(s, seg_idx)));
   }
   return curvature_vec;
 }
@@ -225,15 +243,10 @@ double SplineInterpolationPoints2d::getAccumulatedLength(const size_t idx) const
 void SplineInterpolationPoints2d::calcSplineCoefficientsInner(
   const std::vector<geometry_msgs::msg::Point> & points)
 {
-  const auto base = getBaseValues(points);
-
-  base_s_vec_ = base.at(0);
-  const auto & base_x_vec = base.at(1);
-  const auto & base_y_vec = base.at(2);
-  const auto & base_z_vec = base.at(3);
+  getBaseValues(points, base_s_vec_, base_x_vec_, base_y_vec_, base_z_vec_);
 
   // calculate spline coefficients
-  spline_x_ = SplineInterpolation(base_s_vec_, base_x_vec);
-  spline_y_ = SplineInterpolation(base_s_vec_, base_y_vec);
-  spline_z_ = SplineInterpolation(base_s_vec_, base_z_vec);
+  spline_x_.calcSplineCoefficients(base_s_vec_, base_x_vec_);
+  spline_y_.calcSplineCoefficients(base_s_vec_, base_y_vec_);
+  spline_z_.calcSplineCoefficients(base_s_vec_, base_z_vec_);
 }
@@ -92,3 +92,27 @@ TEST(linear_interpolation, lerp_scalar_query)
     }
   }
 }
+
+TEST(linear_interpolation, lerp_vector_list)
+{
+  const std::vector<double> base_keys{-1.5, 1.0, 5.0, 10.0, 15.0, 20.0};
+  const std::vector<std::vector<double>> base_values_list{
+    {-1.2, 0.5, 1.0, 1.2, 2.0, 1.0}, {0.0, 1.5, 3.0, 4.5, 6.0, 7.5}};
+  const std::vector<double> query_keys{-1.5, 0.0, 8.0, 18.0, 20.0};
+
+  const auto query_values_list = interpolation::lerp(base_keys, base_values_list, query_keys);
+  ASSERT_EQ(query_values_list.size(), base_values_list.size());
+  for (size_t i = 0; i < base_values_list.size(); ++i) {
+    const auto ans = interpolation::lerp(base_keys, base_values_list.at(i), query_keys);
+    ASSERT_EQ(query_values_list.at(i).size(), ans.size());
+    for (size_t j = 0; j < ans.size(); ++j) {
+      EXPECT_NEAR(query_values_list.at(i).at(j), ans.at(j), epsilon);
+    }
+  }
+
+  // size of base_keys and base_values are not the same
+  const std::vector<std::vector<double>> invalid_base_values_list{
+    {-1.2, 0.5, 1.0, 1.2, 2.0, 1.0}, {0.0, 1.5, 3.0}};
+  EXPECT_THROW(
+    interpolation::lerp(base_keys, invalid_base_values_list, query_keys), std::invalid_argument);
+}
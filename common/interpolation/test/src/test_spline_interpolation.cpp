@@ -235,3 +235,41 @@ TEST(spline_interpolation, SplineInterpolation)
     EXPECT_NEAR(query_values.at(i), ans.at(i), epsilon);
   }
 }
+
+TEST(spline_interpolation, SplineInterpolationValueAndDiffs)
+{
+  const std::vector<double> base_keys{-1.5, 1.0, 5.0, 10.0, 15.0, 20.0};
+  const std::vector<double> base_values{-1.2, 0.5, 1.0, 1.2, 2.0, 1.0};
+  const std::vector<double> query_keys{-1.5, 0.0, 1.0, 8.0, 10.0, 18.0, 20.0};
+
+  SplineInterpolation s(base_keys, {0.0, 1.0, 2.0, 3.0, 4.0, 5.0});
+
+  // refit in place
+  s.calcSplineCoefficients(base_keys, base_values);
+  const auto values = s.getSplineInterpolatedValues(query_keys);
+  const auto diff_values = s.getSplineInterpolatedDiffValues(query_keys);
+  const auto quad_diff_values = s.getSplineInterpolatedQuadDiffValues(query_keys);
+
+  size_t seg_idx = 0;
+  for (size_t i = 0; i < query_keys.size(); ++i) {
+    // forward-walking segment index is same as the one by the binary search
+    seg_idx = s.getSegmentIndex(query_keys.at(i), seg_idx);
+    EXPECT_EQ(seg_idx, s.getSegmentIndex(query_keys.at(i)));
+
+    const auto result = s.getSplineInterpolatedValueAndDiffs(query_keys.at(i), seg_idx);
+    EXPECT_NEAR(result.at(0), values.at(i), epsilon);
+    EXPECT_NEAR(result.at(1), diff_values.at(i), epsilon);
+    EXPECT_NEAR(result.at(2), quad_diff_values.at(i), epsilon);
+  }
+
+  // query key behind the start index
+  EXPECT_EQ(s.getSegmentIndex(0.0, 4), size_t(0));
+  EXPECT_EQ(s.getSegmentIndex(5.0, 4), size_t(1));
+
+  // query key out of base keys
+  EXPECT_EQ(s.getSegmentIndex(-10.0), size_t(0));
+  EXPECT_EQ(s.getSegmentIndex(30.0), size_t(4));
+
+  // not fitted
+  EXPECT_THROW(SplineInterpolation{}.getSegmentIndex(0.0), std::invalid_argument);
+}
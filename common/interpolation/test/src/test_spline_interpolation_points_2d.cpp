@@ -220,3 +220,38 @@ TEST(spline_interpolation, SplineInterpolationPoints2dPolymorphism)
   SplineInterpolationPoints2d s_traj_point(trajectory_points);
   s_traj_point.getSplineInterpolatedPoint(0, 0.);
 }
+
+TEST(spline_interpolation, SplineInterpolationPoints2dRefit)
+{
+  using tier4_autoware_utils::createPoint;
+
+  std::vector<geometry_msgs::msg::Point> points;
+  points.push_back(createPoint(-2.0, -10.0, 0.0));
+  points.push_back(createPoint(2.0, 1.5, 0.0));
+  points.push_back(createPoint(3.0, 3.0, 0.0));
+  points.push_back(createPoint(5.0, 10.0, 0.0));
+  points.push_back(createPoint(10.0, 12.5, 0.0));
+
+  std::vector<geometry_msgs::msg::Point> other_points;
+  other_points.push_back(createPoint(0.0, 0.0, 0.0));
+  other_points.push_back(createPoint(1.0, 1.0, 0.0));
+  other_points.push_back(createPoint(2.0, 0.0, 0.0));
+
+  // refit the spline of other points with the points
+  SplineInterpolationPoints2d s(other_points);
+  s.calcSplineCoefficients(points);
+  const SplineInterpolationPoints2d s_ref(points);
+
+  ASSERT_EQ(s.getSize(), s_ref.getSize());
+  const auto yaws = s.getSplineInterpolatedYaws();
+  const auto curvatures = s.getSplineInterpolatedCurvatures();
+  for (size_t i = 0; i < s.getSize(); ++i) {
+    EXPECT_NEAR(yaws.at(i), s_ref.getSplineInterpolatedYaw(i, 0.0), epsilon);
+    EXPECT_NEAR(curvatures.at(i), s_ref.getSplineInterpolatedCurvature(i, 0.0), epsilon);
+
+    const auto p = s.getSplineInterpolatedPoint(i, 0.3);
+    const auto p_ref = s_ref.getSplineInterpolatedPoint(i, 0.3);
+    EXPECT_NEAR(p.x, p_ref.x, epsilon);
+    EXPECT_NEAR(p.y, p_ref.y, epsilon);
+  }
+}
@@ -0,0 +1,149 @@
+// Copyright 2023 The Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef KALMAN_FILTER__KALMAN_FILTER_N_HPP_
+#define KALMAN_FILTER__KALMAN_FILTER_N_HPP_
+
+#include <Eigen/Core>
+#include <Eigen/LU>
+
+/**
+ * @file kalman_filter_n.hpp
+ * @brief kalman filter class with the dimensions fixed at compile time
+ */
+
+/**
+ * @brief Same filter as KalmanFilter, with fixed-size matrices, so that a prediction or an update
+ * does not allocate.
+ * @tparam StateDim dimension of the state
+ * @tparam MeasDim dimension of the measurement of the C and R members. The update with a C and an R
+ * argument takes a measurement of any fixed dimension.
+ */
+template <int StateDim, int MeasDim = StateDim>
+class KalmanFilterN
+{
+public:
+  using StateVector = Eigen::Matrix<double, StateDim, 1>;
+  using StateMatrix = Eigen::Matrix<double, StateDim, StateDim>;
+  using MeasVector = Eigen::Matrix<double, MeasDim, 1>;
+  using MeasMatrix = Eigen::Matrix<double, MeasDim, MeasDim>;
+  using MeasModelMatrix = Eigen::Matrix<double, MeasDim, StateDim>;
+
+  KalmanFilterN()
+  : x_(StateVector::Zero()),
+    A_(StateMatrix::Identity()),
+    C_(MeasModelMatrix::Zero()),
+    Q_(StateMatrix::Zero()),
+    R_(MeasMatrix::Identity()),
+    P_(StateMatrix::Identity())
+  {
+  }
+
+  /**
+   * @brief initialization of kalman filter
+   * @param x initial state
+   * @param P0 initial covariance of estimated state
+   */
+  void init(const StateVector & x, const StateMatrix & P0)
+  {
+    x_ = x;
+    P_ = P0;
+  }
+
+  void setA(const StateMatrix & A) { A_ = A; }
+  void setC(const MeasModelMatrix & C) { C_ = C; }
+  void setQ(const StateMatrix & Q) { Q_ = Q; }
+  void setR(const MeasMatrix & R) { R_ = R; }
+
+  const StateVector & getX() const { return x_; }
+  const StateMatrix & getP() const { return P_; }
+  double getXelement(unsigned int i) const { return x_(i); }
+
+  /**
+   * @brief calculate kalman filter covariance with prediction model with x, A, Q matrix. This is
+   * mainly for EKF with variable matrix.
+   * @param x_next predicted state
+   * @param A coefficient matrix of x for process model
+   * @param Q covariance matrix for process model
+   */
+  bool predict(const StateVector & x_next, const StateMatrix & A, const StateMatrix & Q)
+  {
+    x_ = x_next;
+    P_ = A * P_ * A.transpose() + Q;
+    return true;
+  }
+
+  /**
+   * @brief calculate kalman filter state by prediction model with A and Q being class member
+   * variables.
+   */
+  bool predict()
+  {
+    const StateVector x_next = A_ * x_;
+    return predict(x_next, A_, Q_);
+  }
+
+  /**
+   * @brief calculate kalman filter state by measurement model with y_pred, C and R matrix. This is
+   * mainly for EKF with variable matrix.
+   * @param y measured values
+   * @param y_pred output values expected from measurement model
+   * @param C coefficient matrix of x for measurement model
+   * @param R covariance matrix for measurement model
+   * @return false if the gain is not finite, the state is then not updated
+   */
+  template <int Dim>
+  bool update(
+    const Eigen::Matrix<double, Dim, 1> & y, const Eigen::Matrix<double, Dim, 1> & y_pred,
+    const Eigen::Matrix<double, Dim, StateDim> & C, const Eigen::Matrix<double, Dim, Dim> & R)
+  {
+    const Eigen::Matrix<double, StateDim, Dim> PCT = P_ * C.transpose();
+    const Eigen::Matrix<double, Dim, Dim> S = R + C * PCT;
+    const Eigen::Matrix<double, StateDim, Dim> K = PCT * S.inverse();
+
+    if (!K.allFinite()) {
+      return false;
+    }
+
+    x_ += K * (y - y_pred);
+    P_ -= K * (C * P_);
+    return true;
+  }
+
+  template <int Dim>
+  bool update(
+    const Eigen::Matrix<double, Dim, 1> & y, const Eigen::Matrix<double, Dim, StateDim> & C,
+    const Eigen::Matrix<double, Dim, Dim> & R)
+  {
+    const Eigen::Matrix<double, Dim, 1> y_pred = C * x_;
+    return update(y, y_pred, C, R);
+  }
+
+  /**
+   * @brief calculate kalman filter state by measurement model with C and R being class member
+   * variables.
+   * @param y measured values
+   */
+  bool update(const MeasVector & y) { return update(y, C_, R_); }
+
+protected:
+  StateVector x_;      //!< @brief current estimated state
+  StateMatrix A_;      //!< @brief coefficient matrix of x for process model x[k+1] = A*x[k]
+  MeasModelMatrix C_;  //!< @brief coefficient matrix of x for measurement model y[k] = C * x[k]
+  StateMatrix Q_;      //!< @brief covariance matrix for process model x[k+1] = A*x[k]
+  MeasMatrix R_;       //!< @brief covariance matrix for measurement model y[k] = C * x[k]
+  StateMatrix P_;      //!< @brief covariance of estimated state
+};
+
+#endif  // KALMAN_FILTER__KALMAN_FILTER_N_HPP_
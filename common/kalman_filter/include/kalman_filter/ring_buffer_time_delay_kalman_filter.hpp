@@ -0,0 +1,215 @@
+// Copyright 2023 The Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef KALMAN_FILTER__RING_BUFFER_TIME_DELAY_KALMAN_FILTER_HPP_
+#define KALMAN_FILTER__RING_BUFFER_TIME_DELAY_KALMAN_FILTER_HPP_
+
+#include <Eigen/Core>
+#include <Eigen/LU>
+
+#include <iostream>
+
+/**
+ * @file ring_buffer_time_delay_kalman_filter.hpp
+ * @brief kalman filter with delayed measurement class, whose state history is a ring buffer
+ */
+
+/**
+ * @brief Same filter as TimeDelayKalmanFilter, with the states of the history stored in a ring
+ * buffer of max_delay_step slots instead of being shifted at each prediction.
+ * - the prediction overwrites the slot of the oldest state with the new one, and only computes
+ *   the block row and column of this slot of the covariance,
+ * - the update only multiplies the block row and column of the slot of the delayed state,
+ *   instead of an extended measurement matrix which is zero out of them.
+ * The blocks of a state are fixed-size, and the number of slots is set at initialization.
+ * @tparam StateDim dimension of the latest state
+ */
+template <int StateDim>
+class RingBufferTimeDelayKalmanFilter
+{
+public:
+  using StateVector = Eigen::Matrix<double, StateDim, 1>;
+  using StateMatrix = Eigen::Matrix<double, StateDim, StateDim>;
+
+  RingBufferTimeDelayKalmanFilter() : max_delay_step_(0), latest_slot_(0) {}
+
+  /**
+   * @brief initialization of kalman filter
+   * @param x initial state
+   * @param P0 initial covariance of estimated state
+   * @param max_delay_step Maximum number of delay steps, which determines the dimension of the
+   * extended kalman filter
+   */
+  void init(const StateVector & x, const StateMatrix & P0, const int max_delay_step)
+  {
+    max_delay_step_ = max_delay_step;
+    latest_slot_ = 0;
+    x_ = Eigen::VectorXd::Zero(StateDim * max_delay_step_);
+    P_ = Eigen::MatrixXd::Zero(StateDim * max_delay_step_, StateDim * max_delay_step_);
+    for (int i = 0; i < max_delay_step_; ++i) {
+      x_.template segment<StateDim>(i * StateDim) = x;
+      P_.template block<StateDim, StateDim>(i * StateDim, i * StateDim) = P0;
+    }
+  }
+
+  /**
+   * @brief get latest time estimated state
+   */
+  StateVector getLatestX() const { return getDelayedX(0); }
+
+  /**
+   * @brief get latest time estimation covariance
+   */
+  StateMatrix getLatestP() const
+  {
+    const int offset = slot(0) * StateDim;
+    return P_.template block<StateDim, StateDim>(offset, offset);
+  }
+
+  /**
+   * @brief get estimated state of delay_step steps before
+   */
+  StateVector getDelayedX(const int delay_step) const
+  {
+    return x_.template segment<StateDim>(slot(delay_step) * StateDim);
+  }
+
+  /**
+   * @brief get element of the extended state, in the order of TimeDelayKalmanFilter, i.e. the
+   * element i % StateDim of the state of i / StateDim steps before
+   */
+  double getXelement(unsigned int i) const
+  {
+    return x_(slot(static_cast<int>(i) / StateDim) * StateDim + static_cast<int>(i) % StateDim);
+  }
+
+  /**
+   * @brief get extended state, in the order of TimeDelayKalmanFilter
+   */
+  Eigen::VectorXd getX() const
+  {
+    Eigen::VectorXd x(x_.rows());
+    for (int i = 0; i < max_delay_step_; ++i) {
+      x.template segment<StateDim>(i * StateDim) = getDelayedX(i);
+    }
+    return x;
+  }
+
+  /**
+   * @brief get extended covariance, in the order of TimeDelayKalmanFilter
+   */
+  Eigen::MatrixXd getP() const
+  {
+    Eigen::MatrixXd P(P_.rows(), P_.cols());
+    for (int i = 0; i < max_delay_step_; ++i) {
+      for (int j = 0; j < max_delay_step_; ++j) {
+        P.template block<StateDim, StateDim>(i * StateDim, j * StateDim) =
+          P_.template block<StateDim, StateDim>(slot(i) * StateDim, slot(j) * StateDim);
+      }
+    }
+    return P;
+  }
+
+  /**
+   * @brief calculate kalman filter covariance by precision model with time delay. This is mainly
+   * for EKF of nonlinear process model.
+   * @param x_next predicted state by prediction model
+   * @param A coefficient matrix of x for process model
+   * @param Q covariance matrix for process model
+   */
+  bool predictWithDelay(const StateVector & x_next, const StateMatrix & A, const StateMatrix & Q)
+  {
+    /*
+     * Same model as TimeDelayKalmanFilter::predictWithDelay():
+     *
+     *     [A*P11*A'*+Q  A*P11  A*P12]
+     * P = [     P11*A'    P11    P12]
+     *     [     P21*A'    P21    P22]
+     *
+     * The states of the other slots keep their blocks, so only the blocks of the new state are
+     * computed, in the slot of the oldest state which is dropped.
+     */
+    const int latest = slot(0) * StateDim;
+    const int next_slot = slot(max_delay_step_ - 1);
+    const int next = next_slot * StateDim;
+
+    const StateMatrix P11 = P_.template block<StateDim, StateDim>(latest, latest);
+    for (int j = 0; j < max_delay_step_; ++j) {
+      if (j == next_slot) {
+        continue;
+      }
+      P_.template block<StateDim, StateDim>(next, j * StateDim).noalias() =
+        A * P_.template block<StateDim, StateDim>(latest, j * StateDim);
+      P_.template block<StateDim, StateDim>(j * StateDim, next) =
+        P_.template block<StateDim, StateDim>(next, j * StateDim).transpose();
+    }
+    P_.template block<StateDim, StateDim>(next, next) = A * P11 * A.transpose() + Q;
+
+    x_.template segment<StateDim>(next) = x_next;
+    latest_slot_ = next_slot;
+
+    return true;
+  }
+
+  /**
+   * @brief calculate kalman filter covariance by measurement model with time delay. This is mainly
+   * for EKF of nonlinear process model.
+   * @param y measured values
+   * @param C coefficient matrix of x for measurement model
+   * @param R covariance matrix for measurement model
+   * @param delay_step measurement delay
+   */
+  template <int Dim>
+  bool updateWithDelay(
+    const Eigen::Matrix<double, Dim, 1> & y, const Eigen::Matrix<double, Dim, StateDim> & C,
+    const Eigen::Matrix<double, Dim, Dim> & R, const int delay_step)
+  {
+    if (delay_step >= max_delay_step_) {
+      std::cerr << "delay step is larger than max_delay_step. ignore update." << std::endl;
+      return false;
+    }
+
+    // The correction of a delayed state changes all the states which are correlated with it, so
+    // the whole covariance gets the rank Dim update, of the block row and column of its slot.
+    const int offset = slot(delay_step) * StateDim;
+    const Eigen::Matrix<double, Eigen::Dynamic, Dim> PCT =
+      P_.template middleCols<StateDim>(offset) * C.transpose();
+    const Eigen::Matrix<double, Dim, Eigen::Dynamic> CP =
+      C * P_.template middleRows<StateDim>(offset);
+    const Eigen::Matrix<double, Dim, Dim> S = R + C * PCT.template middleRows<StateDim>(offset);
+    const Eigen::Matrix<double, Eigen::Dynamic, Dim> K = PCT * S.inverse();
+
+    if (!K.allFinite()) {
+      return false;
+    }
+
+    const Eigen::Matrix<double, Dim, 1> y_pred = C * x_.template segment<StateDim>(offset);
+    x_ += K * (y - y_pred);
+    P_.noalias() -= K * CP;
+    return true;
+  }
+
+private:
+  /**
+   * @brief slot of the state of delay_step steps before
+   */
+  int slot(const int delay_step) const { return (latest_slot_ + delay_step) % max_delay_step_; }
+
+  int max_delay_step_;  //!< @brief maximum number of delay steps, i.e. number of slots
+  int latest_slot_;     //!< @brief slot of the latest state
+  Eigen::VectorXd x_;   //!< @brief states of the slots
+  Eigen::MatrixXd P_;   //!< @brief covariance of the states of the slots
+};
+
+#endif  // KALMAN_FILTER__RING_BUFFER_TIME_DELAY_KALMAN_FILTER_HPP_
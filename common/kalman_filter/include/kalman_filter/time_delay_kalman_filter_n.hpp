@@ -0,0 +1,165 @@
+// Copyright 2023 The Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef KALMAN_FILTER__TIME_DELAY_KALMAN_FILTER_N_HPP_
+#define KALMAN_FILTER__TIME_DELAY_KALMAN_FILTER_N_HPP_
+
+#include <Eigen/Core>
+#include <Eigen/LU>
+
+#include <iostream>
+
+/**
+ * @file time_delay_kalman_filter_n.hpp
+ * @brief kalman filter with delayed measurement class with the dimensions fixed at compile time
+ */
+
+/**
+ * @brief Same filter as TimeDelayKalmanFilter, with the extended state sized at compile time.
+ * The extended covariance is allocated once at construction, as a 300x300 matrix of the EKF does
+ * not fit on the stack, and is then updated in place:
+ * - the prediction shifts its blocks instead of building a new extended covariance,
+ * - the update only multiplies the block columns of the delayed state, instead of an extended
+ *   measurement matrix which is zero out of them.
+ * @tparam StateDim dimension of the latest state
+ * @tparam MaxDelayStep maximum number of delay steps
+ */
+template <int StateDim, int MaxDelayStep>
+class TimeDelayKalmanFilterN
+{
+public:
+  static constexpr int dim_x_ex = StateDim * MaxDelayStep;
+
+  using StateVector = Eigen::Matrix<double, StateDim, 1>;
+  using StateMatrix = Eigen::Matrix<double, StateDim, StateDim>;
+  using ExtendedStateVector = Eigen::Matrix<double, dim_x_ex, 1>;
+
+  TimeDelayKalmanFilterN()
+  : x_(ExtendedStateVector::Zero()), P_(Eigen::MatrixXd::Zero(dim_x_ex, dim_x_ex))
+  {
+  }
+
+  /**
+   * @brief initialization of kalman filter
+   * @param x initial state
+   * @param P0 initial covariance of estimated state
+   */
+  void init(const StateVector & x, const StateMatrix & P0)
+  {
+    P_.setZero();
+    for (int i = 0; i < MaxDelayStep; ++i) {
+      x_.template segment<StateDim>(i * StateDim) = x;
+      P_.template block<StateDim, StateDim>(i * StateDim, i * StateDim) = P0;
+    }
+  }
+
+  /**
+   * @brief get latest time estimated state
+   */
+  StateVector getLatestX() const { return x_.template head<StateDim>(); }
+
+  /**
+   * @brief get latest time estimation covariance
+   */
+  StateMatrix getLatestP() const { return P_.template topLeftCorner<StateDim, StateDim>(); }
+
+  const ExtendedStateVector & getX() const { return x_; }
+  const Eigen::MatrixXd & getP() const { return P_; }
+  double getXelement(unsigned int i) const { return x_(i); }
+
+  /**
+   * @brief calculate kalman filter covariance by precision model with time delay. This is mainly
+   * for EKF of nonlinear process model.
+   * @param x_next predicted state by prediction model
+   * @param A coefficient matrix of x for process model
+   * @param Q covariance matrix for process model
+   */
+  bool predictWithDelay(const StateVector & x_next, const StateMatrix & A, const StateMatrix & Q)
+  {
+    /*
+     * Same model as TimeDelayKalmanFilter::predictWithDelay():
+     *
+     *     [A*P11*A'*+Q  A*P11  A*P12]
+     * P = [     P11*A'    P11    P12]
+     *     [     P21*A'    P21    P22]
+     *
+     * The blocks are moved from the last one, so that each one is read before it is overwritten.
+     */
+    for (int i = MaxDelayStep - 1; i > 0; --i) {
+      x_.template segment<StateDim>(i * StateDim) =
+        x_.template segment<StateDim>((i - 1) * StateDim);
+    }
+    x_.template head<StateDim>() = x_next;
+
+    for (int i = MaxDelayStep - 1; i > 0; --i) {
+      for (int j = MaxDelayStep - 1; j > 0; --j) {
+        P_.template block<StateDim, StateDim>(i * StateDim, j * StateDim) =
+          P_.template block<StateDim, StateDim>((i - 1) * StateDim, (j - 1) * StateDim);
+      }
+    }
+    for (int j = MaxDelayStep - 1; j > 0; --j) {
+      P_.template block<StateDim, StateDim>(0, j * StateDim).noalias() =
+        A * P_.template block<StateDim, StateDim>(0, (j - 1) * StateDim);
+      P_.template block<StateDim, StateDim>(j * StateDim, 0).noalias() =
+        P_.template block<StateDim, StateDim>((j - 1) * StateDim, 0) * A.transpose();
+    }
+    const StateMatrix P11 = P_.template topLeftCorner<StateDim, StateDim>();
+    P_.template topLeftCorner<StateDim, StateDim>() = A * P11 * A.transpose() + Q;
+
+    return true;
+  }
+
+  /**
+   * @brief calculate kalman filter covariance by measurement model with time delay. This is mainly
+   * for EKF of nonlinear process model.
+   * @param y measured values
+   * @param C coefficient matrix of x for measurement model
+   * @param R covariance matrix for measurement model
+   * @param delay_step measurement delay
+   */
+  template <int Dim>
+  bool updateWithDelay(
+    const Eigen::Matrix<double, Dim, 1> & y, const Eigen::Matrix<double, Dim, StateDim> & C,
+    const Eigen::Matrix<double, Dim, Dim> & R, const int delay_step)
+  {
+    if (delay_step >= MaxDelayStep) {
+      std::cerr << "delay step is larger than max_delay_step. ignore update." << std::endl;
+      return false;
+    }
+
+    // With C_ex = [0 .. C .. 0], which is C at the block column of delay_step,
+    // P * C_ex' and C_ex * P are the products with the block column and row of the delayed state.
+    const int offset = StateDim * delay_step;
+    const Eigen::Matrix<double, dim_x_ex, Dim> PCT =
+      P_.template middleCols<StateDim>(offset) * C.transpose();
+    const Eigen::Matrix<double, Dim, dim_x_ex> CP = C * P_.template middleRows<StateDim>(offset);
+    const Eigen::Matrix<double, Dim, Dim> S = R + C * PCT.template middleRows<StateDim>(offset);
+    const Eigen::Matrix<double, dim_x_ex, Dim> K = PCT * S.inverse();
+
+    if (!K.allFinite()) {
+      return false;
+    }
+
+    const Eigen::Matrix<double, Dim, 1> y_pred = C * x_.template segment<StateDim>(offset);
+    x_ += K * (y - y_pred);
+    P_.noalias() -= K * CP;
+    return true;
+  }
+
+private:
+  ExtendedStateVector x_;  //!< @brief extended state, the latest state first
+  Eigen::MatrixXd P_;      //!< @brief covariance of the extended state
+};
+
+#endif  // KALMAN_FILTER__TIME_DELAY_KALMAN_FILTER_N_HPP_
@@ -0,0 +1,110 @@
+// Copyright 2023 The Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "kalman_filter/kalman_filter.hpp"
+#include "kalman_filter/kalman_filter_n.hpp"
+#include "kalman_filter/time_delay_kalman_filter.hpp"
+#include "kalman_filter/time_delay_kalman_filter_n.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(kalman_filter_n, same_as_kalman_filter)
+{
+  Eigen::Matrix<double, 3, 1> x_t;
+  x_t << 1.0, 2.0, 3.0;
+  Eigen::Matrix<double, 3, 3> P_t;
+  P_t << 0.3, 0.1, 0.0, 0.1, 0.2, 0.0, 0.0, 0.0, 0.1;
+  Eigen::Matrix<double, 3, 3> A_t;
+  A_t << 1.0, 0.1, 0.0, 0.0, 1.0, 0.1, 0.0, 0.0, 1.0;
+  Eigen::Matrix<double, 3, 3> Q_t = 0.01 * Eigen::Matrix<double, 3, 3>::Identity();
+  Eigen::Matrix<double, 2, 3> C_t;
+  C_t << 1.0, 0.0, 0.0, 0.0, 0.0, 1.0;
+  Eigen::Matrix<double, 2, 2> R_t;
+  R_t << 0.09, 0.0, 0.0, 0.04;
+  Eigen::Matrix<double, 2, 1> y_t;
+  y_t << 1.5, 2.5;
+
+  KalmanFilter kf;
+  kf.init(x_t, P_t);
+  KalmanFilterN<3, 2> kf_n;
+  kf_n.init(x_t, P_t);
+
+  const Eigen::Matrix<double, 3, 1> x_next = A_t * x_t;
+  EXPECT_TRUE(kf.predict(x_next, A_t, Q_t));
+  EXPECT_TRUE(kf_n.predict(x_next, A_t, Q_t));
+  EXPECT_TRUE(kf.update(y_t, C_t, R_t));
+  EXPECT_TRUE(kf_n.update(y_t, C_t, R_t));
+
+  Eigen::MatrixXd x_expected, P_expected;
+  kf.getX(x_expected);
+  kf.getP(P_expected);
+  EXPECT_TRUE(kf_n.getX().isApprox(x_expected, 1e-12));
+  EXPECT_TRUE(kf_n.getP().isApprox(P_expected, 1e-12));
+
+  // update with the C and R members
+  kf_n.setC(C_t);
+  kf_n.setR(R_t);
+  EXPECT_TRUE(kf_n.update(y_t));
+  EXPECT_TRUE(kf.update(y_t, C_t, R_t));
+  kf.getX(x_expected);
+  kf.getP(P_expected);
+  EXPECT_TRUE(kf_n.getX().isApprox(x_expected, 1e-12));
+  EXPECT_TRUE(kf_n.getP().isApprox(P_expected, 1e-12));
+}
+
+TEST(kalman_filter_n, same_as_time_delay_kalman_filter)
+{
+  constexpr int dim_x = 3;
+  constexpr int max_delay_step = 5;
+
+  Eigen::Matrix<double, dim_x, 1> x_t;
+  x_t << 1.0, 2.0, 3.0;
+  Eigen::Matrix<double, dim_x, dim_x> P_t;
+  P_t << 0.1, 0.0, 0.0, 0.0, 0.2, 0.0, 0.0, 0.0, 0.3;
+  Eigen::Matrix<double, dim_x, dim_x> A_t;
+  A_t << 1.0, 0.1, 0.0, 0.0, 1.0, 0.1, 0.0, 0.0, 1.0;
+  Eigen::Matrix<double, dim_x, dim_x> Q_t;
+  Q_t << 0.01, 0.0, 0.0, 0.0, 0.02, 0.0, 0.0, 0.0, 0.03;
+  Eigen::Matrix<double, 2, dim_x> C_t;
+  C_t << 0.5, 0.0, 0.0, 0.0, 0.5, 0.0;
+  Eigen::Matrix<double, 2, 2> R_t;
+  R_t << 0.001, 0.0, 0.0, 0.002;
+
+  TimeDelayKalmanFilter td_kf;
+  td_kf.init(x_t, P_t, max_delay_step);
+  TimeDelayKalmanFilterN<dim_x, max_delay_step> td_kf_n;
+  td_kf_n.init(x_t, P_t);
+
+  Eigen::Matrix<double, dim_x, 1> x_next = x_t;
+  for (int i = 0; i < 4; ++i) {
+    x_next = A_t * x_next;
+    EXPECT_TRUE(td_kf.predictWithDelay(x_next, A_t, Q_t));
+    EXPECT_TRUE(td_kf_n.predictWithDelay(x_next, A_t, Q_t));
+
+    Eigen::Matrix<double, 2, 1> y_t;
+    y_t << 1.05 + 0.1 * i, 2.05 - 0.1 * i;
+    const int delay_step = i % 3;
+    EXPECT_TRUE(td_kf.updateWithDelay(y_t, C_t, R_t, delay_step));
+    EXPECT_TRUE(td_kf_n.updateWithDelay(y_t, C_t, R_t, delay_step));
+
+    Eigen::MatrixXd x_expected, P_expected;
+    td_kf.getX(x_expected);
+    td_kf.getP(P_expected);
+    EXPECT_TRUE(td_kf_n.getX().isApprox(x_expected, 1e-12));
+    EXPECT_TRUE(td_kf_n.getP().isApprox(P_expected, 1e-12));
+  }
+
+  Eigen::Matrix<double, 2, 1> y_t = Eigen::Matrix<double, 2, 1>::Zero();
+  EXPECT_FALSE(td_kf_n.updateWithDelay(y_t, C_t, R_t, max_delay_step));
+}
@@ -0,0 +1,70 @@
+// Copyright 2023 The Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "kalman_filter/ring_buffer_time_delay_kalman_filter.hpp"
+#include "kalman_filter/time_delay_kalman_filter.hpp"
+
+#include <gtest/gtest.h>
+
+TEST(ring_buffer_time_delay_kalman_filter, same_as_time_delay_kalman_filter)
+{
+  constexpr int dim_x = 3;
+  const int max_delay_step = 5;
+
+  Eigen::Matrix<double, dim_x, 1> x_t;
+  x_t << 1.0, 2.0, 3.0;
+  Eigen::Matrix<double, dim_x, dim_x> P_t;
+  P_t << 0.1, 0.0, 0.0, 0.0, 0.2, 0.0, 0.0, 0.0, 0.3;
+  Eigen::Matrix<double, dim_x, dim_x> A_t;
+  A_t << 1.0, 0.1, 0.0, 0.0, 1.0, 0.1, 0.0, 0.0, 1.0;
+  Eigen::Matrix<double, dim_x, dim_x> Q_t;
+  Q_t << 0.01, 0.0, 0.0, 0.0, 0.02, 0.0, 0.0, 0.0, 0.03;
+  Eigen::Matrix<double, 2, dim_x> C_t;
+  C_t << 0.5, 0.0, 0.0, 0.0, 0.5, 0.0;
+  Eigen::Matrix<double, 2, 2> R_t;
+  R_t << 0.001, 0.0, 0.0, 0.002;
+
+  TimeDelayKalmanFilter td_kf;
+  td_kf.init(x_t, P_t, max_delay_step);
+  RingBufferTimeDelayKalmanFilter<dim_x> rb_kf;
+  rb_kf.init(x_t, P_t, max_delay_step);
+
+  // more predictions than slots, so that the ring buffer wraps around
+  Eigen::Matrix<double, dim_x, 1> x_next = x_t;
+  for (int i = 0; i < 12; ++i) {
+    x_next = A_t * x_next;
+    EXPECT_TRUE(td_kf.predictWithDelay(x_next, A_t, Q_t));
+    EXPECT_TRUE(rb_kf.predictWithDelay(x_next, A_t, Q_t));
+
+    Eigen::Matrix<double, 2, 1> y_t;
+    y_t << 1.05 + 0.1 * i, 2.05 - 0.1 * i;
+    const int delay_step = i % max_delay_step;
+    EXPECT_TRUE(td_kf.updateWithDelay(y_t, C_t, R_t, delay_step));
+    EXPECT_TRUE(rb_kf.updateWithDelay(y_t, C_t, R_t, delay_step));
+
+    Eigen::MatrixXd x_expected, P_expected;
+    td_kf.getX(x_expected);
+    td_kf.getP(P_expected);
+    EXPECT_TRUE(rb_kf.getX().isApprox(x_expected, 1e-12));
+    EXPECT_TRUE(rb_kf.getP().isApprox(P_expected, 1e-12));
+    EXPECT_TRUE(rb_kf.getLatestX().isApprox(td_kf.getLatestX(), 1e-12));
+    EXPECT_TRUE(rb_kf.getLatestP().isApprox(td_kf.getLatestP(), 1e-12));
+    for (int j = 0; j < dim_x * max_delay_step; ++j) {
+      EXPECT_NEAR(rb_kf.getXelement(j), td_kf.getXelement(j), 1e-12);
+    }
+  }
+
+  Eigen::Matrix<double, 2, 1> y_t = Eigen::Matrix<double, 2, 1>::Zero();
+  EXPECT_FALSE(rb_kf.updateWithDelay(y_t, C_t, R_t, max_delay_step));
+}
@@ -0,0 +1,72 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef MOTION_UTILS__TRAJECTORY__TRAJECTORY_FOOTPRINT_HPP_
+#define MOTION_UTILS__TRAJECTORY__TRAJECTORY_FOOTPRINT_HPP_
+
+#include "tier4_autoware_utils/geometry/boost_geometry.hpp"
+
+#include <boost/geometry/index/rtree.hpp>
+
+#include <utility>
+#include <vector>
+
+namespace motion_utils
+{
+/**
+ * @brief footprints of the ego along a trajectory, e.g. the one step polygons between the
+ * trajectory points, which are checked against the object polygons.
+ * The bounding boxes of the footprints are indexed with an rtree at construction, so that an object
+ * polygon is only checked against the footprints around it.
+ */
+class TrajectoryFootprint
+{
+public:
+  explicit TrajectoryFootprint(std::vector<tier4_autoware_utils::Polygon2d> footprints);
+
+  size_t size() const { return footprints_.size(); }
+  bool empty() const { return footprints_.empty(); }
+  const tier4_autoware_utils::Polygon2d & at(const size_t idx) const
+  {
+    return footprints_.at(idx);
+  }
+  const std::vector<tier4_autoware_utils::Polygon2d> & getFootprints() const
+  {
+    return footprints_;
+  }
+
+  /**
+   * @brief get the indices of the footprints whose bounding boxes intersect the one of the polygon.
+   * The footprints which are not returned never intersect the polygon.
+   * @return indices sorted in ascending order
+   */
+  std::vector<size_t> getCandidateIndices(const tier4_autoware_utils::Polygon2d & polygon) const;
+
+  /**
+   * @brief calculate the minimum distance between the footprints and the polygon, which is the
+   * same as the minimum of bg::distance over all the footprints.
+   * @return the minimum distance, or std::numeric_limits<double>::max() for empty footprints
+   */
+  double calcDistance(const tier4_autoware_utils::Polygon2d & polygon) const;
+
+private:
+  using BoxRtree = boost::geometry::index::rtree<
+    std::pair<tier4_autoware_utils::Box2d, size_t>, boost::geometry::index::rstar<16>>;
+
+  std::vector<tier4_autoware_utils::Polygon2d> footprints_;
+  BoxRtree rtree_;
+};
+}  // namespace motion_utils
+
+#endif  // MOTION_UTILS__TRAJECTORY__TRAJECTORY_FOOTPRINT_HPP_
@@ -0,0 +1,117 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef MOTION_UTILS__TRAJECTORY__TRAJECTORY_INDEX_HPP_
+#define MOTION_UTILS__TRAJECTORY__TRAJECTORY_INDEX_HPP_
+
+#include "tier4_autoware_utils/geometry/geometry.hpp"
+
+#include <geometry_msgs/msg/point.hpp>
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace motion_utils
+{
+/**
+ * @brief accelerator of the nearest search and arc length functions in trajectory.hpp for a
+ * trajectory which is queried many times.
+ * The cumulative arc length of the points and a grid of the point indices are built once at
+ * construction, so that calcSignedArcLength between indices becomes O(1) and findNearestIndex only
+ * visits the points around the query. The results are the same as the ones of the corresponding
+ * functions in trajectory.hpp.
+ */
+class TrajectoryIndex
+{
+public:
+  /**
+   * @param points points of trajectory, path, ...
+   * @param cell_size size of the grid cells used for the nearest search [m]
+   */
+  template <class T>
+  explicit TrajectoryIndex(const T & points, const double cell_size = 5.0)
+  {
+    points_.reserve(points.size());
+    for (const auto & p : points) {
+      points_.push_back(tier4_autoware_utils::getPoint(p));
+    }
+    build(cell_size);
+  }
+
+  size_t size() const { return points_.size(); }
+
+  /**
+   * @brief same as motion_utils::findNearestIndex(points, point)
+   */
+  size_t findNearestIndex(const geometry_msgs::msg::Point & point) const;
+
+  /**
+   * @brief same as motion_utils::findNearestSegmentIndex(points, point)
+   */
+  size_t findNearestSegmentIndex(const geometry_msgs::msg::Point & point) const;
+
+  /**
+   * @brief same as motion_utils::calcLongitudinalOffsetToSegment(points, seg_idx, p_target)
+   */
+  double calcLongitudinalOffsetToSegment(
+    const size_t seg_idx, const geometry_msgs::msg::Point & p_target) const;
+
+  /**
+   * @brief same as motion_utils::calcSignedArcLength(points, src_idx, dst_idx)
+   */
+  double calcSignedArcLength(const size_t src_idx, const size_t dst_idx) const;
+
+  /**
+   * @brief same as motion_utils::calcSignedArcLength(points, src_point, dst_idx)
+   */
+  double calcSignedArcLength(
+    const geometry_msgs::msg::Point & src_point, const size_t dst_idx) const;
+
+  /**
+   * @brief same as motion_utils::calcSignedArcLength(points, src_idx, dst_point)
+   */
+  double calcSignedArcLength(
+    const size_t src_idx, const geometry_msgs::msg::Point & dst_point) const;
+
+  /**
+   * @brief same as motion_utils::calcSignedArcLength(points, src_point, dst_point)
+   */
+  double calcSignedArcLength(
+    const geometry_msgs::msg::Point & src_point,
+    const geometry_msgs::msg::Point & dst_point) const;
+
+  /**
+   * @brief same as motion_utils::calcArcLength(points)
+   */
+  double calcArcLength() const;
+
+private:
+  void build(const double cell_size);
+  int64_t toCellIndex(const double v) const;
+  static int64_t toCellKey(const int64_t ix, const int64_t iy);
+
+  std::vector<geometry_msgs::msg::Point> points_;
+  std::vector<double> arc_lengths_;  // arc length from the first point
+
+  double cell_size_;
+  int64_t min_ix_{0};
+  int64_t max_ix_{-1};
+  int64_t min_iy_{0};
+  int64_t max_iy_{-1};
+  std::unordered_map<int64_t, std::vector<size_t>> cells_;
+};
+}  // namespace motion_utils
+
+#endif  // MOTION_UTILS__TRAJECTORY__TRAJECTORY_INDEX_HPP_
@@ -24,6 +24,9 @@
 #include "tier4_autoware_utils/geometry/pose_deviation.hpp"
 #include "tier4_autoware_utils/math/constants.hpp"
 
+#include <utility>
+#include <vector>
+
 namespace motion_utils
 {
 std::vector<geometry_msgs::msg::Point> resamplePointVector(
@@ -280,10 +283,6 @@ autoware_auto_planning_msgs::msg::PathWithLaneId resamplePath(
   }
 
   // Interpolate
-  const auto lerp = [&](const auto & input) {
-    return interpolation::lerp(input_arclength, input, resampling_arclength);
-  };
-
   auto closest_segment_indices =
     interpolation::calc_closest_segment_indices(input_arclength, resampling_arclength);
 
@@ -293,9 +292,17 @@ autoware_auto_planning_msgs::msg::PathWithLaneId resamplePath(
 
   const auto interpolated_pose =
     resamplePoseVector(input_pose, resampling_arclength, use_akima_spline_for_xy, use_lerp_for_z);
-  const auto interpolated_v_lon = use_zero_order_hold_for_v ? zoh(v_lon) : lerp(v_lon);
-  const auto interpolated_v_lat = use_zero_order_hold_for_v ? zoh(v_lat) : lerp(v_lat);
-  const auto interpolated_heading_rate = lerp(heading_rate);
+
+  // the linearly interpolated values are interpolated at once to search the segments only once
+  std::vector<std::vector<double>> lerp_input{std::move(heading_rate)};
+  if (!use_zero_order_hold_for_v) {
+    lerp_input.push_back(v_lon);
+    lerp_input.push_back(v_lat);
+  }
+  const auto lerp_output = interpolation::lerp(input_arclength, lerp_input, resampling_arclength);
+  const auto & interpolated_heading_rate = lerp_output.at(0);
+  const auto interpolated_v_lon = use_zero_order_hold_for_v ? zoh(v_lon) : lerp_output.at(1);
+  const auto interpolated_v_lat = use_zero_order_hold_for_v ? zoh(v_lat) : lerp_output.at(2);
   const auto interpolated_is_final = zoh(is_final);
 
   // interpolate lane_ids
@@ -461,10 +468,6 @@ autoware_auto_planning_msgs::msg::Path resamplePath(
   }
 
   // Interpolate
-  const auto lerp = [&](const auto & input) {
-    return interpolation::lerp(input_arclength, input, resampled_arclength);
-  };
-
   std::vector<size_t> closest_segment_indices;
   if (use_zero_order_hold_for_v) {
     closest_segment_indices =
@@ -476,9 +479,17 @@ autoware_auto_planning_msgs::msg::Path resamplePath(
 
   const auto interpolated_pose =
     resamplePoseVector(input_pose, resampled_arclength, use_akima_spline_for_xy, use_lerp_for_z);
-  const auto interpolated_v_lon = use_zero_order_hold_for_v ? zoh(v_lon) : lerp(v_lon);
-  const auto interpolated_v_lat = use_zero_order_hold_for_v ? zoh(v_lat) : lerp(v_lat);
-  const auto interpolated_heading_rate = lerp(heading_rate);
+
+  // the linearly interpolated values are interpolated at once to search the segments only once
+  std::vector<std::vector<double>> lerp_input{std::move(heading_rate)};
+  if (!use_zero_order_hold_for_v) {
+    lerp_input.push_back(v_lon);
+    lerp_input.push_back(v_lat);
+  }
+  const auto lerp_output = interpolation::lerp(input_arclength, lerp_input, resampled_arclength);
+  const auto & interpolated_heading_rate = lerp_output.at(0);
+  const auto interpolated_v_lon = use_zero_order_hold_for_v ? zoh(v_lon) : lerp_output.at(1);
+  const auto interpolated_v_lat = use_zero_order_hold_for_v ? zoh(v_lat) : lerp_output.at(2);
 
   if (interpolated_pose.size() != resampled_arclength.size()) {
     std::cerr << "[motion_utils]: Resampled pose size is different from resampled arclength"
@@ -619,10 +630,6 @@ autoware_auto_planning_msgs::msg::Trajectory resampleTrajectory(
   }
 
   // Interpolate
-  const auto lerp = [&](const auto & input) {
-    return interpolation::lerp(input_arclength, input, resampled_arclength);
-  };
-
   std::vector<size_t> closest_segment_indices;
   if (use_zero_order_hold_for_twist) {
     closest_segment_indices =
@@ -634,14 +641,25 @@ autoware_auto_planning_msgs::msg::Trajectory resampleTrajectory(
 
   const auto interpolated_pose =
     resamplePoseVector(input_pose, resampled_arclength, use_akima_spline_for_xy, use_lerp_for_z);
-  const auto interpolated_v_lon = use_zero_order_hold_for_twist ? zoh(v_lon) : lerp(v_lon);
-  const auto interpolated_v_lat = use_zero_order_hold_for_twist ? zoh(v_lat) : lerp(v_lat);
-  const auto interpolated_heading_rate = lerp(heading_rate);
+
+  // the linearly interpolated values are interpolated at once to search the segments only once
+  std::vector<std::vector<double>> lerp_input{
+    std::move(heading_rate), std::move(front_wheel_angle), std::move(rear_wheel_angle),
+    std::move(time_from_start)};
+  if (!use_zero_order_hold_for_twist) {
+    lerp_input.push_back(v_lon);
+    lerp_input.push_back(v_lat);
+    lerp_input.push_back(acceleration);
+  }
+  const auto lerp_output = interpolation::lerp(input_arclength, lerp_input, resampled_arclength);
+  const auto & interpolated_heading_rate = lerp_output.at(0);
+  const auto & interpolated_front_wheel_angle = lerp_output.at(1);
+  const auto & interpolated_rear_wheel_angle = lerp_output.at(2);
+  const auto & interpolated_time_from_start = lerp_output.at(3);
+  const auto interpolated_v_lon = use_zero_order_hold_for_twist ? zoh(v_lon) : lerp_output.at(4);
+  const auto interpolated_v_lat = use_zero_order_hold_for_twist ? zoh(v_lat) : lerp_output.at(5);
   const auto interpolated_acceleration =
-    use_zero_order_hold_for_twist ? zoh(acceleration) : lerp(acceleration);
-  const auto interpolated_front_wheel_angle = lerp(front_wheel_angle);
-  const auto interpolated_rear_wheel_angle = lerp(rear_wheel_angle);
-  const auto interpolated_time_from_start = lerp(time_from_start);
+    use_zero_order_hold_for_twist ? zoh(acceleration) : lerp_output.at(6);
 
   if (interpolated_pose.size() != resampled_arclength.size()) {
     std::cerr << "[motion_utils]: Resampled pose size is different from resampled arclength"
@@ -0,0 +1,77 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "motion_utils/trajectory/trajectory_footprint.hpp"
+
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <limits>
+
+namespace motion_utils
+{
+namespace bg = boost::geometry;
+namespace bgi = boost::geometry::index;
+using tier4_autoware_utils::Box2d;
+using tier4_autoware_utils::Polygon2d;
+
+TrajectoryFootprint::TrajectoryFootprint(std::vector<Polygon2d> footprints)
+: footprints_(std::move(footprints))
+{
+  std::vector<std::pair<Box2d, size_t>> boxes;
+  boxes.reserve(footprints_.size());
+  for (size_t i = 0; i < footprints_.size(); ++i) {
+    boxes.emplace_back(bg::return_envelope<Box2d>(footprints_.at(i)), i);
+  }
+  // the packing algorithm is used to build the rtree at once
+  rtree_ = BoxRtree(boxes.begin(), boxes.end());
+}
+
+std::vector<size_t> TrajectoryFootprint::getCandidateIndices(const Polygon2d & polygon) const
+{
+  std::vector<std::pair<Box2d, size_t>> result;
+  rtree_.query(
+    bgi::intersects(bg::return_envelope<Box2d>(polygon)), std::back_inserter(result));
+
+  std::vector<size_t> indices;
+  indices.reserve(result.size());
+  for (const auto & [box, idx] : result) {
+    indices.push_back(idx);
+  }
+  std::sort(indices.begin(), indices.end());
+  return indices;
+}
+
+double TrajectoryFootprint::calcDistance(const Polygon2d & polygon) const
+{
+  double min_dist = std::numeric_limits<double>::max();
+  if (rtree_.empty()) {
+    return min_dist;
+  }
+
+  // the footprints are visited in ascending order of the distance between the bounding boxes,
+  // which is a lower bound of the distance between the polygons
+  const auto polygon_box = bg::return_envelope<Box2d>(polygon);
+  for (auto itr = rtree_.qbegin(bgi::nearest(polygon_box, rtree_.size())); itr != rtree_.qend();
+       ++itr) {
+    if (min_dist < bg::distance(itr->first, polygon_box)) {
+      break;
+    }
+    min_dist = std::min(min_dist, bg::distance(footprints_.at(itr->second), polygon));
+  }
+  return min_dist;
+}
+}  // namespace motion_utils
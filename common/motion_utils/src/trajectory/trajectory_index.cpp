@@ -0,0 +1,268 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "motion_utils/trajectory/trajectory_index.hpp"
+
+#include "motion_utils/trajectory/trajectory.hpp"
+#include "tier4_autoware_utils/system/backtrace.hpp"
+
+#include <Eigen/Core>
+
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+namespace motion_utils
+{
+void TrajectoryIndex::build(const double cell_size)
+{
+  cell_size_ = cell_size;
+
+  arc_lengths_.reserve(points_.size());
+  double arc_length = 0.0;
+  for (size_t i = 0; i < points_.size(); ++i) {
+    if (i != 0) {
+      arc_length += tier4_autoware_utils::calcDistance2d(points_.at(i - 1), points_.at(i));
+    }
+    arc_lengths_.push_back(arc_length);
+  }
+
+  if (points_.empty()) {
+    return;
+  }
+  min_ix_ = max_ix_ = toCellIndex(points_.front().x);
+  min_iy_ = max_iy_ = toCellIndex(points_.front().y);
+  for (size_t i = 0; i < points_.size(); ++i) {
+    const auto ix = toCellIndex(points_.at(i).x);
+    const auto iy = toCellIndex(points_.at(i).y);
+    min_ix_ = std::min(min_ix_, ix);
+    max_ix_ = std::max(max_ix_, ix);
+    min_iy_ = std::min(min_iy_, iy);
+    max_iy_ = std::max(max_iy_, iy);
+    cells_[toCellKey(ix, iy)].push_back(i);
+  }
+}
+
+int64_t TrajectoryIndex::toCellIndex(const double v) const
+{
+  return static_cast<int64_t>(std::floor(v / cell_size_));
+}
+
+int64_t TrajectoryIndex::toCellKey(const int64_t ix, const int64_t iy)
+{
+  return static_cast<int64_t>(
+    (static_cast<uint64_t>(ix) << 32) ^ (static_cast<uint64_t>(iy) & 0xffffffff));
+}
+
+size_t TrajectoryIndex::findNearestIndex(const geometry_msgs::msg::Point & point) const
+{
+  validateNonEmpty(points_);
+
+  const auto cx = toCellIndex(point.x);
+  const auto cy = toCellIndex(point.y);
+  const auto max_ring = std::max(
+    {std::abs(cx - min_ix_), std::abs(max_ix_ - cx), std::abs(cy - min_iy_),
+     std::abs(max_iy_ - cy)});
+
+  double min_dist = std::numeric_limits<double>::max();
+  size_t min_idx = 0;
+  bool is_found = false;
+  const auto update = [&](const int64_t ix, const int64_t iy) {
+    const auto cell = cells_.find(toCellKey(ix, iy));
+    if (cell == cells_.end()) {
+      return;
+    }
+    for (const auto idx : cell->second) {
+      const auto dist = tier4_autoware_utils::calcSquaredDistance2d(points_.at(idx), point);
+      // keep the first index among the nearest points as the linear search does
+      if (dist < min_dist || (dist == min_dist && idx < min_idx)) {
+        min_dist = dist;
+        min_idx = idx;
+        is_found = true;
+      }
+    }
+  };
+
+  // search the cells ring by ring around the query point. the points in the ring r are at least
+  // (r - 1) * cell_size away from the query point, so the search stops once the nearest point
+  // found so far is closer than that.
+  size_t visited_cell_num = 0;
+  for (int64_t r = 0; r <= max_ring; ++r) {
+    const double ring_dist = static_cast<double>(r - 1) * cell_size_;
+    if (is_found && 0.0 < ring_dist && min_dist < ring_dist * ring_dist) {
+      break;
+    }
+
+    const auto ix_begin = std::max(cx - r, min_ix_);
+    const auto ix_end = std::min(cx + r, max_ix_);
+    const auto iy_begin = std::max(cy - r, min_iy_);
+    const auto iy_end = std::min(cy + r, max_iy_);
+    for (auto ix = ix_begin; ix <= ix_end; ++ix) {
+      if (std::abs(ix - cx) == r) {
+        for (auto iy = iy_begin; iy <= iy_end; ++iy) {
+          update(ix, iy);
+        }
+        visited_cell_num += iy_end < iy_begin ? 0 : iy_end - iy_begin + 1;
+        continue;
+      }
+      if (min_iy_ <= cy - r && cy - r <= max_iy_) {
+        update(ix, cy - r);
+        ++visited_cell_num;
+      }
+      if (min_iy_ <= cy + r && cy + r <= max_iy_) {
+        update(ix, cy + r);
+        ++visited_cell_num;
+      }
+    }
+
+    // the query point is far from the points, so the grid does not help
+    if (points_.size() < visited_cell_num + static_cast<size_t>(r)) {
+      return motion_utils::findNearestIndex(points_, point);
+    }
+  }
+
+  return min_idx;
+}
+
+size_t TrajectoryIndex::findNearestSegmentIndex(const geometry_msgs::msg::Point & point) const
+{
+  const size_t nearest_idx = findNearestIndex(point);
+
+  if (nearest_idx == 0) {
+    return 0;
+  }
+  if (nearest_idx == points_.size() - 1) {
+    return points_.size() - 2;
+  }
+
+  const double signed_length = calcLongitudinalOffsetToSegment(nearest_idx, point);
+
+  if (signed_length <= 0) {
+    return nearest_idx - 1;
+  }
+
+  return nearest_idx;
+}
+
+double TrajectoryIndex::calcLongitudinalOffsetToSegment(
+  const size_t seg_idx, const geometry_msgs::msg::Point & p_target) const
+{
+  if (points_.empty() || seg_idx >= points_.size() - 1) {
+    const std::out_of_range e("Segment index is invalid.");
+    tier4_autoware_utils::print_backtrace();
+    std::cerr << e.what() << std::endl;
+    return std::nan("");
+  }
+
+  // the next point which does not overlap with the segment front point, as removeOverlapPoints
+  // does
+  constexpr double eps = 1.0E-08;
+  const auto & p_front = points_.at(seg_idx);
+  size_t back_idx = seg_idx + 1;
+  while (back_idx < points_.size() && std::abs(p_front.x - points_.at(back_idx).x) < eps &&
+         std::abs(p_front.y - points_.at(back_idx).y) < eps) {
+    ++back_idx;
+  }
+  if (back_idx == points_.size()) {
+    const std::runtime_error e("Same points are given.");
+    tier4_autoware_utils::print_backtrace();
+    std::cerr << e.what() << std::endl;
+    return std::nan("");
+  }
+  const auto & p_back = points_.at(back_idx);
+
+  const Eigen::Vector3d segment_vec{p_back.x - p_front.x, p_back.y - p_front.y, 0};
+  const Eigen::Vector3d target_vec{p_target.x - p_front.x, p_target.y - p_front.y, 0};
+
+  return segment_vec.dot(target_vec) / segment_vec.norm();
+}
+
+double TrajectoryIndex::calcSignedArcLength(const size_t src_idx, const size_t dst_idx) const
+{
+  try {
+    validateNonEmpty(points_);
+  } catch (const std::exception & e) {
+    std::cerr << e.what() << std::endl;
+    return 0.0;
+  }
+
+  return arc_lengths_.at(dst_idx) - arc_lengths_.at(src_idx);
+}
+
+double TrajectoryIndex::calcSignedArcLength(
+  const geometry_msgs::msg::Point & src_point, const size_t dst_idx) const
+{
+  try {
+    validateNonEmpty(points_);
+  } catch (const std::exception & e) {
+    std::cerr << e.what() << std::endl;
+    return 0.0;
+  }
+
+  const size_t src_seg_idx = findNearestSegmentIndex(src_point);
+
+  const double signed_length_on_traj = calcSignedArcLength(src_seg_idx, dst_idx);
+  const double signed_length_src_offset = calcLongitudinalOffsetToSegment(src_seg_idx, src_point);
+
+  return signed_length_on_traj - signed_length_src_offset;
+}
+
+double TrajectoryIndex::calcSignedArcLength(
+  const size_t src_idx, const geometry_msgs::msg::Point & dst_point) const
+{
+  try {
+    validateNonEmpty(points_);
+  } catch (const std::exception & e) {
+    std::cerr << e.what() << std::endl;
+    return 0.0;
+  }
+
+  return -calcSignedArcLength(dst_point, src_idx);
+}
+
+double TrajectoryIndex::calcSignedArcLength(
+  const geometry_msgs::msg::Point & src_point, const geometry_msgs::msg::Point & dst_point) const
+{
+  try {
+    validateNonEmpty(points_);
+  } catch (const std::exception & e) {
+    std::cerr << e.what() << std::endl;
+    return 0.0;
+  }
+
+  const size_t src_seg_idx = findNearestSegmentIndex(src_point);
+  const size_t dst_seg_idx = findNearestSegmentIndex(dst_point);
+
+  const double signed_length_on_traj = calcSignedArcLength(src_seg_idx, dst_seg_idx);
+  const double signed_length_src_offset = calcLongitudinalOffsetToSegment(src_seg_idx, src_point);
+  const double signed_length_dst_offset = calcLongitudinalOffsetToSegment(dst_seg_idx, dst_point);
+
+  return signed_length_on_traj - signed_length_src_offset + signed_length_dst_offset;
+}
+
+double TrajectoryIndex::calcArcLength() const
+{
+  try {
+    validateNonEmpty(points_);
+  } catch (const std::exception & e) {
+    std::cerr << e.what() << std::endl;
+    return 0.0;
+  }
+
+  return arc_lengths_.back();
+}
+}  // namespace motion_utils
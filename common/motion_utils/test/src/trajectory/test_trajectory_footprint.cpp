@@ -0,0 +1,104 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "motion_utils/trajectory/trajectory_footprint.hpp"
+
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
+
+#include <gtest/gtest.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace
+{
+using tier4_autoware_utils::Point2d;
+using tier4_autoware_utils::Polygon2d;
+
+Polygon2d createSquare(const double x, const double y, const double radius, const double yaw)
+{
+  Polygon2d polygon;
+  for (size_t i = 0; i < 4; ++i) {
+    const double theta = yaw + M_PI_2 * static_cast<double>(i);
+    polygon.outer().emplace_back(x + radius * std::cos(theta), y + radius * std::sin(theta));
+  }
+  boost::geometry::correct(polygon);
+  return polygon;
+}
+
+std::vector<Polygon2d> createFootprints()
+{
+  std::vector<Polygon2d> footprints;
+  for (size_t i = 0; i < 60; ++i) {
+    const double s = static_cast<double>(i);
+    footprints.push_back(createSquare(s, 5.0 * std::sin(0.1 * s), 2.0, 0.05 * s));
+  }
+  return footprints;
+}
+
+std::vector<Polygon2d> createObjectPolygons()
+{
+  std::vector<Polygon2d> polygons;
+  for (double x = -20.0; x <= 80.0; x += 3.7) {
+    for (double y = -20.0; y <= 20.0; y += 2.3) {
+      polygons.push_back(createSquare(x, y, 1.0, 0.1 * x));
+    }
+  }
+  return polygons;
+}
+}  // namespace
+
+TEST(trajectory_footprint, getCandidateIndices)
+{
+  const auto footprints = createFootprints();
+  const motion_utils::TrajectoryFootprint trajectory_footprint(footprints);
+  EXPECT_EQ(trajectory_footprint.size(), footprints.size());
+
+  for (const auto & polygon : createObjectPolygons()) {
+    const auto candidate_indices = trajectory_footprint.getCandidateIndices(polygon);
+    EXPECT_TRUE(std::is_sorted(candidate_indices.begin(), candidate_indices.end()));
+    for (size_t i = 0; i < footprints.size(); ++i) {
+      if (boost::geometry::intersects(footprints.at(i), polygon)) {
+        EXPECT_TRUE(std::binary_search(candidate_indices.begin(), candidate_indices.end(), i));
+      }
+    }
+  }
+
+  // empty
+  const motion_utils::TrajectoryFootprint empty_footprint({});
+  EXPECT_TRUE(empty_footprint.getCandidateIndices(footprints.front()).empty());
+}
+
+TEST(trajectory_footprint, calcDistance)
+{
+  const auto footprints = createFootprints();
+  const motion_utils::TrajectoryFootprint trajectory_footprint(footprints);
+
+  for (const auto & polygon : createObjectPolygons()) {
+    double min_dist = std::numeric_limits<double>::max();
+    for (const auto & footprint : footprints) {
+      min_dist = std::min(min_dist, boost::geometry::distance(footprint, polygon));
+    }
+    EXPECT_DOUBLE_EQ(trajectory_footprint.calcDistance(polygon), min_dist);
+  }
+
+  // empty
+  const motion_utils::TrajectoryFootprint empty_footprint({});
+  EXPECT_DOUBLE_EQ(
+    empty_footprint.calcDistance(footprints.front()), std::numeric_limits<double>::max());
+}
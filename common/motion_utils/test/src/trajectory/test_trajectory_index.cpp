@@ -0,0 +1,123 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "motion_utils/trajectory/trajectory.hpp"
+#include "motion_utils/trajectory/trajectory_index.hpp"
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <vector>
+
+namespace
+{
+using autoware_auto_planning_msgs::msg::TrajectoryPoint;
+using tier4_autoware_utils::createPoint;
+
+constexpr double epsilon = 1e-6;
+
+std::vector<TrajectoryPoint> generateCurvedTrajectory(const size_t num_points)
+{
+  std::vector<TrajectoryPoint> points;
+  double x = 0.0;
+  double y = 0.0;
+  for (size_t i = 0; i < num_points; ++i) {
+    const double theta = 0.05 * static_cast<double>(i);
+    x += std::cos(theta);
+    y += std::sin(theta);
+
+    TrajectoryPoint p;
+    p.pose.position = createPoint(x, y, 0.0);
+    points.push_back(p);
+
+    // add an overlapping point
+    if (i % 10 == 0) {
+      points.push_back(p);
+    }
+  }
+  return points;
+}
+
+std::vector<geometry_msgs::msg::Point> generateQueryPoints()
+{
+  std::vector<geometry_msgs::msg::Point> query_points;
+  for (double x = -30.0; x <= 50.0; x += 3.7) {
+    for (double y = -30.0; y <= 50.0; y += 4.3) {
+      query_points.push_back(createPoint(x, y, 0.0));
+    }
+  }
+  // far from the trajectory
+  query_points.push_back(createPoint(1000.0, -1000.0, 0.0));
+  return query_points;
+}
+}  // namespace
+
+TEST(trajectory_index, findNearestIndex)
+{
+  using motion_utils::TrajectoryIndex;
+
+  const auto points = generateCurvedTrajectory(60);
+  const TrajectoryIndex index(points);
+
+  for (const auto & p : generateQueryPoints()) {
+    EXPECT_EQ(index.findNearestIndex(p), motion_utils::findNearestIndex(points, p));
+    EXPECT_EQ(index.findNearestSegmentIndex(p), motion_utils::findNearestSegmentIndex(points, p));
+  }
+  // on a trajectory point
+  for (size_t i = 0; i < points.size(); ++i) {
+    const auto & p = points.at(i).pose.position;
+    EXPECT_EQ(index.findNearestIndex(p), motion_utils::findNearestIndex(points, p));
+  }
+
+  // empty
+  const TrajectoryIndex empty_index(std::vector<TrajectoryPoint>{});
+  EXPECT_THROW(empty_index.findNearestIndex(createPoint(0.0, 0.0, 0.0)), std::invalid_argument);
+}
+
+TEST(trajectory_index, calcSignedArcLength)
+{
+  using motion_utils::TrajectoryIndex;
+
+  const auto points = generateCurvedTrajectory(60);
+  const TrajectoryIndex index(points);
+
+  EXPECT_NEAR(index.calcArcLength(), motion_utils::calcArcLength(points), epsilon);
+
+  for (size_t i = 0; i < points.size(); i += 7) {
+    for (size_t j = 0; j < points.size(); j += 5) {
+      EXPECT_NEAR(
+        index.calcSignedArcLength(i, j), motion_utils::calcSignedArcLength(points, i, j), epsilon);
+    }
+  }
+
+  const auto query_points = generateQueryPoints();
+  for (size_t i = 0; i + 1 < query_points.size(); ++i) {
+    const auto & src = query_points.at(i);
+    const auto & dst = query_points.at(i + 1);
+    EXPECT_NEAR(
+      index.calcSignedArcLength(src, size_t(5)),
+      motion_utils::calcSignedArcLength(points, src, size_t(5)), epsilon);
+    EXPECT_NEAR(
+      index.calcSignedArcLength(size_t(5), dst),
+      motion_utils::calcSignedArcLength(points, size_t(5), dst), epsilon);
+    EXPECT_NEAR(
+      index.calcSignedArcLength(src, dst), motion_utils::calcSignedArcLength(points, src, dst),
+      epsilon);
+  }
+
+  // empty
+  const TrajectoryIndex empty_index(std::vector<TrajectoryPoint>{});
+  EXPECT_DOUBLE_EQ(empty_index.calcSignedArcLength(size_t(0), size_t(0)), 0.0);
+  EXPECT_DOUBLE_EQ(empty_index.calcArcLength(), 0.0);
+}
@@ -21,15 +21,88 @@
 
 #include <boost/geometry.hpp>
 
+#include <autoware_auto_perception_msgs/msg/shape.hpp>
+#include <geometry_msgs/msg/pose.hpp>
+
 #include <algorithm>
+#include <array>
+#include <cstddef>
 #include <numeric>
 #include <utility>
 #include <vector>
 
 namespace object_recognition_utils
 {
+using tier4_autoware_utils::Point2d;
 using tier4_autoware_utils::Polygon2d;
 
+/**
+ * @brief convex polygon with a fixed maximum number of vertices, which needs no heap allocation
+ * @details The vertices are in counterclockwise order, and the first vertex is not repeated at the
+ * end.
+ */
+struct ConvexPolygon2d
+{
+  // the intersection of two polygons has at most as many vertices as both of them, and a bounding
+  // box and a cylinder have 4 and 6 vertices
+  static constexpr size_t max_size = 12;
+  std::array<Point2d, max_size> points;
+  size_t size{0};
+};
+
+/**
+ * @brief polygon of an object for the matching
+ * @details The convex polygon is used if the shape is a bounding box or a cylinder, otherwise the
+ * boost polygon is used.
+ */
+struct ObjectPolygon2d
+{
+  bool is_convex{false};
+  ConvexPolygon2d convex_polygon;
+  Polygon2d polygon;
+  double area{0.0};
+};
+
+/**
+ * @brief convert the shape to the convex polygon with the same vertices as toPolygon2d
+ * @return false if the shape is not a bounding box or a cylinder, which may not be convex
+ */
+bool toConvexPolygon2d(
+  const geometry_msgs::msg::Pose & pose, const autoware_auto_perception_msgs::msg::Shape & shape,
+  ConvexPolygon2d & polygon);
+
+Polygon2d toPolygon2d(const ConvexPolygon2d & polygon);
+
+double getArea(const ConvexPolygon2d & polygon);
+
+/**
+ * @brief calculate the intersection area by clipping one polygon by the edges of the other
+ * (Sutherland-Hodgman algorithm)
+ */
+double getIntersectionArea(
+  const ConvexPolygon2d & source_polygon, const ConvexPolygon2d & target_polygon);
+
+/**
+ * @brief calculate the area of the convex hull of the vertices of the two polygons
+ */
+double getConvexShapeArea(
+  const ConvexPolygon2d & source_polygon, const ConvexPolygon2d & target_polygon);
+
+template <class T>
+ObjectPolygon2d toObjectPolygon2d(const T & object)
+{
+  ObjectPolygon2d object_polygon;
+  object_polygon.is_convex =
+    toConvexPolygon2d(getPose(object), object.shape, object_polygon.convex_polygon);
+  if (object_polygon.is_convex) {
+    object_polygon.area = getArea(object_polygon.convex_polygon);
+  } else {
+    object_polygon.polygon = tier4_autoware_utils::toPolygon2d(object);
+    object_polygon.area = boost::geometry::area(object_polygon.polygon);
+  }
+  return object_polygon;
+}
+
 inline double getConvexShapeArea(const Polygon2d & source_polygon, const Polygon2d & target_polygon)
 {
   boost::geometry::model::multi_polygon<Polygon2d> union_polygons;
@@ -42,7 +115,7 @@ inline double getConvexShapeArea(const Polygon2d & source_polygon, const Polygon
 
 inline double getSumArea(const std::vector<Polygon2d> & polygons)
 {
-  return std::accumulate(polygons.begin(), polygons.end(), 0.0, [](double acc, Polygon2d p) {
+  return std::accumulate(polygons.begin(), polygons.end(), 0.0, [](double acc, const Polygon2d & p) {
     return acc + boost::geometry::area(p);
   });
 }
@@ -62,59 +135,69 @@ inline double getUnionArea(const Polygon2d & source_polygon, const Polygon2d & t
   return getSumArea(union_polygons);
 }
 
-template <class T1, class T2>
-double get2dIoU(const T1 source_object, const T2 target_object, const double min_union_area = 0.01)
-{
-  const auto source_polygon = tier4_autoware_utils::toPolygon2d(source_object);
-  const auto target_polygon = tier4_autoware_utils::toPolygon2d(target_object);
+double get2dIoU(
+  const ObjectPolygon2d & source_polygon, const ObjectPolygon2d & target_polygon,
+  const double min_union_area = 0.01);
+
+double get2dGeneralizedIoU(
+  const ObjectPolygon2d & source_polygon, const ObjectPolygon2d & target_polygon);
+
+double get2dPrecision(
+  const ObjectPolygon2d & source_polygon, const ObjectPolygon2d & target_polygon);
 
-  const double intersection_area = getIntersectionArea(source_polygon, target_polygon);
-  if (intersection_area == 0.0) return 0.0;
-  const double union_area = getUnionArea(source_polygon, target_polygon);
+double get2dRecall(const ObjectPolygon2d & source_polygon, const ObjectPolygon2d & target_polygon);
 
-  const double iou =
-    union_area < min_union_area ? 0.0 : std::min(1.0, intersection_area / union_area);
-  return iou;
+template <class T1, class T2>
+double get2dIoU(
+  const T1 & source_object, const T2 & target_object, const double min_union_area = 0.01)
+{
+  return get2dIoU(
+    toObjectPolygon2d(source_object), toObjectPolygon2d(target_object), min_union_area);
 }
 
 template <class T1, class T2>
 double get2dGeneralizedIoU(const T1 & source_object, const T2 & target_object)
 {
-  const auto source_polygon = tier4_autoware_utils::toPolygon2d(source_object);
-  const auto target_polygon = tier4_autoware_utils::toPolygon2d(target_object);
-
-  const double intersection_area = getIntersectionArea(source_polygon, target_polygon);
-  const double union_area = getUnionArea(source_polygon, target_polygon);
-  const double convex_shape_area = getConvexShapeArea(source_polygon, target_polygon);
-
-  const double iou = union_area < 0.01 ? 0.0 : std::min(1.0, intersection_area / union_area);
-  return iou - (convex_shape_area - union_area) / convex_shape_area;
+  return get2dGeneralizedIoU(toObjectPolygon2d(source_object), toObjectPolygon2d(target_object));
 }
 
 template <class T1, class T2>
-double get2dPrecision(const T1 source_object, const T2 target_object)
+double get2dPrecision(const T1 & source_object, const T2 & target_object)
 {
-  const auto source_polygon = tier4_autoware_utils::toPolygon2d(source_object);
-  const auto target_polygon = tier4_autoware_utils::toPolygon2d(target_object);
-
-  const double intersection_area = getIntersectionArea(source_polygon, target_polygon);
-  if (intersection_area == 0.0) return 0.0;
-  const double source_area = boost::geometry::area(source_polygon);
-
-  return std::min(1.0, intersection_area / source_area);
+  return get2dPrecision(toObjectPolygon2d(source_object), toObjectPolygon2d(target_object));
 }
 
 template <class T1, class T2>
-double get2dRecall(const T1 source_object, const T2 target_object)
+double get2dRecall(const T1 & source_object, const T2 & target_object)
 {
-  const auto source_polygon = tier4_autoware_utils::toPolygon2d(source_object);
-  const auto target_polygon = tier4_autoware_utils::toPolygon2d(target_object);
-
-  const double intersection_area = getIntersectionArea(source_polygon, target_polygon);
-  if (intersection_area == 0.0) return 0.0;
-  const double target_area = boost::geometry::area(target_polygon);
+  return get2dRecall(toObjectPolygon2d(source_object), toObjectPolygon2d(target_object));
+}
 
-  return std::min(1.0, intersection_area / target_area);
+/**
+ * @brief calculate 2d IoU of all the pairs of the source objects and the target objects
+ * @details Each object is converted to the polygon once, instead of once for each pair.
+ * @return IoU matrix, where the element [i][j] is IoU of source_objects[i] and target_objects[j]
+ */
+template <class T1, class T2>
+std::vector<std::vector<double>> get2dIoUMatrix(
+  const std::vector<T1> & source_objects, const std::vector<T2> & target_objects,
+  const double min_union_area = 0.01)
+{
+  std::vector<ObjectPolygon2d> target_polygons;
+  target_polygons.reserve(target_objects.size());
+  for (const auto & target_object : target_objects) {
+    target_polygons.push_back(toObjectPolygon2d(target_object));
+  }
+
+  std::vector<std::vector<double>> iou_matrix(source_objects.size());
+  for (size_t i = 0; i < source_objects.size(); ++i) {
+    const auto source_polygon = toObjectPolygon2d(source_objects.at(i));
+    iou_matrix.at(i).reserve(target_polygons.size());
+    for (const auto & target_polygon : target_polygons) {
+      iou_matrix.at(i).push_back(get2dIoU(source_polygon, target_polygon, min_union_area));
+    }
+  }
+  return iou_matrix;
 }
 }  // namespace object_recognition_utils
 
@@ -0,0 +1,276 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "object_recognition_utils/matching.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+using object_recognition_utils::ConvexPolygon2d;
+using object_recognition_utils::ObjectPolygon2d;
+using tier4_autoware_utils::Point2d;
+using tier4_autoware_utils::Polygon2d;
+
+// positive if p is on the left of the line from a to b
+double cross(const Point2d & a, const Point2d & b, const Point2d & p)
+{
+  return (b.x() - a.x()) * (p.y() - a.y()) - (b.y() - a.y()) * (p.x() - a.x());
+}
+
+void appendPoint(ConvexPolygon2d & polygon, const double x, const double y)
+{
+  // a nearly degenerate polygon may have more vertices than a convex one due to rounding errors
+  if (polygon.size < ConvexPolygon2d::max_size) {
+    polygon.points[polygon.size++] = Point2d(x, y);
+  }
+}
+
+// clip the polygon by the half plane on the left of the line from a to b
+void clipPolygon(
+  const ConvexPolygon2d & polygon, const Point2d & a, const Point2d & b, ConvexPolygon2d & clipped)
+{
+  clipped.size = 0;
+  for (size_t i = 0; i < polygon.size; ++i) {
+    const auto & current = polygon.points[i];
+    const auto & next = polygon.points[(i + 1) % polygon.size];
+    const double current_side = cross(a, b, current);
+    const double next_side = cross(a, b, next);
+    if (current_side >= 0.0) {
+      appendPoint(clipped, current.x(), current.y());
+    }
+    if ((current_side > 0.0 && next_side < 0.0) || (current_side < 0.0 && next_side > 0.0)) {
+      const double ratio = current_side / (current_side - next_side);
+      appendPoint(
+        clipped, current.x() + ratio * (next.x() - current.x()),
+        current.y() + ratio * (next.y() - current.y()));
+    }
+  }
+}
+
+// Andrew's monotone chain, the sorted points are overwritten
+double getConvexHullArea(std::array<Point2d, 2 * ConvexPolygon2d::max_size> & points, size_t size)
+{
+  std::sort(points.begin(), points.begin() + size, [](const Point2d & p1, const Point2d & p2) {
+    return p1.x() < p2.x() || (p1.x() == p2.x() && p1.y() < p2.y());
+  });
+  std::array<Point2d, 2 * ConvexPolygon2d::max_size + 1> hull;
+  size_t hull_size = 0;
+  // lower hull
+  for (size_t i = 0; i < size; ++i) {
+    while (hull_size >= 2 && cross(hull[hull_size - 2], hull[hull_size - 1], points[i]) <= 0.0) {
+      --hull_size;
+    }
+    hull[hull_size++] = points[i];
+  }
+  // upper hull
+  const size_t lower_size = hull_size + 1;
+  for (size_t i = size - 1; i-- > 0;) {
+    while (hull_size >= lower_size &&
+           cross(hull[hull_size - 2], hull[hull_size - 1], points[i]) <= 0.0) {
+      --hull_size;
+    }
+    hull[hull_size++] = points[i];
+  }
+
+  double area = 0.0;
+  for (size_t i = 0; i + 1 < hull_size; ++i) {
+    area += hull[i].x() * hull[i + 1].y() - hull[i + 1].x() * hull[i].y();
+  }
+  return 0.5 * area;
+}
+
+Polygon2d getBoostPolygon(const ObjectPolygon2d & object_polygon)
+{
+  return object_polygon.is_convex ? object_recognition_utils::toPolygon2d(
+                                      object_polygon.convex_polygon)
+                                  : object_polygon.polygon;
+}
+}  // namespace
+
+namespace object_recognition_utils
+{
+bool toConvexPolygon2d(
+  const geometry_msgs::msg::Pose & pose, const autoware_auto_perception_msgs::msg::Shape & shape,
+  ConvexPolygon2d & polygon)
+{
+  using autoware_auto_perception_msgs::msg::Shape;
+
+  polygon.size = 0;
+  if (shape.type == Shape::BOUNDING_BOX) {
+    // x and y axes of the rotation matrix, as calcOffsetPose rotates the offsets
+    const auto & q = pose.orientation;
+    const double norm2 = q.x * q.x + q.y * q.y + q.z * q.z + q.w * q.w;
+    const double s = norm2 > 0.0 ? 2.0 / norm2 : 0.0;
+    const double xx = 1.0 - s * (q.y * q.y + q.z * q.z);
+    const double xy = s * (q.x * q.y + q.w * q.z);
+    const double yx = s * (q.x * q.y - q.w * q.z);
+    const double yy = 1.0 - s * (q.x * q.x + q.z * q.z);
+
+    const double half_length = shape.dimensions.x / 2.0;
+    const double half_width = shape.dimensions.y / 2.0;
+    const std::array<std::pair<double, double>, 4> offsets{
+      {{half_length, half_width},
+       {-half_length, half_width},
+       {-half_length, -half_width},
+       {half_length, -half_width}}};
+    for (const auto & offset : offsets) {
+      appendPoint(
+        polygon, pose.position.x + xx * offset.first + yx * offset.second,
+        pose.position.y + xy * offset.first + yy * offset.second);
+    }
+  } else if (shape.type == Shape::CYLINDER) {
+    const double radius = shape.dimensions.x / 2.0;
+    constexpr int circle_discrete_num = 6;
+    for (int i = 0; i < circle_discrete_num; ++i) {
+      const double angle =
+        (static_cast<double>(i) / static_cast<double>(circle_discrete_num)) * 2.0 * M_PI +
+        M_PI / static_cast<double>(circle_discrete_num);
+      appendPoint(
+        polygon, std::cos(angle) * radius + pose.position.x,
+        std::sin(angle) * radius + pose.position.y);
+    }
+  } else {
+    return false;
+  }
+
+  if (getArea(polygon) < 0.0) {
+    std::reverse(polygon.points.begin(), polygon.points.begin() + polygon.size);
+  }
+  return true;
+}
+
+Polygon2d toPolygon2d(const ConvexPolygon2d & polygon)
+{
+  // boost polygon is clockwise and closed
+  Polygon2d boost_polygon;
+  for (size_t i = polygon.size; i-- > 0;) {
+    boost_polygon.outer().push_back(polygon.points[i]);
+  }
+  if (polygon.size > 0) {
+    boost_polygon.outer().push_back(polygon.points[polygon.size - 1]);
+  }
+  return boost_polygon;
+}
+
+double getArea(const ConvexPolygon2d & polygon)
+{
+  double area = 0.0;
+  for (size_t i = 0; i < polygon.size; ++i) {
+    const auto & current = polygon.points[i];
+    const auto & next = polygon.points[(i + 1) % polygon.size];
+    area += current.x() * next.y() - next.x() * current.y();
+  }
+  return 0.5 * area;
+}
+
+double getIntersectionArea(
+  const ConvexPolygon2d & source_polygon, const ConvexPolygon2d & target_polygon)
+{
+  ConvexPolygon2d clipped = source_polygon;
+  ConvexPolygon2d buffer;
+  for (size_t i = 0; i < target_polygon.size && clipped.size > 0; ++i) {
+    clipPolygon(
+      clipped, target_polygon.points[i], target_polygon.points[(i + 1) % target_polygon.size],
+      buffer);
+    std::swap(clipped, buffer);
+  }
+  return std::max(0.0, getArea(clipped));
+}
+
+double getConvexShapeArea(
+  const ConvexPolygon2d & source_polygon, const ConvexPolygon2d & target_polygon)
+{
+  std::array<Point2d, 2 * ConvexPolygon2d::max_size> points;
+  std::copy(
+    source_polygon.points.begin(), source_polygon.points.begin() + source_polygon.size,
+    points.begin());
+  std::copy(
+    target_polygon.points.begin(), target_polygon.points.begin() + target_polygon.size,
+    points.begin() + source_polygon.size);
+  return getConvexHullArea(points, source_polygon.size + target_polygon.size);
+}
+
+double get2dIoU(
+  const ObjectPolygon2d & source_polygon, const ObjectPolygon2d & target_polygon,
+  const double min_union_area)
+{
+  double intersection_area = 0.0;
+  double union_area = 0.0;
+  if (source_polygon.is_convex && target_polygon.is_convex) {
+    intersection_area =
+      getIntersectionArea(source_polygon.convex_polygon, target_polygon.convex_polygon);
+    if (intersection_area == 0.0) return 0.0;
+    union_area = source_polygon.area + target_polygon.area - intersection_area;
+  } else {
+    const auto source = getBoostPolygon(source_polygon);
+    const auto target = getBoostPolygon(target_polygon);
+    intersection_area = getIntersectionArea(source, target);
+    if (intersection_area == 0.0) return 0.0;
+    union_area = getUnionArea(source, target);
+  }
+
+  const double iou =
+    union_area < min_union_area ? 0.0 : std::min(1.0, intersection_area / union_area);
+  return iou;
+}
+
+double get2dGeneralizedIoU(
+  const ObjectPolygon2d & source_polygon, const ObjectPolygon2d & target_polygon)
+{
+  double intersection_area = 0.0;
+  double union_area = 0.0;
+  double convex_shape_area = 0.0;
+  if (source_polygon.is_convex && target_polygon.is_convex) {
+    intersection_area =
+      getIntersectionArea(source_polygon.convex_polygon, target_polygon.convex_polygon);
+    union_area = source_polygon.area + target_polygon.area - intersection_area;
+    convex_shape_area =
+      getConvexShapeArea(source_polygon.convex_polygon, target_polygon.convex_polygon);
+  } else {
+    const auto source = getBoostPolygon(source_polygon);
+    const auto target = getBoostPolygon(target_polygon);
+    intersection_area = getIntersectionArea(source, target);
+    union_area = getUnionArea(source, target);
+    convex_shape_area = getConvexShapeArea(source, target);
+  }
+
+  const double iou = union_area < 0.01 ? 0.0 : std::min(1.0, intersection_area / union_area);
+  return iou - (convex_shape_area - union_area) / convex_shape_area;
+}
+
+double get2dPrecision(
+  const ObjectPolygon2d & source_polygon, const ObjectPolygon2d & target_polygon)
+{
+  const double intersection_area =
+    source_polygon.is_convex && target_polygon.is_convex
+      ? getIntersectionArea(source_polygon.convex_polygon, target_polygon.convex_polygon)
+      : getIntersectionArea(getBoostPolygon(source_polygon), getBoostPolygon(target_polygon));
+  if (intersection_area == 0.0) return 0.0;
+
+  return std::min(1.0, intersection_area / source_polygon.area);
+}
+
+double get2dRecall(const ObjectPolygon2d & source_polygon, const ObjectPolygon2d & target_polygon)
+{
+  const double intersection_area =
+    source_polygon.is_convex && target_polygon.is_convex
+      ? getIntersectionArea(source_polygon.convex_polygon, target_polygon.convex_polygon)
+      : getIntersectionArea(getBoostPolygon(source_polygon), getBoostPolygon(target_polygon));
+  if (intersection_area == 0.0) return 0.0;
+
+  return std::min(1.0, intersection_area / target_polygon.area);
+}
+}  // namespace object_recognition_utils
@@ -19,6 +19,10 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <random>
+#include <vector>
+
 using tier4_autoware_utils::Point2d;
 using tier4_autoware_utils::Point3d;
 
@@ -284,3 +288,107 @@ TEST(matching, test_get2dRecall)
     EXPECT_DOUBLE_EQ(reversed_recall, quart_circle * 4);
   }
 }
+
+TEST(matching, test_convexPolygon)
+{
+  using autoware_auto_perception_msgs::msg::DetectedObject;
+  using autoware_auto_perception_msgs::msg::Shape;
+  using object_recognition_utils::get2dGeneralizedIoU;
+  using object_recognition_utils::get2dIoU;
+  using object_recognition_utils::get2dPrecision;
+  using object_recognition_utils::get2dRecall;
+  using object_recognition_utils::getConvexShapeArea;
+  using object_recognition_utils::getIntersectionArea;
+  using object_recognition_utils::getUnionArea;
+  using tier4_autoware_utils::toPolygon2d;
+
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<double> position_dist(-3.0, 3.0);
+  std::uniform_real_distribution<double> yaw_dist(-M_PI, M_PI);
+  std::uniform_real_distribution<double> size_dist(0.5, 5.0);
+  const auto create_object = [&]() {
+    DetectedObject obj;
+    obj.kinematics.pose_with_covariance.pose =
+      createPose(position_dist(gen), position_dist(gen), yaw_dist(gen));
+    obj.shape.type = gen() % 2 == 0 ? Shape::BOUNDING_BOX : Shape::CYLINDER;
+    obj.shape.dimensions.x = size_dist(gen);
+    obj.shape.dimensions.y = size_dist(gen);
+    return obj;
+  };
+
+  // the convex polygons give the same results as boost
+  for (int i = 0; i < 1000; ++i) {
+    const auto source_obj = create_object();
+    const auto target_obj = create_object();
+    const auto source_polygon = toPolygon2d(source_obj);
+    const auto target_polygon = toPolygon2d(target_obj);
+    const double intersection_area = getIntersectionArea(source_polygon, target_polygon);
+    const double union_area = getUnionArea(source_polygon, target_polygon);
+    const double convex_shape_area = getConvexShapeArea(source_polygon, target_polygon);
+
+    const double iou = intersection_area == 0.0 ? 0.0 : intersection_area / union_area;
+    EXPECT_NEAR(get2dIoU(source_obj, target_obj), iou, epsilon);
+    EXPECT_NEAR(
+      get2dGeneralizedIoU(source_obj, target_obj),
+      intersection_area / union_area - (convex_shape_area - union_area) / convex_shape_area,
+      epsilon);
+    EXPECT_NEAR(
+      get2dPrecision(source_obj, target_obj),
+      std::min(1.0, intersection_area / boost::geometry::area(source_polygon)), epsilon);
+    EXPECT_NEAR(
+      get2dRecall(source_obj, target_obj),
+      std::min(1.0, intersection_area / boost::geometry::area(target_polygon)), epsilon);
+  }
+
+  {  // polygon shape is calculated by boost
+    DetectedObject source_obj;
+    source_obj.kinematics.pose_with_covariance.pose = createPose(0.5, 0.5, 0.0);
+    source_obj.shape.type = Shape::POLYGON;
+    for (const auto & point : {Point2d{-0.5, -0.5}, Point2d{0.5, -0.5}, Point2d{0.0, 0.5}}) {
+      source_obj.shape.footprint.points.push_back(
+        geometry_msgs::build<geometry_msgs::msg::Point32>().x(point.x()).y(point.y()).z(0.0));
+    }
+
+    DetectedObject target_obj;
+    target_obj.kinematics.pose_with_covariance.pose = createPose(0.0, 0.0, 0.0);
+    target_obj.shape.type = Shape::BOUNDING_BOX;
+    target_obj.shape.dimensions.x = 2.0;
+    target_obj.shape.dimensions.y = 2.0;
+
+    EXPECT_NEAR(get2dIoU(source_obj, target_obj), 0.5 / 4.0, epsilon);
+    EXPECT_NEAR(get2dPrecision(source_obj, target_obj), 1.0, epsilon);
+    EXPECT_NEAR(get2dRecall(source_obj, target_obj), 0.5 / 4.0, epsilon);
+  }
+}
+
+TEST(matching, test_get2dIoUMatrix)
+{
+  using autoware_auto_perception_msgs::msg::DetectedObject;
+  using object_recognition_utils::get2dIoU;
+  using object_recognition_utils::get2dIoUMatrix;
+
+  std::vector<DetectedObject> source_objects;
+  std::vector<DetectedObject> target_objects;
+  for (int i = 0; i < 4; ++i) {
+    DetectedObject obj;
+    obj.kinematics.pose_with_covariance.pose = createPose(0.3 * i, 0.2 * i, 0.4 * i);
+    obj.shape.type = autoware_auto_perception_msgs::msg::Shape::BOUNDING_BOX;
+    obj.shape.dimensions.x = 2.0;
+    obj.shape.dimensions.y = 1.0;
+    source_objects.push_back(obj);
+    if (i < 3) {
+      obj.shape.type = autoware_auto_perception_msgs::msg::Shape::CYLINDER;
+      target_objects.push_back(obj);
+    }
+  }
+
+  const auto iou_matrix = get2dIoUMatrix(source_objects, target_objects);
+  ASSERT_EQ(iou_matrix.size(), source_objects.size());
+  for (size_t i = 0; i < source_objects.size(); ++i) {
+    ASSERT_EQ(iou_matrix.at(i).size(), target_objects.size());
+    for (size_t j = 0; j < target_objects.size(); ++j) {
+      EXPECT_DOUBLE_EQ(
+        iou_matrix.at(i).at(j), get2dIoU(source_objects.at(i), target_objects.at(j)));
+    }
+  }
+}
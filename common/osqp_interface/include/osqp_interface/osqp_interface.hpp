@@ -54,6 +54,9 @@ private:
   bool m_work_initialized = false;
   // Exitflag
   int64_t m_exitflag;
+  // P and A of the current work, whose sparsity patterns are compared in updateProblem
+  CSC_Matrix m_P_csc;
+  CSC_Matrix m_A_csc;
 
   // Runs the solver on the stored problem.
   std::tuple<std::vector<double>, std::vector<double>, int64_t, int64_t, int64_t> solve();
@@ -135,6 +138,35 @@ public:
     CSC_Matrix P, CSC_Matrix A, const std::vector<double> & q, const std::vector<double> & l,
     const std::vector<double> & u);
 
+  /// \brief Updates the problem keeping the workspace when the sparsity patterns of P and A and
+  ///        the problem size are same as the ones of the current workspace. Then, only the numeric
+  ///        values are updated without the setup (symbolic factorization), and the previous
+  ///        solution is used for the warm start. Otherwise, the workspace is set up again by
+  ///        initializeProblem.
+  /// \details How to use:
+  /// \details   osqp_interface.updateProblem(P, A, q, l, u);
+  /// \details   const auto result = osqp_interface.optimize();
+  /// \param P (n,n) matrix defining relations between parameters.
+  /// \param A (m,n) matrix defining parameter constraints relative to the lower and upper bound.
+  /// \param q (n) vector defining the linear cost of the problem.
+  /// \param l (m) vector defining the lower bound problem constraint.
+  /// \param u (m) vector defining the upper bound problem constraint.
+  /// \return exit flag of the update or the setup (Healthy condition: 0).
+  int64_t updateProblem(
+    const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
+    const std::vector<double> & l, const std::vector<double> & u);
+  int64_t updateProblem(
+    const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+    const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u);
+  int64_t updateProblem(
+    CSC_Matrix P_csc, CSC_Matrix A_csc, const std::vector<double> & q,
+    const std::vector<double> & l, const std::vector<double> & u);
+
+  /// \brief Check if the current workspace can be updated by P and A without the setup.
+  /// \param P_csc upper trapezoidal (n,n) matrix
+  /// \param A_csc (m,n) matrix
+  bool isSameSparsityPattern(const CSC_Matrix & P_csc, const CSC_Matrix & A_csc) const;
+
   // Setter functions for warm start
   bool setWarmStart(
     const std::vector<double> & primal_variables, const std::vector<double> & dual_variables);
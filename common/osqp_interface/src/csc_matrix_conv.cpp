@@ -18,6 +18,7 @@
 #include <Eigen/SparseCore>
 
 #include <exception>
+#include <stdexcept>
 #include <iostream>
 #include <vector>
 
@@ -115,6 +116,57 @@ CSC_Matrix calCSCMatrixTrapezoidal(const Eigen::MatrixXd & mat)
   return csc_matrix;
 }
 
+CSC_Matrix calCSCMatrix(const Eigen::SparseMatrix<double> & mat)
+{
+  const size_t elem = static_cast<size_t>(mat.nonZeros());
+  const Eigen::Index cols = mat.cols();
+
+  CSC_Matrix csc_matrix;
+  csc_matrix.m_vals.reserve(elem);
+  csc_matrix.m_row_idxs.reserve(elem);
+  csc_matrix.m_col_idxs.reserve(static_cast<size_t>(cols) + 1);
+
+  csc_matrix.m_col_idxs.push_back(0);
+  for (Eigen::Index j = 0; j < cols; j++) {  // col iteration
+    for (Eigen::SparseMatrix<double>::InnerIterator itr(mat, j); itr; ++itr) {
+      csc_matrix.m_vals.push_back(itr.value());
+      csc_matrix.m_row_idxs.push_back(itr.row());
+    }
+    csc_matrix.m_col_idxs.push_back(static_cast<c_int>(csc_matrix.m_vals.size()));
+  }
+
+  return csc_matrix;
+}
+
+CSC_Matrix calCSCMatrixTrapezoidal(const Eigen::SparseMatrix<double> & mat)
+{
+  if (mat.rows() != mat.cols()) {
+    throw std::invalid_argument("Matrix must be square (n, n)");
+  }
+
+  const size_t elem = static_cast<size_t>(mat.nonZeros());
+  const Eigen::Index cols = mat.cols();
+
+  CSC_Matrix csc_matrix;
+  csc_matrix.m_vals.reserve(elem);
+  csc_matrix.m_row_idxs.reserve(elem);
+  csc_matrix.m_col_idxs.reserve(static_cast<size_t>(cols) + 1);
+
+  csc_matrix.m_col_idxs.push_back(0);
+  for (Eigen::Index j = 0; j < cols; j++) {  // col iteration
+    for (Eigen::SparseMatrix<double>::InnerIterator itr(mat, j); itr; ++itr) {
+      if (itr.row() > j) {
+        continue;
+      }
+      csc_matrix.m_vals.push_back(itr.value());
+      csc_matrix.m_row_idxs.push_back(itr.row());
+    }
+    csc_matrix.m_col_idxs.push_back(static_cast<c_int>(csc_matrix.m_vals.size()));
+  }
+
+  return csc_matrix;
+}
+
 void printCSCMatrix(const CSC_Matrix & csc_mat)
 {
   std::cout << "[";
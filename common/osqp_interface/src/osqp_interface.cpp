@@ -21,8 +21,11 @@
 #include <iostream>
 #include <limits>
 #include <memory>
+#include <sstream>
+#include <stdexcept>
 #include <string>
 #include <tuple>
+#include <utility>
 #include <vector>
 
 namespace autoware
@@ -31,6 +34,43 @@ namespace common
 {
 namespace osqp
 {
+namespace
+{
+template <class Matrix>
+void validateProblemSize(
+  const Matrix & P, const Matrix & A, const std::vector<double> & q, const std::vector<double> & l,
+  const std::vector<double> & u)
+{
+  // check if arguments are valid
+  std::stringstream ss;
+  if (P.rows() != P.cols()) {
+    ss << "P.rows() and P.cols() are not the same. P.rows() = " << P.rows()
+       << ", P.cols() = " << P.cols();
+    throw std::invalid_argument(ss.str());
+  }
+  if (P.rows() != static_cast<int>(q.size())) {
+    ss << "P.rows() and q.size() are not the same. P.rows() = " << P.rows()
+       << ", q.size() = " << q.size();
+    throw std::invalid_argument(ss.str());
+  }
+  if (P.rows() != A.cols()) {
+    ss << "P.rows() and A.cols() are not the same. P.rows() = " << P.rows()
+       << ", A.cols() = " << A.cols();
+    throw std::invalid_argument(ss.str());
+  }
+  if (A.rows() != static_cast<int>(l.size())) {
+    ss << "A.rows() and l.size() are not the same. A.rows() = " << A.rows()
+       << ", l.size() = " << l.size();
+    throw std::invalid_argument(ss.str());
+  }
+  if (A.rows() != static_cast<int>(u.size())) {
+    ss << "A.rows() and u.size() are not the same. A.rows() = " << A.rows()
+       << ", u.size() = " << u.size();
+    throw std::invalid_argument(ss.str());
+  }
+}
+}  // namespace
+
 OSQPInterface::OSQPInterface(const c_float eps_abs, const bool polish)
 : m_work{nullptr, OSQPWorkspaceDeleter}
 {
@@ -287,33 +327,7 @@ int64_t OSQPInterface::initializeProblem(
   const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
   const std::vector<double> & l, const std::vector<double> & u)
 {
-  // check if arguments are valid
-  std::stringstream ss;
-  if (P.rows() != P.cols()) {
-    ss << "P.rows() and P.cols() are not the same. P.rows() = " << P.rows()
-       << ", P.cols() = " << P.cols();
-    throw std::invalid_argument(ss.str());
-  }
-  if (P.rows() != static_cast<int>(q.size())) {
-    ss << "P.rows() and q.size() are not the same. P.rows() = " << P.rows()
-       << ", q.size() = " << q.size();
-    throw std::invalid_argument(ss.str());
-  }
-  if (P.rows() != A.cols()) {
-    ss << "P.rows() and A.cols() are not the same. P.rows() = " << P.rows()
-       << ", A.cols() = " << A.cols();
-    throw std::invalid_argument(ss.str());
-  }
-  if (A.rows() != static_cast<int>(l.size())) {
-    ss << "A.rows() and l.size() are not the same. A.rows() = " << A.rows()
-       << ", l.size() = " << l.size();
-    throw std::invalid_argument(ss.str());
-  }
-  if (A.rows() != static_cast<int>(u.size())) {
-    ss << "A.rows() and u.size() are not the same. A.rows() = " << A.rows()
-       << ", u.size() = " << u.size();
-    throw std::invalid_argument(ss.str());
-  }
+  validateProblemSize(P, A, q, l, u);
 
   CSC_Matrix P_csc = calCSCMatrixTrapezoidal(P);
   CSC_Matrix A_csc = calCSCMatrix(A);
@@ -360,9 +374,70 @@ int64_t OSQPInterface::initializeProblem(
   m_work.reset(workspace);
   m_work_initialized = true;
 
+  // NOTE: moving the vectors does not invalidate the pointers in m_data
+  m_P_csc = std::move(P_csc);
+  m_A_csc = std::move(A_csc);
+
   return m_exitflag;
 }
 
+int64_t OSQPInterface::updateProblem(
+  const Eigen::MatrixXd & P, const Eigen::MatrixXd & A, const std::vector<double> & q,
+  const std::vector<double> & l, const std::vector<double> & u)
+{
+  validateProblemSize(P, A, q, l, u);
+
+  return updateProblem(calCSCMatrixTrapezoidal(P), calCSCMatrix(A), q, l, u);
+}
+
+int64_t OSQPInterface::updateProblem(
+  const Eigen::SparseMatrix<double> & P, const Eigen::SparseMatrix<double> & A,
+  const std::vector<double> & q, const std::vector<double> & l, const std::vector<double> & u)
+{
+  validateProblemSize(P, A, q, l, u);
+
+  return updateProblem(calCSCMatrixTrapezoidal(P), calCSCMatrix(A), q, l, u);
+}
+
+int64_t OSQPInterface::updateProblem(
+  CSC_Matrix P_csc, CSC_Matrix A_csc, const std::vector<double> & q, const std::vector<double> & l,
+  const std::vector<double> & u)
+{
+  if (
+    !m_work_initialized || m_exitflag != 0 || static_cast<int64_t>(q.size()) != m_param_n ||
+    static_cast<c_int>(l.size()) != m_data->m || !isSameSparsityPattern(P_csc, A_csc)) {
+    return initializeProblem(std::move(P_csc), std::move(A_csc), q, l, u);
+  }
+
+  // update the numeric values only. The solution of the previous problem remains in the work,
+  // and is used as the initial guess since warm_start is enabled.
+  m_exitflag = osqp_update_P_A(
+    m_work.get(), P_csc.m_vals.data(), OSQP_NULL, static_cast<c_int>(P_csc.m_vals.size()),
+    A_csc.m_vals.data(), OSQP_NULL, static_cast<c_int>(A_csc.m_vals.size()));
+  if (m_exitflag == 0) {
+    m_exitflag = osqp_update_lin_cost(m_work.get(), q.data());
+  }
+  if (m_exitflag == 0) {
+    m_exitflag = osqp_update_bounds(m_work.get(), l.data(), u.data());
+  }
+  if (m_exitflag != 0) {
+    // fall back to the setup
+    return initializeProblem(std::move(P_csc), std::move(A_csc), q, l, u);
+  }
+
+  m_P_csc = std::move(P_csc);
+  m_A_csc = std::move(A_csc);
+
+  return m_exitflag;
+}
+
+bool OSQPInterface::isSameSparsityPattern(const CSC_Matrix & P_csc, const CSC_Matrix & A_csc) const
+{
+  return m_work_initialized && P_csc.m_row_idxs == m_P_csc.m_row_idxs &&
+         P_csc.m_col_idxs == m_P_csc.m_col_idxs && A_csc.m_row_idxs == m_A_csc.m_row_idxs &&
+         A_csc.m_col_idxs == m_A_csc.m_col_idxs;
+}
+
 std::tuple<std::vector<double>, std::vector<double>, int64_t, int64_t, int64_t>
 OSQPInterface::solve()
 {
@@ -16,6 +16,7 @@
 #include "osqp_interface/csc_matrix_conv.hpp"
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <string>
 #include <tuple>
@@ -164,6 +165,44 @@ TEST(TestCscMatrixConv, Trapezoidal)
     EXPECT_EQ(e.what(), std::string("Matrix must be square (n, n)"));
   }
 }
+TEST(TestCscMatrixConv, Sparse)
+{
+  using autoware::common::osqp::calCSCMatrix;
+  using autoware::common::osqp::calCSCMatrixTrapezoidal;
+  using autoware::common::osqp::CSC_Matrix;
+
+  Eigen::MatrixXd square(3, 3);
+  square << 1.0, 2.0, 0.0, 2.0, 4.0, 5.0, 0.0, 5.0, 6.0;
+  const Eigen::SparseMatrix<double> sparse_square = square.sparseView();
+
+  // same as the dense version
+  for (const auto & [csc, ref] :
+       {std::make_pair(calCSCMatrix(sparse_square), calCSCMatrix(square)),
+        std::make_pair(
+          calCSCMatrixTrapezoidal(sparse_square), calCSCMatrixTrapezoidal(square))}) {
+    EXPECT_EQ(csc.m_vals, ref.m_vals);
+    EXPECT_EQ(csc.m_row_idxs, ref.m_row_idxs);
+    EXPECT_EQ(csc.m_col_idxs, ref.m_col_idxs);
+  }
+
+  // explicit zeros are kept
+  std::vector<Eigen::Triplet<double>> triplets{{0, 0, 1.0}, {1, 0, 0.0}, {0, 1, 0.0}, {1, 1, 3.0}};
+  Eigen::SparseMatrix<double> sparse_zeros(2, 2);
+  sparse_zeros.setFromTriplets(triplets.begin(), triplets.end());
+
+  const CSC_Matrix csc_zeros = calCSCMatrix(sparse_zeros);
+  EXPECT_EQ(csc_zeros.m_vals, (std::vector<c_float>{1.0, 0.0, 0.0, 3.0}));
+  EXPECT_EQ(csc_zeros.m_row_idxs, (std::vector<c_int>{0, 1, 0, 1}));
+  EXPECT_EQ(csc_zeros.m_col_idxs, (std::vector<c_int>{0, 2, 4}));
+
+  const CSC_Matrix csc_trap_zeros = calCSCMatrixTrapezoidal(sparse_zeros);
+  EXPECT_EQ(csc_trap_zeros.m_vals, (std::vector<c_float>{1.0, 0.0, 3.0}));
+  EXPECT_EQ(csc_trap_zeros.m_row_idxs, (std::vector<c_int>{0, 0, 1}));
+  EXPECT_EQ(csc_trap_zeros.m_col_idxs, (std::vector<c_int>{0, 1, 3}));
+
+  EXPECT_THROW(
+    calCSCMatrixTrapezoidal(Eigen::SparseMatrix<double>(1, 2)), std::invalid_argument);
+}
 TEST(TestCscMatrixConv, Print)
 {
   using autoware::common::osqp::calCSCMatrix;
@@ -16,6 +16,7 @@
 #include "osqp_interface/osqp_interface.hpp"
 
 #include <Eigen/Core>
+#include <Eigen/SparseCore>
 
 #include <tuple>
 #include <vector>
@@ -160,5 +161,41 @@ TEST(TestOsqpInterface, BasicQp)
     check_result(result);
     EXPECT_EQ(osqp.getTakenIter(), 1);
   }
+
+  // update problem keeping the workspace
+  {
+    std::tuple<std::vector<double>, std::vector<double>, int, int, int> result;
+    // initial problem with the same sparsity pattern
+    const Eigen::MatrixXd P_ini = 2.0 * P;
+    const Eigen::MatrixXd A_ini = 0.5 * A;
+    autoware::common::osqp::OSQPInterface osqp(P_ini, A_ini, q, l, u, 1e-6);
+    osqp.optimize();
+
+    // only values are updated
+    EXPECT_TRUE(osqp.isSameSparsityPattern(calCSCMatrixTrapezoidal(P), calCSCMatrix(A)));
+    EXPECT_EQ(osqp.updateProblem(P, A, q, l, u), 0);
+    result = osqp.optimize();
+    check_result(result);
+
+    // sparse matrices
+    const Eigen::SparseMatrix<double> P_sparse = P.sparseView();
+    const Eigen::SparseMatrix<double> A_sparse = A.sparseView();
+    EXPECT_EQ(osqp.updateProblem(P_sparse, A_sparse, q, l, u), 0);
+    result = osqp.optimize();
+    check_result(result);
+
+    // the workspace is set up again for a different sparsity pattern
+    const Eigen::MatrixXd P_diag = (Eigen::MatrixXd(2, 2) << 4, 0, 0, 2).finished();
+    EXPECT_FALSE(osqp.isSameSparsityPattern(calCSCMatrixTrapezoidal(P_diag), calCSCMatrix(A)));
+    EXPECT_EQ(osqp.updateProblem(P_diag, A, q, l, u), 0);
+    osqp.optimize();
+    EXPECT_EQ(osqp.updateProblem(P, A, q, l, u), 0);
+    result = osqp.optimize();
+    check_result(result);
+
+    // invalid size
+    EXPECT_THROW(
+      osqp.updateProblem(P, A, q, std::vector<double>{0.0}, u), std::invalid_argument);
+  }
 }
 }  // namespace
@@ -0,0 +1,49 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef QP_INTERFACE__QP_PROBLEM_HPP_
+#define QP_INTERFACE__QP_PROBLEM_HPP_
+
+#include <Eigen/Core>
+
+#include <string>
+#include <vector>
+
+namespace qp
+{
+/// \brief QP instance: min 1/2 x' P x + q' x  s.t. l <= A x <= u
+struct QPProblem
+{
+  Eigen::MatrixXd P;
+  Eigen::MatrixXd A;
+  std::vector<double> q;
+  std::vector<double> l;
+  std::vector<double> u;
+};
+
+/// \brief Append the QP instance to the file, so that the instances solved in consecutive cycles
+///        can be replayed in order (e.g. for the warm start). Only non-zero entries of P and A are
+///        written, and values are written with the full precision.
+/// \return false if the file cannot be opened
+bool saveQPProblem(const QPProblem & problem, const std::string & file_path);
+
+/// \brief Load all the QP instances saved by saveQPProblem in the file.
+/// \throw std::runtime_error if the file cannot be opened or its format is invalid
+std::vector<QPProblem> loadQPProblems(const std::string & file_path);
+
+/// \brief Calculate the maximum violation of l <= A x <= u.
+double calcConstraintViolation(const QPProblem & problem, const std::vector<double> & x);
+}  // namespace qp
+
+#endif  // QP_INTERFACE__QP_PROBLEM_HPP_
@@ -347,7 +347,8 @@ void OSQPInterface::updateBounds(
 
 int OSQPInterface::getIteration() const
 {
-  return m_work->info->iter;
+  // NOTE: m_work is reset after optimization without the warm start
+  return static_cast<int>(m_latest_work_info.iter);
 }
 
 int OSQPInterface::getStatus() const
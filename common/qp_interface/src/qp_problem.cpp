@@ -0,0 +1,168 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "qp_interface/qp_problem.hpp"
+
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <vector>
+
+// File format: one block per QP instance
+//   qp <n> <m>
+//   P <number of non-zero entries>
+//   <row> <col> <value>   (for each non-zero entry)
+//   A <number of non-zero entries>
+//   <row> <col> <value>   (for each non-zero entry)
+//   q <q_0> ... <q_n-1>
+//   l <l_0> ... <l_m-1>
+//   u <u_0> ... <u_m-1>
+namespace
+{
+void writeMatrix(std::ofstream & ofs, const std::string & name, const Eigen::MatrixXd & mat)
+{
+  std::vector<std::tuple<Eigen::Index, Eigen::Index, double>> entries;
+  for (Eigen::Index j = 0; j < mat.cols(); ++j) {
+    for (Eigen::Index i = 0; i < mat.rows(); ++i) {
+      if (mat(i, j) != 0.0) {
+        entries.emplace_back(i, j, mat(i, j));
+      }
+    }
+  }
+
+  ofs << name << " " << entries.size() << "\n";
+  for (const auto & [i, j, val] : entries) {
+    ofs << i << " " << j << " " << val << "\n";
+  }
+}
+
+void writeVector(std::ofstream & ofs, const std::string & name, const std::vector<double> & vec)
+{
+  ofs << name;
+  for (const double val : vec) {
+    ofs << " " << val;
+  }
+  ofs << "\n";
+}
+
+void expectToken(std::ifstream & ifs, const std::string & expected_token)
+{
+  std::string token;
+  if (!(ifs >> token) || token != expected_token) {
+    throw std::runtime_error("invalid QP problem file: expected " + expected_token);
+  }
+}
+
+Eigen::MatrixXd readMatrix(
+  std::ifstream & ifs, const std::string & name, const Eigen::Index rows, const Eigen::Index cols)
+{
+  expectToken(ifs, name);
+  size_t entries_num;
+  if (!(ifs >> entries_num)) {
+    throw std::runtime_error("invalid QP problem file: number of entries of " + name);
+  }
+
+  Eigen::MatrixXd mat = Eigen::MatrixXd::Zero(rows, cols);
+  for (size_t k = 0; k < entries_num; ++k) {
+    Eigen::Index i;
+    Eigen::Index j;
+    double val;
+    if (!(ifs >> i >> j >> val) || i < 0 || rows <= i || j < 0 || cols <= j) {
+      throw std::runtime_error("invalid QP problem file: entry of " + name);
+    }
+    mat(i, j) = val;
+  }
+  return mat;
+}
+
+std::vector<double> readVector(std::ifstream & ifs, const std::string & name, const size_t size)
+{
+  expectToken(ifs, name);
+  std::vector<double> vec(size);
+  for (auto & val : vec) {
+    if (!(ifs >> val)) {
+      throw std::runtime_error("invalid QP problem file: entry of " + name);
+    }
+  }
+  return vec;
+}
+}  // namespace
+
+namespace qp
+{
+bool saveQPProblem(const QPProblem & problem, const std::string & file_path)
+{
+  std::ofstream ofs(file_path, std::ios::app);
+  if (!ofs) {
+    return false;
+  }
+  ofs.precision(std::numeric_limits<double>::max_digits10);
+
+  ofs << "qp " << problem.q.size() << " " << problem.l.size() << "\n";
+  writeMatrix(ofs, "P", problem.P);
+  writeMatrix(ofs, "A", problem.A);
+  writeVector(ofs, "q", problem.q);
+  writeVector(ofs, "l", problem.l);
+  writeVector(ofs, "u", problem.u);
+
+  return static_cast<bool>(ofs);
+}
+
+std::vector<QPProblem> loadQPProblems(const std::string & file_path)
+{
+  std::ifstream ifs(file_path);
+  if (!ifs) {
+    throw std::runtime_error("cannot open QP problem file: " + file_path);
+  }
+
+  std::vector<QPProblem> problems;
+  std::string token;
+  while (ifs >> token) {
+    size_t n;
+    size_t m;
+    if (token != "qp" || !(ifs >> n >> m)) {
+      throw std::runtime_error("invalid QP problem file: expected qp");
+    }
+
+    QPProblem problem;
+    problem.P = readMatrix(ifs, "P", n, n);
+    problem.A = readMatrix(ifs, "A", m, n);
+    problem.q = readVector(ifs, "q", n);
+    problem.l = readVector(ifs, "l", m);
+    problem.u = readVector(ifs, "u", m);
+    problems.push_back(problem);
+  }
+
+  return problems;
+}
+
+double calcConstraintViolation(const QPProblem & problem, const std::vector<double> & x)
+{
+  if (x.size() != static_cast<size_t>(problem.A.cols())) {
+    return std::numeric_limits<double>::infinity();
+  }
+
+  const Eigen::VectorXd Ax =
+    problem.A * Eigen::Map<const Eigen::VectorXd>(x.data(), static_cast<Eigen::Index>(x.size()));
+
+  double violation = 0.0;
+  for (Eigen::Index i = 0; i < Ax.size(); ++i) {
+    violation = std::max({violation, problem.l.at(i) - Ax(i), Ax(i) - problem.u.at(i)});
+  }
+  return violation;
+}
+}  // namespace qp
@@ -0,0 +1,82 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "qp_interface/osqp_interface.hpp"
+#include "qp_interface/proxqp_interface.hpp"
+#include "qp_interface/qp_problem.hpp"
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+// Replay QP instances saved by qp::saveQPProblem with each QP solver backend under several
+// tolerances and warm start settings, and print the solve time, iterations, status and
+// constraint violation of each instance as CSV.
+//
+// Usage: benchmark <qp_problem_file> [<qp_problem_file> ...]
+int main(int argc, char * argv[])
+{
+  if (argc < 2) {
+    std::cerr << "Usage: " << argv[0] << " <qp_problem_file> [<qp_problem_file> ...]" << std::endl;
+    return 1;
+  }
+
+  using SolverFactory = std::function<std::unique_ptr<qp::QPInterface>(const bool, const double)>;
+  const std::vector<std::pair<std::string, SolverFactory>> solver_factories{
+    {"osqp",
+     [](const bool enable_warm_start, const double eps_abs) {
+       return std::make_unique<qp::OSQPInterface>(enable_warm_start, eps_abs);
+     }},
+    {"proxqp", [](const bool enable_warm_start, const double eps_abs) {
+       return std::make_unique<qp::ProxQPInterface>(enable_warm_start, eps_abs);
+     }}};
+  const std::vector<double> eps_abs_vec{1e-3, 1e-4, 1e-6};
+  const std::vector<bool> enable_warm_start_vec{false, true};
+
+  std::cout << "file,solver,eps_abs,warm_start,index,variables,constraints,time_ms,iteration,"
+               "status,constraint_violation\n";
+  for (int i = 1; i < argc; ++i) {
+    const std::string file_path = argv[i];
+    const auto problems = qp::loadQPProblems(file_path);
+
+    for (const auto & [solver_name, solver_factory] : solver_factories) {
+      for (const double eps_abs : eps_abs_vec) {
+        for (const bool enable_warm_start : enable_warm_start_vec) {
+          // NOTE: the solver is kept over the instances in the file so that the warm start
+          //       works as in the node which dumped them.
+          const auto solver = solver_factory(enable_warm_start, eps_abs);
+          for (size_t idx = 0; idx < problems.size(); ++idx) {
+            const auto & p = problems.at(idx);
+
+            const auto start = std::chrono::steady_clock::now();
+            const auto x = solver->QPInterface::optimize(p.P, p.A, p.q, p.l, p.u);
+            const auto end = std::chrono::steady_clock::now();
+            const double time_ms =
+              std::chrono::duration<double, std::milli>(end - start).count();
+
+            std::cout << file_path << "," << solver_name << "," << eps_abs << ","
+                      << enable_warm_start << "," << idx << "," << p.q.size() << ","
+                      << p.l.size() << "," << time_ms << "," << solver->getIteration() << ","
+                      << solver->getStatus() << "," << qp::calcConstraintViolation(p, x) << "\n";
+          }
+        }
+      }
+    }
+  }
+
+  return 0;
+}
@@ -0,0 +1,76 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "gtest/gtest.h"
+#include "qp_interface/qp_problem.hpp"
+
+#include <Eigen/Core>
+
+#include <cstdio>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+TEST(TestQPProblem, SaveAndLoad)
+{
+  const std::string file_path = testing::TempDir() + "test_qp_problem.txt";
+  std::remove(file_path.c_str());
+
+  qp::QPProblem problem;
+  problem.P = (Eigen::MatrixXd(2, 2) << 4, 1, 1, 2).finished();
+  problem.A = (Eigen::MatrixXd(4, 2) << 1, 1, 1, 0, 0, 1, 0, 1).finished();
+  problem.q = {1.0, 1.0 / 3.0};
+  problem.l = {1.0, 0.0, 0.0, -1e30};
+  problem.u = {1.0, 0.7, 0.7, 1e30};
+
+  qp::QPProblem other_problem;
+  other_problem.P = Eigen::MatrixXd::Identity(1, 1);
+  other_problem.A = Eigen::MatrixXd::Zero(0, 1);
+  other_problem.q = {0.1};
+
+  // problems are appended
+  ASSERT_TRUE(qp::saveQPProblem(problem, file_path));
+  ASSERT_TRUE(qp::saveQPProblem(other_problem, file_path));
+  const auto loaded_problems = qp::loadQPProblems(file_path);
+  std::remove(file_path.c_str());
+
+  ASSERT_EQ(loaded_problems.size(), size_t(2));
+  EXPECT_EQ(loaded_problems.at(0).P, problem.P);
+  EXPECT_EQ(loaded_problems.at(0).A, problem.A);
+  EXPECT_EQ(loaded_problems.at(0).q, problem.q);
+  EXPECT_EQ(loaded_problems.at(0).l, problem.l);
+  EXPECT_EQ(loaded_problems.at(0).u, problem.u);
+  EXPECT_EQ(loaded_problems.at(1).P, other_problem.P);
+  EXPECT_EQ(loaded_problems.at(1).A.rows(), 0);
+  EXPECT_EQ(loaded_problems.at(1).q, other_problem.q);
+
+  EXPECT_THROW(qp::loadQPProblems(file_path), std::runtime_error);
+}
+
+TEST(TestQPProblem, ConstraintViolation)
+{
+  qp::QPProblem problem;
+  problem.P = (Eigen::MatrixXd(2, 2) << 4, 1, 1, 2).finished();
+  problem.A = (Eigen::MatrixXd(2, 2) << 1, 1, 1, 0).finished();
+  problem.q = {1.0, 1.0};
+  problem.l = {1.0, 0.0};
+  problem.u = {1.0, 0.7};
+
+  EXPECT_DOUBLE_EQ(qp::calcConstraintViolation(problem, {0.3, 0.7}), 0.0);
+  EXPECT_DOUBLE_EQ(qp::calcConstraintViolation(problem, {0.9, 0.7}), 0.6);
+  EXPECT_DOUBLE_EQ(qp::calcConstraintViolation(problem, {0.0, 0.5}), 0.5);
+  EXPECT_EQ(
+    qp::calcConstraintViolation(problem, {0.0}), std::numeric_limits<double>::infinity());
+}
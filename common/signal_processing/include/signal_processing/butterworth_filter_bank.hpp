@@ -0,0 +1,84 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SIGNAL_PROCESSING__BUTTERWORTH_FILTER_BANK_HPP_
+#define SIGNAL_PROCESSING__BUTTERWORTH_FILTER_BANK_HPP_
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @brief Coefficients of a second-order section, normalized with a0 = 1.
+ * The first-order section of an odd order filter has b2 = a2 = 0.
+ */
+struct sSecondOrderSection
+{
+  double b0{1.};
+  double b1{};
+  double b2{};
+  double a1{};
+  double a2{};
+};
+
+/**
+ * @brief Computes the second-order sections of a digital Butterworth low-pass filter with the
+ * bilinear transformation. Their product equals the transfer function which ButterworthFilter
+ * computes with use_sampling_frequency = true.
+ * @param N [in] order of the filter.
+ * @param fc [in] cut-off frequency in Hz.
+ * @param fs [in] sampling frequency in Hz.
+ * */
+std::vector<sSecondOrderSection> computeButterworthSections(
+  int const & N, double const & fc, double const & fs);
+
+/**
+ * @class Butterworth low-pass filter bank
+ * @brief filtering the values of multiple channels with the same Butterworth low-pass filter
+ * @details The filter is applied as a cascade of second-order sections, which is numerically
+ * stable even for a high order. The states are stored per section as arrays over the channels so
+ * that a sample of all the channels is filtered by loops over contiguous arrays.
+ */
+class ButterworthFilterBank
+{
+public:
+  /**
+   * @param N [in] order of the filter.
+   * @param fc [in] cut-off frequency in Hz.
+   * @param fs [in] sampling frequency in Hz.
+   * @param channel_num [in] number of the channels.
+   * */
+  ButterworthFilterBank(int const & N, double const & fc, double const & fs, size_t channel_num);
+
+  // The next filter() starts from the steady state of its input.
+  void reset();
+  // Sets the steady state of the input x, whose size is the number of the channels.
+  void reset(std::vector<double> const & x);
+
+  // Filters a sample of all the channels in place. The size of u is the number of the channels.
+  void filter(std::vector<double> & u);
+
+  [[nodiscard]] size_t getChannelNum() const;
+  [[nodiscard]] std::vector<sSecondOrderSection> const & getSections() const;
+
+private:
+  std::vector<sSecondOrderSection> sections_;
+  size_t channel_num_;
+  bool is_initialized_{false};
+
+  // states of the transposed direct form II, channel_num_ elements per section
+  std::vector<double> z1_;
+  std::vector<double> z2_;
+};
+
+#endif  // SIGNAL_PROCESSING__BUTTERWORTH_FILTER_BANK_HPP_
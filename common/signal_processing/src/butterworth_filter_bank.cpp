@@ -0,0 +1,119 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "signal_processing/butterworth_filter_bank.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+std::vector<sSecondOrderSection> computeButterworthSections(
+  int const & N, double const & fc, double const & fs)
+{
+  if (N < 1) {
+    throw std::invalid_argument("The order of the filter must be positive.");
+  }
+  if (fc <= 0. || fc >= fs / 2) {
+    throw std::invalid_argument("Cut-off frequency fc must be in (0, fs/2).");
+  }
+
+  // pre-warped cut-off frequency of the bilinear transformation
+  const double K = std::tan(M_PI * fc / fs);
+  const double K2 = K * K;
+
+  std::vector<sSecondOrderSection> sections;
+  sections.reserve((N + 1) / 2);
+
+  // The odd order filter has a real pole at -1, which is a first-order section.
+  if (N % 2 == 1) {
+    const double norm = 1. / (1. + K);
+    sections.push_back({K * norm, K * norm, 0., (K - 1.) * norm, 0.});
+  }
+
+  // The complex conjugate poles of the analog prototype have the damping sin((2k - 1)pi / 2N).
+  for (int k = 1; k <= N / 2; ++k) {
+    const double damping = 2. * std::sin(M_PI * (2. * k - 1.) / (2. * N));
+    const double norm = 1. / (1. + damping * K + K2);
+    const double b0 = K2 * norm;
+    sections.push_back({b0, 2. * b0, b0, 2. * (K2 - 1.) * norm, (1. - damping * K + K2) * norm});
+  }
+
+  return sections;
+}
+
+ButterworthFilterBank::ButterworthFilterBank(
+  int const & N, double const & fc, double const & fs, size_t channel_num)
+: sections_(computeButterworthSections(N, fc, fs)),
+  channel_num_(channel_num),
+  z1_(sections_.size() * channel_num, 0.),
+  z2_(sections_.size() * channel_num, 0.)
+{
+}
+
+void ButterworthFilterBank::reset()
+{
+  is_initialized_ = false;
+}
+
+void ButterworthFilterBank::reset(std::vector<double> const & x)
+{
+  if (x.size() != channel_num_) {
+    throw std::invalid_argument("The size of the input must be the number of the channels.");
+  }
+
+  // Each section has the unity DC gain, so its input and output are x at the steady state.
+  for (size_t s = 0; s < sections_.size(); ++s) {
+    const auto & sec = sections_[s];
+    double * z1 = z1_.data() + s * channel_num_;
+    double * z2 = z2_.data() + s * channel_num_;
+    for (size_t c = 0; c < channel_num_; ++c) {
+      z1[c] = (1. - sec.b0) * x[c];
+      z2[c] = (sec.b2 - sec.a2) * x[c];
+    }
+  }
+  is_initialized_ = true;
+}
+
+void ButterworthFilterBank::filter(std::vector<double> & u)
+{
+  if (!is_initialized_) {
+    reset(u);
+  }
+  if (u.size() != channel_num_) {
+    throw std::invalid_argument("The size of the input must be the number of the channels.");
+  }
+
+  // The output of a section is the input of the next one, so u is overwritten section by section.
+  double * x = u.data();
+  for (size_t s = 0; s < sections_.size(); ++s) {
+    const auto & sec = sections_[s];
+    double * z1 = z1_.data() + s * channel_num_;
+    double * z2 = z2_.data() + s * channel_num_;
+    for (size_t c = 0; c < channel_num_; ++c) {
+      const double y = sec.b0 * x[c] + z1[c];
+      z1[c] = sec.b1 * x[c] - sec.a1 * y + z2[c];
+      z2[c] = sec.b2 * x[c] - sec.a2 * y;
+      x[c] = y;
+    }
+  }
+}
+
+size_t ButterworthFilterBank::getChannelNum() const
+{
+  return channel_num_;
+}
+
+std::vector<sSecondOrderSection> const & ButterworthFilterBank::getSections() const
+{
+  return sections_;
+}
@@ -0,0 +1,177 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "signal_processing/butterworth.hpp"
+#include "signal_processing/butterworth_filter_bank.hpp"
+
+#include <gtest/gtest.h>
+
+#include <vector>
+
+namespace
+{
+// Multiplies the polynomials of the sections to get the transfer function.
+void multiplySections(
+  const std::vector<sSecondOrderSection> & sections, std::vector<double> & An,
+  std::vector<double> & Bn)
+{
+  An = {1.};
+  Bn = {1.};
+  for (const auto & sec : sections) {
+    const std::vector<double> a{1., sec.a1, sec.a2};
+    const std::vector<double> b{sec.b0, sec.b1, sec.b2};
+    std::vector<double> next_An(An.size() + 2, 0.);
+    std::vector<double> next_Bn(Bn.size() + 2, 0.);
+    for (size_t i = 0; i < An.size(); ++i) {
+      for (size_t j = 0; j < 3; ++j) {
+        next_An[i + j] += An[i] * a[j];
+        next_Bn[i + j] += Bn[i] * b[j];
+      }
+    }
+    An = next_An;
+    Bn = next_Bn;
+  }
+}
+
+// Filters a sample with the difference equation of the transfer function.
+double filterDirectForm(
+  const std::vector<double> & An, const std::vector<double> & Bn, std::vector<double> & inputs,
+  std::vector<double> & outputs, const double u)
+{
+  inputs.insert(inputs.begin(), u);
+  double y = 0.;
+  for (size_t k = 0; k < Bn.size(); ++k) {
+    y += Bn[k] * inputs[k];
+  }
+  for (size_t k = 1; k < An.size(); ++k) {
+    y -= An[k] * outputs[k - 1];
+  }
+  inputs.pop_back();
+  outputs.insert(outputs.begin(), y);
+  outputs.pop_back();
+  return y;
+}
+}  // namespace
+
+TEST(butterworth_filter_bank, sectionsEqualTransferFunction)
+{
+  const double tol{1e-12};
+  const double cut_off_frq_hz{10.};
+  const double sampling_frq_hz{100.};
+
+  for (int order = 1; order <= 6; ++order) {
+    ButterworthFilter bf;
+    bf.setOrder(order);
+    bf.setCutOffFrequency(cut_off_frq_hz, sampling_frq_hz);
+    bf.computeContinuousTimeTF(true);
+    bf.computeDiscreteTimeTF(true);
+
+    std::vector<double> An;
+    std::vector<double> Bn;
+    multiplySections(computeButterworthSections(order, cut_off_frq_hz, sampling_frq_hz), An, Bn);
+
+    const auto & An_ground_truth = bf.getAn();
+    const auto & Bn_ground_truth = bf.getBn();
+    for (size_t k = 0; k < An_ground_truth.size(); ++k) {
+      EXPECT_NEAR(An[k], An_ground_truth[k], tol) << "order " << order << ", k " << k;
+      EXPECT_NEAR(Bn[k], Bn_ground_truth[k], tol) << "order " << order << ", k " << k;
+    }
+    // the padding of the first-order section
+    for (size_t k = An_ground_truth.size(); k < An.size(); ++k) {
+      EXPECT_NEAR(An[k], 0., tol);
+      EXPECT_NEAR(Bn[k], 0., tol);
+    }
+  }
+}
+
+TEST(butterworth_filter_bank, filter)
+{
+  const double tol{1e-9};
+  const int order{3};
+  const double cut_off_frq_hz{5.};
+  const double sampling_frq_hz{40.};
+
+  ButterworthFilter bf;
+  bf.setOrder(order);
+  bf.setCutOffFrequency(cut_off_frq_hz, sampling_frq_hz);
+  bf.computeContinuousTimeTF(true);
+  bf.computeDiscreteTimeTF(true);
+  const auto & An = bf.getAn();
+  const auto & Bn = bf.getBn();
+
+  // each channel is compared with the difference equation started from its first sample
+  const std::vector<double> initial_values{0., 1., -2.};
+  ButterworthFilterBank filter_bank(order, cut_off_frq_hz, sampling_frq_hz, 3);
+  EXPECT_EQ(filter_bank.getChannelNum(), 3u);
+  EXPECT_EQ(filter_bank.getSections().size(), 2u);
+
+  std::vector<std::vector<double>> inputs;
+  std::vector<std::vector<double>> outputs;
+  for (const double x : initial_values) {
+    inputs.emplace_back(order + 1, x);
+    outputs.emplace_back(order, x);
+  }
+
+  for (int i = 0; i < 50; ++i) {
+    std::vector<double> u(3);
+    for (size_t c = 0; c < u.size(); ++c) {
+      u[c] = i == 0 ? initial_values[c] : std::sin(0.3 * i + c) + static_cast<double>(c);
+    }
+    std::vector<double> y = u;
+    filter_bank.filter(y);
+    for (size_t c = 0; c < u.size(); ++c) {
+      EXPECT_NEAR(y[c], filterDirectForm(An, Bn, inputs[c], outputs[c], u[c]), tol);
+    }
+  }
+}
+
+TEST(butterworth_filter_bank, reset)
+{
+  const double tol{1e-12};
+  ButterworthFilterBank filter_bank(4, 2., 50., 2);
+
+  // the steady state is kept
+  filter_bank.reset({1.5, -3.});
+  for (int i = 0; i < 10; ++i) {
+    std::vector<double> u{1.5, -3.};
+    filter_bank.filter(u);
+    EXPECT_NEAR(u[0], 1.5, tol);
+    EXPECT_NEAR(u[1], -3., tol);
+  }
+
+  // the next input is the steady state after the reset without the value
+  filter_bank.reset();
+  std::vector<double> u{0.5, 2.};
+  filter_bank.filter(u);
+  EXPECT_NEAR(u[0], 0.5, tol);
+  EXPECT_NEAR(u[1], 2., tol);
+
+  // a step converges to the new value
+  for (int i = 0; i < 500; ++i) {
+    u = {1., 1.};
+    filter_bank.filter(u);
+  }
+  EXPECT_NEAR(u[0], 1., 1e-6);
+  EXPECT_NEAR(u[1], 1., 1e-6);
+}
+
+TEST(butterworth_filter_bank, invalidArgument)
+{
+  EXPECT_THROW(ButterworthFilterBank(0, 10., 100., 1), std::invalid_argument);
+  EXPECT_THROW(ButterworthFilterBank(2, 50., 100., 1), std::invalid_argument);
+
+  ButterworthFilterBank filter_bank(2, 10., 100., 2);
+  std::vector<double> u{1.};
+  EXPECT_THROW(filter_bank.filter(u), std::invalid_argument);
+}
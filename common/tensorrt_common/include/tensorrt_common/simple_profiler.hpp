@@ -17,6 +17,7 @@
 
 #include <NvInfer.h>
 
+#include <array>
 #include <iostream>
 #include <map>
 #include <string>
@@ -43,12 +44,18 @@ struct LayerInfo
 class SimpleProfiler : public nvinfer1::IProfiler
 {
 public:
+  // Latency histogram of a record, 4 bins per octave from 1 us up to about 68 s
+  static constexpr int NUM_HISTOGRAM_BINS = 64;
+  static constexpr float HISTOGRAM_MIN_TIME = 0.001F;  // [ms]
+
   struct Record
   {
     float time{0};
     int count{0};
     float min_time{-1.0};
+    float max_time{0};
     int index;
+    std::array<int, NUM_HISTOGRAM_BINS> histogram{};
   };
   SimpleProfiler(
     std::string name,
@@ -58,6 +65,27 @@ public:
 
   void setProfDict(nvinfer1::ILayer * layer) noexcept;
 
+  /**
+   * @brief Estimate a percentile of the times of a record from its histogram
+   * @param[in] record record of a layer or a stage
+   * @param[in] percentile percentile in [0, 100]
+   * @return upper bound of the histogram bin of the percentile [ms]
+   */
+  static float getPercentileTime(const Record & record, float percentile);
+
+  /**
+   * @brief Write one CSV line per record, in the order of the first report:
+   * profiler, index, name, count, total_ms, avg_ms, min_ms, p50_ms, p90_ms, p99_ms, max_ms
+   * @param[in] out stream to write to
+   * @param[in] with_header flag to write the column names first
+   */
+  void writeReport(std::ostream & out, bool with_header = true) const;
+
+  /**
+   * @brief Clear the records, e.g. after a warmup
+   */
+  void reset();
+
   friend std::ostream & operator<<(std::ostream & out, SimpleProfiler & value);
 
 private:
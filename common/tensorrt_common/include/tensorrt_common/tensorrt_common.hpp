@@ -62,6 +62,9 @@ struct BuildConfig
   // clip value for implicit quantization
   double clip_value;  // For implicit quantization
 
+  // directory of the content-addressed engine cache, the engine is cached next to the ONNX if empty
+  std::string engine_cache_dir;
+
   // Supported calibration type
   const std::array<std::string, 4> valid_calib_type = {"Entropy", "Legacy", "Percentile", "MinMax"};
 
@@ -71,20 +74,23 @@ struct BuildConfig
     quantize_first_layer(false),
     quantize_last_layer(false),
     profile_per_layer(false),
-    clip_value(0.0)
+    clip_value(0.0),
+    engine_cache_dir("")
   {
   }
 
   explicit BuildConfig(
     const std::string & calib_type_str, const int dla_core_id = -1,
     const bool quantize_first_layer = false, const bool quantize_last_layer = false,
-    const bool profile_per_layer = false, const double clip_value = 0.0)
+    const bool profile_per_layer = false, const double clip_value = 0.0,
+    const std::string & engine_cache_dir = "")
   : calib_type_str(calib_type_str),
     dla_core_id(dla_core_id),
     quantize_first_layer(quantize_first_layer),
     quantize_last_layer(quantize_last_layer),
     profile_per_layer(profile_per_layer),
-    clip_value(clip_value)
+    clip_value(clip_value),
+    engine_cache_dir(engine_cache_dir)
   {
     if (
       std::find(valid_calib_type.begin(), valid_calib_type.end(), calib_type_str) ==
@@ -180,9 +186,19 @@ public:
    */
   void setup();
 
+  /**
+   * @brief Path of the engine built from the ONNX model
+   * @details With BuildConfig::engine_cache_dir, the file name holds a hash of the ONNX content,
+   * the TensorRT version, the compute capability of the GPU and the build options, so that a stale
+   * engine is never loaded.
+   */
+  fs::path getCacheEnginePath() const;
+
   bool isInitialized();
 
   nvinfer1::Dims getBindingDimensions(const int32_t index) const;
+  bool bindingIsInput(const int32_t index) const;
+  nvinfer1::DataType getBindingDataType(const int32_t index) const;
   int32_t getNbBindings();
   bool setBindingDimensions(const int32_t index, const nvinfer1::Dims & dimensions) const;
   bool enqueueV2(void ** bindings, cudaStream_t stream, cudaEvent_t * input_consumed);
@@ -192,6 +208,25 @@ public:
    */
   void printProfiling(void);
 
+  /**
+   * @brief Record the time of a stage of the caller, e.g. preprocess or postprocess, with the
+   * host profiler. Nothing is recorded unless BuildConfig::profile_per_layer is set.
+   * @param[in] stage name of the stage
+   * @param[in] ms time of the stage [ms]
+   */
+  void reportStageTime(const char * stage, float ms);
+
+  /**
+   * @brief Write the latency histograms of the stages and layers as CSV
+   * @see SimpleProfiler::writeReport
+   */
+  void writeProfilingReport(std::ostream & out) const;
+
+  /**
+   * @brief Clear the stage and layer records
+   */
+  void resetProfiling();
+
 #if (NV_TENSORRT_MAJOR * 1000) + (NV_TENSORRT_MINOR * 100) + NV_TENSOR_PATCH >= 8200
   /**
    * @brief get per-layer information for trt-engine-profiler
@@ -222,6 +257,13 @@ private:
   std::unique_ptr<const BuildConfig> build_config_;
 };
 
+/**
+ * @brief Run TrtCommon::setup() of all the given instances at the same time, one thread each
+ * @details Loading the engines of a launch in parallel hides most of the deserialization time of
+ * the slowest one. Each instance owns its runtime and logger, so that their setups are independent.
+ */
+void setup_in_parallel(const std::vector<TrtCommon *> & trt_commons);
+
 }  // namespace tensorrt_common
 
 #endif  // TENSORRT_COMMON__TENSORRT_COMMON_HPP_
@@ -14,6 +14,8 @@
 
 #include <tensorrt_common/simple_profiler.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <iomanip>
 
 namespace tensorrt_common
@@ -32,23 +34,89 @@ SimpleProfiler::SimpleProfiler(std::string name, const std::vector<SimpleProfile
       } else {
         it->second.time += rec.second.time;
         it->second.count += rec.second.count;
+        it->second.max_time = std::max(it->second.max_time, rec.second.max_time);
+        for (int bin = 0; bin < NUM_HISTOGRAM_BINS; ++bin) {
+          it->second.histogram[bin] += rec.second.histogram[bin];
+        }
         total_time += rec.second.time;
       }
     }
   }
 }
 
+namespace
+{
+int histogramBin(const float ms)
+{
+  if (!(ms > SimpleProfiler::HISTOGRAM_MIN_TIME)) {
+    return 0;
+  }
+  const int bin =
+    static_cast<int>(std::ceil(4.0F * std::log2(ms / SimpleProfiler::HISTOGRAM_MIN_TIME)));
+  return std::min(bin, SimpleProfiler::NUM_HISTOGRAM_BINS - 1);
+}
+
+float histogramBinUpperBound(const int bin)
+{
+  return SimpleProfiler::HISTOGRAM_MIN_TIME * std::exp2(bin / 4.0F);
+}
+}  // namespace
+
 void SimpleProfiler::reportLayerTime(const char * layerName, float ms) noexcept
 {
-  m_profile[layerName].count++;
-  m_profile[layerName].time += ms;
-  if (m_profile[layerName].min_time == -1.0) {
-    m_profile[layerName].min_time = ms;
-    m_profile[layerName].index = m_index;
+  auto & record = m_profile[layerName];
+  record.count++;
+  record.time += ms;
+  record.max_time = std::max(record.max_time, ms);
+  record.histogram[histogramBin(ms)]++;
+  if (record.min_time == -1.0) {
+    record.min_time = ms;
+    record.index = m_index;
     m_index++;
-  } else if (m_profile[layerName].min_time > ms) {
-    m_profile[layerName].min_time = ms;
+  } else if (record.min_time > ms) {
+    record.min_time = ms;
+  }
+}
+
+float SimpleProfiler::getPercentileTime(const Record & record, const float percentile)
+{
+  if (record.count == 0) {
+    return 0.0F;
   }
+  const float rank = std::clamp(percentile, 0.0F, 100.0F) / 100.0F * record.count;
+  int num_below = 0;
+  for (int bin = 0; bin < NUM_HISTOGRAM_BINS; ++bin) {
+    num_below += record.histogram[bin];
+    if (num_below >= rank && num_below > 0) {
+      // The bounds of the bins are coarse, the extreme times are known exactly
+      return std::clamp(histogramBinUpperBound(bin), record.min_time, record.max_time);
+    }
+  }
+  return record.max_time;
+}
+
+void SimpleProfiler::writeReport(std::ostream & out, const bool with_header) const
+{
+  if (with_header) {
+    out << "profiler,index,name,count,total_ms,avg_ms,min_ms,p50_ms,p90_ms,p99_ms,max_ms"
+        << std::endl;
+  }
+  std::vector<std::pair<std::string, Record>> records(m_profile.begin(), m_profile.end());
+  std::sort(records.begin(), records.end(), [](const auto & a, const auto & b) {
+    return a.second.index < b.second.index;
+  });
+  for (const auto & [name, record] : records) {
+    out << m_name << "," << record.index << "," << name << "," << record.count << ","
+        << record.time << "," << record.time / std::max(record.count, 1) << "," << record.min_time
+        << "," << getPercentileTime(record, 50.0F) << "," << getPercentileTime(record, 90.0F)
+        << "," << getPercentileTime(record, 99.0F) << "," << record.max_time << std::endl;
+  }
+}
+
+void SimpleProfiler::reset()
+{
+  m_profile.clear();
+  m_index = 0;
 }
 
 void SimpleProfiler::setProfDict(nvinfer1::ILayer * layer) noexcept
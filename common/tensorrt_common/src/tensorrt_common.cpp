@@ -15,14 +15,21 @@
 #include <tensorrt_common/tensorrt_common.hpp>
 
 #include <NvInferPlugin.h>
+#include <cuda_runtime_api.h>
 #include <dlfcn.h>
+#include <unistd.h>
 
+#include <cstdint>
+#include <cstdio>
 #include <fstream>
 #include <functional>
+#include <future>
+#include <iomanip>
 #include <iostream>
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace
 {
@@ -31,6 +38,50 @@ bool contain(const std::string & s, const T & v)
 {
   return s.find(v) != std::string::npos;
 }
+
+// 64-bit FNV-1a, enough to tell apart the engines of a cache directory
+class Fnv1aHash
+{
+public:
+  void update(const void * data, const std::size_t size)
+  {
+    const auto * bytes = static_cast<const std::uint8_t *>(data);
+    for (std::size_t i = 0; i < size; ++i) {
+      hash_ = (hash_ ^ bytes[i]) * 0x100000001b3ULL;
+    }
+  }
+
+  void update(const std::string & s) { update(s.data(), s.size() + 1); }
+
+  template <class T>
+  void update(const T & value)
+  {
+    update(&value, sizeof(value));
+  }
+
+  bool updateFile(const std::string & file_path)
+  {
+    std::ifstream file(file_path, std::ios::binary);
+    if (!file.is_open()) {
+      return false;
+    }
+    std::vector<char> chunk(1 << 20);
+    while (file.read(chunk.data(), chunk.size()) || file.gcount() > 0) {
+      update(chunk.data(), static_cast<std::size_t>(file.gcount()));
+    }
+    return true;
+  }
+
+  std::string hex() const
+  {
+    std::stringstream ss;
+    ss << std::hex << std::setw(16) << std::setfill('0') << hash_;
+    return ss.str();
+  }
+
+private:
+  std::uint64_t hash_{0xcbf29ce484222325ULL};
+};
 }  // anonymous namespace
 
 namespace tensorrt_common
@@ -142,49 +193,23 @@ void TrtCommon::setup()
     std::cout << "Load ... " << model_file_path_ << std::endl;
     loadEngine(model_file_path_);
   } else if (model_file_path_.extension() == ".onnx") {
-    fs::path cache_engine_path{model_file_path_};
-    std::string ext;
-    std::string calib_name = "";
-    if (precision_ == "int8") {
-      if (build_config_->calib_type_str == "Entropy") {
-        calib_name = "EntropyV2-";
-      } else if (
-        build_config_->calib_type_str == "Legacy" ||
-        build_config_->calib_type_str == "Percentile") {
-        calib_name = "Legacy-";
-      } else {
-        calib_name = "MinMax-";
-      }
-    }
-    if (build_config_->dla_core_id != -1) {
-      ext = "DLA" + std::to_string(build_config_->dla_core_id) + "-" + calib_name + precision_;
-      if (build_config_->quantize_first_layer) {
-        ext += "-firstFP16";
-      }
-      if (build_config_->quantize_last_layer) {
-        ext += "-lastFP16";
-      }
-      ext += "-batch" + std::to_string(batch_config_[0]) + ".engine";
-    } else {
-      ext = calib_name + precision_;
-      if (build_config_->quantize_first_layer) {
-        ext += "-firstFP16";
-      }
-      if (build_config_->quantize_last_layer) {
-        ext += "-lastFP16";
-      }
-      ext += "-batch" + std::to_string(batch_config_[0]) + ".engine";
-    }
-    cache_engine_path.replace_extension(ext);
+    const fs::path cache_engine_path = getCacheEnginePath();
+    const bool is_cached = fs::exists(cache_engine_path);
 
     // Output Network Information
-    printNetworkInfo(model_file_path_);
+    // The ONNX is parsed again only for the layer names of the profiler when the engine is cached
+    if (!is_cached || build_config_->profile_per_layer) {
+      printNetworkInfo(model_file_path_);
+    }
 
-    if (fs::exists(cache_engine_path)) {
+    if (is_cached) {
       std::cout << "Loading... " << cache_engine_path << std::endl;
       loadEngine(cache_engine_path);
     } else {
       std::cout << "Building... " << cache_engine_path << std::endl;
+      if (!build_config_->engine_cache_dir.empty()) {
+        fs::create_directories(build_config_->engine_cache_dir);
+      }
       logger_.log(nvinfer1::ILogger::Severity::kINFO, "Start build engine");
       buildEngineFromOnnx(model_file_path_, cache_engine_path);
       logger_.log(nvinfer1::ILogger::Severity::kINFO, "End build engine");
@@ -195,6 +220,12 @@ void TrtCommon::setup()
     return;
   }
 
+  if (!engine_) {
+    logger_.log(nvinfer1::ILogger::Severity::kERROR, "Fail to load engine");
+    is_initialized_ = false;
+    return;
+  }
+
   context_ = TrtUniquePtr<nvinfer1::IExecutionContext>(engine_->createExecutionContext());
   if (!context_) {
     logger_.log(nvinfer1::ILogger::Severity::kERROR, "Fail to create context");
@@ -219,15 +250,90 @@ void TrtCommon::setup()
   is_initialized_ = true;
 }
 
+fs::path TrtCommon::getCacheEnginePath() const
+{
+  if (!build_config_->engine_cache_dir.empty()) {
+    Fnv1aHash hash;
+    hash.updateFile(model_file_path_.string());
+    hash.update(getInferLibVersion());
+    int device = 0;
+    cudaDeviceProp prop{};
+    if (
+      cudaGetDevice(&device) == cudaSuccess &&
+      cudaGetDeviceProperties(&prop, device) == cudaSuccess) {
+      hash.update(prop.major);
+      hash.update(prop.minor);
+    }
+    hash.update(precision_);
+    hash.update(build_config_->calib_type_str);
+    hash.update(build_config_->dla_core_id);
+    hash.update(build_config_->quantize_first_layer);
+    hash.update(build_config_->quantize_last_layer);
+    hash.update(build_config_->clip_value);
+    hash.update(batch_config_);
+    hash.update(max_workspace_size_);
+    return fs::path(build_config_->engine_cache_dir) /
+           (model_file_path_.stem().string() + "-" + hash.hex() + ".engine");
+  }
+
+  fs::path cache_engine_path{model_file_path_};
+  std::string ext;
+  std::string calib_name = "";
+  if (precision_ == "int8") {
+    if (build_config_->calib_type_str == "Entropy") {
+      calib_name = "EntropyV2-";
+    } else if (
+      build_config_->calib_type_str == "Legacy" ||
+      build_config_->calib_type_str == "Percentile") {
+      calib_name = "Legacy-";
+    } else {
+      calib_name = "MinMax-";
+    }
+  }
+  // an engine with a dynamic batch is distinguished by its max batch size
+  std::string batch_suffix = std::to_string(batch_config_[0]);
+  if (batch_config_[2] != batch_config_[0]) {
+    batch_suffix += "-" + std::to_string(batch_config_[2]);
+  }
+  if (build_config_->dla_core_id != -1) {
+    ext = "DLA" + std::to_string(build_config_->dla_core_id) + "-" + calib_name + precision_;
+    if (build_config_->quantize_first_layer) {
+      ext += "-firstFP16";
+    }
+    if (build_config_->quantize_last_layer) {
+      ext += "-lastFP16";
+    }
+    ext += "-batch" + batch_suffix + ".engine";
+  } else {
+    ext = calib_name + precision_;
+    if (build_config_->quantize_first_layer) {
+      ext += "-firstFP16";
+    }
+    if (build_config_->quantize_last_layer) {
+      ext += "-lastFP16";
+    }
+    ext += "-batch" + batch_suffix + ".engine";
+  }
+  cache_engine_path.replace_extension(ext);
+
+  return cache_engine_path;
+}
+
 bool TrtCommon::loadEngine(const std::string & engine_file_path)
 {
-  std::ifstream engine_file(engine_file_path);
-  std::stringstream engine_buffer;
-  engine_buffer << engine_file.rdbuf();
-  std::string engine_str = engine_buffer.str();
-  engine_ = TrtUniquePtr<nvinfer1::ICudaEngine>(runtime_->deserializeCudaEngine(
-    reinterpret_cast<const void *>(engine_str.data()), engine_str.size()));
-  return true;
+  // Read the file straight into the buffer handed to the runtime, without a copy through a stream
+  std::ifstream engine_file(engine_file_path, std::ios::binary | std::ios::ate);
+  if (!engine_file.is_open()) {
+    return false;
+  }
+  std::vector<char> engine_data(static_cast<std::size_t>(engine_file.tellg()));
+  engine_file.seekg(0);
+  if (!engine_file.read(engine_data.data(), engine_data.size())) {
+    return false;
+  }
+  engine_ = TrtUniquePtr<nvinfer1::ICudaEngine>(
+    runtime_->deserializeCudaEngine(engine_data.data(), engine_data.size()));
+  return engine_ != nullptr;
 }
 
 void TrtCommon::printNetworkInfo(const std::string & onnx_file_path)
@@ -458,7 +564,8 @@ bool TrtCommon::buildEngineFromOnnx(
     // Attention : below API is deprecated in TRT8.4
     builder->setMaxBatchSize(batch_config_.at(2));
   } else {
-    if (build_config_->profile_per_layer) {
+    // a dynamic batch needs the profile to be built
+    if (build_config_->profile_per_layer || input_batch == -1) {
       auto profile = builder->createOptimizationProfile();
       profile->setDimensions(
         network->getInput(0)->getName(), nvinfer1::OptProfileSelector::kMIN,
@@ -510,11 +617,15 @@ bool TrtCommon::buildEngineFromOnnx(
   }
 
   // save engine
+  // The engine is written to a temporary file first and renamed, so that another process never
+  // loads a partially written engine from the cache
 #if TENSORRT_VERSION_MAJOR < 8
   auto data = TrtUniquePtr<nvinfer1::IHostMemory>(engine_->serialize());
 #endif
+  const std::string tmp_engine_file_path =
+    output_engine_file_path + ".tmp" + std::to_string(getpid());
   std::ofstream file;
-  file.open(output_engine_file_path, std::ios::binary | std::ios::out);
+  file.open(tmp_engine_file_path, std::ios::binary | std::ios::out);
   if (!file.is_open()) {
     return false;
   }
@@ -525,6 +636,10 @@ bool TrtCommon::buildEngineFromOnnx(
 #endif
 
   file.close();
+  if (!file || std::rename(tmp_engine_file_path.c_str(), output_engine_file_path.c_str()) != 0) {
+    std::remove(tmp_engine_file_path.c_str());
+    return false;
+  }
 
   return true;
 }
@@ -552,6 +667,16 @@ nvinfer1::Dims TrtCommon::getBindingDimensions(const int32_t index) const
 #endif
 }
 
+bool TrtCommon::bindingIsInput(const int32_t index) const
+{
+  return engine_->bindingIsInput(index);
+}
+
+nvinfer1::DataType TrtCommon::getBindingDataType(const int32_t index) const
+{
+  return engine_->getBindingDataType(index);
+}
+
 int32_t TrtCommon::getNbBindings()
 {
   return engine_->getNbBindings();
@@ -586,6 +711,25 @@ void TrtCommon::printProfiling()
   std::cout << model_profiler_;
 }
 
+void TrtCommon::reportStageTime(const char * stage, const float ms)
+{
+  if (build_config_->profile_per_layer) {
+    host_profiler_.reportLayerTime(stage, ms);
+  }
+}
+
+void TrtCommon::writeProfilingReport(std::ostream & out) const
+{
+  host_profiler_.writeReport(out);
+  model_profiler_.writeReport(out, false);
+}
+
+void TrtCommon::resetProfiling()
+{
+  host_profiler_.reset();
+  model_profiler_.reset();
+}
+
 #if (NV_TENSORRT_MAJOR * 1000) + (NV_TENSORRT_MINOR * 100) + NV_TENSOR_PATCH >= 8200
 std::string TrtCommon::getLayerInformation(nvinfer1::LayerInformationFormat format)
 {
@@ -599,4 +743,16 @@ std::string TrtCommon::getLayerInformation(nvinfer1::LayerInformationFormat form
 }
 #endif
 
+void setup_in_parallel(const std::vector<TrtCommon *> & trt_commons)
+{
+  std::vector<std::future<void>> setups;
+  setups.reserve(trt_commons.size());
+  for (auto * trt_common : trt_commons) {
+    setups.push_back(std::async(std::launch::async, [trt_common]() { trt_common->setup(); }));
+  }
+  for (auto & setup : setups) {
+    setup.get();
+  }
+}
+
 }  // namespace tensorrt_common
@@ -0,0 +1,266 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Replays inputs through a TensorRT engine at a fixed rate, and writes the latency histograms of
+// the stages (h2d, execute, d2h, latency) and of the layers as CSV, see
+// SimpleProfiler::writeReport.
+// The precision and the DLA core are options, so that the placements of a model can be compared
+// on the target.
+//
+// Usage: trt_bench <model.onnx|model.engine> [--precision fp32|fp16|int8] [--dla <core id>]
+//          [--batch <size>] [--rate <hz, 0 runs back to back>] [--iterations <n>] [--warmup <n>]
+//          [--input <raw file>]... [--report <csv file>]
+// An --input file per input binding holds raw tensors, one or more frames of the binding size,
+// which are replayed in a loop. The inputs without a file are filled with random values.
+
+#include <tensorrt_common/tensorrt_common.hpp>
+
+#include <cuda_runtime_api.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <memory>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+struct Options
+{
+  std::string model_path;
+  std::string precision{"fp16"};
+  int dla_core_id{-1};
+  int batch_size{1};
+  double rate{10.0};
+  int iterations{100};
+  int warmup{10};
+  std::vector<std::string> input_paths;
+  std::string report_path;
+};
+
+bool parseOptions(int argc, char ** argv, Options & options)
+{
+  if (argc < 2) {
+    return false;
+  }
+  options.model_path = argv[1];
+  for (int i = 2; i < argc; ++i) {
+    const std::string arg = argv[i];
+    if (i + 1 >= argc) {
+      return false;
+    }
+    const std::string value = argv[++i];
+    if (arg == "--precision") {
+      options.precision = value;
+    } else if (arg == "--dla") {
+      options.dla_core_id = std::stoi(value);
+    } else if (arg == "--batch") {
+      options.batch_size = std::max(1, std::stoi(value));
+    } else if (arg == "--rate") {
+      options.rate = std::stod(value);
+    } else if (arg == "--iterations") {
+      options.iterations = std::max(1, std::stoi(value));
+    } else if (arg == "--warmup") {
+      options.warmup = std::max(0, std::stoi(value));
+    } else if (arg == "--input") {
+      options.input_paths.push_back(value);
+    } else if (arg == "--report") {
+      options.report_path = value;
+    } else {
+      return false;
+    }
+  }
+  return true;
+}
+
+std::size_t elementSize(const nvinfer1::DataType type)
+{
+  switch (type) {
+    case nvinfer1::DataType::kFLOAT:
+    case nvinfer1::DataType::kINT32:
+      return 4;
+    case nvinfer1::DataType::kHALF:
+      return 2;
+    default:
+      return 1;
+  }
+}
+
+struct CudaDeleter
+{
+  void operator()(void * p) const { cudaFree(p); }
+};
+
+struct Binding
+{
+  bool is_input;
+  std::size_t size;  // [bytes]
+  std::unique_ptr<void, CudaDeleter> data_d;
+  std::vector<char> frames_h;  // the replayed input frames, or the output
+};
+
+float elapsedMs(
+  const std::chrono::steady_clock::time_point & start,
+  const std::chrono::steady_clock::time_point & end)
+{
+  return std::chrono::duration<float, std::milli>(end - start).count();
+}
+}  // namespace
+
+int main(int argc, char ** argv)
+{
+  Options options;
+  if (!parseOptions(argc, argv, options)) {
+    std::cerr << "Usage: trt_bench <model.onnx|model.engine> [--precision fp32|fp16|int8] "
+                 "[--dla <core id>] [--batch <size>] [--rate <hz>] [--iterations <n>] "
+                 "[--warmup <n>] [--input <raw file>]... [--report <csv file>]"
+              << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // profile_per_layer enables the per-layer profiler and the stage records
+  const tensorrt_common::BuildConfig build_config(
+    "MinMax", options.dla_core_id, false, false, true);
+  const tensorrt_common::BatchConfig batch_config{
+    options.batch_size, options.batch_size, options.batch_size};
+  tensorrt_common::TrtCommon trt_common(
+    options.model_path, options.precision, nullptr, batch_config, (1ULL << 30), build_config);
+  trt_common.setup();
+  if (!trt_common.isInitialized()) {
+    std::cerr << "Failed to set up " << options.model_path << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::mt19937 engine(0);
+  std::uniform_int_distribution<int> random_byte(0, 255);
+  std::vector<Binding> bindings(trt_common.getNbBindings());
+  std::size_t num_inputs = 0;
+  for (int32_t i = 0; i < trt_common.getNbBindings(); ++i) {
+    auto & binding = bindings[i];
+    binding.is_input = trt_common.bindingIsInput(i);
+    if (binding.is_input) {
+      auto dims = trt_common.getBindingDimensions(i);
+      if (dims.nbDims > 0 && dims.d[0] == -1) {
+        dims.d[0] = options.batch_size;
+        trt_common.setBindingDimensions(i, dims);
+      }
+    }
+  }
+  for (int32_t i = 0; i < trt_common.getNbBindings(); ++i) {
+    auto & binding = bindings[i];
+    const auto dims = trt_common.getBindingDimensions(i);
+    std::size_t volume = 1;
+    for (int32_t d = 0; d < dims.nbDims; ++d) {
+      volume *= static_cast<std::size_t>(std::max(dims.d[d], 1));
+    }
+    binding.size = volume * elementSize(trt_common.getBindingDataType(i));
+    void * data_d = nullptr;
+    if (cudaMalloc(&data_d, binding.size) != cudaSuccess) {
+      std::cerr << "Failed to allocate binding " << i << std::endl;
+      return EXIT_FAILURE;
+    }
+    binding.data_d.reset(data_d);
+
+    if (!binding.is_input) {
+      binding.frames_h.resize(binding.size);
+    } else if (num_inputs < options.input_paths.size()) {
+      std::ifstream file(options.input_paths[num_inputs++], std::ios::binary);
+      binding.frames_h.assign(std::istreambuf_iterator<char>(file), {});
+      if (binding.frames_h.size() < binding.size || binding.frames_h.size() % binding.size != 0) {
+        std::cerr << "The size of " << options.input_paths[num_inputs - 1]
+                  << " is not a multiple of the input binding " << i << " size " << binding.size
+                  << std::endl;
+        return EXIT_FAILURE;
+      }
+    } else {
+      binding.frames_h.resize(binding.size);
+      std::generate(binding.frames_h.begin(), binding.frames_h.end(), [&]() {
+        return static_cast<char>(random_byte(engine));
+      });
+    }
+  }
+
+  std::vector<void *> buffers;
+  for (const auto & binding : bindings) {
+    buffers.push_back(binding.data_d.get());
+  }
+  cudaStream_t stream;
+  cudaStreamCreate(&stream);
+
+  using Clock = std::chrono::steady_clock;
+  const auto period = std::chrono::duration_cast<Clock::duration>(
+    std::chrono::duration<double>(options.rate > 0.0 ? 1.0 / options.rate : 0.0));
+  int num_deadline_misses = 0;
+  const int num_runs = options.warmup + options.iterations;
+  auto next_start = Clock::now();
+  for (int run = 0; run < num_runs; ++run) {
+    if (run == options.warmup) {
+      trt_common.resetProfiling();
+      num_deadline_misses = 0;
+    }
+    std::this_thread::sleep_until(next_start);
+
+    const auto start = Clock::now();
+    for (const auto & binding : bindings) {
+      if (binding.is_input) {
+        const std::size_t num_frames = binding.frames_h.size() / binding.size;
+        const char * frame = binding.frames_h.data() + (run % num_frames) * binding.size;
+        cudaMemcpyAsync(binding.data_d.get(), frame, binding.size, cudaMemcpyHostToDevice, stream);
+      }
+    }
+    cudaStreamSynchronize(stream);
+    const auto h2d_end = Clock::now();
+    trt_common.enqueueV2(buffers.data(), stream, nullptr);
+    cudaStreamSynchronize(stream);
+    const auto execute_end = Clock::now();
+    for (auto & binding : bindings) {
+      if (!binding.is_input) {
+        cudaMemcpyAsync(
+          binding.frames_h.data(), binding.data_d.get(), binding.size, cudaMemcpyDeviceToHost,
+          stream);
+      }
+    }
+    cudaStreamSynchronize(stream);
+    const auto end = Clock::now();
+
+    trt_common.reportStageTime("h2d", elapsedMs(start, h2d_end));
+    trt_common.reportStageTime("execute", elapsedMs(h2d_end, execute_end));
+    trt_common.reportStageTime("d2h", elapsedMs(execute_end, end));
+    trt_common.reportStageTime("latency", elapsedMs(start, end));
+
+    // A late run does not shift the schedule, as a sensor does not wait for the detector
+    next_start += period;
+    if (period.count() > 0 && end > next_start) {
+      ++num_deadline_misses;
+    }
+  }
+  cudaStreamDestroy(stream);
+
+  if (options.report_path.empty()) {
+    trt_common.writeProfilingReport(std::cout);
+  } else {
+    std::ofstream report(options.report_path);
+    trt_common.writeProfilingReport(report);
+  }
+  std::cerr << num_deadline_misses << " of " << options.iterations << " runs missed the period"
+            << std::endl;
+  return EXIT_SUCCESS;
+}
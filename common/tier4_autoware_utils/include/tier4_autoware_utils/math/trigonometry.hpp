@@ -15,6 +15,8 @@
 #ifndef TIER4_AUTOWARE_UTILS__MATH__TRIGONOMETRY_HPP_
 #define TIER4_AUTOWARE_UTILS__MATH__TRIGONOMETRY_HPP_
 
+#include <cstddef>
+
 namespace tier4_autoware_utils
 {
 
@@ -22,6 +24,30 @@ float sin(float radian);
 
 float cos(float radian);
 
+/**
+ * @brief calculate sin and cos of the angles in an array
+ * @details The values are approximated by polynomials instead of the table lookup, so that the loop
+ * over the array has no branch nor gather and is vectorized by the compiler. The absolute error is
+ * below 1e-6 for |radian| <= 1e4, which is larger for larger angles due to the float precision.
+ * @param [in] radians angles [rad]
+ * @param [out] sin_values sin of the angles, which can be the same array as radians
+ * @param [out] cos_values cos of the angles, which can be the same array as radians
+ * @param [in] size number of the angles
+ */
+void sin_cos(const float * radians, float * sin_values, float * cos_values, const size_t size);
+
+/**
+ * @brief calculate atan2 of the values in arrays
+ * @details The values are approximated by a polynomial, so that the loop over the arrays has no
+ * branch and is vectorized by the compiler. The absolute error is below 1e-6 [rad]. The results
+ * for zeros follow std::atan2, and the results for infinities and NaN are not defined.
+ * @param [in] y y coordinates
+ * @param [in] x x coordinates
+ * @param [out] radians atan2 of the values [rad], which can be the same array as y or x
+ * @param [in] size number of the values
+ */
+void atan2(const float * y, const float * x, float * radians, const size_t size);
+
 }  // namespace tier4_autoware_utils
 
 #endif  // TIER4_AUTOWARE_UTILS__MATH__TRIGONOMETRY_HPP_
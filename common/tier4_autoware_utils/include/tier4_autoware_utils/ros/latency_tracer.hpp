@@ -0,0 +1,138 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TIER4_AUTOWARE_UTILS__ROS__LATENCY_TRACER_HPP_
+#define TIER4_AUTOWARE_UTILS__ROS__LATENCY_TRACER_HPP_
+
+#include <rclcpp/time.hpp>
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace tier4_autoware_utils
+{
+/**
+ * @brief trace of the latency of the messages processed by a node.
+ * A message is identified by its origin stamp, i.e. the header stamp which is kept through the
+ * pipeline, so that the latency of each hop is split into the time since the origin stamp until
+ * the node starts processing the message, and the processing time of the node.
+ * The last records are kept in a ring buffer allocated at construction.
+ */
+class LatencyTracer
+{
+public:
+  struct Record
+  {
+    rclcpp::Time origin_stamp;
+    rclcpp::Time start_time;
+    rclcpp::Time end_time;
+
+    double getWaitingTimeMs() const { return (start_time - origin_stamp).seconds() * 1e3; }
+    double getProcessingTimeMs() const { return (end_time - start_time).seconds() * 1e3; }
+    double getLatencyMs() const { return (end_time - origin_stamp).seconds() * 1e3; }
+  };
+
+  explicit LatencyTracer(const size_t capacity = 100) : records_(std::max<size_t>(capacity, 1)) {}
+
+  /**
+   * @brief start the trace of a message when the node starts processing it
+   * @param origin_stamp stamp of the message, e.g. its header stamp
+   * @param now current time of the same clock as the origin stamp
+   */
+  void start(const rclcpp::Time & origin_stamp, const rclcpp::Time & now)
+  {
+    current_record_.origin_stamp = origin_stamp;
+    current_record_.start_time = now;
+    is_started_ = true;
+  }
+
+  /**
+   * @brief stop the trace of the message started last when its result is published, and store it
+   * @return false if no trace is started
+   */
+  bool stop(const rclcpp::Time & now)
+  {
+    if (!is_started_) {
+      return false;
+    }
+    current_record_.end_time = now;
+    records_.at(next_idx_) = current_record_;
+    next_idx_ = (next_idx_ + 1) % records_.size();
+    size_ = std::min(size_ + 1, records_.size());
+    is_started_ = false;
+    return true;
+  }
+
+  size_t size() const { return size_; }
+  bool empty() const { return size_ == 0; }
+
+  /**
+   * @brief get the stored records
+   * @return records from the oldest to the latest
+   */
+  std::vector<Record> getRecords() const
+  {
+    std::vector<Record> records;
+    records.reserve(size_);
+    const size_t begin_idx = (next_idx_ + records_.size() - size_) % records_.size();
+    for (size_t i = 0; i < size_; ++i) {
+      records.push_back(records_.at((begin_idx + i) % records_.size()));
+    }
+    return records;
+  }
+
+  /**
+   * @brief get the latest and the maximum times of the stored records, e.g. to be published with
+   * ProcessingTimePublisher
+   */
+  std::map<std::string, double> getSummary() const
+  {
+    std::map<std::string, double> summary;
+    if (empty()) {
+      return summary;
+    }
+
+    const auto & latest_record = records_.at((next_idx_ + records_.size() - 1) % records_.size());
+    summary["waiting_time_ms"] = latest_record.getWaitingTimeMs();
+    summary["processing_time_ms"] = latest_record.getProcessingTimeMs();
+    summary["latency_ms"] = latest_record.getLatencyMs();
+
+    double max_waiting_time_ms = latest_record.getWaitingTimeMs();
+    double max_processing_time_ms = latest_record.getProcessingTimeMs();
+    double max_latency_ms = latest_record.getLatencyMs();
+    for (const auto & record : getRecords()) {
+      max_waiting_time_ms = std::max(max_waiting_time_ms, record.getWaitingTimeMs());
+      max_processing_time_ms = std::max(max_processing_time_ms, record.getProcessingTimeMs());
+      max_latency_ms = std::max(max_latency_ms, record.getLatencyMs());
+    }
+    summary["max_waiting_time_ms"] = max_waiting_time_ms;
+    summary["max_processing_time_ms"] = max_processing_time_ms;
+    summary["max_latency_ms"] = max_latency_ms;
+
+    return summary;
+  }
+
+private:
+  std::vector<Record> records_;
+  size_t next_idx_{0};
+  size_t size_{0};
+
+  Record current_record_;
+  bool is_started_{false};
+};
+}  // namespace tier4_autoware_utils
+
+#endif  // TIER4_AUTOWARE_UTILS__ROS__LATENCY_TRACER_HPP_
@@ -0,0 +1,76 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// =============== Note ===============
+// This class applies realtime settings to the thread constructing the node, which is the thread
+// spinning the node when it runs with the executable generated by rclcpp_components, and to the
+// memory of the whole process. All the settings are disabled by default.
+//
+// Parameters (declared by this class):
+// - realtime.priority: SCHED_FIFO priority of the thread, 0 keeps the default scheduler
+// - realtime.cpu_affinity: CPUs the thread runs on, empty keeps all CPUs
+// - realtime.lock_memory: lock the current and future memory of the process with mlockall
+// - realtime.prefault_stack_size: size of the stack touched in advance [byte]
+// - realtime.prefault_heap_size: size of the heap reserved and touched in advance [byte]
+//
+// The priority and the memory locking need the corresponding privileges (e.g. rtprio and memlock
+// in /etc/security/limits.conf). A setting which cannot be applied is reported with a warning and
+// the node runs without it.
+
+// =============== How to use ===============
+// ___In your_node.hpp___
+// #include "tier4_autoware_utils/ros/realtime_configure.hpp"
+// class YourNode : public rclcpp::Node {
+//   ...
+//
+//   // Define realtime_configure as a node class member variable
+//   std::unique_ptr<tier4_autoware_utils::RealtimeConfigure> realtime_configure_;
+// }
+//
+// ___In your_node.cpp___
+// YourNode::YourNode() {
+//   ...
+//
+//   // Set up realtime_configure at the end of the constructor
+//   realtime_configure_ = std::make_unique<RealtimeConfigure>(this);
+// }
+
+#ifndef TIER4_AUTOWARE_UTILS__ROS__REALTIME_CONFIGURE_HPP_
+#define TIER4_AUTOWARE_UTILS__ROS__REALTIME_CONFIGURE_HPP_
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace tier4_autoware_utils
+{
+class RealtimeConfigure
+{
+public:
+  explicit RealtimeConfigure(rclcpp::Node * node);
+
+private:
+  rclcpp::Logger ros_logger_;
+
+  bool setPriority(const int priority);
+  bool setCpuAffinity(const std::vector<int64_t> & cpus);
+  bool lockMemory();
+  void prefaultStack(const size_t size);
+  bool prefaultHeap(const size_t size);
+};
+
+}  // namespace tier4_autoware_utils
+#endif  // TIER4_AUTOWARE_UTILS__ROS__REALTIME_CONFIGURE_HPP_
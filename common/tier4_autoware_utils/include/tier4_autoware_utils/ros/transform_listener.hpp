@@ -18,13 +18,20 @@
 #include <rclcpp/rclcpp.hpp>
 
 #include <geometry_msgs/msg/transform_stamped.hpp>
+#include <tf2_msgs/msg/tf_message.hpp>
 
 #include <tf2_ros/buffer.h>
 #include <tf2_ros/create_timer_ros.h>
+#include <tf2_ros/qos.hpp>
 #include <tf2_ros/transform_listener.h>
 
+#include <atomic>
+#include <cstdint>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <utility>
 
 namespace tier4_autoware_utils
 {
@@ -39,11 +46,31 @@ public:
       node->get_node_base_interface(), node->get_node_timers_interface());
     tf_buffer_->setCreateTimerInterface(timer_interface);
     tf_listener_ = std::make_shared<tf2_ros::TransformListener>(*tf_buffer_);
+
+    // The cached transforms may be outdated by any new static transform. The new transforms are
+    // set to the buffer here as well, since the listener may receive them after this callback.
+    static_transforms_ = std::make_shared<const StaticTransforms>();
+    sub_tf_static_ = node->create_subscription<tf2_msgs::msg::TFMessage>(
+      "/tf_static", tf2_ros::StaticListenerQoS(),
+      [this](const tf2_msgs::msg::TFMessage::ConstSharedPtr msg) {
+        std::lock_guard<std::mutex> lock(static_transforms_mutex_);
+        for (const auto & transform : msg->transforms) {
+          tf_buffer_->setTransform(transform, "tier4_autoware_utils", true);
+        }
+        ++static_transforms_version_;
+        std::atomic_store(&static_transforms_, std::make_shared<const StaticTransforms>());
+      });
   }
 
   geometry_msgs::msg::TransformStamped::ConstSharedPtr getLatestTransform(
     const std::string & from, const std::string & to)
   {
+    const uint64_t version = static_transforms_version_;
+    bool is_checked = false;
+    if (const auto static_tf = getStaticTransform(from, to, is_checked)) {
+      return static_tf;
+    }
+
     geometry_msgs::msg::TransformStamped tf;
     try {
       tf = tf_buffer_->lookupTransform(from, to, tf2::TimePointZero);
@@ -53,13 +80,26 @@ public:
       return {};
     }
 
-    return std::make_shared<const geometry_msgs::msg::TransformStamped>(tf);
+    auto tf_ptr = std::make_shared<const geometry_msgs::msg::TransformStamped>(tf);
+    if (!is_checked) {
+      // the latest transform of a chain of static transforms has no time stamp
+      addTransformType(from, to, isStatic(tf) ? tf_ptr : nullptr, version);
+    }
+    return tf_ptr;
   }
 
   geometry_msgs::msg::TransformStamped::ConstSharedPtr getTransform(
     const std::string & from, const std::string & to, const rclcpp::Time & time,
     const rclcpp::Duration & duration)
   {
+    const uint64_t version = static_transforms_version_;
+    bool is_checked = false;
+    if (const auto static_tf = getStaticTransform(from, to, is_checked)) {
+      auto tf_ptr = std::make_shared<geometry_msgs::msg::TransformStamped>(*static_tf);
+      tf_ptr->header.stamp = time;
+      return tf_ptr;
+    }
+
     geometry_msgs::msg::TransformStamped tf;
     try {
       tf = tf_buffer_->lookupTransform(from, to, time, duration);
@@ -69,16 +109,70 @@ public:
       return {};
     }
 
+    if (!is_checked) {
+      // check once whether the frames are connected by static transforms
+      geometry_msgs::msg::TransformStamped latest_tf;
+      try {
+        latest_tf = tf_buffer_->lookupTransform(from, to, tf2::TimePointZero);
+        addTransformType(
+          from, to,
+          isStatic(latest_tf)
+            ? std::make_shared<const geometry_msgs::msg::TransformStamped>(latest_tf)
+            : nullptr,
+          version);
+      } catch (const tf2::TransformException &) {
+        // checked again at the next lookup
+      }
+    }
     return std::make_shared<const geometry_msgs::msg::TransformStamped>(tf);
   }
 
   rclcpp::Logger getLogger() { return logger_; }
 
 private:
+  // Transforms between the frames connected by static transforms, which are looked up without the
+  // buffer. The frames connected by other transforms have nullptr so that they are checked once.
+  // The map is replaced instead of modified, so that it is read without lock.
+  using StaticTransforms = std::map<
+    std::pair<std::string, std::string>, geometry_msgs::msg::TransformStamped::ConstSharedPtr>;
+
+  static bool isStatic(const geometry_msgs::msg::TransformStamped & tf)
+  {
+    return tf.header.stamp.sec == 0 && tf.header.stamp.nanosec == 0;
+  }
+
+  geometry_msgs::msg::TransformStamped::ConstSharedPtr getStaticTransform(
+    const std::string & from, const std::string & to, bool & is_checked) const
+  {
+    const auto static_transforms = std::atomic_load(&static_transforms_);
+    const auto itr = static_transforms->find(std::make_pair(from, to));
+    is_checked = itr != static_transforms->end();
+    return is_checked ? itr->second : nullptr;
+  }
+
+  void addTransformType(
+    const std::string & from, const std::string & to,
+    const geometry_msgs::msg::TransformStamped::ConstSharedPtr & static_tf, const uint64_t version)
+  {
+    std::lock_guard<std::mutex> lock(static_transforms_mutex_);
+    // the transform may be looked up before a new static transform
+    if (version != static_transforms_version_) {
+      return;
+    }
+    auto static_transforms = std::make_shared<StaticTransforms>(*static_transforms_);
+    static_transforms->emplace(std::make_pair(from, to), static_tf);
+    std::atomic_store(
+      &static_transforms_, std::shared_ptr<const StaticTransforms>(std::move(static_transforms)));
+  }
+
   rclcpp::Clock::SharedPtr clock_;
   rclcpp::Logger logger_;
   std::shared_ptr<tf2_ros::Buffer> tf_buffer_;
   std::shared_ptr<tf2_ros::TransformListener> tf_listener_;
+  rclcpp::Subscription<tf2_msgs::msg::TFMessage>::SharedPtr sub_tf_static_;
+  std::shared_ptr<const StaticTransforms> static_transforms_;
+  std::atomic<uint64_t> static_transforms_version_{0};
+  std::mutex static_transforms_mutex_;
 };
 }  // namespace tier4_autoware_utils
 
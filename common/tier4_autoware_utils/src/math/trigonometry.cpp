@@ -17,7 +17,9 @@
 #include "tier4_autoware_utils/math/constants.hpp"
 #include "tier4_autoware_utils/math/sin_table.hpp"
 
+#include <algorithm>
 #include <cmath>
+#include <limits>
 
 namespace tier4_autoware_utils
 {
@@ -49,4 +51,67 @@ float cos(float radian)
   return sin(radian + static_cast<float>(tier4_autoware_utils::pi) / 2.f);
 }
 
+void sin_cos(const float * radians, float * sin_values, float * cos_values, const size_t size)
+{
+  // pi / 2 split into the parts which are exact in float, to reduce the angle precisely
+  constexpr float half_pi_0 = 1.5703125f;
+  constexpr float half_pi_1 = 4.837512969970703125e-4f;
+  constexpr float half_pi_2 = 7.54978995489188216e-8f;
+  constexpr float two_over_pi = 0.636619772367581343f;
+  // adding and subtracting 1.5 * 2^23 rounds a float to the nearest integer without a branch
+  constexpr float round_magic = 12582912.f;
+
+  for (size_t i = 0; i < size; ++i) {
+    const float radian = radians[i];
+    // reduce the angle to [-pi/4, pi/4] and the quadrant
+    const float quadrant_f = (radian * two_over_pi + round_magic) - round_magic;
+    const int quadrant = static_cast<int>(quadrant_f);
+    const float r =
+      ((radian - quadrant_f * half_pi_0) - quadrant_f * half_pi_1) - quadrant_f * half_pi_2;
+    const float r2 = r * r;
+
+    // minimax polynomials on [-pi/4, pi/4]
+    const float sin_r =
+      r + r * r2 * (-1.6666654611e-1f + r2 * (8.3321608736e-3f + r2 * -1.9515295891e-4f));
+    const float cos_r = 1.f - 0.5f * r2 +
+                        r2 * r2 *
+                          (4.166664568298827e-2f +
+                           r2 * (-1.388731625493765e-3f + r2 * 2.443315711809948e-5f));
+
+    const bool is_swapped = quadrant & 1;
+    const float sin_value = is_swapped ? cos_r : sin_r;
+    const float cos_value = is_swapped ? sin_r : cos_r;
+    sin_values[i] = (quadrant & 2) ? -sin_value : sin_value;
+    cos_values[i] = ((quadrant + 1) & 2) ? -cos_value : cos_value;
+  }
+}
+
+void atan2(const float * y, const float * x, float * radians, const size_t size)
+{
+  constexpr float pi_f = static_cast<float>(tier4_autoware_utils::pi);
+  constexpr float tan_pi_8 = 0.414213562373095f;
+
+  for (size_t i = 0; i < size; ++i) {
+    const float abs_y = std::abs(y[i]);
+    const float abs_x = std::abs(x[i]);
+    const float max_value = std::max(abs_x, abs_y);
+    const float min_value = std::min(abs_x, abs_y);
+    // atan of the ratio in [0, 1], which is reduced to [-tan(pi/8), tan(pi/8)] with
+    // atan(ratio) = pi/4 + atan((ratio - 1) / (ratio + 1))
+    const float ratio = min_value / std::max(max_value, std::numeric_limits<float>::min());
+    const bool is_large_ratio = tan_pi_8 < ratio;
+    const float t = is_large_ratio ? (ratio - 1.f) / (ratio + 1.f) : ratio;
+    const float t2 = t * t;
+    // minimax polynomial on [-tan(pi/8), tan(pi/8)]
+    const float poly = 1.99777106478e-1f + t2 * (-1.38776856032e-1f + t2 * 8.05374449538e-2f);
+    float angle = t + t * t2 * (-3.33329491539e-1f + t2 * poly);
+    angle += is_large_ratio ? pi_f / 4.f : 0.f;
+
+    // restore the octant and the quadrant, where the sign of -0 is taken into account
+    angle = abs_x < abs_y ? pi_f / 2.f - angle : angle;
+    angle = std::copysign(1.f, x[i]) < 0.f ? pi_f - angle : angle;
+    radians[i] = std::copysign(angle, y[i]);
+  }
+}
+
 }  // namespace tier4_autoware_utils
@@ -0,0 +1,129 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tier4_autoware_utils/ros/realtime_configure.hpp"
+
+#include <alloca.h>
+#include <malloc.h>
+#include <pthread.h>
+#include <sched.h>
+#include <sys/mman.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <vector>
+
+namespace tier4_autoware_utils
+{
+RealtimeConfigure::RealtimeConfigure(rclcpp::Node * node) : ros_logger_(node->get_logger())
+{
+  const auto priority = node->declare_parameter<int>("realtime.priority", 0);
+  const auto cpu_affinity =
+    node->declare_parameter<std::vector<int64_t>>("realtime.cpu_affinity", std::vector<int64_t>{});
+  const auto lock_memory = node->declare_parameter<bool>("realtime.lock_memory", false);
+  const auto prefault_stack_size = node->declare_parameter<int>("realtime.prefault_stack_size", 0);
+  const auto prefault_heap_size = node->declare_parameter<int>("realtime.prefault_heap_size", 0);
+
+  // NOTE: the memory is locked first so that the pages touched by the prefaulting stay resident
+  if (lock_memory && lockMemory()) {
+    RCLCPP_INFO(ros_logger_, "Memory of the process is locked.");
+  }
+  if (prefault_stack_size > 0) {
+    prefaultStack(static_cast<size_t>(prefault_stack_size));
+  }
+  if (prefault_heap_size > 0 && prefaultHeap(static_cast<size_t>(prefault_heap_size))) {
+    RCLCPP_INFO(ros_logger_, "%d bytes of heap are prefaulted.", prefault_heap_size);
+  }
+  if (!cpu_affinity.empty() && setCpuAffinity(cpu_affinity)) {
+    RCLCPP_INFO(ros_logger_, "CPU affinity is set.");
+  }
+  if (priority > 0 && setPriority(priority)) {
+    RCLCPP_INFO(ros_logger_, "SCHED_FIFO with priority %d is set.", priority);
+  }
+}
+
+bool RealtimeConfigure::setPriority(const int priority)
+{
+  sched_param param{};
+  param.sched_priority = priority;
+  const int ret = pthread_setschedparam(pthread_self(), SCHED_FIFO, &param);
+  if (ret != 0) {
+    RCLCPP_WARN(ros_logger_, "Failed to set SCHED_FIFO priority: %s", std::strerror(ret));
+    return false;
+  }
+  return true;
+}
+
+bool RealtimeConfigure::setCpuAffinity(const std::vector<int64_t> & cpus)
+{
+  cpu_set_t cpu_set;
+  CPU_ZERO(&cpu_set);
+  for (const auto cpu : cpus) {
+    if (cpu < 0 || cpu >= CPU_SETSIZE) {
+      RCLCPP_WARN_STREAM(ros_logger_, "Invalid CPU " << cpu << " for the CPU affinity.");
+      return false;
+    }
+    CPU_SET(static_cast<int>(cpu), &cpu_set);
+  }
+  const int ret = pthread_setaffinity_np(pthread_self(), sizeof(cpu_set_t), &cpu_set);
+  if (ret != 0) {
+    RCLCPP_WARN(ros_logger_, "Failed to set CPU affinity: %s", std::strerror(ret));
+    return false;
+  }
+  return true;
+}
+
+bool RealtimeConfigure::lockMemory()
+{
+  if (mlockall(MCL_CURRENT | MCL_FUTURE) != 0) {
+    RCLCPP_WARN(ros_logger_, "Failed to lock memory: %s", std::strerror(errno));
+    return false;
+  }
+  return true;
+}
+
+void RealtimeConfigure::prefaultStack(const size_t size)
+{
+  // touch the stack below the current frame so that its pages are mapped before running
+  auto * stack = static_cast<volatile unsigned char *>(alloca(size));
+  const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  for (size_t i = 0; i < size; i += page_size) {
+    stack[i] = 0;
+  }
+}
+
+bool RealtimeConfigure::prefaultHeap(const size_t size)
+{
+  // keep the freed memory in the process instead of returning it to the system, and serve all
+  // allocations from the heap instead of separate mappings
+  if (mallopt(M_TRIM_THRESHOLD, -1) == 0 || mallopt(M_MMAP_MAX, 0) == 0) {
+    RCLCPP_WARN(ros_logger_, "Failed to configure malloc for the heap prefaulting.");
+    return false;
+  }
+  auto * heap = static_cast<volatile unsigned char *>(std::malloc(size));
+  if (heap == nullptr) {
+    RCLCPP_WARN(ros_logger_, "Failed to allocate %zu bytes for the heap prefaulting.", size);
+    return false;
+  }
+  const auto page_size = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+  for (size_t i = 0; i < size; i += page_size) {
+    heap[i] = 0;
+  }
+  std::free(const_cast<unsigned char *>(heap));
+  return true;
+}
+
+}  // namespace tier4_autoware_utils
@@ -18,6 +18,8 @@
 #include <gtest/gtest.h>
 
 #include <cmath>
+#include <random>
+#include <vector>
 
 TEST(trigonometry, sin)
 {
@@ -40,3 +42,50 @@ TEST(trigonometry, cos)
         tier4_autoware_utils::cos(x * static_cast<float>(i))) < 10e-5);
   }
 }
+
+TEST(trigonometry, sin_cos)
+{
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<float> dist(-1e4f, 1e4f);
+  std::vector<float> radians(1000);
+  for (auto & radian : radians) {
+    radian = dist(gen);
+  }
+  radians.at(0) = 0.f;
+  radians.at(1) = static_cast<float>(tier4_autoware_utils::pi);
+
+  std::vector<float> sin_values(radians.size());
+  std::vector<float> cos_values(radians.size());
+  tier4_autoware_utils::sin_cos(
+    radians.data(), sin_values.data(), cos_values.data(), radians.size());
+  for (size_t i = 0; i < radians.size(); i++) {
+    EXPECT_NEAR(sin_values.at(i), std::sin(static_cast<double>(radians.at(i))), 1e-6);
+    EXPECT_NEAR(cos_values.at(i), std::cos(static_cast<double>(radians.at(i))), 1e-6);
+  }
+}
+
+TEST(trigonometry, atan2)
+{
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<float> dist(-100.f, 100.f);
+  std::vector<float> y(1000);
+  std::vector<float> x(1000);
+  for (size_t i = 0; i < y.size(); i++) {
+    y.at(i) = dist(gen);
+    x.at(i) = dist(gen);
+  }
+  // the signs of zeros are taken into account as std::atan2
+  const std::vector<float> zeros = {0.f, -0.f, 0.f, -0.f, 1.f, -1.f, 0.f, -0.f};
+  const std::vector<float> zero_xs = {0.f, 0.f, -0.f, -0.f, 0.f, -0.f, 1.f, -1.f};
+  y.insert(y.end(), zeros.begin(), zeros.end());
+  x.insert(x.end(), zero_xs.begin(), zero_xs.end());
+
+  std::vector<float> radians(y.size());
+  tier4_autoware_utils::atan2(y.data(), x.data(), radians.data(), y.size());
+  for (size_t i = 0; i < y.size(); i++) {
+    const double expected =
+      std::atan2(static_cast<double>(y.at(i)), static_cast<double>(x.at(i)));
+    EXPECT_NEAR(radians.at(i), expected, 1e-6);
+    EXPECT_EQ(std::signbit(radians.at(i)), std::signbit(expected));
+  }
+}
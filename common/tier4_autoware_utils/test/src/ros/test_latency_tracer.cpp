@@ -0,0 +1,59 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "tier4_autoware_utils/ros/latency_tracer.hpp"
+
+#include <gtest/gtest.h>
+
+#include <array>
+#include <vector>
+
+TEST(ros, LatencyTracer)
+{
+  using tier4_autoware_utils::LatencyTracer;
+
+  const auto to_time = [](const double sec) {
+    return rclcpp::Time(static_cast<int64_t>(sec * 1e9), RCL_ROS_TIME);
+  };
+
+  LatencyTracer tracer(3);
+  EXPECT_TRUE(tracer.empty());
+  EXPECT_TRUE(tracer.getSummary().empty());
+  EXPECT_FALSE(tracer.stop(to_time(1.0)));
+
+  // origin stamp, start time and end time of each message
+  const std::vector<std::array<double, 3>> times{
+    {0.0, 0.1, 0.15}, {1.0, 1.05, 1.25}, {2.0, 2.3, 2.35}, {3.0, 3.01, 3.02}};
+  for (const auto & [origin_stamp, start_time, end_time] : times) {
+    tracer.start(to_time(origin_stamp), to_time(start_time));
+    EXPECT_TRUE(tracer.stop(to_time(end_time)));
+  }
+  EXPECT_FALSE(tracer.stop(to_time(4.0)));
+
+  // only the last records are kept
+  const auto records = tracer.getRecords();
+  ASSERT_EQ(records.size(), 3U);
+  EXPECT_NEAR(records.front().getWaitingTimeMs(), 50.0, 1e-3);
+  EXPECT_NEAR(records.front().getProcessingTimeMs(), 200.0, 1e-3);
+  EXPECT_NEAR(records.front().getLatencyMs(), 250.0, 1e-3);
+  EXPECT_NEAR(records.back().getLatencyMs(), 20.0, 1e-3);
+
+  const auto summary = tracer.getSummary();
+  EXPECT_NEAR(summary.at("waiting_time_ms"), 10.0, 1e-3);
+  EXPECT_NEAR(summary.at("processing_time_ms"), 10.0, 1e-3);
+  EXPECT_NEAR(summary.at("latency_ms"), 20.0, 1e-3);
+  EXPECT_NEAR(summary.at("max_waiting_time_ms"), 300.0, 1e-3);
+  EXPECT_NEAR(summary.at("max_processing_time_ms"), 200.0, 1e-3);
+  EXPECT_NEAR(summary.at("max_latency_ms"), 350.0, 1e-3);
+}
@@ -35,6 +35,8 @@
 #include <OgreSceneManager.h>
 #include <OgreSceneNode.h>
 
+#include <algorithm>
+#include <array>
 #include <deque>
 #include <memory>
 #include <vector>
@@ -136,7 +138,11 @@ public:
     property_point_offset_{"Offset", 0.0, "", &property_point_view_},
     // slope
     property_slope_text_view_{"View Text Slope", false, "", this},
-    property_slope_text_scale_{"Scale", 0.3, "", &property_slope_text_view_}
+    property_slope_text_scale_{"Scale", 0.3, "", &property_slope_text_view_},
+    // decimation
+    property_decimation_interval_{
+      "Decimation Interval", 0.0,
+      "[m] Minimum interval of the footprints, points and texts. 0 draws all of them.", this}
   {
     // path
     property_path_width_.setMin(0.0);
@@ -159,6 +165,8 @@ public:
     // initialize point
     property_point_alpha_.setMin(0.0);
     property_point_alpha_.setMax(1.0);
+    // decimation
+    property_decimation_interval_.setMin(0.0);
 
     updateVehicleInfo();
   }
@@ -269,6 +277,8 @@ protected:
     this->scene_node_->setPosition(position);
     this->scene_node_->setOrientation(orientation);
 
+    updateDrawnPoints(msg_ptr);
+
     // visualize Path
     visualizePath(msg_ptr);
 
@@ -281,8 +291,65 @@ protected:
     last_msg_ptr_ = msg_ptr;
   }
 
+  // decimate the points whose footprint, point and texts are drawn since they are much heavier
+  // than the path and velocity, and are cluttered anyway when they are dense
+  void updateDrawnPoints(const typename T::ConstSharedPtr msg_ptr)
+  {
+    const size_t size = msg_ptr->points.size();
+    is_drawn_point_.assign(size, true);
+
+    const double interval = property_decimation_interval_.getFloat();
+    if (interval <= 0.0 || size < 3) {
+      return;
+    }
+
+    // NOTE: the first and last points are always drawn
+    auto last_drawn_position = tier4_autoware_utils::getPoint(msg_ptr->points.front());
+    for (size_t point_idx = 1; point_idx < size - 1; point_idx++) {
+      const auto position = tier4_autoware_utils::getPoint(msg_ptr->points.at(point_idx));
+      if (tier4_autoware_utils::calcDistance2d(last_drawn_position, position) < interval) {
+        is_drawn_point_.at(point_idx) = false;
+        continue;
+      }
+      last_drawn_position = position;
+    }
+  }
+
+  void resizeTexts(
+    std::vector<rviz_rendering::MovableText *> & texts, std::vector<Ogre::SceneNode *> & nodes,
+    const size_t size)
+  {
+    for (size_t i = texts.size(); i < size; i++) {
+      Ogre::SceneNode * node = this->scene_node_->createChildSceneNode();
+      rviz_rendering::MovableText * text =
+        new rviz_rendering::MovableText("not initialized", "Liberation Sans", 0.1);
+      text->setVisible(false);
+      text->setTextAlignment(
+        rviz_rendering::MovableText::H_CENTER, rviz_rendering::MovableText::V_ABOVE);
+      node->attachObject(text);
+      texts.push_back(text);
+      nodes.push_back(node);
+    }
+    for (size_t i = size; i < texts.size(); i++) {
+      Ogre::SceneNode * node = nodes.at(i);
+      node->detachAllObjects();
+      node->removeAndDestroyAllChildren();
+      this->scene_manager_->destroySceneNode(node);
+    }
+    texts.resize(size);
+    nodes.resize(size);
+  }
+
   void visualizePath(const typename T::ConstSharedPtr msg_ptr)
   {
+    // NOTE: the texts are created only while they are viewed
+    const bool is_velocity_text_view = property_velocity_text_view_.getBool();
+    const bool is_slope_text_view =
+      property_slope_text_view_.getBool() && 1 < msg_ptr->points.size();
+    resizeTexts(
+      velocity_texts_, velocity_text_nodes_, is_velocity_text_view ? msg_ptr->points.size() : 0);
+    resizeTexts(slope_texts_, slope_text_nodes_, is_slope_text_view ? msg_ptr->points.size() : 0);
+
     if (msg_ptr->points.empty()) {
       return;
     }
@@ -297,100 +364,51 @@ protected:
     path_manual_object_->begin("BaseWhiteNoLighting", Ogre::RenderOperation::OT_TRIANGLE_STRIP);
     velocity_manual_object_->begin("BaseWhiteNoLighting", Ogre::RenderOperation::OT_LINE_STRIP);
 
-    if (msg_ptr->points.size() > velocity_texts_.size()) {
-      for (size_t i = velocity_texts_.size(); i < msg_ptr->points.size(); i++) {
-        Ogre::SceneNode * node = this->scene_node_->createChildSceneNode();
-        rviz_rendering::MovableText * text =
-          new rviz_rendering::MovableText("not initialized", "Liberation Sans", 0.1);
-        text->setVisible(false);
-        text->setTextAlignment(
-          rviz_rendering::MovableText::H_CENTER, rviz_rendering::MovableText::V_ABOVE);
-        node->attachObject(text);
-        velocity_texts_.push_back(text);
-        velocity_text_nodes_.push_back(node);
-      }
-    } else if (msg_ptr->points.size() < velocity_texts_.size()) {
-      for (size_t i = velocity_texts_.size() - 1; i >= msg_ptr->points.size(); i--) {
-        Ogre::SceneNode * node = velocity_text_nodes_.at(i);
-        node->detachAllObjects();
-        node->removeAndDestroyAllChildren();
-        this->scene_manager_->destroySceneNode(node);
-      }
-      velocity_texts_.resize(msg_ptr->points.size());
-      velocity_text_nodes_.resize(msg_ptr->points.size());
-    }
-
-    if (msg_ptr->points.size() > slope_texts_.size()) {
-      for (size_t i = slope_texts_.size(); i < msg_ptr->points.size(); i++) {
-        Ogre::SceneNode * node = this->scene_node_->createChildSceneNode();
-        rviz_rendering::MovableText * text =
-          new rviz_rendering::MovableText("not initialized", "Liberation Sans", 0.1);
-        text->setVisible(false);
-        text->setTextAlignment(
-          rviz_rendering::MovableText::H_CENTER, rviz_rendering::MovableText::V_ABOVE);
-        node->attachObject(text);
-        slope_texts_.push_back(text);
-        slope_text_nodes_.push_back(node);
-      }
-    } else if (msg_ptr->points.size() < slope_texts_.size()) {
-      for (size_t i = slope_texts_.size() - 1; i >= msg_ptr->points.size(); i--) {
-        Ogre::SceneNode * node = slope_text_nodes_.at(i);
-        node->detachAllObjects();
-        node->removeAndDestroyAllChildren();
-        this->scene_manager_->destroySceneNode(node);
-      }
-      slope_texts_.resize(msg_ptr->points.size());
-      slope_text_nodes_.resize(msg_ptr->points.size());
-    }
-
     const auto info = vehicle_footprint_info_;
     const float left = property_path_width_view_.getBool() ? -property_path_width_.getFloat() / 2.0
                                                            : -info->width / 2.0;
     const float right = property_path_width_view_.getBool() ? property_path_width_.getFloat() / 2.0
                                                             : info->width / 2.0;
 
+    // NOTE: the properties are read once since they are not cheap to read for every point
+    const bool is_path_view = property_path_view_.getBool();
+    const bool is_path_color_view = property_path_color_view_.getBool();
+    const Ogre::ColourValue path_color =
+      rviz_common::properties::qtToOgre(property_path_color_.getColor());
+    const float path_alpha = property_path_alpha_.getFloat();
+    const bool is_velocity_view = property_velocity_view_.getBool();
+    const bool is_velocity_color_view = property_velocity_color_view_.getBool();
+    const Ogre::ColourValue velocity_color =
+      rviz_common::properties::qtToOgre(property_velocity_color_.getColor());
+    const float velocity_alpha = property_velocity_alpha_.getFloat();
+    const float velocity_scale = property_velocity_scale_.getFloat();
+    const float vel_max = property_vel_max_.getFloat();
+    const float velocity_text_scale = property_velocity_text_scale_.getFloat();
+    const float slope_text_scale = property_slope_text_scale_.getFloat();
+
     for (size_t point_idx = 0; point_idx < msg_ptr->points.size(); point_idx++) {
       const auto & path_point = msg_ptr->points.at(point_idx);
       const auto & pose = tier4_autoware_utils::getPose(path_point);
       const auto & velocity = tier4_autoware_utils::getLongitudinalVelocity(path_point);
 
+      // color change depending on velocity
+      Ogre::ColourValue dynamic_color;
+      if ((is_path_view && !is_path_color_view) || (is_velocity_view && !is_velocity_color_view)) {
+        dynamic_color = *setColorDependsOnVelocity(vel_max, velocity);
+      }
+
       // path
-      if (property_path_view_.getBool()) {
-        Ogre::ColourValue color;
-        if (property_path_color_view_.getBool()) {
-          color = rviz_common::properties::qtToOgre(property_path_color_.getColor());
-        } else {
-          // color change depending on velocity
-          std::unique_ptr<Ogre::ColourValue> dynamic_color_ptr =
-            setColorDependsOnVelocity(property_vel_max_.getFloat(), velocity);
-          color = *dynamic_color_ptr;
-        }
-        color.a = property_path_alpha_.getFloat();
-        Eigen::Vector3f vec_in;
-        Eigen::Vector3f vec_out;
-        Eigen::Quaternionf quat_yaw_reverse(0, 0, 0, 1);
-        {
-          vec_in << 0, right, 0;
-          Eigen::Quaternionf quat(
-            pose.orientation.w, pose.orientation.x, pose.orientation.y, pose.orientation.z);
-          if (!isDrivingForward(msg_ptr->points, point_idx)) {
-            quat *= quat_yaw_reverse;
-          }
-          vec_out = quat * vec_in;
-          path_manual_object_->position(
-            static_cast<float>(pose.position.x) + vec_out.x(),
-            static_cast<float>(pose.position.y) + vec_out.y(),
-            static_cast<float>(pose.position.z) + vec_out.z());
-          path_manual_object_->colour(color);
+      if (is_path_view) {
+        Ogre::ColourValue color = is_path_color_view ? path_color : dynamic_color;
+        color.a = path_alpha;
+        Eigen::Quaternionf quat(
+          pose.orientation.w, pose.orientation.x, pose.orientation.y, pose.orientation.z);
+        if (!isDrivingForward(msg_ptr->points, point_idx)) {
+          const Eigen::Quaternionf quat_yaw_reverse(0, 0, 0, 1);
+          quat *= quat_yaw_reverse;
         }
-        {
-          vec_in << 0, left, 0;
-          Eigen::Quaternionf quat(
-            pose.orientation.w, pose.orientation.x, pose.orientation.y, pose.orientation.z);
-          if (!isDrivingForward(msg_ptr->points, point_idx)) {
-            quat *= quat_yaw_reverse;
-          }
-          vec_out = quat * vec_in;
+        for (const float lat_offset : {right, left}) {
+          const Eigen::Vector3f vec_out = quat * Eigen::Vector3f(0, lat_offset, 0);
           path_manual_object_->position(
             static_cast<float>(pose.position.x) + vec_out.x(),
             static_cast<float>(pose.position.y) + vec_out.y(),
@@ -400,75 +418,70 @@ protected:
       }
 
       // velocity
-      if (property_velocity_view_.getBool()) {
-        Ogre::ColourValue color;
-        if (property_velocity_color_view_.getBool()) {
-          color = rviz_common::properties::qtToOgre(property_velocity_color_.getColor());
-        } else {
-          /* color change depending on velocity */
-          std::unique_ptr<Ogre::ColourValue> dynamic_color_ptr =
-            setColorDependsOnVelocity(property_vel_max_.getFloat(), velocity);
-          color = *dynamic_color_ptr;
-        }
-        color.a = property_velocity_alpha_.getFloat();
+      if (is_velocity_view) {
+        Ogre::ColourValue color = is_velocity_color_view ? velocity_color : dynamic_color;
+        color.a = velocity_alpha;
 
         velocity_manual_object_->position(
           pose.position.x, pose.position.y,
-          static_cast<float>(pose.position.z) + velocity * property_velocity_scale_.getFloat());
+          static_cast<float>(pose.position.z) + velocity * velocity_scale);
         velocity_manual_object_->colour(color);
       }
 
       // velocity text
-      if (property_velocity_text_view_.getBool()) {
-        Ogre::Vector3 position;
-        position.x = pose.position.x;
-        position.y = pose.position.y;
-        position.z = pose.position.z;
-        Ogre::SceneNode * node = velocity_text_nodes_.at(point_idx);
-        node->setPosition(position);
-
-        rviz_rendering::MovableText * text = velocity_texts_.at(point_idx);
-        const double vel = velocity;
-        std::stringstream ss;
-        ss << std::fixed << std::setprecision(2) << vel;
-        text->setCaption(ss.str());
-        text->setCharacterHeight(property_velocity_text_scale_.getFloat());
-        text->setVisible(true);
-      } else {
+      if (is_velocity_text_view) {
         rviz_rendering::MovableText * text = velocity_texts_.at(point_idx);
-        text->setVisible(false);
+        if (is_drawn_point_.at(point_idx)) {
+          Ogre::Vector3 position;
+          position.x = pose.position.x;
+          position.y = pose.position.y;
+          position.z = pose.position.z;
+          Ogre::SceneNode * node = velocity_text_nodes_.at(point_idx);
+          node->setPosition(position);
+
+          const double vel = velocity;
+          std::stringstream ss;
+          ss << std::fixed << std::setprecision(2) << vel;
+          text->setCaption(ss.str());
+          text->setCharacterHeight(velocity_text_scale);
+          text->setVisible(true);
+        } else {
+          text->setVisible(false);
+        }
       }
 
       // slope text
-      if (property_slope_text_view_.getBool() && 1 < msg_ptr->points.size()) {
-        const size_t prev_idx =
-          (point_idx != msg_ptr->points.size() - 1) ? point_idx : point_idx - 1;
-        const size_t next_idx =
-          (point_idx != msg_ptr->points.size() - 1) ? point_idx + 1 : point_idx;
-
-        const auto & prev_path_pos =
-          tier4_autoware_utils::getPose(msg_ptr->points.at(prev_idx)).position;
-        const auto & next_path_pos =
-          tier4_autoware_utils::getPose(msg_ptr->points.at(next_idx)).position;
-
-        Ogre::Vector3 position;
-        position.x = pose.position.x;
-        position.y = pose.position.y;
-        position.z = pose.position.z;
-        Ogre::SceneNode * node = slope_text_nodes_.at(point_idx);
-        node->setPosition(position);
-
-        rviz_rendering::MovableText * text = slope_texts_.at(point_idx);
-        const double slope = tier4_autoware_utils::calcElevationAngle(prev_path_pos, next_path_pos);
-
-        std::stringstream ss;
-        ss << std::fixed << std::setprecision(2) << slope;
-        text->setCaption(ss.str());
-        text->setCharacterHeight(property_slope_text_scale_.getFloat());
-        text->setVisible(true);
-      } else {
+      if (is_slope_text_view) {
         rviz_rendering::MovableText * text = slope_texts_.at(point_idx);
-        text->setVisible(false);
+        if (is_drawn_point_.at(point_idx)) {
+          const size_t prev_idx =
+            (point_idx != msg_ptr->points.size() - 1) ? point_idx : point_idx - 1;
+          const size_t next_idx =
+            (point_idx != msg_ptr->points.size() - 1) ? point_idx + 1 : point_idx;
+
+          const auto & prev_path_pos =
+            tier4_autoware_utils::getPose(msg_ptr->points.at(prev_idx)).position;
+          const auto & next_path_pos =
+            tier4_autoware_utils::getPose(msg_ptr->points.at(next_idx)).position;
+
+          Ogre::Vector3 position;
+          position.x = pose.position.x;
+          position.y = pose.position.y;
+          position.z = pose.position.z;
+          Ogre::SceneNode * node = slope_text_nodes_.at(point_idx);
+          node->setPosition(position);
+
+          const double slope =
+            tier4_autoware_utils::calcElevationAngle(prev_path_pos, next_path_pos);
+
+          std::stringstream ss;
+          ss << std::fixed << std::setprecision(2) << slope;
+          text->setCaption(ss.str());
+          text->setCharacterHeight(slope_text_scale);
+          text->setVisible(true);
+        } else {
+          text->setVisible(false);
+        }
       }
     }
 
@@ -487,9 +500,14 @@ protected:
     material->setSceneBlending(Ogre::SBT_TRANSPARENT_ALPHA);
     material->setDepthWriteEnabled(false);
 
-    footprint_manual_object_->estimateVertexCount(msg_ptr->points.size() * 4 * 2);
+    const bool is_footprint_view = property_footprint_view_.getBool();
+    const bool is_point_view = property_point_view_.getBool();
+    const size_t drawn_point_num =
+      static_cast<size_t>(std::count(is_drawn_point_.begin(), is_drawn_point_.end(), true));
+
+    footprint_manual_object_->estimateVertexCount(is_footprint_view ? drawn_point_num * 4 * 2 : 0);
     footprint_manual_object_->begin("BaseWhiteNoLighting", Ogre::RenderOperation::OT_LINE_LIST);
-    point_manual_object_->estimateVertexCount(msg_ptr->points.size() * 3 * 8);
+    point_manual_object_->estimateVertexCount(is_point_view ? drawn_point_num * 3 * 8 : 0);
     point_manual_object_->begin("BaseWhiteNoLighting", Ogre::RenderOperation::OT_TRIANGLE_LIST);
 
     preVisualizePathFootprintDetail(msg_ptr);
@@ -500,71 +518,75 @@ protected:
     const float bottom = -info->rear_overhang + offset_from_baselink;
     const float left = -info->width / 2.0;
     const float right = info->width / 2.0;
+    const std::array<float, 4> lon_offset_vec{top, top, bottom, bottom};
+    const std::array<float, 4> lat_offset_vec{left, right, right, left};
+
+    Ogre::ColourValue footprint_color =
+      rviz_common::properties::qtToOgre(property_footprint_color_.getColor());
+    footprint_color.a = property_footprint_alpha_.getFloat();
+
+    Ogre::ColourValue point_color =
+      rviz_common::properties::qtToOgre(property_point_color_.getColor());
+    point_color.a = property_point_alpha_.getFloat();
+    const double point_offset = property_point_offset_.getFloat();
+    const double point_radius = property_point_radius_.getFloat();
+    // vertices of the octagon of the point relative to its center
+    std::array<std::pair<double, double>, 9> point_vertices;
+    for (size_t s_idx = 0; s_idx < point_vertices.size(); ++s_idx) {
+      const double angle = static_cast<double>(s_idx) / 8.0 * 2.0 * M_PI;
+      point_vertices.at(s_idx) = {point_radius * std::cos(angle), point_radius * std::sin(angle)};
+    }
 
     for (size_t p_idx = 0; p_idx < msg_ptr->points.size(); p_idx++) {
+      if (!is_drawn_point_.at(p_idx)) {
+        visualizePathFootprintDetail(msg_ptr, p_idx);
+        continue;
+      }
+
       const auto & point = msg_ptr->points.at(p_idx);
       const auto & pose = tier4_autoware_utils::getPose(point);
       // footprint
-      if (property_footprint_view_.getBool()) {
-        Ogre::ColourValue color;
-        color = rviz_common::properties::qtToOgre(property_footprint_color_.getColor());
-        color.a = property_footprint_alpha_.getFloat();
-
-        const std::array<float, 4> lon_offset_vec{top, top, bottom, bottom};
-        const std::array<float, 4> lat_offset_vec{left, right, right, left};
+      if (is_footprint_view) {
+        const Eigen::Quaternionf quat(
+          pose.orientation.w, pose.orientation.x, pose.orientation.y, pose.orientation.z);
 
+        std::array<Eigen::Vector3f, 4> offset_to_edges;
         for (int f_idx = 0; f_idx < 4; ++f_idx) {
-          const Eigen::Quaternionf quat(
-            pose.orientation.w, pose.orientation.x, pose.orientation.y, pose.orientation.z);
+          offset_to_edges.at(f_idx) =
+            quat * Eigen::Vector3f(lon_offset_vec.at(f_idx), lat_offset_vec.at(f_idx), 0.0);
+        }
 
-          {
-            const Eigen::Vector3f offset_vec{
-              lon_offset_vec.at(f_idx), lat_offset_vec.at(f_idx), 0.0};
-            const auto offset_to_edge = quat * offset_vec;
-            footprint_manual_object_->position(
-              pose.position.x + offset_to_edge.x(), pose.position.y + offset_to_edge.y(),
-              pose.position.z);
-            footprint_manual_object_->colour(color);
-          }
-          {
-            const Eigen::Vector3f offset_vec{
-              lon_offset_vec.at((f_idx + 1) % 4), lat_offset_vec.at((f_idx + 1) % 4), 0.0};
-            const auto offset_to_edge = quat * offset_vec;
+        for (int f_idx = 0; f_idx < 4; ++f_idx) {
+          for (const auto & offset_to_edge :
+               {offset_to_edges.at(f_idx), offset_to_edges.at((f_idx + 1) % 4)}) {
             footprint_manual_object_->position(
               pose.position.x + offset_to_edge.x(), pose.position.y + offset_to_edge.y(),
               pose.position.z);
-            footprint_manual_object_->colour(color);
+            footprint_manual_object_->colour(footprint_color);
           }
         }
       }
 
       // point
-      if (property_point_view_.getBool()) {
-        Ogre::ColourValue color;
-        color = rviz_common::properties::qtToOgre(property_point_color_.getColor());
-        color.a = property_point_alpha_.getFloat();
-
-        const double offset = property_point_offset_.getFloat();
+      if (is_point_view) {
         const double yaw = tf2::getYaw(pose.orientation);
-        const double base_x = pose.position.x + offset * std::cos(yaw);
-        const double base_y = pose.position.y + offset * std::sin(yaw);
+        const double base_x = pose.position.x + point_offset * std::cos(yaw);
+        const double base_y = pose.position.y + point_offset * std::sin(yaw);
         const double base_z = pose.position.z;
 
-        const double radius = property_point_radius_.getFloat();
         for (size_t s_idx = 0; s_idx < 8; ++s_idx) {
-          const double current_angle = static_cast<double>(s_idx) / 8.0 * 2.0 * M_PI;
-          const double next_angle = static_cast<double>(s_idx + 1) / 8.0 * 2.0 * M_PI;
+          const auto & current_vertex = point_vertices.at(s_idx);
+          const auto & next_vertex = point_vertices.at(s_idx + 1);
           point_manual_object_->position(
-            base_x + radius * std::cos(current_angle), base_y + radius * std::sin(current_angle),
-            base_z);
-          point_manual_object_->colour(color);
+            base_x + current_vertex.first, base_y + current_vertex.second, base_z);
+          point_manual_object_->colour(point_color);
 
           point_manual_object_->position(
-            base_x + radius * std::cos(next_angle), base_y + radius * std::sin(next_angle), base_z);
-          point_manual_object_->colour(color);
+            base_x + next_vertex.first, base_y + next_vertex.second, base_z);
+          point_manual_object_->colour(point_color);
 
           point_manual_object_->position(base_x, base_y, base_z);
-          point_manual_object_->colour(color);
+          point_manual_object_->colour(point_color);
         }
       }
 
@@ -636,10 +658,14 @@ protected:
   rviz_common::properties::BoolProperty property_slope_text_view_;
   rviz_common::properties::FloatProperty property_slope_text_scale_;
 
+  rviz_common::properties::FloatProperty property_decimation_interval_;
+
   std::shared_ptr<VehicleInfo> vehicle_info_;
 
 private:
   typename T::ConstSharedPtr last_msg_ptr_;
+  // whether the footprint, point and texts of each point are drawn
+  std::vector<bool> is_drawn_point_;
 
   struct VehicleFootprintInfo
   {
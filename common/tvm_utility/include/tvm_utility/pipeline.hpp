@@ -23,10 +23,18 @@
 #include <tvm_vendor/tvm/runtime/packed_func.h>
 #include <tvm_vendor/tvm/runtime/registry.h>
 
+#include <algorithm>
+#include <array>
+#include <condition_variable>
 #include <cstdint>
+#include <deque>
+#include <exception>
 #include <fstream>
+#include <future>
 #include <memory>
+#include <mutex>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -183,6 +191,242 @@ private:
   PostProcessorType post_processor_{};
 };
 
+/**
+ * @class AsyncPipeline
+ * @brief Inference Pipeline of which the 3 stages run each on their own
+ * thread, so that the stages of consecutive inputs overlap.
+ *
+ * The stages usually return containers of their own buffers, which they
+ * overwrite at the next call. A stage is therefore only called again when the
+ * next stage is done with the outputs which would be overwritten: with one
+ * buffer, the pre processing of an input overlaps the post processing of the
+ * previous one. The inference overlaps the post processing as well if the
+ * inference engine rotates several output buffers.
+ */
+template <class PreProcessorType, class InferenceEngineType, class PostProcessorType>
+class AsyncPipeline
+{
+  using InputType = decltype(std::declval<PreProcessorType>().input_type_indicator_);
+  using OutputType = decltype(std::declval<PostProcessorType>().output_type_indicator_);
+
+public:
+  /**
+   * @brief Construct a new AsyncPipeline object and start its threads
+   *
+   * @param pre_processor a PreProcessor object
+   * @param inference_engine a InferenceEngine object
+   * @param post_processor a PostProcessor object
+   * @param num_pre_processor_buffers number of outputs of the pre processor
+   * which stay valid, so that it may run as many inputs ahead of the inference
+   * @param num_inference_engine_buffers number of outputs of the inference
+   * engine which stay valid, so that it may run as many inputs ahead of the
+   * post processor
+   * @param max_queued_inputs number of inputs waiting for the pre processor
+   * above which schedule() blocks
+   */
+  AsyncPipeline(
+    PreProcessorType pre_processor, InferenceEngineType inference_engine,
+    PostProcessorType post_processor, const std::size_t num_pre_processor_buffers = 1,
+    const std::size_t num_inference_engine_buffers = 1, const std::size_t max_queued_inputs = 1)
+  : pre_processor_(pre_processor),
+    inference_engine_(inference_engine),
+    post_processor_(post_processor),
+    num_buffers_{
+      std::max<std::size_t>(num_pre_processor_buffers, 1),
+      std::max<std::size_t>(num_inference_engine_buffers, 1)},
+    max_queued_inputs_(std::max<std::size_t>(max_queued_inputs, 1))
+  {
+    pre_processor_thread_ = std::thread([this]() { runPreProcessor(); });
+    inference_engine_thread_ = std::thread([this]() { runInferenceEngine(); });
+    post_processor_thread_ = std::thread([this]() { runPostProcessor(); });
+  }
+
+  AsyncPipeline(const AsyncPipeline &) = delete;
+  AsyncPipeline & operator=(const AsyncPipeline &) = delete;
+
+  /**
+   * @brief Stop the threads. The inputs still in the pipeline are dropped, and
+   * their futures get a broken promise error.
+   */
+  ~AsyncPipeline()
+  {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    condition_.notify_all();
+    pre_processor_thread_.join();
+    inference_engine_thread_.join();
+    post_processor_thread_.join();
+  }
+
+  /**
+   * @brief push an input into the pipeline. Blocks while max_queued_inputs
+   * inputs are waiting for the pre processor.
+   *
+   * @param input The data to push into the pipeline
+   * @return The future pipeline output, which holds the exception if one of
+   * the stages throws
+   */
+  std::future<OutputType> schedule(const InputType & input)
+  {
+    std::unique_lock<std::mutex> lock(mutex_);
+    condition_.wait(lock, [this]() { return stop_ || inputs_.size() < max_queued_inputs_; });
+    inputs_.push_back(input);
+    promises_.emplace_back();
+    auto future = promises_.back().get_future();
+    lock.unlock();
+    condition_.notify_all();
+    return future;
+  }
+
+  /**
+   * @brief run the pipeline on a batch of inputs, which overlap each other
+   *
+   * @param inputs The data to push into the pipeline
+   * @return The pipeline outputs, in the order of the inputs
+   */
+  std::vector<OutputType> scheduleBatch(const std::vector<InputType> & inputs)
+  {
+    std::vector<std::future<OutputType>> futures;
+    futures.reserve(inputs.size());
+    for (const auto & input : inputs) {
+      futures.push_back(schedule(input));
+    }
+    std::vector<OutputType> outputs;
+    outputs.reserve(inputs.size());
+    for (auto & future : futures) {
+      outputs.push_back(future.get());
+    }
+    return outputs;
+  }
+
+private:
+  // Output of a stage for one input, or the exception of the stage which failed
+  struct Tensors
+  {
+    TVMArrayContainerVector tensors;
+    std::exception_ptr error;
+  };
+
+  // The n-th output of a stage overwrites its (n - num_buffers)-th one, which
+  // the next stage must be done with
+  bool isBufferFree(const std::size_t stage) const
+  {
+    return num_processed_[stage] < num_processed_[stage + 1] + num_buffers_[stage];
+  }
+
+  void runPreProcessor()
+  {
+    while (true) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(lock, [this]() { return stop_ || (!inputs_.empty() && isBufferFree(0)); });
+      if (stop_) {
+        return;
+      }
+      InputType input = std::move(inputs_.front());
+      inputs_.pop_front();
+      lock.unlock();
+      condition_.notify_all();
+
+      Tensors output;
+      try {
+        output.tensors = pre_processor_.schedule(input);
+      } catch (...) {
+        output.error = std::current_exception();
+      }
+
+      lock.lock();
+      pre_processor_outputs_.push_back(std::move(output));
+      ++num_processed_[0];
+      lock.unlock();
+      condition_.notify_all();
+    }
+  }
+
+  void runInferenceEngine()
+  {
+    while (true) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(
+        lock, [this]() { return stop_ || (!pre_processor_outputs_.empty() && isBufferFree(1)); });
+      if (stop_) {
+        return;
+      }
+      Tensors input = std::move(pre_processor_outputs_.front());
+      pre_processor_outputs_.pop_front();
+      lock.unlock();
+
+      Tensors output;
+      output.error = input.error;
+      if (!output.error) {
+        try {
+          output.tensors = inference_engine_.schedule(input.tensors);
+        } catch (...) {
+          output.error = std::current_exception();
+        }
+      }
+
+      lock.lock();
+      inference_engine_outputs_.push_back(std::move(output));
+      ++num_processed_[1];
+      lock.unlock();
+      condition_.notify_all();
+    }
+  }
+
+  void runPostProcessor()
+  {
+    while (true) {
+      std::unique_lock<std::mutex> lock(mutex_);
+      condition_.wait(lock, [this]() { return stop_ || !inference_engine_outputs_.empty(); });
+      if (stop_) {
+        return;
+      }
+      Tensors input = std::move(inference_engine_outputs_.front());
+      inference_engine_outputs_.pop_front();
+      std::promise<OutputType> promise = std::move(promises_.front());
+      promises_.pop_front();
+      lock.unlock();
+
+      if (input.error) {
+        promise.set_exception(std::move(input.error));
+      } else {
+        try {
+          promise.set_value(post_processor_.schedule(input.tensors));
+        } catch (...) {
+          promise.set_exception(std::current_exception());
+        }
+      }
+
+      lock.lock();
+      ++num_processed_[2];
+      lock.unlock();
+      condition_.notify_all();
+    }
+  }
+
+  PreProcessorType pre_processor_{};
+  InferenceEngineType inference_engine_{};
+  PostProcessorType post_processor_{};
+  const std::array<std::size_t, 2> num_buffers_;
+  const std::size_t max_queued_inputs_;
+
+  std::mutex mutex_;
+  std::condition_variable condition_;
+  bool stop_{false};
+  std::deque<InputType> inputs_;
+  std::deque<std::promise<OutputType>> promises_;
+  std::deque<Tensors> pre_processor_outputs_;
+  std::deque<Tensors> inference_engine_outputs_;
+  // number of inputs processed by each stage
+  std::array<std::size_t, 3> num_processed_{0, 0, 0};
+
+  std::thread pre_processor_thread_;
+  std::thread inference_engine_thread_;
+  std::thread post_processor_thread_;
+};
+
 // NetworkNode
 typedef struct
 {
@@ -224,9 +468,18 @@ typedef struct
 class InferenceEngineTVM : public InferenceEngine
 {
 public:
+  /**
+   * @brief Construct a new InferenceEngineTVM object
+   *
+   * @param config configuration of the network
+   * @param pkg_name package in which the network is installed
+   * @param autoware_data_path path of the autoware_data folder, empty for the package share
+   * @param num_output_buffers number of output sets the calls rotate, so that the outputs of a
+   * call stay valid during the next num_output_buffers - 1 calls, e.g. in an AsyncPipeline
+   */
   explicit InferenceEngineTVM(
     const InferenceEngineTVMConfig & config, const std::string & pkg_name,
-    const std::string & autoware_data_path = "")
+    const std::string & autoware_data_path = "", const std::size_t num_output_buffers = 1)
   : config_(config)
   {
     // Get full network path
@@ -292,10 +545,13 @@ public:
     // Get the function to get output data
     get_output = runtime_mod.GetFunction("get_output");
 
-    for (auto & output_config : config.network_outputs) {
-      output_.push_back(TVMArrayContainer(
-        output_config.node_shape, output_config.tvm_dtype_code, output_config.tvm_dtype_bits,
-        output_config.tvm_dtype_lanes, config.tvm_device_type, config.tvm_device_id));
+    outputs_.resize(std::max<std::size_t>(num_output_buffers, 1));
+    for (auto & output : outputs_) {
+      for (auto & output_config : config.network_outputs) {
+        output.push_back(TVMArrayContainer(
+          output_config.node_shape, output_config.tvm_dtype_code, output_config.tvm_dtype_bits,
+          output_config.tvm_dtype_lanes, config.tvm_device_type, config.tvm_device_id));
+      }
     }
   }
 
@@ -313,13 +569,15 @@ public:
     execute();
 
     // Get output(s)
-    for (uint32_t index = 0; index < output_.size(); ++index) {
-      if (output_[index].getArray() == nullptr) {
+    auto & output = outputs_[next_output_];
+    next_output_ = (next_output_ + 1) % outputs_.size();
+    for (uint32_t index = 0; index < output.size(); ++index) {
+      if (output[index].getArray() == nullptr) {
         throw std::runtime_error("output variable is null");
       }
-      get_output(index, output_[index].getArray());
+      get_output(index, output[index].getArray());
     }
-    return output_;
+    return output;
   }
 
   /**
@@ -347,7 +605,8 @@ public:
 
 private:
   InferenceEngineTVMConfig config_;
-  TVMArrayContainerVector output_;
+  std::vector<TVMArrayContainerVector> outputs_;
+  std::size_t next_output_{0};
   tvm::runtime::PackedFunc set_input;
   tvm::runtime::PackedFunc execute;
   tvm::runtime::PackedFunc get_output;
@@ -19,6 +19,7 @@
 #include <opencv2/opencv.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <cstdio>
 #include <string>
 #include <utility>
@@ -142,5 +143,37 @@ TEST(PipelineExamples, SimplePipeline)
   }
 }
 
+TEST(PipelineExamples, AsyncPipeline)
+{
+  using PrePT = PreProcessorLinearModel;
+  using IET = tvm_utility::pipeline::InferenceEngineTVM;
+  using PostPT = PostProcessorLinearModel;
+
+  PrePT PreP{config};
+  // two output buffers, so that the inference of an input overlaps the post processing of the
+  // previous one
+  IET IE{config, "tvm_utility", "", 2};
+  PostPT PostP{config};
+
+  tvm_utility::pipeline::AsyncPipeline<PrePT, IET, PostPT> pipeline(PreP, IE, PostP, 1, 2);
+
+  std::vector<std::vector<float>> inputs;
+  for (int i = 0; i < 8; ++i) {
+    const float value = static_cast<float>(i);
+    inputs.push_back({-value, value + 1.f, -(value + 2.f), value + 3.f});
+  }
+  auto outputs = pipeline.scheduleBatch(inputs);
+
+  // Test: check if the generated outputs are the absolute values of the inputs, in order
+  ASSERT_EQ(inputs.size(), outputs.size()) << "Unexpected number of outputs";
+  for (size_t n = 0; n < outputs.size(); ++n) {
+    EXPECT_EQ(inputs[n].size(), outputs[n].size()) << "Unexpected output size";
+    for (size_t i = 0; i < outputs[n].size(); ++i) {
+      EXPECT_NEAR(std::abs(inputs[n][i]), outputs[n][i], 0.0001)
+        << "at input: " << n << ", index: " << i;
+    }
+  }
+}
+
 }  // namespace abs_model
 }  // namespace tvm_utility
@@ -30,6 +30,7 @@
 #include <visualization_msgs/msg/marker.hpp>
 #include <visualization_msgs/msg/marker_array.hpp>
 
+#include <boost/geometry/index/rtree.hpp>
 #include <boost/optional.hpp>
 
 #include <pcl/common/transforms.h>
@@ -42,6 +43,7 @@
 #include <memory>
 #include <mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace autoware::motion::control::autonomous_emergency_braking
@@ -157,6 +159,10 @@ public:
   void addCollisionMarker(const ObjectData & data, MarkerArray & debug_markers);
 
   PointCloud2::SharedPtr obstacle_ros_pointcloud_ptr_{nullptr};
+  // filtered obstacle points and R-tree of their positions, shared by all the ego paths
+  PointCloud::Ptr obstacle_points_ptr_{nullptr};
+  boost::geometry::index::rtree<std::pair<Point2d, size_t>, boost::geometry::index::rstar<16>>
+    obstacle_points_rtree_;
   VelocityReport::ConstSharedPtr current_velocity_ptr_{nullptr};
   Vector3::SharedPtr angular_velocity_ptr_{nullptr};
   Trajectory::ConstSharedPtr predicted_traj_ptr_{nullptr};
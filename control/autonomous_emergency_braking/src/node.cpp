@@ -34,7 +34,14 @@
 #endif
 
 #include <boost/geometry/algorithms/convex_hull.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
 #include <boost/geometry/algorithms/within.hpp>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
+
 namespace autoware::motion::control::autonomous_emergency_braking
 {
 using diagnostic_msgs::msg::DiagnosticStatus;
@@ -227,6 +234,18 @@ void AEB::onPointCloud(const PointCloud2::ConstSharedPtr input_msg)
   filter.setLeafSize(voxel_grid_x_, voxel_grid_y_, voxel_grid_z_);
   filter.filter(*no_height_filtered_pointcloud_ptr);
 
+  // index the obstacle points once for all the ego paths
+  std::vector<std::pair<Point2d, size_t>> indexed_points;
+  indexed_points.reserve(no_height_filtered_pointcloud_ptr->size());
+  for (size_t i = 0; i < no_height_filtered_pointcloud_ptr->size(); ++i) {
+    const auto & point = no_height_filtered_pointcloud_ptr->points.at(i);
+    indexed_points.emplace_back(Point2d(point.x, point.y), i);
+  }
+  // packing algorithm
+  obstacle_points_rtree_ =
+    decltype(obstacle_points_rtree_)(indexed_points.begin(), indexed_points.end());
+  obstacle_points_ptr_ = no_height_filtered_pointcloud_ptr;
+
   obstacle_ros_pointcloud_ptr_ = std::make_shared<PointCloud2>();
   pcl::toROSMsg(*no_height_filtered_pointcloud_ptr, *obstacle_ros_pointcloud_ptr_);
   obstacle_ros_pointcloud_ptr_->header = input_msg->header;
@@ -478,24 +497,39 @@ void AEB::createObjectData(
     return;
   }
 
-  PointCloud::Ptr obstacle_points_ptr(new PointCloud);
-  pcl::fromROSMsg(*obstacle_ros_pointcloud_ptr_, *obstacle_points_ptr);
-  for (const auto & point : obstacle_points_ptr->points) {
+  // search the points in the bounding box of each ego polygon, then test them exactly
+  std::vector<size_t> point_indices;
+  std::vector<std::pair<Point2d, size_t>> query_results;
+  for (const auto & ego_poly : ego_polys) {
+    if (ego_poly.outer().empty()) {
+      continue;
+    }
+    query_results.clear();
+    obstacle_points_rtree_.query(
+      bg::index::intersects(bg::return_envelope<tier4_autoware_utils::Box2d>(ego_poly)),
+      std::back_inserter(query_results));
+    for (const auto & [obj_point, point_idx] : query_results) {
+      if (bg::within(obj_point, ego_poly)) {
+        point_indices.push_back(point_idx);
+      }
+    }
+  }
+  // keep the order of the points
+  std::sort(point_indices.begin(), point_indices.end());
+  point_indices.erase(
+    std::unique(point_indices.begin(), point_indices.end()), point_indices.end());
+
+  for (const auto point_idx : point_indices) {
+    const auto & point = obstacle_points_ptr_->points.at(point_idx);
     ObjectData obj;
     obj.stamp = stamp;
     obj.position = tier4_autoware_utils::createPoint(point.x, point.y, point.z);
     obj.velocity = 0.0;
-    const Point2d obj_point(point.x, point.y);
     const double lat_dist = motion_utils::calcLateralOffset(ego_path, obj.position);
     if (lat_dist > 5.0) {
       continue;
     }
-    for (const auto & ego_poly : ego_polys) {
-      if (bg::within(obj_point, ego_poly)) {
-        objects.push_back(obj);
-        break;
-      }
-    }
+    objects.push_back(obj);
   }
 }
 
@@ -29,6 +29,7 @@
 #include <geometry_msgs/msg/twist_stamped.hpp>
 #include <nav_msgs/msg/odometry.hpp>
 
+#include <boost/geometry/index/rtree.hpp>
 #include <boost/optional.hpp>
 
 #include <lanelet2_core/LaneletMap.h>
@@ -36,6 +37,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace lane_departure_checker
@@ -113,8 +115,28 @@ public:
     const lanelet::ConstLanelets & candidate_lanelets, const LinearRing2d & vehicle_footprint);
 
 private:
+  // polygons of lanelets and R-tree of their bounding boxes, which are kept for the same lanelets
+  struct LaneletPolygonIndex
+  {
+    lanelet::ConstLanelets lanelets;
+    std::vector<lanelet::BasicPolygon2d> polygons;
+    boost::geometry::index::rtree<
+      std::pair<tier4_autoware_utils::Box2d, size_t>, boost::geometry::index::rstar<16>>
+      rtree;
+  };
+
   Param param_;
   std::shared_ptr<vehicle_info_util::VehicleInfo> vehicle_info_ptr_;
+  LaneletPolygonIndex route_lanelet_index_;
+  LaneletPolygonIndex shoulder_lanelet_index_;
+
+  static void updateLaneletPolygonIndex(
+    const lanelet::ConstLanelets & lanelets, LaneletPolygonIndex & index);
+
+  static void getCandidateLanelets(
+    const LaneletPolygonIndex & index, const std::vector<LinearRing2d> & vehicle_footprints,
+    lanelet::ConstLanelets & candidate_lanelets,
+    std::vector<lanelet::BasicPolygon2d> & candidate_polygons);
 
   static PoseDeviation calcTrajectoryDeviation(
     const Trajectory & trajectory, const geometry_msgs::msg::Pose & pose,
@@ -134,7 +156,7 @@ private:
     const std::vector<LinearRing2d> & vehicle_footprints);
 
   static bool willLeaveLane(
-    const lanelet::ConstLanelets & candidate_lanelets,
+    const std::vector<lanelet::BasicPolygon2d> & candidate_polygons,
     const std::vector<LinearRing2d> & vehicle_footprints);
 
   static bool willCrossBoundary(
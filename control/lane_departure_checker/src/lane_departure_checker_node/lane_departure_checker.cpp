@@ -28,8 +28,11 @@
 #include <tf2/utils.h>
 
 #include <algorithm>
+#include <iterator>
+#include <utility>
 #include <vector>
 
+using tier4_autoware_utils::Box2d;
 using tier4_autoware_utils::LinearRing2d;
 using tier4_autoware_utils::MultiPoint2d;
 using tier4_autoware_utils::Point2d;
@@ -56,10 +59,11 @@ double calcBrakingDistance(
   return (abs_velocity * abs_velocity) / (2.0 * max_deceleration) + delay_time * abs_velocity;
 }
 
-bool isInAnyLane(const lanelet::ConstLanelets & candidate_lanelets, const Point2d & point)
+bool isInAnyLane(
+  const std::vector<lanelet::BasicPolygon2d> & candidate_polygons, const Point2d & point)
 {
-  for (const auto & ll : candidate_lanelets) {
-    if (boost::geometry::within(point, ll.polygon2d().basicPolygon())) {
+  for (const auto & polygon : candidate_polygons) {
+    if (boost::geometry::within(point, polygon)) {
       return true;
     }
   }
@@ -67,10 +71,39 @@ bool isInAnyLane(const lanelet::ConstLanelets & candidate_lanelets, const Point2
   return false;
 }
 
+bool isFootprintOutOfLane(
+  const std::vector<lanelet::BasicPolygon2d> & candidate_polygons,
+  const LinearRing2d & vehicle_footprint)
+{
+  for (const auto & point : vehicle_footprint) {
+    if (!isInAnyLane(candidate_polygons, point)) {
+      return true;
+    }
+  }
+
+  return false;
+}
+
+template <class T>
+Box2d calcBoundingBox(const T & points)
+{
+  Box2d box;
+  boost::geometry::assign_inverse(box);
+  for (const auto & p : points) {
+    boost::geometry::expand(box, Point2d(p.x(), p.y()));
+  }
+  return box;
+}
+
 bool isCrossingWithBoundary(
   const lanelet::BasicLineString2d & boundary, const std::vector<LinearRing2d> & footprints)
 {
+  const auto boundary_box = calcBoundingBox(boundary);
   for (auto & footprint : footprints) {
+    // a footprint whose bounding box is apart from the boundary cannot cross it
+    if (boost::geometry::disjoint(calcBoundingBox(footprint), boundary_box)) {
+      continue;
+    }
     for (size_t i = 0; i < footprint.size() - 1; ++i) {
       auto footprint1 = footprint.at(i).to_3d();
       auto footprint2 = footprint.at(i + 1).to_3d();
@@ -103,23 +136,6 @@ LinearRing2d createHullFromFootprints(const std::vector<LinearRing2d> & footprin
   return hull;
 }
 
-lanelet::ConstLanelets getCandidateLanelets(
-  const lanelet::ConstLanelets & route_lanelets,
-  const std::vector<LinearRing2d> & vehicle_footprints)
-{
-  lanelet::ConstLanelets candidate_lanelets;
-
-  // Find lanes within the convex hull of footprints
-  const auto footprint_hull = createHullFromFootprints(vehicle_footprints);
-  for (const auto & route_lanelet : route_lanelets) {
-    const auto poly = route_lanelet.polygon2d().basicPolygon();
-    if (!boost::geometry::disjoint(poly, footprint_hull)) {
-      candidate_lanelets.push_back(route_lanelet);
-    }
-  }
-
-  return candidate_lanelets;
-}
 }  // namespace
 
 namespace lane_departure_checker
@@ -155,21 +171,25 @@ Output LaneDepartureChecker::update(const Input & input)
   output.vehicle_passing_areas = createVehiclePassingAreas(output.vehicle_footprints);
   output.processing_time_map["createVehiclePassingAreas"] = stop_watch.toc(true);
 
-  const auto candidate_road_lanelets =
-    getCandidateLanelets(input.route_lanelets, output.vehicle_footprints);
-  const auto candidate_shoulder_lanelets =
-    getCandidateLanelets(input.shoulder_lanelets, output.vehicle_footprints);
-  output.candidate_lanelets = candidate_road_lanelets;
-  output.candidate_lanelets.insert(
-    output.candidate_lanelets.end(), candidate_shoulder_lanelets.begin(),
-    candidate_shoulder_lanelets.end());
-
+  updateLaneletPolygonIndex(input.route_lanelets, route_lanelet_index_);
+  updateLaneletPolygonIndex(input.shoulder_lanelets, shoulder_lanelet_index_);
+  output.processing_time_map["updateLaneletPolygonIndex"] = stop_watch.toc(true);
+
+  // road lanelets first, then shoulder lanelets
+  std::vector<lanelet::BasicPolygon2d> candidate_polygons;
+  getCandidateLanelets(
+    route_lanelet_index_, output.vehicle_footprints, output.candidate_lanelets,
+    candidate_polygons);
+  getCandidateLanelets(
+    shoulder_lanelet_index_, output.vehicle_footprints, output.candidate_lanelets,
+    candidate_polygons);
   output.processing_time_map["getCandidateLanelets"] = stop_watch.toc(true);
 
-  output.will_leave_lane = willLeaveLane(output.candidate_lanelets, output.vehicle_footprints);
+  output.will_leave_lane = willLeaveLane(candidate_polygons, output.vehicle_footprints);
   output.processing_time_map["willLeaveLane"] = stop_watch.toc(true);
 
-  output.is_out_of_lane = isOutOfLane(output.candidate_lanelets, output.vehicle_footprints.front());
+  output.is_out_of_lane =
+    isFootprintOutOfLane(candidate_polygons, output.vehicle_footprints.front());
   output.processing_time_map["isOutOfLane"] = stop_watch.toc(true);
 
   output.will_cross_boundary = willCrossBoundary(
@@ -183,8 +203,75 @@ bool LaneDepartureChecker::checkPathWillLeaveLane(
   const lanelet::ConstLanelets & lanelets, const PathWithLaneId & path) const
 {
   std::vector<LinearRing2d> vehicle_footprints = createVehicleFootprints(path);
-  lanelet::ConstLanelets candidate_lanelets = getCandidateLanelets(lanelets, vehicle_footprints);
-  return willLeaveLane(candidate_lanelets, vehicle_footprints);
+  LaneletPolygonIndex lanelet_index;
+  updateLaneletPolygonIndex(lanelets, lanelet_index);
+  lanelet::ConstLanelets candidate_lanelets;
+  std::vector<lanelet::BasicPolygon2d> candidate_polygons;
+  getCandidateLanelets(lanelet_index, vehicle_footprints, candidate_lanelets, candidate_polygons);
+  return willLeaveLane(candidate_polygons, vehicle_footprints);
+}
+
+void LaneDepartureChecker::updateLaneletPolygonIndex(
+  const lanelet::ConstLanelets & lanelets, LaneletPolygonIndex & index)
+{
+  const auto is_same_lanelets = [&]() {
+    if (lanelets.size() != index.lanelets.size()) {
+      return false;
+    }
+    for (size_t i = 0; i < lanelets.size(); ++i) {
+      if (lanelets.at(i).id() != index.lanelets.at(i).id()) {
+        return false;
+      }
+    }
+    return true;
+  };
+  if (!index.lanelets.empty() && is_same_lanelets()) {
+    return;
+  }
+
+  index.lanelets = lanelets;
+  index.polygons.clear();
+  index.polygons.reserve(lanelets.size());
+  std::vector<std::pair<Box2d, size_t>> boxes;
+  boxes.reserve(lanelets.size());
+  for (size_t i = 0; i < lanelets.size(); ++i) {
+    index.polygons.push_back(lanelets.at(i).polygon2d().basicPolygon());
+    boxes.emplace_back(calcBoundingBox(index.polygons.back()), i);
+  }
+  // packing algorithm
+  index.rtree = decltype(index.rtree)(boxes.begin(), boxes.end());
+}
+
+void LaneDepartureChecker::getCandidateLanelets(
+  const LaneletPolygonIndex & index, const std::vector<LinearRing2d> & vehicle_footprints,
+  lanelet::ConstLanelets & candidate_lanelets,
+  std::vector<lanelet::BasicPolygon2d> & candidate_polygons)
+{
+  // Find lanes within the convex hull of footprints
+  const auto footprint_hull = createHullFromFootprints(vehicle_footprints);
+  if (footprint_hull.empty()) {
+    return;
+  }
+
+  std::vector<std::pair<Box2d, size_t>> query_results;
+  index.rtree.query(
+    boost::geometry::index::intersects(calcBoundingBox(footprint_hull)),
+    std::back_inserter(query_results));
+  // keep the order of the lanelets
+  std::vector<size_t> indices;
+  indices.reserve(query_results.size());
+  for (const auto & result : query_results) {
+    indices.push_back(result.second);
+  }
+  std::sort(indices.begin(), indices.end());
+
+  for (const auto i : indices) {
+    const auto & polygon = index.polygons.at(i);
+    if (!boost::geometry::disjoint(polygon, footprint_hull)) {
+      candidate_lanelets.push_back(index.lanelets.at(i));
+      candidate_polygons.push_back(polygon);
+    }
+  }
 }
 
 PoseDeviation LaneDepartureChecker::calcTrajectoryDeviation(
@@ -310,11 +397,11 @@ std::vector<LinearRing2d> LaneDepartureChecker::createVehiclePassingAreas(
 }
 
 bool LaneDepartureChecker::willLeaveLane(
-  const lanelet::ConstLanelets & candidate_lanelets,
+  const std::vector<lanelet::BasicPolygon2d> & candidate_polygons,
   const std::vector<LinearRing2d> & vehicle_footprints)
 {
   for (const auto & vehicle_footprint : vehicle_footprints) {
-    if (isOutOfLane(candidate_lanelets, vehicle_footprint)) {
+    if (isFootprintOutOfLane(candidate_polygons, vehicle_footprint)) {
       return true;
     }
   }
@@ -325,13 +412,12 @@ bool LaneDepartureChecker::willLeaveLane(
 bool LaneDepartureChecker::isOutOfLane(
   const lanelet::ConstLanelets & candidate_lanelets, const LinearRing2d & vehicle_footprint)
 {
-  for (const auto & point : vehicle_footprint) {
-    if (!isInAnyLane(candidate_lanelets, point)) {
-      return true;
-    }
+  std::vector<lanelet::BasicPolygon2d> candidate_polygons;
+  candidate_polygons.reserve(candidate_lanelets.size());
+  for (const auto & candidate_lanelet : candidate_lanelets) {
+    candidate_polygons.push_back(candidate_lanelet.polygon2d().basicPolygon());
   }
-
-  return false;
+  return isFootprintOutOfLane(candidate_polygons, vehicle_footprint);
 }
 
 bool LaneDepartureChecker::willCrossBoundary(
@@ -17,6 +17,7 @@
 
 #include "mpc_lateral_controller/lowpass_filter.hpp"
 #include "mpc_lateral_controller/mpc_trajectory.hpp"
+#include "mpc_lateral_controller/mpc_utils.hpp"
 #include "mpc_lateral_controller/qp_solver/qp_solver_interface.hpp"
 #include "mpc_lateral_controller/steering_predictor.hpp"
 #include "mpc_lateral_controller/vehicle_model/vehicle_model_interface.hpp"
@@ -40,6 +41,7 @@ namespace autoware::motion::control::mpc_lateral_controller
 
 using autoware_auto_control_msgs::msg::AckermannLateralCommand;
 using autoware_auto_planning_msgs::msg::Trajectory;
+using autoware_auto_planning_msgs::msg::TrajectoryPoint;
 using autoware_auto_vehicle_msgs::msg::SteeringReport;
 using geometry_msgs::msg::Pose;
 using nav_msgs::msg::Odometry;
@@ -217,8 +219,15 @@ private:
   double m_lateral_error_prev = 0.0;   // Previous lateral error for derivative calculation.
   double m_yaw_error_prev = 0.0;       // Previous heading error for derivative calculation.
 
+  VectorXd m_Uex_prev;                // Previous optimized input for the warm start.
+  double m_prediction_dt_prev = 0.0;  // Prediction time step of the previous optimized input.
+
   bool m_is_forward_shift = true;  // Flag indicating if the shift is in the forward direction.
 
+  // Points of the last received trajectory and the interpolator of its conversion.
+  std::vector<TrajectoryPoint> m_raw_trajectory_points;
+  MPCUtils::MPCTrajectoryInterpolator m_raw_trajectory_interpolator;
+
   double m_min_prediction_length = 5.0;  // Minimum prediction distance.
 
   /**
@@ -26,6 +26,7 @@
 #include "tf2_geometry_msgs/tf2_geometry_msgs.hpp"
 #endif
 
+#include "interpolation/spline_interpolation.hpp"
 #include "mpc_lateral_controller/mpc_trajectory.hpp"
 
 #include "autoware_auto_planning_msgs/msg/trajectory.hpp"
@@ -102,6 +103,47 @@ std::pair<bool, MPCTrajectory> resampleMPCTrajectoryByDistance(
   const MPCTrajectory & input, const double resample_interval_dist, const size_t nearest_seg_idx,
   const double ego_offset_to_segment);
 
+/**
+ * @brief interpolator of a trajectory by its arc length. The spline coefficients are calculated at
+ * construction, so that the same trajectory is resampled several times without recalculating them.
+ */
+class MPCTrajectoryInterpolator
+{
+public:
+  MPCTrajectoryInterpolator() = default;
+  explicit MPCTrajectoryInterpolator(const MPCTrajectory & input);
+
+  const MPCTrajectory & getInput() const { return input_; }
+  const std::vector<double> & getArcLength() const { return arc_length_; }
+
+  /**
+   * @brief interpolate the trajectory at the given arc lengths
+   * @param [in] query_arc_length arc lengths of the output points
+   * @return interpolated trajectory
+   */
+  MPCTrajectory interpolate(const std::vector<double> & query_arc_length) const;
+
+private:
+  MPCTrajectory input_;
+  std::vector<double> arc_length_;
+  SplineInterpolation x_;
+  SplineInterpolation y_;
+  SplineInterpolation z_;
+  SplineInterpolation yaw_;
+  SplineInterpolation k_;
+  SplineInterpolation smooth_k_;
+};
+
+/**
+ * @brief resample the trajectory of the given interpolator with the given fixed interval
+ * @param [in] interpolator interpolator of the trajectory to resample
+ * @param [in] resample_interval_dist the desired distance between two successive trajectory points
+ * @return The pair contains the successful flag and the resultant resampled trajectory
+ */
+std::pair<bool, MPCTrajectory> resampleMPCTrajectoryByDistance(
+  const MPCTrajectoryInterpolator & interpolator, const double resample_interval_dist,
+  const size_t nearest_seg_idx, const double ego_offset_to_segment);
+
 /**
  * @brief linearly interpolate the given trajectory assuming a base indexing and a new desired
  * indexing
@@ -46,6 +46,13 @@ public:
     const Eigen::VectorXd & lb, const Eigen::VectorXd & ub, const Eigen::VectorXd & lb_a,
     const Eigen::VectorXd & ub_a, Eigen::VectorXd & u) = 0;
 
+  /**
+   * @brief set the initial guess of the next solve, e.g. the previous solution shifted in time.
+   * It is ignored by the solvers without warm start.
+   * @param [in] u initial guess of the optimal variable vector
+   */
+  virtual void setInitialGuess([[maybe_unused]] const Eigen::VectorXd & u) {}
+
   virtual int64_t getTakenIter() const { return 0; }
   virtual double getRunTime() const { return 0.0; }
   virtual double getObjVal() const { return 0.0; }
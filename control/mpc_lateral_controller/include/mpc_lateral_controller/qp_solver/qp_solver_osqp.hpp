@@ -19,6 +19,8 @@
 #include "osqp_interface/osqp_interface.hpp"
 #include "rclcpp/rclcpp.hpp"
 
+#include <vector>
+
 namespace autoware::motion::control::mpc_lateral_controller
 {
 
@@ -53,6 +55,11 @@ public:
     const Eigen::VectorXd & lb, const Eigen::VectorXd & ub, const Eigen::VectorXd & lb_a,
     const Eigen::VectorXd & ub_a, Eigen::VectorXd & u) override;
 
+  void setInitialGuess(const Eigen::VectorXd & u) override
+  {
+    initial_guess_.assign(u.data(), u.data() + u.size());
+  }
+
   int64_t getTakenIter() const override { return osqpsolver_.getTakenIter(); }
   double getRunTime() const override { return osqpsolver_.getRunTime(); }
   double getObjVal() const override { return osqpsolver_.getObjVal(); }
@@ -60,6 +67,7 @@ public:
 private:
   autoware::common::osqp::OSQPInterface osqpsolver_;
   rclcpp::Logger logger_;
+  std::vector<double> initial_guess_;
 };
 }  // namespace autoware::motion::control::mpc_lateral_controller
 #endif  // MPC_LATERAL_CONTROLLER__QP_SOLVER__QP_SOLVER_OSQP_HPP_
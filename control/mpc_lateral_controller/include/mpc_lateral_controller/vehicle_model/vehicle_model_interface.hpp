@@ -36,6 +36,39 @@ protected:
   double m_curvature;  //!< @brief curvature on the linearized point on path
   double m_wheelbase;  //!< @brief wheelbase of the vehicle [m]
 
+  /**
+   * @brief discrete matrices of the last calculateDiscreteMatrix() call with their inputs
+   */
+  struct DiscreteMatrixCache
+  {
+    bool is_valid{false};
+    double velocity{0.0};
+    double curvature{0.0};
+    double dt{0.0};
+    Eigen::MatrixXd a_d;
+    Eigen::MatrixXd b_d;
+    Eigen::MatrixXd c_d;
+    Eigen::MatrixXd w_d;
+  };
+  DiscreteMatrixCache m_discrete_matrix_cache;
+
+  /**
+   * @brief get the cached discrete matrices if they were calculated with the current velocity,
+   * curvature and the given dt. The consecutive points of a reference trajectory often have the
+   * same velocity and curvature, e.g. on a straight road at a constant speed.
+   * @return true if the matrices are set from the cache
+   */
+  bool getCachedDiscreteMatrix(
+    Eigen::MatrixXd & a_d, Eigen::MatrixXd & b_d, Eigen::MatrixXd & c_d, Eigen::MatrixXd & w_d,
+    const double dt) const;
+
+  /**
+   * @brief cache the discrete matrices calculated with the current velocity, curvature and dt
+   */
+  void cacheDiscreteMatrix(
+    const Eigen::MatrixXd & a_d, const Eigen::MatrixXd & b_d, const Eigen::MatrixXd & c_d,
+    const Eigen::MatrixXd & w_d, const double dt);
+
 public:
   /**
    * @brief constructor
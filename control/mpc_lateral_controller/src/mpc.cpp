@@ -74,8 +74,11 @@ bool MPC::calculateMPC(
     mpc_matrix, x0_delayed, prediction_dt, mpc_resampled_ref_trajectory,
     current_kinematics.twist.twist.linear.x);
   if (!success_opt) {
+    m_Uex_prev.resize(0);
     return fail_warn_throttle("optimization failed. Stop MPC.");
   }
+  m_Uex_prev = Uex;
+  m_prediction_dt_prev = prediction_dt;
 
   // apply filters for the input limitation and low pass filter
   const double u_saturated = std::clamp(Uex(0), -m_steer_lim, m_steer_lim);
@@ -190,11 +193,19 @@ void MPC::setReferenceTrajectory(
   const double ego_offset_to_segment = motion_utils::calcLongitudinalOffsetToSegment(
     trajectory_msg.points, nearest_seg_idx, current_kinematics.pose.pose.position);
 
-  const auto mpc_traj_raw = MPCUtils::convertToMPCTrajectory(trajectory_msg);
+  // the same trajectory is usually received for several control cycles, so its conversion and
+  // spline coefficients are kept until it changes
+  if (trajectory_msg.points != m_raw_trajectory_points) {
+    m_raw_trajectory_interpolator =
+      MPCUtils::MPCTrajectoryInterpolator(MPCUtils::convertToMPCTrajectory(trajectory_msg));
+    m_raw_trajectory_points = trajectory_msg.points;
+  }
+  const auto & mpc_traj_raw = m_raw_trajectory_interpolator.getInput();
 
   // resampling
   const auto [success_resample, mpc_traj_resampled] = MPCUtils::resampleMPCTrajectoryByDistance(
-    mpc_traj_raw, param.traj_resample_dist, nearest_seg_idx, ego_offset_to_segment);
+    m_raw_trajectory_interpolator, param.traj_resample_dist, nearest_seg_idx,
+    ego_offset_to_segment);
   if (!success_resample) {
     warn_throttle("[setReferenceTrajectory] spline error when resampling by distance");
     return;
@@ -497,13 +508,13 @@ MPCMatrix MPC::generateMPCMatrix(
       m.Bex.block(0, 0, DIM_X, DIM_U) = Bd;
       m.Wex.block(0, 0, DIM_X, 1) = Wd;
     } else {
-      m.Aex.block(idx_x_i, 0, DIM_X, DIM_X) = Ad * m.Aex.block(idx_x_i_prev, 0, DIM_X, DIM_X);
-      for (int j = 0; j < i; ++j) {
-        int idx_u_j = j * DIM_U;
-        m.Bex.block(idx_x_i, idx_u_j, DIM_X, DIM_U) =
-          Ad * m.Bex.block(idx_x_i_prev, idx_u_j, DIM_X, DIM_U);
-      }
-      m.Wex.block(idx_x_i, 0, DIM_X, 1) = Ad * m.Wex.block(idx_x_i_prev, 0, DIM_X, 1) + Wd;
+      // NOTE: the blocks of the current step do not overlap the ones of the previous step
+      m.Aex.block(idx_x_i, 0, DIM_X, DIM_X).noalias() =
+        Ad * m.Aex.block(idx_x_i_prev, 0, DIM_X, DIM_X);
+      m.Bex.block(idx_x_i, 0, DIM_X, idx_u_i).noalias() =
+        Ad * m.Bex.block(idx_x_i_prev, 0, DIM_X, idx_u_i);
+      m.Wex.block(idx_x_i, 0, DIM_X, 1).noalias() = Ad * m.Wex.block(idx_x_i_prev, 0, DIM_X, 1);
+      m.Wex.block(idx_x_i, 0, DIM_X, 1) += Wd;
     }
     m.Bex.block(idx_x_i, idx_u_i, DIM_X, DIM_U) = Bd;
     m.Cex.block(idx_y_i, idx_x_i, DIM_Y, DIM_X) = Cd;
@@ -566,18 +577,40 @@ std::pair<bool, VectorXd> MPC::executeOptimization(
     return {false, {}};
   }
 
-  const int DIM_U_N = m_param.prediction_horizon * m_vehicle_model_ptr->getDimU();
+  const int N = m_param.prediction_horizon;
+  const int DIM_X = m_vehicle_model_ptr->getDimX();
+  const int DIM_U = m_vehicle_model_ptr->getDimU();
+  const int DIM_Y = m_vehicle_model_ptr->getDimY();
+  const int DIM_U_N = N * DIM_U;
 
   // cost function: 1/2 * Uex' * H * Uex + f' * Uex,  H = B' * C' * Q * C * B + R
-  const MatrixXd CB = m.Cex * m.Bex;
-  const MatrixXd QCB = m.Qex * CB;
-  // MatrixXd H = CB.transpose() * QCB + m.R1ex + m.R2ex; // This calculation is heavy. looking for
-  // a good way.  //NOLINT
+  // NOTE: Cex and Qex are block diagonal and Bex is block lower triangular, so CB and QCB are also
+  // block lower triangular. The products are calculated only with their non-zero blocks.
+  MatrixXd CB = MatrixXd::Zero(DIM_Y * N, DIM_U_N);
+  MatrixXd QCB = MatrixXd::Zero(DIM_Y * N, DIM_U_N);
+  const VectorXd AW = m.Aex * x0 + m.Wex;
+  VectorXd CAW(DIM_Y * N);
+  for (int i = 0; i < N; ++i) {
+    const auto C = m.Cex.block(i * DIM_Y, i * DIM_X, DIM_Y, DIM_X);
+    const auto Q = m.Qex.block(i * DIM_Y, i * DIM_Y, DIM_Y, DIM_Y);
+    const int cols = (i + 1) * DIM_U;
+    CB.block(i * DIM_Y, 0, DIM_Y, cols).noalias() = C * m.Bex.block(i * DIM_X, 0, DIM_X, cols);
+    QCB.block(i * DIM_Y, 0, DIM_Y, cols).noalias() = Q * CB.block(i * DIM_Y, 0, DIM_Y, cols);
+    CAW.segment(i * DIM_Y, DIM_Y).noalias() = C * AW.segment(i * DIM_X, DIM_X);
+  }
+
+  // the k-th block column of the upper triangle of CB' * QCB only depends on the block rows of CB
+  // and QCB after k since the blocks before k of the k-th block column of QCB are zero
   MatrixXd H = MatrixXd::Zero(DIM_U_N, DIM_U_N);
-  H.triangularView<Eigen::Upper>() = CB.transpose() * QCB;
+  for (int k = 0; k < N; ++k) {
+    const int rows = (N - k) * DIM_Y;
+    H.block(0, k * DIM_U, (k + 1) * DIM_U, DIM_U).noalias() =
+      CB.block(k * DIM_Y, 0, rows, (k + 1) * DIM_U).transpose() *
+      QCB.block(k * DIM_Y, k * DIM_U, rows, DIM_U);
+  }
   H.triangularView<Eigen::Upper>() += m.R1ex + m.R2ex;
   H.triangularView<Eigen::Lower>() = H.transpose();
-  MatrixXd f = (m.Cex * (m.Aex * x0 + m.Wex)).transpose() * QCB - m.Uref_ex.transpose() * m.R1ex;
+  MatrixXd f = CAW.transpose() * QCB - m.Uref_ex.transpose() * m.R1ex;
   addSteerWeightF(prediction_dt, f);
 
   MatrixXd A = MatrixXd::Identity(DIM_U_N, DIM_U_N);
@@ -596,6 +629,23 @@ std::pair<bool, VectorXd> MPC::executeOptimization(
   ubA(0) = m_raw_steer_cmd_prev + steer_rate_limits(0) * m_ctrl_period;
   lbA(0) = m_raw_steer_cmd_prev - steer_rate_limits(0) * m_ctrl_period;
 
+  // warm start with the previous solution shifted by the control period, which is the time
+  // difference between the start of the previous prediction and the current one
+  if (m_Uex_prev.size() == DIM_U_N && m_prediction_dt_prev > 0.0) {
+    VectorXd initial_guess(DIM_U_N);
+    for (int i = 0; i < N; ++i) {
+      const double prev_idx = std::min(
+        (i * prediction_dt + m_ctrl_period) / m_prediction_dt_prev, static_cast<double>(N - 1));
+      const int prev_i0 = static_cast<int>(prev_idx);
+      const int prev_i1 = std::min(prev_i0 + 1, N - 1);
+      const double ratio = prev_idx - prev_i0;
+      initial_guess.segment(i * DIM_U, DIM_U) =
+        (1.0 - ratio) * m_Uex_prev.segment(prev_i0 * DIM_U, DIM_U) +
+        ratio * m_Uex_prev.segment(prev_i1 * DIM_U, DIM_U);
+    }
+    m_qpsolver_ptr->setInitialGuess(initial_guess);
+  }
+
   auto t_start = std::chrono::system_clock::now();
   bool solve_result = m_qpsolver_ptr->solve(H, f.transpose(), A, lb, ub, lbA, ubA, Uex);
   auto t_end = std::chrono::system_clock::now();
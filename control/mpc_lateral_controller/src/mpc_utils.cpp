@@ -93,16 +93,59 @@ std::pair<bool, MPCTrajectory> resampleMPCTrajectoryByDistance(
   const MPCTrajectory & input, const double resample_interval_dist, const size_t nearest_seg_idx,
   const double ego_offset_to_segment)
 {
+  if (input.empty()) {
+    return {true, MPCTrajectory{}};
+  }
+  return resampleMPCTrajectoryByDistance(
+    MPCTrajectoryInterpolator(input), resample_interval_dist, nearest_seg_idx,
+    ego_offset_to_segment);
+}
+
+MPCTrajectoryInterpolator::MPCTrajectoryInterpolator(const MPCTrajectory & input) : input_(input)
+{
+  if (input_.empty()) {
+    return;
+  }
+  calcMPCTrajectoryArcLength(input_, arc_length_);
+
+  x_ = SplineInterpolation(arc_length_, input_.x);
+  y_ = SplineInterpolation(arc_length_, input_.y);
+  z_ = SplineInterpolation(arc_length_, input_.z);
+  yaw_ = SplineInterpolation(arc_length_, input_.yaw);
+  k_ = SplineInterpolation(arc_length_, input_.k);
+  smooth_k_ = SplineInterpolation(arc_length_, input_.smooth_k);
+}
+
+MPCTrajectory MPCTrajectoryInterpolator::interpolate(
+  const std::vector<double> & query_arc_length) const
+{
+  const auto lerp_arc_length = [&](const auto & input_value) {
+    return interpolation::lerp(arc_length_, input_value, query_arc_length);
+  };
+
   MPCTrajectory output;
+  output.x = x_.getSplineInterpolatedValues(query_arc_length);
+  output.y = y_.getSplineInterpolatedValues(query_arc_length);
+  output.z = z_.getSplineInterpolatedValues(query_arc_length);
+  output.yaw = yaw_.getSplineInterpolatedValues(query_arc_length);
+  output.vx = lerp_arc_length(input_.vx);  // must be linear
+  output.k = k_.getSplineInterpolatedValues(query_arc_length);
+  output.smooth_k = smooth_k_.getSplineInterpolatedValues(query_arc_length);
+  output.relative_time = lerp_arc_length(input_.relative_time);  // must be linear
+  return output;
+}
 
-  if (input.empty()) {
-    return {true, output};
+std::pair<bool, MPCTrajectory> resampleMPCTrajectoryByDistance(
+  const MPCTrajectoryInterpolator & interpolator, const double resample_interval_dist,
+  const size_t nearest_seg_idx, const double ego_offset_to_segment)
+{
+  if (interpolator.getInput().empty()) {
+    return {true, MPCTrajectory{}};
   }
-  std::vector<double> input_arclength;
-  calcMPCTrajectoryArcLength(input, input_arclength);
+  const auto & input_arclength = interpolator.getArcLength();
 
   if (input_arclength.empty()) {
-    return {false, output};
+    return {false, MPCTrajectory{}};
   }
 
   std::vector<double> output_arclength;
@@ -121,26 +164,7 @@ std::pair<bool, MPCTrajectory> resampleMPCTrajectoryByDistance(
     output_arclength.push_back(s);
   }
 
-  std::vector<double> input_yaw = input.yaw;
-  convertEulerAngleToMonotonic(input_yaw);
-
-  const auto lerp_arc_length = [&](const auto & input_value) {
-    return interpolation::lerp(input_arclength, input_value, output_arclength);
-  };
-  const auto spline_arc_length = [&](const auto & input_value) {
-    return interpolation::spline(input_arclength, input_value, output_arclength);
-  };
-
-  output.x = spline_arc_length(input.x);
-  output.y = spline_arc_length(input.y);
-  output.z = spline_arc_length(input.z);
-  output.yaw = spline_arc_length(input.yaw);
-  output.vx = lerp_arc_length(input.vx);  // must be linear
-  output.k = spline_arc_length(input.k);
-  output.smooth_k = spline_arc_length(input.smooth_k);
-  output.relative_time = lerp_arc_length(input.relative_time);  // must be linear
-
-  return {true, output};
+  return {true, interpolator.interpolate(output_arclength)};
 }
 
 bool linearInterpMPCTrajectory(
@@ -442,8 +466,11 @@ void extendTrajectoryInYawDirection(
   traj.yaw.back() = yaw;
 
   // get terminal pose
-  const auto autoware_traj = MPCUtils::convertToAutowareTrajectory(traj);
-  auto extended_pose = autoware_traj.points.back().pose;
+  Pose extended_pose;
+  extended_pose.position.x = traj.x.back();
+  extended_pose.position.y = traj.y.back();
+  extended_pose.position.z = traj.z.back();
+  extended_pose.orientation = tier4_autoware_utils::createQuaternionFromYaw(traj.yaw.back());
 
   constexpr double extend_dist = 10.0;
   constexpr double extend_vel = 10.0;
@@ -52,7 +52,14 @@ bool QPSolverOSQP::solve(
   osqpA << Identity, a;
 
   /* execute optimization */
-  auto result = osqpsolver_.optimize(h_mat, osqpA, f, lower_bound, upper_bound);
+  // NOTE: the workspace is kept and warm started when the sparsity pattern is unchanged
+  osqpsolver_.updateProblem(h_mat, osqpA, f, lower_bound, upper_bound);
+  if (static_cast<Eigen::Index>(initial_guess_.size()) == dim_u) {
+    // replace the previous solution with the given initial guess
+    osqpsolver_.setPrimalVariables(initial_guess_);
+  }
+  initial_guess_.clear();
+  auto result = osqpsolver_.optimize();
 
   std::vector<double> U_osqp = std::get<0>(result);
   u = Eigen::Map<Eigen::Matrix<double, Eigen::Dynamic, 1>>(
@@ -42,6 +42,10 @@ void DynamicsBicycleModel::calculateDiscreteMatrix(
    * x[k+1] = a_d*x[k] + b_d*u + w_d
    */
 
+  if (getCachedDiscreteMatrix(a_d, b_d, c_d, w_d, dt)) {
+    return;
+  }
+
   const double vel = std::max(m_velocity, 0.01);
 
   a_d = Eigen::MatrixXd::Zero(m_dim_x, m_dim_x);
@@ -54,10 +58,12 @@ void DynamicsBicycleModel::calculateDiscreteMatrix(
   a_d(3, 2) = (m_lf * m_cf - m_lr * m_cr) / m_iz;
   a_d(3, 3) = -(m_lf * m_lf * m_cf + m_lr * m_lr * m_cr) / (m_iz * vel);
 
-  Eigen::MatrixXd I = Eigen::MatrixXd::Identity(m_dim_x, m_dim_x);
-  Eigen::MatrixXd a_d_inverse = (I - dt * 0.5 * a_d).inverse();
+  // the fixed size matrix is inverted in closed form
+  const Eigen::Matrix4d a = a_d;
+  const Eigen::Matrix4d I = Eigen::Matrix4d::Identity();
+  const Eigen::Matrix4d a_d_inverse = (I - dt * 0.5 * a).inverse();
 
-  a_d = a_d_inverse * (I + dt * 0.5 * a_d);  // bilinear discretization
+  a_d = a_d_inverse * (I + dt * 0.5 * a);  // bilinear discretization
 
   b_d = Eigen::MatrixXd::Zero(m_dim_x, m_dim_u);
   b_d(0, 0) = 0.0;
@@ -77,6 +83,8 @@ void DynamicsBicycleModel::calculateDiscreteMatrix(
   c_d = Eigen::MatrixXd::Zero(m_dim_y, m_dim_x);
   c_d(0, 0) = 1.0;
   c_d(1, 2) = 1.0;
+
+  cacheDiscreteMatrix(a_d, b_d, c_d, w_d, dt);
 }
 
 void DynamicsBicycleModel::calculateReferenceInput(Eigen::MatrixXd & u_ref)
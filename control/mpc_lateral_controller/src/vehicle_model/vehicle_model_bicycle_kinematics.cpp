@@ -30,6 +30,10 @@ void KinematicsBicycleModel::calculateDiscreteMatrix(
   Eigen::MatrixXd & a_d, Eigen::MatrixXd & b_d, Eigen::MatrixXd & c_d, Eigen::MatrixXd & w_d,
   const double dt)
 {
+  if (getCachedDiscreteMatrix(a_d, b_d, c_d, w_d, dt)) {
+    return;
+  }
+
   auto sign = [](double x) { return (x > 0.0) - (x < 0.0); };
 
   /* Linearize delta around delta_r (reference delta) */
@@ -57,11 +61,15 @@ void KinematicsBicycleModel::calculateDiscreteMatrix(
 
   // bilinear discretization for ZOH system
   // no discretization is needed for Cd
-  Eigen::MatrixXd I = Eigen::MatrixXd::Identity(m_dim_x, m_dim_x);
-  const Eigen::MatrixXd i_dt2a_inv = (I - dt * 0.5 * a_d).inverse();
-  a_d = i_dt2a_inv * (I + dt * 0.5 * a_d);
+  // the fixed size matrix is inverted in closed form
+  const Eigen::Matrix3d a = a_d;
+  const Eigen::Matrix3d I = Eigen::Matrix3d::Identity();
+  const Eigen::Matrix3d i_dt2a_inv = (I - dt * 0.5 * a).inverse();
+  a_d = i_dt2a_inv * (I + dt * 0.5 * a);
   b_d = i_dt2a_inv * b_d * dt;
   w_d = i_dt2a_inv * w_d * dt;
+
+  cacheDiscreteMatrix(a_d, b_d, c_d, w_d, dt);
 }
 
 void KinematicsBicycleModel::calculateReferenceInput(Eigen::MatrixXd & u_ref)
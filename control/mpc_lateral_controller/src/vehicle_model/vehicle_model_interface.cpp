@@ -44,4 +44,34 @@ void VehicleModelInterface::setCurvature(const double curvature)
 {
   m_curvature = curvature;
 }
+bool VehicleModelInterface::getCachedDiscreteMatrix(
+  Eigen::MatrixXd & a_d, Eigen::MatrixXd & b_d, Eigen::MatrixXd & c_d, Eigen::MatrixXd & w_d,
+  const double dt) const
+{
+  const auto & cache = m_discrete_matrix_cache;
+  if (
+    !cache.is_valid || cache.velocity != m_velocity || cache.curvature != m_curvature ||
+    cache.dt != dt) {
+    return false;
+  }
+  a_d = cache.a_d;
+  b_d = cache.b_d;
+  c_d = cache.c_d;
+  w_d = cache.w_d;
+  return true;
+}
+void VehicleModelInterface::cacheDiscreteMatrix(
+  const Eigen::MatrixXd & a_d, const Eigen::MatrixXd & b_d, const Eigen::MatrixXd & c_d,
+  const Eigen::MatrixXd & w_d, const double dt)
+{
+  auto & cache = m_discrete_matrix_cache;
+  cache.is_valid = true;
+  cache.velocity = m_velocity;
+  cache.curvature = m_curvature;
+  cache.dt = dt;
+  cache.a_d = a_d;
+  cache.b_d = b_d;
+  cache.c_d = c_d;
+  cache.w_d = w_d;
+}
 }  // namespace autoware::motion::control::mpc_lateral_controller
@@ -24,6 +24,7 @@
 #include <geometry_msgs/msg/twist.hpp>
 #include <sensor_msgs/msg/point_cloud2.hpp>
 
+#include <boost/geometry/index/rtree.hpp>
 #include <boost/optional.hpp>
 
 #include <pcl/point_cloud.h>
@@ -31,11 +32,16 @@
 
 #include <map>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace obstacle_collision_checker
 {
+using tier4_autoware_utils::Box2d;
 using tier4_autoware_utils::LinearRing2d;
+using tier4_autoware_utils::Point2d;
+using PointRtree = boost::geometry::index::rtree<
+  std::pair<Point2d, size_t>, boost::geometry::index::rstar<16>>;
 
 struct Param
 {
@@ -99,7 +105,7 @@ private:
     const std::vector<LinearRing2d> & vehicle_footprints);
 
   static bool hasCollision(
-    const pcl::PointCloud<pcl::PointXYZ> & obstacle_pointcloud,
+    const pcl::PointCloud<pcl::PointXYZ> & obstacle_pointcloud, const PointRtree & rtree,
     const LinearRing2d & vehicle_footprint);
 };
 }  // namespace obstacle_collision_checker
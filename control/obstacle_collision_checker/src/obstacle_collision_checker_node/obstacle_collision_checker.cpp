@@ -22,6 +22,7 @@
 #include <tier4_autoware_utils/system/stop_watch.hpp>
 
 #include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
 
 #include <pcl_conversions/pcl_conversions.h>
 #include <tf2/utils.h>
@@ -32,11 +33,18 @@
 #include <tf2_eigen/tf2_eigen.hpp>
 #endif
 
+#include <algorithm>
 #include <iostream>
+#include <iterator>
+#include <limits>
+#include <utility>
 #include <vector>
 
 namespace
 {
+namespace bg = boost::geometry;
+namespace bgi = boost::geometry::index;
+
 pcl::PointCloud<pcl::PointXYZ> getTransformedPointCloud(
   const sensor_msgs::msg::PointCloud2 & pointcloud_msg,
   const geometry_msgs::msg::Transform & transform)
@@ -56,15 +64,24 @@ pcl::PointCloud<pcl::PointXYZ> filterPointCloudByTrajectory(
   const pcl::PointCloud<pcl::PointXYZ> & pointcloud,
   const autoware_auto_planning_msgs::msg::Trajectory & trajectory, const double radius)
 {
+  std::vector<tier4_autoware_utils::Point2d> trajectory_points;
+  trajectory_points.reserve(trajectory.points.size());
+  for (const auto & trajectory_point : trajectory.points) {
+    trajectory_points.emplace_back(
+      trajectory_point.pose.position.x, trajectory_point.pose.position.y);
+  }
+  const bgi::rtree<tier4_autoware_utils::Point2d, bgi::rstar<16>> rtree(
+    trajectory_points.begin(), trajectory_points.end());
+
   pcl::PointCloud<pcl::PointXYZ> filtered_pointcloud;
   for (const auto & point : pointcloud.points) {
-    for (const auto & trajectory_point : trajectory.points) {
-      const double dx = trajectory_point.pose.position.x - point.x;
-      const double dy = trajectory_point.pose.position.y - point.y;
-      if (std::hypot(dx, dy) < radius) {
-        filtered_pointcloud.points.push_back(point);
-        break;
-      }
+    const tier4_autoware_utils::Box2d search_box(
+      {point.x - radius, point.y - radius}, {point.x + radius, point.y + radius});
+    const auto is_near = [&](const tier4_autoware_utils::Point2d & trajectory_point) {
+      return std::hypot(trajectory_point.x() - point.x, trajectory_point.y() - point.y) < radius;
+    };
+    if (rtree.qbegin(bgi::intersects(search_box) && bgi::satisfies(is_near)) != rtree.qend()) {
+      filtered_pointcloud.points.push_back(point);
     }
   }
   return filtered_pointcloud;
@@ -237,10 +254,19 @@ bool ObstacleCollisionChecker::willCollide(
   const pcl::PointCloud<pcl::PointXYZ> & obstacle_pointcloud,
   const std::vector<LinearRing2d> & vehicle_footprints)
 {
+  // index the points once so that each footprint is checked only with the points around it
+  std::vector<std::pair<tier4_autoware_utils::Point2d, size_t>> points;
+  points.reserve(obstacle_pointcloud.points.size());
+  for (size_t i = 0; i < obstacle_pointcloud.points.size(); ++i) {
+    const auto & point = obstacle_pointcloud.points.at(i);
+    points.emplace_back(tier4_autoware_utils::Point2d{point.x, point.y}, i);
+  }
+  const PointRtree rtree(points.begin(), points.end());
+
   for (size_t i = 1; i < vehicle_footprints.size(); i++) {
     // skip first footprint because surround obstacle checker handle it
     const auto & vehicle_footprint = vehicle_footprints.at(i);
-    if (hasCollision(obstacle_pointcloud, vehicle_footprint)) {
+    if (hasCollision(obstacle_pointcloud, rtree, vehicle_footprint)) {
       RCLCPP_WARN(
         rclcpp::get_logger("obstacle_collision_checker"), "ObstacleCollisionChecker::willCollide");
       return true;
@@ -251,19 +277,25 @@ bool ObstacleCollisionChecker::willCollide(
 }
 
 bool ObstacleCollisionChecker::hasCollision(
-  const pcl::PointCloud<pcl::PointXYZ> & obstacle_pointcloud,
+  const pcl::PointCloud<pcl::PointXYZ> & obstacle_pointcloud, const PointRtree & rtree,
   const LinearRing2d & vehicle_footprint)
 {
-  for (const auto & point : obstacle_pointcloud.points) {
-    if (boost::geometry::within(
-          tier4_autoware_utils::Point2d{point.x, point.y}, vehicle_footprint)) {
-      RCLCPP_WARN(
-        rclcpp::get_logger("obstacle_collision_checker"),
-        "[ObstacleCollisionChecker] Collide to Point x: %f y: %f", point.x, point.y);
-      return true;
+  // the first point of the input order is reported
+  size_t collision_idx = std::numeric_limits<size_t>::max();
+  for (auto itr = rtree.qbegin(bgi::intersects(bg::return_envelope<Box2d>(vehicle_footprint)));
+       itr != rtree.qend(); ++itr) {
+    if (itr->second < collision_idx && bg::within(itr->first, vehicle_footprint)) {
+      collision_idx = itr->second;
     }
   }
+  if (collision_idx == std::numeric_limits<size_t>::max()) {
+    return false;
+  }
 
-  return false;
+  const auto & point = obstacle_pointcloud.points.at(collision_idx);
+  RCLCPP_WARN(
+    rclcpp::get_logger("obstacle_collision_checker"),
+    "[ObstacleCollisionChecker] Collide to Point x: %f y: %f", point.x, point.y);
+  return true;
 }
 }  // namespace obstacle_collision_checker
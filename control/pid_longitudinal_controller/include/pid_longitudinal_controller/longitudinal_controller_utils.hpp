@@ -51,6 +51,12 @@ bool isValidTrajectory(const Trajectory & traj);
 double calcStopDistance(
   const Pose & current_pose, const Trajectory & traj, const double max_dist, const double max_yaw);
 
+/**
+ * @brief calculate distance to stopline from current vehicle position where velocity is 0
+ * @param [in] seg_idx index of the trajectory segment nearest to the current vehicle position
+ */
+double calcStopDistance(const Pose & current_pose, const Trajectory & traj, const size_t seg_idx);
+
 /**
  * @brief calculate pitch angle from estimated current pose
  */
@@ -86,15 +92,12 @@ Quaternion lerpOrientation(const Quaternion & o_from, const Quaternion & o_to, c
  * @brief apply linear interpolation to trajectory point that is nearest to a certain point
  * @param [in] points trajectory points
  * @param [in] point Interpolated point is nearest to this point.
+ * @param [in] seg_idx index of the segment nearest to the point
  */
 template <class T>
-TrajectoryPoint lerpTrajectoryPoint(
-  const T & points, const Pose & pose, const double max_dist, const double max_yaw)
+TrajectoryPoint lerpTrajectoryPoint(const T & points, const Pose & pose, const size_t seg_idx)
 {
   TrajectoryPoint interpolated_point;
-  const size_t seg_idx =
-    motion_utils::findFirstNearestSegmentIndexWithSoftConstraints(points, pose, max_dist, max_yaw);
-
   const double len_to_interpolated =
     motion_utils::calcLongitudinalOffsetToSegment(points, seg_idx, pose.position);
   const double len_segment = motion_utils::calcSignedArcLength(points, seg_idx, seg_idx + 1);
@@ -123,6 +126,20 @@ TrajectoryPoint lerpTrajectoryPoint(
   return interpolated_point;
 }
 
+/**
+ * @brief apply linear interpolation to trajectory point that is nearest to a certain point
+ * @param [in] points trajectory points
+ * @param [in] point Interpolated point is nearest to this point.
+ */
+template <class T>
+TrajectoryPoint lerpTrajectoryPoint(
+  const T & points, const Pose & pose, const double max_dist, const double max_yaw)
+{
+  const size_t seg_idx =
+    motion_utils::findFirstNearestSegmentIndexWithSoftConstraints(points, pose, max_dist, max_yaw);
+  return lerpTrajectoryPoint(points, pose, seg_idx);
+}
+
 /**
  * @brief limit variable whose differential is within a certain value
  * @param [in] input_val current value
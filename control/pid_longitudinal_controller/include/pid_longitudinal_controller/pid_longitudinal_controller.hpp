@@ -72,6 +72,7 @@ private:
   {
     bool is_far_from_trajectory{false};
     size_t nearest_idx{0};  // nearest_idx = 0 when nearest_idx is not found with findNearestIdx
+    size_t nearest_seg_idx{0};
     Motion current_motion{};
     Shift shift{Shift::Forward};  // shift is used only to calculate the sign of pitch compensation
     double stop_dist{0.0};  // signed distance that is positive when car is before the stopline
@@ -204,6 +205,8 @@ private:
 
   // debug values
   DebugValues m_debug_values;
+  size_t m_debug_publish_interval{1};  // number of control cycles between debug publications
+  size_t m_debug_publish_count{0};
 
   std::shared_ptr<rclcpp::Time> m_last_running_time{std::make_shared<rclcpp::Time>(clock_->now())};
 
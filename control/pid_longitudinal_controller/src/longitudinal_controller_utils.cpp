@@ -57,12 +57,17 @@ bool isValidTrajectory(const Trajectory & traj)
 
 double calcStopDistance(
   const Pose & current_pose, const Trajectory & traj, const double max_dist, const double max_yaw)
+{
+  const size_t seg_idx = motion_utils::findFirstNearestSegmentIndexWithSoftConstraints(
+    traj.points, current_pose, max_dist, max_yaw);
+  return calcStopDistance(current_pose, traj, seg_idx);
+}
+
+double calcStopDistance(const Pose & current_pose, const Trajectory & traj, const size_t seg_idx)
 {
   const auto stop_idx_opt = motion_utils::searchZeroVelocityIndex(traj.points);
 
   const size_t end_idx = stop_idx_opt ? *stop_idx_opt : traj.points.size() - 1;
-  const size_t seg_idx = motion_utils::findFirstNearestSegmentIndexWithSoftConstraints(
-    traj.points, current_pose, max_dist, max_yaw);
   const double signed_length_on_traj = motion_utils::calcSignedArcLength(
     traj.points, current_pose.position, seg_idx, traj.points.at(end_idx).pose.position,
     std::min(end_idx, traj.points.size() - 2));
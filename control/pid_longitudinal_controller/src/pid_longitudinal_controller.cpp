@@ -19,6 +19,7 @@
 #include "tier4_autoware_utils/math/normalization.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <memory>
 #include <string>
@@ -43,6 +44,13 @@ PidLongitudinalController::PidLongitudinalController(rclcpp::Node & node)
   // parameters for delay compensation
   m_delay_compensation_time = node.declare_parameter<double>("delay_compensation_time");  // [s]
 
+  // parameters for debug
+  {
+    const double debug_publish_period = node.declare_parameter<double>("debug_publish_period");
+    m_debug_publish_interval = static_cast<size_t>(
+      std::max(std::round(debug_publish_period / m_longitudinal_ctrl_period), 1.0));
+  }
+
   // parameters to enable functions
   m_enable_smooth_stop = node.declare_parameter<bool>("enable_smooth_stop");
   m_enable_overshoot_emergency = node.declare_parameter<bool>("enable_overshoot_emergency");
@@ -444,6 +452,18 @@ PidLongitudinalController::ControlData PidLongitudinalController::getControlData
     return control_data;
   }
   control_data.nearest_idx = nearest_idx;
+  // NOTE: same as findFirstNearestSegmentIndexWithSoftConstraints() without searching again
+  control_data.nearest_seg_idx = [&]() -> size_t {
+    if (nearest_idx == 0) {
+      return 0;
+    }
+    if (nearest_idx == m_trajectory.points.size() - 1) {
+      return m_trajectory.points.size() - 2;
+    }
+    const double signed_length = motion_utils::calcLongitudinalOffsetToSegment(
+      m_trajectory.points, nearest_idx, current_pose.position);
+    return signed_length <= 0 ? nearest_idx - 1 : nearest_idx;
+  }();
 
   // shift
   control_data.shift = getCurrentShift(control_data.nearest_idx);
@@ -453,8 +473,8 @@ PidLongitudinalController::ControlData PidLongitudinalController::getControlData
   m_prev_shift = control_data.shift;
 
   // distance to stopline
-  control_data.stop_dist = longitudinal_utils::calcStopDistance(
-    current_pose, m_trajectory, m_ego_nearest_dist_threshold, m_ego_nearest_yaw_threshold);
+  control_data.stop_dist =
+    longitudinal_utils::calcStopDistance(current_pose, m_trajectory, control_data.nearest_seg_idx);
 
   // pitch
   // NOTE: getPitchByTraj() calculates the pitch angle as defined in
@@ -749,9 +769,14 @@ void PidLongitudinalController::publishDebugData(
   m_debug_values.setValues(DebugValues::TYPE::CONTROL_STATE, static_cast<double>(m_control_state));
   m_debug_values.setValues(DebugValues::TYPE::ACC_CMD_PUBLISHED, ctrl_cmd.acc);
 
-  // publish debug values
+  // publish debug values at the debug publication rate
+  m_debug_publish_count = (m_debug_publish_count + 1) % m_debug_publish_interval;
+  if (m_debug_publish_count != 0) {
+    return;
+  }
   tier4_debug_msgs::msg::Float32MultiArrayStamped debug_msg{};
   debug_msg.stamp = clock_->now();
+  debug_msg.data.reserve(m_debug_values.getValues().size());
   for (const auto & v : m_debug_values.getValues()) {
     debug_msg.data.push_back(static_cast<decltype(debug_msg.data)::value_type>(v));
   }
@@ -1009,7 +1034,12 @@ void PidLongitudinalController::updateDebugVelAcc(
 {
   const double current_vel = control_data.current_motion.vel;
 
-  const auto interpolated_point = calcInterpolatedTargetValue(m_trajectory, current_pose);
+  // NOTE: the segment nearest to the current pose is already known
+  const auto interpolated_point =
+    m_trajectory.points.size() == 1
+      ? m_trajectory.points.at(0)
+      : longitudinal_utils::lerpTrajectoryPoint(
+          m_trajectory.points, current_pose, control_data.nearest_seg_idx);
 
   m_debug_values.setValues(DebugValues::TYPE::CURRENT_VEL, current_vel);
   m_debug_values.setValues(DebugValues::TYPE::TARGET_VEL, target_motion.vel);
@@ -100,6 +100,10 @@ TEST(TestLongitudinalControllerUtils, calcStopDistance)
   point.longitudinal_velocity_mps = 0.0;
   traj.points.push_back(point);
   EXPECT_EQ(longitudinal_utils::calcStopDistance(current_pose, traj, max_dist, max_yaw), 3.0);
+  // with the index of the nearest segment
+  EXPECT_EQ(longitudinal_utils::calcStopDistance(current_pose, traj, size_t{0}), 3.0);
+  current_pose.position.x = 1.5;
+  EXPECT_EQ(longitudinal_utils::calcStopDistance(current_pose, traj, size_t{1}), 1.5);
 }
 
 TEST(TestLongitudinalControllerUtils, getPitchByPose)
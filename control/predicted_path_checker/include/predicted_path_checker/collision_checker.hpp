@@ -32,6 +32,7 @@
 #include <boost/assert.hpp>
 #include <boost/assign/list_of.hpp>
 #include <boost/geometry.hpp>
+#include <boost/geometry/index/rtree.hpp>
 
 #include <tf2_ros/buffer.h>
 #include <tf2_ros/transform_listener.h>
@@ -49,11 +50,15 @@ using autoware_auto_perception_msgs::msg::PredictedObject;
 using autoware_auto_perception_msgs::msg::PredictedObjects;
 using geometry_msgs::msg::Pose;
 using geometry_msgs::msg::TransformStamped;
+using tier4_autoware_utils::Box2d;
 using tier4_autoware_utils::Point2d;
 using tier4_autoware_utils::Polygon2d;
 using PointArray = std::vector<geometry_msgs::msg::Point>;
 
 namespace bg = boost::geometry;
+namespace bgi = boost::geometry::index;
+
+using ObjectPolygonRtree = bgi::rtree<std::pair<Box2d, size_t>, bgi::rstar<16>>;
 
 struct CollisionCheckerParam
 {
@@ -98,6 +103,7 @@ private:
 
   boost::optional<std::pair<geometry_msgs::msg::Point, PredictedObject>> checkDynamicObjects(
     const Pose & base_pose, PredictedObjects::ConstSharedPtr dynamic_objects,
+    const std::vector<Polygon2d> & object_polygons, const ObjectPolygonRtree & object_rtree,
     const Polygon2d & one_step_move_vehicle_polygon2d, const double z_min, const double z_max);
 
   void updatePredictedObjectHistory(const rclcpp::Time & now)
@@ -17,6 +17,8 @@
 #include <rclcpp/logging.hpp>
 #include <tier4_autoware_utils/ros/marker_helper.hpp>
 
+#include <algorithm>
+#include <iterator>
 #include <memory>
 #include <utility>
 #include <vector>
@@ -50,6 +52,21 @@ CollisionChecker::checkTrajectoryForCollision(
     return boost::none;
   }
 
+  // convert the objects to polygons once, and index their bounding boxes so that each step of the
+  // trajectory is checked only with the objects around it
+  std::vector<Polygon2d> object_polygons;
+  std::vector<std::pair<Box2d, size_t>> object_boxes;
+  object_polygons.reserve(dynamic_objects->objects.size());
+  object_boxes.reserve(dynamic_objects->objects.size());
+  for (const auto & obj : dynamic_objects->objects) {
+    object_polygons.push_back(utils::convertObjToPolygon(obj));
+    if (!object_polygons.back().outer().empty()) {
+      object_boxes.emplace_back(
+        bg::return_envelope<Box2d>(object_polygons.back()), object_polygons.size() - 1);
+    }
+  }
+  const ObjectPolygonRtree object_rtree(object_boxes.begin(), object_boxes.end());
+
   for (size_t i = 0; i < predicted_trajectory_array.size() - 1; i++) {
     // create one step circle center for vehicle
     const auto & p_front = predicted_trajectory_array.at(i).pose;
@@ -74,7 +91,9 @@ CollisionChecker::checkTrajectoryForCollision(
       checkObstacleHistory(p_front, one_step_move_vehicle_polygon2d, z_min, z_max);
 
     auto found_collision_at_dynamic_objects =
-      checkDynamicObjects(p_front, dynamic_objects, one_step_move_vehicle_polygon2d, z_min, z_max);
+      checkDynamicObjects(
+        p_front, dynamic_objects, object_polygons, object_rtree, one_step_move_vehicle_polygon2d,
+        z_min, z_max);
 
     if (found_collision_at_dynamic_objects || found_collision_at_history) {
       double distance_to_current = std::numeric_limits<double>::max();
@@ -155,28 +174,38 @@ CollisionChecker::checkObstacleHistory(
 boost::optional<std::pair<geometry_msgs::msg::Point, PredictedObject>>
 CollisionChecker::checkDynamicObjects(
   const Pose & base_pose, PredictedObjects::ConstSharedPtr dynamic_objects,
+  const std::vector<Polygon2d> & object_polygons, const ObjectPolygonRtree & object_rtree,
   const Polygon2d & one_step_move_vehicle_polygon2d, const double z_min, const double z_max)
 {
   if (dynamic_objects->objects.empty()) {
     return boost::none;
   }
+
+  // the candidates are sorted to check the objects in the same order as the input
+  std::vector<std::pair<Box2d, size_t>> candidates;
+  object_rtree.query(
+    bgi::intersects(bg::return_envelope<Box2d>(one_step_move_vehicle_polygon2d)),
+    std::back_inserter(candidates));
+  std::vector<size_t> candidate_indices;
+  candidate_indices.reserve(candidates.size());
+  for (const auto & candidate : candidates) {
+    candidate_indices.push_back(candidate.second);
+  }
+  std::sort(candidate_indices.begin(), candidate_indices.end());
+
   double min_norm_collision_norm = 0.0;
   bool is_init = false;
   size_t nearest_collision_object_index = 0;
   geometry_msgs::msg::Point nearest_collision_point;
 
-  for (size_t i = 0; i < dynamic_objects->objects.size(); ++i) {
+  for (const auto i : candidate_indices) {
     const auto & obj = dynamic_objects->objects.at(i);
     if (param_.enable_z_axis_obstacle_filtering) {
       if (!utils::intersectsInZAxis(obj, z_min, z_max)) {
         continue;
       }
     }
-    const auto object_polygon = utils::convertObjToPolygon(obj);
-    if (object_polygon.outer().empty()) {
-      // unsupported type
-      continue;
-    }
+    const auto & object_polygon = object_polygons.at(i);
 
     const auto found_collision_points =
       bg::intersects(one_step_move_vehicle_polygon2d, object_polygon);
@@ -216,7 +245,7 @@ CollisionChecker::checkDynamicObjects(
   }
   if (is_init) {
     const auto & obj = dynamic_objects->objects.at(nearest_collision_object_index);
-    const auto obstacle_polygon = utils::convertObjToPolygon(obj);
+    const auto & obstacle_polygon = object_polygons.at(nearest_collision_object_index);
     if (param_.enable_z_axis_obstacle_filtering) {
       debug_ptr_->pushPolyhedron(obstacle_polygon, z_min, z_max, PolygonType::Collision);
     } else {
@@ -15,11 +15,13 @@
 #ifndef TRAJECTORY_FOLLOWER_NODE__CONTROLLER_NODE_HPP_
 #define TRAJECTORY_FOLLOWER_NODE__CONTROLLER_NODE_HPP_
 
+#include "diagnostic_updater/diagnostic_updater.hpp"
 #include "rclcpp/rclcpp.hpp"
 #include "tf2/utils.h"
 #include "tf2_ros/buffer.h"
 #include "tf2_ros/transform_listener.h"
 #include "tier4_autoware_utils/ros/logger_level_configure.hpp"
+#include "tier4_autoware_utils/ros/realtime_configure.hpp"
 #include "tier4_autoware_utils/system/stop_watch.hpp"
 #include "trajectory_follower_base/lateral_controller_base.hpp"
 #include "trajectory_follower_base/longitudinal_controller_base.hpp"
@@ -69,7 +71,9 @@ public:
 
 private:
   rclcpp::TimerBase::SharedPtr timer_control_;
+  double ctrl_period_;
   double timeout_thr_sec_;
+  bool enable_parallel_control_;
   boost::optional<LongitudinalOutput> longitudinal_output_{boost::none};
 
   std::shared_ptr<trajectory_follower::LongitudinalControllerBase> longitudinal_controller_;
@@ -107,6 +111,7 @@ private:
    */
   boost::optional<trajectory_follower::InputData> createInputData(rclcpp::Clock & clock) const;
   void callbackTimerControl();
+  void onTimerControl();
   void onTrajectory(const autoware_auto_planning_msgs::msg::Trajectory::SharedPtr);
   void onOdometry(const nav_msgs::msg::Odometry::SharedPtr msg);
   void onSteering(const autoware_auto_vehicle_msgs::msg::SteeringReport::SharedPtr msg);
@@ -120,6 +125,14 @@ private:
     const trajectory_follower::LateralOutput & lat_out) const;
 
   std::unique_ptr<tier4_autoware_utils::LoggerLevelConfigure> logger_configure_;
+  std::unique_ptr<tier4_autoware_utils::RealtimeConfigure> realtime_configure_;
+
+  // deadline monitoring of the control cycles
+  diagnostic_updater::Updater diagnostic_updater_{this};
+  boost::optional<rclcpp::Time> prev_control_time_{boost::none};
+  size_t deadline_miss_count_{0};
+  size_t reported_deadline_miss_count_{0};
+  void checkControlDeadline(diagnostic_updater::DiagnosticStatusWrapper & stat);
 
   void publishProcessingTime(
     const double t_ms, const rclcpp::Publisher<Float64Stamped>::SharedPtr pub);
@@ -20,6 +20,7 @@
 #include "tier4_autoware_utils/ros/marker_helper.hpp"
 
 #include <algorithm>
+#include <future>
 #include <limits>
 #include <memory>
 #include <string>
@@ -32,8 +33,9 @@ Controller::Controller(const rclcpp::NodeOptions & node_options) : Node("control
 {
   using std::placeholders::_1;
 
-  const double ctrl_period = declare_parameter<double>("ctrl_period");
+  ctrl_period_ = declare_parameter<double>("ctrl_period");
   timeout_thr_sec_ = declare_parameter<double>("timeout_thr_sec");
+  enable_parallel_control_ = declare_parameter<bool>("enable_parallel_control");
 
   const auto lateral_controller_mode =
     getLateralControllerMode(declare_parameter<std::string>("lateral_controller_mode"));
@@ -85,12 +87,16 @@ Controller::Controller(const rclcpp::NodeOptions & node_options) : Node("control
   // Timer
   {
     const auto period_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
-      std::chrono::duration<double>(ctrl_period));
+      std::chrono::duration<double>(ctrl_period_));
     timer_control_ = rclcpp::create_timer(
-      this, get_clock(), period_ns, std::bind(&Controller::callbackTimerControl, this));
+      this, get_clock(), period_ns, std::bind(&Controller::onTimerControl, this));
   }
 
+  diagnostic_updater_.setHardwareID("trajectory_follower_node");
+  diagnostic_updater_.add("control_deadline", this, &Controller::checkControlDeadline);
+
   logger_configure_ = std::make_unique<tier4_autoware_utils::LoggerLevelConfigure>(this);
+  realtime_configure_ = std::make_unique<tier4_autoware_utils::RealtimeConfigure>(this);
 }
 
 Controller::LateralControllerMode Controller::getLateralControllerMode(
@@ -188,6 +194,39 @@ boost::optional<trajectory_follower::InputData> Controller::createInputData(
   return input_data;
 }
 
+void Controller::onTimerControl()
+{
+  // A control cycle misses its deadline when it starts later than the end of the next period of
+  // the previous cycle, or when it takes longer than the control period.
+  const auto start_time = this->now();
+  if (prev_control_time_ && (start_time - *prev_control_time_).seconds() > 2.0 * ctrl_period_) {
+    ++deadline_miss_count_;
+  }
+  prev_control_time_ = start_time;
+
+  callbackTimerControl();
+
+  if ((this->now() - start_time).seconds() > ctrl_period_) {
+    ++deadline_miss_count_;
+  }
+}
+
+void Controller::checkControlDeadline(diagnostic_updater::DiagnosticStatusWrapper & stat)
+{
+  using diagnostic_msgs::msg::DiagnosticStatus;
+
+  const size_t recent_deadline_miss_count = deadline_miss_count_ - reported_deadline_miss_count_;
+  reported_deadline_miss_count_ = deadline_miss_count_;
+
+  stat.add("deadline_miss_count", deadline_miss_count_);
+  stat.add("recent_deadline_miss_count", recent_deadline_miss_count);
+  if (recent_deadline_miss_count > 0) {
+    stat.summary(DiagnosticStatus::WARN, "control cycle missed its deadline");
+  } else {
+    stat.summary(DiagnosticStatus::OK, "OK");
+  }
+}
+
 void Controller::callbackTimerControl()
 {
   // 1. create input data
@@ -209,13 +248,33 @@ void Controller::callbackTimerControl()
   }
 
   // 3. run controllers
-  stop_watch_.tic("lateral");
-  const auto lat_out = lateral_controller_->run(*input_data);
-  publishProcessingTime(stop_watch_.toc("lateral"), pub_processing_time_lat_ms_);
-
-  stop_watch_.tic("longitudinal");
-  const auto lon_out = longitudinal_controller_->run(*input_data);
-  publishProcessingTime(stop_watch_.toc("longitudinal"), pub_processing_time_lon_ms_);
+  // NOTE: the controllers only exchange their sync data after both of them have run, so they can
+  // run concurrently without any lock.
+  const auto run_lateral_controller = [&]() {
+    const auto lat_out = lateral_controller_->run(*input_data);
+    publishProcessingTime(stop_watch_.toc("lateral"), pub_processing_time_lat_ms_);
+    return lat_out;
+  };
+  const auto run_longitudinal_controller = [&]() {
+    const auto lon_out = longitudinal_controller_->run(*input_data);
+    publishProcessingTime(stop_watch_.toc("longitudinal"), pub_processing_time_lon_ms_);
+    return lon_out;
+  };
+
+  LateralOutput lat_out;
+  LongitudinalOutput lon_out;
+  if (enable_parallel_control_) {
+    stop_watch_.tic("lateral");
+    stop_watch_.tic("longitudinal");
+    auto lat_out_future = std::async(std::launch::async, run_lateral_controller);
+    lon_out = run_longitudinal_controller();
+    lat_out = lat_out_future.get();
+  } else {
+    stop_watch_.tic("lateral");
+    lat_out = run_lateral_controller();
+    stop_watch_.tic("longitudinal");
+    lon_out = run_longitudinal_controller();
+  }
 
   // 4. sync with each other controllers
   longitudinal_controller_->sync(lat_out.sync_data);
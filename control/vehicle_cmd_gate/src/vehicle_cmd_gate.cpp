@@ -242,6 +242,7 @@ VehicleCmdGate::VehicleCmdGate(const rclcpp::NodeOptions & node_options)
     this, get_clock(), period_ns, std::bind(&VehicleCmdGate::publishStatus, this));
 
   logger_configure_ = std::make_unique<tier4_autoware_utils::LoggerLevelConfigure>(this);
+  realtime_configure_ = std::make_unique<tier4_autoware_utils::RealtimeConfigure>(this);
 }
 
 bool VehicleCmdGate::isHeartbeatTimeout(
@@ -440,9 +441,11 @@ void VehicleCmdGate::publishControlCommands(const Commands & commands)
   }
 
   // Check if command filtering option is enable
+  IsFilterActivated is_filter_activated;
   if (enable_cmd_limit_filter_) {
     // Apply limit filtering
-    filtered_commands.control = filterControlCommand(filtered_commands.control);
+    filtered_commands.control =
+      filterControlCommand(filtered_commands.control, is_filter_activated);
   }
   // tmp: Publish vehicle emergency status
   VehicleEmergencyStamped vehicle_cmd_emergency;
@@ -455,6 +458,12 @@ void VehicleCmdGate::publishControlCommands(const Commands & commands)
   adapi_pause_->publish();
   moderate_stop_interface_->publish();
 
+  // Publish the filter status after the commands not to delay them
+  if (enable_cmd_limit_filter_) {
+    is_filter_activated_pub_->publish(is_filter_activated);
+    publishMarkers(is_filter_activated);
+  }
+
   // Save ControlCmd to steering angle when disengaged
   prev_control_cmd_ = filtered_commands.control;
 }
@@ -521,7 +530,8 @@ void VehicleCmdGate::publishStatus()
   moderate_stop_interface_->publish();
 }
 
-AckermannControlCommand VehicleCmdGate::filterControlCommand(const AckermannControlCommand & in)
+AckermannControlCommand VehicleCmdGate::filterControlCommand(
+  const AckermannControlCommand & in, IsFilterActivated & is_filter_activated)
 {
   AckermannControlCommand out = in;
   const double dt = getDt();
@@ -533,7 +543,7 @@ AckermannControlCommand VehicleCmdGate::filterControlCommand(const AckermannCont
   filter_.setCurrentSpeed(current_kinematics_.twist.twist.linear.x);
   filter_on_transition_.setCurrentSpeed(current_kinematics_.twist.twist.linear.x);
 
-  IsFilterActivated is_filter_activated;
+  is_filter_activated = IsFilterActivated{};
 
   // Apply transition_filter when transiting from MANUAL to AUTO.
   if (mode.is_in_transition) {
@@ -578,8 +588,6 @@ AckermannControlCommand VehicleCmdGate::filterControlCommand(const AckermannCont
   filter_on_transition_.setPrevCmd(prev_values);
 
   is_filter_activated.stamp = now();
-  is_filter_activated_pub_->publish(is_filter_activated);
-  publishMarkers(is_filter_activated);
 
   return out;
 }
@@ -796,6 +804,7 @@ MarkerArray VehicleCmdGate::createMarkerArray(const IsFilterActivated & filter_a
 
 void VehicleCmdGate::publishMarkers(const IsFilterActivated & filter_activated)
 {
+  const auto marker_array = createMarkerArray(filter_activated);
   BoolStamped filter_activated_flag;
   if (filter_activated.is_activated) {
     filter_activated_count_++;
@@ -806,7 +815,7 @@ void VehicleCmdGate::publishMarkers(const IsFilterActivated & filter_activated)
     filter_activated_count_ >= filter_activated_count_threshold_ &&
     std::fabs(current_kinematics_.twist.twist.linear.x) >= filter_activated_velocity_threshold_ &&
     current_operation_mode_.mode == OperationModeState::AUTONOMOUS) {
-    filter_activated_marker_pub_->publish(createMarkerArray(filter_activated));
+    filter_activated_marker_pub_->publish(marker_array);
     filter_activated_flag.data = true;
   } else {
     filter_activated_flag.data = false;
@@ -814,7 +823,7 @@ void VehicleCmdGate::publishMarkers(const IsFilterActivated & filter_activated)
 
   filter_activated_flag.stamp = now();
   filter_activated_flag_pub_->publish(filter_activated_flag);
-  filter_activated_marker_raw_pub_->publish(createMarkerArray(filter_activated));
+  filter_activated_marker_raw_pub_->publish(marker_array);
 }
 }  // namespace vehicle_cmd_gate
 
@@ -18,6 +18,7 @@
 #include "adapi_pause_interface.hpp"
 #include "moderate_stop_interface.hpp"
 #include "tier4_autoware_utils/ros/logger_level_configure.hpp"
+#include "tier4_autoware_utils/ros/realtime_configure.hpp"
 #include "vehicle_cmd_filter.hpp"
 
 #include <diagnostic_updater/diagnostic_updater.hpp>
@@ -227,7 +228,8 @@ private:
   AckermannControlCommand getActualStatusAsCommand();
 
   VehicleCmdFilter filter_;
-  AckermannControlCommand filterControlCommand(const AckermannControlCommand & msg);
+  AckermannControlCommand filterControlCommand(
+    const AckermannControlCommand & msg, IsFilterActivated & is_filter_activated);
 
   // filtering on transition
   OperationModeState current_operation_mode_;
@@ -246,6 +248,7 @@ private:
   void publishMarkers(const IsFilterActivated & filter_activated);
 
   std::unique_ptr<tier4_autoware_utils::LoggerLevelConfigure> logger_configure_;
+  std::unique_ptr<tier4_autoware_utils::RealtimeConfigure> realtime_configure_;
 };
 
 }  // namespace vehicle_cmd_gate
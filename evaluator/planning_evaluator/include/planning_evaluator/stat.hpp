@@ -12,6 +12,7 @@
 // See the License for the specific language governing permissions and
 // limitations under the License.
 
+#include <cmath>
 #include <iostream>
 #include <limits>
 
@@ -21,7 +22,8 @@
 namespace planning_diagnostics
 {
 /**
- * @brief class to incrementally build statistics
+ * @brief class to incrementally build statistics in a single pass over the values
+ * @details the mean and the variance are updated with Welford's algorithm
  * @typedef T type of the values (default to double)
  */
 template <typename T = double>
@@ -41,7 +43,9 @@ public:
       max_ = value;
     }
     ++count_;
-    mean_ = mean_ + (value - mean_) / count_;
+    const long double delta = value - mean_;
+    mean_ = mean_ + delta / count_;
+    squared_deviation_sum_ += delta * (value - mean_);
   }
 
   /**
@@ -49,6 +53,16 @@ public:
    */
   long double mean() const { return mean_; }
 
+  /**
+   * @brief get the population variance
+   */
+  long double variance() const { return count_ == 0 ? 0.0 : squared_deviation_sum_ / count_; }
+
+  /**
+   * @brief get the population standard deviation
+   */
+  long double stddev() const { return std::sqrt(variance()); }
+
   /**
    * @brief get the minimum value
    */
@@ -69,8 +83,9 @@ public:
 
 private:
   T min_ = std::numeric_limits<T>::max();
-  T max_ = std::numeric_limits<T>::min();
+  T max_ = std::numeric_limits<T>::lowest();
   long double mean_ = 0.0;
+  long double squared_deviation_sum_ = 0.0;
   unsigned int count_ = 0;
 };
 
@@ -17,11 +17,10 @@
 #include "motion_utils/trajectory/trajectory.hpp"
 #include "tier4_autoware_utils/geometry/geometry.hpp"
 
-#include <Eigen/Core>
-
 #include "autoware_auto_planning_msgs/msg/trajectory_point.hpp"
 
 #include <algorithm>
+#include <vector>
 
 namespace planning_diagnostics
 {
@@ -37,23 +36,26 @@ Stat<double> calcFrechetDistance(const Trajectory & traj1, const Trajectory & tr
     return stat;
   }
 
-  Eigen::MatrixXd ca = Eigen::MatrixXd::Zero(traj1.points.size(), traj2.points.size());
+  // only the previous row of the coupling matrix is needed to calculate the current row
+  std::vector<double> prev_ca(traj2.points.size());
+  std::vector<double> ca(traj2.points.size());
 
   for (size_t i = 0; i < traj1.points.size(); ++i) {
     for (size_t j = 0; j < traj2.points.size(); ++j) {
       const double dist = tier4_autoware_utils::calcDistance2d(traj1.points[i], traj2.points[j]);
       if (i > 0 && j > 0) {
-        ca(i, j) = std::max(std::min(ca(i - 1, j), std::min(ca(i - 1, j - 1), ca(i, j - 1))), dist);
+        ca[j] = std::max(std::min(prev_ca[j], std::min(prev_ca[j - 1], ca[j - 1])), dist);
       } else if (i > 0 /*&& j == 0*/) {
-        ca(i, j) = std::max(ca(i - 1, 0), dist);
+        ca[j] = std::max(prev_ca[0], dist);
       } else if (j > 0 /*&& i == 0*/) {
-        ca(i, j) = std::max(ca(0, j - 1), dist);
+        ca[j] = std::max(ca[j - 1], dist);
       } else { /* i == j == 0 */
-        ca(i, j) = dist;
+        ca[j] = dist;
       }
     }
+    std::swap(prev_ca, ca);
   }
-  stat.add(ca(traj1.points.size() - 1, traj2.points.size() - 1));
+  stat.add(prev_ca.back());
   return stat;
 }
 
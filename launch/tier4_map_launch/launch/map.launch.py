@@ -95,6 +95,8 @@ def launch_setup(context, *args, **kwargs):
             ("service/get_partial_pcd_map", "/map/get_partial_pointcloud_map"),
             ("service/get_differential_pcd_map", "/map/get_differential_pointcloud_map"),
             ("service/get_selected_pcd_map", "/map/get_selected_pointcloud_map"),
+            ("input/vector_map", "vector_map"),
+            ("input/route", "/planning/mission_planning/route"),
         ],
         parameters=[
             {"pcd_paths_or_directory": ["[", LaunchConfiguration("pointcloud_map_path"), "]"]},
@@ -40,9 +40,9 @@ EKFModule::EKFModule(std::shared_ptr<Warning> warning, const HyperParameters par
   dim_x_(6),  // x, y, yaw, yaw_bias, vx, wz
   params_(params)
 {
-  Eigen::MatrixXd X = Eigen::MatrixXd::Zero(dim_x_, 1);
-  Eigen::MatrixXd P = Eigen::MatrixXd::Identity(dim_x_, dim_x_) * 1.0E15;  // for x & y
-  P(IDX::YAW, IDX::YAW) = 50.0;                                            // for yaw
+  Vector6d X = Vector6d::Zero();
+  Matrix6d P = Matrix6d::Identity() * 1.0E15;  // for x & y
+  P(IDX::YAW, IDX::YAW) = 50.0;                // for yaw
   if (params_.enable_yaw_bias_estimation) {
     P(IDX::YAWB, IDX::YAWB) = 50.0;  // for yaw bias
   }
@@ -55,8 +55,8 @@ EKFModule::EKFModule(std::shared_ptr<Warning> warning, const HyperParameters par
 void EKFModule::initialize(
   const PoseWithCovariance & initial_pose, const geometry_msgs::msg::TransformStamped & transform)
 {
-  Eigen::MatrixXd X(dim_x_, 1);
-  Eigen::MatrixXd P = Eigen::MatrixXd::Zero(dim_x_, dim_x_);
+  Vector6d X;
+  Matrix6d P = Matrix6d::Zero();
 
   X(IDX::X) = initial_pose.pose.pose.position.x + transform.transform.translation.x;
   X(IDX::Y) = initial_pose.pose.pose.position.y + transform.transform.translation.y;
@@ -133,8 +133,7 @@ double EKFModule::getYawBias() const
 
 void EKFModule::predictWithDelay(const double dt)
 {
-  const Eigen::MatrixXd X_curr = kalman_filter_.getLatestX();
-  const Eigen::MatrixXd P_curr = kalman_filter_.getLatestP();
+  const Vector6d X_curr = kalman_filter_.getLatestX();
 
   const double proc_cov_vx_d = std::pow(params_.proc_stddev_vx_c * dt, 2.0);
   const double proc_cov_wz_d = std::pow(params_.proc_stddev_wz_c * dt, 2.0);
@@ -157,7 +156,7 @@ bool EKFModule::measurementUpdatePose(
         pose.header.frame_id.c_str(), params_.pose_frame_id.c_str()),
       2000);
   }
-  const Eigen::MatrixXd X_curr = kalman_filter_.getLatestX();
+  const Vector6d X_curr = kalman_filter_.getLatestX();
   DEBUG_PRINT_MAT(X_curr.transpose());
 
   constexpr int dim_y = 3;  // pos_x, pos_y, yaw, depending on Pose output
@@ -188,7 +187,7 @@ bool EKFModule::measurementUpdatePose(
   yaw = yaw_error + ekf_yaw;
 
   /* Set measurement matrix */
-  Eigen::MatrixXd y(dim_y, 1);
+  Eigen::Matrix<double, dim_y, 1> y;
   y << pose.pose.pose.position.x, pose.pose.pose.position.y, yaw;
 
   if (hasNan(y) || hasInf(y)) {
@@ -201,8 +200,8 @@ bool EKFModule::measurementUpdatePose(
   const Eigen::Vector3d y_ekf(
     kalman_filter_.getXelement(delay_step * dim_x_ + IDX::X),
     kalman_filter_.getXelement(delay_step * dim_x_ + IDX::Y), ekf_yaw);
-  const Eigen::MatrixXd P_curr = kalman_filter_.getLatestP();
-  const Eigen::MatrixXd P_y = P_curr.block(0, 0, dim_y, dim_y);
+  const Matrix6d P_curr = kalman_filter_.getLatestP();
+  const Eigen::Matrix3d P_y = P_curr.block<dim_y, dim_y>(0, 0);
 
   const double distance = mahalanobis(y_ekf, y, P_y);
   pose_diag_info.mahalanobis_distance = std::max(distance, pose_diag_info.mahalanobis_distance);
@@ -224,7 +223,7 @@ bool EKFModule::measurementUpdatePose(
   kalman_filter_.updateWithDelay(y, C, R, delay_step);
 
   // debug
-  const Eigen::MatrixXd X_result = kalman_filter_.getLatestX();
+  const Vector6d X_result = kalman_filter_.getLatestX();
   DEBUG_PRINT_MAT(X_result.transpose());
   DEBUG_PRINT_MAT((X_result - X_curr).transpose());
 
@@ -250,7 +249,7 @@ bool EKFModule::measurementUpdateTwist(
     warning_->warnThrottle("twist frame_id must be base_link", 2000);
   }
 
-  const Eigen::MatrixXd X_curr = kalman_filter_.getLatestX();
+  const Vector6d X_curr = kalman_filter_.getLatestX();
   DEBUG_PRINT_MAT(X_curr.transpose());
 
   constexpr int dim_y = 2;  // vx, wz
@@ -274,7 +273,7 @@ bool EKFModule::measurementUpdateTwist(
   }
 
   /* Set measurement matrix */
-  Eigen::MatrixXd y(dim_y, 1);
+  Eigen::Matrix<double, dim_y, 1> y;
   y << twist.twist.twist.linear.x, twist.twist.twist.angular.z;
 
   if (hasNan(y) || hasInf(y)) {
@@ -286,8 +285,8 @@ bool EKFModule::measurementUpdateTwist(
   const Eigen::Vector2d y_ekf(
     kalman_filter_.getXelement(delay_step * dim_x_ + IDX::VX),
     kalman_filter_.getXelement(delay_step * dim_x_ + IDX::WZ));
-  const Eigen::MatrixXd P_curr = kalman_filter_.getLatestP();
-  const Eigen::MatrixXd P_y = P_curr.block(4, 4, dim_y, dim_y);
+  const Matrix6d P_curr = kalman_filter_.getLatestP();
+  const Eigen::Matrix2d P_y = P_curr.block<dim_y, dim_y>(4, 4);
 
   const double distance = mahalanobis(y_ekf, y, P_y);
   twist_diag_info.mahalanobis_distance = std::max(distance, twist_diag_info.mahalanobis_distance);
@@ -309,7 +308,7 @@ bool EKFModule::measurementUpdateTwist(
   kalman_filter_.updateWithDelay(y, C, R, delay_step);
 
   // debug
-  const Eigen::MatrixXd X_result = kalman_filter_.getLatestX();
+  const Vector6d X_result = kalman_filter_.getLatestX();
   DEBUG_PRINT_MAT(X_result.transpose());
   DEBUG_PRINT_MAT((X_result - X_curr).transpose());
 
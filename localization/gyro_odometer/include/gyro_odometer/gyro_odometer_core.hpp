@@ -32,7 +32,6 @@
 #include <tf2_geometry_msgs/tf2_geometry_msgs.hpp>
 #endif
 
-#include <deque>
 #include <memory>
 #include <string>
 
@@ -50,6 +49,8 @@ private:
     const geometry_msgs::msg::TwistWithCovarianceStamped::ConstSharedPtr vehicle_twist_msg_ptr);
   void callbackImu(const sensor_msgs::msg::Imu::ConstSharedPtr imu_msg_ptr);
   void publishData(const geometry_msgs::msg::TwistWithCovarianceStamped & twist_with_cov_raw);
+  geometry_msgs::msg::TwistWithCovarianceStamped concatGyroAndOdometer() const;
+  void clearSums();
 
   rclcpp::Subscription<geometry_msgs::msg::TwistWithCovarianceStamped>::SharedPtr
     vehicle_twist_sub_;
@@ -71,8 +72,25 @@ private:
 
   bool vehicle_twist_arrived_;
   bool imu_arrived_;
-  std::deque<geometry_msgs::msg::TwistWithCovarianceStamped> vehicle_twist_queue_;
-  std::deque<sensor_msgs::msg::Imu> gyro_queue_;
+
+  // NOTE: only the means and the latest stamps of the messages since the last publication are
+  // used, so the running sums of them are kept instead of the messages themselves
+  struct VehicleTwistSum
+  {
+    double vx{0.0};
+    double vx_covariance{0.0};
+    size_t size{0};
+    builtin_interfaces::msg::Time latest_stamp;
+  };
+  struct GyroSum
+  {
+    geometry_msgs::msg::Vector3 angular_velocity;
+    geometry_msgs::msg::Vector3 angular_velocity_covariance;
+    size_t size{0};
+    builtin_interfaces::msg::Time latest_stamp;
+  };
+  VehicleTwistSum vehicle_twist_sum_;
+  GyroSum gyro_sum_;
 };
 
 #endif  // GYRO_ODOMETER__GYRO_ODOMETER_CORE_HPP_
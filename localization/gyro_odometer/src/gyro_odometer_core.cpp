@@ -39,67 +39,6 @@ std::array<double, 9> transformCovariance(const std::array<double, 9> & cov)
   return cov_transformed;
 }
 
-geometry_msgs::msg::TwistWithCovarianceStamped concatGyroAndOdometer(
-  const std::deque<geometry_msgs::msg::TwistWithCovarianceStamped> & vehicle_twist_queue,
-  const std::deque<sensor_msgs::msg::Imu> & gyro_queue)
-{
-  using COV_IDX_XYZ = tier4_autoware_utils::xyz_covariance_index::XYZ_COV_IDX;
-  using COV_IDX_XYZRPY = tier4_autoware_utils::xyzrpy_covariance_index::XYZRPY_COV_IDX;
-
-  double vx_mean = 0;
-  geometry_msgs::msg::Vector3 gyro_mean{};
-  double vx_covariance_original = 0;
-  geometry_msgs::msg::Vector3 gyro_covariance_original{};
-  for (const auto & vehicle_twist : vehicle_twist_queue) {
-    vx_mean += vehicle_twist.twist.twist.linear.x;
-    vx_covariance_original += vehicle_twist.twist.covariance[0 * 6 + 0];
-  }
-  vx_mean /= vehicle_twist_queue.size();
-  vx_covariance_original /= vehicle_twist_queue.size();
-
-  for (const auto & gyro : gyro_queue) {
-    gyro_mean.x += gyro.angular_velocity.x;
-    gyro_mean.y += gyro.angular_velocity.y;
-    gyro_mean.z += gyro.angular_velocity.z;
-    gyro_covariance_original.x += gyro.angular_velocity_covariance[COV_IDX_XYZ::X_X];
-    gyro_covariance_original.y += gyro.angular_velocity_covariance[COV_IDX_XYZ::Y_Y];
-    gyro_covariance_original.z += gyro.angular_velocity_covariance[COV_IDX_XYZ::Z_Z];
-  }
-  gyro_mean.x /= gyro_queue.size();
-  gyro_mean.y /= gyro_queue.size();
-  gyro_mean.z /= gyro_queue.size();
-  gyro_covariance_original.x /= gyro_queue.size();
-  gyro_covariance_original.y /= gyro_queue.size();
-  gyro_covariance_original.z /= gyro_queue.size();
-
-  geometry_msgs::msg::TwistWithCovarianceStamped twist_with_cov;
-  const auto latest_vehicle_twist_stamp = rclcpp::Time(vehicle_twist_queue.back().header.stamp);
-  const auto latest_imu_stamp = rclcpp::Time(gyro_queue.back().header.stamp);
-  if (latest_vehicle_twist_stamp < latest_imu_stamp) {
-    twist_with_cov.header.stamp = latest_imu_stamp;
-  } else {
-    twist_with_cov.header.stamp = latest_vehicle_twist_stamp;
-  }
-  twist_with_cov.header.frame_id = gyro_queue.front().header.frame_id;
-  twist_with_cov.twist.twist.linear.x = vx_mean;
-  twist_with_cov.twist.twist.angular = gyro_mean;
-
-  // From a statistical point of view, here we reduce the covariances according to the number of
-  // observed data
-  twist_with_cov.twist.covariance[COV_IDX_XYZRPY::X_X] =
-    vx_covariance_original / vehicle_twist_queue.size();
-  twist_with_cov.twist.covariance[COV_IDX_XYZRPY::Y_Y] = 100000.0;
-  twist_with_cov.twist.covariance[COV_IDX_XYZRPY::Z_Z] = 100000.0;
-  twist_with_cov.twist.covariance[COV_IDX_XYZRPY::ROLL_ROLL] =
-    gyro_covariance_original.x / gyro_queue.size();
-  twist_with_cov.twist.covariance[COV_IDX_XYZRPY::PITCH_PITCH] =
-    gyro_covariance_original.y / gyro_queue.size();
-  twist_with_cov.twist.covariance[COV_IDX_XYZRPY::YAW_YAW] =
-    gyro_covariance_original.z / gyro_queue.size();
-
-  return twist_with_cov;
-}
-
 GyroOdometer::GyroOdometer(const rclcpp::NodeOptions & options)
 : Node("gyro_odometer", options),
   output_frame_(declare_parameter<std::string>("output_frame")),
@@ -138,39 +77,39 @@ void GyroOdometer::callbackVehicleTwist(
   vehicle_twist_arrived_ = true;
   if (!imu_arrived_) {
     RCLCPP_WARN_THROTTLE(this->get_logger(), *this->get_clock(), 1000, "Imu msg is not subscribed");
-    vehicle_twist_queue_.clear();
-    gyro_queue_.clear();
+    clearSums();
     return;
   }
 
-  const double twist_dt = std::abs((this->now() - vehicle_twist_ptr->header.stamp).seconds());
+  const rclcpp::Time now = this->now();
+  const double twist_dt = std::abs((now - vehicle_twist_ptr->header.stamp).seconds());
   if (twist_dt > message_timeout_sec_) {
     const std::string error_msg = fmt::format(
       "Twist msg is timeout. twist_dt: {}[sec], tolerance {}[sec]", twist_dt, message_timeout_sec_);
     RCLCPP_ERROR_THROTTLE(this->get_logger(), *this->get_clock(), 1000, error_msg.c_str());
-    vehicle_twist_queue_.clear();
-    gyro_queue_.clear();
+    clearSums();
     return;
   }
 
-  vehicle_twist_queue_.push_back(*vehicle_twist_ptr);
+  vehicle_twist_sum_.vx += vehicle_twist_ptr->twist.twist.linear.x;
+  vehicle_twist_sum_.vx_covariance += vehicle_twist_ptr->twist.covariance[0 * 6 + 0];
+  vehicle_twist_sum_.latest_stamp = vehicle_twist_ptr->header.stamp;
+  ++vehicle_twist_sum_.size;
 
-  if (gyro_queue_.empty()) return;
-  const double imu_dt = std::abs((this->now() - gyro_queue_.back().header.stamp).seconds());
+  if (gyro_sum_.size == 0) return;
+  const double imu_dt = std::abs((now - rclcpp::Time(gyro_sum_.latest_stamp)).seconds());
   if (imu_dt > message_timeout_sec_) {
     const std::string error_msg = fmt::format(
       "Imu msg is timeout. twist_dt: {}[sec], tolerance {}[sec]", imu_dt, message_timeout_sec_);
     RCLCPP_ERROR_THROTTLE(this->get_logger(), *this->get_clock(), 1000, error_msg.c_str());
-    vehicle_twist_queue_.clear();
-    gyro_queue_.clear();
+    clearSums();
     return;
   }
 
   const geometry_msgs::msg::TwistWithCovarianceStamped twist_with_cov_raw =
-    concatGyroAndOdometer(vehicle_twist_queue_, gyro_queue_);
+    concatGyroAndOdometer();
   publishData(twist_with_cov_raw);
-  vehicle_twist_queue_.clear();
-  gyro_queue_.clear();
+  clearSums();
 }
 
 void GyroOdometer::callbackImu(const sensor_msgs::msg::Imu::ConstSharedPtr imu_msg_ptr)
@@ -179,18 +118,17 @@ void GyroOdometer::callbackImu(const sensor_msgs::msg::Imu::ConstSharedPtr imu_m
   if (!vehicle_twist_arrived_) {
     RCLCPP_WARN_THROTTLE(
       this->get_logger(), *this->get_clock(), 1000, "Twist msg is not subscribed");
-    vehicle_twist_queue_.clear();
-    gyro_queue_.clear();
+    clearSums();
     return;
   }
 
-  const double imu_dt = std::abs((this->now() - imu_msg_ptr->header.stamp).seconds());
+  const rclcpp::Time now = this->now();
+  const double imu_dt = std::abs((now - imu_msg_ptr->header.stamp).seconds());
   if (imu_dt > message_timeout_sec_) {
     const std::string error_msg = fmt::format(
       "Imu msg is timeout. imu_dt: {}[sec], tolerance {}[sec]", imu_dt, message_timeout_sec_);
     RCLCPP_ERROR_THROTTLE(this->get_logger(), *this->get_clock(), 1000, error_msg.c_str());
-    vehicle_twist_queue_.clear();
-    gyro_queue_.clear();
+    clearSums();
     return;
   }
 
@@ -200,8 +138,7 @@ void GyroOdometer::callbackImu(const sensor_msgs::msg::Imu::ConstSharedPtr imu_m
     RCLCPP_ERROR(
       this->get_logger(), "Please publish TF %s to %s", output_frame_.c_str(),
       (imu_msg_ptr->header.frame_id).c_str());
-    vehicle_twist_queue_.clear();
-    gyro_queue_.clear();
+    clearSums();
     return;
   }
 
@@ -213,32 +150,81 @@ void GyroOdometer::callbackImu(const sensor_msgs::msg::Imu::ConstSharedPtr imu_m
   transformed_angular_velocity.header = tf_imu2base_ptr->header;
   tf2::doTransform(angular_velocity, transformed_angular_velocity, *tf_imu2base_ptr);
 
-  sensor_msgs::msg::Imu gyro_base_link;
-  gyro_base_link.header = imu_msg_ptr->header;
-  gyro_base_link.header.frame_id = output_frame_;
-  gyro_base_link.angular_velocity = transformed_angular_velocity.vector;
-  gyro_base_link.angular_velocity_covariance =
+  const auto angular_velocity_covariance =
     transformCovariance(imu_msg_ptr->angular_velocity_covariance);
-
-  gyro_queue_.push_back(gyro_base_link);
-
-  if (vehicle_twist_queue_.empty()) return;
-  const double twist_dt =
-    std::abs((this->now() - vehicle_twist_queue_.back().header.stamp).seconds());
+  gyro_sum_.angular_velocity.x += transformed_angular_velocity.vector.x;
+  gyro_sum_.angular_velocity.y += transformed_angular_velocity.vector.y;
+  gyro_sum_.angular_velocity.z += transformed_angular_velocity.vector.z;
+  gyro_sum_.angular_velocity_covariance.x += angular_velocity_covariance[COV_IDX::X_X];
+  gyro_sum_.angular_velocity_covariance.y += angular_velocity_covariance[COV_IDX::Y_Y];
+  gyro_sum_.angular_velocity_covariance.z += angular_velocity_covariance[COV_IDX::Z_Z];
+  gyro_sum_.latest_stamp = imu_msg_ptr->header.stamp;
+  ++gyro_sum_.size;
+
+  if (vehicle_twist_sum_.size == 0) return;
+  const double twist_dt = std::abs((now - rclcpp::Time(vehicle_twist_sum_.latest_stamp)).seconds());
   if (twist_dt > message_timeout_sec_) {
     const std::string error_msg = fmt::format(
       "Twist msg is timeout. twist_dt: {}[sec], tolerance {}[sec]", twist_dt, message_timeout_sec_);
     RCLCPP_ERROR_THROTTLE(this->get_logger(), *this->get_clock(), 1000, error_msg.c_str());
-    vehicle_twist_queue_.clear();
-    gyro_queue_.clear();
+    clearSums();
     return;
   }
 
   const geometry_msgs::msg::TwistWithCovarianceStamped twist_with_cov_raw =
-    concatGyroAndOdometer(vehicle_twist_queue_, gyro_queue_);
+    concatGyroAndOdometer();
   publishData(twist_with_cov_raw);
-  vehicle_twist_queue_.clear();
-  gyro_queue_.clear();
+  clearSums();
+}
+
+geometry_msgs::msg::TwistWithCovarianceStamped GyroOdometer::concatGyroAndOdometer() const
+{
+  using COV_IDX_XYZRPY = tier4_autoware_utils::xyzrpy_covariance_index::XYZRPY_COV_IDX;
+
+  const double vx_mean = vehicle_twist_sum_.vx / vehicle_twist_sum_.size;
+  const double vx_covariance_original = vehicle_twist_sum_.vx_covariance / vehicle_twist_sum_.size;
+
+  geometry_msgs::msg::Vector3 gyro_mean{};
+  gyro_mean.x = gyro_sum_.angular_velocity.x / gyro_sum_.size;
+  gyro_mean.y = gyro_sum_.angular_velocity.y / gyro_sum_.size;
+  gyro_mean.z = gyro_sum_.angular_velocity.z / gyro_sum_.size;
+  geometry_msgs::msg::Vector3 gyro_covariance_original{};
+  gyro_covariance_original.x = gyro_sum_.angular_velocity_covariance.x / gyro_sum_.size;
+  gyro_covariance_original.y = gyro_sum_.angular_velocity_covariance.y / gyro_sum_.size;
+  gyro_covariance_original.z = gyro_sum_.angular_velocity_covariance.z / gyro_sum_.size;
+
+  geometry_msgs::msg::TwistWithCovarianceStamped twist_with_cov;
+  const auto latest_vehicle_twist_stamp = rclcpp::Time(vehicle_twist_sum_.latest_stamp);
+  const auto latest_imu_stamp = rclcpp::Time(gyro_sum_.latest_stamp);
+  if (latest_vehicle_twist_stamp < latest_imu_stamp) {
+    twist_with_cov.header.stamp = latest_imu_stamp;
+  } else {
+    twist_with_cov.header.stamp = latest_vehicle_twist_stamp;
+  }
+  twist_with_cov.header.frame_id = output_frame_;
+  twist_with_cov.twist.twist.linear.x = vx_mean;
+  twist_with_cov.twist.twist.angular = gyro_mean;
+
+  // From a statistical point of view, here we reduce the covariances according to the number of
+  // observed data
+  twist_with_cov.twist.covariance[COV_IDX_XYZRPY::X_X] =
+    vx_covariance_original / vehicle_twist_sum_.size;
+  twist_with_cov.twist.covariance[COV_IDX_XYZRPY::Y_Y] = 100000.0;
+  twist_with_cov.twist.covariance[COV_IDX_XYZRPY::Z_Z] = 100000.0;
+  twist_with_cov.twist.covariance[COV_IDX_XYZRPY::ROLL_ROLL] =
+    gyro_covariance_original.x / gyro_sum_.size;
+  twist_with_cov.twist.covariance[COV_IDX_XYZRPY::PITCH_PITCH] =
+    gyro_covariance_original.y / gyro_sum_.size;
+  twist_with_cov.twist.covariance[COV_IDX_XYZRPY::YAW_YAW] =
+    gyro_covariance_original.z / gyro_sum_.size;
+
+  return twist_with_cov;
+}
+
+void GyroOdometer::clearSums()
+{
+  vehicle_twist_sum_ = VehicleTwistSum{};
+  gyro_sum_ = GyroSum{};
 }
 
 void GyroOdometer::publishData(
@@ -0,0 +1,153 @@
+// Copyright 2023 Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Replays scans against a PCD map with the given NDT parameters, to compare the parameters offline.
+//
+// usage: ndt_scan_matcher_bench <map.pcd> <scans.csv> [resolution] [step_size] [trans_epsilon]
+//          [max_iterations] [num_threads]
+//
+// Each line of scans.csv is "<scan.pcd>,x,y,z,roll,pitch,yaw", a scan in the base frame and the
+// initial pose of the alignment in the map frame. A relative scan path is relative to scans.csv.
+
+#include <tier4_autoware_utils/system/stop_watch.hpp>
+
+#include <Eigen/Geometry>
+
+#include <multigrid_pclomp/multigrid_ndt_omp.h>
+#include <pcl/io/pcd_io.h>
+#include <pcl/point_types.h>
+
+#include <algorithm>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+using PointSource = pcl::PointXYZ;
+using PointTarget = pcl::PointXYZ;
+using NormalDistributionsTransform =
+  pclomp::MultiGridNormalDistributionsTransform<PointSource, PointTarget>;
+
+struct Scan
+{
+  std::string path;
+  Eigen::Matrix4f initial_pose;
+};
+
+std::vector<Scan> read_scans(const std::string & csv_path)
+{
+  const auto slash = csv_path.find_last_of('/');
+  const std::string directory =
+    slash == std::string::npos ? std::string("") : csv_path.substr(0, slash + 1);
+
+  std::vector<Scan> scans;
+  std::ifstream csv(csv_path);
+  std::string line;
+  while (std::getline(csv, line)) {
+    std::replace(line.begin(), line.end(), ',', ' ');
+    std::istringstream fields(line);
+    Scan scan;
+    double x, y, z, roll, pitch, yaw;
+    if (!(fields >> scan.path >> x >> y >> z >> roll >> pitch >> yaw)) {
+      continue;
+    }
+    if (scan.path.front() != '/') {
+      scan.path = directory + scan.path;
+    }
+    const Eigen::Affine3f pose = Eigen::Translation3f(x, y, z) *
+                                 Eigen::AngleAxisf(yaw, Eigen::Vector3f::UnitZ()) *
+                                 Eigen::AngleAxisf(pitch, Eigen::Vector3f::UnitY()) *
+                                 Eigen::AngleAxisf(roll, Eigen::Vector3f::UnitX());
+    scan.initial_pose = pose.matrix();
+    scans.push_back(scan);
+  }
+  return scans;
+}
+
+int main(int argc, char ** argv)
+{
+  if (argc < 3) {
+    std::cerr << "usage: " << argv[0]
+              << " <map.pcd> <scans.csv> [resolution] [step_size] [trans_epsilon]"
+                 " [max_iterations] [num_threads]"
+              << std::endl;
+    return 1;
+  }
+
+  // the same defaults as ndt_scan_matcher.param.yaml
+  pclomp::NdtParams ndt_params{};
+  ndt_params.resolution = argc > 3 ? std::atof(argv[3]) : 2.0;
+  ndt_params.step_size = argc > 4 ? std::atof(argv[4]) : 0.1;
+  ndt_params.trans_epsilon = argc > 5 ? std::atof(argv[5]) : 0.01;
+  ndt_params.max_iterations = argc > 6 ? std::atoi(argv[6]) : 30;
+  ndt_params.num_threads = std::max(argc > 7 ? std::atoi(argv[7]) : 4, 1);
+  ndt_params.regularization_scale_factor = 0.0f;
+
+  tier4_autoware_utils::StopWatch<std::chrono::milliseconds> stop_watch;
+
+  pcl::shared_ptr<pcl::PointCloud<PointTarget>> map_points_ptr(new pcl::PointCloud<PointTarget>);
+  if (pcl::io::loadPCDFile(argv[1], *map_points_ptr) != 0) {
+    std::cerr << "failed to load the map " << argv[1] << std::endl;
+    return 1;
+  }
+  const std::vector<Scan> scans = read_scans(argv[2]);
+  if (scans.empty()) {
+    std::cerr << "no scan in " << argv[2] << std::endl;
+    return 1;
+  }
+
+  NormalDistributionsTransform ndt;
+  ndt.setParams(ndt_params);
+  stop_watch.tic("map");
+  ndt.setInputTarget(map_points_ptr);
+  std::cout << "map points: " << map_points_ptr->size() << ", target creation time: "
+            << stop_watch.toc("map") << " [ms]" << std::endl;
+
+  std::cout << "scan,points,align_time_ms,iteration_num,transform_probability,"
+               "nearest_voxel_transformation_likelihood"
+            << std::endl;
+  double total_align_time = 0.0;
+  double max_align_time = 0.0;
+  int total_iteration_num = 0;
+  for (const Scan & scan : scans) {
+    pcl::shared_ptr<pcl::PointCloud<PointSource>> scan_points_ptr(
+      new pcl::PointCloud<PointSource>);
+    if (pcl::io::loadPCDFile(scan.path, *scan_points_ptr) != 0) {
+      std::cerr << "failed to load the scan " << scan.path << std::endl;
+      continue;
+    }
+    ndt.setInputSource(scan_points_ptr);
+
+    pcl::PointCloud<PointSource> output_cloud;
+    stop_watch.tic("align");
+    ndt.align(output_cloud, scan.initial_pose);
+    const double align_time = stop_watch.toc("align");
+    const pclomp::NdtResult ndt_result = ndt.getResult();
+
+    total_align_time += align_time;
+    max_align_time = std::max(max_align_time, align_time);
+    total_iteration_num += ndt_result.iteration_num;
+    std::cout << scan.path << "," << scan_points_ptr->size() << "," << align_time << ","
+              << ndt_result.iteration_num << "," << ndt_result.transform_probability << ","
+              << ndt_result.nearest_voxel_transformation_likelihood << std::endl;
+  }
+
+  const auto num_scans = static_cast<double>(scans.size());
+  std::cout << "mean align time: " << total_align_time / num_scans
+            << " [ms], max align time: " << max_align_time
+            << " [ms], mean iteration num: " << total_iteration_num / num_scans << std::endl;
+  return 0;
+}
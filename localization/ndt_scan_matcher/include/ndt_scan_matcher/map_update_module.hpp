@@ -49,7 +49,7 @@ class MapUpdateModule
 public:
   MapUpdateModule(
     rclcpp::Node * node, std::mutex * ndt_ptr_mutex,
-    std::shared_ptr<NormalDistributionsTransform> ndt_ptr,
+    std::shared_ptr<NormalDistributionsTransform> * ndt_ptr_ptr,
     std::shared_ptr<Tf2ListenerModule> tf2_listener_module, std::string map_frame,
     rclcpp::CallbackGroup::SharedPtr main_callback_group);
 
@@ -63,7 +63,7 @@ private:
     const std::vector<std::string> & map_ids_to_remove);
   void update_map(const geometry_msgs::msg::Point & position);
   [[nodiscard]] bool should_update_map(const geometry_msgs::msg::Point & position) const;
-  void publish_partial_pcd_map();
+  void publish_partial_pcd_map(const NormalDistributionsTransform & ndt);
 
   rclcpp::Publisher<sensor_msgs::msg::PointCloud2>::SharedPtr loaded_pcd_pub_;
 
@@ -75,7 +75,8 @@ private:
 
   rclcpp::CallbackGroup::SharedPtr map_callback_group_;
 
-  std::shared_ptr<NormalDistributionsTransform> ndt_ptr_;
+  // the NDT of NDTScanMatcher, which is replaced by a new one under ndt_ptr_mutex_
+  std::shared_ptr<NormalDistributionsTransform> * ndt_ptr_ptr_;
   std::mutex * ndt_ptr_mutex_;
   std::string map_frame_;
   rclcpp::Logger logger_;
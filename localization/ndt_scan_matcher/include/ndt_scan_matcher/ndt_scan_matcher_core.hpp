@@ -23,6 +23,7 @@
 
 #include <rclcpp/rclcpp.hpp>
 #include <tier4_autoware_utils/ros/logger_level_configure.hpp>
+#include <tier4_autoware_utils/system/stop_watch.hpp>
 
 #include <diagnostic_msgs/msg/diagnostic_array.hpp>
 #include <geometry_msgs/msg/pose_array.hpp>
@@ -31,6 +32,7 @@
 #include <nav_msgs/msg/odometry.hpp>
 #include <sensor_msgs/msg/point_cloud2.hpp>
 #include <std_srvs/srv/set_bool.hpp>
+#include <tier4_debug_msgs/msg/float32_multi_array_stamped.hpp>
 #include <tier4_debug_msgs/msg/float32_stamped.hpp>
 #include <tier4_debug_msgs/msg/int32_stamped.hpp>
 #include <tier4_localization_msgs/srv/pose_with_covariance_stamped.hpp>
@@ -69,6 +71,8 @@ enum class ConvergedParamType {
   NEAREST_VOXEL_TRANSFORMATION_LIKELIHOOD = 1
 };
 
+enum class CovarianceEstimationType { MULTI_NDT = 0, LAPLACE_APPROXIMATION = 1 };
+
 class NDTScanMatcher : public rclcpp::Node
 {
   using PointSource = pcl::PointXYZ;
@@ -97,6 +101,11 @@ private:
   geometry_msgs::msg::PoseWithCovarianceStamped align_pose(
     const geometry_msgs::msg::PoseWithCovarianceStamped & initial_pose_with_cov);
 
+  void set_latest_sensor_points();
+  bool is_stationary(const Eigen::Matrix4f & initial_pose_matrix) const;
+  void update_stationary_state(
+    const Eigen::Matrix4f & initial_pose_matrix, const pclomp::NdtResult & ndt_result,
+    const bool is_converged);
   void transform_sensor_measurement(
     const std::string & source_frame, const std::string & target_frame,
     const pcl::shared_ptr<pcl::PointCloud<PointSource>> & sensor_points_input_ptr,
@@ -127,6 +136,10 @@ private:
   std::array<double, 36> estimate_covariance(
     const pclomp::NdtResult & ndt_result, const Eigen::Matrix4f & initial_pose_matrix,
     const rclcpp::Time & sensor_ros_time);
+  std::array<double, 36> estimate_covariance_by_laplace_approximation(
+    const pclomp::NdtResult & ndt_result);
+  std::vector<std::shared_ptr<NormalDistributionsTransform>> get_covariance_ndt_ptrs(
+    const int num_ndt_ptrs);
 
   std::optional<Eigen::Matrix4f> interpolate_regularization_pose(
     const rclcpp::Time & sensor_ros_time);
@@ -149,6 +162,8 @@ private:
   rclcpp::Publisher<geometry_msgs::msg::PoseArray>::SharedPtr multi_ndt_pose_pub_;
   rclcpp::Publisher<geometry_msgs::msg::PoseArray>::SharedPtr multi_initial_pose_pub_;
   rclcpp::Publisher<tier4_debug_msgs::msg::Float32Stamped>::SharedPtr exe_time_pub_;
+  rclcpp::Publisher<tier4_debug_msgs::msg::Float32MultiArrayStamped>::SharedPtr
+    stage_exe_time_pub_;
   rclcpp::Publisher<tier4_debug_msgs::msg::Float32Stamped>::SharedPtr transform_probability_pub_;
   rclcpp::Publisher<tier4_debug_msgs::msg::Float32Stamped>::SharedPtr
     nearest_voxel_transformation_likelihood_pub_;
@@ -189,14 +204,21 @@ private:
 
   int initial_estimate_particles_num_;
   int n_startup_trials_;
+  int initial_estimate_particles_batch_size_;
   double lidar_topic_timeout_sec_;
   double initial_pose_timeout_sec_;
   double initial_pose_distance_tolerance_m_;
   float inversion_vector_threshold_;
   float oscillation_threshold_;
   bool use_cov_estimation_;
+  CovarianceEstimationType covariance_estimation_type_;
+  int covariance_estimation_batch_size_;
   std::vector<Eigen::Vector2d> initial_pose_offset_model_;
   std::array<double, 36> output_pose_covariance_;
+  // copies of ndt_ptr_ for the concurrent searches of the covariance estimation, which are made
+  // again when ndt_ptr_ is replaced by the map update
+  std::vector<std::shared_ptr<NormalDistributionsTransform>> covariance_ndt_ptrs_;
+  std::weak_ptr<NormalDistributionsTransform> covariance_ndt_source_;
 
   std::deque<geometry_msgs::msg::PoseWithCovarianceStamped::ConstSharedPtr>
     initial_pose_msg_ptr_array_;
@@ -205,6 +227,7 @@ private:
 
   // variables for regularization
   const bool regularization_enabled_;
+  std::optional<Eigen::Matrix4f> regularization_pose_;
   std::deque<geometry_msgs::msg::PoseWithCovarianceStamped::ConstSharedPtr>
     regularization_pose_msg_ptr_array_;
 
@@ -220,6 +243,20 @@ private:
 
   bool use_dynamic_map_loading_;
 
+  // the latest scan, which is transformed only when it is aligned, and its transformed points,
+  // which are set again to the NDT which the map update swaps into ndt_ptr_
+  sensor_msgs::msg::PointCloud2::ConstSharedPtr latest_sensor_points_msg_;
+  pcl::shared_ptr<pcl::PointCloud<PointSource>> latest_sensor_points_in_baselink_frame_;
+
+  // variables for skipping the alignment of the scans while the vehicle is stationary
+  bool skip_stationary_scans_;
+  double stationary_translation_threshold_;
+  double stationary_rotation_threshold_;
+  int stationary_max_skip_num_;
+  int stationary_skip_num_;
+  // the initial pose of the last alignment, if it converged close to it
+  std::optional<Eigen::Matrix4f> stationary_initial_pose_matrix_;
+
   // The execution time which means probably NDT cannot matches scans properly
   int critical_upper_bound_exe_time_ms_;
 };
@@ -16,9 +16,9 @@
 
 MapModule::MapModule(
   rclcpp::Node * node, std::mutex * ndt_ptr_mutex,
-  std::shared_ptr<NormalDistributionsTransform> ndt_ptr,
+  std::shared_ptr<NormalDistributionsTransform> * ndt_ptr_ptr,
   rclcpp::CallbackGroup::SharedPtr map_callback_group)
-: ndt_ptr_(std::move(ndt_ptr)), ndt_ptr_mutex_(ndt_ptr_mutex)
+: ndt_ptr_ptr_(ndt_ptr_ptr), ndt_ptr_mutex_(ndt_ptr_mutex)
 {
   auto map_sub_opt = rclcpp::SubscriptionOptions();
   map_sub_opt.callback_group = map_callback_group;
@@ -31,19 +31,19 @@ MapModule::MapModule(
 void MapModule::callback_map_points(
   sensor_msgs::msg::PointCloud2::ConstSharedPtr map_points_msg_ptr)
 {
-  NormalDistributionsTransform new_ndt;
-  new_ndt.setParams(ndt_ptr_->getParams());
+  auto new_ndt_ptr = std::make_shared<NormalDistributionsTransform>();
+  new_ndt_ptr->setParams((*ndt_ptr_ptr_)->getParams());
 
   pcl::shared_ptr<pcl::PointCloud<PointTarget>> map_points_ptr(new pcl::PointCloud<PointTarget>);
   pcl::fromROSMsg(*map_points_msg_ptr, *map_points_ptr);
-  new_ndt.setInputTarget(map_points_ptr);
+  new_ndt_ptr->setInputTarget(map_points_ptr);
   // create Thread
   // detach
   auto output_cloud = std::make_shared<pcl::PointCloud<PointSource>>();
-  new_ndt.align(*output_cloud);
+  new_ndt_ptr->align(*output_cloud);
 
-  // swap
+  // swap the pointers, the previous map is freed out of the lock
   ndt_ptr_mutex_->lock();
-  *ndt_ptr_ = new_ndt;
+  ndt_ptr_ptr_->swap(new_ndt_ptr);
   ndt_ptr_mutex_->unlock();
 }
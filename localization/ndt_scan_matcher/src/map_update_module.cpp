@@ -24,10 +24,10 @@ double norm_xy(const T p1, const U p2)
 
 MapUpdateModule::MapUpdateModule(
   rclcpp::Node * node, std::mutex * ndt_ptr_mutex,
-  std::shared_ptr<NormalDistributionsTransform> ndt_ptr,
+  std::shared_ptr<NormalDistributionsTransform> * ndt_ptr_ptr,
   std::shared_ptr<Tf2ListenerModule> tf2_listener_module, std::string map_frame,
   rclcpp::CallbackGroup::SharedPtr main_callback_group)
-: ndt_ptr_(std::move(ndt_ptr)),
+: ndt_ptr_ptr_(ndt_ptr_ptr),
   ndt_ptr_mutex_(ndt_ptr_mutex),
   map_frame_(std::move(map_frame)),
   logger_(node->get_logger()),
@@ -107,7 +107,7 @@ void MapUpdateModule::update_map(const geometry_msgs::msg::Point & position)
   request->area.center_x = static_cast<float>(position.x);
   request->area.center_y = static_cast<float>(position.y);
   request->area.radius = static_cast<float>(dynamic_map_loading_map_radius_);
-  request->cached_ids = ndt_ptr_->getCurrentMapIDs();
+  request->cached_ids = (*ndt_ptr_ptr_)->getCurrentMapIDs();
 
   while (!pcd_loader_client_->wait_for_service(std::chrono::seconds(1)) && rclcpp::ok()) {
     RCLCPP_INFO(
@@ -145,21 +145,21 @@ void MapUpdateModule::update_ndt(
   }
   const auto exe_start_time = std::chrono::system_clock::now();
 
-  NormalDistributionsTransform backup_ndt = *ndt_ptr_;
+  auto new_ndt_ptr = std::make_shared<NormalDistributionsTransform>(**ndt_ptr_ptr_);
+
+  // Remove pcd first, so that the removed cells are freed before the new ones are added
+  for (const std::string & map_id_to_remove : map_ids_to_remove) {
+    new_ndt_ptr->removeTarget(map_id_to_remove);
+  }
 
   // Add pcd
   for (const auto & map_to_add : maps_to_add) {
     pcl::shared_ptr<pcl::PointCloud<PointTarget>> map_points_ptr(new pcl::PointCloud<PointTarget>);
     pcl::fromROSMsg(map_to_add.pointcloud, *map_points_ptr);
-    backup_ndt.addTarget(map_points_ptr, map_to_add.cell_id);
+    new_ndt_ptr->addTarget(map_points_ptr, map_to_add.cell_id);
   }
 
-  // Remove pcd
-  for (const std::string & map_id_to_remove : map_ids_to_remove) {
-    backup_ndt.removeTarget(map_id_to_remove);
-  }
-
-  backup_ndt.createVoxelKdtree();
+  new_ndt_ptr->createVoxelKdtree();
 
   const auto exe_end_time = std::chrono::system_clock::now();
   const auto duration_micro_sec =
@@ -167,20 +167,22 @@ void MapUpdateModule::update_ndt(
   const auto exe_time = static_cast<double>(duration_micro_sec) / 1000.0;
   RCLCPP_INFO(logger_, "Time duration for creating new ndt_ptr: %lf [ms]", exe_time);
 
-  // swap
+  // swap the pointers, so that the scan matching is blocked only for the swap and not for a copy
+  // of the whole map
   (*ndt_ptr_mutex_).lock();
-  // ToDo (kminoda): Here negligible NDT copy occurs during the new map loading phase, which should
-  // ideally be avoided. But I will leave this for now since I cannot come up with a solution other
-  // than using pointer of pointer.
-  *ndt_ptr_ = backup_ndt;
+  ndt_ptr_ptr_->swap(new_ndt_ptr);
+  const std::shared_ptr<NormalDistributionsTransform> current_ndt_ptr = *ndt_ptr_ptr_;
   (*ndt_ptr_mutex_).unlock();
 
-  publish_partial_pcd_map();
+  // the previous map is released out of the lock
+  new_ndt_ptr.reset();
+
+  publish_partial_pcd_map(*current_ndt_ptr);
 }
 
-void MapUpdateModule::publish_partial_pcd_map()
+void MapUpdateModule::publish_partial_pcd_map(const NormalDistributionsTransform & ndt)
 {
-  pcl::PointCloud<PointTarget> map_pcl = ndt_ptr_->getVoxelPCD();
+  pcl::PointCloud<PointTarget> map_pcl = ndt.getVoxelPCD();
 
   sensor_msgs::msg::PointCloud2 map_msg;
   pcl::toROSMsg(map_pcl, map_msg);
@@ -119,6 +119,7 @@ NDTScanMatcher::NDTScanMatcher()
 {
   (*state_ptr_)["state"] = "Initializing";
   is_activated_ = false;
+  stationary_skip_num_ = 0;
 
   int points_queue_size = this->declare_parameter<int>("input_sensor_points_queue_size");
   points_queue_size = std::max(points_queue_size, 0);
@@ -184,6 +185,12 @@ NDTScanMatcher::NDTScanMatcher()
       use_cov_estimation_ = false;
     }
   }
+  const int covariance_estimation_type_tmp =
+    this->declare_parameter<int>("covariance_estimation_type", 0);
+  covariance_estimation_type_ =
+    static_cast<CovarianceEstimationType>(covariance_estimation_type_tmp);
+  covariance_estimation_batch_size_ =
+    std::max(this->declare_parameter<int>("covariance_estimation_batch_size", 1), 1);
 
   std::vector<double> output_pose_covariance =
     this->declare_parameter<std::vector<double>>("output_pose_covariance");
@@ -191,8 +198,18 @@ NDTScanMatcher::NDTScanMatcher()
     output_pose_covariance_[i] = output_pose_covariance[i];
   }
 
+  skip_stationary_scans_ = this->declare_parameter<bool>("skip_stationary_scans", false);
+  stationary_translation_threshold_ =
+    this->declare_parameter<double>("stationary_translation_threshold", 0.05);
+  stationary_rotation_threshold_ =
+    this->declare_parameter<double>("stationary_rotation_threshold", 0.01);
+  stationary_max_skip_num_ =
+    std::max(this->declare_parameter<int>("stationary_max_skip_num", 4), 0);
+
   initial_estimate_particles_num_ = this->declare_parameter<int>("initial_estimate_particles_num");
   n_startup_trials_ = this->declare_parameter<int>("n_startup_trials");
+  initial_estimate_particles_batch_size_ =
+    this->declare_parameter<int>("initial_estimate_particles_batch_size", 1);
 
   estimate_scores_for_degrounded_scan_ =
     this->declare_parameter<bool>("estimate_scores_for_degrounded_scan");
@@ -239,6 +256,8 @@ NDTScanMatcher::NDTScanMatcher()
   multi_initial_pose_pub_ =
     this->create_publisher<geometry_msgs::msg::PoseArray>("multi_initial_pose", 10);
   exe_time_pub_ = this->create_publisher<tier4_debug_msgs::msg::Float32Stamped>("exe_time_ms", 10);
+  stage_exe_time_pub_ = this->create_publisher<tier4_debug_msgs::msg::Float32MultiArrayStamped>(
+    "stage_exe_time_ms", 10);
   transform_probability_pub_ =
     this->create_publisher<tier4_debug_msgs::msg::Float32Stamped>("transform_probability", 10);
   nearest_voxel_transformation_likelihood_pub_ =
@@ -285,9 +304,9 @@ NDTScanMatcher::NDTScanMatcher()
   use_dynamic_map_loading_ = this->declare_parameter<bool>("use_dynamic_map_loading");
   if (use_dynamic_map_loading_) {
     map_update_module_ = std::make_unique<MapUpdateModule>(
-      this, &ndt_ptr_mtx_, ndt_ptr_, tf2_listener_module_, map_frame_, main_callback_group);
+      this, &ndt_ptr_mtx_, &ndt_ptr_, tf2_listener_module_, map_frame_, main_callback_group);
   } else {
-    map_module_ = std::make_unique<MapModule>(this, &ndt_ptr_mtx_, ndt_ptr_, main_callback_group);
+    map_module_ = std::make_unique<MapModule>(this, &ndt_ptr_mtx_, &ndt_ptr_, main_callback_group);
   }
 
   logger_configure_ = std::make_unique<tier4_autoware_utils::LoggerLevelConfigure>(this);
@@ -431,18 +450,11 @@ void NDTScanMatcher::callback_sensor_points(
   std::lock_guard<std::mutex> lock(ndt_ptr_mtx_);
 
   const auto exe_start_time = std::chrono::system_clock::now();
+  tier4_autoware_utils::StopWatch<std::chrono::milliseconds> stop_watch;
 
-  // preprocess input pointcloud
-  pcl::shared_ptr<pcl::PointCloud<PointSource>> sensor_points_in_sensor_frame(
-    new pcl::PointCloud<PointSource>);
-  pcl::shared_ptr<pcl::PointCloud<PointSource>> sensor_points_in_baselink_frame(
-    new pcl::PointCloud<PointSource>);
-  const std::string & sensor_frame = sensor_points_msg_in_sensor_frame->header.frame_id;
-
-  pcl::fromROSMsg(*sensor_points_msg_in_sensor_frame, *sensor_points_in_sensor_frame);
-  transform_sensor_measurement(
-    sensor_frame, base_frame_, sensor_points_in_sensor_frame, sensor_points_in_baselink_frame);
-  ndt_ptr_->setInputSource(sensor_points_in_baselink_frame);
+  // the scan is transformed only when it is aligned, here or in service_ndt_align
+  latest_sensor_points_msg_ = sensor_points_msg_in_sensor_frame;
+  latest_sensor_points_in_baselink_frame_.reset();
   if (!is_activated_) return;
 
   // calculate initial pose
@@ -466,12 +478,29 @@ void NDTScanMatcher::callback_sensor_points(
     return;
   }
 
-  // perform ndt scan matching
   const Eigen::Matrix4f initial_pose_matrix =
     pose_to_matrix4f(interpolator.get_current_pose().pose.pose);
+  if (skip_stationary_scans_ && is_stationary(initial_pose_matrix)) {
+    ++stationary_skip_num_;
+    (*state_ptr_)["state"] = "Skipped";
+    (*state_ptr_)["stationary_skip_num"] = std::to_string(stationary_skip_num_);
+    publish_diagnostic();
+    return;
+  }
+
+  // preprocess input pointcloud
+  stop_watch.tic("sensor_transform");
+  set_latest_sensor_points();
+  const pcl::shared_ptr<pcl::PointCloud<PointSource>> sensor_points_in_baselink_frame =
+    latest_sensor_points_in_baselink_frame_;
+  const double sensor_transform_time = stop_watch.toc("sensor_transform");
+
+  // perform ndt scan matching
   auto output_cloud = std::make_shared<pcl::PointCloud<PointSource>>();
+  stop_watch.tic("align");
   ndt_ptr_->align(*output_cloud, initial_pose_matrix);
   const pclomp::NdtResult ndt_result = ndt_ptr_->getResult();
+  const double align_time = stop_watch.toc("align");
 
   const geometry_msgs::msg::Pose result_pose_msg = matrix4f_to_pose(ndt_result.pose);
   std::vector<geometry_msgs::msg::Pose> transformation_msg_array;
@@ -498,14 +527,19 @@ void NDTScanMatcher::callback_sensor_points(
     ++skipping_publish_num;
     RCLCPP_WARN(get_logger(), "Not Converged");
   }
+  if (skip_stationary_scans_) {
+    update_stationary_state(initial_pose_matrix, ndt_result, is_converged);
+  }
 
   // covariance estimation
   std::array<double, 36> ndt_covariance = output_pose_covariance_;
+  stop_watch.tic("covariance_estimation");
   if (is_converged && use_cov_estimation_) {
     const auto estimated_covariance =
       estimate_covariance(ndt_result, initial_pose_matrix, sensor_ros_time);
     ndt_covariance = estimated_covariance;
   }
+  const double covariance_estimation_time = stop_watch.toc("covariance_estimation");
 
   const auto exe_end_time = std::chrono::system_clock::now();
   const auto duration_micro_sec =
@@ -513,6 +547,7 @@ void NDTScanMatcher::callback_sensor_points(
   const auto exe_time = static_cast<float>(duration_micro_sec) / 1000.0f;
 
   // publish
+  stop_watch.tic("publish");
   initial_pose_with_covariance_pub_->publish(interpolator.get_current_pose());
   exe_time_pub_->publish(make_float32_stamped(sensor_ros_time, exe_time));
   transform_probability_pub_->publish(
@@ -532,6 +567,15 @@ void NDTScanMatcher::callback_sensor_points(
   tier4_autoware_utils::transformPointCloud(
     *sensor_points_in_baselink_frame, *sensor_points_in_map_ptr, ndt_result.pose);
   publish_point_cloud(sensor_ros_time, map_frame_, sensor_points_in_map_ptr);
+  const double publish_time = stop_watch.toc("publish");
+
+  // the stages in the order of the processing, see README.md
+  tier4_debug_msgs::msg::Float32MultiArrayStamped stage_exe_time_msg;
+  stage_exe_time_msg.stamp = sensor_ros_time;
+  stage_exe_time_msg.data = {
+    static_cast<float>(sensor_transform_time), static_cast<float>(align_time),
+    static_cast<float>(covariance_estimation_time), static_cast<float>(publish_time)};
+  stage_exe_time_pub_->publish(stage_exe_time_msg);
 
   // whether use de-grounded points calculate score
   if (estimate_scores_for_degrounded_scan_) {
@@ -568,16 +612,77 @@ void NDTScanMatcher::callback_sensor_points(
     std::to_string(ndt_result.nearest_voxel_transformation_likelihood);
   (*state_ptr_)["iteration_num"] = std::to_string(ndt_result.iteration_num);
   (*state_ptr_)["skipping_publish_num"] = std::to_string(skipping_publish_num);
+  (*state_ptr_)["stationary_skip_num"] = std::to_string(stationary_skip_num_);
   if (is_local_optimal_solution_oscillation) {
     (*state_ptr_)["is_local_optimal_solution_oscillation"] = "1";
   } else {
     (*state_ptr_)["is_local_optimal_solution_oscillation"] = "0";
   }
   (*state_ptr_)["execution_time"] = std::to_string(exe_time);
+  (*state_ptr_)["sensor_transform_time"] = std::to_string(sensor_transform_time);
+  (*state_ptr_)["align_time"] = std::to_string(align_time);
+  (*state_ptr_)["covariance_estimation_time"] = std::to_string(covariance_estimation_time);
+  (*state_ptr_)["publish_time"] = std::to_string(publish_time);
 
   publish_diagnostic();
 }
 
+void NDTScanMatcher::set_latest_sensor_points()
+{
+  if (latest_sensor_points_msg_ == nullptr) {
+    return;
+  }
+
+  if (latest_sensor_points_in_baselink_frame_ == nullptr) {
+    pcl::shared_ptr<pcl::PointCloud<PointSource>> sensor_points_in_sensor_frame(
+      new pcl::PointCloud<PointSource>);
+    latest_sensor_points_in_baselink_frame_.reset(new pcl::PointCloud<PointSource>);
+    const std::string & sensor_frame = latest_sensor_points_msg_->header.frame_id;
+
+    pcl::fromROSMsg(*latest_sensor_points_msg_, *sensor_points_in_sensor_frame);
+    transform_sensor_measurement(
+      sensor_frame, base_frame_, sensor_points_in_sensor_frame,
+      latest_sensor_points_in_baselink_frame_);
+  }
+  if (ndt_ptr_->getInputSource() != latest_sensor_points_in_baselink_frame_) {
+    ndt_ptr_->setInputSource(latest_sensor_points_in_baselink_frame_);
+  }
+}
+
+bool NDTScanMatcher::is_stationary(const Eigen::Matrix4f & initial_pose_matrix) const
+{
+  // an alignment is forced after stationary_max_skip_num skipped scans
+  if (!stationary_initial_pose_matrix_ || stationary_skip_num_ >= stationary_max_skip_num_) {
+    return false;
+  }
+
+  // the motion predicted by the EKF since the last alignment
+  const Eigen::Matrix4f motion = stationary_initial_pose_matrix_->inverse() * initial_pose_matrix;
+  const Eigen::Matrix3f rotation = motion.topLeftCorner<3, 3>();
+  return motion.topRightCorner<3, 1>().norm() < stationary_translation_threshold_ &&
+         Eigen::AngleAxisf(rotation).angle() < stationary_rotation_threshold_;
+}
+
+void NDTScanMatcher::update_stationary_state(
+  const Eigen::Matrix4f & initial_pose_matrix, const pclomp::NdtResult & ndt_result,
+  const bool is_converged)
+{
+  stationary_skip_num_ = 0;
+
+  // The following scans can be skipped only if NDT agreed with the EKF on this one. Otherwise, the
+  // EKF still needs the correction of the following alignments.
+  const Eigen::Matrix4f correction = initial_pose_matrix.inverse() * ndt_result.pose;
+  const Eigen::Matrix3f rotation = correction.topLeftCorner<3, 3>();
+  const bool is_close = correction.topRightCorner<3, 1>().norm() <
+                          stationary_translation_threshold_ &&
+                        Eigen::AngleAxisf(rotation).angle() < stationary_rotation_threshold_;
+  if (is_converged && is_close) {
+    stationary_initial_pose_matrix_ = initial_pose_matrix;
+  } else {
+    stationary_initial_pose_matrix_ = std::nullopt;
+  }
+}
+
 void NDTScanMatcher::transform_sensor_measurement(
   const std::string & source_frame, const std::string & target_frame,
   const pcl::shared_ptr<pcl::PointCloud<PointSource>> & sensor_points_input_ptr,
@@ -745,6 +850,10 @@ std::array<double, 36> NDTScanMatcher::estimate_covariance(
   const pclomp::NdtResult & ndt_result, const Eigen::Matrix4f & initial_pose_matrix,
   const rclcpp::Time & sensor_ros_time)
 {
+  if (covariance_estimation_type_ == CovarianceEstimationType::LAPLACE_APPROXIMATION) {
+    return estimate_covariance_by_laplace_approximation(ndt_result);
+  }
+
   Eigen::Matrix2d rot = Eigen::Matrix2d::Identity();
   try {
     rot = find_rotation_matrix_aligning_covariance_to_principal_axes(
@@ -771,19 +880,42 @@ std::array<double, 36> NDTScanMatcher::estimate_covariance(
   multi_ndt_result_msg.poses.push_back(matrix4f_to_pose(ndt_result.pose));
   multi_initial_pose_msg.poses.push_back(matrix4f_to_pose(initial_pose_matrix));
 
-  // multiple searches
-  for (const auto & pose_offset : initial_pose_offset_model_) {
-    const Eigen::Vector2d rotated_pose_offset_2d = rot * pose_offset;
-
-    Eigen::Matrix4f sub_initial_pose_matrix(Eigen::Matrix4f::Identity());
-    sub_initial_pose_matrix = ndt_result.pose;
-    sub_initial_pose_matrix(0, 3) += static_cast<float>(rotated_pose_offset_2d.x());
-    sub_initial_pose_matrix(1, 3) += static_cast<float>(rotated_pose_offset_2d.y());
+  // multiple searches, which are run concurrently on copies of the NDT in the batched mode
+  const int num_offsets = static_cast<int>(initial_pose_offset_model_.size());
+  std::vector<Eigen::Matrix4f> sub_initial_pose_matrices(num_offsets);
+  std::vector<Eigen::Matrix4f> sub_ndt_results(num_offsets);
+  for (int i = 0; i < num_offsets; i++) {
+    const Eigen::Vector2d rotated_pose_offset_2d = rot * initial_pose_offset_model_[i];
+    sub_initial_pose_matrices[i] = ndt_result.pose;
+    sub_initial_pose_matrices[i](0, 3) += static_cast<float>(rotated_pose_offset_2d.x());
+    sub_initial_pose_matrices[i](1, 3) += static_cast<float>(rotated_pose_offset_2d.y());
+  }
 
-    auto sub_output_cloud = std::make_shared<pcl::PointCloud<PointSource>>();
-    ndt_ptr_->align(*sub_output_cloud, sub_initial_pose_matrix);
-    const Eigen::Matrix4f sub_ndt_result = ndt_ptr_->getResult().pose;
+  const int batch_size = std::max(std::min(covariance_estimation_batch_size_, num_offsets), 1);
+  const std::vector<std::shared_ptr<NormalDistributionsTransform>> ndt_ptrs =
+    get_covariance_ndt_ptrs(batch_size);
+  const auto align = [&](const int k) {
+    pcl::PointCloud<PointSource> sub_output_cloud;
+    for (int i = k; i < num_offsets; i += batch_size) {
+      ndt_ptrs[k]->align(sub_output_cloud, sub_initial_pose_matrices[i]);
+      sub_ndt_results[i] = ndt_ptrs[k]->getResult().pose;
+    }
+  };
+  if (batch_size == 1) {
+    align(0);
+  } else {
+    std::vector<std::thread> align_threads;
+    for (int k = 0; k < batch_size; k++) {
+      align_threads.emplace_back(align, k);
+    }
+    for (auto & align_thread : align_threads) {
+      align_thread.join();
+    }
+  }
 
+  for (int i = 0; i < num_offsets; i++) {
+    const Eigen::Matrix4f & sub_initial_pose_matrix = sub_initial_pose_matrices[i];
+    const Eigen::Matrix4f & sub_ndt_result = sub_ndt_results[i];
     const Eigen::Vector2d sub_ndt_pose_2d = sub_ndt_result.topRightCorner<2, 1>().cast<double>();
     mean += sub_ndt_pose_2d;
     ndt_pose_2d_vec.emplace_back(sub_ndt_pose_2d);
@@ -813,6 +945,64 @@ std::array<double, 36> NDTScanMatcher::estimate_covariance(
   return ndt_covariance;
 }
 
+std::array<double, 36> NDTScanMatcher::estimate_covariance_by_laplace_approximation(
+  const pclomp::NdtResult & ndt_result)
+{
+  // The score is maximized at convergence, where its Hessian is negative definite. The inverse of
+  // its negation approximates the covariance of the pose without any further search.
+  const Eigen::Matrix<double, 6, 6> information = -ndt_result.hessian;
+  const Eigen::LLT<Eigen::Matrix<double, 6, 6>> llt(information);
+  if (llt.info() != Eigen::Success) {
+    RCLCPP_WARN_STREAM_THROTTLE(
+      this->get_logger(), *this->get_clock(), 1,
+      "The Hessian of the NDT score is not negative definite. The covariance is not estimated.");
+    return output_pose_covariance_;
+  }
+  const Eigen::Matrix2d laplace_covariance =
+    llt.solve(Eigen::Matrix<double, 6, 6>::Identity()).topLeftCorner<2, 2>();
+
+  std::array<double, 36> ndt_covariance = output_pose_covariance_;
+  ndt_covariance[0 + 6 * 0] += laplace_covariance(0, 0);
+  ndt_covariance[1 + 6 * 0] += laplace_covariance(1, 0);
+  ndt_covariance[0 + 6 * 1] += laplace_covariance(0, 1);
+  ndt_covariance[1 + 6 * 1] += laplace_covariance(1, 1);
+  return ndt_covariance;
+}
+
+std::vector<std::shared_ptr<NormalDistributionsTransform>> NDTScanMatcher::get_covariance_ndt_ptrs(
+  const int num_ndt_ptrs)
+{
+  if (num_ndt_ptrs == 1) {
+    return {ndt_ptr_};
+  }
+
+  // Each copy holds the whole map, so the copies are kept until the map update replaces ndt_ptr_
+  // instead of being made for each scan.
+  if (
+    static_cast<int>(covariance_ndt_ptrs_.size()) != num_ndt_ptrs ||
+    covariance_ndt_source_.lock() != ndt_ptr_) {
+    covariance_ndt_ptrs_.clear();
+    pclomp::NdtParams copy_ndt_params = ndt_ptr_->getParams();
+    copy_ndt_params.num_threads = std::max(copy_ndt_params.num_threads / num_ndt_ptrs, 1);
+    for (int k = 0; k < num_ndt_ptrs; k++) {
+      covariance_ndt_ptrs_.push_back(std::make_shared<NormalDistributionsTransform>(*ndt_ptr_));
+      covariance_ndt_ptrs_.back()->setParams(copy_ndt_params);
+    }
+    covariance_ndt_source_ = ndt_ptr_;
+  }
+
+  for (const auto & ndt_ptr : covariance_ndt_ptrs_) {
+    ndt_ptr->setInputSource(ndt_ptr_->getInputSource());
+    if (regularization_enabled_) {
+      ndt_ptr->unsetRegularizationPose();
+      if (regularization_pose_.has_value()) {
+        ndt_ptr->setRegularizationPose(regularization_pose_.value());
+      }
+    }
+  }
+  return covariance_ndt_ptrs_;
+}
+
 std::optional<Eigen::Matrix4f> NDTScanMatcher::interpolate_regularization_pose(
   const rclcpp::Time & sensor_ros_time)
 {
@@ -837,6 +1027,7 @@ void NDTScanMatcher::add_regularization_pose(const rclcpp::Time & sensor_ros_tim
 {
   ndt_ptr_->unsetRegularizationPose();
   std::optional<Eigen::Matrix4f> pose_opt = interpolate_regularization_pose(sensor_ros_time);
+  regularization_pose_ = pose_opt;
   if (pose_opt.has_value()) {
     ndt_ptr_->setRegularizationPose(pose_opt.value());
     RCLCPP_DEBUG_STREAM(get_logger(), "Regularization pose is set to NDT");
@@ -873,6 +1064,7 @@ void NDTScanMatcher::service_ndt_align(
 
   // mutex Map
   std::lock_guard<std::mutex> lock(ndt_ptr_mtx_);
+  set_latest_sensor_points();
 
   if (ndt_ptr_->getInputTarget() == nullptr) {
     res->success = false;
@@ -934,12 +1126,7 @@ geometry_msgs::msg::PoseWithCovarianceStamped NDTScanMatcher::align_pose(
   TreeStructuredParzenEstimator tpe(
     TreeStructuredParzenEstimator::Direction::MAXIMIZE, n_startup_trials_, is_loop_variable);
 
-  std::vector<Particle> particle_array;
-  auto output_cloud = std::make_shared<pcl::PointCloud<PointSource>>();
-
-  for (int i = 0; i < initial_estimate_particles_num_; i++) {
-    const TreeStructuredParzenEstimator::Input input = tpe.get_next_input();
-
+  const auto input_to_initial_pose = [&](const TreeStructuredParzenEstimator::Input & input) {
     geometry_msgs::msg::Pose initial_pose;
     initial_pose.position.x =
       initial_pose_with_cov.pose.pose.position.x + uniform_to_normal(input[0]) * stddev_x;
@@ -954,21 +1141,10 @@ geometry_msgs::msg::PoseWithCovarianceStamped NDTScanMatcher::align_pose(
     tf2::Quaternion tf_quaternion;
     tf_quaternion.setRPY(init_rpy.x, init_rpy.y, init_rpy.z);
     initial_pose.orientation = tf2::toMsg(tf_quaternion);
+    return initial_pose;
+  };
 
-    const Eigen::Matrix4f initial_pose_matrix = pose_to_matrix4f(initial_pose);
-    ndt_ptr_->align(*output_cloud, initial_pose_matrix);
-    const pclomp::NdtResult ndt_result = ndt_ptr_->getResult();
-
-    Particle particle(
-      initial_pose, matrix4f_to_pose(ndt_result.pose), ndt_result.transform_probability,
-      ndt_result.iteration_num);
-    particle_array.push_back(particle);
-    const auto marker_array = make_debug_markers(
-      get_clock()->now(), map_frame_, tier4_autoware_utils::createMarkerScale(0.3, 0.1, 0.1),
-      particle, i);
-    ndt_monte_carlo_initial_pose_marker_pub_->publish(marker_array);
-
-    const geometry_msgs::msg::Pose pose = matrix4f_to_pose(ndt_result.pose);
+  const auto result_pose_to_input = [&](const geometry_msgs::msg::Pose & pose) {
     const geometry_msgs::msg::Vector3 rpy = get_rpy(pose);
 
     const double diff_x = pose.position.x - initial_pose_with_cov.pose.pose.position.x;
@@ -987,11 +1163,82 @@ geometry_msgs::msg::PoseWithCovarianceStamped NDTScanMatcher::align_pose(
     result[3] = normal_to_uniform(diff_roll / stddev_roll);
     result[4] = normal_to_uniform(diff_pitch / stddev_pitch);
     result[5] = diff_yaw / M_PI;
-    tpe.add_trial(TreeStructuredParzenEstimator::Trial{result, ndt_result.transform_probability});
+    return result;
+  };
+
+  // In the batched mode, the particles of a batch are drawn from the TPE at once and aligned
+  // concurrently, each on its own copy of the NDT. The threads of ndt_omp are shared among them.
+  const int batch_size =
+    std::max(std::min(initial_estimate_particles_batch_size_, initial_estimate_particles_num_), 1);
+  std::vector<std::shared_ptr<NormalDistributionsTransform>> ndt_ptrs;
+  if (batch_size == 1) {
+    ndt_ptrs.push_back(ndt_ptr_);
+  } else {
+    pclomp::NdtParams batch_ndt_params = ndt_ptr_->getParams();
+    batch_ndt_params.num_threads = std::max(batch_ndt_params.num_threads / batch_size, 1);
+    for (int k = 0; k < batch_size; k++) {
+      ndt_ptrs.push_back(std::make_shared<NormalDistributionsTransform>(*ndt_ptr_));
+      ndt_ptrs.back()->setParams(batch_ndt_params);
+    }
+  }
+
+  std::vector<Particle> particle_array;
+  std::vector<pcl::PointCloud<PointSource>> output_clouds(batch_size);
+  std::vector<geometry_msgs::msg::Pose> initial_poses(batch_size);
+  std::vector<pclomp::NdtResult> ndt_results(batch_size);
+
+  for (int begin = 0; begin < initial_estimate_particles_num_; begin += batch_size) {
+    const int num_particles = std::min(batch_size, initial_estimate_particles_num_ - begin);
+    for (int k = 0; k < num_particles; k++) {
+      initial_poses[k] = input_to_initial_pose(tpe.get_next_input());
+    }
+
+    const auto align = [&](const int k) {
+      const Eigen::Matrix4f initial_pose_matrix = pose_to_matrix4f(initial_poses[k]);
+      ndt_ptrs[k]->align(output_clouds[k], initial_pose_matrix);
+      ndt_results[k] = ndt_ptrs[k]->getResult();
+    };
+    if (num_particles == 1) {
+      align(0);
+    } else {
+      std::vector<std::thread> align_threads;
+      for (int k = 0; k < num_particles; k++) {
+        align_threads.emplace_back(align, k);
+      }
+      for (auto & align_thread : align_threads) {
+        align_thread.join();
+      }
+    }
+
+    visualization_msgs::msg::MarkerArray marker_array;
+    int best_k = 0;
+    for (int k = 0; k < num_particles; k++) {
+      const pclomp::NdtResult & ndt_result = ndt_results[k];
+      const geometry_msgs::msg::Pose pose = matrix4f_to_pose(ndt_result.pose);
+
+      Particle particle(
+        initial_poses[k], pose, ndt_result.transform_probability, ndt_result.iteration_num);
+      particle_array.push_back(particle);
+      const auto particle_marker_array = make_debug_markers(
+        get_clock()->now(), map_frame_, tier4_autoware_utils::createMarkerScale(0.3, 0.1, 0.1),
+        particle, begin + k);
+      marker_array.markers.insert(
+        marker_array.markers.end(), particle_marker_array.markers.begin(),
+        particle_marker_array.markers.end());
+
+      tpe.add_trial(TreeStructuredParzenEstimator::Trial{
+        result_pose_to_input(pose), ndt_result.transform_probability});
+
+      if (ndt_results[best_k].transform_probability < ndt_result.transform_probability) {
+        best_k = k;
+      }
+    }
+    ndt_monte_carlo_initial_pose_marker_pub_->publish(marker_array);
 
+    // the aligned scan of the best particle of the batch
     auto sensor_points_in_map_ptr = std::make_shared<pcl::PointCloud<PointSource>>();
     tier4_autoware_utils::transformPointCloud(
-      *ndt_ptr_->getInputSource(), *sensor_points_in_map_ptr, ndt_result.pose);
+      *ndt_ptr_->getInputSource(), *sensor_points_in_map_ptr, ndt_results[best_k].pose);
     publish_point_cloud(initial_pose_with_cov.header.stamp, map_frame_, sensor_points_in_map_ptr);
   }
 
@@ -23,6 +23,7 @@
 #include "yabloc_module.hpp"
 
 #include <memory>
+#include <optional>
 #include <vector>
 
 PoseInitializer::PoseInitializer() : Node("pose_initializer")
@@ -49,6 +50,7 @@ PoseInitializer::PoseInitializer() : Node("pose_initializer")
     ndt_ = std::make_unique<NdtModule>(this);
     ndt_localization_trigger_ = std::make_unique<NdtLocalizationTriggerModule>(this);
   }
+  parallel_align_enabled_ = declare_parameter<bool>("parallel_align_enabled");
   if (declare_parameter<bool>("stop_check_enabled")) {
     // Add 1.0 sec margin for twist buffer.
     stop_check_duration_ = declare_parameter<double>("stop_check_duration");
@@ -89,7 +91,9 @@ void PoseInitializer::on_initialize(
       ndt_localization_trigger_->send_request(false);
     }
     auto pose = req->pose.empty() ? get_gnss_pose() : req->pose.front();
-    if (ndt_) {
+    if (ndt_ && yabloc_ && parallel_align_enabled_) {
+      pose = align_pose_in_parallel(pose);
+    } else if (ndt_) {
       pose = ndt_->align_pose(pose);
     } else if (yabloc_) {
       // If both the NDT and YabLoc initializer are enabled, prioritize NDT as it offers more
@@ -112,6 +116,29 @@ void PoseInitializer::on_initialize(
   }
 }
 
+geometry_msgs::msg::PoseWithCovarianceStamped PoseInitializer::align_pose_in_parallel(
+  const PoseWithCovarianceStamped & pose)
+{
+  // Send the requests to both servers at once so that the YabLoc result is ready without waiting
+  // for another alignment when NDT fails. NDT is prioritized as it offers more accuracy pose.
+  std::optional<YabLocModule::AlignFuture> yabloc_future;
+  try {
+    yabloc_future = yabloc_->send_align_request(pose);
+  } catch (const ServiceException & error) {
+    RCLCPP_WARN(get_logger(), "%s", error.status().message.c_str());
+  }
+
+  try {
+    return ndt_->align_pose(pose);
+  } catch (const ServiceException &) {
+    if (!yabloc_future) {
+      throw;
+    }
+    RCLCPP_WARN(get_logger(), "Use the YabLoc result since the NDT alignment failed.");
+  }
+  return yabloc_->get_aligned_pose(*yabloc_future);
+}
+
 geometry_msgs::msg::PoseWithCovarianceStamped PoseInitializer::get_gnss_pose()
 {
   if (gnss_) {
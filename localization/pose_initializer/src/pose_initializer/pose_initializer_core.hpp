@@ -58,10 +58,12 @@ private:
   std::unique_ptr<NdtLocalizationTriggerModule> ndt_localization_trigger_;
   std::unique_ptr<tier4_autoware_utils::LoggerLevelConfigure> logger_configure_;
   double stop_check_duration_;
+  bool parallel_align_enabled_;
   void change_state(State::Message::_state_type state);
   void on_initialize(
     const Initialize::Service::Request::SharedPtr req,
     const Initialize::Service::Response::SharedPtr res);
+  PoseWithCovarianceStamped align_pose_in_parallel(const PoseWithCovarianceStamped & pose);
   PoseWithCovarianceStamped get_gnss_pose();
 };
 
@@ -27,8 +27,11 @@ private:
   using RequestPoseAlignment = tier4_localization_msgs::srv::PoseWithCovarianceStamped;
 
 public:
+  using AlignFuture = rclcpp::Client<RequestPoseAlignment>::SharedFuture;
   explicit YabLocModule(rclcpp::Node * node);
   PoseWithCovarianceStamped align_pose(const PoseWithCovarianceStamped & pose);
+  AlignFuture send_align_request(const PoseWithCovarianceStamped & pose);
+  PoseWithCovarianceStamped get_aligned_pose(const AlignFuture & future);
 
 private:
   rclcpp::Logger logger_;
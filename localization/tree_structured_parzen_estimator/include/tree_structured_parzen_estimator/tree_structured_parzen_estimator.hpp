@@ -63,13 +63,31 @@ private:
   static std::uniform_real_distribution<double> dist_uniform;
   static std::normal_distribution<double> dist_normal;
 
-  double compute_log_likelihood_ratio(const Input & input) const;
+  struct Kernel
+  {
+    Input inv_two_variance;  // 1 / (2 * sigma^2) of each dimension
+    double log_normalizer;   // sum of -log(sqrt(2 * pi) * sigma) of each dimension
+  };
+
+  void update_kernels();
+  Kernel make_kernel(const double coeff) const;
+  double compute_log_likelihood_ratio(const Input & input, std::vector<double> & log_terms) const;
+  double log_kernel_pdf(const Input & input, const double * mu, const Kernel & kernel) const;
   double log_gaussian_pdf(const Input & input, const Input & mu, const Input & sigma) const;
   static std::vector<double> get_weights(const int64_t n);
   static double normalize_loop_variable(const double value);
 
-  std::vector<Trial> trials_;
+  std::vector<Trial> trials_;  // sorted from the best score
   int64_t above_num_;
+
+  // The kernels only change when a trial is added, so they are updated in add_trial() instead of
+  // being rebuilt for each candidate of get_next_input().
+  std::vector<double> sorted_inputs_;  // inputs of trials_, contiguous in the same order
+  std::vector<double> log_weights_;    // normalized log weight of the kernel of each trial
+  Kernel above_kernel_;
+  Kernel below_kernel_;
+  double above_coeff_;
+  double log_prior_weight_;
   const Direction direction_;
   const int64_t n_startup_trials_;
   const int64_t input_dimension_;
@@ -28,6 +28,8 @@ std::normal_distribution<double> TreeStructuredParzenEstimator::dist_normal(0.0,
 TreeStructuredParzenEstimator::TreeStructuredParzenEstimator(
   const Direction direction, const int64_t n_startup_trials, std::vector<bool> is_loop_variable)
 : above_num_(0),
+  above_coeff_(0.0),
+  log_prior_weight_(0.0),
   direction_(direction),
   n_startup_trials_(n_startup_trials),
   input_dimension_(is_loop_variable.size()),
@@ -38,12 +40,65 @@ TreeStructuredParzenEstimator::TreeStructuredParzenEstimator(
 
 void TreeStructuredParzenEstimator::add_trial(const Trial & trial)
 {
-  trials_.push_back(trial);
-  std::sort(trials_.begin(), trials_.end(), [this](const Trial & lhs, const Trial & rhs) {
+  // trials_ is kept sorted, so the trial is inserted after the ones which are not worse
+  const auto is_better = [this](const Trial & lhs, const Trial & rhs) {
     return (direction_ == Direction::MAXIMIZE ? lhs.score > rhs.score : lhs.score < rhs.score);
-  });
+  };
+  const auto position = std::upper_bound(trials_.begin(), trials_.end(), trial, is_better);
+  const int64_t index = std::distance(trials_.begin(), position);
+  trials_.insert(position, trial);
+  sorted_inputs_.insert(
+    sorted_inputs_.begin() + index * input_dimension_, trial.input.begin(), trial.input.end());
   above_num_ =
     std::min(static_cast<int64_t>(25), static_cast<int64_t>(trials_.size() * MAX_GOOD_RATE));
+  update_kernels();
+}
+
+void TreeStructuredParzenEstimator::update_kernels()
+{
+  if (above_num_ == 0) {
+    return;
+  }
+  const int64_t n = trials_.size();
+
+  // Scott's rule
+  above_coeff_ = BASE_STDDEV_COEFF * std::pow(above_num_, -1.0 / (4 + input_dimension_));
+  const double below_coeff =
+    BASE_STDDEV_COEFF * std::pow(n - above_num_, -1.0 / (4 + input_dimension_));
+  above_kernel_ = make_kernel(above_coeff_);
+  below_kernel_ = make_kernel(below_coeff);
+
+  std::vector<double> above_weights = get_weights(above_num_);
+  std::vector<double> below_weights = get_weights(n - above_num_);
+  std::reverse(below_weights.begin(), below_weights.end());  // below_weights is ascending order
+
+  // calculate the sum of weights to normalize
+  double above_sum = std::accumulate(above_weights.begin(), above_weights.end(), 0.0);
+  double below_sum = std::accumulate(below_weights.begin(), below_weights.end(), 0.0);
+
+  // above includes prior
+  above_sum += PRIOR_WEIGHT;
+
+  log_prior_weight_ = std::log(PRIOR_WEIGHT / above_sum);
+  log_weights_.resize(n);
+  for (int64_t i = 0; i < n; i++) {
+    log_weights_[i] =
+      (i < above_num_ ? std::log(above_weights[i] / above_sum)
+                      : std::log(below_weights[i - above_num_] / below_sum));
+  }
+}
+
+TreeStructuredParzenEstimator::Kernel TreeStructuredParzenEstimator::make_kernel(
+  const double coeff) const
+{
+  const double log_2pi = std::log(2.0 * M_PI);
+  Kernel kernel{Input(input_dimension_), 0.0};
+  for (int64_t j = 0; j < input_dimension_; j++) {
+    const double sigma = base_stddev_[j] * coeff;
+    kernel.inv_two_variance[j] = 1.0 / (2.0 * sigma * sigma);
+    kernel.log_normalizer += -0.5 * log_2pi - std::log(sigma);
+  }
+  return kernel;
 }
 
 TreeStructuredParzenEstimator::Input TreeStructuredParzenEstimator::get_next_input() const
@@ -58,33 +113,25 @@ TreeStructuredParzenEstimator::Input TreeStructuredParzenEstimator::get_next_inp
   }
 
   Input best_input;
+  Input input(input_dimension_);
+  std::vector<double> log_terms(trials_.size());
   double best_log_likelihood_ratio = std::numeric_limits<double>::lowest();
-  const double coeff = BASE_STDDEV_COEFF * std::pow(above_num_, -1.0 / (4 + input_dimension_));
   std::vector<double> weights = get_weights(above_num_);
   weights.push_back(PRIOR_WEIGHT);
   std::discrete_distribution<int64_t> dist(weights.begin(), weights.end());
   for (int64_t i = 0; i < N_EI_CANDIDATES; i++) {
-    Input mu, sigma;
     const int64_t index = dist(engine);
-    if (index == above_num_) {
-      mu = Input(input_dimension_, 0.0);
-      sigma = base_stddev_;
-    } else {
-      mu = trials_[index].input;
-      sigma = base_stddev_;
-      for (int64_t j = 0; j < input_dimension_; j++) {
-        sigma[j] *= coeff;
-      }
-    }
+    const bool is_prior = (index == above_num_);
     // sample from the normal distribution
-    Input input(input_dimension_);
     for (int64_t j = 0; j < input_dimension_; j++) {
-      input[j] = mu[j] + dist_normal(engine) * sigma[j];
+      const double mu = (is_prior ? 0.0 : sorted_inputs_[index * input_dimension_ + j]);
+      const double sigma = (is_prior ? base_stddev_[j] : base_stddev_[j] * above_coeff_);
+      input[j] = mu + dist_normal(engine) * sigma;
       input[j] =
         (is_loop_variable_[j] ? normalize_loop_variable(input[j])
                               : std::clamp(input[j], MIN_VALUE, MAX_VALUE));
     }
-    const double log_likelihood_ratio = compute_log_likelihood_ratio(input);
+    const double log_likelihood_ratio = compute_log_likelihood_ratio(input, log_terms);
     if (log_likelihood_ratio > best_log_likelihood_ratio) {
       best_log_likelihood_ratio = log_likelihood_ratio;
       best_input = input;
@@ -93,74 +140,57 @@ TreeStructuredParzenEstimator::Input TreeStructuredParzenEstimator::get_next_inp
   return best_input;
 }
 
-double TreeStructuredParzenEstimator::compute_log_likelihood_ratio(const Input & input) const
+double TreeStructuredParzenEstimator::compute_log_likelihood_ratio(
+  const Input & input, std::vector<double> & log_terms) const
 {
   const int64_t n = trials_.size();
 
   // The above KDE and the below KDE are calculated respectively, and the ratio is the criteria to
   // select best sample.
-  std::vector<double> above_logs;
-  std::vector<double> below_logs;
-
-  // Scott's rule
-  const double coeff_above =
-    BASE_STDDEV_COEFF * std::pow(above_num_, -1.0 / (4 + input_dimension_));
-  const double coeff_below =
-    BASE_STDDEV_COEFF * std::pow(n - above_num_, -1.0 / (4 + input_dimension_));
-  Input sigma_above = base_stddev_;
-  Input sigma_below = base_stddev_;
-  for (int64_t j = 0; j < input_dimension_; j++) {
-    sigma_above[j] *= coeff_above;
-    sigma_below[j] *= coeff_below;
+  for (int64_t i = 0; i < n; i++) {
+    const Kernel & kernel = (i < above_num_ ? above_kernel_ : below_kernel_);
+    log_terms[i] =
+      log_kernel_pdf(input, sorted_inputs_.data() + i * input_dimension_, kernel) + log_weights_[i];
   }
 
-  std::vector<double> above_weights = get_weights(above_num_);
-  std::vector<double> below_weights = get_weights(n - above_num_);
-  std::reverse(below_weights.begin(), below_weights.end());  // below_weights is ascending order
-
-  // calculate the sum of weights to normalize
-  double above_sum = std::accumulate(above_weights.begin(), above_weights.end(), 0.0);
-  double below_sum = std::accumulate(below_weights.begin(), below_weights.end(), 0.0);
-
-  // above includes prior
-  above_sum += PRIOR_WEIGHT;
-
-  for (int64_t i = 0; i < n; i++) {
-    if (i < above_num_) {
-      const double log_p = log_gaussian_pdf(input, trials_[i].input, sigma_above);
-      const double w = above_weights[i] / above_sum;
-      const double log_w = std::log(w);
-      above_logs.push_back(log_p + log_w);
-    } else {
-      const double log_p = log_gaussian_pdf(input, trials_[i].input, sigma_below);
-      const double w = below_weights[i - above_num_] / below_sum;
-      const double log_w = std::log(w);
-      below_logs.push_back(log_p + log_w);
+  auto log_sum_exp = [](const double * begin, const double * end) {
+    const double max = *std::max_element(begin, end);
+    double sum = 0.0;
+    for (const double * log_v = begin; log_v != end; ++log_v) {
+      sum += std::exp(*log_v - max);
     }
-  }
+    return max + std::log(sum);
+  };
+
+  double above = log_sum_exp(log_terms.data(), log_terms.data() + above_num_);
+  const double below = log_sum_exp(log_terms.data() + above_num_, log_terms.data() + n);
 
   // prior
   if (PRIOR_WEIGHT > 0.0) {
     const double log_p = log_gaussian_pdf(input, Input(input_dimension_, 0.0), base_stddev_);
-    const double log_w = std::log(PRIOR_WEIGHT / above_sum);
-    above_logs.push_back(log_p + log_w);
+    const double log_prior = log_p + log_prior_weight_;
+    const double max = std::max(above, log_prior);
+    above = max + std::log(std::exp(above - max) + std::exp(log_prior - max));
   }
 
-  auto log_sum_exp = [](const std::vector<double> & log_vec) {
-    const double max = *std::max_element(log_vec.begin(), log_vec.end());
-    double sum = 0.0;
-    for (const double log_v : log_vec) {
-      sum += std::exp(log_v - max);
-    }
-    return max + std::log(sum);
-  };
-
-  const double above = log_sum_exp(above_logs);
-  const double below = log_sum_exp(below_logs);
   const double r = above - below;
   return r;
 }
 
+double TreeStructuredParzenEstimator::log_kernel_pdf(
+  const Input & input, const double * mu, const Kernel & kernel) const
+{
+  double result = kernel.log_normalizer;
+  for (int64_t i = 0; i < input_dimension_; i++) {
+    double diff = input[i] - mu[i];
+    if (is_loop_variable_[i]) {
+      diff = normalize_loop_variable(diff);
+    }
+    result -= diff * diff * kernel.inv_two_variance[i];
+  }
+  return result;
+}
+
 double TreeStructuredParzenEstimator::log_gaussian_pdf(
   const Input & input, const Input & mu, const Input & sigma) const
 {
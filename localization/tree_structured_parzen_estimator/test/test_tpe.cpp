@@ -63,3 +63,27 @@ TEST(TreeStructuredParzenEstimatorTest, TPE_is_better_than_random_search_on_sphe
   }
   ASSERT_LT(mean_scores[0], mean_scores[1]);
 }
+
+TEST(TreeStructuredParzenEstimatorTest, TPE_minimizes_with_loop_variables)
+{
+  // the minimum of a function of a loop variable is across the wrap of [-1, 1)
+  auto function = [](const TreeStructuredParzenEstimator::Input & input) {
+    const double loop_diff = std::abs(input[0]) - 1.0;
+    return loop_diff * loop_diff + input[1] * input[1];
+  };
+
+  constexpr int64_t kTrialsNum = 100;
+  TreeStructuredParzenEstimator estimator(
+    TreeStructuredParzenEstimator::Direction::MINIMIZE, kTrialsNum / 10, {true, false});
+  double best_score = std::numeric_limits<double>::max();
+  for (int64_t trial = 0; trial < kTrialsNum; trial++) {
+    const TreeStructuredParzenEstimator::Input input = estimator.get_next_input();
+    ASSERT_EQ(input.size(), 2u);
+    EXPECT_LE(-1.0, input[0]);
+    EXPECT_LT(input[0], 1.0);
+    const double score = function(input);
+    estimator.add_trial({input, score});
+    best_score = std::min(best_score, score);
+  }
+  EXPECT_LT(best_score, 0.05);
+}
@@ -26,6 +26,11 @@
 
 #include <cv_bridge/cv_bridge.h>
 
+#ifdef YABLOC_OPENCV_CUDA
+#include <opencv4/opencv2/core/cuda.hpp>
+#include <opencv4/opencv2/cudawarping.hpp>
+#endif
+
 #include <optional>
 
 namespace yabloc::undistort
@@ -40,10 +45,23 @@ public:
   UndistortNode()
   : Node("undistort"),
     OUTPUT_WIDTH(declare_parameter<int>("width")),
-    OVERRIDE_FRAME_ID(declare_parameter<std::string>("override_frame_id"))
+    OVERRIDE_FRAME_ID(declare_parameter<std::string>("override_frame_id")),
+    use_cuda_(declare_parameter<bool>("use_cuda", false))
   {
     using std::placeholders::_1;
 
+#ifdef YABLOC_OPENCV_CUDA
+    if (use_cuda_ && cv::cuda::getCudaEnabledDeviceCount() == 0) {
+      RCLCPP_WARN_STREAM(get_logger(), "no CUDA device is found, the CPU remap is used");
+      use_cuda_ = false;
+    }
+#else
+    if (use_cuda_) {
+      RCLCPP_WARN_STREAM(get_logger(), "built without OpenCV CUDA, the CPU remap is used");
+      use_cuda_ = false;
+    }
+#endif
+
     rclcpp::QoS qos{10};
     if (declare_parameter<bool>("use_sensor_qos")) {
       qos = rclcpp::QoS(10).durability_volatile().best_effort();
@@ -74,7 +92,13 @@ private:
   std::optional<CameraInfo> info_{std::nullopt};
   std::optional<CameraInfo> scaled_info_{std::nullopt};
 
+  bool use_cuda_;
   cv::Mat undistort_map_x, undistort_map_y;
+#ifdef YABLOC_OPENCV_CUDA
+  // the maps are uploaded once, and the device buffers are reused by each image
+  cv::cuda::GpuMat gpu_map_x_, gpu_map_y_;
+  cv::cuda::GpuMat gpu_image_, gpu_undistorted_image_;
+#endif
 
   void make_remap_lut()
   {
@@ -91,6 +115,12 @@ private:
 
     cv::initUndistortRectifyMap(
       K, D, cv::Mat(), new_K, new_size, CV_32FC1, undistort_map_x, undistort_map_y);
+#ifdef YABLOC_OPENCV_CUDA
+    if (use_cuda_) {
+      gpu_map_x_.upload(undistort_map_x);
+      gpu_map_y_.upload(undistort_map_y);
+    }
+#endif
 
     scaled_info_ = sensor_msgs::msg::CameraInfo{};
     scaled_info_->k.at(0) = new_K.at<double>(0, 0);
@@ -103,10 +133,25 @@ private:
     scaled_info_->height = new_size.height;
   }
 
-  void remap_and_publish(const cv::Mat & image, const std_msgs::msg::Header & header)
+  cv::Mat remap(const cv::Mat & image)
   {
     cv::Mat undistorted_image;
+#ifdef YABLOC_OPENCV_CUDA
+    if (use_cuda_) {
+      gpu_image_.upload(image);
+      cv::cuda::remap(
+        gpu_image_, gpu_undistorted_image_, gpu_map_x_, gpu_map_y_, cv::INTER_LINEAR);
+      gpu_undistorted_image_.download(undistorted_image);
+      return undistorted_image;
+    }
+#endif
     cv::remap(image, undistorted_image, undistort_map_x, undistort_map_y, cv::INTER_LINEAR);
+    return undistorted_image;
+  }
+
+  void remap_and_publish(const cv::Mat & image, const std_msgs::msg::Header & header)
+  {
+    const cv::Mat undistorted_image = remap(image);
 
     // Publish CameraInfo
     {
@@ -16,6 +16,7 @@
 #define YABLOC_PARTICLE_FILTER__CAMERA_CORRECTOR__CAMERA_PARTICLE_CORRECTOR_HPP_
 
 #include <opencv4/opencv2/core.hpp>
+#include <sophus/geometry.hpp>
 #include <yabloc_particle_filter/correction/abstract_corrector.hpp>
 #include <yabloc_particle_filter/ll2_cost_map/hierarchical_cost_map.hpp>
 
@@ -29,7 +30,9 @@
 #include <pcl/point_cloud.h>
 #include <pcl/point_types.h>
 
+#include <array>
 #include <utility>
+#include <vector>
 
 namespace yabloc::modularized_particle_filter
 {
@@ -52,8 +55,18 @@ public:
   CameraParticleCorrector();
 
 private:
+  // Points sampled every 0.1 m along the line segments in the base frame, which are the same for
+  // all the particles
+  struct LineSegmentSamples
+  {
+    Eigen::Matrix3Xf points;
+    Eigen::Matrix3Xf tangents;   // tangent of the line segment of each point
+    std::vector<float> weights;  // 1 for apriori line segments, 0.2 for posteriori ones
+  };
+
   const float min_prob_;
   const float far_weight_gain_;
+  const float cost_map_prefetch_distance_;
   HierarchicalCostMap cost_map_;
 
   rclcpp::Subscription<PointCloud2>::SharedPtr sub_bounding_box_;
@@ -76,6 +89,10 @@ private:
 
   bool enable_switch_{true};
 
+  // direction of each angle of the cost map, for abs_cos()
+  std::array<Eigen::Vector2f, 256> angle_directions_;
+  std::vector<CostMapValue> cost_map_values_;
+
   void on_line_segments(const PointCloud2 & msg);
   void on_ll2(const PointCloud2 & msg);
   void on_bounding_box(const PointCloud2 & msg);
@@ -85,8 +102,9 @@ private:
 
   std::pair<LineSegments, LineSegments> split_line_segments(const PointCloud2 & msg);
 
-  float compute_logit(
-    const LineSegments & line_segments_cloud, const Eigen::Vector3f & self_position);
+  LineSegmentSamples sample_line_segments(const LineSegments & line_segments_cloud) const;
+
+  float compute_logit(const LineSegmentSamples & samples, const Sophus::SE3f & transform);
 
   pcl::PointCloud<pcl::PointXYZI> evaluate_cloud(
     const LineSegments & line_segments_cloud, const Eigen::Vector3f & self_position);
@@ -29,7 +29,12 @@
 #include <pcl/point_cloud.h>
 #include <pcl/point_types.h>
 
+#include <condition_variable>
+#include <deque>
 #include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
 #include <unordered_map>
 #include <vector>
 
@@ -102,6 +107,7 @@ public:
   using BgPolygon = boost::geometry::model::polygon<BgPoint>;
 
   explicit HierarchicalCostMap(rclcpp::Node * node);
+  ~HierarchicalCostMap();
 
   void set_cloud(const pcl::PointCloud<pcl::PointNormal> & cloud);
   void set_bounding_box(const pcl::PointCloud<pcl::PointXYZL> & cloud);
@@ -114,34 +120,87 @@ public:
    */
   CostMapValue at(const Eigen::Vector2f & position);
 
+  /**
+   * Get pixel values at specified pixels, looking the map of an area up once for consecutive
+   * positions in the same area
+   *
+   * @param[in] positions Real scale positions at world frame
+   * @param[out] values The same values as at() for each position
+   */
+  void at(
+    const Eigen::Ref<const Eigen::Matrix2Xf> & positions, std::vector<CostMapValue> & values);
+
   MarkerArray show_map_range() const;
 
   cv::Mat get_map_image(const Pose & pose);
 
+  /**
+   * Erase the least recently used maps beyond the memory limit
+   */
   void erase_obsolete();
 
   void set_height(float height);
 
+  /**
+   * Build the maps along a straight trajectory in background, so that at() does not build them
+   *
+   * @param[in] position Real scale start position of the trajectory at world frame
+   * @param[in] direction Direction of the trajectory
+   * @param[in] distance Length of the trajectory [m]
+   */
+  void prefetch(
+    const Eigen::Vector2f & position, const Eigen::Vector2f & direction, float distance);
+
 private:
+  // Inputs of building a map, which are shared with the prefetch thread
+  struct MapSources
+  {
+    std::shared_ptr<const pcl::PointCloud<pcl::PointNormal>> cloud;
+    std::shared_ptr<const std::vector<BgPolygon>> bounding_boxes;
+    std::optional<float> height;
+  };
+
+  struct PrefetchRequest
+  {
+    Area area;
+    MapSources sources;
+    int generation;
+  };
+
   const float max_range_;
   const float image_size_;
-  const size_t max_map_count_;
+  size_t max_map_count_;
   rclcpp::Logger logger_;
   std::optional<float> height_{std::nullopt};
 
   common::GammaConverter gamma_converter{4.0f};
 
-  std::unordered_map<Area, bool, Area> map_accessed_;
-
+  // the maps from the least recently used one to the most recently used one
   std::list<Area> generated_map_history_;
-  std::optional<pcl::PointCloud<pcl::PointNormal>> cloud_;
-  std::vector<BgPolygon> bounding_boxes_;
+  std::unordered_map<Area, std::list<Area>::iterator, Area> history_iterators_;
+  std::shared_ptr<const pcl::PointCloud<pcl::PointNormal>> cloud_;
+  std::shared_ptr<const std::vector<BgPolygon>> bounding_boxes_;
   std::unordered_map<Area, cv::Mat, Area> cost_maps_;
 
+  // The prefetch thread builds the requested maps into prefetched_maps_, from which they are moved
+  // into cost_maps_. The maps of an older generation, which set_height() cleared, are dropped.
+  std::mutex prefetch_mutex_;
+  std::condition_variable prefetch_condition_;
+  std::deque<PrefetchRequest> prefetch_requests_;
+  std::unordered_map<Area, bool, Area> prefetch_requested_;
+  std::unordered_map<Area, cv::Mat, Area> prefetched_maps_;
+  int map_generation_{0};
+  bool is_prefetch_stopped_{false};
+  std::thread prefetch_thread_;
+
   cv::Point to_cv_point(const Area & are, const Eigen::Vector2f) const;
-  void build_map(const Area & area);
+  MapSources map_sources() const;
+  const cv::Mat & find_map(const Area & area);
+  cv::Mat build_map(const Area & area, const MapSources & sources) const;
+  void run_prefetch();
 
-  cv::Mat create_available_area_image(const Area & area) const;
+  cv::Mat create_available_area_image(
+    const Area & area, const std::vector<BgPolygon> & bounding_boxes) const;
 };
 }  // namespace yabloc
 
@@ -32,6 +32,7 @@ CameraParticleCorrector::CameraParticleCorrector()
 : AbstractCorrector("camera_particle_corrector"),
   min_prob_(declare_parameter<float>("min_prob")),
   far_weight_gain_(declare_parameter<float>("far_weight_gain")),
+  cost_map_prefetch_distance_(declare_parameter<float>("cost_map_prefetch_distance", 0.0f)),
   cost_map_(this)
 {
   using std::placeholders::_1;
@@ -39,6 +40,12 @@ CameraParticleCorrector::CameraParticleCorrector()
 
   enable_switch_ = declare_parameter<bool>("enabled_at_first");
 
+  for (std::size_t deg = 0; deg < angle_directions_.size(); ++deg) {
+    const float radian = deg * M_PI / 180.0;
+    angle_directions_[deg] =
+      Eigen::Vector2f(tier4_autoware_utils::cos(radian), tier4_autoware_utils::sin(radian));
+  }
+
   // Publication
   pub_image_ = create_publisher<Image>("~/debug/match_image", 10);
   pub_map_image_ = create_publisher<Image>("~/debug/cost_map_image", 10);
@@ -163,17 +170,23 @@ void CameraParticleCorrector::on_line_segments(const PointCloud2 & line_segments
   }
 
   cost_map_.set_height(mean_pose.position.z);
+  if (cost_map_prefetch_distance_ > 0) {
+    // the maps ahead are built in background, before the particles reach them
+    const Eigen::Affine3f mean_affine = common::pose_to_affine(mean_pose);
+    const Eigen::Vector3f heading = mean_affine.rotation() * Eigen::Vector3f::UnitX();
+    cost_map_.prefetch(
+      mean_affine.translation().topRows(2), heading.topRows(2), cost_map_prefetch_distance_);
+  }
 
   if (publish_weighted_particles) {
+    // the line segments are sampled once, and the samples are transformed for each particle
+    LineSegments all_line_segments_cloud = line_segments_cloud;
+    all_line_segments_cloud += iffy_line_segments_cloud;
+    const LineSegmentSamples samples = sample_line_segments(all_line_segments_cloud);
+
     for (auto & particle : weighted_particles.particles) {
       Sophus::SE3f transform = common::pose_to_se3(particle.pose);
-      LineSegments transformed_line_segments =
-        common::transform_line_segments(line_segments_cloud, transform);
-      LineSegments transformed_iffy_line_segments =
-        common::transform_line_segments(iffy_line_segments_cloud, transform);
-      transformed_line_segments += transformed_iffy_line_segments;
-
-      float logit = compute_logit(transformed_line_segments, transform.translation());
+      float logit = compute_logit(samples, transform);
       particle.weight = logit_to_prob(logit, 0.01f);
     }
 
@@ -263,33 +276,58 @@ float abs_cos(const Eigen::Vector3f & t, float deg)
   return std::abs(x.dot(y));
 }
 
-float CameraParticleCorrector::compute_logit(
-  const LineSegments & line_segments_cloud, const Eigen::Vector3f & self_position)
+CameraParticleCorrector::LineSegmentSamples CameraParticleCorrector::sample_line_segments(
+  const LineSegments & line_segments_cloud) const
 {
-  float logit = 0;
+  std::vector<Eigen::Vector3f> points;
+  std::vector<Eigen::Vector3f> tangents;
+  LineSegmentSamples samples;
   for (const LineSegment & pn : line_segments_cloud) {
     const Eigen::Vector3f tangent = (pn.getNormalVector3fMap() - pn.getVector3fMap()).normalized();
     const float length = (pn.getVector3fMap() - pn.getNormalVector3fMap()).norm();
 
     for (float distance = 0; distance < length; distance += 0.1f) {
-      Eigen::Vector3f p = pn.getVector3fMap() + tangent * distance;
+      points.push_back(pn.getVector3fMap() + tangent * distance);
+      tangents.push_back(tangent);
+      samples.weights.push_back(pn.label == 0 ? 0.2f : 1.0f);  // posteriori : apriori
+    }
+  }
 
-      // NOTE: Close points are prioritized
-      float squared_norm = (p - self_position).topRows(2).squaredNorm();
-      float gain = exp(-far_weight_gain_ * squared_norm);  // 0 < gain < 1
+  samples.points.resize(3, points.size());
+  samples.tangents.resize(3, tangents.size());
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    samples.points.col(i) = points[i];
+    samples.tangents.col(i) = tangents[i];
+  }
+  return samples;
+}
 
-      const CostMapValue v3 = cost_map_.at(p.topRows(2));
+float CameraParticleCorrector::compute_logit(
+  const LineSegmentSamples & samples, const Sophus::SE3f & transform)
+{
+  // all the samples are transformed at once
+  const Eigen::Matrix3f rotation = transform.rotationMatrix();
+  const Eigen::Matrix3Xf rotated_points = rotation * samples.points;
+  const Eigen::Matrix3Xf points = rotated_points.colwise() + transform.translation();
+  const Eigen::Matrix3Xf tangents = rotation * samples.tangents;
 
-      if (v3.unmapped) {
-        // logit does not change if target pixel is unmapped
-        continue;
-      }
-      if (pn.label == 0) {  // posteriori
-        logit += 0.2f * gain * (abs_cos(tangent, v3.angle) * v3.intensity - 0.5f);
-      } else {  // apriori
-        logit += gain * (abs_cos(tangent, v3.angle) * v3.intensity - 0.5f);
-      }
+  // NOTE: Close points are prioritized
+  const Eigen::ArrayXf gains =
+    (-far_weight_gain_ * rotated_points.topRows<2>().colwise().squaredNorm().array()).exp();
+
+  cost_map_.at(points.topRows<2>(), cost_map_values_);
+
+  float logit = 0;
+  for (Eigen::Index i = 0; i < points.cols(); ++i) {
+    const CostMapValue & v3 = cost_map_values_[i];
+    if (v3.unmapped) {
+      // logit does not change if target pixel is unmapped
+      continue;
     }
+    // the same as abs_cos(), with the direction of the angle looked up
+    const Eigen::Vector2f tangent_2d = tangents.col(i).topRows<2>().normalized();
+    const float abs_cos_value = std::abs(tangent_2d.dot(angle_directions_[v3.angle]));
+    logit += samples.weights[i] * gains[i] * (abs_cos_value * v3.intensity - 0.5f);
   }
   return logit;
 }
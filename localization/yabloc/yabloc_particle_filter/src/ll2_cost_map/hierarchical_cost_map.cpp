@@ -29,12 +29,29 @@ float Area::unit_length_ = -1;
 HierarchicalCostMap::HierarchicalCostMap(rclcpp::Node * node)
 : max_range_(node->declare_parameter<float>("max_range")),
   image_size_(node->declare_parameter<int>("image_size")),
-  max_map_count_(10),
-  logger_(node->get_logger())
+  logger_(node->get_logger()),
+  bounding_boxes_(std::make_shared<std::vector<BgPolygon>>())
 {
   Area::unit_length_ = max_range_;
   float gamma = node->declare_parameter<float>("gamma");
   gamma_converter.reset(gamma);
+
+  // a map has 3 channels of 8 bits
+  const double memory_limit = node->declare_parameter<double>("cost_map_memory_limit", 20.0);
+  const double map_memory = image_size_ * image_size_ * 3 * 1e-6;
+  max_map_count_ = std::max(static_cast<size_t>(memory_limit / map_memory), size_t{1});
+}
+
+HierarchicalCostMap::~HierarchicalCostMap()
+{
+  {
+    std::lock_guard<std::mutex> lock(prefetch_mutex_);
+    is_prefetch_stopped_ = true;
+  }
+  prefetch_condition_.notify_all();
+  if (prefetch_thread_.joinable()) {
+    prefetch_thread_.join();
+  }
 }
 
 cv::Point2i HierarchicalCostMap::to_cv_point(const Area & area, const Eigen::Vector2f p) const
@@ -47,28 +64,56 @@ cv::Point2i HierarchicalCostMap::to_cv_point(const Area & area, const Eigen::Vec
 
 CostMapValue HierarchicalCostMap::at(const Eigen::Vector2f & position)
 {
-  if (!cloud_.has_value()) {
+  if (cloud_ == nullptr) {
     return CostMapValue{0.5f, 0, true};
   }
 
   Area key(position);
-  if (cost_maps_.count(key) == 0) {
-    build_map(key);
-  }
-  map_accessed_[key] = true;
-
   cv::Point2i tmp = to_cv_point(key, position);
-  cv::Vec3b b3 = cost_maps_.at(key).ptr<cv::Vec3b>(tmp.y)[tmp.x];
+  cv::Vec3b b3 = find_map(key).ptr<cv::Vec3b>(tmp.y)[tmp.x];
   return {b3[0] / 255.f, b3[1], b3[2] == 1};
 }
 
+void HierarchicalCostMap::at(
+  const Eigen::Ref<const Eigen::Matrix2Xf> & positions, std::vector<CostMapValue> & values)
+{
+  values.clear();
+  if (cloud_ == nullptr) {
+    values.resize(positions.cols(), CostMapValue{0.5f, 0, true});
+    return;
+  }
+
+  values.reserve(positions.cols());
+  std::optional<Area> last_key{std::nullopt};
+  const cv::Mat * last_map = nullptr;
+  for (Eigen::Index i = 0; i < positions.cols(); ++i) {
+    const Eigen::Vector2f position = positions.col(i);
+    Area key(position);
+    if (!last_key.has_value() || key != *last_key) {
+      // the elements of unordered_map are not moved by the insertion of other ones
+      last_map = &find_map(key);
+      last_key = key;
+    }
+
+    cv::Point2i tmp = to_cv_point(key, position);
+    cv::Vec3b b3 = last_map->ptr<cv::Vec3b>(tmp.y)[tmp.x];
+    values.emplace_back(b3[0] / 255.f, b3[1], b3[2] == 1);
+  }
+}
+
 void HierarchicalCostMap::set_height(float height)
 {
   if (height_) {
     if (std::abs(*height_ - height) > 2) {
       generated_map_history_.clear();
+      history_iterators_.clear();
       cost_maps_.clear();
-      map_accessed_.clear();
+
+      std::lock_guard<std::mutex> lock(prefetch_mutex_);
+      ++map_generation_;
+      prefetch_requests_.clear();
+      prefetch_requested_.clear();
+      prefetched_maps_.clear();
     }
   }
 
@@ -78,31 +123,126 @@ void HierarchicalCostMap::set_height(float height)
 void HierarchicalCostMap::set_bounding_box(const pcl::PointCloud<pcl::PointXYZL> & cloud)
 {
   if (cloud.empty()) return;
+  auto bounding_boxes = std::make_shared<std::vector<BgPolygon>>(*bounding_boxes_);
   BgPolygon poly;
 
   std::optional<uint32_t> last_label = std::nullopt;
   for (const pcl::PointXYZL p : cloud) {
     if (last_label) {
       if ((*last_label) != p.label) {
-        bounding_boxes_.push_back(poly);
+        bounding_boxes->push_back(poly);
         poly.outer().clear();
       }
     }
     poly.outer().push_back(BgPoint(p.x, p.y));
     last_label = p.label;
   }
-  bounding_boxes_.push_back(poly);
+  bounding_boxes->push_back(poly);
+  bounding_boxes_ = bounding_boxes;
 }
 
 void HierarchicalCostMap::set_cloud(const pcl::PointCloud<pcl::PointNormal> & cloud)
 {
-  cloud_ = cloud;
+  cloud_ = std::make_shared<const pcl::PointCloud<pcl::PointNormal>>(cloud);
+}
+
+HierarchicalCostMap::MapSources HierarchicalCostMap::map_sources() const
+{
+  return {cloud_, bounding_boxes_, height_};
+}
+
+const cv::Mat & HierarchicalCostMap::find_map(const Area & area)
+{
+  auto itr = cost_maps_.find(area);
+  if (itr != cost_maps_.end()) {
+    generated_map_history_.splice(
+      generated_map_history_.end(), generated_map_history_, history_iterators_.at(area));
+    return itr->second;
+  }
+
+  cv::Mat map;
+  {
+    std::lock_guard<std::mutex> lock(prefetch_mutex_);
+    auto prefetched_itr = prefetched_maps_.find(area);
+    if (prefetched_itr != prefetched_maps_.end()) {
+      map = prefetched_itr->second;
+      prefetched_maps_.erase(prefetched_itr);
+    }
+  }
+  if (map.empty()) {
+    // NOTE: This stalls the correction, unless the map was prefetched
+    map = build_map(area, map_sources());
+    RCLCPP_INFO_STREAM(
+      logger_, "succeeded to build map " << area(area) << " " << area.real_scale().transpose());
+  }
+
+  generated_map_history_.push_back(area);
+  history_iterators_[area] = std::prev(generated_map_history_.end());
+  return cost_maps_.emplace(area, map).first->second;
+}
+
+void HierarchicalCostMap::prefetch(
+  const Eigen::Vector2f & position, const Eigen::Vector2f & direction, float distance)
+{
+  if (cloud_ == nullptr || distance <= 0) return;
+
+  // the areas of the square of max_range around each point of the trajectory every max_range / 2
+  std::vector<Area> areas;
+  const Eigen::Vector2f unit_direction = direction.normalized();
+  for (float d = 0; d <= distance; d += max_range_ / 2) {
+    const Eigen::Vector2f center = position + unit_direction * d;
+    for (float dx : {-max_range_ / 2, max_range_ / 2}) {
+      for (float dy : {-max_range_ / 2, max_range_ / 2}) {
+        const Area area(Eigen::Vector2f(center.x() + dx, center.y() + dy));
+        if (cost_maps_.count(area) == 0) {
+          areas.push_back(area);
+        }
+      }
+    }
+  }
+  if (areas.empty()) return;
+
+  {
+    std::lock_guard<std::mutex> lock(prefetch_mutex_);
+    for (const Area & area : areas) {
+      if (prefetch_requested_.count(area) || prefetched_maps_.count(area)) {
+        continue;
+      }
+      prefetch_requested_[area] = true;
+      prefetch_requests_.push_back({area, map_sources(), map_generation_});
+    }
+  }
+  if (!prefetch_thread_.joinable()) {
+    prefetch_thread_ = std::thread(&HierarchicalCostMap::run_prefetch, this);
+  }
+  prefetch_condition_.notify_one();
 }
 
-void HierarchicalCostMap::build_map(const Area & area)
+void HierarchicalCostMap::run_prefetch()
 {
-  if (!cloud_.has_value()) return;
+  std::unique_lock<std::mutex> lock(prefetch_mutex_);
+  while (true) {
+    prefetch_condition_.wait(
+      lock, [this] { return is_prefetch_stopped_ || !prefetch_requests_.empty(); });
+    if (is_prefetch_stopped_) return;
+
+    const PrefetchRequest request = prefetch_requests_.front();
+    prefetch_requests_.pop_front();
+    lock.unlock();
+    cv::Mat map = build_map(request.area, request.sources);
+    lock.lock();
+
+    if (request.generation != map_generation_) continue;
+    prefetch_requested_.erase(request.area);
+    prefetched_maps_[request.area] = map;
+    RCLCPP_INFO_STREAM(
+      logger_, "succeeded to prefetch map " << request.area(request.area) << " "
+                                            << request.area.real_scale().transpose());
+  }
+}
 
+cv::Mat HierarchicalCostMap::build_map(const Area & area, const MapSources & sources) const
+{
   cv::Mat image = 255 * cv::Mat::ones(cv::Size(image_size_, image_size_), CV_8UC1);
   cv::Mat orientation = cv::Mat::zeros(cv::Size(image_size_, image_size_), CV_8UC1);
 
@@ -111,10 +251,10 @@ void HierarchicalCostMap::build_map(const Area & area)
   };
 
   // TODO(KYabuuchi) We can speed up by skipping too far line_segments
-  for (const auto pn : cloud_.value()) {
-    if (height_) {
-      if (std::abs(pn.z - *height_) > 4) continue;
-      if (std::abs(pn.normal_z - *height_) > 4) continue;
+  for (const auto pn : *sources.cloud) {
+    if (sources.height) {
+      if (std::abs(pn.z - *sources.height) > 4) continue;
+      if (std::abs(pn.normal_z - *sources.height) > 4) continue;
     }
 
     cv::Point2i from = cvPoint(pn.getVector3fMap());
@@ -138,18 +278,13 @@ void HierarchicalCostMap::build_map(const Area & area)
   cv::Mat whole_orientation = direct_cost_map(orientation, image);
 
   // channel-3
-  cv::Mat available_area = create_available_area_image(area);
+  cv::Mat available_area = create_available_area_image(area, *sources.bounding_boxes);
 
   cv::Mat directed_cost_map;
   cv::merge(
     std::vector<cv::Mat>{gamma_converter(distance), whole_orientation, available_area},
     directed_cost_map);
-
-  cost_maps_[area] = directed_cost_map;
-  generated_map_history_.push_back(area);
-
-  RCLCPP_INFO_STREAM(
-    logger_, "succeeded to build map " << area(area) << " " << area.real_scale().transpose());
+  return directed_cost_map;
 }
 
 HierarchicalCostMap::MarkerArray HierarchicalCostMap::show_map_range() const
@@ -219,24 +354,32 @@ cv::Mat HierarchicalCostMap::get_map_image(const Pose & pose)
 
 void HierarchicalCostMap::erase_obsolete()
 {
-  if (cost_maps_.size() < max_map_count_) return;
-
-  for (auto itr = generated_map_history_.begin(); itr != generated_map_history_.end();) {
-    if (map_accessed_[*itr]) {
-      ++itr;
-      continue;
-    }
-    cost_maps_.erase(*itr);
-    itr = generated_map_history_.erase(itr);
+  // the prefetched maps count as the most recently used ones
+  std::unordered_map<Area, cv::Mat, Area> prefetched_maps;
+  {
+    std::lock_guard<std::mutex> lock(prefetch_mutex_);
+    prefetched_maps.swap(prefetched_maps_);
+  }
+  for (const auto & [area, map] : prefetched_maps) {
+    if (cost_maps_.count(area)) continue;
+    cost_maps_.emplace(area, map);
+    generated_map_history_.push_back(area);
+    history_iterators_[area] = std::prev(generated_map_history_.end());
   }
 
-  map_accessed_.clear();
+  while (cost_maps_.size() > max_map_count_) {
+    const Area area = generated_map_history_.front();
+    cost_maps_.erase(area);
+    history_iterators_.erase(area);
+    generated_map_history_.pop_front();
+  }
 }
 
-cv::Mat HierarchicalCostMap::create_available_area_image(const Area & area) const
+cv::Mat HierarchicalCostMap::create_available_area_image(
+  const Area & area, const std::vector<BgPolygon> & bounding_boxes) const
 {
   cv::Mat available_area = cv::Mat::zeros(cv::Size(image_size_, image_size_), CV_8UC1);
-  if (bounding_boxes_.empty()) return available_area;
+  if (bounding_boxes.empty()) return available_area;
 
   // Define current area
   using BgBox = boost::geometry::model::box<BgPoint>;
@@ -248,7 +391,7 @@ cv::Mat HierarchicalCostMap::create_available_area_image(const Area & area) cons
 
   std::vector<std::vector<cv::Point2i>> contours;
 
-  for (const BgPolygon & box : bounding_boxes_) {
+  for (const BgPolygon & box : bounding_boxes) {
     if (boost::geometry::disjoint(area_polygon, box)) {
       continue;
     }
@@ -22,6 +22,7 @@
 #include <memory>
 #include <optional>
 #include <string>
+#include <vector>
 
 namespace map_height_fitter
 {
@@ -34,6 +35,9 @@ public:
   MapHeightFitter(rclcpp::Node * node);
   ~MapHeightFitter();
   std::optional<Point> fit(const Point & position, const std::string & frame);
+  // fits the points at once, with one partial map around them when partial load is enabled
+  std::optional<std::vector<Point>> fit(
+    const std::vector<Point> & positions, const std::string & frame);
 
 private:
   struct Impl;
@@ -23,23 +23,244 @@
 #include <pcl_conversions/pcl_conversions.h>
 #include <tf2_ros/transform_listener.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <string>
+#include <vector>
+
 namespace map_height_fitter
 {
 
+namespace
+{
+
+// A 2D grid of the map points with the lowest height and the bounds of the points of each cell,
+// so that the ground height is found from the cells around the point instead of all the points.
+// The height is the same as that of the linear search of all the points.
+class GroundHeightGrid
+{
+public:
+  explicit GroundHeightGrid(const pcl::PointCloud<pcl::PointXYZ> & cloud);
+  double get_ground_height(const double x, const double y, const double z) const;
+
+private:
+  struct Cell
+  {
+    std::uint32_t begin;
+    std::uint32_t end;
+    float min_z;
+    float min_x;
+    float min_y;
+    float max_x;
+    float max_y;
+  };
+
+  // a margin for the rounding of the cell of a point, which is far smaller than a cell
+  static constexpr double margin = 1e-6;
+
+  int to_grid(const double v, const double origin, const int size) const;
+  static double min_squared_distance(const Cell & cell, const double x, const double y);
+  static double max_squared_distance(const Cell & cell, const double x, const double y);
+
+  double origin_x_;
+  double origin_y_;
+  double cell_size_;
+  int size_x_;
+  int size_y_;
+  std::vector<Cell> cells_;
+  std::vector<pcl::PointXYZ> points_;  // sorted by the cell
+};
+
+GroundHeightGrid::GroundHeightGrid(const pcl::PointCloud<pcl::PointXYZ> & cloud)
+: origin_x_(0.0), origin_y_(0.0), cell_size_(1.0), size_x_(0), size_y_(0)
+{
+  // the points without the horizontal position never affect the height
+  std::vector<pcl::PointXYZ> points;
+  points.reserve(cloud.points.size());
+  double max_x = -INFINITY;
+  double max_y = -INFINITY;
+  origin_x_ = INFINITY;
+  origin_y_ = INFINITY;
+  for (const auto & p : cloud.points) {
+    if (std::isfinite(p.x) && std::isfinite(p.y)) {
+      points.push_back(p);
+      origin_x_ = std::min<double>(origin_x_, p.x);
+      origin_y_ = std::min<double>(origin_y_, p.y);
+      max_x = std::max<double>(max_x, p.x);
+      max_y = std::max<double>(max_y, p.y);
+    }
+  }
+  if (points.empty()) {
+    return;
+  }
+
+  // about 8 points per cell at least, so that a whole map does not need too many cells
+  const double area = std::max(max_x - origin_x_, 1.0) * std::max(max_y - origin_y_, 1.0);
+  cell_size_ = std::max(1.0, std::sqrt(area * 8.0 / static_cast<double>(points.size())));
+  size_x_ = static_cast<int>((max_x - origin_x_) / cell_size_) + 1;
+  size_y_ = static_cast<int>((max_y - origin_y_) / cell_size_) + 1;
+
+  std::vector<std::uint32_t> cell_indices(points.size());
+  std::vector<std::uint32_t> offsets(static_cast<size_t>(size_x_) * size_y_ + 1, 0);
+  for (size_t i = 0; i < points.size(); ++i) {
+    const int gx = to_grid(points[i].x, origin_x_, size_x_);
+    const int gy = to_grid(points[i].y, origin_y_, size_y_);
+    cell_indices[i] = static_cast<std::uint32_t>(gy * size_x_ + gx);
+    ++offsets[cell_indices[i] + 1];
+  }
+  for (size_t i = 1; i < offsets.size(); ++i) {
+    offsets[i] += offsets[i - 1];
+  }
+
+  constexpr float inf = std::numeric_limits<float>::infinity();
+  cells_.resize(offsets.size() - 1);
+  for (size_t i = 0; i < cells_.size(); ++i) {
+    cells_[i] = Cell{offsets[i], offsets[i], inf, inf, inf, -inf, -inf};
+  }
+  points_.resize(points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    Cell & cell = cells_[cell_indices[i]];
+    const auto & p = points[i];
+    points_[cell.end++] = p;
+    cell.min_z = std::min(cell.min_z, p.z);
+    cell.min_x = std::min(cell.min_x, p.x);
+    cell.min_y = std::min(cell.min_y, p.y);
+    cell.max_x = std::max(cell.max_x, p.x);
+    cell.max_y = std::max(cell.max_y, p.y);
+  }
+}
+
+int GroundHeightGrid::to_grid(const double v, const double origin, const int size) const
+{
+  const double index = std::floor((v - origin) / cell_size_);
+  return static_cast<int>(std::clamp(index, 0.0, static_cast<double>(size - 1)));
+}
+
+double GroundHeightGrid::min_squared_distance(const Cell & cell, const double x, const double y)
+{
+  const double dx = std::max({cell.min_x - x, x - cell.max_x, 0.0});
+  const double dy = std::max({cell.min_y - y, y - cell.max_y, 0.0});
+  return (dx * dx) + (dy * dy);
+}
+
+double GroundHeightGrid::max_squared_distance(const Cell & cell, const double x, const double y)
+{
+  const double dx = std::max(x - cell.min_x, cell.max_x - x);
+  const double dy = std::max(y - cell.min_y, cell.max_y - y);
+  return (dx * dx) + (dy * dy);
+}
+
+double GroundHeightGrid::get_ground_height(const double x, const double y, const double z) const
+{
+  if (points_.empty()) {
+    return z;
+  }
+
+  const auto squared_distance = [x, y](const pcl::PointXYZ & p) {
+    const double dx = x - p.x;
+    const double dy = y - p.y;
+    return (dx * dx) + (dy * dy);
+  };
+
+  // find distance d to closest point, from the rings of the cells around the point
+  const int cx = to_grid(x, origin_x_, size_x_);
+  const int cy = to_grid(y, origin_y_, size_y_);
+  // the distance from the point to the grid in each axis, since the point may be out of the grid
+  const double grid_dx = std::max({origin_x_ - x, x - (origin_x_ + size_x_ * cell_size_), 0.0});
+  const double grid_dy = std::max({origin_y_ - y, y - (origin_y_ + size_y_ * cell_size_), 0.0});
+  double min_dist2 = INFINITY;
+  for (int ring = 0;; ++ring) {
+    // the lower bound of the distance to the cells out of the previous rings, on each side
+    const int r = ring - 1;
+    double bound2 = INFINITY;
+    if (cx + r < size_x_ - 1) {
+      const double dx = std::max(origin_x_ + (cx + r + 1) * cell_size_ - x - margin, 0.0);
+      bound2 = std::min(bound2, (dx * dx) + (grid_dy * grid_dy));
+    }
+    if (0 < cx - r) {
+      const double dx = std::max(x - (origin_x_ + (cx - r) * cell_size_) - margin, 0.0);
+      bound2 = std::min(bound2, (dx * dx) + (grid_dy * grid_dy));
+    }
+    if (cy + r < size_y_ - 1) {
+      const double dy = std::max(origin_y_ + (cy + r + 1) * cell_size_ - y - margin, 0.0);
+      bound2 = std::min(bound2, (grid_dx * grid_dx) + (dy * dy));
+    }
+    if (0 < cy - r) {
+      const double dy = std::max(y - (origin_y_ + (cy - r) * cell_size_) - margin, 0.0);
+      bound2 = std::min(bound2, (grid_dx * grid_dx) + (dy * dy));
+    }
+    if (bound2 > min_dist2 || std::isinf(bound2)) {
+      break;
+    }
+    for (int gy = std::max(cy - ring, 0); gy <= std::min(cy + ring, size_y_ - 1); ++gy) {
+      const bool is_edge_row = gy == cy - ring || gy == cy + ring;
+      const int step = is_edge_row ? 1 : 2 * ring;
+      for (int gx = cx - ring; gx <= cx + ring; gx += step) {
+        if (gx < 0 || size_x_ <= gx) {
+          continue;
+        }
+        const Cell & cell = cells_[gy * size_x_ + gx];
+        if (cell.begin == cell.end || min_squared_distance(cell, x, y) >= min_dist2) {
+          continue;
+        }
+        for (std::uint32_t i = cell.begin; i < cell.end; ++i) {
+          min_dist2 = std::min(min_dist2, squared_distance(points_[i]));
+        }
+      }
+    }
+  }
+
+  // find lowest height within radius (d+1.0)
+  const double radius = std::sqrt(min_dist2) + 1.0;
+  const double radius2 = std::pow(radius, 2.0);
+  const int min_gx = to_grid(x - radius, origin_x_, size_x_);
+  const int max_gx = to_grid(x + radius, origin_x_, size_x_);
+  const int min_gy = to_grid(y - radius, origin_y_, size_y_);
+  const int max_gy = to_grid(y + radius, origin_y_, size_y_);
+  double height = INFINITY;
+  for (int gy = std::max(min_gy - 1, 0); gy <= std::min(max_gy + 1, size_y_ - 1); ++gy) {
+    for (int gx = std::max(min_gx - 1, 0); gx <= std::min(max_gx + 1, size_x_ - 1); ++gx) {
+      const Cell & cell = cells_[gy * size_x_ + gx];
+      if (
+        cell.begin == cell.end || cell.min_z >= height ||
+        min_squared_distance(cell, x, y) >= radius2) {
+        continue;
+      }
+      if (max_squared_distance(cell, x, y) < radius2) {
+        height = std::min(height, static_cast<double>(cell.min_z));
+        continue;
+      }
+      for (std::uint32_t i = cell.begin; i < cell.end; ++i) {
+        if (squared_distance(points_[i]) < radius2) {
+          height = std::min(height, static_cast<double>(points_[i].z));
+        }
+      }
+    }
+  }
+
+  return std::isfinite(height) ? height : z;
+}
+
+}  // namespace
+
 struct MapHeightFitter::Impl
 {
   static constexpr char enable_partial_load[] = "enable_partial_load";
 
   explicit Impl(rclcpp::Node * node);
   void on_map(const sensor_msgs::msg::PointCloud2::ConstSharedPtr msg);
-  bool get_partial_point_cloud_map(const Point & point);
-  double get_ground_height(const tf2::Vector3 & point) const;
+  bool get_partial_point_cloud_map(const Point & point, const double radius);
   std::optional<Point> fit(const Point & position, const std::string & frame);
+  std::optional<std::vector<Point>> fit(
+    const std::vector<Point> & positions, const std::string & frame);
 
   tf2::BufferCore tf2_buffer_;
   tf2_ros::TransformListener tf2_listener_;
   std::string map_frame_;
-  pcl::PointCloud<pcl::PointXYZ>::Ptr map_cloud_;
+  std::shared_ptr<const GroundHeightGrid> map_grid_;
   rclcpp::Node * node_;
 
   rclcpp::CallbackGroup::SharedPtr group_;
@@ -79,11 +300,12 @@ MapHeightFitter::Impl::Impl(rclcpp::Node * node) : tf2_listener_(tf2_buffer_), n
 void MapHeightFitter::Impl::on_map(const sensor_msgs::msg::PointCloud2::ConstSharedPtr msg)
 {
   map_frame_ = msg->header.frame_id;
-  map_cloud_ = pcl::PointCloud<pcl::PointXYZ>::Ptr(new pcl::PointCloud<pcl::PointXYZ>);
-  pcl::fromROSMsg(*msg, *map_cloud_);
+  pcl::PointCloud<pcl::PointXYZ> map_cloud;
+  pcl::fromROSMsg(*msg, map_cloud);
+  map_grid_ = std::make_shared<const GroundHeightGrid>(map_cloud);
 }
 
-bool MapHeightFitter::Impl::get_partial_point_cloud_map(const Point & point)
+bool MapHeightFitter::Impl::get_partial_point_cloud_map(const Point & point, const double radius)
 {
   const auto logger = node_->get_logger();
 
@@ -99,7 +321,7 @@ bool MapHeightFitter::Impl::get_partial_point_cloud_map(const Point & point)
   const auto req = std::make_shared<autoware_map_msgs::srv::GetPartialPointCloudMap::Request>();
   req->area.center_x = point.x;
   req->area.center_y = point.y;
-  req->area.radius = 50;
+  req->area.radius = radius;
 
   RCLCPP_INFO(logger, "Send request to map_loader");
   auto future = cli_map_->async_send_request(req);
@@ -129,77 +351,87 @@ bool MapHeightFitter::Impl::get_partial_point_cloud_map(const Point & point)
     }
   }
   map_frame_ = res->header.frame_id;
-  map_cloud_ = pcl::PointCloud<pcl::PointXYZ>::Ptr(new pcl::PointCloud<pcl::PointXYZ>);
-  pcl::fromROSMsg(pcd_msg, *map_cloud_);
+  pcl::PointCloud<pcl::PointXYZ> map_cloud;
+  pcl::fromROSMsg(pcd_msg, map_cloud);
+  map_grid_ = std::make_shared<const GroundHeightGrid>(map_cloud);
   return true;
 }
 
-double MapHeightFitter::Impl::get_ground_height(const tf2::Vector3 & point) const
+std::optional<Point> MapHeightFitter::Impl::fit(const Point & position, const std::string & frame)
 {
-  const double x = point.getX();
-  const double y = point.getY();
+  const auto logger = node_->get_logger();
 
-  // find distance d to closest point
-  double min_dist2 = INFINITY;
-  for (const auto & p : map_cloud_->points) {
-    const double dx = x - p.x;
-    const double dy = y - p.y;
-    const double sd = (dx * dx) + (dy * dy);
-    min_dist2 = std::min(min_dist2, sd);
-  }
+  RCLCPP_INFO(logger, "original point: %.3f %.3f %.3f", position.x, position.y, position.z);
 
-  // find lowest height within radius (d+1.0)
-  const double radius2 = std::pow(std::sqrt(min_dist2) + 1.0, 2.0);
-  double height = INFINITY;
-  for (const auto & p : map_cloud_->points) {
-    const double dx = x - p.x;
-    const double dy = y - p.y;
-    const double sd = (dx * dx) + (dy * dy);
-    if (sd < radius2) {
-      height = std::min(height, static_cast<double>(p.z));
-    }
+  const auto fitted = fit(std::vector<Point>{position}, frame);
+  if (!fitted) {
+    return std::nullopt;
   }
 
-  return std::isfinite(height) ? height : point.getZ();
+  const auto & result = fitted->front();
+  RCLCPP_INFO(logger, "modified point: %.3f %.3f %.3f", result.x, result.y, result.z);
+  return result;
 }
 
-std::optional<Point> MapHeightFitter::Impl::fit(const Point & position, const std::string & frame)
+std::optional<std::vector<Point>> MapHeightFitter::Impl::fit(
+  const std::vector<Point> & positions, const std::string & frame)
 {
   const auto logger = node_->get_logger();
-  tf2::Vector3 point(position.x, position.y, position.z);
 
-  RCLCPP_INFO(logger, "original point: %.3f %.3f %.3f", point.getX(), point.getY(), point.getZ());
+  if (positions.empty()) {
+    return std::vector<Point>{};
+  }
 
   if (cli_map_) {
-    if (!get_partial_point_cloud_map(position)) {
+    // one partial map around all the points
+    double min_x = INFINITY;
+    double min_y = INFINITY;
+    double max_x = -INFINITY;
+    double max_y = -INFINITY;
+    for (const auto & position : positions) {
+      min_x = std::min(min_x, position.x);
+      min_y = std::min(min_y, position.y);
+      max_x = std::max(max_x, position.x);
+      max_y = std::max(max_y, position.y);
+    }
+    Point center;
+    center.x = (min_x + max_x) / 2.0;
+    center.y = (min_y + max_y) / 2.0;
+    const double radius = std::hypot(max_x - min_x, max_y - min_y) / 2.0 + 50.0;
+    if (!get_partial_point_cloud_map(center, radius)) {
       return std::nullopt;
     }
   }
 
-  if (!map_cloud_) {
+  const auto map_grid = map_grid_;
+  if (!map_grid) {
     RCLCPP_WARN_STREAM(logger, "point cloud map is not ready");
     return std::nullopt;
   }
 
+  std::vector<Point> results;
+  results.reserve(positions.size());
   try {
     const auto stamped = tf2_buffer_.lookupTransform(map_frame_, frame, tf2::TimePointZero);
     tf2::Transform transform{tf2::Quaternion{}, tf2::Vector3{}};
     tf2::fromMsg(stamped.transform, transform);
-    point = transform * point;
-    point.setZ(get_ground_height(point));
-    point = transform.inverse() * point;
+    for (const auto & position : positions) {
+      tf2::Vector3 point(position.x, position.y, position.z);
+      point = transform * point;
+      point.setZ(map_grid->get_ground_height(point.getX(), point.getY(), point.getZ()));
+      point = transform.inverse() * point;
+
+      Point result;
+      result.x = point.getX();
+      result.y = point.getY();
+      result.z = point.getZ();
+      results.push_back(result);
+    }
   } catch (tf2::TransformException & exception) {
     RCLCPP_WARN_STREAM(logger, "failed to lookup transform: " << exception.what());
     return std::nullopt;
   }
-
-  RCLCPP_INFO(logger, "modified point: %.3f %.3f %.3f", point.getX(), point.getY(), point.getZ());
-
-  Point result;
-  result.x = point.getX();
-  result.y = point.getY();
-  result.z = point.getZ();
-  return result;
+  return results;
 }
 
 MapHeightFitter::MapHeightFitter(rclcpp::Node * node)
@@ -216,4 +448,10 @@ std::optional<Point> MapHeightFitter::fit(const Point & position, const std::str
   return impl_->fit(position, frame);
 }
 
+std::optional<std::vector<Point>> MapHeightFitter::fit(
+  const std::vector<Point> & positions, const std::string & frame)
+{
+  return impl_->fit(positions, frame);
+}
+
 }  // namespace map_height_fitter
@@ -0,0 +1,96 @@
+// Copyright 2023 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef MAP_LOADER__BINARY_POINTCLOUD_MAP_HPP_
+#define MAP_LOADER__BINARY_POINTCLOUD_MAP_HPP_
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+#include <sensor_msgs/msg/point_field.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+/*
+A binary pointcloud map (.pcdbin) holds all the cells of a divided pointcloud map in one file, in
+the point layout of sensor_msgs::msg::PointCloud2:
+
+  | header | points of cell 0 | points of cell 1 | ... | fields | cells | cell ids |
+
+The points of each cell start at a page boundary. The loader maps the file into memory, so that
+the points of a cell are a slice of the mapping instead of a PCD file to parse.
+*/
+
+struct BinaryPointCloudMapCell
+{
+  std::string id;
+  float min_x;
+  float min_y;
+  float min_z;
+  float max_x;
+  float max_y;
+  float max_z;
+  std::uint64_t data_offset;  // offset of the points of the cell in the file
+  std::uint64_t point_num;
+};
+
+class BinaryPointCloudMap
+{
+public:
+  // throws std::runtime_error if the file is not a valid binary pointcloud map
+  explicit BinaryPointCloudMap(const std::string & path);
+  ~BinaryPointCloudMap();
+  BinaryPointCloudMap(const BinaryPointCloudMap &) = delete;
+  BinaryPointCloudMap & operator=(const BinaryPointCloudMap &) = delete;
+
+  static bool isBinaryPointCloudMapFile(const std::string & path);
+
+  const std::vector<BinaryPointCloudMapCell> & getCells() const { return cells_; }
+  const BinaryPointCloudMapCell * findCell(const std::string & id) const;
+  void loadCell(const BinaryPointCloudMapCell & cell, sensor_msgs::msg::PointCloud2 & cloud) const;
+
+private:
+  const std::uint8_t * data_{nullptr};
+  std::size_t size_{0};
+  std::uint32_t point_step_{0};
+  std::vector<sensor_msgs::msg::PointField> fields_;
+  std::vector<BinaryPointCloudMapCell> cells_;
+  std::unordered_map<std::string, std::size_t> cell_indices_;
+};
+
+class BinaryPointCloudMapWriter
+{
+public:
+  // throws std::runtime_error if the file cannot be opened
+  explicit BinaryPointCloudMapWriter(const std::string & path);
+
+  // The data_offset and point_num of the cell are set from the cloud, whose fields must be the
+  // same for all the cells. throws std::runtime_error on a different layout or a write failure.
+  void addCell(const BinaryPointCloudMapCell & cell, const sensor_msgs::msg::PointCloud2 & cloud);
+
+  // writes the tables of the fields and the cells, and the header
+  void close();
+
+private:
+  std::string path_;
+  std::ofstream file_;
+  std::uint32_t point_step_{0};
+  std::vector<sensor_msgs::msg::PointField> fields_;
+  std::vector<BinaryPointCloudMapCell> cells_;
+};
+
+#endif  // MAP_LOADER__BINARY_POINTCLOUD_MAP_HPP_
@@ -0,0 +1,186 @@
+// Copyright 2023 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lanelet2_map_cache.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cstdint>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace lanelet2_map_cache
+{
+namespace
+{
+constexpr char MAGIC[8] = {'L', 'L', '2', 'C', 'A', 'C', 'H', 'E'};
+// to be incremented when the serialization of the map or of this file changes
+constexpr std::uint64_t VERSION = 1;
+
+// FNV-1a, which is the same across the builds unlike std::hash
+std::uint64_t hash_file(std::ifstream & file)
+{
+  std::uint64_t hash = 14695981039346656037ULL;
+  std::vector<char> buffer(1 << 20);
+  while (file) {
+    file.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+    for (std::streamsize i = 0; i < file.gcount(); ++i) {
+      hash = (hash ^ static_cast<std::uint8_t>(buffer[i])) * 1099511628211ULL;
+    }
+  }
+  return hash;
+}
+
+void write_string(std::ofstream & file, const std::string & str)
+{
+  const std::uint64_t size = str.size();
+  file.write(reinterpret_cast<const char *>(&size), sizeof(size));
+  file.write(str.data(), static_cast<std::streamsize>(size));
+}
+
+// reads a string at offset from the mapped file, moving the offset after it
+bool read_string(
+  const std::uint8_t * data, const std::size_t size, std::size_t & offset, std::string & str)
+{
+  std::uint64_t length;
+  if (size - offset < sizeof(length)) {
+    return false;
+  }
+  std::memcpy(&length, data + offset, sizeof(length));
+  offset += sizeof(length);
+  if (size - offset < length) {
+    return false;
+  }
+  str.assign(reinterpret_cast<const char *>(data + offset), length);
+  offset += length;
+  return true;
+}
+}  // namespace
+
+std::string create_key(
+  const std::string & lanelet2_filename,
+  const tier4_map_msgs::msg::MapProjectorInfo & projector_info, const double center_line_resolution)
+{
+  std::ifstream file(lanelet2_filename, std::ios::binary);
+  if (!file) {
+    return "";
+  }
+
+  std::ostringstream key;
+  key << std::hex << std::setw(16) << std::setfill('0') << hash_file(file) << std::dec;
+  key << std::setprecision(17) << ";" << projector_info.projector_type << ";"
+      << projector_info.vertical_datum << ";" << projector_info.mgrs_grid << ";"
+      << projector_info.map_origin.latitude << ";" << projector_info.map_origin.longitude << ";"
+      << projector_info.map_origin.altitude << ";" << center_line_resolution;
+  return key.str();
+}
+
+bool load(
+  const std::string & cache_path, const std::string & key,
+  autoware_auto_mapping_msgs::msg::HADMapBin & map_bin_msg)
+{
+  const int fd = ::open(cache_path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat file_status;
+  if (::fstat(fd, &file_status) != 0 || file_status.st_size == 0) {
+    ::close(fd);
+    return false;
+  }
+  const std::size_t size = static_cast<std::size_t>(file_status.st_size);
+  void * mapped = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+  ::close(fd);
+  if (mapped == MAP_FAILED) {
+    return false;
+  }
+  // the serialized map is read through once
+  ::madvise(mapped, size, MADV_SEQUENTIAL);
+
+  const auto * data = static_cast<const std::uint8_t *>(mapped);
+  const auto parse = [&]() {
+    std::uint64_t version;
+    if (size < sizeof(MAGIC) + sizeof(version) || std::memcmp(data, MAGIC, sizeof(MAGIC)) != 0) {
+      return false;
+    }
+    std::memcpy(&version, data + sizeof(MAGIC), sizeof(version));
+    std::size_t offset = sizeof(MAGIC) + sizeof(version);
+    std::string cached_key, format_version, map_version;
+    if (
+      version != VERSION || !read_string(data, size, offset, cached_key) || cached_key != key ||
+      !read_string(data, size, offset, format_version) ||
+      !read_string(data, size, offset, map_version)) {
+      return false;
+    }
+    std::uint64_t data_size;
+    if (size - offset < sizeof(data_size)) {
+      return false;
+    }
+    std::memcpy(&data_size, data + offset, sizeof(data_size));
+    offset += sizeof(data_size);
+    if (data_size == 0 || size - offset != data_size) {
+      return false;
+    }
+    map_bin_msg.format_version = format_version;
+    map_bin_msg.map_version = map_version;
+    map_bin_msg.data.assign(data + offset, data + offset + data_size);
+    return true;
+  };
+  const bool is_loaded = parse();
+  ::munmap(mapped, size);
+  return is_loaded;
+}
+
+void save(
+  const std::string & cache_path, const std::string & key,
+  const autoware_auto_mapping_msgs::msg::HADMapBin & map_bin_msg)
+{
+  // written aside and renamed, so that a cache is never read while it is written
+  const std::string tmp_path = cache_path + ".tmp";
+  {
+    std::ofstream file(tmp_path, std::ios::binary | std::ios::trunc);
+    if (!file) {
+      throw std::runtime_error("Lanelet2 map cache open failed: " + tmp_path);
+    }
+    file.write(MAGIC, sizeof(MAGIC));
+    file.write(reinterpret_cast<const char *>(&VERSION), sizeof(VERSION));
+    write_string(file, key);
+    write_string(file, map_bin_msg.format_version);
+    write_string(file, map_bin_msg.map_version);
+    const std::uint64_t data_size = map_bin_msg.data.size();
+    file.write(reinterpret_cast<const char *>(&data_size), sizeof(data_size));
+    file.write(
+      reinterpret_cast<const char *>(map_bin_msg.data.data()),
+      static_cast<std::streamsize>(data_size));
+    file.close();
+    if (!file) {
+      throw std::runtime_error("Lanelet2 map cache write failed: " + tmp_path);
+    }
+  }
+  std::error_code error;
+  std::filesystem::rename(tmp_path, cache_path, error);
+  if (error) {
+    throw std::runtime_error("Lanelet2 map cache rename failed: " + cache_path);
+  }
+}
+}  // namespace lanelet2_map_cache
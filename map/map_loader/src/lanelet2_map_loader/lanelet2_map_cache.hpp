@@ -0,0 +1,44 @@
+// Copyright 2023 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LANELET2_MAP_LOADER__LANELET2_MAP_CACHE_HPP_
+#define LANELET2_MAP_LOADER__LANELET2_MAP_CACHE_HPP_
+
+#include <autoware_auto_mapping_msgs/msg/had_map_bin.hpp>
+#include <tier4_map_msgs/msg/map_projector_info.hpp>
+
+#include <string>
+
+// A cache of the serialized lanelet2 map, so that the map is loaded without parsing and projecting
+// the OSM file, as long as the file, the projector and the centerline resolution are the same.
+namespace lanelet2_map_cache
+{
+// the key of the serialized map, or an empty string if the map file is not readable
+std::string create_key(
+  const std::string & lanelet2_filename,
+  const tier4_map_msgs::msg::MapProjectorInfo & projector_info,
+  const double center_line_resolution);
+
+// false if the cache does not exist, is invalid or has another key
+bool load(
+  const std::string & cache_path, const std::string & key,
+  autoware_auto_mapping_msgs::msg::HADMapBin & map_bin_msg);
+
+// throws std::runtime_error if the cache is not written
+void save(
+  const std::string & cache_path, const std::string & key,
+  const autoware_auto_mapping_msgs::msg::HADMapBin & map_bin_msg);
+}  // namespace lanelet2_map_cache
+
+#endif  // LANELET2_MAP_LOADER__LANELET2_MAP_CACHE_HPP_
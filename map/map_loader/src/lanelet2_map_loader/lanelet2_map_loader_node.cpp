@@ -33,6 +33,8 @@
 
 #include "map_loader/lanelet2_map_loader_node.hpp"
 
+#include "lanelet2_map_cache.hpp"
+
 #include <ament_index_cpp/get_package_prefix.hpp>
 #include <geography_utils/lanelet2_projector.hpp>
 #include <lanelet2_extension/io/autoware_osm_parser.hpp>
@@ -47,6 +49,7 @@
 #include <lanelet2_io/Io.h>
 #include <lanelet2_projection/UTM.h>
 
+#include <stdexcept>
 #include <string>
 
 Lanelet2MapLoaderNode::Lanelet2MapLoaderNode(const rclcpp::NodeOptions & options)
@@ -61,6 +64,7 @@ Lanelet2MapLoaderNode::Lanelet2MapLoaderNode(const rclcpp::NodeOptions & options
 
   declare_parameter("lanelet2_map_path", "");
   declare_parameter("center_line_resolution", 5.0);
+  declare_parameter("lanelet2_map_cache_path", "");
 }
 
 void Lanelet2MapLoaderNode::on_map_projector_info(
@@ -68,18 +72,40 @@ void Lanelet2MapLoaderNode::on_map_projector_info(
 {
   const auto lanelet2_filename = get_parameter("lanelet2_map_path").as_string();
   const auto center_line_resolution = get_parameter("center_line_resolution").as_double();
+  const auto cache_path = get_parameter("lanelet2_map_cache_path").as_string();
 
-  // load map from file
-  const auto map = load_map(lanelet2_filename, *msg);
-  if (!map) {
-    return;
-  }
+  // the serialized map is loaded from the cache if the map file and the projector are the same
+  const auto cache_key =
+    cache_path.empty()
+      ? ""
+      : lanelet2_map_cache::create_key(lanelet2_filename, *msg, center_line_resolution);
+  HADMapBin map_bin_msg;
+  if (!cache_key.empty() && lanelet2_map_cache::load(cache_path, cache_key, map_bin_msg)) {
+    map_bin_msg.header.stamp = now();
+    map_bin_msg.header.frame_id = "map";
+    RCLCPP_INFO_STREAM(get_logger(), "Loaded lanelet2 map cache: " << cache_path);
+  } else {
+    // load map from file
+    const auto map = load_map(lanelet2_filename, *msg);
+    if (!map) {
+      return;
+    }
 
-  // overwrite centerline
-  lanelet::utils::overwriteLaneletsCenterline(map, center_line_resolution, false);
+    // overwrite centerline
+    lanelet::utils::overwriteLaneletsCenterline(map, center_line_resolution, false);
 
-  // create map bin msg
-  const auto map_bin_msg = create_map_bin_msg(map, lanelet2_filename, now());
+    // create map bin msg
+    map_bin_msg = create_map_bin_msg(map, lanelet2_filename, now());
+
+    if (!cache_key.empty()) {
+      try {
+        lanelet2_map_cache::save(cache_path, cache_key, map_bin_msg);
+        RCLCPP_INFO_STREAM(get_logger(), "Saved lanelet2 map cache: " << cache_path);
+      } catch (std::runtime_error & e) {
+        RCLCPP_WARN_STREAM(get_logger(), e.what());
+      }
+    }
+  }
 
   // create publisher and publish
   pub_map_bin_ =
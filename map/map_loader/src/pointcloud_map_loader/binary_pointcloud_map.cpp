@@ -0,0 +1,280 @@
+// Copyright 2023 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "map_loader/binary_pointcloud_map.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+constexpr char MAGIC[8] = {'P', 'C', 'D', 'B', 'I', 'N', '\0', '\0'};
+constexpr std::uint32_t VERSION = 1;
+constexpr std::uint64_t PAGE_SIZE = 4096;
+constexpr std::size_t FIELD_NAME_SIZE = 32;
+
+struct Header
+{
+  char magic[8];
+  std::uint32_t version;
+  std::uint32_t point_step;
+  std::uint64_t field_num;
+  std::uint64_t cell_num;
+  std::uint64_t table_offset;
+};
+
+struct FieldRecord
+{
+  char name[FIELD_NAME_SIZE];
+  std::uint32_t offset;
+  std::uint32_t count;
+  std::uint8_t datatype;
+  std::uint8_t padding[7];
+};
+
+struct CellRecord
+{
+  float bounds[6];
+  std::uint64_t data_offset;
+  std::uint64_t point_num;
+  std::uint64_t id_length;
+};
+
+std::uint64_t alignToPage(const std::uint64_t offset)
+{
+  return (offset + PAGE_SIZE - 1) / PAGE_SIZE * PAGE_SIZE;
+}
+
+bool isSameLayout(
+  const std::vector<sensor_msgs::msg::PointField> & lhs,
+  const std::vector<sensor_msgs::msg::PointField> & rhs)
+{
+  return std::equal(
+    lhs.begin(), lhs.end(), rhs.begin(), rhs.end(),
+    [](const sensor_msgs::msg::PointField & a, const sensor_msgs::msg::PointField & b) {
+      return a.name == b.name && a.offset == b.offset && a.datatype == b.datatype &&
+             a.count == b.count;
+    });
+}
+}  // namespace
+
+BinaryPointCloudMap::BinaryPointCloudMap(const std::string & path)
+{
+  const int fd = ::open(path.c_str(), O_RDONLY);
+  if (fd < 0) {
+    throw std::runtime_error("Binary pointcloud map open failed: " + path);
+  }
+  struct stat file_status;
+  if (::fstat(fd, &file_status) != 0 || file_status.st_size < static_cast<off_t>(sizeof(Header))) {
+    ::close(fd);
+    throw std::runtime_error("Binary pointcloud map is too small: " + path);
+  }
+  size_ = static_cast<std::size_t>(file_status.st_size);
+  void * mapped = ::mmap(nullptr, size_, PROT_READ, MAP_SHARED, fd, 0);
+  ::close(fd);
+  if (mapped == MAP_FAILED) {
+    throw std::runtime_error("Binary pointcloud map mmap failed: " + path);
+  }
+  data_ = static_cast<const std::uint8_t *>(mapped);
+  // the cells are read on request, in any order
+  ::madvise(mapped, size_, MADV_RANDOM);
+
+  const auto fail = [&](const std::string & reason) {
+    ::munmap(const_cast<std::uint8_t *>(data_), size_);
+    throw std::runtime_error("Invalid binary pointcloud map (" + reason + "): " + path);
+  };
+
+  Header header;
+  std::memcpy(&header, data_, sizeof(Header));
+  if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0) fail("magic");
+  if (header.version != VERSION) fail("version");
+
+  const std::uint64_t fields_size = header.field_num * sizeof(FieldRecord);
+  const std::uint64_t cells_size = header.cell_num * sizeof(CellRecord);
+  if (header.table_offset > size_ || fields_size + cells_size > size_ - header.table_offset) {
+    fail("table");
+  }
+
+  point_step_ = header.point_step;
+  const std::uint8_t * table = data_ + header.table_offset;
+  for (std::uint64_t i = 0; i < header.field_num; ++i) {
+    FieldRecord record;
+    std::memcpy(&record, table + i * sizeof(FieldRecord), sizeof(FieldRecord));
+    sensor_msgs::msg::PointField field;
+    field.name = std::string(record.name, strnlen(record.name, FIELD_NAME_SIZE));
+    field.offset = record.offset;
+    field.datatype = record.datatype;
+    field.count = record.count;
+    fields_.push_back(field);
+  }
+
+  const std::uint8_t * cell_table = table + fields_size;
+  std::uint64_t id_offset = header.table_offset + fields_size + cells_size;
+  for (std::uint64_t i = 0; i < header.cell_num; ++i) {
+    CellRecord record;
+    std::memcpy(&record, cell_table + i * sizeof(CellRecord), sizeof(CellRecord));
+    if (record.id_length > size_ - id_offset) fail("cell id");
+    if (
+      record.data_offset > size_ ||
+      record.point_num > (size_ - record.data_offset) / std::max<std::uint32_t>(point_step_, 1)) {
+      fail("cell points");
+    }
+
+    BinaryPointCloudMapCell cell;
+    cell.id = std::string(reinterpret_cast<const char *>(data_ + id_offset), record.id_length);
+    cell.min_x = record.bounds[0];
+    cell.min_y = record.bounds[1];
+    cell.min_z = record.bounds[2];
+    cell.max_x = record.bounds[3];
+    cell.max_y = record.bounds[4];
+    cell.max_z = record.bounds[5];
+    cell.data_offset = record.data_offset;
+    cell.point_num = record.point_num;
+    id_offset += record.id_length;
+
+    cell_indices_[cell.id] = cells_.size();
+    cells_.push_back(cell);
+  }
+}
+
+BinaryPointCloudMap::~BinaryPointCloudMap()
+{
+  ::munmap(const_cast<std::uint8_t *>(data_), size_);
+}
+
+bool BinaryPointCloudMap::isBinaryPointCloudMapFile(const std::string & path)
+{
+  namespace fs = std::filesystem;
+  return !fs::is_directory(path) && fs::path(path).extension() == ".pcdbin";
+}
+
+const BinaryPointCloudMapCell * BinaryPointCloudMap::findCell(const std::string & id) const
+{
+  const auto it = cell_indices_.find(id);
+  return it == cell_indices_.end() ? nullptr : &cells_[it->second];
+}
+
+void BinaryPointCloudMap::loadCell(
+  const BinaryPointCloudMapCell & cell, sensor_msgs::msg::PointCloud2 & cloud) const
+{
+  cloud.height = 1;
+  cloud.width = static_cast<std::uint32_t>(cell.point_num);
+  cloud.fields = fields_;
+  cloud.is_bigendian = false;
+  cloud.point_step = point_step_;
+  cloud.row_step = cloud.width * point_step_;
+  cloud.is_dense = false;
+
+  // the message owns its data, so this is a copy from the page cache, without any parse
+  const std::uint8_t * begin = data_ + cell.data_offset;
+  cloud.data.assign(begin, begin + cell.point_num * point_step_);
+}
+
+BinaryPointCloudMapWriter::BinaryPointCloudMapWriter(const std::string & path)
+: path_(path), file_(path, std::ios::binary | std::ios::trunc)
+{
+  if (!file_) {
+    throw std::runtime_error("Binary pointcloud map open failed: " + path);
+  }
+  // the header is written by close(), once the offsets are known
+  const std::vector<char> zeros(alignToPage(sizeof(Header)), 0);
+  file_.write(zeros.data(), static_cast<std::streamsize>(zeros.size()));
+}
+
+void BinaryPointCloudMapWriter::addCell(
+  const BinaryPointCloudMapCell & cell, const sensor_msgs::msg::PointCloud2 & cloud)
+{
+  if (cells_.empty()) {
+    for (const auto & field : cloud.fields) {
+      if (field.name.size() >= FIELD_NAME_SIZE) {
+        throw std::runtime_error("The point field name is too long: " + field.name);
+      }
+    }
+    point_step_ = cloud.point_step;
+    fields_ = cloud.fields;
+  } else if (cloud.point_step != point_step_ || !isSameLayout(cloud.fields, fields_)) {
+    throw std::runtime_error("The point layout of the cell " + cell.id + " is different");
+  }
+
+  BinaryPointCloudMapCell written_cell = cell;
+  written_cell.data_offset = static_cast<std::uint64_t>(file_.tellp());
+  written_cell.point_num = static_cast<std::uint64_t>(cloud.width) * cloud.height;
+
+  // the rows of a cloud may be padded, while the points of a cell are contiguous
+  const std::size_t row_size = static_cast<std::size_t>(cloud.width) * cloud.point_step;
+  for (std::uint32_t row = 0; row < cloud.height; ++row) {
+    file_.write(
+      reinterpret_cast<const char *>(cloud.data.data() + row * cloud.row_step),
+      static_cast<std::streamsize>(row_size));
+  }
+  const std::uint64_t end = static_cast<std::uint64_t>(file_.tellp());
+  const std::vector<char> zeros(alignToPage(end) - end, 0);
+  file_.write(zeros.data(), static_cast<std::streamsize>(zeros.size()));
+  if (!file_) {
+    throw std::runtime_error("Binary pointcloud map write failed: " + path_);
+  }
+  cells_.push_back(written_cell);
+}
+
+void BinaryPointCloudMapWriter::close()
+{
+  Header header{};
+  std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+  header.version = VERSION;
+  header.point_step = point_step_;
+  header.field_num = fields_.size();
+  header.cell_num = cells_.size();
+  header.table_offset = static_cast<std::uint64_t>(file_.tellp());
+
+  for (const auto & field : fields_) {
+    FieldRecord record{};
+    std::strncpy(record.name, field.name.c_str(), FIELD_NAME_SIZE - 1);
+    record.offset = field.offset;
+    record.count = field.count;
+    record.datatype = field.datatype;
+    file_.write(reinterpret_cast<const char *>(&record), sizeof(FieldRecord));
+  }
+  for (const auto & cell : cells_) {
+    CellRecord record{};
+    record.bounds[0] = cell.min_x;
+    record.bounds[1] = cell.min_y;
+    record.bounds[2] = cell.min_z;
+    record.bounds[3] = cell.max_x;
+    record.bounds[4] = cell.max_y;
+    record.bounds[5] = cell.max_z;
+    record.data_offset = cell.data_offset;
+    record.point_num = cell.point_num;
+    record.id_length = cell.id.size();
+    file_.write(reinterpret_cast<const char *>(&record), sizeof(CellRecord));
+  }
+  for (const auto & cell : cells_) {
+    file_.write(cell.id.data(), static_cast<std::streamsize>(cell.id.size()));
+  }
+
+  file_.seekp(0);
+  file_.write(reinterpret_cast<const char *>(&header), sizeof(Header));
+  file_.close();
+  if (!file_) {
+    throw std::runtime_error("Binary pointcloud map write failed: " + path_);
+  }
+}
@@ -0,0 +1,147 @@
+// Copyright 2023 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "cell_cache.hpp"
+
+#include <pcl/io/pcd_io.h>
+#include <pcl_conversions/pcl_conversions.h>
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+bool loadPointCloudMapCell(
+  const std::string & path, const BinaryPointCloudMap * binary_map,
+  sensor_msgs::msg::PointCloud2 & cloud)
+{
+  if (binary_map) {
+    const BinaryPointCloudMapCell * cell = binary_map->findCell(path);
+    if (!cell) {
+      return false;
+    }
+    binary_map->loadCell(*cell, cloud);
+    return true;
+  }
+  return pcl::io::loadPCDFile(path, cloud) != -1;
+}
+
+PointCloudMapCellCache::PointCloudMapCellCache(
+  const size_t capacity, std::shared_ptr<const BinaryPointCloudMap> binary_map)
+: capacity_(capacity), binary_map_(std::move(binary_map))
+{
+  prefetch_thread_ = std::thread(&PointCloudMapCellCache::runPrefetch, this);
+}
+
+PointCloudMapCellCache::~PointCloudMapCellCache()
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    stop_prefetch_ = true;
+  }
+  prefetch_condition_.notify_all();
+  prefetch_thread_.join();
+}
+
+PointCloudMapCellCache::CellConstPtr PointCloudMapCellCache::get(const std::string & path)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    const auto it = cells_.find(path);
+    if (it != cells_.end()) {
+      lru_paths_.splice(lru_paths_.end(), lru_paths_, it->second.second);
+      return it->second.first;
+    }
+  }
+
+  // the cell is loaded without the lock, so that the prefetch and the other requests go on
+  CellConstPtr cell = load(path);
+  if (cell) {
+    insert(path, cell);
+  }
+  return cell;
+}
+
+void PointCloudMapCellCache::prefetch(const std::vector<std::string> & paths)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    prefetch_queue_.clear();
+    for (const auto & path : paths) {
+      // the prefetched cells must not evict each other
+      if (prefetch_queue_.size() >= capacity_) {
+        break;
+      }
+      if (cells_.count(path) == 0) {
+        prefetch_queue_.push_back(path);
+      }
+    }
+  }
+  prefetch_condition_.notify_one();
+}
+
+bool PointCloudMapCellCache::contains(const std::string & path) const
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  return cells_.count(path) > 0;
+}
+
+PointCloudMapCellCache::CellConstPtr PointCloudMapCellCache::load(const std::string & path) const
+{
+  auto cell = std::make_shared<sensor_msgs::msg::PointCloud2>();
+  if (!loadPointCloudMapCell(path, binary_map_.get(), *cell)) {
+    return nullptr;
+  }
+  return cell;
+}
+
+void PointCloudMapCellCache::insert(const std::string & path, CellConstPtr cell)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  const auto it = cells_.find(path);
+  if (it != cells_.end()) {
+    // loaded by the prefetch and a request at the same time
+    lru_paths_.splice(lru_paths_.end(), lru_paths_, it->second.second);
+    return;
+  }
+  cells_.emplace(path, std::make_pair(cell, lru_paths_.insert(lru_paths_.end(), path)));
+  while (cells_.size() > capacity_) {
+    cells_.erase(lru_paths_.front());
+    lru_paths_.pop_front();
+  }
+}
+
+void PointCloudMapCellCache::runPrefetch()
+{
+  while (true) {
+    std::string path;
+    {
+      std::unique_lock<std::mutex> lock(mutex_);
+      prefetch_condition_.wait(lock, [this] { return stop_prefetch_ || !prefetch_queue_.empty(); });
+      if (stop_prefetch_) {
+        return;
+      }
+      path = prefetch_queue_.front();
+      prefetch_queue_.pop_front();
+      if (cells_.count(path) > 0) {
+        continue;
+      }
+    }
+
+    CellConstPtr cell = load(path);
+    if (cell) {
+      insert(path, cell);
+    }
+  }
+}
@@ -0,0 +1,79 @@
+// Copyright 2023 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef POINTCLOUD_MAP_LOADER__CELL_CACHE_HPP_
+#define POINTCLOUD_MAP_LOADER__CELL_CACHE_HPP_
+
+#include "map_loader/binary_pointcloud_map.hpp"
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+// Loads the cell of path from the binary pointcloud map if it is given, or from the PCD file.
+bool loadPointCloudMapCell(
+  const std::string & path, const BinaryPointCloudMap * binary_map,
+  sensor_msgs::msg::PointCloud2 & cloud);
+
+// A LRU cache of the cells, shared by the map loader modules, so that the cells requested by
+// several clients are loaded once. The cells can be prefetched in background.
+class PointCloudMapCellCache
+{
+public:
+  using CellConstPtr = std::shared_ptr<const sensor_msgs::msg::PointCloud2>;
+
+  PointCloudMapCellCache(
+    const size_t capacity, std::shared_ptr<const BinaryPointCloudMap> binary_map);
+  ~PointCloudMapCellCache();
+  PointCloudMapCellCache(const PointCloudMapCellCache &) = delete;
+  PointCloudMapCellCache & operator=(const PointCloudMapCellCache &) = delete;
+
+  // the cell of path, which is loaded if it is not cached. nullptr if the load fails.
+  CellConstPtr get(const std::string & path);
+
+  // loads the cells which are not cached in background, replacing the previous prefetch requests
+  void prefetch(const std::vector<std::string> & paths);
+
+  bool contains(const std::string & path) const;
+
+private:
+  CellConstPtr load(const std::string & path) const;
+  void insert(const std::string & path, CellConstPtr cell);
+  void runPrefetch();
+
+  const size_t capacity_;
+  const std::shared_ptr<const BinaryPointCloudMap> binary_map_;
+
+  mutable std::mutex mutex_;
+  // the paths of the cached cells, from the least recently used one
+  std::list<std::string> lru_paths_;
+  std::unordered_map<std::string, std::pair<CellConstPtr, std::list<std::string>::iterator>>
+    cells_;
+
+  std::deque<std::string> prefetch_queue_;
+  std::condition_variable prefetch_condition_;
+  bool stop_prefetch_{false};
+  std::thread prefetch_thread_;
+};
+
+#endif  // POINTCLOUD_MAP_LOADER__CELL_CACHE_HPP_
@@ -15,8 +15,16 @@
 #include "differential_map_loader_module.hpp"
 
 DifferentialMapLoaderModule::DifferentialMapLoaderModule(
-  rclcpp::Node * node, const std::map<std::string, PCDFileMetadata> & pcd_file_metadata_dict)
-: logger_(node->get_logger()), all_pcd_file_metadata_dict_(pcd_file_metadata_dict)
+  rclcpp::Node * node, const std::map<std::string, PCDFileMetadata> & pcd_file_metadata_dict,
+  std::shared_ptr<const BinaryPointCloudMap> binary_map,
+  std::shared_ptr<PointCloudMapCellCache> cell_cache,
+  std::shared_ptr<RoutePrefetchModule> route_prefetch)
+: logger_(node->get_logger()),
+  all_pcd_file_metadata_dict_(pcd_file_metadata_dict),
+  pcd_file_metadata_index_(all_pcd_file_metadata_dict_),
+  binary_map_(std::move(binary_map)),
+  cell_cache_(std::move(cell_cache)),
+  route_prefetch_(std::move(route_prefetch))
 {
   get_differential_pcd_maps_service_ = node->create_service<GetDifferentialPointCloudMap>(
     "service/get_differential_pcd_map",
@@ -29,22 +37,24 @@ void DifferentialMapLoaderModule::differentialAreaLoad(
   const autoware_map_msgs::msg::AreaInfo & area, const std::vector<std::string> & cached_ids,
   GetDifferentialPointCloudMap::Response::SharedPtr & response) const
 {
-  // iterate over all the available pcd map grids
+  // the first index of each cached ID, as std::find would find it
+  std::unordered_map<std::string, size_t> cached_id_indices;
+  for (size_t i = 0; i < cached_ids.size(); ++i) {
+    cached_id_indices.emplace(cached_ids[i], i);
+  }
+
+  // iterate over the pcd map grids within the queried area
   std::vector<bool> should_remove(static_cast<int>(cached_ids.size()), true);
-  for (const auto & ele : all_pcd_file_metadata_dict_) {
-    std::string path = ele.first;
-    PCDFileMetadata metadata = ele.second;
+  for (const auto & ele : pcd_file_metadata_index_.query(area)) {
+    std::string path = ele->first;
+    PCDFileMetadata metadata = ele->second;
 
     // assume that the map ID = map path (for now)
     std::string map_id = path;
 
-    // skip if the pcd file is not within the queried area
-    if (!isGridWithinQueriedArea(area, metadata)) continue;
-
-    auto id_in_cached_list = std::find(cached_ids.begin(), cached_ids.end(), map_id);
-    if (id_in_cached_list != cached_ids.end()) {
-      int index = id_in_cached_list - cached_ids.begin();
-      should_remove[index] = false;
+    auto id_in_cached_list = cached_id_indices.find(map_id);
+    if (id_in_cached_list != cached_id_indices.end()) {
+      should_remove[id_in_cached_list->second] = false;
     } else {
       autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id =
         loadPointCloudMapCellWithID(path, map_id);
@@ -71,6 +81,9 @@ bool DifferentialMapLoaderModule::onServiceGetDifferentialPointCloudMap(
   std::vector<std::string> cached_ids = req->cached_ids;
   differentialAreaLoad(area, cached_ids, res);
   res->header.frame_id = "map";
+  if (route_prefetch_) {
+    route_prefetch_->onAreaRequested(area);
+  }
   return true;
 }
 
@@ -78,12 +91,18 @@ autoware_map_msgs::msg::PointCloudMapCellWithID
 DifferentialMapLoaderModule::loadPointCloudMapCellWithID(
   const std::string & path, const std::string & map_id) const
 {
-  sensor_msgs::msg::PointCloud2 pcd;
-  if (pcl::io::loadPCDFile(path, pcd) == -1) {
+  autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id;
+  if (cell_cache_) {
+    const auto cell = cell_cache_->get(path);
+    if (cell) {
+      pointcloud_map_cell_with_id.pointcloud = *cell;
+    } else {
+      RCLCPP_ERROR_STREAM(logger_, "PCD load failed: " << path);
+    }
+  } else if (!loadPointCloudMapCell(
+               path, binary_map_.get(), pointcloud_map_cell_with_id.pointcloud)) {
     RCLCPP_ERROR_STREAM(logger_, "PCD load failed: " << path);
   }
-  autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id;
-  pointcloud_map_cell_with_id.pointcloud = pcd;
   pointcloud_map_cell_with_id.cell_id = map_id;
   return pointcloud_map_cell_with_id;
 }
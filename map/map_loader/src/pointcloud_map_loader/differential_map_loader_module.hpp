@@ -15,6 +15,9 @@
 #ifndef POINTCLOUD_MAP_LOADER__DIFFERENTIAL_MAP_LOADER_MODULE_HPP_
 #define POINTCLOUD_MAP_LOADER__DIFFERENTIAL_MAP_LOADER_MODULE_HPP_
 
+#include "cell_cache.hpp"
+#include "map_loader/binary_pointcloud_map.hpp"
+#include "route_prefetch_module.hpp"
 #include "utils.hpp"
 
 #include <rclcpp/rclcpp.hpp>
@@ -29,7 +32,9 @@
 #include <pcl_conversions/pcl_conversions.h>
 
 #include <map>
+#include <memory>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 class DifferentialMapLoaderModule
@@ -38,12 +43,22 @@ class DifferentialMapLoaderModule
 
 public:
   explicit DifferentialMapLoaderModule(
-    rclcpp::Node * node, const std::map<std::string, PCDFileMetadata> & pcd_file_metadata_dict);
+    rclcpp::Node * node, const std::map<std::string, PCDFileMetadata> & pcd_file_metadata_dict,
+    std::shared_ptr<const BinaryPointCloudMap> binary_map = nullptr,
+    std::shared_ptr<PointCloudMapCellCache> cell_cache = nullptr,
+    std::shared_ptr<RoutePrefetchModule> route_prefetch = nullptr);
 
 private:
   rclcpp::Logger logger_;
 
   std::map<std::string, PCDFileMetadata> all_pcd_file_metadata_dict_;
+  PCDFileMetadataIndex pcd_file_metadata_index_;
+  // the cells are loaded from this map instead of the PCD files, if it is given
+  std::shared_ptr<const BinaryPointCloudMap> binary_map_;
+  // the cells are shared with the other modules through this cache, if it is given
+  std::shared_ptr<PointCloudMapCellCache> cell_cache_;
+  // the cells along the route ahead of the requested areas are prefetched, if it is given
+  std::shared_ptr<RoutePrefetchModule> route_prefetch_;
   rclcpp::Service<GetDifferentialPointCloudMap>::SharedPtr get_differential_pcd_maps_service_;
 
   bool onServiceGetDifferentialPointCloudMap(
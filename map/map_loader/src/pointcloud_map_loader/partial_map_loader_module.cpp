@@ -15,8 +15,14 @@
 #include "partial_map_loader_module.hpp"
 
 PartialMapLoaderModule::PartialMapLoaderModule(
-  rclcpp::Node * node, const std::map<std::string, PCDFileMetadata> & pcd_file_metadata_dict)
-: logger_(node->get_logger()), all_pcd_file_metadata_dict_(pcd_file_metadata_dict)
+  rclcpp::Node * node, const std::map<std::string, PCDFileMetadata> & pcd_file_metadata_dict,
+  std::shared_ptr<const BinaryPointCloudMap> binary_map,
+  std::shared_ptr<PointCloudMapCellCache> cell_cache)
+: logger_(node->get_logger()),
+  all_pcd_file_metadata_dict_(pcd_file_metadata_dict),
+  pcd_file_metadata_index_(all_pcd_file_metadata_dict_),
+  binary_map_(std::move(binary_map)),
+  cell_cache_(std::move(cell_cache))
 {
   get_partial_pcd_maps_service_ = node->create_service<GetPartialPointCloudMap>(
     "service/get_partial_pcd_map", std::bind(
@@ -28,17 +34,14 @@ void PartialMapLoaderModule::partialAreaLoad(
   const autoware_map_msgs::msg::AreaInfo & area,
   GetPartialPointCloudMap::Response::SharedPtr & response) const
 {
-  // iterate over all the available pcd map grids
-  for (const auto & ele : all_pcd_file_metadata_dict_) {
-    std::string path = ele.first;
-    PCDFileMetadata metadata = ele.second;
+  // iterate over the pcd map grids within the queried area
+  for (const auto & ele : pcd_file_metadata_index_.query(area)) {
+    std::string path = ele->first;
+    PCDFileMetadata metadata = ele->second;
 
     // assume that the map ID = map path (for now)
     std::string map_id = path;
 
-    // skip if the pcd file is not within the queried area
-    if (!isGridWithinQueriedArea(area, metadata)) continue;
-
     autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id =
       loadPointCloudMapCellWithID(path, map_id);
     pointcloud_map_cell_with_id.metadata.min_x = metadata.min.x;
@@ -62,12 +65,18 @@ bool PartialMapLoaderModule::onServiceGetPartialPointCloudMap(
 autoware_map_msgs::msg::PointCloudMapCellWithID PartialMapLoaderModule::loadPointCloudMapCellWithID(
   const std::string & path, const std::string & map_id) const
 {
-  sensor_msgs::msg::PointCloud2 pcd;
-  if (pcl::io::loadPCDFile(path, pcd) == -1) {
+  autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id;
+  if (cell_cache_) {
+    const auto cell = cell_cache_->get(path);
+    if (cell) {
+      pointcloud_map_cell_with_id.pointcloud = *cell;
+    } else {
+      RCLCPP_ERROR_STREAM(logger_, "PCD load failed: " << path);
+    }
+  } else if (!loadPointCloudMapCell(
+               path, binary_map_.get(), pointcloud_map_cell_with_id.pointcloud)) {
     RCLCPP_ERROR_STREAM(logger_, "PCD load failed: " << path);
   }
-  autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id;
-  pointcloud_map_cell_with_id.pointcloud = pcd;
   pointcloud_map_cell_with_id.cell_id = map_id;
   return pointcloud_map_cell_with_id;
 }
@@ -15,6 +15,8 @@
 #ifndef POINTCLOUD_MAP_LOADER__PARTIAL_MAP_LOADER_MODULE_HPP_
 #define POINTCLOUD_MAP_LOADER__PARTIAL_MAP_LOADER_MODULE_HPP_
 
+#include "cell_cache.hpp"
+#include "map_loader/binary_pointcloud_map.hpp"
 #include "utils.hpp"
 
 #include <rclcpp/rclcpp.hpp>
@@ -29,6 +31,7 @@
 #include <pcl_conversions/pcl_conversions.h>
 
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -38,12 +41,19 @@ class PartialMapLoaderModule
 
 public:
   explicit PartialMapLoaderModule(
-    rclcpp::Node * node, const std::map<std::string, PCDFileMetadata> & pcd_file_metadata_dict);
+    rclcpp::Node * node, const std::map<std::string, PCDFileMetadata> & pcd_file_metadata_dict,
+    std::shared_ptr<const BinaryPointCloudMap> binary_map = nullptr,
+    std::shared_ptr<PointCloudMapCellCache> cell_cache = nullptr);
 
 private:
   rclcpp::Logger logger_;
 
   std::map<std::string, PCDFileMetadata> all_pcd_file_metadata_dict_;
+  PCDFileMetadataIndex pcd_file_metadata_index_;
+  // the cells are loaded from this map instead of the PCD files, if it is given
+  std::shared_ptr<const BinaryPointCloudMap> binary_map_;
+  // the cells are shared with the other modules through this cache, if it is given
+  std::shared_ptr<PointCloudMapCellCache> cell_cache_;
   rclcpp::Service<GetPartialPointCloudMap>::SharedPtr get_partial_pcd_maps_service_;
 
   bool onServiceGetPartialPointCloudMap(
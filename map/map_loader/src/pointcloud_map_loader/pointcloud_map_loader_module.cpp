@@ -40,8 +40,9 @@ sensor_msgs::msg::PointCloud2 downsample(
 
 PointcloudMapLoaderModule::PointcloudMapLoaderModule(
   rclcpp::Node * node, const std::vector<std::string> & pcd_paths,
-  const std::string & publisher_name, const bool use_downsample)
-: logger_(node->get_logger())
+  const std::string & publisher_name, const bool use_downsample,
+  std::shared_ptr<const BinaryPointCloudMap> binary_map)
+: logger_(node->get_logger()), binary_map_(std::move(binary_map))
 {
   rclcpp::QoS durable_qos{1};
   durable_qos.transient_local();
@@ -71,14 +72,16 @@ sensor_msgs::msg::PointCloud2 PointcloudMapLoaderModule::loadPCDFiles(
   sensor_msgs::msg::PointCloud2 whole_pcd;
   sensor_msgs::msg::PointCloud2 partial_pcd;
 
-  for (size_t i = 0; i < pcd_paths.size(); ++i) {
-    auto & path = pcd_paths[i];
+  const size_t file_num = binary_map_ ? binary_map_->getCells().size() : pcd_paths.size();
+  for (size_t i = 0; i < file_num; ++i) {
+    const std::string & path = binary_map_ ? binary_map_->getCells()[i].id : pcd_paths[i];
     if (i % 50 == 0) {
-      RCLCPP_INFO_STREAM(
-        logger_, fmt::format("Load {} ({} out of {})", path, i + 1, pcd_paths.size()));
+      RCLCPP_INFO_STREAM(logger_, fmt::format("Load {} ({} out of {})", path, i + 1, file_num));
     }
 
-    if (pcl::io::loadPCDFile(path, partial_pcd) == -1) {
+    if (binary_map_) {
+      binary_map_->loadCell(binary_map_->getCells()[i], partial_pcd);
+    } else if (pcl::io::loadPCDFile(path, partial_pcd) == -1) {
       RCLCPP_ERROR_STREAM(logger_, "PCD load failed: " << path);
     }
 
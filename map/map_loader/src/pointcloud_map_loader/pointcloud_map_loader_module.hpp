@@ -15,6 +15,8 @@
 #ifndef POINTCLOUD_MAP_LOADER__POINTCLOUD_MAP_LOADER_MODULE_HPP_
 #define POINTCLOUD_MAP_LOADER__POINTCLOUD_MAP_LOADER_MODULE_HPP_
 
+#include "map_loader/binary_pointcloud_map.hpp"
+
 #include <rclcpp/rclcpp.hpp>
 
 #include <sensor_msgs/msg/point_cloud2.hpp>
@@ -25,6 +27,7 @@
 #include <pcl/io/pcd_io.h>
 #include <pcl_conversions/pcl_conversions.h>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -33,11 +36,14 @@ class PointcloudMapLoaderModule
 public:
   explicit PointcloudMapLoaderModule(
     rclcpp::Node * node, const std::vector<std::string> & pcd_paths,
-    const std::string & publisher_name, const bool use_downsample);
+    const std::string & publisher_name, const bool use_downsample,
+    std::shared_ptr<const BinaryPointCloudMap> binary_map = nullptr);
 
 private:
   rclcpp::Logger logger_;
   rclcpp::Publisher<sensor_msgs::msg::PointCloud2>::SharedPtr pub_pointcloud_map_;
+  // the cells are loaded from this map instead of the PCD files, if it is given
+  std::shared_ptr<const BinaryPointCloudMap> binary_map_;
 
   sensor_msgs::msg::PointCloud2 loadPCDFiles(
     const std::vector<std::string> & pcd_paths, const boost::optional<float> leaf_size) const;
@@ -47,46 +47,75 @@ bool isPcdFile(const std::string & p)
 PointCloudMapLoaderNode::PointCloudMapLoaderNode(const rclcpp::NodeOptions & options)
 : Node("pointcloud_map_loader", options)
 {
-  const auto pcd_paths =
-    getPcdPaths(declare_parameter<std::vector<std::string>>("pcd_paths_or_directory"));
+  const auto pcd_paths_or_directory =
+    declare_parameter<std::vector<std::string>>("pcd_paths_or_directory");
+  const auto pcd_paths = getPcdPaths(pcd_paths_or_directory);
+  const auto binary_map = loadBinaryPointCloudMap(pcd_paths_or_directory);
   std::string pcd_metadata_path = declare_parameter<std::string>("pcd_metadata_path");
   bool enable_whole_load = declare_parameter<bool>("enable_whole_load");
   bool enable_downsample_whole_load = declare_parameter<bool>("enable_downsampled_whole_load");
   bool enable_partial_load = declare_parameter<bool>("enable_partial_load");
   bool enable_differential_load = declare_parameter<bool>("enable_differential_load");
   bool enable_selected_load = declare_parameter<bool>("enable_selected_load");
+  const auto cell_cache_size = declare_parameter<int>("cell_cache_size", 0);
+  const bool enable_route_prefetch = declare_parameter<bool>("enable_route_prefetch", false);
 
   if (enable_whole_load) {
     std::string publisher_name = "output/pointcloud_map";
-    pcd_map_loader_ =
-      std::make_unique<PointcloudMapLoaderModule>(this, pcd_paths, publisher_name, false);
+    pcd_map_loader_ = std::make_unique<PointcloudMapLoaderModule>(
+      this, pcd_paths, publisher_name, false, binary_map);
   }
 
   if (enable_downsample_whole_load) {
     std::string publisher_name = "output/debug/downsampled_pointcloud_map";
-    downsampled_pcd_map_loader_ =
-      std::make_unique<PointcloudMapLoaderModule>(this, pcd_paths, publisher_name, true);
+    downsampled_pcd_map_loader_ = std::make_unique<PointcloudMapLoaderModule>(
+      this, pcd_paths, publisher_name, true, binary_map);
   }
 
   if (enable_partial_load || enable_differential_load || enable_selected_load) {
     std::map<std::string, PCDFileMetadata> pcd_metadata_dict;
-    try {
-      pcd_metadata_dict = getPCDMetadata(pcd_metadata_path, pcd_paths);
-    } catch (std::runtime_error & e) {
-      RCLCPP_ERROR_STREAM(get_logger(), e.what());
+    if (binary_map) {
+      // the binary pointcloud map has its own metadata
+      pcd_metadata_dict = getBinaryPointCloudMapMetadata(*binary_map);
+    } else {
+      try {
+        pcd_metadata_dict = getPCDMetadata(pcd_metadata_path, pcd_paths);
+      } catch (std::runtime_error & e) {
+        RCLCPP_ERROR_STREAM(get_logger(), e.what());
+      }
+    }
+
+    // the cells requested by several clients are loaded once and shared by the modules
+    std::shared_ptr<PointCloudMapCellCache> cell_cache;
+    if (cell_cache_size > 0) {
+      cell_cache =
+        std::make_shared<PointCloudMapCellCache>(static_cast<size_t>(cell_cache_size), binary_map);
+    }
+
+    std::shared_ptr<RoutePrefetchModule> route_prefetch;
+    if (enable_route_prefetch) {
+      if (cell_cache && enable_differential_load) {
+        route_prefetch = std::make_shared<RoutePrefetchModule>(this, pcd_metadata_dict, cell_cache);
+      } else {
+        RCLCPP_WARN(
+          get_logger(),
+          "Route prefetch needs cell_cache_size > 0 and enable_differential_load, disabled");
+      }
     }
 
     if (enable_partial_load) {
-      partial_map_loader_ = std::make_unique<PartialMapLoaderModule>(this, pcd_metadata_dict);
+      partial_map_loader_ =
+        std::make_unique<PartialMapLoaderModule>(this, pcd_metadata_dict, binary_map, cell_cache);
     }
 
     if (enable_differential_load) {
-      differential_map_loader_ =
-        std::make_unique<DifferentialMapLoaderModule>(this, pcd_metadata_dict);
+      differential_map_loader_ = std::make_unique<DifferentialMapLoaderModule>(
+        this, pcd_metadata_dict, binary_map, cell_cache, route_prefetch);
     }
 
     if (enable_selected_load) {
-      selected_map_loader_ = std::make_unique<SelectedMapLoaderModule>(this, pcd_metadata_dict);
+      selected_map_loader_ =
+        std::make_unique<SelectedMapLoaderModule>(this, pcd_metadata_dict, binary_map, cell_cache);
     }
   }
 }
@@ -120,6 +149,39 @@ std::map<std::string, PCDFileMetadata> PointCloudMapLoaderNode::getPCDMetadata(
   return pcd_metadata_dict;
 }
 
+std::map<std::string, PCDFileMetadata> PointCloudMapLoaderNode::getBinaryPointCloudMapMetadata(
+  const BinaryPointCloudMap & binary_map) const
+{
+  std::map<std::string, PCDFileMetadata> pcd_metadata_dict;
+  for (const auto & cell : binary_map.getCells()) {
+    PCDFileMetadata metadata;
+    metadata.min = pcl::PointXYZ(cell.min_x, cell.min_y, cell.min_z);
+    metadata.max = pcl::PointXYZ(cell.max_x, cell.max_y, cell.max_z);
+    pcd_metadata_dict[cell.id] = metadata;
+  }
+  return pcd_metadata_dict;
+}
+
+std::shared_ptr<const BinaryPointCloudMap> PointCloudMapLoaderNode::loadBinaryPointCloudMap(
+  const std::vector<std::string> & pcd_paths_or_directory) const
+{
+  for (const auto & p : pcd_paths_or_directory) {
+    if (!fs::exists(p) || !BinaryPointCloudMap::isBinaryPointCloudMapFile(p)) {
+      continue;
+    }
+    try {
+      auto binary_map = std::make_shared<const BinaryPointCloudMap>(p);
+      RCLCPP_INFO_STREAM(
+        get_logger(), "Mapped binary pointcloud map: " << p << " (" << binary_map->getCells().size()
+                                                       << " cells)");
+      return binary_map;
+    } catch (std::runtime_error & e) {
+      RCLCPP_ERROR_STREAM(get_logger(), e.what());
+    }
+  }
+  return nullptr;
+}
+
 std::vector<std::string> PointCloudMapLoaderNode::getPcdPaths(
   const std::vector<std::string> & pcd_paths_or_directory) const
 {
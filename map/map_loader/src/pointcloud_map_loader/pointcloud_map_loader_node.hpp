@@ -49,6 +49,10 @@ private:
     const std::vector<std::string> & pcd_paths_or_directory) const;
   std::map<std::string, PCDFileMetadata> getPCDMetadata(
     const std::string & pcd_metadata_path, const std::vector<std::string> & pcd_paths) const;
+  std::shared_ptr<const BinaryPointCloudMap> loadBinaryPointCloudMap(
+    const std::vector<std::string> & pcd_paths_or_directory) const;
+  std::map<std::string, PCDFileMetadata> getBinaryPointCloudMapMetadata(
+    const BinaryPointCloudMap & binary_map) const;
 };
 
 #endif  // POINTCLOUD_MAP_LOADER__POINTCLOUD_MAP_LOADER_NODE_HPP_
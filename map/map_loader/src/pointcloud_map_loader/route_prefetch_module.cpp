@@ -0,0 +1,137 @@
+// Copyright 2023 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "route_prefetch_module.hpp"
+
+#include <lanelet2_extension/utility/message_conversion.hpp>
+
+#include <cmath>
+#include <limits>
+#include <memory>
+#include <string>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
+RoutePrefetchModule::RoutePrefetchModule(
+  rclcpp::Node * node, const std::map<std::string, PCDFileMetadata> & pcd_file_metadata_dict,
+  std::shared_ptr<PointCloudMapCellCache> cell_cache)
+: logger_(node->get_logger()),
+  prefetch_distance_(node->declare_parameter<double>("route_prefetch_distance", 200.0)),
+  prefetch_radius_(node->declare_parameter<double>("route_prefetch_radius", 150.0)),
+  all_pcd_file_metadata_dict_(pcd_file_metadata_dict),
+  pcd_file_metadata_index_(all_pcd_file_metadata_dict_),
+  cell_cache_(std::move(cell_cache))
+{
+  sub_vector_map_ = node->create_subscription<HADMapBin>(
+    "input/vector_map", rclcpp::QoS{1}.transient_local(),
+    std::bind(&RoutePrefetchModule::onVectorMap, this, std::placeholders::_1));
+  sub_route_ = node->create_subscription<LaneletRoute>(
+    "input/route", rclcpp::QoS{1}.transient_local(),
+    std::bind(&RoutePrefetchModule::onRoute, this, std::placeholders::_1));
+}
+
+void RoutePrefetchModule::onVectorMap(const HADMapBin::ConstSharedPtr msg)
+{
+  auto lanelet_map = std::make_shared<lanelet::LaneletMap>();
+  lanelet::utils::conversion::fromBinMsg(*msg, lanelet_map);
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  lanelet_map_ = lanelet_map;
+  updateRoutePoints();
+}
+
+void RoutePrefetchModule::onRoute(const LaneletRoute::ConstSharedPtr msg)
+{
+  std::lock_guard<std::mutex> lock(mutex_);
+  route_ = msg;
+  updateRoutePoints();
+}
+
+void RoutePrefetchModule::updateRoutePoints()
+{
+  route_points_.clear();
+  if (!lanelet_map_ || !route_) {
+    return;
+  }
+
+  // the centerline of the preferred lanelets, resampled so that the prefetch areas overlap
+  const double interval = prefetch_radius_ / 2.0;
+  double distance = 0.0;
+  double prev_x = 0.0;
+  double prev_y = 0.0;
+  for (const auto & segment : route_->segments) {
+    if (!lanelet_map_->laneletLayer.exists(segment.preferred_primitive.id)) {
+      RCLCPP_ERROR_STREAM(
+        logger_, "Lanelet of the route not found: " << segment.preferred_primitive.id);
+      route_points_.clear();
+      return;
+    }
+    const lanelet::ConstLanelet lanelet =
+      lanelet_map_->laneletLayer.get(segment.preferred_primitive.id);
+    for (const auto & point : lanelet.centerline2d()) {
+      if (!route_points_.empty()) {
+        distance += std::hypot(point.x() - prev_x, point.y() - prev_y);
+      }
+      prev_x = point.x();
+      prev_y = point.y();
+      if (route_points_.empty() || distance - route_points_.back().distance >= interval) {
+        route_points_.push_back({point.x(), point.y(), distance});
+      }
+    }
+  }
+}
+
+void RoutePrefetchModule::onAreaRequested(const autoware_map_msgs::msg::AreaInfo & area)
+{
+  std::vector<std::string> paths;
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    if (route_points_.empty()) {
+      return;
+    }
+
+    // the route point nearest to the area, which must be on the route
+    size_t nearest_index = 0;
+    double nearest_squared_distance = std::numeric_limits<double>::max();
+    for (size_t i = 0; i < route_points_.size(); ++i) {
+      const double dx = route_points_[i].x - area.center_x;
+      const double dy = route_points_[i].y - area.center_y;
+      if (dx * dx + dy * dy < nearest_squared_distance) {
+        nearest_squared_distance = dx * dx + dy * dy;
+        nearest_index = i;
+      }
+    }
+    if (nearest_squared_distance > prefetch_radius_ * prefetch_radius_) {
+      return;
+    }
+
+    std::unordered_set<std::string> added_paths;
+    const double end_distance = route_points_[nearest_index].distance + prefetch_distance_;
+    for (size_t i = nearest_index;
+         i < route_points_.size() && route_points_[i].distance <= end_distance; ++i) {
+      autoware_map_msgs::msg::AreaInfo prefetch_area;
+      prefetch_area.center_x = static_cast<float>(route_points_[i].x);
+      prefetch_area.center_y = static_cast<float>(route_points_[i].y);
+      prefetch_area.radius = static_cast<float>(prefetch_radius_);
+      // the nearer cells are prefetched first
+      for (const auto & ele : pcd_file_metadata_index_.query(prefetch_area)) {
+        if (added_paths.insert(ele->first).second) {
+          paths.push_back(ele->first);
+        }
+      }
+    }
+  }
+  cell_cache_->prefetch(paths);
+}
@@ -0,0 +1,80 @@
+// Copyright 2023 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef POINTCLOUD_MAP_LOADER__ROUTE_PREFETCH_MODULE_HPP_
+#define POINTCLOUD_MAP_LOADER__ROUTE_PREFETCH_MODULE_HPP_
+
+#include "cell_cache.hpp"
+#include "utils.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <autoware_auto_mapping_msgs/msg/had_map_bin.hpp>
+#include <autoware_map_msgs/msg/area_info.hpp>
+#include <autoware_planning_msgs/msg/lanelet_route.hpp>
+
+#include <lanelet2_core/LaneletMap.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+// Prefetches the cells along the route from mission_planner into the cell cache, ahead of the
+// areas requested by the clients, so that the cells are cached when the vehicle gets there.
+class RoutePrefetchModule
+{
+  using HADMapBin = autoware_auto_mapping_msgs::msg::HADMapBin;
+  using LaneletRoute = autoware_planning_msgs::msg::LaneletRoute;
+
+public:
+  RoutePrefetchModule(
+    rclcpp::Node * node, const std::map<std::string, PCDFileMetadata> & pcd_file_metadata_dict,
+    std::shared_ptr<PointCloudMapCellCache> cell_cache);
+
+  // prefetches the cells along the route ahead of the area, if the area is on the route
+  void onAreaRequested(const autoware_map_msgs::msg::AreaInfo & area);
+
+private:
+  struct RoutePoint
+  {
+    double x;
+    double y;
+    double distance;  // along the route from its start
+  };
+
+  rclcpp::Logger logger_;
+
+  const double prefetch_distance_;
+  const double prefetch_radius_;
+
+  std::map<std::string, PCDFileMetadata> all_pcd_file_metadata_dict_;
+  PCDFileMetadataIndex pcd_file_metadata_index_;
+  std::shared_ptr<PointCloudMapCellCache> cell_cache_;
+
+  rclcpp::Subscription<HADMapBin>::SharedPtr sub_vector_map_;
+  rclcpp::Subscription<LaneletRoute>::SharedPtr sub_route_;
+
+  std::mutex mutex_;
+  lanelet::LaneletMapPtr lanelet_map_;
+  LaneletRoute::ConstSharedPtr route_;
+  std::vector<RoutePoint> route_points_;
+
+  void onVectorMap(const HADMapBin::ConstSharedPtr msg);
+  void onRoute(const LaneletRoute::ConstSharedPtr msg);
+  void updateRoutePoints();
+};
+
+#endif  // POINTCLOUD_MAP_LOADER__ROUTE_PREFETCH_MODULE_HPP_
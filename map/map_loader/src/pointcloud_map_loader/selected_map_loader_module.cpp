@@ -44,8 +44,13 @@ autoware_map_msgs::msg::PointCloudMapMetaData createMetadata(
 }  // namespace
 
 SelectedMapLoaderModule::SelectedMapLoaderModule(
-  rclcpp::Node * node, const std::map<std::string, PCDFileMetadata> & pcd_file_metadata_dict)
-: logger_(node->get_logger()), all_pcd_file_metadata_dict_(pcd_file_metadata_dict)
+  rclcpp::Node * node, const std::map<std::string, PCDFileMetadata> & pcd_file_metadata_dict,
+  std::shared_ptr<const BinaryPointCloudMap> binary_map,
+  std::shared_ptr<PointCloudMapCellCache> cell_cache)
+: logger_(node->get_logger()),
+  all_pcd_file_metadata_dict_(pcd_file_metadata_dict),
+  binary_map_(std::move(binary_map)),
+  cell_cache_(std::move(cell_cache))
 {
   get_selected_pcd_maps_service_ = node->create_service<GetSelectedPointCloudMap>(
     "service/get_selected_pcd_map", std::bind(
@@ -96,12 +101,18 @@ autoware_map_msgs::msg::PointCloudMapCellWithID
 SelectedMapLoaderModule::loadPointCloudMapCellWithID(
   const std::string & path, const std::string & map_id) const
 {
-  sensor_msgs::msg::PointCloud2 pcd;
-  if (pcl::io::loadPCDFile(path, pcd) == -1) {
+  autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id;
+  if (cell_cache_) {
+    const auto cell = cell_cache_->get(path);
+    if (cell) {
+      pointcloud_map_cell_with_id.pointcloud = *cell;
+    } else {
+      RCLCPP_ERROR_STREAM(logger_, "PCD load failed: " << path);
+    }
+  } else if (!loadPointCloudMapCell(
+               path, binary_map_.get(), pointcloud_map_cell_with_id.pointcloud)) {
     RCLCPP_ERROR_STREAM(logger_, "PCD load failed: " << path);
   }
-  autoware_map_msgs::msg::PointCloudMapCellWithID pointcloud_map_cell_with_id;
-  pointcloud_map_cell_with_id.pointcloud = pcd;
   pointcloud_map_cell_with_id.cell_id = map_id;
   return pointcloud_map_cell_with_id;
 }
@@ -15,6 +15,8 @@
 #ifndef POINTCLOUD_MAP_LOADER__SELECTED_MAP_LOADER_MODULE_HPP_
 #define POINTCLOUD_MAP_LOADER__SELECTED_MAP_LOADER_MODULE_HPP_
 
+#include "cell_cache.hpp"
+#include "map_loader/binary_pointcloud_map.hpp"
 #include "utils.hpp"
 
 #include <rclcpp/rclcpp.hpp>
@@ -30,6 +32,7 @@
 #include <pcl_conversions/pcl_conversions.h>
 
 #include <map>
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -39,12 +42,18 @@ class SelectedMapLoaderModule
 
 public:
   explicit SelectedMapLoaderModule(
-    rclcpp::Node * node, const std::map<std::string, PCDFileMetadata> & pcd_file_metadata_dict);
+    rclcpp::Node * node, const std::map<std::string, PCDFileMetadata> & pcd_file_metadata_dict,
+    std::shared_ptr<const BinaryPointCloudMap> binary_map = nullptr,
+    std::shared_ptr<PointCloudMapCellCache> cell_cache = nullptr);
 
 private:
   rclcpp::Logger logger_;
 
   std::map<std::string, PCDFileMetadata> all_pcd_file_metadata_dict_;
+  // the cells are loaded from this map instead of the PCD files, if it is given
+  std::shared_ptr<const BinaryPointCloudMap> binary_map_;
+  // the cells are shared with the other modules through this cache, if it is given
+  std::shared_ptr<PointCloudMapCellCache> cell_cache_;
   rclcpp::Service<GetSelectedPointCloudMap>::SharedPtr get_selected_pcd_maps_service_;
 
   rclcpp::Publisher<autoware_map_msgs::msg::PointCloudMapMetaData>::SharedPtr pub_metadata_;
@@ -16,6 +16,8 @@
 
 #include <fmt/format.h>
 
+#include <algorithm>
+#include <cmath>
 #include <map>
 #include <string>
 #include <vector>
@@ -99,3 +101,88 @@ bool isGridWithinQueriedArea(
   bool res = cylinderAndBoxOverlapExists(center_x, center_y, radius, metadata.min, metadata.max);
   return res;
 }
+
+PCDFileMetadataIndex::PCDFileMetadataIndex(
+  const std::map<std::string, PCDFileMetadata> & pcd_metadata_dict)
+{
+  if (pcd_metadata_dict.empty()) {
+    return;
+  }
+
+  double max_x = std::numeric_limits<double>::lowest();
+  double max_y = std::numeric_limits<double>::lowest();
+  min_x_ = std::numeric_limits<double>::max();
+  min_y_ = std::numeric_limits<double>::max();
+  double max_size = 0.0;
+  for (auto it = pcd_metadata_dict.begin(); it != pcd_metadata_dict.end(); ++it) {
+    const PCDFileMetadata & metadata = it->second;
+    min_x_ = std::min(min_x_, static_cast<double>(metadata.min.x));
+    min_y_ = std::min(min_y_, static_cast<double>(metadata.min.y));
+    max_x = std::max(max_x, static_cast<double>(metadata.max.x));
+    max_y = std::max(max_y, static_cast<double>(metadata.max.y));
+    max_size = std::max<double>(
+      max_size, std::max(metadata.max.x - metadata.min.x, metadata.max.y - metadata.min.y));
+    entries_.push_back(it);
+  }
+  if (max_size > 0.0) {
+    grid_size_ = max_size;
+  }
+  grid_num_x_ = static_cast<std::int64_t>(std::floor((max_x - min_x_) / grid_size_)) + 1;
+  grid_num_y_ = static_cast<std::int64_t>(std::floor((max_y - min_y_) / grid_size_)) + 1;
+
+  for (size_t i = 0; i < entries_.size(); ++i) {
+    const PCDFileMetadata & metadata = entries_[i]->second;
+    const std::int64_t begin_x = toGridX(metadata.min.x);
+    const std::int64_t end_x = toGridX(metadata.max.x);
+    const std::int64_t begin_y = toGridY(metadata.min.y);
+    const std::int64_t end_y = toGridY(metadata.max.y);
+    for (std::int64_t grid_x = begin_x; grid_x <= end_x; ++grid_x) {
+      for (std::int64_t grid_y = begin_y; grid_y <= end_y; ++grid_y) {
+        grids_[toKey(grid_x, grid_y)].push_back(static_cast<int>(i));
+      }
+    }
+  }
+}
+
+std::vector<PCDFileMetadataIndex::Iterator> PCDFileMetadataIndex::query(
+  const autoware_map_msgs::msg::AreaInfo & area) const
+{
+  // a PCD file within the area overlaps with the square around the area
+  const std::int64_t begin_x = std::max<std::int64_t>(toGridX(area.center_x - area.radius), 0);
+  const std::int64_t end_x = std::min(toGridX(area.center_x + area.radius), grid_num_x_ - 1);
+  const std::int64_t begin_y = std::max<std::int64_t>(toGridY(area.center_y - area.radius), 0);
+  const std::int64_t end_y = std::min(toGridY(area.center_y + area.radius), grid_num_y_ - 1);
+  if (grids_.empty() || begin_x > end_x || begin_y > end_y) {
+    return {};
+  }
+
+  std::vector<int> candidates;
+  const auto add_candidates = [&](const std::vector<int> & indices) {
+    candidates.insert(candidates.end(), indices.begin(), indices.end());
+  };
+  if ((end_x - begin_x + 1) * (end_y - begin_y + 1) > static_cast<std::int64_t>(grids_.size())) {
+    // the area covers most of the map
+    for (const auto & grid : grids_) {
+      add_candidates(grid.second);
+    }
+  } else {
+    for (std::int64_t grid_x = begin_x; grid_x <= end_x; ++grid_x) {
+      for (std::int64_t grid_y = begin_y; grid_y <= end_y; ++grid_y) {
+        const auto grid = grids_.find(toKey(grid_x, grid_y));
+        if (grid != grids_.end()) {
+          add_candidates(grid->second);
+        }
+      }
+    }
+  }
+  std::sort(candidates.begin(), candidates.end());
+  candidates.erase(std::unique(candidates.begin(), candidates.end()), candidates.end());
+
+  std::vector<Iterator> result;
+  for (const int index : candidates) {
+    if (isGridWithinQueriedArea(area, entries_[index]->second)) {
+      result.push_back(entries_[index]);
+    }
+  }
+  return result;
+}
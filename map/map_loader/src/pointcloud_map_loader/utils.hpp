@@ -21,8 +21,12 @@
 #include <pcl/common/common.h>
 #include <yaml-cpp/yaml.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 struct PCDFileMetadata
@@ -47,4 +51,40 @@ bool cylinderAndBoxOverlapExists(
 bool isGridWithinQueriedArea(
   const autoware_map_msgs::msg::AreaInfo area, const PCDFileMetadata metadata);
 
+// A uniform grid over the PCD file metadata, so that an area query only checks the PCD files in
+// the grids around the area. The grid size is the largest size of the PCD files, so that each of
+// them is in at most 2x2 grids. The metadata dict must outlive the index.
+class PCDFileMetadataIndex
+{
+public:
+  using Iterator = std::map<std::string, PCDFileMetadata>::const_iterator;
+
+  explicit PCDFileMetadataIndex(const std::map<std::string, PCDFileMetadata> & pcd_metadata_dict);
+
+  // the PCD files which overlap with the area, in the order of the metadata dict
+  std::vector<Iterator> query(const autoware_map_msgs::msg::AreaInfo & area) const;
+
+private:
+  // the grid of a coordinate, clamped to [-1, grid_num] since the queries may be out of the map
+  std::int64_t toGridX(const double x) const { return toGrid(x, min_x_, grid_num_x_); }
+  std::int64_t toGridY(const double y) const { return toGrid(y, min_y_, grid_num_y_); }
+  std::int64_t toGrid(const double value, const double min, const std::int64_t grid_num) const
+  {
+    const double grid = std::floor((value - min) / grid_size_);
+    return static_cast<std::int64_t>(std::clamp(grid, -1.0, static_cast<double>(grid_num)));
+  }
+  std::int64_t toKey(const std::int64_t grid_x, const std::int64_t grid_y) const
+  {
+    return grid_x * grid_num_y_ + grid_y;
+  }
+
+  std::vector<Iterator> entries_;
+  double min_x_{0.0};
+  double min_y_{0.0};
+  double grid_size_{1.0};
+  std::int64_t grid_num_x_{1};
+  std::int64_t grid_num_y_{1};
+  std::unordered_map<std::int64_t, std::vector<int>> grids_;
+};
+
 #endif  // POINTCLOUD_MAP_LOADER__UTILS_HPP_
@@ -0,0 +1,113 @@
+// Copyright 2023 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "map_loader/binary_pointcloud_map.hpp"
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <gtest/gtest.h>
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+#include <pcl_conversions/pcl_conversions.h>
+
+#include <fstream>
+#include <stdexcept>
+#include <string>
+
+namespace
+{
+sensor_msgs::msg::PointCloud2 createCloud(const int point_num, const float offset)
+{
+  pcl::PointCloud<pcl::PointXYZ> cloud;
+  for (int i = 0; i < point_num; ++i) {
+    cloud.push_back(pcl::PointXYZ(offset + i, offset + i * 2, offset + i * 3));
+  }
+  sensor_msgs::msg::PointCloud2 msg;
+  pcl::toROSMsg(cloud, msg);
+  return msg;
+}
+
+BinaryPointCloudMapCell createCell(const std::string & id, const float min_x, const float min_y)
+{
+  BinaryPointCloudMapCell cell{};
+  cell.id = id;
+  cell.min_x = min_x;
+  cell.min_y = min_y;
+  cell.max_x = min_x + 20.0f;
+  cell.max_y = min_y + 20.0f;
+  return cell;
+}
+}  // namespace
+
+TEST(BinaryPointCloudMapTest, WrittenCellsAreReadBack)
+{
+  const std::string path = "/tmp/test_binary_pointcloud_map.pcdbin";
+  const auto cloud_a = createCloud(5, 0.0f);
+  const auto cloud_b = createCloud(1000, 20.0f);
+  {
+    BinaryPointCloudMapWriter writer(path);
+    writer.addCell(createCell("A.pcd", 0.0f, 0.0f), cloud_a);
+    writer.addCell(createCell("B.pcd", 20.0f, 0.0f), cloud_b);
+    writer.close();
+  }
+
+  const BinaryPointCloudMap map(path);
+  ASSERT_EQ(map.getCells().size(), 2u);
+  EXPECT_EQ(map.findCell("C.pcd"), nullptr);
+
+  const BinaryPointCloudMapCell * cell = map.findCell("B.pcd");
+  ASSERT_NE(cell, nullptr);
+  EXPECT_FLOAT_EQ(cell->min_x, 20.0f);
+  EXPECT_FLOAT_EQ(cell->max_y, 20.0f);
+  EXPECT_EQ(cell->point_num, 1000u);
+  // the points of a cell start at a page boundary
+  EXPECT_EQ(cell->data_offset % 4096, 0u);
+
+  sensor_msgs::msg::PointCloud2 loaded;
+  map.loadCell(*cell, loaded);
+  EXPECT_EQ(loaded.width, cloud_b.width);
+  EXPECT_EQ(loaded.point_step, cloud_b.point_step);
+  ASSERT_EQ(loaded.fields.size(), cloud_b.fields.size());
+  EXPECT_EQ(loaded.fields[2].name, "z");
+  EXPECT_EQ(loaded.data, cloud_b.data);
+
+  map.loadCell(*map.findCell("A.pcd"), loaded);
+  EXPECT_EQ(loaded.data, cloud_a.data);
+}
+
+TEST(BinaryPointCloudMapTest, DifferentPointLayoutIsRejected)
+{
+  pcl::PointCloud<pcl::PointXYZI> cloud;
+  cloud.push_back(pcl::PointXYZI(1.0f));
+  sensor_msgs::msg::PointCloud2 msg;
+  pcl::toROSMsg(cloud, msg);
+
+  BinaryPointCloudMapWriter writer("/tmp/test_binary_pointcloud_map_layout.pcdbin");
+  writer.addCell(createCell("A.pcd", 0.0f, 0.0f), createCloud(3, 0.0f));
+  EXPECT_THROW(writer.addCell(createCell("B.pcd", 20.0f, 0.0f), msg), std::runtime_error);
+}
+
+TEST(BinaryPointCloudMapTest, InvalidFileIsRejected)
+{
+  const std::string path = "/tmp/test_binary_pointcloud_map_invalid.pcdbin";
+  std::ofstream(path) << "this is not a binary pointcloud map";
+  EXPECT_THROW(BinaryPointCloudMap{path}, std::runtime_error);
+  EXPECT_THROW(BinaryPointCloudMap{"/tmp/not_found.pcdbin"}, std::runtime_error);
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
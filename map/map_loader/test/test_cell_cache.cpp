@@ -0,0 +1,92 @@
+// Copyright 2023 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../src/pointcloud_map_loader/cell_cache.hpp"
+
+#include <gtest/gtest.h>
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+#include <pcl_conversions/pcl_conversions.h>
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <thread>
+
+namespace
+{
+std::shared_ptr<const BinaryPointCloudMap> createBinaryMap(const int cell_num)
+{
+  const std::string path = "/tmp/test_cell_cache.pcdbin";
+  BinaryPointCloudMapWriter writer(path);
+  for (int i = 0; i < cell_num; ++i) {
+    pcl::PointCloud<pcl::PointXYZ> cloud;
+    cloud.push_back(pcl::PointXYZ(i, i, i));
+    sensor_msgs::msg::PointCloud2 msg;
+    pcl::toROSMsg(cloud, msg);
+    BinaryPointCloudMapCell cell{};
+    cell.id = std::to_string(i) + ".pcd";
+    cell.min_x = 20.0f * i;
+    cell.max_x = 20.0f * (i + 1);
+    cell.max_y = 20.0f;
+    writer.addCell(cell, msg);
+  }
+  writer.close();
+  return std::make_shared<const BinaryPointCloudMap>(path);
+}
+}  // namespace
+
+TEST(PointCloudMapCellCacheTest, CellsAreLoadedOnce)
+{
+  PointCloudMapCellCache cache(2, createBinaryMap(3));
+
+  const auto cell = cache.get("0.pcd");
+  ASSERT_NE(cell, nullptr);
+  EXPECT_EQ(cell->width, 1u);
+  EXPECT_EQ(cache.get("0.pcd"), cell);
+  EXPECT_EQ(cache.get("not_found.pcd"), nullptr);
+}
+
+TEST(PointCloudMapCellCacheTest, LeastRecentlyUsedCellIsEvicted)
+{
+  PointCloudMapCellCache cache(2, createBinaryMap(3));
+
+  cache.get("0.pcd");
+  cache.get("1.pcd");
+  cache.get("0.pcd");
+  cache.get("2.pcd");
+  EXPECT_TRUE(cache.contains("0.pcd"));
+  EXPECT_FALSE(cache.contains("1.pcd"));
+  EXPECT_TRUE(cache.contains("2.pcd"));
+}
+
+TEST(PointCloudMapCellCacheTest, CellsArePrefetched)
+{
+  PointCloudMapCellCache cache(2, createBinaryMap(3));
+
+  cache.prefetch({"1.pcd", "2.pcd", "0.pcd"});
+  for (int i = 0; i < 100 && !(cache.contains("1.pcd") && cache.contains("2.pcd")); ++i) {
+    std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  }
+  EXPECT_TRUE(cache.contains("1.pcd"));
+  EXPECT_TRUE(cache.contains("2.pcd"));
+  // beyond the capacity, so that the prefetched cells do not evict each other
+  EXPECT_FALSE(cache.contains("0.pcd"));
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,92 @@
+// Copyright 2023 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../src/lanelet2_map_loader/lanelet2_map_cache.hpp"
+
+#include <gtest/gtest.h>
+
+#include <fstream>
+#include <string>
+
+namespace
+{
+const std::string map_path = "/tmp/test_lanelet2_map_cache.osm";
+const std::string cache_path = "/tmp/test_lanelet2_map_cache.bin";
+
+tier4_map_msgs::msg::MapProjectorInfo createProjectorInfo()
+{
+  tier4_map_msgs::msg::MapProjectorInfo projector_info;
+  projector_info.projector_type = tier4_map_msgs::msg::MapProjectorInfo::MGRS;
+  projector_info.mgrs_grid = "54SUE";
+  return projector_info;
+}
+
+autoware_auto_mapping_msgs::msg::HADMapBin createMapBinMsg()
+{
+  autoware_auto_mapping_msgs::msg::HADMapBin map_bin_msg;
+  map_bin_msg.format_version = "1.1.0";
+  map_bin_msg.map_version = "2";
+  map_bin_msg.data = {1, 2, 3, 4, 5};
+  return map_bin_msg;
+}
+}  // namespace
+
+TEST(Lanelet2MapCacheTest, SavedMapIsLoadedWithTheSameKey)
+{
+  std::ofstream(map_path) << "<osm></osm>";
+  const auto key = lanelet2_map_cache::create_key(map_path, createProjectorInfo(), 5.0);
+  ASSERT_FALSE(key.empty());
+  EXPECT_EQ(key, lanelet2_map_cache::create_key(map_path, createProjectorInfo(), 5.0));
+
+  lanelet2_map_cache::save(cache_path, key, createMapBinMsg());
+  autoware_auto_mapping_msgs::msg::HADMapBin loaded;
+  ASSERT_TRUE(lanelet2_map_cache::load(cache_path, key, loaded));
+  EXPECT_EQ(loaded.format_version, "1.1.0");
+  EXPECT_EQ(loaded.map_version, "2");
+  EXPECT_EQ(loaded.data, createMapBinMsg().data);
+}
+
+TEST(Lanelet2MapCacheTest, KeyChangesWithTheMapAndTheProjector)
+{
+  std::ofstream(map_path) << "<osm></osm>";
+  const auto key = lanelet2_map_cache::create_key(map_path, createProjectorInfo(), 5.0);
+  lanelet2_map_cache::save(cache_path, key, createMapBinMsg());
+
+  EXPECT_NE(key, lanelet2_map_cache::create_key(map_path, createProjectorInfo(), 2.0));
+  auto projector_info = createProjectorInfo();
+  projector_info.mgrs_grid = "53SPU";
+  EXPECT_NE(key, lanelet2_map_cache::create_key(map_path, projector_info, 5.0));
+
+  std::ofstream(map_path) << "<osm><node/></osm>";
+  const auto new_key = lanelet2_map_cache::create_key(map_path, createProjectorInfo(), 5.0);
+  EXPECT_NE(key, new_key);
+  autoware_auto_mapping_msgs::msg::HADMapBin loaded;
+  EXPECT_FALSE(lanelet2_map_cache::load(cache_path, new_key, loaded));
+
+  EXPECT_TRUE(lanelet2_map_cache::create_key("/tmp/not_found.osm", projector_info, 5.0).empty());
+}
+
+TEST(Lanelet2MapCacheTest, InvalidCacheIsNotLoaded)
+{
+  std::ofstream(cache_path) << "LL2CACHE this is not a lanelet2 map cache";
+  autoware_auto_mapping_msgs::msg::HADMapBin loaded;
+  EXPECT_FALSE(lanelet2_map_cache::load(cache_path, "key", loaded));
+  EXPECT_FALSE(lanelet2_map_cache::load("/tmp/not_found.bin", "key", loaded));
+}
+
+int main(int argc, char ** argv)
+{
+  testing::InitGoogleTest(&argc, argv);
+  return RUN_ALL_TESTS();
+}
@@ -0,0 +1,69 @@
+// Copyright 2023 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "../src/pointcloud_map_loader/utils.hpp"
+
+#include <gmock/gmock.h>
+
+#include <map>
+#include <random>
+#include <string>
+#include <vector>
+
+TEST(PCDFileMetadataIndex, QueryMatchesLinearScan)
+{
+  // 20m x 20m grids of a map with holes, as the metadata of pointcloud_divider
+  std::mt19937 engine(0);
+  std::map<std::string, PCDFileMetadata> metadata_dict;
+  for (int x = -10; x < 30; ++x) {
+    for (int y = 5; y < 25; ++y) {
+      if (engine() % 4 == 0) continue;
+      PCDFileMetadata metadata;
+      metadata.min = pcl::PointXYZ(x * 20.0f, y * 20.0f, 0.0f);
+      metadata.max = pcl::PointXYZ(x * 20.0f + 20.0f, y * 20.0f + 20.0f, 0.0f);
+      metadata_dict["/map/" + std::to_string(x) + "_" + std::to_string(y) + ".pcd"] = metadata;
+    }
+  }
+  const PCDFileMetadataIndex index(metadata_dict);
+
+  std::uniform_real_distribution<double> position(-400.0, 800.0);
+  std::uniform_real_distribution<double> radius(0.0, 150.0);
+  for (int query = 0; query < 200; ++query) {
+    autoware_map_msgs::msg::AreaInfo area;
+    area.center_x = position(engine);
+    area.center_y = position(engine);
+    area.radius = query == 0 ? 10000.0 : radius(engine);
+
+    std::vector<std::string> expected;
+    for (const auto & [path, metadata] : metadata_dict) {
+      if (isGridWithinQueriedArea(area, metadata)) {
+        expected.push_back(path);
+      }
+    }
+    std::vector<std::string> result;
+    for (const auto & it : index.query(area)) {
+      result.push_back(it->first);
+    }
+    EXPECT_EQ(result, expected);
+  }
+}
+
+TEST(PCDFileMetadataIndex, EmptyMetadata)
+{
+  const std::map<std::string, PCDFileMetadata> metadata_dict;
+  const PCDFileMetadataIndex index(metadata_dict);
+  autoware_map_msgs::msg::AreaInfo area;
+  area.radius = 100.0;
+  EXPECT_TRUE(index.query(area).empty());
+}
@@ -0,0 +1,152 @@
+// Copyright 2023 The Autoware Contributors
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Converts a divided pointcloud map, the PCD files and their metadata of map_loader, into one
+// binary pointcloud map (.pcdbin) which map_loader maps into memory.
+
+#include <map_loader/binary_pointcloud_map.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <pcl/common/common.h>
+#include <pcl/io/pcd_io.h>
+#include <pcl/point_types.h>
+#include <pcl_conversions/pcl_conversions.h>
+#include <yaml-cpp/yaml.h>
+
+#include <algorithm>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+std::vector<std::string> getPcdPaths(const std::string & pcd_map_path)
+{
+  const auto is_pcd_file = [](const fs::path & p) {
+    return !fs::is_directory(p) && (p.extension() == ".pcd" || p.extension() == ".PCD");
+  };
+
+  std::vector<std::string> pcd_paths;
+  if (is_pcd_file(pcd_map_path)) {
+    pcd_paths.push_back(pcd_map_path);
+  } else if (fs::is_directory(pcd_map_path)) {
+    for (const auto & file : fs::directory_iterator(pcd_map_path)) {
+      if (is_pcd_file(file.path())) {
+        pcd_paths.push_back(file.path().string());
+      }
+    }
+  }
+  return pcd_paths;
+}
+
+// The same metadata as map_loader: the cell of a PCD file is [x, x + x_resolution] x [y, y +
+// y_resolution], and the cell of a single PCD file without metadata is the bounds of its points.
+bool loadCells(
+  const std::vector<std::string> & pcd_paths, const std::string & pcd_metadata_path,
+  std::vector<std::pair<BinaryPointCloudMapCell, std::string>> & cells)
+{
+  if (pcd_metadata_path.empty()) {
+    if (pcd_paths.size() != 1) {
+      std::cerr << "pcd_metadata_path is needed for multiple PCD files" << std::endl;
+      return false;
+    }
+    pcl::PointCloud<pcl::PointXYZ> single_pcd;
+    if (pcl::io::loadPCDFile(pcd_paths[0], single_pcd) == -1) {
+      std::cerr << "PCD load failed: " << pcd_paths[0] << std::endl;
+      return false;
+    }
+    pcl::PointXYZ min, max;
+    pcl::getMinMax3D(single_pcd, min, max);
+    BinaryPointCloudMapCell cell{};
+    cell.id = fs::path(pcd_paths[0]).filename().string();
+    cell.min_x = min.x;
+    cell.min_y = min.y;
+    cell.min_z = min.z;
+    cell.max_x = max.x;
+    cell.max_y = max.y;
+    cell.max_z = max.z;
+    cells.emplace_back(cell, pcd_paths[0]);
+    return true;
+  }
+
+  const YAML::Node config = YAML::LoadFile(pcd_metadata_path);
+  const float x_resolution = config["x_resolution"].as<float>();
+  const float y_resolution = config["y_resolution"].as<float>();
+  for (const auto & path : pcd_paths) {
+    const std::string filename = fs::path(path).filename().string();
+    if (!config[filename]) {
+      std::cerr << "No metadata of " << filename << ", skipped" << std::endl;
+      continue;
+    }
+    const std::vector<int> values = config[filename].as<std::vector<int>>();
+    BinaryPointCloudMapCell cell{};
+    cell.id = filename;
+    cell.min_x = values[0];
+    cell.min_y = values[1];
+    cell.max_x = values[0] + x_resolution;
+    cell.max_y = values[1] + y_resolution;
+    cells.emplace_back(cell, path);
+  }
+  return true;
+}
+
+int main(int argc, char * argv[])
+{
+  rclcpp::init(argc, argv);
+
+  auto node = rclcpp::Node::make_shared("convert_to_binary_map");
+
+  const auto pcd_map_path = node->declare_parameter<std::string>("pcd_map_path");
+  const auto pcd_metadata_path = node->declare_parameter<std::string>("pcd_metadata_path", "");
+  const auto output_path = node->declare_parameter<std::string>("output_path");
+
+  std::vector<std::pair<BinaryPointCloudMapCell, std::string>> cells;
+  if (!loadCells(getPcdPaths(pcd_map_path), pcd_metadata_path, cells) || cells.empty()) {
+    std::cerr << "No PCD to convert: " << pcd_map_path << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // the points of the cells of a row are next to each other in the file
+  std::sort(cells.begin(), cells.end(), [](const auto & lhs, const auto & rhs) {
+    return std::make_pair(lhs.first.min_y, lhs.first.min_x) <
+           std::make_pair(rhs.first.min_y, rhs.first.min_x);
+  });
+
+  try {
+    BinaryPointCloudMapWriter writer(output_path);
+    sensor_msgs::msg::PointCloud2 pcd;
+    for (size_t i = 0; i < cells.size(); ++i) {
+      const auto & [cell, path] = cells[i];
+      if (pcl::io::loadPCDFile(path, pcd) == -1) {
+        std::cerr << "PCD load failed: " << path << std::endl;
+        return EXIT_FAILURE;
+      }
+      writer.addCell(cell, pcd);
+      std::cout << "Converted " << path << " (" << i + 1 << " out of " << cells.size() << ")"
+                << std::endl;
+    }
+    writer.close();
+  } catch (std::runtime_error & e) {
+    std::cerr << e.what() << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << "Saved " << output_path << std::endl;
+
+  rclcpp::shutdown();
+
+  return 0;
+}
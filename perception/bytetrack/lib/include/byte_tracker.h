@@ -97,4 +97,10 @@ private:
   std::vector<STrack> lost_stracks;
   std::vector<STrack> removed_stracks;
   byte_kalman::KalmanFilter kalman_filter;
+
+  // workspace of lapjv, reused between the assignments
+  std::vector<double> lapjv_cost;
+  std::vector<double *> lapjv_cost_rows;
+  std::vector<int> lapjv_x;
+  std::vector<int> lapjv_y;
 };
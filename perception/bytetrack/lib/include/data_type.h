@@ -56,6 +56,9 @@ typedef Eigen::Matrix<float, 1, 8, Eigen::RowMajor> KAL_MEAN;
 typedef Eigen::Matrix<float, 8, 8, Eigen::RowMajor> KAL_COVA;
 typedef Eigen::Matrix<float, 1, 4, Eigen::RowMajor> KAL_HMEAN;
 typedef Eigen::Matrix<float, 4, 4, Eigen::RowMajor> KAL_HCOVA;
+// the means and the row major covariances of several tracks, one track per row
+typedef Eigen::Matrix<float, -1, 8, Eigen::RowMajor> KAL_MEANS;
+typedef Eigen::Matrix<float, -1, 64, Eigen::RowMajor> KAL_COVAS;
 using KAL_DATA = std::pair<KAL_MEAN, KAL_COVA>;
 using KAL_HDATA = std::pair<KAL_HMEAN, KAL_HCOVA>;
 
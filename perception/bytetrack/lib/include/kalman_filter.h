@@ -50,6 +50,8 @@ public:
   KalmanFilter();
   KAL_DATA initiate(const DETECTBOX & measurement);
   void predict(KAL_MEAN & mean, KAL_COVA & covariance);
+  // the same as predict for each row of means and covariances
+  void multi_predict(KAL_MEANS & means, KAL_COVAS & covariances);
   KAL_HDATA project(const KAL_MEAN & mean, const KAL_COVA & covariance);
   KAL_DATA update(
     const KAL_MEAN & mean, const KAL_COVA & covariance, const DETECTBOX & measurement);
@@ -59,8 +61,6 @@ public:
     bool only_position = false);
 
 private:
-  Eigen::Matrix<float, 8, 8, Eigen::RowMajor> _motion_mat;
-  Eigen::Matrix<float, 4, 8, Eigen::RowMajor> _update_mat;
   float _std_weight_position;
   float _std_weight_velocity;
 };
@@ -46,15 +46,6 @@ const double KalmanFilter::chi2inv95[10] = {0,      3.8415, 5.9915, 7.8147, 9.48
                                             11.070, 12.592, 14.067, 15.507, 16.919};
 KalmanFilter::KalmanFilter()
 {
-  int ndim = 4;
-  double dt = 1.;
-
-  _motion_mat = Eigen::MatrixXf::Identity(8, 8);
-  for (int i = 0; i < ndim; i++) {
-    _motion_mat(i, ndim + i) = dt;
-  }
-  _update_mat = Eigen::MatrixXf::Identity(4, 8);
-
   this->_std_weight_position = 1. / 20;
   this->_std_weight_velocity = 1. / 160;
 }
@@ -101,13 +92,32 @@ void KalmanFilter::predict(KAL_MEAN & mean, KAL_COVA & covariance)
   tmp.block<1, 4>(0, 0) = std_pos;
   tmp.block<1, 4>(0, 4) = std_vel;
   tmp = tmp.array().square();
-  KAL_COVA motion_cov = tmp.asDiagonal();
-  KAL_MEAN mean1 = this->_motion_mat * mean.transpose();
-  KAL_COVA covariance1 = this->_motion_mat * covariance * (_motion_mat.transpose());
-  covariance1 += motion_cov;
 
-  mean = mean1;
-  covariance = covariance1;
+  // the motion model adds the velocities to the positions with a time step of 1, so its products
+  // are sums of blocks
+  mean.leftCols<4>() += mean.rightCols<4>();
+  covariance.topRows<4>() += covariance.bottomRows<4>();
+  covariance.leftCols<4>() += covariance.rightCols<4>();
+  covariance.diagonal() += tmp.transpose();
+}
+
+void KalmanFilter::multi_predict(KAL_MEANS & means, KAL_COVAS & covariances)
+{
+  const Eigen::Array<float, -1, 1> std_pos = _std_weight_position * means.col(3).array();
+  const Eigen::Array<float, -1, 1> std_vel = _std_weight_velocity * means.col(3).array();
+  KAL_MEANS motion_var(means.rows(), 8);
+  motion_var.col(0) = motion_var.col(1) = motion_var.col(3) = std_pos.square().matrix();
+  motion_var.col(4) = motion_var.col(5) = motion_var.col(7) = std_vel.square().matrix();
+  motion_var.col(2).setConstant(1e-2f * 1e-2f);
+  motion_var.col(6).setConstant(1e-5f * 1e-5f);
+
+  means.leftCols<4>() += means.rightCols<4>();
+  for (Eigen::Index i = 0; i < covariances.rows(); i++) {
+    Eigen::Map<KAL_COVA> covariance(covariances.row(i).data());
+    covariance.topRows<4>() += covariance.bottomRows<4>();
+    covariance.leftCols<4>() += covariance.rightCols<4>();
+    covariance.diagonal() += motion_var.row(i).transpose();
+  }
 }
 
 KAL_HDATA KalmanFilter::project(const KAL_MEAN & mean, const KAL_COVA & covariance)
@@ -115,8 +125,9 @@ KAL_HDATA KalmanFilter::project(const KAL_MEAN & mean, const KAL_COVA & covarian
   DETECTBOX std;
   std << _std_weight_position * mean(3), _std_weight_position * mean(3), 1e-1,
     _std_weight_position * mean(3);
-  KAL_HMEAN mean1 = _update_mat * mean.transpose();
-  KAL_HCOVA covariance1 = _update_mat * covariance * (_update_mat.transpose());
+  // the measurement is the position part of the state
+  KAL_HMEAN mean1 = mean.leftCols<4>();
+  KAL_HCOVA covariance1 = covariance.topLeftCorner<4, 4>();
   Eigen::Matrix<float, 4, 4> diag = std.asDiagonal();
   diag = diag.array().square().matrix();
   covariance1 += diag;
@@ -138,7 +149,7 @@ KalmanFilter::update(
   // scipy.linalg.cho_solve((cho_factor, lower),
   // np.dot(covariance, self._upadte_mat.T).T,
   // check_finite=False).T
-  Eigen::Matrix<float, 4, 8> B = (covariance * (_update_mat.transpose())).transpose();
+  Eigen::Matrix<float, 4, 8> B = covariance.leftCols<4>().transpose();
   Eigen::Matrix<float, 8, 4> kalman_gain = (projected_cov.llt().solve(B)).transpose();  // eg.8x4
   Eigen::Matrix<float, 1, 4> innovation = measurement - projected_mean;                 // eg.1x4
   auto tmp = innovation * (kalman_gain.transpose());
@@ -225,11 +225,24 @@ int STrack::end_frame()
 void STrack::multi_predict(
   std::vector<STrack *> & stracks, byte_kalman::KalmanFilter & kalman_filter)
 {
+  // predict all the tracks at once, with the covariances in row major order
+  KAL_MEANS means(stracks.size(), 8);
+  KAL_COVAS covariances(stracks.size(), 64);
   for (size_t i = 0; i < stracks.size(); i++) {
     if (stracks[i]->state != TrackState::Tracked) {
       stracks[i]->mean[7] = 0;
     }
-    kalman_filter.predict(stracks[i]->mean, stracks[i]->covariance);
+    means.row(i) = stracks[i]->mean;
+    covariances.row(i) = Eigen::Map<const Eigen::Matrix<float, 1, 64>>(
+      stracks[i]->covariance.data());
+  }
+
+  kalman_filter.multi_predict(means, covariances);
+
+  for (size_t i = 0; i < stracks.size(); i++) {
+    stracks[i]->mean = means.row(i);
+    Eigen::Map<Eigen::Matrix<float, 1, 64>>(stracks[i]->covariance.data()) =
+      covariances.row(i);
     stracks[i]->static_tlwh();
     stracks[i]->static_tlbr();
   }
@@ -274,11 +274,6 @@ double ByteTracker::lapjv(
   const std::vector<std::vector<float>> & cost, std::vector<int> & rowsol,
   std::vector<int> & colsol, bool extend_cost, float cost_limit, bool return_cost)
 {
-  std::vector<std::vector<float>> cost_c;
-  cost_c.assign(cost.begin(), cost.end());
-
-  std::vector<std::vector<float>> cost_c_extended;
-
   int n_rows = cost.size();
   int n_cols = cost[0].size();
   rowsol.resize(n_rows);
@@ -295,58 +290,49 @@ double ByteTracker::lapjv(
     }
   }
 
+  float extended_cost = 0;
   if (extend_cost || cost_limit < LONG_MAX) {
     n = n_rows + n_cols;
-    cost_c_extended.resize(n);
-    for (size_t i = 0; i < cost_c_extended.size(); i++) cost_c_extended[i].resize(n);
-
     if (cost_limit < LONG_MAX) {
-      for (size_t i = 0; i < cost_c_extended.size(); i++) {
-        for (size_t j = 0; j < cost_c_extended[i].size(); j++) {
-          cost_c_extended[i][j] = cost_limit / 2.0;
-        }
-      }
+      extended_cost = cost_limit / 2.0;
     } else {
       float cost_max = -1;
-      for (size_t i = 0; i < cost_c.size(); i++) {
-        for (size_t j = 0; j < cost_c[i].size(); j++) {
-          if (cost_c[i][j] > cost_max) cost_max = cost_c[i][j];
-        }
-      }
-      for (size_t i = 0; i < cost_c_extended.size(); i++) {
-        for (size_t j = 0; j < cost_c_extended[i].size(); j++) {
-          cost_c_extended[i][j] = cost_max + 1;
+      for (size_t i = 0; i < cost.size(); i++) {
+        for (size_t j = 0; j < cost[i].size(); j++) {
+          if (cost[i][j] > cost_max) cost_max = cost[i][j];
         }
       }
+      extended_cost = cost_max + 1;
     }
-
-    for (size_t i = n_rows; i < cost_c_extended.size(); i++) {
-      for (size_t j = n_cols; j < cost_c_extended[i].size(); j++) {
-        cost_c_extended[i][j] = 0;
-      }
-    }
-    for (int i = 0; i < n_rows; i++) {
-      for (int j = 0; j < n_cols; j++) {
-        cost_c_extended[i][j] = cost_c[i][j];
-      }
-    }
-
-    cost_c.clear();
-    cost_c.assign(cost_c_extended.begin(), cost_c_extended.end());
   }
 
-  double ** cost_ptr;
-  cost_ptr = new double *[sizeof(double *) * n];
-  for (int i = 0; i < n; i++) cost_ptr[i] = new double[sizeof(double) * n];
+  // the workspace only grows, so it is allocated at most once per new maximum number of tracks
+  // and detections
+  lapjv_cost.resize(n * n);
+  lapjv_cost_rows.resize(n);
+  lapjv_x.resize(n);
+  lapjv_y.resize(n);
+  for (int i = 0; i < n; i++) {
+    lapjv_cost_rows[i] = lapjv_cost.data() + i * n;
+  }
+  double ** cost_ptr = lapjv_cost_rows.data();
 
+  // the extension pairs the rows and the columns with dummy ones of extended_cost, and the dummy
+  // rows with the dummy columns for free
   for (int i = 0; i < n; i++) {
     for (int j = 0; j < n; j++) {
-      cost_ptr[i][j] = cost_c[i][j];
+      if (i < n_rows && j < n_cols) {
+        cost_ptr[i][j] = cost[i][j];
+      } else if (i < n_rows || j < n_cols) {
+        cost_ptr[i][j] = extended_cost;
+      } else {
+        cost_ptr[i][j] = 0;
+      }
     }
   }
 
-  int * x_c = new int[sizeof(int) * n];
-  int * y_c = new int[sizeof(int) * n];
+  int * x_c = lapjv_x.data();
+  int * y_c = lapjv_y.data();
 
   int ret = lapjv_internal(n, cost_ptr, x_c, y_c);
   if (ret != 0) {
@@ -382,13 +368,6 @@ double ByteTracker::lapjv(
     }
   }
 
-  for (int i = 0; i < n; i++) {
-    delete[] cost_ptr[i];
-  }
-  delete[] cost_ptr;
-  delete[] x_c;
-  delete[] y_c;
-
   return opt;
 }
 
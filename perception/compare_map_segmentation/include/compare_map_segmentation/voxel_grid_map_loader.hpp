@@ -15,6 +15,8 @@
 #ifndef COMPARE_MAP_SEGMENTATION__VOXEL_GRID_MAP_LOADER_HPP_
 #define COMPARE_MAP_SEGMENTATION__VOXEL_GRID_MAP_LOADER_HPP_
 
+#include "compare_map_segmentation/voxel_hash_map.hpp"
+
 #include <rclcpp/rclcpp.hpp>
 
 #include <autoware_map_msgs/srv/get_differential_point_cloud_map.hpp>
@@ -26,6 +28,8 @@
 #include <pcl/search/pcl_search.h>
 #include <pcl_conversions/pcl_conversions.h>
 
+#include <atomic>
+#include <condition_variable>
 #include <map>
 #include <memory>
 #include <string>
@@ -100,6 +104,10 @@ protected:
   rclcpp::Publisher<sensor_msgs::msg::PointCloud2>::SharedPtr downsampled_map_pub_;
   bool debug_ = false;
 
+  /** \brief Answer the queries with a hash of the voxels of all the loaded map cells */
+  bool use_voxel_hash_map_ = false;
+  compare_map_segmentation::VoxelHashMap voxel_hash_map_;
+
 public:
   typedef VoxelGridEx<pcl::PointXYZ> VoxelGridPointXYZ;
   typedef typename pcl::Filter<pcl::PointXYZ>::PointCloud PointCloud;
@@ -107,8 +115,12 @@ public:
   explicit VoxelGridMapLoader(
     rclcpp::Node * node, double leaf_size, double downsize_ratio_z_axis,
     std::string * tf_map_input_frame, std::mutex * mutex);
+  virtual ~VoxelGridMapLoader() = default;
 
   virtual bool is_close_to_map(const pcl::PointXYZ & point, const double distance_threshold) = 0;
+  /** \brief Copy the points of `input` which are not close to the map to `output` */
+  virtual void filter_points(
+    const PointCloud & input, const double distance_threshold, PointCloud & output);
   bool is_close_to_neighbor_voxels(
     const pcl::PointXYZ & point, const double distance_threshold, VoxelGridPointXYZ & voxel,
     pcl::search::Search<pcl::PointXYZ>::Ptr tree) const;
@@ -119,6 +131,11 @@ public:
     const pcl::PointXYZ & src_point, const pcl::PointXYZ & target_point,
     const double distance_threshold, const PointCloudPtr & map, VoxelGridPointXYZ & voxel) const;
 
+  /** \brief Add the occupied voxels of a map cell to `voxel_hash_map` */
+  void insert_voxels(
+    const VoxelGridPointXYZ & voxel, const PointCloudPtr & map, const int cell,
+    compare_map_segmentation::VoxelHashMap & voxel_hash_map) const;
+
   void publish_downsampled_map(const pcl::PointCloud<pcl::PointXYZ> & downsampled_pc);
   bool is_close_points(
     const pcl::PointXYZ point, const pcl::PointXYZ target_point,
@@ -136,9 +153,11 @@ protected:
 public:
   explicit VoxelGridStaticMapLoader(
     rclcpp::Node * node, double leaf_size, double downsize_ratio_z_axis,
-    std::string * tf_map_input_frame, std::mutex * mutex);
+    std::string * tf_map_input_frame, std::mutex * mutex, bool use_voxel_hash_map = false);
   virtual void onMapCallback(const sensor_msgs::msg::PointCloud2::ConstSharedPtr map);
   virtual bool is_close_to_map(const pcl::PointXYZ & point, const double distance_threshold);
+  void filter_points(
+    const PointCloud & input, const double distance_threshold, PointCloud & output) override;
 };
 
 class VoxelGridDynamicMapLoader : public VoxelGridMapLoader
@@ -189,17 +208,39 @@ protected:
   /** \brief y-coordinate of map grid which should belong to array[0][0] */
   float origin_y_;
 
+  /** \brief Request and voxelize the map cells on map_update_thread_, not in timer_callback() */
+  bool use_background_map_loading_ = false;
+  std::thread map_update_thread_;
+  std::mutex map_update_mutex_;
+  std::condition_variable map_update_cv_;
+  /** \brief Latest position to update the map at, older requests not started yet are dropped */
+  std::optional<geometry_msgs::msg::Point> pending_update_position_ = std::nullopt;
+  std::atomic<bool> stop_map_update_thread_{false};
+
+  void map_update_thread_loop();
+  void update_map(const geometry_msgs::msg::Point & position);
+
 public:
   explicit VoxelGridDynamicMapLoader(
     rclcpp::Node * node, double leaf_size, double downsize_ratio_z_axis,
     std::string * tf_map_input_frame, std::mutex * mutex,
-    rclcpp::CallbackGroup::SharedPtr main_callback_group);
+    rclcpp::CallbackGroup::SharedPtr main_callback_group, bool use_voxel_hash_map = false);
+  ~VoxelGridDynamicMapLoader() override;
   void onEstimatedPoseCallback(nav_msgs::msg::Odometry::ConstSharedPtr pose);
 
   void timer_callback();
   bool should_update_map() const;
   void request_update_map(const geometry_msgs::msg::Point & position);
   virtual bool is_close_to_map(const pcl::PointXYZ & point, const double distance_threshold);
+  void filter_points(
+    const PointCloud & input, const double distance_threshold, PointCloud & output) override;
+  /** \brief Index of the map grid of `point` in current_voxel_grid_array_ */
+  inline int map_grid_index(const pcl::PointXYZ & point) const
+  {
+    return static_cast<int>(
+      std::floor((point.x - origin_x_) / map_grid_size_x_) +
+      map_grids_x_ * std::floor((point.y - origin_y_) / map_grid_size_y_));
+  }
   /** \brief Check if point close to map pointcloud in the */
   bool is_close_to_next_map_grid(
     const pcl::PointXYZ & point, const int current_map_grid_index, const double distance_threshold);
@@ -237,45 +278,88 @@ public:
   /** Update loaded map grid array for fast searching*/
   virtual inline void updateVoxelGridArray()
   {
-    origin_x_ = std::floor((current_position_.value().x - map_loader_radius_) / map_grid_size_x_) *
-                  map_grid_size_x_ +
-                origin_x_remainder_;
-    origin_y_ = std::floor((current_position_.value().y - map_loader_radius_) / map_grid_size_y_) *
-                  map_grid_size_y_ +
-                origin_y_remainder_;
-
-    map_grids_x_ = static_cast<int>(
-      std::ceil((current_position_.value().x + map_loader_radius_ - origin_x_) / map_grid_size_x_));
-    map_grids_y_ = static_cast<int>(
-      std::ceil((current_position_.value().y + map_loader_radius_ - origin_y_) / map_grid_size_y_));
-
-    if (map_grids_x_ * map_grids_y_ == 0) {
+    // The new array is built aside, so that the lock is only held to swap it with the current one
+    const float origin_x =
+      std::floor((current_position_.value().x - map_loader_radius_) / map_grid_size_x_) *
+        map_grid_size_x_ +
+      origin_x_remainder_;
+    const float origin_y =
+      std::floor((current_position_.value().y - map_loader_radius_) / map_grid_size_y_) *
+        map_grid_size_y_ +
+      origin_y_remainder_;
+
+    const int map_grids_x = static_cast<int>(
+      std::ceil((current_position_.value().x + map_loader_radius_ - origin_x) / map_grid_size_x_));
+    const int map_grids_y = static_cast<int>(
+      std::ceil((current_position_.value().y + map_loader_radius_ - origin_y) / map_grid_size_y_));
+
+    if (map_grids_x * map_grids_y == 0) {
       return;
     }
 
-    (*mutex_ptr_).lock();
-    current_voxel_grid_array_.assign(
-      map_grids_x_ * map_grid_size_y_, std::make_shared<MapGridVoxelInfo>());
+    // The dictionary is only modified by this thread, so it is read without the lock
+    std::vector<std::shared_ptr<MapGridVoxelInfo>> voxel_grid_array(
+      map_grids_x * map_grid_size_y_, std::make_shared<MapGridVoxelInfo>());
     for (const auto & kv : current_voxel_grid_dict_) {
-      int index = static_cast<int>(
-        std::floor((kv.second.min_b_x - origin_x_) / map_grid_size_x_) +
-        map_grids_x_ * std::floor((kv.second.min_b_y - origin_y_) / map_grid_size_y_));
+      int index = map_grid_array_index(kv.second, origin_x, origin_y, map_grids_x);
       // TODO(1222-takeshi): check if index is valid
-      if (index >= map_grids_x_ * map_grids_y_ || index < 0) {
+      if (index >= map_grids_x * map_grids_y || index < 0) {
         continue;
       }
-      current_voxel_grid_array_.at(index) = std::make_shared<MapGridVoxelInfo>(kv.second);
+      voxel_grid_array.at(index) = std::make_shared<MapGridVoxelInfo>(kv.second);
     }
+    compare_map_segmentation::VoxelHashMap voxel_hash_map;
+    if (use_voxel_hash_map_) {
+      voxel_hash_map = buildVoxelHashMap(voxel_grid_array);
+    }
+
+    (*mutex_ptr_).lock();
+    origin_x_ = origin_x;
+    origin_y_ = origin_y;
+    map_grids_x_ = map_grids_x;
+    map_grids_y_ = map_grids_y;
+    std::swap(current_voxel_grid_array_, voxel_grid_array);
+    std::swap(voxel_hash_map_, voxel_hash_map);
     (*mutex_ptr_).unlock();
+    // the previous array and hash are released here, out of the lock
+  }
+
+  inline int map_grid_array_index(
+    const MapGridVoxelInfo & map_grid, const float origin_x, const float origin_y,
+    const int map_grids_x) const
+  {
+    return static_cast<int>(
+      std::floor((map_grid.min_b_x - origin_x) / map_grid_size_x_) +
+      map_grids_x * std::floor((map_grid.min_b_y - origin_y) / map_grid_size_y_));
+  }
+
+  /** Hash of the voxels of the map grids in `voxel_grid_array`, the index being the cell */
+  inline compare_map_segmentation::VoxelHashMap buildVoxelHashMap(
+    const std::vector<std::shared_ptr<MapGridVoxelInfo>> & voxel_grid_array) const
+  {
+    compare_map_segmentation::VoxelHashMap voxel_hash_map(
+      voxel_leaf_size_, voxel_leaf_size_z_, downsize_ratio_z_axis_);
+    std::size_t num_voxels = 0;
+    for (const auto & map_grid : voxel_grid_array) {
+      num_voxels += map_grid->map_cell_pc_ptr ? map_grid->map_cell_pc_ptr->size() : 0;
+    }
+    voxel_hash_map.clear(num_voxels);
+    for (std::size_t index = 0; index < voxel_grid_array.size(); ++index) {
+      const auto & map_grid = voxel_grid_array.at(index);
+      insert_voxels(
+        map_grid->map_cell_voxel_grid, map_grid->map_cell_pc_ptr, static_cast<int>(index),
+        voxel_hash_map);
+    }
+    return voxel_hash_map;
   }
 
   inline void removeMapCell(const std::string map_cell_id_to_remove)
   {
     (*mutex_ptr_).lock();
-    current_voxel_grid_dict_.erase(map_cell_id_to_remove);
+    auto removed_map_cell = current_voxel_grid_dict_.extract(map_cell_id_to_remove);
     (*mutex_ptr_).unlock();
+    // the voxel grid of the cell is released here, out of the lock
   }
-
   virtual inline void addMapCellAndFilter(
     const autoware_map_msgs::msg::PointCloudMapCellWithID & map_cell_to_add)
   {
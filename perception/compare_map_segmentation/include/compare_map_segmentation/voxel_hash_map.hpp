@@ -0,0 +1,92 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef COMPARE_MAP_SEGMENTATION__VOXEL_HASH_MAP_HPP_
+#define COMPARE_MAP_SEGMENTATION__VOXEL_HASH_MAP_HPP_
+
+#include <pcl/point_types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace compare_map_segmentation
+{
+/**
+ * Flat open-addressing hash of the map voxel centroids, over all the loaded map cells.
+ * The voxels are keyed by the grid coordinates of pcl::VoxelGrid, and each entry also keeps the
+ * map cell it belongs to, so that a query only matches the voxels of its own cell, as the per cell
+ * pcl::VoxelGrid lookup does.
+ */
+class VoxelHashMap
+{
+public:
+  VoxelHashMap();
+  VoxelHashMap(double leaf_size, double leaf_size_z, double downsize_ratio_z_axis);
+
+  /** \brief Remove all the voxels, and reserve room for `num_voxels` of them. */
+  void clear(std::size_t num_voxels = 0);
+
+  /** \brief Add the centroid of the voxel at grid coordinates (i, j, k) of `cell`. */
+  void insert(int i, int j, int k, int cell, const pcl::PointXYZ & centroid);
+
+  std::size_t size() const { return size_; }
+
+  /**
+   * Same check as VoxelGridMapLoader::is_close_to_neighbor_voxels(): a centroid of the 27 voxels
+   * around `point` in `cell` is closer than the threshold.
+   */
+  bool is_close(const pcl::PointXYZ & point, int cell, double distance_threshold) const;
+
+  /**
+   * Batched is_close(), for `num_points` points and their cells.
+   * \param[out] is_close_flags 1 for the points which are close to the map, 0 otherwise
+   */
+  void filter_points(
+    const pcl::PointXYZ * points, const int * cells, std::size_t num_points,
+    double distance_threshold, std::vector<std::uint8_t> & is_close_flags) const;
+
+private:
+  static constexpr std::size_t NUM_NEIGHBORS = 27;
+  // The centroids of the voxels around a point, whose distances are checked together
+  struct Candidates
+  {
+    std::size_t size{0};
+    double x[NUM_NEIGHBORS];
+    double y[NUM_NEIGHBORS];
+    double z[NUM_NEIGHBORS];
+  };
+
+  std::uint64_t key(float x, float y, float z) const;
+  void rehash(std::size_t capacity);
+  void collect(std::uint64_t key, int cell, Candidates & candidates) const;
+  bool is_close(
+    const pcl::PointXYZ & point, int cell, double distance_threshold,
+    Candidates & candidates) const;
+
+  float inverse_leaf_size_[3]{1.0f, 1.0f, 1.0f};
+  double downsize_ratio_z_axis_{1.0};
+
+  std::size_t size_{0};
+  std::size_t mask_{0};
+  std::vector<std::uint64_t> keys_;
+  std::vector<std::int32_t> cells_;
+  std::vector<float> x_;
+  std::vector<float> y_;
+  std::vector<float> z_;
+};
+
+}  // namespace compare_map_segmentation
+
+#endif  // COMPARE_MAP_SEGMENTATION__VOXEL_HASH_MAP_HPP_
@@ -42,6 +42,7 @@ VoxelBasedCompareMapFilterComponent::VoxelBasedCompareMapFilterComponent(
   distance_threshold_ = declare_parameter<double>("distance_threshold");
   bool use_dynamic_map_loading = declare_parameter<bool>("use_dynamic_map_loading");
   double downsize_ratio_z_axis = declare_parameter<double>("downsize_ratio_z_axis");
+  const bool use_voxel_hash_map = declare_parameter<bool>("use_voxel_hash_map", false);
   if (downsize_ratio_z_axis <= 0.0) {
     RCLCPP_ERROR(this->get_logger(), "downsize_ratio_z_axis should be positive");
     return;
@@ -52,10 +53,11 @@ VoxelBasedCompareMapFilterComponent::VoxelBasedCompareMapFilterComponent(
     main_callback_group = this->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
     voxel_grid_map_loader_ = std::make_unique<VoxelGridDynamicMapLoader>(
       this, distance_threshold_, downsize_ratio_z_axis, &tf_input_frame_, &mutex_,
-      main_callback_group);
+      main_callback_group, use_voxel_hash_map);
   } else {
     voxel_grid_map_loader_ = std::make_unique<VoxelGridStaticMapLoader>(
-      this, distance_threshold_, downsize_ratio_z_axis, &tf_input_frame_, &mutex_);
+      this, distance_threshold_, downsize_ratio_z_axis, &tf_input_frame_, &mutex_,
+      use_voxel_hash_map);
   }
   tf_input_frame_ = *(voxel_grid_map_loader_->tf_map_input_frame_);
   RCLCPP_INFO(this->get_logger(), "tf_map_input_frame: %s", tf_input_frame_.c_str());
@@ -70,14 +72,7 @@ void VoxelBasedCompareMapFilterComponent::filter(
   pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_input(new pcl::PointCloud<pcl::PointXYZ>);
   pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_output(new pcl::PointCloud<pcl::PointXYZ>);
   pcl::fromROSMsg(*input, *pcl_input);
-  pcl_output->points.reserve(pcl_input->points.size());
-  for (size_t i = 0; i < pcl_input->points.size(); ++i) {
-    const pcl::PointXYZ point = pcl_input->points.at(i);
-    if (voxel_grid_map_loader_->is_close_to_map(point, distance_threshold_)) {
-      continue;
-    }
-    pcl_output->points.push_back(point);
-  }
+  voxel_grid_map_loader_->filter_points(*pcl_input, distance_threshold_, *pcl_output);
   pcl::toROSMsg(*pcl_output, output);
   output.header = input->header;
 
@@ -39,6 +39,41 @@ bool VoxelGridMapLoader::is_close_points(
   return false;
 }
 
+void VoxelGridMapLoader::filter_points(
+  const PointCloud & input, const double distance_threshold, PointCloud & output)
+{
+  output.points.reserve(input.points.size());
+  for (const auto & point : input.points) {
+    if (is_close_to_map(point, distance_threshold)) {
+      continue;
+    }
+    output.points.push_back(point);
+  }
+}
+
+void VoxelGridMapLoader::insert_voxels(
+  const VoxelGridPointXYZ & voxel, const PointCloudPtr & map, const int cell,
+  compare_map_segmentation::VoxelHashMap & voxel_hash_map) const
+{
+  if (map == NULL) {
+    return;
+  }
+  // The leaf layout is the dense grid of the voxels between min_b and max_b, -1 for empty voxels
+  const Eigen::Vector4i min_b = voxel.get_min_b();
+  const Eigen::Vector4i div_b = voxel.get_div_b();
+  const std::size_t slice_size = static_cast<std::size_t>(div_b[0]) * div_b[1];
+  for (std::size_t idx = 0; idx < voxel.leaf_layout_.size(); ++idx) {
+    const int voxel_index = voxel.leaf_layout_[idx];
+    if (voxel_index == -1) {
+      continue;
+    }
+    const int i = static_cast<int>(idx % div_b[0]) + min_b[0];
+    const int j = static_cast<int>((idx / div_b[0]) % div_b[1]) + min_b[1];
+    const int k = static_cast<int>(idx / slice_size) + min_b[2];
+    voxel_hash_map.insert(i, j, k, cell, map->points.at(voxel_index));
+  }
+}
+
 void VoxelGridMapLoader::publish_downsampled_map(
   const pcl::PointCloud<pcl::PointXYZ> & downsampled_pc)
 {
@@ -251,10 +286,13 @@ bool VoxelGridMapLoader::is_in_voxel(
 
 VoxelGridStaticMapLoader::VoxelGridStaticMapLoader(
   rclcpp::Node * node, double leaf_size, double downsize_ratio_z_axis,
-  std::string * tf_map_input_frame, std::mutex * mutex)
+  std::string * tf_map_input_frame, std::mutex * mutex, bool use_voxel_hash_map)
 : VoxelGridMapLoader(node, leaf_size, downsize_ratio_z_axis, tf_map_input_frame, mutex)
 {
   voxel_leaf_size_z_ = voxel_leaf_size_ * downsize_ratio_z_axis_;
+  use_voxel_hash_map_ = use_voxel_hash_map;
+  voxel_hash_map_ = compare_map_segmentation::VoxelHashMap(
+    voxel_leaf_size_, voxel_leaf_size_z_, downsize_ratio_z_axis_);
   sub_map_ = node->create_subscription<sensor_msgs::msg::PointCloud2>(
     "map", rclcpp::QoS{1}.transient_local(),
     std::bind(&VoxelGridStaticMapLoader::onMapCallback, this, std::placeholders::_1));
@@ -274,6 +312,10 @@ void VoxelGridStaticMapLoader::onMapCallback(
   voxel_grid_.setInputCloud(map_pcl_ptr);
   voxel_grid_.setSaveLeafLayout(true);
   voxel_grid_.filter(*voxel_map_ptr_);
+  if (use_voxel_hash_map_) {
+    voxel_hash_map_.clear(voxel_map_ptr_->size());
+    insert_voxels(voxel_grid_, voxel_map_ptr_, 0, voxel_hash_map_);
+  }
   (*mutex_ptr_).unlock();
 
   if (debug_) {
@@ -283,22 +325,48 @@ void VoxelGridStaticMapLoader::onMapCallback(
 bool VoxelGridStaticMapLoader::is_close_to_map(
   const pcl::PointXYZ & point, const double distance_threshold)
 {
+  if (use_voxel_hash_map_) {
+    return voxel_hash_map_.is_close(point, 0, distance_threshold);
+  }
   if (is_close_to_neighbor_voxels(point, distance_threshold, voxel_map_ptr_, voxel_grid_)) {
     return true;
   }
   return false;
 }
 
+void VoxelGridStaticMapLoader::filter_points(
+  const PointCloud & input, const double distance_threshold, PointCloud & output)
+{
+  if (!use_voxel_hash_map_) {
+    VoxelGridMapLoader::filter_points(input, distance_threshold, output);
+    return;
+  }
+  const std::vector<int> cells(input.points.size(), 0);
+  std::vector<std::uint8_t> is_close_flags;
+  voxel_hash_map_.filter_points(
+    input.points.data(), cells.data(), input.points.size(), distance_threshold, is_close_flags);
+  output.points.reserve(input.points.size());
+  for (std::size_t i = 0; i < input.points.size(); ++i) {
+    if (!is_close_flags[i]) {
+      output.points.push_back(input.points[i]);
+    }
+  }
+}
+
 VoxelGridDynamicMapLoader::VoxelGridDynamicMapLoader(
   rclcpp::Node * node, double leaf_size, double downsize_ratio_z_axis,
   std::string * tf_map_input_frame, std::mutex * mutex,
-  rclcpp::CallbackGroup::SharedPtr main_callback_group)
+  rclcpp::CallbackGroup::SharedPtr main_callback_group, bool use_voxel_hash_map)
 : VoxelGridMapLoader(node, leaf_size, downsize_ratio_z_axis, tf_map_input_frame, mutex)
 {
   voxel_leaf_size_z_ = voxel_leaf_size_ * downsize_ratio_z_axis_;
+  use_voxel_hash_map_ = use_voxel_hash_map;
+  voxel_hash_map_ = compare_map_segmentation::VoxelHashMap(
+    voxel_leaf_size_, voxel_leaf_size_z_, downsize_ratio_z_axis_);
   auto timer_interval_ms = node->declare_parameter<int>("timer_interval_ms");
   map_update_distance_threshold_ = node->declare_parameter<double>("map_update_distance_threshold");
   map_loader_radius_ = node->declare_parameter<double>("map_loader_radius");
+  use_background_map_loading_ = node->declare_parameter<bool>("use_background_map_loading", false);
   auto main_sub_opt = rclcpp::SubscriptionOptions();
   main_sub_opt.callback_group = main_callback_group;
   sub_kinematic_state_ = node->create_subscription<nav_msgs::msg::Odometry>(
@@ -321,6 +389,53 @@ VoxelGridDynamicMapLoader::VoxelGridDynamicMapLoader(
   map_update_timer_ = rclcpp::create_timer(
     node, node->get_clock(), period_ns, std::bind(&VoxelGridDynamicMapLoader::timer_callback, this),
     timer_callback_group_);
+
+  if (use_background_map_loading_) {
+    map_update_thread_ = std::thread(&VoxelGridDynamicMapLoader::map_update_thread_loop, this);
+  }
+}
+
+VoxelGridDynamicMapLoader::~VoxelGridDynamicMapLoader()
+{
+  if (map_update_thread_.joinable()) {
+    {
+      std::lock_guard<std::mutex> lock(map_update_mutex_);
+      stop_map_update_thread_ = true;
+    }
+    map_update_cv_.notify_one();
+    map_update_thread_.join();
+  }
+}
+
+void VoxelGridDynamicMapLoader::map_update_thread_loop()
+{
+  while (true) {
+    geometry_msgs::msg::Point position;
+    {
+      std::unique_lock<std::mutex> lock(map_update_mutex_);
+      map_update_cv_.wait(
+        lock, [this]() { return stop_map_update_thread_ || pending_update_position_; });
+      if (stop_map_update_thread_) {
+        return;
+      }
+      position = pending_update_position_.value();
+      pending_update_position_ = std::nullopt;
+    }
+    request_update_map(position);
+  }
+}
+
+void VoxelGridDynamicMapLoader::update_map(const geometry_msgs::msg::Point & position)
+{
+  if (!use_background_map_loading_) {
+    request_update_map(position);
+    return;
+  }
+  {
+    std::lock_guard<std::mutex> lock(map_update_mutex_);
+    pending_update_position_ = position;
+  }
+  map_update_cv_.notify_one();
 }
 void VoxelGridDynamicMapLoader::onEstimatedPoseCallback(nav_msgs::msg::Odometry::ConstSharedPtr msg)
 {
@@ -329,9 +444,7 @@ void VoxelGridDynamicMapLoader::onEstimatedPoseCallback(nav_msgs::msg::Odometry:
 bool VoxelGridDynamicMapLoader::is_close_to_next_map_grid(
   const pcl::PointXYZ & point, const int current_map_grid_index, const double distance_threshold)
 {
-  int neighbor_map_grid_index = static_cast<int>(
-    std::floor((point.x - origin_x_) / map_grid_size_x_) +
-    map_grids_x_ * std::floor((point.y - origin_y_) / map_grid_size_y_));
+  int neighbor_map_grid_index = map_grid_index(point);
 
   if (
     static_cast<size_t>(neighbor_map_grid_index) >= current_voxel_grid_array_.size() ||
@@ -357,62 +470,94 @@ bool VoxelGridDynamicMapLoader::is_close_to_map(
 
   // Compare point with map grid that point belong to
 
-  int map_grid_index = static_cast<int>(
-    std::floor((point.x - origin_x_) / map_grid_size_x_) +
-    map_grids_x_ * std::floor((point.y - origin_y_) / map_grid_size_y_));
+  const int point_map_grid_index = map_grid_index(point);
 
-  if (static_cast<size_t>(map_grid_index) >= current_voxel_grid_array_.size()) {
+  if (static_cast<size_t>(point_map_grid_index) >= current_voxel_grid_array_.size()) {
     return false;
   }
+  if (use_voxel_hash_map_) {
+    // is_close_to_next_map_grid() never matches, the array has no NULL map grid
+    return voxel_hash_map_.is_close(point, point_map_grid_index, distance_threshold);
+  }
   if (
-    current_voxel_grid_array_.at(map_grid_index) != NULL &&
+    current_voxel_grid_array_.at(point_map_grid_index) != NULL &&
     is_close_to_neighbor_voxels(
-      point, distance_threshold, current_voxel_grid_array_.at(map_grid_index)->map_cell_pc_ptr,
-      current_voxel_grid_array_.at(map_grid_index)->map_cell_voxel_grid)) {
+      point, distance_threshold,
+      current_voxel_grid_array_.at(point_map_grid_index)->map_cell_pc_ptr,
+      current_voxel_grid_array_.at(point_map_grid_index)->map_cell_voxel_grid)) {
     return true;
   }
 
   // Compare point with the neighbor map cells if point close to map cell boundary
 
   if (is_close_to_next_map_grid(
-        pcl::PointXYZ(point.x - distance_threshold, point.y, point.z), map_grid_index,
+        pcl::PointXYZ(point.x - distance_threshold, point.y, point.z), point_map_grid_index,
         distance_threshold)) {
     return true;
   }
 
   if (is_close_to_next_map_grid(
-        pcl::PointXYZ(point.x + distance_threshold, point.y, point.z), map_grid_index,
+        pcl::PointXYZ(point.x + distance_threshold, point.y, point.z), point_map_grid_index,
         distance_threshold)) {
     return true;
   }
 
   if (is_close_to_next_map_grid(
-        pcl::PointXYZ(point.x, point.y - distance_threshold, point.z), map_grid_index,
+        pcl::PointXYZ(point.x, point.y - distance_threshold, point.z), point_map_grid_index,
         distance_threshold)) {
     return true;
   }
   if (is_close_to_next_map_grid(
-        pcl::PointXYZ(point.x, point.y + distance_threshold, point.z), map_grid_index,
+        pcl::PointXYZ(point.x, point.y + distance_threshold, point.z), point_map_grid_index,
         distance_threshold)) {
     return true;
   }
 
   return false;
 }
+
+void VoxelGridDynamicMapLoader::filter_points(
+  const PointCloud & input, const double distance_threshold, PointCloud & output)
+{
+  if (!use_voxel_hash_map_) {
+    VoxelGridMapLoader::filter_points(input, distance_threshold, output);
+    return;
+  }
+  // Points out of the array get the cell -1, which has no voxel
+  std::vector<int> cells(input.points.size(), -1);
+  if (current_voxel_grid_dict_.size() != 0) {
+    for (std::size_t i = 0; i < input.points.size(); ++i) {
+      const int index = map_grid_index(input.points[i]);
+      if (static_cast<size_t>(index) < current_voxel_grid_array_.size()) {
+        cells[i] = index;
+      }
+    }
+  }
+  std::vector<std::uint8_t> is_close_flags;
+  voxel_hash_map_.filter_points(
+    input.points.data(), cells.data(), input.points.size(), distance_threshold, is_close_flags);
+  output.points.reserve(input.points.size());
+  for (std::size_t i = 0; i < input.points.size(); ++i) {
+    if (!is_close_flags[i]) {
+      output.points.push_back(input.points[i]);
+    }
+  }
+}
+
 void VoxelGridDynamicMapLoader::timer_callback()
 {
   if (current_position_ == std::nullopt) {
     return;
   }
   if (last_updated_position_ == std::nullopt) {
-    request_update_map(current_position_.value());
+    update_map(current_position_.value());
     last_updated_position_ = current_position_;
     return;
   }
 
   if (should_update_map()) {
     last_updated_position_ = current_position_;
-    request_update_map((current_position_.value()));
+    update_map((current_position_.value()));
     last_updated_position_ = current_position_;
   }
 }
@@ -442,7 +587,7 @@ void VoxelGridDynamicMapLoader::request_update_map(const geometry_msgs::msg::Poi
   std::future_status status = result.wait_for(std::chrono::seconds(0));
   while (status != std::future_status::ready) {
     RCLCPP_INFO(logger_, "Waiting for response...\n");
-    if (!rclcpp::ok()) {
+    if (!rclcpp::ok() || stop_map_update_thread_) {
       return;
     }
     status = result.wait_for(std::chrono::seconds(1));
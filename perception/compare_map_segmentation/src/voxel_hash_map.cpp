@@ -0,0 +1,198 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "compare_map_segmentation/voxel_hash_map.hpp"
+
+#include <cmath>
+#include <limits>
+
+namespace
+{
+// Each grid coordinate is biased and packed on 21 bits, which covers +-2^20 voxels along each axis
+constexpr std::int64_t KEY_BITS = 21;
+constexpr std::int64_t KEY_BIAS = 1 << (KEY_BITS - 1);
+constexpr std::uint64_t KEY_MASK = (1ULL << KEY_BITS) - 1;
+constexpr std::uint64_t EMPTY_KEY = std::numeric_limits<std::uint64_t>::max();
+constexpr std::size_t MIN_CAPACITY = 16;
+
+std::uint64_t pack(const int i, const int j, const int k)
+{
+  return (static_cast<std::uint64_t>(i + KEY_BIAS) & KEY_MASK) |
+         ((static_cast<std::uint64_t>(j + KEY_BIAS) & KEY_MASK) << KEY_BITS) |
+         ((static_cast<std::uint64_t>(k + KEY_BIAS) & KEY_MASK) << (2 * KEY_BITS));
+}
+
+// finalizer of splitmix64, to spread the neighbor voxels over the table
+std::size_t hash(std::uint64_t key)
+{
+  key = (key ^ (key >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  key = (key ^ (key >> 27)) * 0x94d049bb133111ebULL;
+  return key ^ (key >> 31);
+}
+}  // namespace
+
+namespace compare_map_segmentation
+{
+VoxelHashMap::VoxelHashMap()
+{
+  clear();
+}
+
+VoxelHashMap::VoxelHashMap(double leaf_size, double leaf_size_z, double downsize_ratio_z_axis)
+: downsize_ratio_z_axis_(downsize_ratio_z_axis)
+{
+  // same single precision inverse as pcl::VoxelGrid::setLeafSize()
+  inverse_leaf_size_[0] = 1.0f / static_cast<float>(leaf_size);
+  inverse_leaf_size_[1] = 1.0f / static_cast<float>(leaf_size);
+  inverse_leaf_size_[2] = 1.0f / static_cast<float>(leaf_size_z);
+  clear();
+}
+
+void VoxelHashMap::clear(std::size_t num_voxels)
+{
+  size_ = 0;
+  std::size_t capacity = MIN_CAPACITY;
+  // keep the load factor under 0.5
+  while (capacity < 2 * num_voxels) {
+    capacity *= 2;
+  }
+  mask_ = capacity - 1;
+  keys_.assign(capacity, EMPTY_KEY);
+  cells_.resize(capacity);
+  x_.resize(capacity);
+  y_.resize(capacity);
+  z_.resize(capacity);
+}
+
+void VoxelHashMap::rehash(std::size_t capacity)
+{
+  auto keys = std::move(keys_);
+  auto cells = std::move(cells_);
+  auto x = std::move(x_);
+  auto y = std::move(y_);
+  auto z = std::move(z_);
+  clear(capacity / 2);
+  for (std::size_t slot = 0; slot < keys.size(); ++slot) {
+    if (keys[slot] == EMPTY_KEY) {
+      continue;
+    }
+    std::size_t new_slot = hash(keys[slot]) & mask_;
+    while (keys_[new_slot] != EMPTY_KEY) {
+      new_slot = (new_slot + 1) & mask_;
+    }
+    keys_[new_slot] = keys[slot];
+    cells_[new_slot] = cells[slot];
+    x_[new_slot] = x[slot];
+    y_[new_slot] = y[slot];
+    z_[new_slot] = z[slot];
+    ++size_;
+  }
+}
+
+void VoxelHashMap::insert(int i, int j, int k, int cell, const pcl::PointXYZ & centroid)
+{
+  if (2 * (size_ + 1) > keys_.size()) {
+    rehash(2 * keys_.size());
+  }
+  // The voxels of a key in different cells are separate entries
+  const std::uint64_t voxel_key = pack(i, j, k);
+  std::size_t slot = hash(voxel_key) & mask_;
+  while (keys_[slot] != EMPTY_KEY) {
+    slot = (slot + 1) & mask_;
+  }
+  keys_[slot] = voxel_key;
+  cells_[slot] = cell;
+  x_[slot] = centroid.x;
+  y_[slot] = centroid.y;
+  z_[slot] = centroid.z;
+  ++size_;
+}
+
+std::uint64_t VoxelHashMap::key(const float x, const float y, const float z) const
+{
+  // same grid coordinates as pcl::VoxelGrid::getGridCoordinates()
+  return pack(
+    static_cast<int>(std::floor(x * inverse_leaf_size_[0])),
+    static_cast<int>(std::floor(y * inverse_leaf_size_[1])),
+    static_cast<int>(std::floor(z * inverse_leaf_size_[2])));
+}
+
+void VoxelHashMap::collect(std::uint64_t voxel_key, int cell, Candidates & candidates) const
+{
+  for (std::size_t slot = hash(voxel_key) & mask_; keys_[slot] != EMPTY_KEY;
+       slot = (slot + 1) & mask_) {
+    if (keys_[slot] != voxel_key || cells_[slot] != cell || candidates.size == NUM_NEIGHBORS) {
+      continue;
+    }
+    candidates.x[candidates.size] = x_[slot];
+    candidates.y[candidates.size] = y_[slot];
+    candidates.z[candidates.size] = z_[slot];
+    ++candidates.size;
+  }
+}
+
+bool VoxelHashMap::is_close(
+  const pcl::PointXYZ & point, int cell, double distance_threshold,
+  Candidates & candidates) const
+{
+  if (!std::isfinite(point.x) || !std::isfinite(point.y) || !std::isfinite(point.z)) {
+    return false;
+  }
+  const double distance_threshold_z = downsize_ratio_z_axis_ * distance_threshold;
+  const double offsets_xy[3] = {0.0, -distance_threshold, distance_threshold};
+  const double offsets_z[3] = {0.0, -distance_threshold_z, distance_threshold_z};
+
+  candidates.size = 0;
+  for (const double dx : offsets_xy) {
+    for (const double dy : offsets_xy) {
+      for (const double dz : offsets_z) {
+        collect(
+          key(
+            static_cast<float>(point.x + dx), static_cast<float>(point.y + dy),
+            static_cast<float>(point.z + dz)),
+          cell, candidates);
+      }
+    }
+  }
+
+  // No early exit, so that the compiler can vectorize the distance checks
+  const double sqr_threshold = distance_threshold * distance_threshold * downsize_ratio_z_axis_;
+  bool close = false;
+  for (std::size_t c = 0; c < candidates.size; ++c) {
+    const double dist_x = candidates.x[c] - point.x;
+    const double dist_y = candidates.y[c] - point.y;
+    const double dist_z = candidates.z[c] - point.z;
+    close |= dist_x * dist_x + dist_y * dist_y + dist_z * dist_z < sqr_threshold;
+  }
+  return close;
+}
+
+bool VoxelHashMap::is_close(const pcl::PointXYZ & point, int cell, double distance_threshold) const
+{
+  Candidates candidates;
+  return is_close(point, cell, distance_threshold, candidates);
+}
+
+void VoxelHashMap::filter_points(
+  const pcl::PointXYZ * points, const int * cells, std::size_t num_points,
+  double distance_threshold, std::vector<std::uint8_t> & is_close_flags) const
+{
+  is_close_flags.resize(num_points);
+  Candidates candidates;
+  for (std::size_t i = 0; i < num_points; ++i) {
+    is_close_flags[i] = is_close(points[i], cells[i], distance_threshold, candidates);
+  }
+}
+
+}  // namespace compare_map_segmentation
@@ -35,6 +35,7 @@
 #include <lanelet2_traffic_rules/TrafficRulesFactory.h>
 
 #include <memory>
+#include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -69,7 +70,27 @@ private:
   lanelet::routing::RoutingGraphPtr routing_graph_ptr_;
   std::shared_ptr<const lanelet::routing::RoutingGraphContainer> overall_graphs_ptr_;
 
-  lanelet::ConstLanelets conflicting_crosswalks_;
+  // vehicle lanelet conflicting with a crosswalk, which has a traffic light
+  struct ConflictingLanelet
+  {
+    lanelet::ConstLanelet lanelet;
+    lanelet::Id traffic_light_id;
+    std::string turn_direction;
+  };
+
+  // relations of a crosswalk on the route, which are fixed until the route changes
+  struct CrosswalkRelation
+  {
+    lanelet::ConstLanelet crosswalk;
+    lanelet::Ids crosswalk_traffic_light_ids;
+    lanelet::Id related_traffic_light_id;
+    std::vector<ConflictingLanelet> conflicting_lanelets;
+    // pairs of the indices of the conflicting lanelets which have different turn directions and
+    // merge into the same lanelet
+    std::vector<std::pair<size_t, size_t>> merging_lanelet_pairs;
+  };
+
+  std::vector<CrosswalkRelation> crosswalk_relations_;
 
   void onMap(const HADMapBin::ConstSharedPtr msg);
   void onRoute(const LaneletRoute::ConstSharedPtr msg);
@@ -77,13 +98,16 @@ private:
 
   void updateLastDetectedSignal(const TrafficLightIdMap & traffic_signals);
   void setCrosswalkTrafficSignal(
-    const lanelet::ConstLanelet & crosswalk, const uint8_t color, TrafficSignalArray & msg) const;
+    const CrosswalkRelation & relation, const uint8_t color, TrafficSignalArray & msg) const;
 
-  lanelet::ConstLanelets getNonRedLanelets(
-    const lanelet::ConstLanelets & lanelets, const TrafficLightIdMap & traffic_light_id_map) const;
+  CrosswalkRelation createCrosswalkRelation(const lanelet::ConstLanelet & crosswalk) const;
+
+  // flags of the conflicting lanelets whose traffic lights are not red
+  std::vector<bool> getNonRedLanelets(
+    const CrosswalkRelation & relation, const TrafficLightIdMap & traffic_light_id_map) const;
 
   uint8_t estimateCrosswalkTrafficSignal(
-    const lanelet::ConstLanelet & crosswalk, const lanelet::ConstLanelets & non_red_lanelets) const;
+    const CrosswalkRelation & relation, const std::vector<bool> & is_non_red) const;
 
   boost::optional<uint8_t> getHighestConfidenceTrafficSignal(
     const lanelet::ConstLineStringsOrPolygons3d & traffic_lights,
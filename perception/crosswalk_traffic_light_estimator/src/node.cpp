@@ -16,8 +16,10 @@
 #include <lanelet2_extension/regulatory_elements/Forward.hpp>
 #include <lanelet2_extension/utility/message_conversion.hpp>
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
+#include <string>
 #include <utility>
 #include <vector>
 
@@ -44,36 +46,6 @@ bool hasMergeLane(
   return false;
 }
 
-bool hasMergeLane(
-  const lanelet::ConstLanelets & lanelets,
-  const lanelet::routing::RoutingGraphPtr & routing_graph_ptr)
-{
-  for (size_t i = 0; i < lanelets.size(); ++i) {
-    for (size_t j = i + 1; j < lanelets.size(); ++j) {
-      const auto lanelet_1 = lanelets.at(i);
-      const auto lanelet_2 = lanelets.at(j);
-
-      if (lanelet_1.id() == lanelet_2.id()) {
-        continue;
-      }
-
-      const std::string turn_direction_1 = lanelet_1.attributeOr("turn_direction", "none");
-      const std::string turn_direction_2 = lanelet_2.attributeOr("turn_direction", "none");
-      if (turn_direction_1 == turn_direction_2) {
-        continue;
-      }
-
-      if (!hasMergeLane(lanelet_1, lanelet_2, routing_graph_ptr)) {
-        continue;
-      }
-
-      return true;
-    }
-  }
-
-  return false;
-}
-
 }  // namespace
 
 CrosswalkTrafficLightEstimatorNode::CrosswalkTrafficLightEstimatorNode(
@@ -139,18 +111,60 @@ void CrosswalkTrafficLightEstimatorNode::onRoute(const LaneletRoute::ConstShared
     }
   }
 
-  conflicting_crosswalks_.clear();
+  crosswalk_relations_.clear();
 
+  // The relations of the crosswalks are looked up in the routing graphs once for the route,
+  // instead of for every traffic signal message.
   for (const auto & route_lanelet : route_lanelets) {
     constexpr int PEDESTRIAN_GRAPH_ID = 1;
     const auto conflict_lls =
       overall_graphs_ptr_->conflictingInGraph(route_lanelet, PEDESTRIAN_GRAPH_ID);
     for (const auto & lanelet : conflict_lls) {
-      conflicting_crosswalks_.push_back(lanelet);
+      crosswalk_relations_.push_back(createCrosswalkRelation(lanelet));
     }
   }
 }
 
+CrosswalkTrafficLightEstimatorNode::CrosswalkRelation
+CrosswalkTrafficLightEstimatorNode::createCrosswalkRelation(
+  const lanelet::ConstLanelet & crosswalk) const
+{
+  CrosswalkRelation relation;
+  relation.crosswalk = crosswalk;
+  for (const auto & tl_reg_elem : crosswalk.regulatoryElementsAs<const lanelet::TrafficLight>()) {
+    relation.crosswalk_traffic_light_ids.push_back(tl_reg_elem->id());
+  }
+  const std::string related_tl_id = crosswalk.attributeOr("related_traffic_light", "none");
+  relation.related_traffic_light_id = std::atoi(related_tl_id.c_str());
+
+  constexpr int VEHICLE_GRAPH_ID = 0;
+  const auto conflict_lls = overall_graphs_ptr_->conflictingInGraph(crosswalk, VEHICLE_GRAPH_ID);
+  for (const auto & lanelet : conflict_lls) {
+    const auto tl_reg_elems = lanelet.regulatoryElementsAs<const lanelet::TrafficLight>();
+    if (tl_reg_elems.empty()) {
+      continue;
+    }
+    relation.conflicting_lanelets.push_back(
+      {lanelet, tl_reg_elems.front()->id(), lanelet.attributeOr("turn_direction", "none")});
+  }
+
+  const auto & lanelets = relation.conflicting_lanelets;
+  for (size_t i = 0; i < lanelets.size(); ++i) {
+    for (size_t j = i + 1; j < lanelets.size(); ++j) {
+      if (
+        lanelets.at(i).lanelet.id() == lanelets.at(j).lanelet.id() ||
+        lanelets.at(i).turn_direction == lanelets.at(j).turn_direction) {
+        continue;
+      }
+      if (hasMergeLane(lanelets.at(i).lanelet, lanelets.at(j).lanelet, routing_graph_ptr_)) {
+        relation.merging_lanelet_pairs.emplace_back(i, j);
+      }
+    }
+  }
+
+  return relation;
+}
+
 void CrosswalkTrafficLightEstimatorNode::onTrafficLightArray(
   const TrafficSignalArray::ConstSharedPtr msg)
 {
@@ -159,19 +173,19 @@ void CrosswalkTrafficLightEstimatorNode::onTrafficLightArray(
 
   TrafficSignalArray output = *msg;
 
+  const auto now = get_clock()->now();
   TrafficLightIdMap traffic_light_id_map;
+  traffic_light_id_map.reserve(msg->signals.size());
   for (const auto & traffic_signal : msg->signals) {
     traffic_light_id_map[traffic_signal.traffic_signal_id] =
-      std::pair<TrafficSignal, rclcpp::Time>(traffic_signal, get_clock()->now());
+      std::pair<TrafficSignal, rclcpp::Time>(traffic_signal, now);
   }
 
-  for (const auto & crosswalk : conflicting_crosswalks_) {
-    constexpr int VEHICLE_GRAPH_ID = 0;
-    const auto conflict_lls = overall_graphs_ptr_->conflictingInGraph(crosswalk, VEHICLE_GRAPH_ID);
-    const auto non_red_lanelets = getNonRedLanelets(conflict_lls, traffic_light_id_map);
+  for (const auto & relation : crosswalk_relations_) {
+    const auto is_non_red = getNonRedLanelets(relation, traffic_light_id_map);
 
-    const auto crosswalk_tl_color = estimateCrosswalkTrafficSignal(crosswalk, non_red_lanelets);
-    setCrosswalkTrafficSignal(crosswalk, crosswalk_tl_color, output);
+    const auto crosswalk_tl_color = estimateCrosswalkTrafficSignal(relation, is_non_red);
+    setCrosswalkTrafficSignal(relation, crosswalk_tl_color, output);
   }
 
   updateLastDetectedSignal(traffic_light_id_map);
@@ -206,14 +220,14 @@ void CrosswalkTrafficLightEstimatorNode::updateLastDetectedSignal(
     last_detect_color_.at(id) = input_traffic_signal.second;
   }
 
+  const auto now = get_clock()->now();
   std::vector<int32_t> erase_id_list;
   for (auto & last_traffic_signal : last_detect_color_) {
     const auto & id = last_traffic_signal.second.first.traffic_signal_id;
 
     if (traffic_light_id_map.count(id) == 0) {
       // hold signal recognition results for [last_detect_color_hold_time_] seconds.
-      const auto time_from_last_detected =
-        (get_clock()->now() - last_traffic_signal.second.second).seconds();
+      const auto time_from_last_detected = (now - last_traffic_signal.second.second).seconds();
       if (time_from_last_detected > last_detect_color_hold_time_) {
         erase_id_list.emplace_back(id);
       }
@@ -223,37 +237,29 @@ void CrosswalkTrafficLightEstimatorNode::updateLastDetectedSignal(
 }
 
 void CrosswalkTrafficLightEstimatorNode::setCrosswalkTrafficSignal(
-  const lanelet::ConstLanelet & crosswalk, const uint8_t color, TrafficSignalArray & msg) const
+  const CrosswalkRelation & relation, const uint8_t color, TrafficSignalArray & msg) const
 {
-  const auto tl_reg_elems = crosswalk.regulatoryElementsAs<const lanelet::TrafficLight>();
-
-  for (const auto & tl_reg_elem : tl_reg_elems) {
+  for (const auto & tl_reg_elem_id : relation.crosswalk_traffic_light_ids) {
     TrafficSignal output_traffic_signal;
     TrafficSignalElement output_traffic_signal_element;
     output_traffic_signal_element.color = color;
     output_traffic_signal_element.shape = TrafficSignalElement::CIRCLE;
     output_traffic_signal_element.confidence = 1.0;
     output_traffic_signal.elements.push_back(output_traffic_signal_element);
-    output_traffic_signal.traffic_signal_id = tl_reg_elem->id();
+    output_traffic_signal.traffic_signal_id = tl_reg_elem_id;
     msg.signals.push_back(output_traffic_signal);
   }
 }
 
-lanelet::ConstLanelets CrosswalkTrafficLightEstimatorNode::getNonRedLanelets(
-  const lanelet::ConstLanelets & lanelets, const TrafficLightIdMap & traffic_light_id_map) const
+std::vector<bool> CrosswalkTrafficLightEstimatorNode::getNonRedLanelets(
+  const CrosswalkRelation & relation, const TrafficLightIdMap & traffic_light_id_map) const
 {
-  lanelet::ConstLanelets non_red_lanelets{};
-
-  for (const auto & lanelet : lanelets) {
-    const auto tl_reg_elems = lanelet.regulatoryElementsAs<const lanelet::TrafficLight>();
+  std::vector<bool> is_non_red(relation.conflicting_lanelets.size(), false);
 
-    if (tl_reg_elems.empty()) {
-      continue;
-    }
-
-    const auto tl_reg_elem = tl_reg_elems.front();
+  for (size_t i = 0; i < relation.conflicting_lanelets.size(); ++i) {
+    const auto tl_reg_elem_id = relation.conflicting_lanelets.at(i).traffic_light_id;
     const auto current_detected_signal =
-      getHighestConfidenceTrafficSignal(tl_reg_elem->id(), traffic_light_id_map);
+      getHighestConfidenceTrafficSignal(tl_reg_elem_id, traffic_light_id_map);
 
     if (!current_detected_signal && !use_last_detect_color_) {
       continue;
@@ -269,7 +275,7 @@ lanelet::ConstLanelets CrosswalkTrafficLightEstimatorNode::getNonRedLanelets(
                               : true;
 
     const auto last_detected_signal =
-      getHighestConfidenceTrafficSignal(tl_reg_elem->id(), last_detect_color_);
+      getHighestConfidenceTrafficSignal(tl_reg_elem_id, last_detect_color_);
 
     if (!last_detected_signal) {
       continue;
@@ -284,24 +290,26 @@ lanelet::ConstLanelets CrosswalkTrafficLightEstimatorNode::getNonRedLanelets(
       continue;
     }
 
-    non_red_lanelets.push_back(lanelet);
+    is_non_red.at(i) = true;
   }
 
-  return non_red_lanelets;
+  return is_non_red;
 }
 
 uint8_t CrosswalkTrafficLightEstimatorNode::estimateCrosswalkTrafficSignal(
-  const lanelet::ConstLanelet & crosswalk, const lanelet::ConstLanelets & non_red_lanelets) const
+  const CrosswalkRelation & relation, const std::vector<bool> & is_non_red) const
 {
   bool has_left_non_red_lane = false;
   bool has_right_non_red_lane = false;
   bool has_straight_non_red_lane = false;
   bool has_related_non_red_tl = false;
 
-  const std::string related_tl_id = crosswalk.attributeOr("related_traffic_light", "none");
-
-  for (const auto & lanelet : non_red_lanelets) {
-    const std::string turn_direction = lanelet.attributeOr("turn_direction", "none");
+  for (size_t i = 0; i < relation.conflicting_lanelets.size(); ++i) {
+    if (!is_non_red.at(i)) {
+      continue;
+    }
+    const auto & lanelet = relation.conflicting_lanelets.at(i);
+    const auto & turn_direction = lanelet.turn_direction;
 
     if (turn_direction == "left") {
       has_left_non_red_lane = true;
@@ -311,8 +319,7 @@ uint8_t CrosswalkTrafficLightEstimatorNode::estimateCrosswalkTrafficSignal(
       has_straight_non_red_lane = true;
     }
 
-    const auto tl_reg_elems = lanelet.regulatoryElementsAs<const lanelet::TrafficLight>();
-    if (tl_reg_elems.front()->id() == std::atoi(related_tl_id.c_str())) {
+    if (lanelet.traffic_light_id == relation.related_traffic_light_id) {
       has_related_non_red_tl = true;
     }
   }
@@ -321,7 +328,9 @@ uint8_t CrosswalkTrafficLightEstimatorNode::estimateCrosswalkTrafficSignal(
     return TrafficSignalElement::RED;
   }
 
-  const auto has_merge_lane = hasMergeLane(non_red_lanelets, routing_graph_ptr_);
+  const auto has_merge_lane = std::any_of(
+    relation.merging_lanelet_pairs.begin(), relation.merging_lanelet_pairs.end(),
+    [&](const auto & pair) { return is_non_red.at(pair.first) && is_non_red.at(pair.second); });
   return !has_merge_lane && has_left_non_red_lane && has_right_non_red_lane
            ? TrafficSignalElement::RED
            : TrafficSignalElement::UNKNOWN;
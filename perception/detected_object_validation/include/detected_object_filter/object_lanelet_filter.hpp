@@ -23,14 +23,20 @@
 #include <autoware_auto_mapping_msgs/msg/had_map_bin.hpp>
 #include <autoware_auto_perception_msgs/msg/detected_objects.hpp>
 
+#include <boost/geometry/index/rtree.hpp>
+
 #include <lanelet2_core/Forward.h>
+#include <lanelet2_core/primitives/Polygon.h>
 #include <tf2_ros/buffer.h>
 #include <tf2_ros/transform_listener.h>
 
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace object_lanelet_filter
 {
+using tier4_autoware_utils::Box2d;
 using tier4_autoware_utils::LinearRing2d;
 using tier4_autoware_utils::MultiPoint2d;
 using tier4_autoware_utils::Point2d;
@@ -49,9 +55,14 @@ private:
   rclcpp::Subscription<autoware_auto_mapping_msgs::msg::HADMapBin>::SharedPtr map_sub_;
   rclcpp::Subscription<autoware_auto_perception_msgs::msg::DetectedObjects>::SharedPtr object_sub_;
 
+  using LaneletPolygonRtree =
+    boost::geometry::index::rtree<std::pair<Box2d, size_t>, boost::geometry::index::rstar<16>>;
+
   lanelet::LaneletMapPtr lanelet_map_ptr_;
-  lanelet::ConstLanelets road_lanelets_;
-  lanelet::ConstLanelets shoulder_lanelets_;
+  // polygons of the road and shoulder lanelets, built once when the map is received
+  std::vector<lanelet::BasicPolygon2d> lanelet_polygons_;
+  LaneletPolygonRtree lanelet_polygon_rtree_;
+  std::vector<std::pair<Box2d, size_t>> candidate_lanelet_polygons_;
   std::string lanelet_frame_id_;
 
   tf2_ros::Buffer tf_buffer_;
@@ -59,10 +70,8 @@ private:
 
   utils::FilterTargetLabel filter_target_;
 
-  LinearRing2d getConvexHull(const autoware_auto_perception_msgs::msg::DetectedObjects &);
-  lanelet::ConstLanelets getIntersectedLanelets(
-    const LinearRing2d &, const lanelet::ConstLanelets &);
-  bool isPolygonOverlapLanelets(const Polygon2d &, const lanelet::ConstLanelets &);
+  void addLaneletPolygons(const lanelet::ConstLanelets &);
+  bool isPolygonOverlapLanelets(const Polygon2d &);
   geometry_msgs::msg::Polygon setFootprint(
     const autoware_auto_perception_msgs::msg::DetectedObject &);
 };
@@ -16,6 +16,7 @@
 #define OBSTACLE_POINTCLOUD_BASED_VALIDATOR__OBSTACLE_POINTCLOUD_BASED_VALIDATOR_HPP_
 
 #include "obstacle_pointcloud_based_validator/debugger.hpp"
+#include "obstacle_pointcloud_based_validator/pointcloud_grid.hpp"
 
 #include <rclcpp/rclcpp.hpp>
 
@@ -61,6 +62,7 @@ private:
   PointsNumThresholdParam points_num_threshold_param_;
 
   std::shared_ptr<Debugger> debugger_;
+  PointCloudGrid pointcloud_grid_;
 
 private:
   void onObjectsAndObstaclePointCloud(
@@ -0,0 +1,161 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef OBSTACLE_POINTCLOUD_BASED_VALIDATOR__POINTCLOUD_GRID_HPP_
+#define OBSTACLE_POINTCLOUD_BASED_VALIDATOR__POINTCLOUD_GRID_HPP_
+
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+namespace obstacle_pointcloud_based_validator
+{
+/**
+ * @brief 2D uniform grid of the points to search the neighbors of the objects
+ * @details The points are sorted by the cell with a counting sort, which takes a few linear passes
+ * over the pointcloud instead of building a kd-tree. The grid covers the bounding box of the
+ * pointcloud, and the cell size is enlarged if the grid has too many cells.
+ */
+class PointCloudGrid
+{
+public:
+  explicit PointCloudGrid(const double cell_size = 1.0) : base_cell_size_(cell_size) {}
+
+  void setInputCloud(const pcl::PointCloud<pcl::PointXY>::ConstPtr & pointcloud)
+  {
+    pointcloud_ = pointcloud;
+    cell_begin_.clear();
+    indices_.clear();
+
+    float min_x = std::numeric_limits<float>::max();
+    float min_y = std::numeric_limits<float>::max();
+    float max_x = std::numeric_limits<float>::lowest();
+    float max_y = std::numeric_limits<float>::lowest();
+    for (const auto & point : *pointcloud_) {
+      if (!std::isfinite(point.x) || !std::isfinite(point.y)) {
+        continue;
+      }
+      min_x = std::min(min_x, point.x);
+      min_y = std::min(min_y, point.y);
+      max_x = std::max(max_x, point.x);
+      max_y = std::max(max_y, point.y);
+    }
+    if (max_x < min_x) {
+      width_ = 0;
+      height_ = 0;
+      return;
+    }
+
+    const double extent_x = static_cast<double>(max_x) - min_x;
+    const double extent_y = static_cast<double>(max_y) - min_y;
+    cell_size_ = std::max(
+      {base_cell_size_, std::sqrt(extent_x * extent_y / static_cast<double>(max_cell_num)),
+       std::max(extent_x, extent_y) / static_cast<double>(max_cell_num)});
+    min_x_ = min_x;
+    min_y_ = min_y;
+    width_ = static_cast<int>(extent_x / cell_size_) + 1;
+    height_ = static_cast<int>(extent_y / cell_size_) + 1;
+
+    // counting sort of the points by the cell
+    std::vector<int> point_cells(pointcloud_->size(), -1);
+    cell_begin_.assign(static_cast<size_t>(width_) * height_ + 1, 0);
+    for (size_t i = 0; i < pointcloud_->size(); ++i) {
+      const auto & point = pointcloud_->points[i];
+      if (!std::isfinite(point.x) || !std::isfinite(point.y)) {
+        continue;
+      }
+      point_cells[i] = toCellIndex(getCellX(point.x), getCellY(point.y));
+      ++cell_begin_[point_cells[i] + 1];
+    }
+    for (size_t cell = 1; cell < cell_begin_.size(); ++cell) {
+      cell_begin_[cell] += cell_begin_[cell - 1];
+    }
+    indices_.resize(cell_begin_.back());
+    std::vector<size_t> cell_end(cell_begin_.begin(), cell_begin_.end() - 1);
+    for (size_t i = 0; i < point_cells.size(); ++i) {
+      if (point_cells[i] >= 0) {
+        indices_[cell_end[point_cells[i]]++] = static_cast<int>(i);
+      }
+    }
+  }
+
+  /**
+   * @brief search the points within the radius from the center
+   * @param[in] center center of the search
+   * @param[in] radius radius of the search
+   * @param[out] indices indices of the points within the radius
+   */
+  void radiusSearch(const pcl::PointXY & center, const double radius, std::vector<int> & indices)
+    const
+  {
+    indices.clear();
+    if (width_ == 0 || height_ == 0) {
+      return;
+    }
+    // cells overlapping the bounding box of the search circle
+    const int begin_x = getCellX(center.x - radius);
+    const int end_x = getCellX(center.x + radius);
+    const int begin_y = getCellY(center.y - radius);
+    const int end_y = getCellY(center.y + radius);
+    const double sq_radius = radius * radius;
+    for (int y = begin_y; y <= end_y; ++y) {
+      for (int x = begin_x; x <= end_x; ++x) {
+        const int cell = toCellIndex(x, y);
+        for (size_t i = cell_begin_[cell]; i < cell_begin_[cell + 1]; ++i) {
+          const auto & point = pointcloud_->points[indices_[i]];
+          const double dx = point.x - center.x;
+          const double dy = point.y - center.y;
+          if (dx * dx + dy * dy <= sq_radius) {
+            indices.push_back(indices_[i]);
+          }
+        }
+      }
+    }
+  }
+
+private:
+  // upper limit of the number of cells to bound the memory for a sparse and wide pointcloud
+  static constexpr size_t max_cell_num = 1 << 20;
+
+  double base_cell_size_;
+  double cell_size_{1.0};
+  double min_x_{0.0};
+  double min_y_{0.0};
+  int width_{0};
+  int height_{0};
+  pcl::PointCloud<pcl::PointXY>::ConstPtr pointcloud_;
+  // range of the points in indices_ for each cell
+  std::vector<size_t> cell_begin_;
+  // indices of the points sorted by the cell
+  std::vector<int> indices_;
+
+  int getCellX(const double x) const
+  {
+    const double cell_x = std::floor((x - min_x_) / cell_size_);
+    return static_cast<int>(std::clamp(cell_x, 0.0, static_cast<double>(width_ - 1)));
+  }
+  int getCellY(const double y) const
+  {
+    const double cell_y = std::floor((y - min_y_) / cell_size_);
+    return static_cast<int>(std::clamp(cell_y, 0.0, static_cast<double>(height_ - 1)));
+  }
+  int toCellIndex(const int x, const int y) const { return y * width_ + x; }
+};
+}  // namespace obstacle_pointcloud_based_validator
+
+#endif  // OBSTACLE_POINTCLOUD_BASED_VALIDATOR__POINTCLOUD_GRID_HPP_
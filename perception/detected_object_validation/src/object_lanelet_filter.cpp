@@ -19,12 +19,13 @@
 #include <object_recognition_utils/object_recognition_utils.hpp>
 #include <tier4_autoware_utils/geometry/geometry.hpp>
 
-#include <boost/geometry/algorithms/convex_hull.hpp>
 #include <boost/geometry/algorithms/disjoint.hpp>
-#include <boost/geometry/algorithms/intersects.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
 
 #include <lanelet2_core/geometry/Polygon.h>
 
+#include <iterator>
+
 namespace object_lanelet_filter
 {
 ObjectLaneletFilterNode::ObjectLaneletFilterNode(const rclcpp::NodeOptions & node_options)
@@ -61,8 +62,28 @@ void ObjectLaneletFilterNode::mapCallback(
   lanelet_map_ptr_ = std::make_shared<lanelet::LaneletMap>();
   lanelet::utils::conversion::fromBinMsg(*map_msg, lanelet_map_ptr_);
   const lanelet::ConstLanelets all_lanelets = lanelet::utils::query::laneletLayer(lanelet_map_ptr_);
-  road_lanelets_ = lanelet::utils::query::roadLanelets(all_lanelets);
-  shoulder_lanelets_ = lanelet::utils::query::shoulderLanelets(all_lanelets);
+  const lanelet::ConstLanelets road_lanelets = lanelet::utils::query::roadLanelets(all_lanelets);
+  const lanelet::ConstLanelets shoulder_lanelets =
+    lanelet::utils::query::shoulderLanelets(all_lanelets);
+
+  // The objects are kept if they overlap either a road or a shoulder lanelet, so both are indexed
+  // in one R-tree and the lanelet polygons are not rebuilt for every object message.
+  lanelet_polygons_.clear();
+  addLaneletPolygons(road_lanelets);
+  addLaneletPolygons(shoulder_lanelets);
+  std::vector<std::pair<Box2d, size_t>> boxes;
+  boxes.reserve(lanelet_polygons_.size());
+  for (size_t i = 0; i < lanelet_polygons_.size(); ++i) {
+    boxes.emplace_back(boost::geometry::return_envelope<Box2d>(lanelet_polygons_.at(i)), i);
+  }
+  lanelet_polygon_rtree_ = LaneletPolygonRtree(boxes);
+}
+
+void ObjectLaneletFilterNode::addLaneletPolygons(const lanelet::ConstLanelets & lanelets)
+{
+  for (const auto & lanelet : lanelets) {
+    lanelet_polygons_.push_back(lanelet.polygon2d().basicPolygon());
+  }
 }
 
 void ObjectLaneletFilterNode::objectCallback(
@@ -85,14 +106,6 @@ void ObjectLaneletFilterNode::objectCallback(
     return;
   }
 
-  // calculate convex hull
-  const auto convex_hull = getConvexHull(transformed_objects);
-  // get intersected lanelets
-  lanelet::ConstLanelets intersected_road_lanelets =
-    getIntersectedLanelets(convex_hull, road_lanelets_);
-  lanelet::ConstLanelets intersected_shoulder_lanelets =
-    getIntersectedLanelets(convex_hull, shoulder_lanelets_);
-
   int index = 0;
   for (const auto & object : transformed_objects.objects) {
     const auto footprint = setFootprint(object);
@@ -105,9 +118,7 @@ void ObjectLaneletFilterNode::objectCallback(
         polygon.outer().emplace_back(point_transformed.x, point_transformed.y);
       }
       polygon.outer().push_back(polygon.outer().front());
-      if (isPolygonOverlapLanelets(polygon, intersected_road_lanelets)) {
-        output_object_msg.objects.emplace_back(input_msg->objects.at(index));
-      } else if (isPolygonOverlapLanelets(polygon, intersected_shoulder_lanelets)) {
+      if (isPolygonOverlapLanelets(polygon)) {
         output_object_msg.objects.emplace_back(input_msg->objects.at(index));
       }
     } else {
@@ -143,41 +154,15 @@ geometry_msgs::msg::Polygon ObjectLaneletFilterNode::setFootprint(
   return footprint;
 }
 
-LinearRing2d ObjectLaneletFilterNode::getConvexHull(
-  const autoware_auto_perception_msgs::msg::DetectedObjects & detected_objects)
-{
-  MultiPoint2d candidate_points;
-  for (const auto & object : detected_objects.objects) {
-    const auto & pos = object.kinematics.pose_with_covariance.pose.position;
-    const auto footprint = setFootprint(object);
-    for (const auto & p : footprint.points) {
-      candidate_points.emplace_back(p.x + pos.x, p.y + pos.y);
-    }
-  }
-
-  LinearRing2d convex_hull;
-  boost::geometry::convex_hull(candidate_points, convex_hull);
-
-  return convex_hull;
-}
-
-lanelet::ConstLanelets ObjectLaneletFilterNode::getIntersectedLanelets(
-  const LinearRing2d & convex_hull, const lanelet::ConstLanelets & road_lanelets)
-{
-  lanelet::ConstLanelets intersected_lanelets;
-  for (const auto & road_lanelet : road_lanelets) {
-    if (boost::geometry::intersects(convex_hull, road_lanelet.polygon2d().basicPolygon())) {
-      intersected_lanelets.emplace_back(road_lanelet);
-    }
-  }
-  return intersected_lanelets;
-}
-
-bool ObjectLaneletFilterNode::isPolygonOverlapLanelets(
-  const Polygon2d & polygon, const lanelet::ConstLanelets & intersected_lanelets)
+bool ObjectLaneletFilterNode::isPolygonOverlapLanelets(const Polygon2d & polygon)
 {
-  for (const auto & lanelet : intersected_lanelets) {
-    if (!boost::geometry::disjoint(polygon, lanelet.polygon2d().basicPolygon())) {
+  // only the lanelets whose bounding box intersects the one of the polygon are tested
+  candidate_lanelet_polygons_.clear();
+  lanelet_polygon_rtree_.query(
+    boost::geometry::index::intersects(boost::geometry::return_envelope<Box2d>(polygon)),
+    std::back_inserter(candidate_lanelet_polygons_));
+  for (const auto & candidate : candidate_lanelet_polygons_) {
+    if (!boost::geometry::disjoint(polygon, lanelet_polygons_.at(candidate.second))) {
       return true;
     }
   }
@@ -19,10 +19,6 @@
 
 #include <boost/geometry.hpp>
 
-#include <pcl/filters/crop_hull.h>
-#include <pcl/kdtree/kdtree_flann.h>
-#include <pcl/search/kdtree.h>
-#include <pcl/search/pcl_search.h>
 #include <pcl_conversions/pcl_conversions.h>
 
 #ifdef ROS_DISTRO_GALACTIC
@@ -55,17 +51,6 @@ inline pcl::PointXYZ toXYZ(const pcl::PointXY & point)
   return pcl::PointXYZ(point.x, point.y, 0.0);
 }
 
-inline pcl::PointCloud<pcl::PointXYZ>::Ptr toXYZ(
-  const pcl::PointCloud<pcl::PointXY>::Ptr & pointcloud)
-{
-  pcl::PointCloud<pcl::PointXYZ>::Ptr pointcloud_xyz(new pcl::PointCloud<pcl::PointXYZ>);
-  pointcloud_xyz->reserve(pointcloud->size());
-  for (const auto & point : *pointcloud) {
-    pointcloud_xyz->push_back(toXYZ(point));
-  }
-  return pointcloud_xyz;
-}
-
 }  // namespace
 
 namespace obstacle_pointcloud_based_validator
@@ -129,10 +114,9 @@ void ObstaclePointCloudBasedValidator::onObjectsAndObstaclePointCloud(
     return;
   }
 
-  // Create Kd-tree to search neighbor pointcloud to reduce cost.
-  pcl::search::Search<pcl::PointXY>::Ptr kdtree =
-    pcl::make_shared<pcl::search::KdTree<pcl::PointXY>>(false);
-  kdtree->setInputCloud(obstacle_pointcloud);
+  // Create grid to search neighbor pointcloud to reduce cost.
+  pointcloud_grid_.setInputCloud(obstacle_pointcloud);
+  std::vector<int> indices;
 
   for (size_t i = 0; i < transformed_objects.objects.size(); ++i) {
     const auto & transformed_object = transformed_objects.objects.at(i);
@@ -148,10 +132,8 @@ void ObstaclePointCloudBasedValidator::onObjectsAndObstaclePointCloud(
 
     // Search neighbor pointcloud to reduce cost.
     pcl::PointCloud<pcl::PointXY>::Ptr neighbor_pointcloud(new pcl::PointCloud<pcl::PointXY>);
-    std::vector<int> indices;
-    std::vector<float> distances;
-    kdtree->radiusSearch(
-      toPCL(transformed_object_position), search_radius.value(), indices, distances);
+    pointcloud_grid_.radiusSearch(
+      toPCL(transformed_object_position), search_radius.value(), indices);
     for (const auto & index : indices) {
       neighbor_pointcloud->push_back(obstacle_pointcloud->at(index));
     }
@@ -189,32 +171,25 @@ std::optional<size_t> ObstaclePointCloudBasedValidator::getPointCloudNumWithinPo
   const autoware_auto_perception_msgs::msg::DetectedObject & object,
   const pcl::PointCloud<pcl::PointXY>::Ptr pointcloud)
 {
-  pcl::PointCloud<pcl::PointXYZ>::Ptr cropped_pointcloud(new pcl::PointCloud<pcl::PointXYZ>);
-  std::vector<pcl::Vertices> vertices_array;
-  pcl::Vertices vertices;
-
   Polygon2d poly2d =
     tier4_autoware_utils::toPolygon2d(object.kinematics.pose_with_covariance.pose, object.shape);
   if (bg::is_empty(poly2d)) return std::nullopt;
 
-  pcl::PointCloud<pcl::PointXYZ>::Ptr poly3d(new pcl::PointCloud<pcl::PointXYZ>);
-
-  for (size_t i = 0; i < poly2d.outer().size(); ++i) {
-    vertices.vertices.emplace_back(i);
-    vertices_array.emplace_back(vertices);
-    poly3d->emplace_back(poly2d.outer().at(i).x(), poly2d.outer().at(i).y(), 0.0);
+  // test the points in the bounding box of the polygon only
+  const auto envelope = bg::return_envelope<tier4_autoware_utils::Box2d>(poly2d);
+  pcl::PointCloud<pcl::PointXYZ>::Ptr cropped_pointcloud(new pcl::PointCloud<pcl::PointXYZ>);
+  size_t num = 0;
+  for (const auto & point : *pointcloud) {
+    const tier4_autoware_utils::Point2d point2d(point.x, point.y);
+    if (!bg::covered_by(point2d, envelope) || !bg::within(point2d, poly2d)) {
+      continue;
+    }
+    ++num;
+    if (debugger_) cropped_pointcloud->push_back(toXYZ(point));
   }
 
-  pcl::CropHull<pcl::PointXYZ> cropper;  // don't be implemented PointXY by PCL
-  cropper.setInputCloud(toXYZ(pointcloud));
-  cropper.setDim(2);
-  cropper.setHullIndices(vertices_array);
-  cropper.setHullCloud(poly3d);
-  cropper.setCropOutside(true);
-  cropper.filter(*cropped_pointcloud);
-
   if (debugger_) debugger_->addPointcloudWithinPolygon(cropped_pointcloud);
-  return cropped_pointcloud->size();
+  return num;
 }
 
 std::optional<float> ObstaclePointCloudBasedValidator::getMaxRadius(
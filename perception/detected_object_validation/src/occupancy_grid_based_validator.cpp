@@ -76,8 +76,8 @@ void OccupancyGridBasedValidator::onObjectsAndOccGrid(
     const auto & object = input_objects->objects.at(i);
     const auto & label = object.classification.front().label;
     if (object_recognition_utils::isCarLikeVehicle(label)) {
-      auto mask = getMask(*input_occ_grid, transformed_object);
-      const float mean = mask ? cv::mean(occ_grid, mask.value())[0] * 0.01 : 1.0;
+      const float mean =
+        getMeanOccupancy(*input_occ_grid, transformed_object, occ_grid).value_or(1.0);
       if (mean_threshold_ < mean) output.objects.push_back(object);
     } else {
       output.objects.push_back(object);
@@ -89,20 +89,14 @@ void OccupancyGridBasedValidator::onObjectsAndOccGrid(
   if (enable_debug_) showDebugImage(*input_occ_grid, transformed_objects, occ_grid);
 }
 
-std::optional<cv::Mat> OccupancyGridBasedValidator::getMask(
+std::optional<std::vector<cv::Point>> OccupancyGridBasedValidator::getPixelVertices(
   const nav_msgs::msg::OccupancyGrid & occupancy_grid,
   const autoware_auto_perception_msgs::msg::DetectedObject & object)
-{
-  cv::Mat mask = cv::Mat::zeros(occupancy_grid.info.height, occupancy_grid.info.width, CV_8UC1);
-  return getMask(occupancy_grid, object, mask);
-}
-
-std::optional<cv::Mat> OccupancyGridBasedValidator::getMask(
-  const nav_msgs::msg::OccupancyGrid & occupancy_grid,
-  const autoware_auto_perception_msgs::msg::DetectedObject & object, cv::Mat mask)
 {
   const auto & resolution = occupancy_grid.info.resolution;
   const auto & origin = occupancy_grid.info.origin;
+  const int cols = occupancy_grid.info.width;
+  const int rows = occupancy_grid.info.height;
   std::vector<cv::Point> pixel_vertices;
   Polygon2d poly2d =
     tier4_autoware_utils::toPolygon2d(object.kinematics.pose_with_covariance.pose, object.shape);
@@ -111,7 +105,7 @@ std::optional<cv::Mat> OccupancyGridBasedValidator::getMask(
   for (const auto & p : poly2d.outer()) {
     const float px = (p.x() - origin.position.x) / resolution;
     const float py = (p.y() - origin.position.y) / resolution;
-    const bool is_point_within_image = (0 <= px && px < mask.cols && 0 <= py && py < mask.rows);
+    const bool is_point_within_image = (0 <= px && px < cols && 0 <= py && py < rows);
 
     if (!is_point_within_image) is_polygon_within_image = false;
 
@@ -119,23 +113,58 @@ std::optional<cv::Mat> OccupancyGridBasedValidator::getMask(
   }
 
   if (is_polygon_within_image && !pixel_vertices.empty()) {
-    cv::fillConvexPoly(mask, pixel_vertices, cv::Scalar(255));
-    return mask;
+    return pixel_vertices;
   } else {
     return std::nullopt;
   }
 }
 
+std::optional<float> OccupancyGridBasedValidator::getMeanOccupancy(
+  const nav_msgs::msg::OccupancyGrid & occupancy_grid,
+  const autoware_auto_perception_msgs::msg::DetectedObject & object, const cv::Mat & occ_grid)
+{
+  auto pixel_vertices = getPixelVertices(occupancy_grid, object);
+  if (!pixel_vertices) {
+    return std::nullopt;
+  }
+
+  // Rasterize the polygon only in the bounding rectangle instead of the whole grid
+  const cv::Rect roi =
+    cv::boundingRect(pixel_vertices.value()) & cv::Rect(0, 0, occ_grid.cols, occ_grid.rows);
+  if (roi.empty()) {
+    return std::nullopt;
+  }
+  for (auto & vertex : pixel_vertices.value()) {
+    vertex -= roi.tl();
+  }
+  cv::Mat mask = cv::Mat::zeros(roi.size(), CV_8UC1);
+  cv::fillConvexPoly(mask, pixel_vertices.value(), cv::Scalar(255));
+  return cv::mean(occ_grid(roi), mask)[0] * 0.01;
+}
+
+std::optional<cv::Mat> OccupancyGridBasedValidator::getMask(
+  const nav_msgs::msg::OccupancyGrid & occupancy_grid,
+  const autoware_auto_perception_msgs::msg::DetectedObject & object, cv::Mat mask)
+{
+  const auto pixel_vertices = getPixelVertices(occupancy_grid, object);
+  if (!pixel_vertices) {
+    return std::nullopt;
+  }
+  cv::fillConvexPoly(mask, pixel_vertices.value(), cv::Scalar(255));
+  return mask;
+}
+
 cv::Mat OccupancyGridBasedValidator::fromOccupancyGrid(
   const nav_msgs::msg::OccupancyGrid & occupancy_grid)
 {
   cv::Mat cv_occ_grid =
     cv::Mat::zeros(occupancy_grid.info.height, occupancy_grid.info.width, CV_8UC1);
-  for (size_t i = 0; i < occupancy_grid.data.size(); ++i) {
-    size_t y = i / occupancy_grid.info.width;
-    size_t x = i % occupancy_grid.info.width;
+  // the rows of the continuous image are laid out as the data of the occupancy grid
+  const size_t size = std::min(occupancy_grid.data.size(), cv_occ_grid.total());
+  unsigned char * cv_occ_grid_data = cv_occ_grid.ptr<unsigned char>();
+  for (size_t i = 0; i < size; ++i) {
     const auto & data = occupancy_grid.data[i];
-    cv_occ_grid.at<unsigned char>(y, x) =
+    cv_occ_grid_data[i] =
       std::min(std::max(data, static_cast<signed char>(0)), static_cast<signed char>(50)) * 2;
   }
   return cv_occ_grid;
@@ -154,8 +183,7 @@ void OccupancyGridBasedValidator::showDebugImage(
   for (const auto & object : objects.objects) {
     const auto & label = object.classification.front().label;
     if (object_recognition_utils::isCarLikeVehicle(label)) {
-      auto mask = getMask(ros_occ_grid, object);
-      const float mean = mask ? cv::mean(occ_grid, mask.value())[0] * 0.01 : 1.0;
+      const float mean = getMeanOccupancy(ros_occ_grid, object, occ_grid).value_or(1.0);
       if (mean_threshold_ < mean) {
         auto mask = getMask(ros_occ_grid, object, passed_objects_image);
         if (mask) passed_objects_image = mask.value();
@@ -0,0 +1,97 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef DETECTION_BY_TRACKER__CLUSTER_HIERARCHY_HPP_
+#define DETECTION_BY_TRACKER__CLUSTER_HIERARCHY_HPP_
+
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief Single linkage clustering of a pointcloud at several tolerances at once.
+ * The points are pressed 2d into voxels, as in VoxelGridBasedEuclideanCluster. The pairs of voxels
+ * within the largest tolerance are sorted by distance and united in that order, and the clusters
+ * of a tolerance are the components once all the pairs within it are united, so the clusters of
+ * all the tolerances come from a single pass.
+ * All the buffers, the clusters included, are kept between the calls, so that a call does not
+ * allocate once the size of the pointclouds is stable.
+ */
+class ClusterHierarchy
+{
+public:
+  using PointCloud = pcl::PointCloud<pcl::PointXYZ>;
+
+  ClusterHierarchy(const int min_cluster_size, const int max_cluster_size);
+
+  /**
+   * @brief cluster a pointcloud at each tolerance
+   * @param pointcloud pointcloud to cluster
+   * @param tolerances distances of the clustering, in any order
+   * @param voxel_leaf_size size of the voxels, which should be below the smallest tolerance
+   */
+  void build(
+    const PointCloud & pointcloud, const std::vector<float> & tolerances,
+    const float voxel_leaf_size);
+
+  /**
+   * @brief get the clusters of a tolerance, valid until the next build()
+   * @param level index of the tolerance in the tolerances of build()
+   */
+  const std::vector<PointCloud> & getClusters(const std::size_t level) const
+  {
+    return levels_.at(level);
+  }
+
+private:
+  struct Edge
+  {
+    float squared_distance;
+    int voxel_a;
+    int voxel_b;
+  };
+
+  void voxelize(const PointCloud & pointcloud, const float voxel_leaf_size);
+  void findEdges(const float max_tolerance);
+  void extractClusters(const PointCloud & pointcloud, std::vector<PointCloud> & clusters);
+  void resizeClusters(std::vector<PointCloud> & clusters, const std::size_t size);
+  int findRoot(int voxel);
+
+  int min_cluster_size_;
+  int max_cluster_size_;
+
+  // voxels: key of each finite point sorted, and the 2d centroids of the voxels
+  std::vector<std::pair<std::uint64_t, int>> point_keys_;
+  std::vector<int> voxel_of_point_;
+  std::vector<float> voxel_x_;
+  std::vector<float> voxel_y_;
+  // voxels sorted by their cell of the size of the largest tolerance
+  std::vector<std::pair<std::uint64_t, int>> cell_keys_;
+  std::vector<Edge> edges_;
+  // union-find of the voxels, and the cluster of each root
+  std::vector<int> parents_;
+  std::vector<int> cluster_of_root_;
+  std::vector<int> cluster_sizes_;
+  std::vector<std::size_t> level_order_;
+
+  std::vector<std::vector<PointCloud>> levels_;
+  // clusters not used by the levels, kept for their capacity
+  std::vector<PointCloud> spare_clusters_;
+};
+
+#endif  // DETECTION_BY_TRACKER__CLUSTER_HIERARCHY_HPP_
@@ -15,6 +15,7 @@
 #ifndef DETECTION_BY_TRACKER__DETECTION_BY_TRACKER_CORE_HPP_
 #define DETECTION_BY_TRACKER__DETECTION_BY_TRACKER_CORE_HPP_
 
+#include "detection_by_tracker/cluster_hierarchy.hpp"
 #include "detection_by_tracker/debugger.hpp"
 
 #include <euclidean_cluster/euclidean_cluster.hpp>
@@ -82,6 +83,9 @@ private:
   std::map<uint8_t, int> max_search_distance_for_divider_;
 
   bool ignore_unknown_tracker_;
+  // cluster an under segmented object at all the tolerances at once
+  bool use_multi_resolution_clustering_;
+  ClusterHierarchy cluster_hierarchy_{4, 10000};
 
   void setMaxSearchRange();
 
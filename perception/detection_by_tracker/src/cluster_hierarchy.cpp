@@ -0,0 +1,231 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "detection_by_tracker/cluster_hierarchy.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+
+namespace
+{
+constexpr std::int64_t KEY_BIAS = 1LL << 31;
+
+std::uint64_t cellKey(const std::int64_t i, const std::int64_t j)
+{
+  return (static_cast<std::uint64_t>(j + KEY_BIAS) << 32) |
+         (static_cast<std::uint64_t>(i + KEY_BIAS) & 0xFFFFFFFFULL);
+}
+}  // namespace
+
+ClusterHierarchy::ClusterHierarchy(const int min_cluster_size, const int max_cluster_size)
+: min_cluster_size_(min_cluster_size), max_cluster_size_(max_cluster_size)
+{
+}
+
+void ClusterHierarchy::build(
+  const PointCloud & pointcloud, const std::vector<float> & tolerances,
+  const float voxel_leaf_size)
+{
+  levels_.resize(tolerances.size());
+  if (tolerances.empty()) {
+    return;
+  }
+
+  voxelize(pointcloud, voxel_leaf_size);
+  findEdges(*std::max_element(tolerances.begin(), tolerances.end()));
+  std::sort(edges_.begin(), edges_.end(), [](const Edge & a, const Edge & b) {
+    return a.squared_distance < b.squared_distance;
+  });
+
+  // unite the voxels from the closest pair, and extract the clusters of each tolerance from the
+  // smallest one when all the pairs within it are united
+  level_order_.resize(tolerances.size());
+  std::iota(level_order_.begin(), level_order_.end(), 0);
+  std::sort(level_order_.begin(), level_order_.end(), [&tolerances](const auto a, const auto b) {
+    return tolerances.at(a) < tolerances.at(b);
+  });
+  parents_.resize(voxel_x_.size());
+  std::iota(parents_.begin(), parents_.end(), 0);
+  auto edge_itr = edges_.begin();
+  for (const auto level : level_order_) {
+    const float squared_tolerance = tolerances.at(level) * tolerances.at(level);
+    for (; edge_itr != edges_.end() && edge_itr->squared_distance <= squared_tolerance;
+         ++edge_itr) {
+      int a = findRoot(edge_itr->voxel_a);
+      int b = findRoot(edge_itr->voxel_b);
+      if (a == b) {
+        continue;
+      }
+      // the larger root is linked to the smaller one, so the root of a cluster is its first voxel
+      if (a < b) {
+        std::swap(a, b);
+      }
+      parents_[a] = b;
+    }
+    extractClusters(pointcloud, levels_.at(level));
+  }
+}
+
+void ClusterHierarchy::voxelize(const PointCloud & pointcloud, const float voxel_leaf_size)
+{
+  const float inverse_leaf_size = 1.0f / voxel_leaf_size;
+  const auto & points = pointcloud.points;
+  point_keys_.clear();
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    const auto & point = points[i];
+    if (!std::isfinite(point.x) || !std::isfinite(point.y) || !std::isfinite(point.z)) {
+      continue;
+    }
+    point_keys_.emplace_back(
+      cellKey(
+        static_cast<std::int64_t>(std::floor(point.x * inverse_leaf_size)),
+        static_cast<std::int64_t>(std::floor(point.y * inverse_leaf_size))),
+      static_cast<int>(i));
+  }
+  std::sort(point_keys_.begin(), point_keys_.end());
+
+  voxel_of_point_.assign(points.size(), -1);
+  voxel_x_.clear();
+  voxel_y_.clear();
+  for (std::size_t begin = 0; begin < point_keys_.size();) {
+    std::size_t end = begin;
+    float sum_x = 0.0f;
+    float sum_y = 0.0f;
+    for (; end < point_keys_.size() && point_keys_[end].first == point_keys_[begin].first; ++end) {
+      const auto & point = points[point_keys_[end].second];
+      sum_x += point.x;
+      sum_y += point.y;
+      voxel_of_point_[point_keys_[end].second] = static_cast<int>(voxel_x_.size());
+    }
+    const float num_points = static_cast<float>(end - begin);
+    voxel_x_.push_back(sum_x / num_points);
+    voxel_y_.push_back(sum_y / num_points);
+    begin = end;
+  }
+}
+
+void ClusterHierarchy::findEdges(const float max_tolerance)
+{
+  // with cells of the size of the largest tolerance, the voxels within it are in adjacent cells
+  const float inverse_cell_size = 1.0f / max_tolerance;
+  const float squared_max_tolerance = max_tolerance * max_tolerance;
+  const int num_voxels = static_cast<int>(voxel_x_.size());
+  const auto cell_index = [inverse_cell_size](const float v) {
+    return static_cast<std::int64_t>(std::floor(v * inverse_cell_size));
+  };
+  cell_keys_.clear();
+  for (int v = 0; v < num_voxels; ++v) {
+    cell_keys_.emplace_back(cellKey(cell_index(voxel_x_[v]), cell_index(voxel_y_[v])), v);
+  }
+  std::sort(cell_keys_.begin(), cell_keys_.end());
+
+  edges_.clear();
+  for (int a = 0; a < num_voxels; ++a) {
+    const std::int64_t i = cell_index(voxel_x_[a]);
+    const std::int64_t j = cell_index(voxel_y_[a]);
+    for (std::int64_t dj = -1; dj <= 1; ++dj) {
+      for (std::int64_t di = -1; di <= 1; ++di) {
+        const std::uint64_t key = cellKey(i + di, j + dj);
+        // the voxels of a cell are sorted, so the ones after a are the ones from a + 1
+        auto itr = std::lower_bound(
+          cell_keys_.begin(), cell_keys_.end(), std::make_pair(key, a + 1));
+        for (; itr != cell_keys_.end() && itr->first == key; ++itr) {
+          const int b = itr->second;
+          const float dx = voxel_x_[a] - voxel_x_[b];
+          const float dy = voxel_y_[a] - voxel_y_[b];
+          const float squared_distance = dx * dx + dy * dy;
+          if (squared_distance <= squared_max_tolerance) {
+            edges_.push_back(Edge{squared_distance, a, b});
+          }
+        }
+      }
+    }
+  }
+}
+
+void ClusterHierarchy::extractClusters(
+  const PointCloud & pointcloud, std::vector<PointCloud> & clusters)
+{
+  const int num_voxels = static_cast<int>(voxel_x_.size());
+  const auto & points = pointcloud.points;
+
+  // count the points of each cluster, the roots are the first voxels of the clusters
+  cluster_sizes_.assign(num_voxels, 0);
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    if (voxel_of_point_[i] >= 0) {
+      ++cluster_sizes_[findRoot(voxel_of_point_[i])];
+    }
+  }
+  cluster_of_root_.assign(num_voxels, -1);
+  int num_clusters = 0;
+  for (int v = 0; v < num_voxels; ++v) {
+    if (
+      parents_[v] == v && min_cluster_size_ <= cluster_sizes_[v] &&
+      cluster_sizes_[v] <= max_cluster_size_) {
+      cluster_of_root_[v] = num_clusters++;
+    }
+  }
+
+  resizeClusters(clusters, num_clusters);
+  for (int c = 0; c < num_voxels; ++c) {
+    if (cluster_of_root_[c] >= 0) {
+      clusters.at(cluster_of_root_[c]).points.reserve(cluster_sizes_[c]);
+    }
+  }
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    if (voxel_of_point_[i] < 0) {
+      continue;
+    }
+    const int cluster = cluster_of_root_[findRoot(voxel_of_point_[i])];
+    if (cluster >= 0) {
+      clusters.at(cluster).points.push_back(points[i]);
+    }
+  }
+  for (auto & cluster : clusters) {
+    cluster.width = cluster.points.size();
+    cluster.height = 1;
+    cluster.is_dense = false;
+  }
+}
+
+void ClusterHierarchy::resizeClusters(std::vector<PointCloud> & clusters, const std::size_t size)
+{
+  // the clusters are swapped with the spare ones, so that their points keep their capacity
+  while (clusters.size() > size) {
+    spare_clusters_.emplace_back();
+    spare_clusters_.back().swap(clusters.back());
+    clusters.pop_back();
+  }
+  while (clusters.size() < size) {
+    clusters.emplace_back();
+    if (!spare_clusters_.empty()) {
+      clusters.back().swap(spare_clusters_.back());
+      spare_clusters_.pop_back();
+    }
+  }
+  for (auto & cluster : clusters) {
+    cluster.points.clear();
+  }
+}
+
+int ClusterHierarchy::findRoot(int voxel)
+{
+  // path halving
+  while (parents_[voxel] != voxel) {
+    parents_[voxel] = parents_[parents_[voxel]];
+    voxel = parents_[voxel];
+  }
+  return voxel;
+}
@@ -161,6 +161,8 @@ DetectionByTracker::DetectionByTracker(const rclcpp::NodeOptions & node_options)
     "~/output", rclcpp::QoS{1});
 
   ignore_unknown_tracker_ = declare_parameter<bool>("ignore_unknown_tracker", true);
+  use_multi_resolution_clustering_ =
+    declare_parameter<bool>("use_multi_resolution_clustering", false);
 
   // set maximum search setting for merger/divider
   setMaxSearchRange();
@@ -329,16 +331,37 @@ float DetectionByTracker::optimizeUnderSegmentedObject(
   pcl::PointCloud<pcl::PointXYZ>::Ptr pcl_cluster(new pcl::PointCloud<pcl::PointXYZ>);
   pcl::fromROSMsg(under_segmented_cluster, *pcl_cluster);
 
+  // cluster at the ranges of all the iterations at once, with the voxels of the last iteration
+  if (use_multi_resolution_clustering_) {
+    std::vector<float> cluster_ranges(iter_max_count);
+    float range = initial_cluster_range;
+    float last_voxel_size = initial_voxel_size;
+    for (int iter_count = 0; iter_count < iter_max_count; ++iter_count) {
+      cluster_ranges.at(iter_count) = range;
+      if (iter_count + 1 < iter_max_count) {
+        range *= iter_rate;
+        last_voxel_size *= iter_rate;
+      }
+    }
+    cluster_hierarchy_.build(*pcl_cluster, cluster_ranges, last_voxel_size);
+  }
+
   // iterate to find best fit divided object
   float highest_iou = 0.0;
   tier4_perception_msgs::msg::DetectedObjectWithFeature highest_iou_object;
+  std::vector<pcl::PointCloud<pcl::PointXYZ>> clusters_of_range;
   for (int iter_count = 0; iter_count < iter_max_count;
        ++iter_count, cluster_range *= iter_rate, voxel_size *= iter_rate) {
     // divide under segmented cluster
-    std::vector<pcl::PointCloud<pcl::PointXYZ>> divided_clusters;
-    cluster.setTolerance(cluster_range);
-    cluster.setVoxelLeafSize(voxel_size);
-    cluster.cluster(pcl_cluster, divided_clusters);
+    if (!use_multi_resolution_clustering_) {
+      clusters_of_range.clear();
+      cluster.setTolerance(cluster_range);
+      cluster.setVoxelLeafSize(voxel_size);
+      cluster.cluster(pcl_cluster, clusters_of_range);
+    }
+    const auto & divided_clusters = use_multi_resolution_clustering_
+                                      ? cluster_hierarchy_.getClusters(iter_count)
+                                      : clusters_of_range;
 
     // find highest iou object in divided clusters
     float highest_iou_in_current_iter = 0.0f;
@@ -32,22 +32,34 @@
 #include <pcl/pcl_base.h>
 #include <pcl/point_types.h>
 
+#include <cstdint>
 #include <filesystem>
 #include <memory>
 #include <string>
 #include <vector>
 
+// A cell of the point cloud map received by the sequential load. The elevation map of each cell is
+// cached as a tile, which is valid while the hash of the points of the cell is unchanged.
+struct PointCloudMapCell
+{
+  std::string cell_id;
+  uint64_t hash;
+  pcl::PointCloud<pcl::PointXYZ>::Ptr pointcloud;
+};
+
 class DataManager
 {
 public:
   DataManager() = default;
   bool isInitialized()
   {
+    const bool is_pointcloud_map_received =
+      static_cast<bool>(map_pcl_ptr_) || !pointcloud_map_cells_.empty();
     if (use_lane_filter_) {
-      return static_cast<bool>(elevation_map_path_) && static_cast<bool>(map_pcl_ptr_) &&
+      return static_cast<bool>(elevation_map_path_) && is_pointcloud_map_received &&
              static_cast<bool>(lanelet_map_ptr_);
     } else {
-      return static_cast<bool>(elevation_map_path_) && static_cast<bool>(map_pcl_ptr_);
+      return static_cast<bool>(elevation_map_path_) && is_pointcloud_map_received;
     }
   }
   std::unique_ptr<std::filesystem::path> elevation_map_path_;
@@ -55,6 +67,7 @@ public:
   lanelet::LaneletMapPtr lanelet_map_ptr_;
   bool use_lane_filter_ = false;
   std::vector<std::string> pointcloud_map_ids_;
+  std::vector<PointCloudMapCell> pointcloud_map_cells_;
 };
 
 class ElevationMapLoaderNode : public rclcpp::Node
@@ -80,16 +93,17 @@ private:
   void onPointCloudMapMetaData(
     const autoware_map_msgs::msg::PointCloudMapMetaData pointcloud_map_metadata);
   void receiveMap();
-  void concatenatePointCloudMaps(
-    sensor_msgs::msg::PointCloud2 & pointcloud_map,
-    const std::vector<autoware_map_msgs::msg::PointCloudMapCellWithID> & new_pointcloud_with_ids)
-    const;
+  void addPointCloudMapCells(
+    const std::vector<autoware_map_msgs::msg::PointCloudMapCellWithID> & new_pointcloud_with_ids);
   std::vector<std::string> getRequestIDs(const unsigned int map_id_counter) const;
   void publish();
   void createElevationMap();
   void setVerbosityLevelToDebugIfFlagSet();
   void createElevationMapFromPointcloud(
     const pcl::shared_ptr<grid_map::GridMapPclLoader> & grid_map_pcl_loader);
+  void createElevationMapFromTiles();
+  grid_map::GridMap createElevationMapTile(
+    const pcl::PointCloud<pcl::PointXYZ>::Ptr & pointcloud) const;
   void inpaintElevationMap(const float radius);
   pcl::PointCloud<pcl::PointXYZ>::Ptr createPointcloudFromElevationMap();
   void saveElevationMap();
@@ -101,6 +115,7 @@ private:
   bool use_inpaint_;
   float inpaint_radius_;
   unsigned int sequential_map_load_num_;
+  unsigned int num_tile_processing_threads_;
   bool use_elevation_map_cloud_publisher_;
   std::string param_file_path_;
   bool is_map_metadata_received_ = false;
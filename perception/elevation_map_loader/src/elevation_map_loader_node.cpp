@@ -38,9 +38,17 @@
 #include <pcl_conversions/pcl_conversions.h>
 #include <sensor_msgs/msg/point_cloud2.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cinttypes>
+#include <cstdio>
 #include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <limits>
 #include <memory>
 #include <string>
+#include <thread>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -55,6 +63,26 @@
 #include <rosbag2_storage_default_plugins/sqlite/sqlite_statement_wrapper.hpp>
 #endif
 
+namespace
+{
+// FNV-1a hash, which is enough to detect the changes of the map files
+uint64_t calcHash(const char * data, const size_t size, uint64_t hash = 14695981039346656037ULL)
+{
+  for (size_t i = 0; i < size; ++i) {
+    hash ^= static_cast<uint8_t>(data[i]);
+    hash *= 1099511628211ULL;
+  }
+  return hash;
+}
+
+std::string toHexString(const uint64_t value)
+{
+  char buffer[17];
+  std::snprintf(buffer, sizeof(buffer), "%016" PRIx64, value);
+  return buffer;
+}
+}  // namespace
+
 ElevationMapLoaderNode::ElevationMapLoaderNode(const rclcpp::NodeOptions & options)
 : Node("elevation_map_loader", options)
 {
@@ -68,6 +96,10 @@ ElevationMapLoaderNode::ElevationMapLoaderNode(const rclcpp::NodeOptions & optio
   } else {
     throw std::runtime_error("sequential_map_load_num should be larger than 0.");
   }
+  const int num_tile_processing_threads =
+    this->declare_parameter<int>("num_tile_processing_threads", 4);
+  num_tile_processing_threads_ =
+    static_cast<unsigned int>(std::max(num_tile_processing_threads, 1));
   use_inpaint_ = this->declare_parameter("use_inpaint", true);
   inpaint_radius_ = this->declare_parameter("inpaint_radius", 0.3);
   use_elevation_map_cloud_publisher_ =
@@ -252,7 +284,6 @@ void ElevationMapLoaderNode::onVectorMap(
 
 void ElevationMapLoaderNode::receiveMap()
 {
-  sensor_msgs::msg::PointCloud2 pointcloud_map;
   // create a loading request with mode = 1
   auto request = std::make_shared<autoware_map_msgs::srv::GetSelectedPointCloudMap::Request>();
   if (!pcd_loader_client_->service_is_ready()) {
@@ -282,30 +313,23 @@ void ElevationMapLoaderNode::receiveMap()
       status = result.wait_for(std::chrono::seconds(1));
     }
 
-    // concatenate maps
-    concatenatePointCloudMaps(pointcloud_map, result.get()->new_pointcloud_with_ids);
+    // keep the maps for each cell
+    addPointCloudMapCells(result.get()->new_pointcloud_with_ids);
   }
   RCLCPP_DEBUG(this->get_logger(), "finish receiving");
-  pcl::PointCloud<pcl::PointXYZ> map_pcl;
-  pcl::fromROSMsg<pcl::PointXYZ>(pointcloud_map, map_pcl);
-  data_manager_.map_pcl_ptr_ = pcl::make_shared<pcl::PointCloud<pcl::PointXYZ>>(map_pcl);
 }
 
-void ElevationMapLoaderNode::concatenatePointCloudMaps(
-  sensor_msgs::msg::PointCloud2 & pointcloud_map,
+void ElevationMapLoaderNode::addPointCloudMapCells(
   const std::vector<autoware_map_msgs::msg::PointCloudMapCellWithID> & new_pointcloud_with_ids)
-  const
 {
   for (const auto & new_pointcloud_with_id : new_pointcloud_with_ids) {
-    if (pointcloud_map.width == 0) {
-      pointcloud_map = new_pointcloud_with_id.pointcloud;
-    } else {
-      pointcloud_map.width += new_pointcloud_with_id.pointcloud.width;
-      pointcloud_map.row_step += new_pointcloud_with_id.pointcloud.row_step;
-      pointcloud_map.data.insert(
-        pointcloud_map.data.end(), new_pointcloud_with_id.pointcloud.data.begin(),
-        new_pointcloud_with_id.pointcloud.data.end());
-    }
+    const auto & data = new_pointcloud_with_id.pointcloud.data;
+    PointCloudMapCell cell;
+    cell.cell_id = new_pointcloud_with_id.cell_id;
+    cell.hash = calcHash(reinterpret_cast<const char *>(data.data()), data.size());
+    cell.pointcloud = pcl::make_shared<pcl::PointCloud<pcl::PointXYZ>>();
+    pcl::fromROSMsg<pcl::PointXYZ>(new_pointcloud_with_id.pointcloud, *cell.pointcloud);
+    data_manager_.pointcloud_map_cells_.push_back(std::move(cell));
   }
 }
 
@@ -326,7 +350,9 @@ void ElevationMapLoaderNode::createElevationMap()
 {
   auto grid_map_logger = rclcpp::get_logger("grid_map_logger");
   grid_map_logger.set_level(rclcpp::Logger::Level::Error);
-  {
+  if (!data_manager_.pointcloud_map_cells_.empty()) {
+    createElevationMapFromTiles();
+  } else {
     pcl::shared_ptr<grid_map::GridMapPclLoader> grid_map_pcl_loader =
       pcl::make_shared<grid_map::GridMapPclLoader>(grid_map_logger);
     grid_map_pcl_loader->loadParameters(param_file_path_);
@@ -351,6 +377,140 @@ void ElevationMapLoaderNode::createElevationMapFromPointcloud(
     start, "Finish creating elevation map. Total time: ", this->get_logger());
 }
 
+void ElevationMapLoaderNode::createElevationMapFromTiles()
+{
+  const auto start = std::chrono::high_resolution_clock::now();
+  const auto & cells = data_manager_.pointcloud_map_cells_;
+
+  // the tiles depend on the grid map parameters as well as the points
+  std::string params;
+  {
+    std::ifstream params_file(param_file_path_);
+    params.assign(std::istreambuf_iterator<char>(params_file), std::istreambuf_iterator<char>());
+  }
+  const std::string tile_name = toHexString(calcHash(params.data(), params.size()));
+
+  // load the cached tiles of the cells whose points are unchanged
+  std::vector<grid_map::GridMap> tiles(cells.size());
+  std::vector<std::filesystem::path> tile_paths;
+  std::vector<size_t> missing_tile_indices;
+  for (size_t i = 0; i < cells.size(); ++i) {
+    auto cell_id = cells.at(i).cell_id;
+    std::replace(cell_id.begin(), cell_id.end(), '/', '_');
+    tile_paths.push_back(
+      std::filesystem::path(elevation_map_directory_) / "tiles" / cell_id /
+      (toHexString(cells.at(i).hash) + "_" + tile_name));
+    if (cells.at(i).pointcloud->empty()) {
+      continue;
+    }
+    bool is_tile_loaded = false;
+    if (std::filesystem::is_directory(tile_paths.back())) {
+      try {
+        is_tile_loaded = grid_map::GridMapRosConverter::loadFromBag(
+          tile_paths.back(), "elevation_map", tiles.at(i));
+      } catch (const std::runtime_error & e) {
+        RCLCPP_ERROR(this->get_logger(), e.what());
+      }
+    }
+    if (!is_tile_loaded) {
+      missing_tile_indices.push_back(i);
+    }
+  }
+  RCLCPP_INFO(
+    this->get_logger(), "Create %lu of %lu elevation map tiles", missing_tile_indices.size(),
+    cells.size());
+
+  // create the other tiles in parallel
+  {
+    std::atomic<size_t> next_index{0};
+    const auto create_tiles = [&]() {
+      for (size_t i = next_index++; i < missing_tile_indices.size(); i = next_index++) {
+        const auto tile_index = missing_tile_indices.at(i);
+        tiles.at(tile_index) = createElevationMapTile(cells.at(tile_index).pointcloud);
+      }
+    };
+    std::vector<std::thread> threads;
+    const size_t num_threads =
+      std::min<size_t>(num_tile_processing_threads_, missing_tile_indices.size());
+    for (size_t i = 0; i < num_threads; ++i) {
+      threads.emplace_back(create_tiles);
+    }
+    for (auto & thread : threads) {
+      thread.join();
+    }
+  }
+
+  // replace the outdated tiles of the cells with the new ones
+  for (const auto tile_index : missing_tile_indices) {
+    const auto & tile_path = tile_paths.at(tile_index);
+    std::error_code error_code;
+    std::filesystem::remove_all(tile_path.parent_path(), error_code);
+    std::filesystem::create_directories(tile_path.parent_path(), error_code);
+    if (!grid_map::GridMapRosConverter::saveToBag(
+          tiles.at(tile_index), tile_path, "elevation_map")) {
+      RCLCPP_WARN(this->get_logger(), "Failed to save elevation map tile: %s", tile_path.c_str());
+    }
+  }
+
+  // merge the tiles into an elevation map covering all of them
+  double min_x = std::numeric_limits<double>::max();
+  double min_y = std::numeric_limits<double>::max();
+  double max_x = std::numeric_limits<double>::lowest();
+  double max_y = std::numeric_limits<double>::lowest();
+  double resolution = 0.0;
+  for (const auto & tile : tiles) {
+    if (!tile.exists(layer_name_)) {
+      continue;
+    }
+    const auto & position = tile.getPosition();
+    const auto & length = tile.getLength();
+    min_x = std::min(min_x, position.x() - 0.5 * length.x());
+    min_y = std::min(min_y, position.y() - 0.5 * length.y());
+    max_x = std::max(max_x, position.x() + 0.5 * length.x());
+    max_y = std::max(max_y, position.y() + 0.5 * length.y());
+    resolution = tile.getResolution();
+  }
+  if (resolution <= 0.0) {
+    RCLCPP_ERROR(this->get_logger(), "No elevation map tile is created");
+    return;
+  }
+  elevation_map_ = grid_map::GridMap(std::vector<std::string>{layer_name_});
+  elevation_map_.setGeometry(
+    grid_map::Length(max_x - min_x, max_y - min_y), resolution,
+    grid_map::Position(0.5 * (min_x + max_x), 0.5 * (min_y + max_y)));
+  for (const auto & tile : tiles) {
+    if (!tile.exists(layer_name_)) {
+      continue;
+    }
+    for (grid_map::GridMapIterator iterator(tile); !iterator.isPastEnd(); ++iterator) {
+      if (!tile.isValid(*iterator, layer_name_)) {
+        continue;
+      }
+      grid_map::Position position;
+      grid_map::Index index;
+      tile.getPosition(*iterator, position);
+      if (elevation_map_.getIndex(position, index)) {
+        elevation_map_.at(layer_name_, index) = tile.at(layer_name_, *iterator);
+      }
+    }
+  }
+  grid_map::grid_map_pcl::printTimeElapsedToRosInfoStream(
+    start, "Finish creating elevation map. Total time: ", this->get_logger());
+}
+
+grid_map::GridMap ElevationMapLoaderNode::createElevationMapTile(
+  const pcl::PointCloud<pcl::PointXYZ>::Ptr & pointcloud) const
+{
+  pcl::shared_ptr<grid_map::GridMapPclLoader> grid_map_pcl_loader =
+    pcl::make_shared<grid_map::GridMapPclLoader>(rclcpp::get_logger("grid_map_logger"));
+  grid_map_pcl_loader->loadParameters(param_file_path_);
+  grid_map_pcl_loader->setInputCloud(pointcloud);
+  grid_map_pcl_loader->preProcessInputCloud();
+  grid_map_pcl_loader->initializeGridMapGeometryFromInputCloud();
+  grid_map_pcl_loader->addLayerFromInputCloud(layer_name_);
+  return grid_map_pcl_loader->getGridMap();
+}
+
 void ElevationMapLoaderNode::inpaintElevationMap(const float radius)
 {
   // Convert elevation layer to OpenCV image to fill in holes.
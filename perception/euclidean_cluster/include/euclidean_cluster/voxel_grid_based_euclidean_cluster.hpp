@@ -41,12 +41,27 @@ public:
   {
     min_points_number_per_voxel_ = min_points_number_per_voxel;
   }
+  /** \brief Cluster the voxels with a parallel union-find, not pcl::EuclideanClusterExtraction */
+  void setUseUnionFindEngine(bool use_union_find_engine)
+  {
+    use_union_find_engine_ = use_union_find_engine;
+  }
+  void setNumThreads(int num_threads) { num_threads_ = num_threads; }
 
 private:
+  bool clusterUnionFind(
+    const pcl::PointCloud<pcl::PointXYZ>::ConstPtr & pointcloud,
+    std::vector<pcl::PointCloud<pcl::PointXYZ>> & clusters);
+  void appendClusters(
+    const std::vector<pcl::PointCloud<pcl::PointXYZ>> & temporary_clusters,
+    std::vector<pcl::PointCloud<pcl::PointXYZ>> & clusters) const;
+
   pcl::VoxelGrid<pcl::PointXYZ> voxel_grid_;
   float tolerance_;
   float voxel_leaf_size_;
   int min_points_number_per_voxel_;
+  bool use_union_find_engine_ = false;
+  int num_threads_ = 1;
 };
 
 }  // namespace euclidean_cluster
@@ -17,7 +17,73 @@
 #include <pcl/kdtree/kdtree.h>
 #include <pcl/segmentation/extract_clusters.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cmath>
+#include <cstdint>
 #include <unordered_map>
+#include <utility>
+
+namespace
+{
+// The voxels are pressed 2d, the z leaf size covers the whole pointcloud
+constexpr float VOXEL_LEAF_SIZE_Z = 100000.0f;
+
+constexpr std::int64_t KEY_BITS = 21;
+constexpr std::int64_t KEY_BIAS = 1 << (KEY_BITS - 1);
+constexpr std::uint64_t KEY_MASK = (1ULL << KEY_BITS) - 1;
+
+// Keys ordered as the voxel indices of pcl::VoxelGrid: by z, then y, then x
+std::uint64_t voxelKey(const std::int64_t i, const std::int64_t j, const std::int64_t k)
+{
+  return ((static_cast<std::uint64_t>(k + KEY_BIAS) & KEY_MASK) << (2 * KEY_BITS)) |
+         ((static_cast<std::uint64_t>(j + KEY_BIAS) & KEY_MASK) << KEY_BITS) |
+         (static_cast<std::uint64_t>(i + KEY_BIAS) & KEY_MASK);
+}
+
+using KeyIndex = std::pair<std::uint64_t, int>;
+
+bool compareKey(const KeyIndex & a, const std::uint64_t key)
+{
+  return a.first < key;
+}
+
+// Path halving. A parent only moves toward its root, so a failed exchange is harmless.
+int findRoot(std::vector<std::atomic<int>> & parents, int x)
+{
+  while (true) {
+    int parent = parents[x].load(std::memory_order_relaxed);
+    if (parent == x) {
+      return x;
+    }
+    const int grandparent = parents[parent].load(std::memory_order_relaxed);
+    if (parent != grandparent) {
+      parents[x].compare_exchange_weak(parent, grandparent, std::memory_order_relaxed);
+    }
+    x = grandparent;
+  }
+}
+
+// The larger root is linked to the smaller one, so the root of a component is its first voxel,
+// as the seed of pcl::EuclideanClusterExtraction.
+void unite(std::vector<std::atomic<int>> & parents, int a, int b)
+{
+  while (true) {
+    a = findRoot(parents, a);
+    b = findRoot(parents, b);
+    if (a == b) {
+      return;
+    }
+    if (a < b) {
+      std::swap(a, b);
+    }
+    int expected = a;
+    if (parents[a].compare_exchange_strong(expected, b, std::memory_order_relaxed)) {
+      return;
+    }
+  }
+}
+}  // namespace
 
 namespace euclidean_cluster
 {
@@ -47,9 +113,13 @@ bool VoxelGridBasedEuclideanCluster::cluster(
 {
   // TODO(Saito) implement use_height is false version
 
+  if (use_union_find_engine_) {
+    return clusterUnionFind(pointcloud, clusters);
+  }
+
   // create voxel
   pcl::PointCloud<pcl::PointXYZ>::Ptr voxel_map_ptr(new pcl::PointCloud<pcl::PointXYZ>);
-  voxel_grid_.setLeafSize(voxel_leaf_size_, voxel_leaf_size_, 100000.0);
+  voxel_grid_.setLeafSize(voxel_leaf_size_, voxel_leaf_size_, VOXEL_LEAF_SIZE_Z);
   voxel_grid_.setMinimumPointsNumberPerVoxel(min_points_number_per_voxel_);
   voxel_grid_.setInputCloud(pointcloud);
   voxel_grid_.setSaveLeafLayout(true);
@@ -100,20 +170,153 @@ bool VoxelGridBasedEuclideanCluster::cluster(
   }
 
   // build output and check cluster size
-  {
-    for (const auto & cluster : temporary_clusters) {
-      if (!(min_cluster_size_ <= static_cast<int>(cluster.points.size()) &&
-            static_cast<int>(cluster.points.size()) <= max_cluster_size_)) {
-        continue;
+  appendClusters(temporary_clusters, clusters);
+
+  return true;
+}
+
+bool VoxelGridBasedEuclideanCluster::clusterUnionFind(
+  const pcl::PointCloud<pcl::PointXYZ>::ConstPtr & pointcloud,
+  std::vector<pcl::PointCloud<pcl::PointXYZ>> & clusters)
+{
+  // create voxel: same grid coordinates and voxel order as pcl::VoxelGrid
+  const float inverse_leaf_size = 1.0f / voxel_leaf_size_;
+  const float inverse_leaf_size_z = 1.0f / VOXEL_LEAF_SIZE_Z;
+  const auto & points = pointcloud->points;
+  std::vector<KeyIndex> point_keys;
+  point_keys.reserve(points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    const auto & point = points[i];
+    if (!std::isfinite(point.x) || !std::isfinite(point.y) || !std::isfinite(point.z)) {
+      continue;
+    }
+    point_keys.emplace_back(
+      voxelKey(
+        static_cast<std::int64_t>(std::floor(point.x * inverse_leaf_size)),
+        static_cast<std::int64_t>(std::floor(point.y * inverse_leaf_size)),
+        static_cast<std::int64_t>(std::floor(point.z * inverse_leaf_size_z))),
+      static_cast<int>(i));
+  }
+  std::sort(point_keys.begin(), point_keys.end());
+
+  // voxel is pressed 2d, only x and y of the centroids are kept
+  std::vector<int> voxel_index_of_point(points.size(), -1);
+  std::vector<float> voxel_x;
+  std::vector<float> voxel_y;
+  for (size_t begin = 0, end = 0; begin < point_keys.size(); begin = end) {
+    float sum_x = 0.0f;
+    float sum_y = 0.0f;
+    for (end = begin; end < point_keys.size() && point_keys[end].first == point_keys[begin].first;
+         ++end) {
+      sum_x += points[point_keys[end].second].x;
+      sum_y += points[point_keys[end].second].y;
+    }
+    const int num_voxel_points = static_cast<int>(end - begin);
+    if (num_voxel_points < min_points_number_per_voxel_) {
+      continue;
+    }
+    for (size_t i = begin; i < end; ++i) {
+      voxel_index_of_point[point_keys[i].second] = static_cast<int>(voxel_x.size());
+    }
+    voxel_x.push_back(sum_x / static_cast<float>(num_voxel_points));
+    voxel_y.push_back(sum_y / static_cast<float>(num_voxel_points));
+  }
+  const int num_voxels = static_cast<int>(voxel_x.size());
+
+  // hash the centroids on a grid of the tolerance, so that the neighbors are in the 3x3 cells
+  std::vector<std::atomic<int>> parents(num_voxels);
+  for (int v = 0; v < num_voxels; ++v) {
+    parents[v].store(v, std::memory_order_relaxed);
+  }
+  if (tolerance_ > 0.0f) {
+    const double inverse_tolerance = 1.0 / tolerance_;
+    const float sqr_tolerance = tolerance_ * tolerance_;
+    const auto cell_coordinate = [inverse_tolerance](const float value) {
+      return static_cast<std::int64_t>(std::floor(value * inverse_tolerance));
+    };
+    std::vector<KeyIndex> cell_keys(num_voxels);
+    for (int v = 0; v < num_voxels; ++v) {
+      cell_keys[v] = {voxelKey(cell_coordinate(voxel_x[v]), cell_coordinate(voxel_y[v]), 0), v};
+    }
+    std::sort(cell_keys.begin(), cell_keys.end());
+
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic, 256)
+#endif
+    for (int v = 0; v < num_voxels; ++v) {
+      const std::int64_t cell_x = cell_coordinate(voxel_x[v]);
+      const std::int64_t cell_y = cell_coordinate(voxel_y[v]);
+      for (std::int64_t dy = -1; dy <= 1; ++dy) {
+        for (std::int64_t dx = -1; dx <= 1; ++dx) {
+          const std::uint64_t key = voxelKey(cell_x + dx, cell_y + dy, 0);
+          for (auto it = std::lower_bound(cell_keys.begin(), cell_keys.end(), key, compareKey);
+               it != cell_keys.end() && it->first == key; ++it) {
+            const int w = it->second;
+            if (w <= v) {
+              continue;
+            }
+            // same strict comparison as the radius search of pcl::KdTreeFLANN
+            const float dist_x = voxel_x[w] - voxel_x[v];
+            const float dist_y = voxel_y[w] - voxel_y[v];
+            if (dist_x * dist_x + dist_y * dist_y < sqr_tolerance) {
+              unite(parents, v, w);
+            }
+          }
+        }
       }
-      clusters.push_back(cluster);
-      clusters.back().width = cluster.points.size();
-      clusters.back().height = 1;
-      clusters.back().is_dense = false;
     }
   }
 
+  // clustering: a cluster of more than max_cluster_size_ voxels is dropped, as in
+  // pcl::EuclideanClusterExtraction, and the clusters are ordered by their first voxel
+  std::vector<int> roots(num_voxels);
+  std::vector<int> num_cluster_voxels(num_voxels, 0);
+  for (int v = 0; v < num_voxels; ++v) {
+    roots[v] = findRoot(parents, v);
+    ++num_cluster_voxels[roots[v]];
+  }
+  std::vector<int> cluster_index_of_root(num_voxels, -1);
+  int num_clusters = 0;
+  for (int v = 0; v < num_voxels; ++v) {
+    if (roots[v] == v && num_cluster_voxels[v] <= max_cluster_size_) {
+      cluster_index_of_root[v] = num_clusters++;
+    }
+  }
+
+  // create vector of point cloud cluster with a single pass over the points
+  std::vector<pcl::PointCloud<pcl::PointXYZ>> temporary_clusters(num_clusters);
+  for (size_t i = 0; i < points.size(); ++i) {
+    const int voxel_index = voxel_index_of_point[i];
+    if (voxel_index < 0) {
+      continue;
+    }
+    const int cluster_index = cluster_index_of_root[roots[voxel_index]];
+    if (cluster_index < 0) {
+      continue;
+    }
+    temporary_clusters.at(cluster_index).points.push_back(points[i]);
+  }
+
+  // build output and check cluster size
+  appendClusters(temporary_clusters, clusters);
+
   return true;
 }
 
+void VoxelGridBasedEuclideanCluster::appendClusters(
+  const std::vector<pcl::PointCloud<pcl::PointXYZ>> & temporary_clusters,
+  std::vector<pcl::PointCloud<pcl::PointXYZ>> & clusters) const
+{
+  for (const auto & cluster : temporary_clusters) {
+    if (!(min_cluster_size_ <= static_cast<int>(cluster.points.size()) &&
+          static_cast<int>(cluster.points.size()) <= max_cluster_size_)) {
+      continue;
+    }
+    clusters.push_back(cluster);
+    clusters.back().width = cluster.points.size();
+    clusters.back().height = 1;
+    clusters.back().is_dense = false;
+  }
+}
+
 }  // namespace euclidean_cluster
@@ -0,0 +1,108 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef GROUND_SEGMENTATION__CUDA_SCAN_GROUND_FILTER_HPP_
+#define GROUND_SEGMENTATION__CUDA_SCAN_GROUND_FILTER_HPP_
+
+#include <cuda_utils/cuda_unique_ptr.hpp>
+#include <cuda_utils/stream_unique_ptr.hpp>
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <cuda_runtime_api.h>
+
+#include <cstdint>
+#include <vector>
+
+namespace ground_segmentation
+{
+/** \brief Parameters of the elevation grid mode of ScanGroundFilterComponent. */
+struct CudaScanGroundFilterParam
+{
+  float front_wheel_center_x;  // x of the center of the radial divisions
+  float virtual_lidar_z;
+  float radial_divider_angle_rad;
+  std::uint32_t radial_dividers_num;
+  float grid_size_m;
+  float grid_size_rad;
+  float grid_mode_switch_radius;
+  float grid_mode_switch_grid_id;
+  float grid_mode_switch_angle_rad;
+  float global_slope_max_angle_rad;
+  float local_slope_max_angle_rad;
+  float non_ground_height_threshold;
+  float low_priority_region_x;
+  float detection_range_z_max;
+  float split_points_distance_tolerance;
+  std::uint16_t gnd_grid_buffer_size;
+  bool use_recheck_ground_cluster;
+};
+
+/**
+ * Elevation grid mode of the scan ground filter on the GPU.
+ * The points are sorted by radial division and radius on the device, then each radial division is
+ * walked by its own thread with the same algorithm as
+ * ScanGroundFilterComponent::classifyPointCloudGridScan. The non-ground flags are finally
+ * compacted into a list of point indices with a prefix scan. The list stays on the device, so that
+ * a consumer also running on the GPU can use it through classify_on_device() without a copy to the
+ * host.
+ */
+class CudaScanGroundFilter
+{
+public:
+  /** \brief Maximum gnd_grid_buffer_size, the ground grids of a division are thread local */
+  static constexpr std::uint16_t MAX_GND_GRID_BUFFER_SIZE = 15;
+
+  /** \brief Indices of the non-ground points in the input, ascending, in device memory. */
+  struct DeviceIndices
+  {
+    const std::int32_t * data;
+    std::size_t size;
+    /** \brief The stream the indices are computed on. Synchronize or wait on it before use. */
+    cudaStream_t stream;
+  };
+
+  CudaScanGroundFilter();
+  void set_param(const CudaScanGroundFilterParam & param) { param_ = param; }
+
+  /** \brief Classify `input` and copy the indices of its non-ground points to the host. */
+  void classify(
+    const sensor_msgs::msg::PointCloud2 & input, std::vector<int> & out_no_ground_indices);
+
+  /** \brief Classify `input`, keeping the non-ground indices on the device.
+   * The returned buffer is valid until the next call to classify() or classify_on_device(). */
+  DeviceIndices classify_on_device(const sensor_msgs::msg::PointCloud2 & input);
+
+private:
+  void reserve(std::size_t num_points, std::size_t point_step);
+
+  CudaScanGroundFilterParam param_{};
+
+  cuda_utils::StreamUniquePtr stream_;
+  std::size_t capacity_points_{0};
+  std::size_t capacity_bytes_{0};
+  std::size_t capacity_divisions_{0};
+  cuda_utils::CudaUniquePtr<std::uint8_t[]> d_raw_points_;
+  cuda_utils::CudaUniquePtr<std::uint64_t[]> d_keys_;
+  cuda_utils::CudaUniquePtr<std::uint32_t[]> d_order_;
+  cuda_utils::CudaUniquePtr<float4[]> d_sorted_points_;
+  cuda_utils::CudaUniquePtr<std::uint32_t[]> d_div_begin_;
+  cuda_utils::CudaUniquePtr<std::uint32_t[]> d_cluster_members_;
+  cuda_utils::CudaUniquePtr<std::uint8_t[]> d_no_ground_flags_;
+  cuda_utils::CudaUniquePtr<std::int32_t[]> d_no_ground_indices_;
+};
+
+}  // namespace ground_segmentation
+
+#endif  // GROUND_SEGMENTATION__CUDA_SCAN_GROUND_FILTER_HPP_
@@ -44,6 +44,8 @@ namespace ground_segmentation
 {
 using vehicle_info_util::VehicleInfo;
 
+class CudaScanGroundFilter;
+
 class ScanGroundFilterComponent : public pointcloud_preprocessor::Filter
 {
 private:
@@ -138,12 +140,51 @@ private:
 
     float getMaxHeight() { return height_max; }
 
-    float getMinHeight() { return height_min; }
+    float getMinHeight() const { return height_min; }
 
     uint16_t getGridId() { return grid_id; }
 
-    pcl::PointIndices getIndices() { return pcl_indices; }
-    std::vector<float> getHeightList() { return height_list; }
+    const pcl::PointIndices & getIndices() const { return pcl_indices; }
+    const std::vector<float> & getHeightList() const { return height_list; }
+  };
+
+  /**
+   * Points of the elevation grid mode as structure of arrays, for the polar grid engine.
+   * The points are ordered by radial division, then by radius within each division, with a
+   * counting sort. All the buffers are kept between frames, so that they only grow.
+   */
+  struct PolarGrid
+  {
+    // in the order of the input cloud
+    std::vector<uint32_t> input_radial_div;
+    std::vector<uint16_t> input_grid_id;
+    std::vector<float> input_radius;
+    std::vector<float> input_grid_size;
+
+    // first point of each radial division, radial_dividers_num_ + 1 elements
+    std::vector<uint32_t> div_begin;
+    std::vector<uint32_t> div_cursor;
+    // input indices, ordered by radial division and then by grid_id
+    std::vector<uint32_t> div_order;
+    std::vector<uint32_t> grid_order;
+
+    // in the order of radial division and radius
+    std::vector<float> x;
+    std::vector<float> y;
+    std::vector<float> z;
+    std::vector<float> radius;
+    std::vector<float> grid_size;
+    std::vector<uint16_t> grid_id;
+    std::vector<uint32_t> orig_index;
+    std::vector<PointLabel> point_state;
+  };
+
+  // Per thread buffers of the polar grid engine
+  struct PolarGridWorkspace
+  {
+    std::vector<uint32_t> grid_counts;
+    std::vector<GridCenter> gnd_grids;
+    PointsCentroid ground_cluster;
   };
 
   void filter(
@@ -173,9 +214,18 @@ private:
     split_height_distance_;                 // useful for close points
   bool use_virtual_ground_point_;
   bool use_recheck_ground_cluster_;  // to enable recheck ground cluster
+  bool use_polar_grid_engine_;       // SoA engine for elevation_grid_mode
+  int num_threads_;                  // threads of the polar grid engine
+  bool use_cuda_;                    // GPU implementation of elevation_grid_mode
   size_t radial_dividers_num_;
   VehicleInfo vehicle_info_;
 
+  PolarGrid polar_grid_;
+  std::vector<PolarGridWorkspace> polar_grid_workspaces_;
+  std::vector<pcl::PointIndices> div_no_ground_indices_;
+  // Only set when the package is built with CUDA
+  std::shared_ptr<CudaScanGroundFilter> cuda_scan_ground_filter_;
+
   /*!
    * Output transformed PointCloud from in_cloud_ptr->header.frame_id to in_target_frame
    * @param[in] in_target_frame Coordinate system to perform transform
@@ -197,6 +247,12 @@ private:
   void convertPointcloudGridScan(
     const pcl::PointCloud<pcl::PointXYZ>::Ptr in_cloud,
     std::vector<PointCloudRefVector> & out_radial_ordered_points_manager);
+  /*!
+   * Compute the radius, angle, radial division and grid of a point for the elevation grid mode
+   * @param[in] point Input point
+   * @param[out] ref Point reference to fill, except for its state and origin
+   */
+  void calcGridScanCoordinates(const pcl::PointXYZ & point, PointRef & ref) const;
   /*!
    * Output ground center of front wheels as the virtual ground point
    * @param[out] point Virtual ground origin point
@@ -214,15 +270,44 @@ private:
   void initializeFirstGndGrids(
     const float h, const float r, const uint16_t id, std::vector<GridCenter> & gnd_grids);
 
-  void checkContinuousGndGrid(PointRef & p, const std::vector<GridCenter> & gnd_grids_list);
-  void checkDiscontinuousGndGrid(PointRef & p, const std::vector<GridCenter> & gnd_grids_list);
-  void checkBreakGndGrid(PointRef & p, const std::vector<GridCenter> & gnd_grids_list);
+  void checkContinuousGndGrid(
+    const float radius, const float z, PointLabel & point_state,
+    const std::vector<GridCenter> & gnd_grids_list) const;
+  void checkDiscontinuousGndGrid(
+    const float radius, const float z, PointLabel & point_state,
+    const std::vector<GridCenter> & gnd_grids_list) const;
+  void checkBreakGndGrid(
+    const float radius, const float z, PointLabel & point_state,
+    const std::vector<GridCenter> & gnd_grids_list) const;
   void classifyPointCloud(
     std::vector<PointCloudRefVector> & in_radial_ordered_clouds,
     pcl::PointIndices & out_no_ground_indices);
   void classifyPointCloudGridScan(
     std::vector<PointCloudRefVector> & in_radial_ordered_clouds,
     pcl::PointIndices & out_no_ground_indices);
+  /*!
+   * Same classification as convertPointcloudGridScan and classifyPointCloudGridScan, on the
+   * polar grid. The radial divisions are sorted and classified in parallel.
+   * @param in_cloud Input Point Cloud
+   * @param out_no_ground_indices Returns the indices of the points
+   *     classified as not ground in the original PointCloud
+   */
+  void classifyPointCloudPolarGrid(
+    const pcl::PointCloud<pcl::PointXYZ>::Ptr in_cloud, pcl::PointIndices & out_no_ground_indices);
+  /*!
+   * Orders the points of the polar grid in [begin, end), which belong to one radial division,
+   * by radius
+   */
+  void sortPolarGridDivision(
+    const size_t begin, const size_t end, const uint16_t max_grid_id,
+    const pcl::PointCloud<pcl::PointXYZ> & in_cloud, PolarGridWorkspace & workspace);
+  /*!
+   * Classifies the sorted points of the polar grid in [begin, end), which belong to one radial
+   * division
+   */
+  void classifyPolarGridDivision(
+    const size_t begin, const size_t end, PolarGridWorkspace & workspace,
+    pcl::PointIndices & out_no_ground_indices);
   /*!
    * Re-classifies point of ground cluster based on their height
    * @param gnd_cluster Input ground cluster for re-checking
@@ -230,8 +315,8 @@ private:
    * @param non_ground_indices Output non-ground PointCloud indices
    */
   void recheckGroundCluster(
-    PointsCentroid & gnd_cluster, const float non_ground_threshold,
-    pcl::PointIndices & non_ground_indices);
+    const PointsCentroid & gnd_cluster, const float non_ground_threshold,
+    pcl::PointIndices & non_ground_indices) const;
   /*!
    * Returns the resulting complementary PointCloud, one with the points kept
    * and the other removed as indicated in the indices
@@ -0,0 +1,519 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "ground_segmentation/cuda_scan_ground_filter.hpp"
+
+#include <cuda_utils/cuda_check_error.hpp>
+
+#include <thrust/copy.h>
+#include <thrust/device_ptr.h>
+#include <thrust/execution_policy.h>
+#include <thrust/functional.h>
+#include <thrust/iterator/counting_iterator.h>
+#include <thrust/sort.h>
+
+#include <cstring>
+#include <limits>
+
+namespace
+{
+using ground_segmentation::CudaScanGroundFilter;
+using ground_segmentation::CudaScanGroundFilterParam;
+
+constexpr std::size_t THREADS_PER_BLOCK = 256;
+constexpr std::size_t DIVISIONS_PER_BLOCK = 64;
+constexpr std::uint64_t INVALID_KEY = std::numeric_limits<std::uint64_t>::max();
+constexpr std::uint16_t GND_GRID_CONTINUAL_THRESH = 3;
+constexpr float PI = static_cast<float>(M_PI);
+
+std::size_t divup(const std::size_t a, const std::size_t b)
+{
+  return (a + b - 1) / b;
+}
+
+struct NonZero
+{
+  __host__ __device__ bool operator()(const std::uint8_t flag) const { return flag != 0; }
+};
+
+// same as tier4_autoware_utils::normalizeRadian and normalizeDegree, with min = 0
+__device__ float normalizePositive(const float value, const float period)
+{
+  const float remainder = fmodf(value, period);
+  return remainder < 0.0f ? remainder + period : remainder;
+}
+
+__device__ void calcGrid(
+  const float radius, const CudaScanGroundFilterParam & param, std::uint16_t & grid_id,
+  float & grid_size)
+{
+  constexpr std::uint16_t back_steps_num = 1;
+  const float gamma = normalizePositive(atan2f(radius, param.virtual_lidar_z), 2.0f * PI);
+  if (radius <= param.grid_mode_switch_radius) {
+    grid_id = static_cast<std::uint16_t>(radius / param.grid_size_m);
+    grid_size = param.grid_size_m;
+  } else {
+    grid_id = param.grid_mode_switch_grid_id +
+              (gamma - param.grid_mode_switch_angle_rad) / param.grid_size_rad;
+    if (grid_id <= param.grid_mode_switch_grid_id + back_steps_num) {
+      grid_size = param.grid_size_m;
+    } else {
+      grid_size = (tanf(gamma) - tanf(gamma - param.grid_size_rad)) * param.virtual_lidar_z;
+    }
+  }
+}
+
+struct GridCenter
+{
+  float radius;
+  float avg_height;
+  float max_height;
+  std::uint16_t grid_id;
+};
+
+// The last gnd_grid_buffer_size + 1 ground grids of a division, the only ones which are read
+struct GroundGrids
+{
+  GridCenter grids[CudaScanGroundFilter::MAX_GND_GRID_BUFFER_SIZE + 1];
+  int capacity;
+  int num_pushed{0};
+
+  __device__ explicit GroundGrids(const int buffer_size) : capacity(buffer_size + 1) {}
+
+  __device__ void push(const GridCenter & grid)
+  {
+    grids[num_pushed % capacity] = grid;
+    ++num_pushed;
+  }
+
+  // i-th grid from the end, from_end(1) being the last one
+  __device__ const GridCenter & from_end(const int i) const
+  {
+    return grids[((num_pushed - i) % capacity + capacity) % capacity];
+  }
+};
+
+// Same as ScanGroundFilterComponent::PointsCentroid. The members are stored as positions in the
+// sorted points, in the range of the division.
+struct GroundCluster
+{
+  float radius_sum;
+  float height_sum;
+  float radius_avg;
+  float height_avg;
+  float height_max;
+  float height_min;
+  std::uint32_t point_num;
+  std::uint32_t * members;
+
+  __device__ void initialize()
+  {
+    radius_sum = 0.0f;
+    height_sum = 0.0f;
+    radius_avg = 0.0f;
+    height_avg = 0.0f;
+    height_max = 0.0f;
+    height_min = 10.0f;
+    point_num = 0;
+  }
+
+  __device__ void addPoint(const float radius, const float height, const std::uint32_t position)
+  {
+    members[point_num] = position;
+    radius_sum += radius;
+    height_sum += height;
+    ++point_num;
+    radius_avg = radius_sum / point_num;
+    height_avg = height_sum / point_num;
+    height_max = height_max < height ? height : height_max;
+    height_min = height_min > height ? height : height_min;
+  }
+};
+
+__global__ void computeKeys_kernel(
+  const std::uint8_t * raw_points, const std::size_t num_points, const std::size_t point_step,
+  const int x_offset, const int y_offset, const int z_offset,
+  const CudaScanGroundFilterParam param, std::uint64_t * keys, std::uint32_t * order,
+  float4 * points)
+{
+  const std::size_t idx = blockIdx.x * blockDim.x + threadIdx.x;
+  if (idx >= num_points) return;
+
+  const std::uint8_t * raw_point = raw_points + idx * point_step;
+  float x, y, z;
+  memcpy(&x, raw_point + x_offset, sizeof(float));
+  memcpy(&y, raw_point + y_offset, sizeof(float));
+  memcpy(&z, raw_point + z_offset, sizeof(float));
+  order[idx] = idx;
+  if (!isfinite(x) || !isfinite(y) || !isfinite(z)) {
+    keys[idx] = INVALID_KEY;
+    points[idx] = make_float4(0.0f, 0.0f, 0.0f, 0.0f);
+    return;
+  }
+
+  // base on front wheel center
+  const float shifted_x = x - param.front_wheel_center_x;
+  const float radius = hypotf(shifted_x, y);
+  const float theta = normalizePositive(atan2f(shifted_x, y), 2.0f * PI);
+  const auto radial_div = static_cast<std::uint32_t>(
+    floorf(normalizePositive(theta / param.radial_divider_angle_rad, 360.0f)));
+
+  // the radius is not negative, so its bits sort as the value
+  keys[idx] = (static_cast<std::uint64_t>(radial_div) << 32) | __float_as_uint(radius);
+  points[idx] = make_float4(x, y, z, radius);
+}
+
+// div_begin[d] = first sorted point of the division d, and div_begin[num_divisions] = end of the
+// valid points, which come before the invalid ones
+__global__ void findDivisionBegins_kernel(
+  const std::uint64_t * keys, const std::size_t num_points, const std::uint32_t num_divisions,
+  std::uint32_t * div_begin)
+{
+  const std::size_t idx = blockIdx.x * blockDim.x + threadIdx.x;
+  if (idx >= num_points) return;
+
+  const auto division = [num_divisions](const std::uint64_t key) {
+    return min(static_cast<std::uint32_t>(key >> 32), num_divisions);
+  };
+  const std::uint32_t div = division(keys[idx]);
+  const std::uint32_t first_div = idx == 0 ? 0 : division(keys[idx - 1]) + 1;
+  for (std::uint32_t d = first_div; d <= div; ++d) {
+    div_begin[d] = idx;
+  }
+  // the divisions after the last point are empty
+  if (idx == num_points - 1) {
+    for (std::uint32_t d = div + 1; d <= num_divisions; ++d) {
+      div_begin[d] = num_points;
+    }
+  }
+}
+
+__global__ void gatherPoints_kernel(
+  const float4 * points, const std::uint32_t * order, const std::size_t num_points,
+  float4 * sorted_points)
+{
+  const std::size_t idx = blockIdx.x * blockDim.x + threadIdx.x;
+  if (idx >= num_points) return;
+  sorted_points[idx] = points[order[idx]];
+}
+
+__device__ void initializeFirstGndGrids(
+  const float h, const float r, const std::uint16_t id, const std::uint16_t buffer_size,
+  GroundGrids & gnd_grids)
+{
+  for (int ind_grid = id - 1 - buffer_size; ind_grid < id - 1; ++ind_grid) {
+    const float ind = ind_grid - id + 1 + buffer_size;
+    // negative grid ids wrap as in the CPU implementation
+    gnd_grids.push(GridCenter{
+      ind * r / buffer_size, ind * h / buffer_size, ind * h / buffer_size,
+      static_cast<std::uint16_t>(ind_grid)});
+  }
+}
+
+// One thread walks one radial division, with the same algorithm as
+// ScanGroundFilterComponent::classifyPointCloudGridScan
+__global__ void classifyRadialDivisions_kernel(
+  const float4 * points, const std::uint32_t * order, const std::uint32_t * div_begin,
+  const CudaScanGroundFilterParam param, std::uint32_t * cluster_members,
+  std::uint8_t * no_ground_flags)
+{
+  const std::uint32_t div = blockIdx.x * blockDim.x + threadIdx.x;
+  if (div >= param.radial_dividers_num) return;
+  const std::uint32_t begin = div_begin[div];
+  const std::uint32_t end = div_begin[div + 1];
+  if (begin == end) return;
+
+  const int buffer_size = param.gnd_grid_buffer_size;
+  GroundGrids gnd_grids(buffer_size);
+  GroundCluster ground_cluster;
+  ground_cluster.members = cluster_members + begin;
+  ground_cluster.initialize();
+
+  const auto recheck_ground_cluster = [&]() {
+    for (std::uint32_t m = 0; m < ground_cluster.point_num; ++m) {
+      const std::uint32_t position = ground_cluster.members[m];
+      if (points[position].z >= ground_cluster.height_min + param.non_ground_height_threshold) {
+        no_ground_flags[order[position]] = 1;
+      }
+    }
+  };
+
+  enum class Label : std::uint8_t { INIT, GROUND, NON_GROUND, OUT_OF_RANGE };
+  std::uint32_t prev = begin;
+  std::uint16_t prev_grid_id = 0;
+  float4 prev_point = points[begin];
+  Label prev_state = Label::INIT;
+  {
+    float grid_size;
+    calcGrid(prev_point.w, param, prev_grid_id, grid_size);
+  }
+
+  bool initialized_first_gnd_grid = false;
+  bool prev_list_init = false;
+
+  for (std::uint32_t i = begin; i < end; ++i) {
+    const float4 p = points[i];
+    const float x = p.x;
+    const float z = p.z;
+    const float radius = p.w;
+    std::uint16_t grid_id;
+    float grid_size;
+    calcGrid(radius, param, grid_id, grid_size);
+    Label state = Label::INIT;
+
+    const auto next = [&]() {
+      prev = i;
+      prev_point = p;
+      prev_grid_id = grid_id;
+      prev_state = state;
+    };
+
+    const float global_slope_p = atanf(z / radius);
+    float non_ground_height_threshold_local = param.non_ground_height_threshold;
+    if (x < param.low_priority_region_x) {
+      non_ground_height_threshold_local =
+        param.non_ground_height_threshold * fabsf(x / param.low_priority_region_x);
+    }
+    // classify first grid's point cloud
+    if (
+      !initialized_first_gnd_grid && global_slope_p >= param.global_slope_max_angle_rad &&
+      z > non_ground_height_threshold_local) {
+      no_ground_flags[order[i]] = 1;
+      state = Label::NON_GROUND;
+      next();
+      continue;
+    }
+
+    if (
+      !initialized_first_gnd_grid && fabsf(global_slope_p) < param.global_slope_max_angle_rad &&
+      fabsf(z) < non_ground_height_threshold_local) {
+      ground_cluster.addPoint(radius, z, i);
+      state = Label::GROUND;
+      initialized_first_gnd_grid = grid_id != prev_grid_id;
+      next();
+      continue;
+    }
+
+    if (!initialized_first_gnd_grid) {
+      next();
+      continue;
+    }
+
+    // initialize lists of previous gnd grids
+    if (!prev_list_init) {
+      initializeFirstGndGrids(
+        ground_cluster.height_avg, ground_cluster.radius_avg, grid_id, buffer_size, gnd_grids);
+      prev_list_init = true;
+    }
+
+    // move to new grid
+    if (grid_id > prev_grid_id && ground_cluster.radius_avg > 0.0f) {
+      // check if the prev grid have ground point cloud
+      if (param.use_recheck_ground_cluster) {
+        recheck_ground_cluster();
+      }
+      gnd_grids.push(GridCenter{
+        ground_cluster.radius_avg, ground_cluster.height_avg, ground_cluster.height_max,
+        prev_grid_id});
+      ground_cluster.initialize();
+    }
+    const GridCenter & last_gnd_grid = gnd_grids.from_end(1);
+    // classify
+    if (z - last_gnd_grid.avg_height > param.detection_range_z_max) {
+      state = Label::OUT_OF_RANGE;
+      next();
+      continue;
+    }
+    const float points_xy_distance = hypotf(x - prev_point.x, p.y - prev_point.y);
+    if (
+      prev_state == Label::NON_GROUND &&
+      points_xy_distance < param.split_points_distance_tolerance && z > prev_point.z) {
+      state = Label::NON_GROUND;
+      no_ground_flags[order[i]] = 1;
+      next();
+      continue;
+    }
+
+    if (global_slope_p > param.global_slope_max_angle_rad) {
+      no_ground_flags[order[i]] = 1;
+      next();
+      continue;
+    }
+    // gnd grid is continuous, the last gnd grid is close
+    const std::uint16_t next_gnd_grid_id_thresh =
+      gnd_grids.from_end(buffer_size).grid_id + buffer_size + GND_GRID_CONTINUAL_THRESH;
+    const bool is_close = radius - last_gnd_grid.radius < GND_GRID_CONTINUAL_THRESH * grid_size;
+    if (grid_id < next_gnd_grid_id_thresh && is_close) {
+      // checkContinuousGndGrid
+      float gnd_buff_z_mean = 0.0f;
+      float gnd_buff_radius = 0.0f;
+      for (int k = buffer_size + 1; k > 1; --k) {
+        gnd_buff_radius += gnd_grids.from_end(k).radius;
+        gnd_buff_z_mean += gnd_grids.from_end(k).avg_height;
+      }
+      gnd_buff_radius /= static_cast<float>(buffer_size - 1);
+      gnd_buff_z_mean /= static_cast<float>(buffer_size - 1);
+
+      float curr_gnd_slope_rad = atanf(
+        (last_gnd_grid.avg_height - gnd_buff_z_mean) / (last_gnd_grid.radius - gnd_buff_radius));
+      curr_gnd_slope_rad = fminf(
+        fmaxf(curr_gnd_slope_rad, -param.global_slope_max_angle_rad),
+        param.global_slope_max_angle_rad);
+      const float next_gnd_z =
+        tanf(curr_gnd_slope_rad) * (radius - gnd_buff_radius) + gnd_buff_z_mean;
+      const float gnd_z_local_thresh =
+        tanf(5.0f * PI / 180.0f) * (radius - last_gnd_grid.radius);
+
+      const GridCenter & second_last_gnd_grid = gnd_grids.from_end(2);
+      const float local_slope = atanf(
+        (z - second_last_gnd_grid.avg_height) / (radius - second_last_gnd_grid.radius));
+      if (
+        fabsf(z - next_gnd_z) <= param.non_ground_height_threshold + gnd_z_local_thresh ||
+        fabsf(local_slope) <= param.local_slope_max_angle_rad) {
+        state = Label::GROUND;
+      } else if (z - next_gnd_z > param.non_ground_height_threshold + gnd_z_local_thresh) {
+        state = Label::NON_GROUND;
+      }
+    } else if (is_close) {
+      // checkDiscontinuousGndGrid
+      const float tmp_delta_max_z = z - last_gnd_grid.max_height;
+      const float tmp_delta_avg_z = z - last_gnd_grid.avg_height;
+      const float local_slope = atanf(tmp_delta_avg_z / (radius - last_gnd_grid.radius));
+      if (
+        fabsf(local_slope) < param.local_slope_max_angle_rad ||
+        fabsf(tmp_delta_avg_z) < param.non_ground_height_threshold ||
+        fabsf(tmp_delta_max_z) < param.non_ground_height_threshold) {
+        state = Label::GROUND;
+      } else if (local_slope > param.global_slope_max_angle_rad) {
+        state = Label::NON_GROUND;
+      }
+    } else {
+      // checkBreakGndGrid
+      const float local_slope =
+        atanf((z - last_gnd_grid.avg_height) / (radius - last_gnd_grid.radius));
+      if (fabsf(local_slope) < param.global_slope_max_angle_rad) {
+        state = Label::GROUND;
+      } else if (local_slope > param.global_slope_max_angle_rad) {
+        state = Label::NON_GROUND;
+      }
+    }
+    if (state == Label::NON_GROUND) {
+      no_ground_flags[order[i]] = 1;
+    } else if (state == Label::GROUND) {
+      ground_cluster.addPoint(radius, z, i);
+    }
+    next();
+  }
+}
+}  // namespace
+
+namespace ground_segmentation
+{
+
+CudaScanGroundFilter::CudaScanGroundFilter() : stream_(cuda_utils::makeCudaStream())
+{
+}
+
+void CudaScanGroundFilter::reserve(std::size_t num_points, std::size_t point_step)
+{
+  // Buffers only grow, so that a steady input size does not allocate on every frame.
+  if (num_points * point_step > capacity_bytes_) {
+    capacity_bytes_ = num_points * point_step;
+    d_raw_points_ = cuda_utils::make_unique<std::uint8_t[]>(capacity_bytes_);
+  }
+  if (num_points > capacity_points_) {
+    capacity_points_ = num_points;
+    d_keys_ = cuda_utils::make_unique<std::uint64_t[]>(capacity_points_);
+    d_order_ = cuda_utils::make_unique<std::uint32_t[]>(capacity_points_);
+    d_sorted_points_ = cuda_utils::make_unique<float4[]>(2 * capacity_points_);
+    d_cluster_members_ = cuda_utils::make_unique<std::uint32_t[]>(capacity_points_);
+    d_no_ground_flags_ = cuda_utils::make_unique<std::uint8_t[]>(capacity_points_);
+    d_no_ground_indices_ = cuda_utils::make_unique<std::int32_t[]>(capacity_points_);
+  }
+  if (param_.radial_dividers_num + 1 > capacity_divisions_) {
+    capacity_divisions_ = param_.radial_dividers_num + 1;
+    d_div_begin_ = cuda_utils::make_unique<std::uint32_t[]>(capacity_divisions_);
+  }
+}
+
+CudaScanGroundFilter::DeviceIndices CudaScanGroundFilter::classify_on_device(
+  const sensor_msgs::msg::PointCloud2 & input)
+{
+  cudaStream_t stream = *stream_;
+  const std::size_t num_points = input.point_step ? input.data.size() / input.point_step : 0;
+  if (num_points == 0 || param_.radial_dividers_num == 0) {
+    return DeviceIndices{d_no_ground_indices_.get(), 0, stream};
+  }
+  reserve(num_points, input.point_step);
+
+  int x_offset = 0, y_offset = 0, z_offset = 0;
+  for (const auto & field : input.fields) {
+    if (field.name == "x") x_offset = field.offset;
+    if (field.name == "y") y_offset = field.offset;
+    if (field.name == "z") z_offset = field.offset;
+  }
+
+  CHECK_CUDA_ERROR(cudaMemcpyAsync(
+    d_raw_points_.get(), input.data.data(), num_points * input.point_step, cudaMemcpyHostToDevice,
+    stream));
+  CHECK_CUDA_ERROR(cudaMemsetAsync(d_no_ground_flags_.get(), 0, num_points, stream));
+
+  // The first half of d_sorted_points_ holds the points in input order, the second half sorted
+  float4 * d_points = d_sorted_points_.get();
+  float4 * d_sorted_points = d_sorted_points_.get() + capacity_points_;
+  const std::size_t num_blocks = divup(num_points, THREADS_PER_BLOCK);
+  computeKeys_kernel<<<num_blocks, THREADS_PER_BLOCK, 0, stream>>>(
+    d_raw_points_.get(), num_points, input.point_step, x_offset, y_offset, z_offset, param_,
+    d_keys_.get(), d_order_.get(), d_points);
+
+  thrust::device_ptr<std::uint64_t> keys(d_keys_.get());
+  thrust::device_ptr<std::uint32_t> order(d_order_.get());
+  thrust::sort_by_key(thrust::cuda::par.on(stream), keys, keys + num_points, order);
+
+  findDivisionBegins_kernel<<<num_blocks, THREADS_PER_BLOCK, 0, stream>>>(
+    d_keys_.get(), num_points, param_.radial_dividers_num, d_div_begin_.get());
+  gatherPoints_kernel<<<num_blocks, THREADS_PER_BLOCK, 0, stream>>>(
+    d_points, d_order_.get(), num_points, d_sorted_points);
+
+  classifyRadialDivisions_kernel<<<
+    divup(param_.radial_dividers_num, DIVISIONS_PER_BLOCK), DIVISIONS_PER_BLOCK, 0, stream>>>(
+    d_sorted_points, d_order_.get(), d_div_begin_.get(), param_, d_cluster_members_.get(),
+    d_no_ground_flags_.get());
+
+  // stream compaction of the flags, in the order of the input points
+  thrust::device_ptr<std::uint8_t> flags(d_no_ground_flags_.get());
+  thrust::device_ptr<std::int32_t> indices(d_no_ground_indices_.get());
+  const auto indices_end = thrust::copy_if(
+    thrust::cuda::par.on(stream), thrust::counting_iterator<std::int32_t>(0),
+    thrust::counting_iterator<std::int32_t>(num_points), flags, indices, NonZero());
+  CHECK_CUDA_ERROR(cudaGetLastError());
+
+  return DeviceIndices{
+    d_no_ground_indices_.get(), static_cast<std::size_t>(indices_end - indices), stream};
+}
+
+void CudaScanGroundFilter::classify(
+  const sensor_msgs::msg::PointCloud2 & input, std::vector<int> & out_no_ground_indices)
+{
+  const auto indices = classify_on_device(input);
+  out_no_ground_indices.resize(indices.size);
+  if (indices.size > 0) {
+    CHECK_CUDA_ERROR(cudaMemcpyAsync(
+      out_no_ground_indices.data(), indices.data, indices.size * sizeof(std::int32_t),
+      cudaMemcpyDeviceToHost, indices.stream));
+  }
+  CHECK_CUDA_ERROR(cudaStreamSynchronize(indices.stream));
+}
+
+}  // namespace ground_segmentation
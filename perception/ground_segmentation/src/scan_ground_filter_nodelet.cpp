@@ -19,6 +19,15 @@
 #include <tier4_autoware_utils/math/unit_conversion.hpp>
 #include <vehicle_info_util/vehicle_info_util.hpp>
 
+#ifdef WITH_CUDA_SCAN_GROUND
+#include "ground_segmentation/cuda_scan_ground_filter.hpp"
+#endif
+
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
+#include <algorithm>
 #include <memory>
 #include <string>
 #include <vector>
@@ -55,6 +64,9 @@ ScanGroundFilterComponent::ScanGroundFilterComponent(const rclcpp::NodeOptions &
     split_height_distance_ = declare_parameter("split_height_distance", 0.2);
     use_virtual_ground_point_ = declare_parameter("use_virtual_ground_point", true);
     use_recheck_ground_cluster_ = declare_parameter("use_recheck_ground_cluster", true);
+    use_polar_grid_engine_ = declare_parameter("use_polar_grid_engine", false);
+    num_threads_ = static_cast<int>(declare_parameter("num_threads", 1));
+    use_cuda_ = declare_parameter("use_cuda", false);
     radial_dividers_num_ = std::ceil(2.0 * M_PI / radial_divider_angle_rad_);
     vehicle_info_ = VehicleInfoUtil(*this).getVehicleInfo();
 
@@ -64,6 +76,24 @@ ScanGroundFilterComponent::ScanGroundFilterComponent(const rclcpp::NodeOptions &
     grid_mode_switch_angle_rad_ = std::atan2(grid_mode_switch_radius_, virtual_lidar_z_);
   }
 
+  if (use_cuda_) {
+#ifdef WITH_CUDA_SCAN_GROUND
+    if (!elevation_grid_mode_) {
+      RCLCPP_WARN(get_logger(), "use_cuda only supports elevation_grid_mode. Running on the CPU.");
+    } else if (gnd_grid_buffer_size_ > CudaScanGroundFilter::MAX_GND_GRID_BUFFER_SIZE) {
+      RCLCPP_WARN(
+        get_logger(), "use_cuda supports gnd_grid_buffer_size up to %u. Running on the CPU.",
+        CudaScanGroundFilter::MAX_GND_GRID_BUFFER_SIZE);
+    } else {
+      cuda_scan_ground_filter_ = std::make_shared<CudaScanGroundFilter>();
+    }
+#else
+    RCLCPP_WARN(
+      get_logger(), "use_cuda is set but the package is built without CUDA. Running on the CPU.");
+#endif
+    use_cuda_ = static_cast<bool>(cuda_scan_ground_filter_);
+  }
+
   using std::placeholders::_1;
   set_param_res_ = this->add_on_set_parameters_callback(
     std::bind(&ScanGroundFilterComponent::onParameter, this, _1));
@@ -79,54 +109,58 @@ ScanGroundFilterComponent::ScanGroundFilterComponent(const rclcpp::NodeOptions &
   }
 }
 
+void ScanGroundFilterComponent::calcGridScanCoordinates(
+  const pcl::PointXYZ & point, PointRef & ref) const
+{
+  const uint16_t back_steps_num = 1;
+  auto x{
+    point.x - vehicle_info_.wheel_base_m / 2.0f - center_pcl_shift_};  // base on front wheel center
+  auto radius{static_cast<float>(std::hypot(x, point.y))};
+  auto theta{normalizeRadian(std::atan2(x, point.y), 0.0)};
+
+  // divide by vertical angle
+  auto gamma{normalizeRadian(std::atan2(radius, virtual_lidar_z_), 0.0f)};
+  auto radial_div{
+    static_cast<size_t>(std::floor(normalizeDegree(theta / radial_divider_angle_rad_, 0.0)))};
+  uint16_t grid_id = 0;
+  float curr_grid_size = 0.0f;
+  if (radius <= grid_mode_switch_radius_) {
+    grid_id = static_cast<uint16_t>(radius / grid_size_m_);
+    curr_grid_size = grid_size_m_;
+  } else {
+    grid_id = grid_mode_switch_grid_id_ + (gamma - grid_mode_switch_angle_rad_) / grid_size_rad_;
+    if (grid_id <= grid_mode_switch_grid_id_ + back_steps_num) {
+      curr_grid_size = grid_size_m_;
+    } else {
+      curr_grid_size = std::tan(gamma) - std::tan(gamma - grid_size_rad_);
+      curr_grid_size *= virtual_lidar_z_;
+    }
+  }
+  ref.grid_id = grid_id;
+  ref.grid_size = curr_grid_size;
+  ref.radius = radius;
+  ref.theta = theta;
+  ref.radial_div = radial_div;
+}
+
 void ScanGroundFilterComponent::convertPointcloudGridScan(
   const pcl::PointCloud<pcl::PointXYZ>::Ptr in_cloud,
   std::vector<PointCloudRefVector> & out_radial_ordered_points)
 {
   out_radial_ordered_points.resize(radial_dividers_num_);
   PointRef current_point;
-  uint16_t back_steps_num = 1;
 
   grid_size_rad_ =
     normalizeRadian(std::atan2(grid_mode_switch_radius_ + grid_size_m_, virtual_lidar_z_)) -
     normalizeRadian(std::atan2(grid_mode_switch_radius_, virtual_lidar_z_));
   for (size_t i = 0; i < in_cloud->points.size(); ++i) {
-    auto x{
-      in_cloud->points[i].x - vehicle_info_.wheel_base_m / 2.0f -
-      center_pcl_shift_};  // base on front wheel center
-    // auto y{in_cloud->points[i].y};
-    auto radius{static_cast<float>(std::hypot(x, in_cloud->points[i].y))};
-    auto theta{normalizeRadian(std::atan2(x, in_cloud->points[i].y), 0.0)};
-
-    // divide by vertical angle
-    auto gamma{normalizeRadian(std::atan2(radius, virtual_lidar_z_), 0.0f)};
-    auto radial_div{
-      static_cast<size_t>(std::floor(normalizeDegree(theta / radial_divider_angle_rad_, 0.0)))};
-    uint16_t grid_id = 0;
-    float curr_grid_size = 0.0f;
-    if (radius <= grid_mode_switch_radius_) {
-      grid_id = static_cast<uint16_t>(radius / grid_size_m_);
-      curr_grid_size = grid_size_m_;
-    } else {
-      grid_id = grid_mode_switch_grid_id_ + (gamma - grid_mode_switch_angle_rad_) / grid_size_rad_;
-      if (grid_id <= grid_mode_switch_grid_id_ + back_steps_num) {
-        curr_grid_size = grid_size_m_;
-      } else {
-        curr_grid_size = std::tan(gamma) - std::tan(gamma - grid_size_rad_);
-        curr_grid_size *= virtual_lidar_z_;
-      }
-    }
-    current_point.grid_id = grid_id;
-    current_point.grid_size = curr_grid_size;
-    current_point.radius = radius;
-    current_point.theta = theta;
-    current_point.radial_div = radial_div;
+    calcGridScanCoordinates(in_cloud->points[i], current_point);
     current_point.point_state = PointLabel::INIT;
     current_point.orig_index = i;
     current_point.orig_point = &in_cloud->points[i];
 
     // radial divisions
-    out_radial_ordered_points[radial_div].emplace_back(current_point);
+    out_radial_ordered_points[current_point.radial_div].emplace_back(current_point);
   }
 
   // sort by distance
@@ -195,7 +229,8 @@ void ScanGroundFilterComponent::initializeFirstGndGrids(
 }
 
 void ScanGroundFilterComponent::checkContinuousGndGrid(
-  PointRef & p, const std::vector<GridCenter> & gnd_grids_list)
+  const float radius, const float z, PointLabel & point_state,
+  const std::vector<GridCenter> & gnd_grids_list) const
 {
   float next_gnd_z = 0.0f;
   float curr_gnd_slope_rad = 0.0f;
@@ -225,58 +260,60 @@ void ScanGroundFilterComponent::checkContinuousGndGrid(
                          ? global_slope_max_angle_rad_
                          : curr_gnd_slope_rad;
 
-  next_gnd_z = std::tan(curr_gnd_slope_rad) * (p.radius - gnd_buff_radius) + gnd_buff_z_mean;
+  next_gnd_z = std::tan(curr_gnd_slope_rad) * (radius - gnd_buff_radius) + gnd_buff_z_mean;
 
-  float gnd_z_local_thresh = std::tan(DEG2RAD(5.0)) * (p.radius - gnd_grids_list.back().radius);
+  float gnd_z_local_thresh = std::tan(DEG2RAD(5.0)) * (radius - gnd_grids_list.back().radius);
 
-  tmp_delta_mean_z = p.orig_point->z - (gnd_grids_list.end() - 2)->avg_height;
-  tmp_delta_radius = p.radius - (gnd_grids_list.end() - 2)->radius;
+  tmp_delta_mean_z = z - (gnd_grids_list.end() - 2)->avg_height;
+  tmp_delta_radius = radius - (gnd_grids_list.end() - 2)->radius;
   float local_slope = std::atan(tmp_delta_mean_z / tmp_delta_radius);
   if (
-    abs(p.orig_point->z - next_gnd_z) <= non_ground_height_threshold_ + gnd_z_local_thresh ||
+    abs(z - next_gnd_z) <= non_ground_height_threshold_ + gnd_z_local_thresh ||
     abs(local_slope) <= local_slope_max_angle_rad_) {
-    p.point_state = PointLabel::GROUND;
-  } else if (p.orig_point->z - next_gnd_z > non_ground_height_threshold_ + gnd_z_local_thresh) {
-    p.point_state = PointLabel::NON_GROUND;
+    point_state = PointLabel::GROUND;
+  } else if (z - next_gnd_z > non_ground_height_threshold_ + gnd_z_local_thresh) {
+    point_state = PointLabel::NON_GROUND;
   }
 }
 void ScanGroundFilterComponent::checkDiscontinuousGndGrid(
-  PointRef & p, const std::vector<GridCenter> & gnd_grids_list)
+  const float radius, const float z, PointLabel & point_state,
+  const std::vector<GridCenter> & gnd_grids_list) const
 {
-  float tmp_delta_max_z = p.orig_point->z - gnd_grids_list.back().max_height;
-  float tmp_delta_avg_z = p.orig_point->z - gnd_grids_list.back().avg_height;
-  float tmp_delta_radius = p.radius - gnd_grids_list.back().radius;
+  float tmp_delta_max_z = z - gnd_grids_list.back().max_height;
+  float tmp_delta_avg_z = z - gnd_grids_list.back().avg_height;
+  float tmp_delta_radius = radius - gnd_grids_list.back().radius;
   float local_slope = std::atan(tmp_delta_avg_z / tmp_delta_radius);
 
   if (
     abs(local_slope) < local_slope_max_angle_rad_ ||
     abs(tmp_delta_avg_z) < non_ground_height_threshold_ ||
     abs(tmp_delta_max_z) < non_ground_height_threshold_) {
-    p.point_state = PointLabel::GROUND;
+    point_state = PointLabel::GROUND;
   } else if (local_slope > global_slope_max_angle_rad_) {
-    p.point_state = PointLabel::NON_GROUND;
+    point_state = PointLabel::NON_GROUND;
   }
 }
 
 void ScanGroundFilterComponent::checkBreakGndGrid(
-  PointRef & p, const std::vector<GridCenter> & gnd_grids_list)
+  const float radius, const float z, PointLabel & point_state,
+  const std::vector<GridCenter> & gnd_grids_list) const
 {
-  float tmp_delta_avg_z = p.orig_point->z - gnd_grids_list.back().avg_height;
-  float tmp_delta_radius = p.radius - gnd_grids_list.back().radius;
+  float tmp_delta_avg_z = z - gnd_grids_list.back().avg_height;
+  float tmp_delta_radius = radius - gnd_grids_list.back().radius;
   float local_slope = std::atan(tmp_delta_avg_z / tmp_delta_radius);
   if (abs(local_slope) < global_slope_max_angle_rad_) {
-    p.point_state = PointLabel::GROUND;
+    point_state = PointLabel::GROUND;
   } else if (local_slope > global_slope_max_angle_rad_) {
-    p.point_state = PointLabel::NON_GROUND;
+    point_state = PointLabel::NON_GROUND;
   }
 }
 void ScanGroundFilterComponent::recheckGroundCluster(
-  PointsCentroid & gnd_cluster, const float non_ground_threshold,
-  pcl::PointIndices & non_ground_indices)
+  const PointsCentroid & gnd_cluster, const float non_ground_threshold,
+  pcl::PointIndices & non_ground_indices) const
 {
   const float min_gnd_height = gnd_cluster.getMinHeight();
-  pcl::PointIndices gnd_indices = gnd_cluster.getIndices();
-  std::vector<float> height_list = gnd_cluster.getHeightList();
+  const pcl::PointIndices & gnd_indices = gnd_cluster.getIndices();
+  const std::vector<float> & height_list = gnd_cluster.getHeightList();
   for (size_t i = 0; i < height_list.size(); ++i) {
     if (height_list.at(i) >= min_gnd_height + non_ground_threshold) {
       non_ground_indices.indices.push_back(gnd_indices.indices.at(i));
@@ -396,12 +433,12 @@ void ScanGroundFilterComponent::classifyPointCloudGridScan(
       if (
         p->grid_id < next_gnd_grid_id_thresh &&
         p->radius - gnd_grids.back().radius < gnd_grid_continual_thresh_ * p->grid_size) {
-        checkContinuousGndGrid(*p, gnd_grids);
+        checkContinuousGndGrid(p->radius, p->orig_point->z, p->point_state, gnd_grids);
 
       } else if (p->radius - gnd_grids.back().radius < gnd_grid_continual_thresh_ * p->grid_size) {
-        checkDiscontinuousGndGrid(*p, gnd_grids);
+        checkDiscontinuousGndGrid(p->radius, p->orig_point->z, p->point_state, gnd_grids);
       } else {
-        checkBreakGndGrid(*p, gnd_grids);
+        checkBreakGndGrid(p->radius, p->orig_point->z, p->point_state, gnd_grids);
       }
       if (p->point_state == PointLabel::NON_GROUND) {
         out_no_ground_indices.indices.push_back(p->orig_index);
@@ -413,6 +450,254 @@ void ScanGroundFilterComponent::classifyPointCloudGridScan(
   }
 }
 
+void ScanGroundFilterComponent::classifyPointCloudPolarGrid(
+  const pcl::PointCloud<pcl::PointXYZ>::Ptr in_cloud, pcl::PointIndices & out_no_ground_indices)
+{
+  auto & grid = polar_grid_;
+  const size_t num_points = in_cloud->points.size();
+
+  grid_size_rad_ =
+    normalizeRadian(std::atan2(grid_mode_switch_radius_ + grid_size_m_, virtual_lidar_z_)) -
+    normalizeRadian(std::atan2(grid_mode_switch_radius_, virtual_lidar_z_));
+
+  grid.input_radial_div.resize(num_points);
+  grid.input_grid_id.resize(num_points);
+  grid.input_radius.resize(num_points);
+  grid.input_grid_size.resize(num_points);
+  grid.div_begin.assign(radial_dividers_num_ + 1, 0);
+
+  // count the points of each radial division
+  PointRef current_point;
+  uint16_t max_grid_id = 0;
+  for (size_t i = 0; i < num_points; ++i) {
+    calcGridScanCoordinates(in_cloud->points[i], current_point);
+    grid.input_radial_div[i] = current_point.radial_div;
+    grid.input_grid_id[i] = current_point.grid_id;
+    grid.input_radius[i] = current_point.radius;
+    grid.input_grid_size[i] = current_point.grid_size;
+    max_grid_id = std::max(max_grid_id, current_point.grid_id);
+    ++grid.div_begin[current_point.radial_div + 1];
+  }
+  for (size_t div = 0; div < radial_dividers_num_; ++div) {
+    grid.div_begin[div + 1] += grid.div_begin[div];
+  }
+
+  // stable counting sort by radial division
+  grid.div_cursor.assign(grid.div_begin.begin(), grid.div_begin.end() - 1);
+  grid.div_order.resize(num_points);
+  for (size_t i = 0; i < num_points; ++i) {
+    grid.div_order[grid.div_cursor[grid.input_radial_div[i]]++] = i;
+  }
+
+  grid.grid_order.resize(num_points);
+  grid.x.resize(num_points);
+  grid.y.resize(num_points);
+  grid.z.resize(num_points);
+  grid.radius.resize(num_points);
+  grid.grid_size.resize(num_points);
+  grid.grid_id.resize(num_points);
+  grid.orig_index.resize(num_points);
+  grid.point_state.resize(num_points);
+
+  const int num_threads = std::max(num_threads_, 1);
+  polar_grid_workspaces_.resize(num_threads);
+  div_no_ground_indices_.resize(radial_dividers_num_);
+
+  // The radial divisions are independent: each of them only writes its own range of the grid
+  // and its own output indices, which are then merged in the order of the sequential path.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(num_threads)
+#endif
+  for (size_t div = 0; div < radial_dividers_num_; ++div) {
+#ifdef _OPENMP
+    auto & workspace = polar_grid_workspaces_[omp_get_thread_num()];
+#else
+    auto & workspace = polar_grid_workspaces_.front();
+#endif
+    auto & div_no_ground_indices = div_no_ground_indices_[div];
+    div_no_ground_indices.indices.clear();
+    const size_t begin = grid.div_begin[div];
+    const size_t end = grid.div_begin[div + 1];
+    if (begin == end) {
+      continue;
+    }
+    sortPolarGridDivision(begin, end, max_grid_id, *in_cloud, workspace);
+    classifyPolarGridDivision(begin, end, workspace, div_no_ground_indices);
+  }
+
+  out_no_ground_indices.indices.clear();
+  for (const auto & div_no_ground_indices : div_no_ground_indices_) {
+    out_no_ground_indices.indices.insert(
+      out_no_ground_indices.indices.end(), div_no_ground_indices.indices.begin(),
+      div_no_ground_indices.indices.end());
+  }
+}
+
+void ScanGroundFilterComponent::sortPolarGridDivision(
+  const size_t begin, const size_t end, const uint16_t max_grid_id,
+  const pcl::PointCloud<pcl::PointXYZ> & in_cloud, PolarGridWorkspace & workspace)
+{
+  auto & grid = polar_grid_;
+
+  // grid_id does not decrease with the radius, so a counting sort by grid_id leaves only the
+  // points of a same grid to be ordered by radius
+  auto & counts = workspace.grid_counts;
+  counts.assign(static_cast<size_t>(max_grid_id) + 2, 0);
+  for (size_t i = begin; i < end; ++i) {
+    ++counts[grid.input_grid_id[grid.div_order[i]] + 1];
+  }
+  for (size_t id = 0; id + 1 < counts.size(); ++id) {
+    counts[id + 1] += counts[id];
+  }
+  for (size_t i = begin; i < end; ++i) {
+    const uint32_t index = grid.div_order[i];
+    grid.grid_order[begin + counts[grid.input_grid_id[index]]++] = index;
+  }
+
+  // insertion sort, which only moves points inside their grid
+  for (size_t i = begin + 1; i < end; ++i) {
+    const uint32_t index = grid.grid_order[i];
+    const float radius = grid.input_radius[index];
+    size_t j = i;
+    for (; j > begin && grid.input_radius[grid.grid_order[j - 1]] > radius; --j) {
+      grid.grid_order[j] = grid.grid_order[j - 1];
+    }
+    grid.grid_order[j] = index;
+  }
+
+  for (size_t i = begin; i < end; ++i) {
+    const uint32_t index = grid.grid_order[i];
+    const auto & point = in_cloud.points[index];
+    grid.x[i] = point.x;
+    grid.y[i] = point.y;
+    grid.z[i] = point.z;
+    grid.radius[i] = grid.input_radius[index];
+    grid.grid_size[i] = grid.input_grid_size[index];
+    grid.grid_id[i] = grid.input_grid_id[index];
+    grid.orig_index[i] = index;
+    grid.point_state[i] = PointLabel::INIT;
+  }
+}
+
+void ScanGroundFilterComponent::classifyPolarGridDivision(
+  const size_t begin, const size_t end, PolarGridWorkspace & workspace,
+  pcl::PointIndices & out_no_ground_indices)
+{
+  // same algorithm as classifyPointCloudGridScan, on the sorted points of the polar grid
+  auto & grid = polar_grid_;
+  auto & ground_cluster = workspace.ground_cluster;
+  auto & gnd_grids = workspace.gnd_grids;
+  ground_cluster.initialize();
+  gnd_grids.clear();
+  GridCenter curr_gnd_grid;
+
+  size_t prev = begin;  // for checking the distance to prev point
+
+  bool initialized_first_gnd_grid = false;
+  bool prev_list_init = false;
+
+  for (size_t p = begin; p < end; ++p) {
+    const float x = grid.x[p];
+    const float z = grid.z[p];
+    const float radius = grid.radius[p];
+    const uint16_t grid_id = grid.grid_id[p];
+    auto & point_state = grid.point_state[p];
+
+    float global_slope_p = std::atan(z / radius);
+    float non_ground_height_threshold_local = non_ground_height_threshold_;
+    if (x < low_priority_region_x_) {
+      non_ground_height_threshold_local =
+        non_ground_height_threshold_ * abs(x / low_priority_region_x_);
+    }
+    // classify first grid's point cloud
+    if (
+      !initialized_first_gnd_grid && global_slope_p >= global_slope_max_angle_rad_ &&
+      z > non_ground_height_threshold_local) {
+      out_no_ground_indices.indices.push_back(grid.orig_index[p]);
+      point_state = PointLabel::NON_GROUND;
+      prev = p;
+      continue;
+    }
+
+    if (
+      !initialized_first_gnd_grid && abs(global_slope_p) < global_slope_max_angle_rad_ &&
+      abs(z) < non_ground_height_threshold_local) {
+      ground_cluster.addPoint(radius, z, grid.orig_index[p]);
+      point_state = PointLabel::GROUND;
+      initialized_first_gnd_grid = static_cast<bool>(grid_id - grid.grid_id[prev]);
+      prev = p;
+      continue;
+    }
+
+    if (!initialized_first_gnd_grid) {
+      prev = p;
+      continue;
+    }
+
+    // initialize lists of previous gnd grids
+    if (prev_list_init == false) {
+      float h = ground_cluster.getAverageHeight();
+      float r = ground_cluster.getAverageRadius();
+      initializeFirstGndGrids(h, r, grid_id, gnd_grids);
+      prev_list_init = true;
+    }
+
+    // move to new grid
+    if (grid_id > grid.grid_id[prev] && ground_cluster.getAverageRadius() > 0.0) {
+      // check if the prev grid have ground point cloud
+      if (use_recheck_ground_cluster_) {
+        recheckGroundCluster(ground_cluster, non_ground_height_threshold_, out_no_ground_indices);
+      }
+      curr_gnd_grid.radius = ground_cluster.getAverageRadius();
+      curr_gnd_grid.avg_height = ground_cluster.getAverageHeight();
+      curr_gnd_grid.max_height = ground_cluster.getMaxHeight();
+      curr_gnd_grid.grid_id = grid.grid_id[prev];
+      gnd_grids.push_back(curr_gnd_grid);
+      ground_cluster.initialize();
+    }
+    // classify
+    if (z - gnd_grids.back().avg_height > detection_range_z_max_) {
+      point_state = PointLabel::OUT_OF_RANGE;
+      prev = p;
+      continue;
+    }
+    float points_xy_distance = std::hypot(x - grid.x[prev], grid.y[p] - grid.y[prev]);
+    if (
+      grid.point_state[prev] == PointLabel::NON_GROUND &&
+      points_xy_distance < split_points_distance_tolerance_ && z > grid.z[prev]) {
+      point_state = PointLabel::NON_GROUND;
+      out_no_ground_indices.indices.push_back(grid.orig_index[p]);
+      prev = p;
+      continue;
+    }
+
+    if (global_slope_p > global_slope_max_angle_rad_) {
+      out_no_ground_indices.indices.push_back(grid.orig_index[p]);
+      prev = p;
+      continue;
+    }
+    // gnd grid is continuous, the last gnd grid is close
+    uint16_t next_gnd_grid_id_thresh = (gnd_grids.end() - gnd_grid_buffer_size_)->grid_id +
+                                       gnd_grid_buffer_size_ + gnd_grid_continual_thresh_;
+    const float grid_size = grid.grid_size[p];
+    if (
+      grid_id < next_gnd_grid_id_thresh &&
+      radius - gnd_grids.back().radius < gnd_grid_continual_thresh_ * grid_size) {
+      checkContinuousGndGrid(radius, z, point_state, gnd_grids);
+    } else if (radius - gnd_grids.back().radius < gnd_grid_continual_thresh_ * grid_size) {
+      checkDiscontinuousGndGrid(radius, z, point_state, gnd_grids);
+    } else {
+      checkBreakGndGrid(radius, z, point_state, gnd_grids);
+    }
+    if (point_state == PointLabel::NON_GROUND) {
+      out_no_ground_indices.indices.push_back(grid.orig_index[p]);
+    } else if (point_state == PointLabel::GROUND) {
+      ground_cluster.addPoint(radius, z, grid.orig_index[p]);
+    }
+    prev = p;
+  }
+}
+
 void ScanGroundFilterComponent::classifyPointCloud(
   std::vector<PointCloudRefVector> & in_radial_ordered_clouds,
   pcl::PointIndices & out_no_ground_indices)
@@ -552,7 +837,34 @@ void ScanGroundFilterComponent::filter(
   pcl::PointCloud<pcl::PointXYZ>::Ptr no_ground_cloud_ptr(new pcl::PointCloud<pcl::PointXYZ>);
   no_ground_cloud_ptr->points.reserve(current_sensor_cloud_ptr->points.size());
 
-  if (elevation_grid_mode_) {
+  if (use_cuda_) {
+#ifdef WITH_CUDA_SCAN_GROUND
+    CudaScanGroundFilterParam param;
+    param.front_wheel_center_x = vehicle_info_.wheel_base_m / 2.0f + center_pcl_shift_;
+    param.virtual_lidar_z = virtual_lidar_z_;
+    param.radial_divider_angle_rad = radial_divider_angle_rad_;
+    param.radial_dividers_num = radial_dividers_num_;
+    param.grid_size_m = grid_size_m_;
+    param.grid_size_rad =
+      normalizeRadian(std::atan2(grid_mode_switch_radius_ + grid_size_m_, virtual_lidar_z_)) -
+      normalizeRadian(std::atan2(grid_mode_switch_radius_, virtual_lidar_z_));
+    param.grid_mode_switch_radius = grid_mode_switch_radius_;
+    param.grid_mode_switch_grid_id = grid_mode_switch_grid_id_;
+    param.grid_mode_switch_angle_rad = grid_mode_switch_angle_rad_;
+    param.global_slope_max_angle_rad = global_slope_max_angle_rad_;
+    param.local_slope_max_angle_rad = local_slope_max_angle_rad_;
+    param.non_ground_height_threshold = non_ground_height_threshold_;
+    param.low_priority_region_x = low_priority_region_x_;
+    param.detection_range_z_max = detection_range_z_max_;
+    param.split_points_distance_tolerance = split_points_distance_tolerance_;
+    param.gnd_grid_buffer_size = gnd_grid_buffer_size_;
+    param.use_recheck_ground_cluster = use_recheck_ground_cluster_;
+    cuda_scan_ground_filter_->set_param(param);
+    cuda_scan_ground_filter_->classify(*input, no_ground_indices.indices);
+#endif
+  } else if (elevation_grid_mode_ && use_polar_grid_engine_) {
+    classifyPointCloudPolarGrid(current_sensor_cloud_ptr, no_ground_indices);
+  } else if (elevation_grid_mode_) {
     convertPointcloudGridScan(current_sensor_cloud_ptr, radial_ordered_points);
     classifyPointCloudGridScan(radial_ordered_points, no_ground_indices);
   } else {
@@ -619,6 +931,14 @@ rcl_interfaces::msg::SetParametersResult ScanGroundFilterComponent::onParameter(
       get_logger(),
       "Setting use_recheck_ground_cluster to: " << std::boolalpha << use_recheck_ground_cluster_);
   }
+  if (get_param(p, "use_polar_grid_engine", use_polar_grid_engine_)) {
+    RCLCPP_DEBUG_STREAM(
+      get_logger(),
+      "Setting use_polar_grid_engine to: " << std::boolalpha << use_polar_grid_engine_);
+  }
+  if (get_param(p, "num_threads", num_threads_)) {
+    RCLCPP_DEBUG(get_logger(), "Setting num_threads to: %d.", num_threads_);
+  }
   rcl_interfaces::msg::SetParametersResult result;
   result.successful = true;
   result.reason = "success";
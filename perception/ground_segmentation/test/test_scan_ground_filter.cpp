@@ -31,6 +31,10 @@
 
 #include <yaml-cpp/yaml.h>
 
+#include <algorithm>
+#include <array>
+#include <vector>
+
 class ScanGroundFilterTest : public ::testing::Test
 {
 protected:
@@ -188,3 +192,32 @@ TEST_F(ScanGroundFilterTest, TestCase1)
   //           << ",percentage:" << percent << std::endl;
   EXPECT_GE(percent, 0.9);
 }
+
+TEST_F(ScanGroundFilterTest, PolarGridEngineMatchesDefault)
+{
+  scan_ground_filter_->set_parameter(
+    rclcpp::Parameter("elevation_grid_mode", elevation_grid_mode_));
+  const auto sorted_points = [](const sensor_msgs::msg::PointCloud2 & cloud) {
+    std::vector<std::array<float, 3>> points;
+    for (sensor_msgs::PointCloud2ConstIterator<float> iter_x(cloud, "x"), iter_y(cloud, "y"),
+         iter_z(cloud, "z");
+         iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
+      points.push_back({*iter_x, *iter_y, *iter_z});
+    }
+    std::sort(points.begin(), points.end());
+    return points;
+  };
+
+  sensor_msgs::msg::PointCloud2 default_cloud;
+  filter(default_cloud);
+
+  scan_ground_filter_->set_parameter(rclcpp::Parameter("use_polar_grid_engine", true));
+  scan_ground_filter_->set_parameter(rclcpp::Parameter("num_threads", 4));
+  sensor_msgs::msg::PointCloud2 engine_cloud;
+  filter(engine_cloud);
+  // the buffers are reused for the next frames
+  filter(engine_cloud);
+
+  EXPECT_GT(default_cloud.width, 0U);
+  EXPECT_EQ(sorted_points(default_cloud), sorted_points(engine_cloud));
+}
@@ -16,6 +16,7 @@
 #define IMAGE_PROJECTION_BASED_FUSION__FUSION_NODE_HPP_
 
 #include <image_projection_based_fusion/debugger.hpp>
+#include <image_projection_based_fusion/utils/camera_projection.hpp>
 #include <rclcpp/rclcpp.hpp>
 #include <tier4_autoware_utils/ros/debug_publisher.hpp>
 #include <tier4_autoware_utils/system/stop_watch.hpp>
@@ -91,7 +92,16 @@ protected:
 
   virtual void publish(const Msg & output_msg);
 
+  /** \brief projection from the source frame onto the image of the camera `camera_id`.
+   * \return nullptr if the transform to the camera optical frame is not available
+   */
+  const CameraProjection * getCameraProjection(
+    const std::size_t camera_id, const std::string & camera_frame_id,
+    const std::string & source_frame_id, const rclcpp::Time & stamp);
+
   void timer_callback();
+  // restart the timer to time out when the cameras which are not fused yet have all timed out
+  void updateTimeout();
   void setPeriod(const int64_t new_period);
 
   std::size_t rois_number_{1};
@@ -101,9 +111,15 @@ protected:
   // camera_info
   std::map<std::size_t, sensor_msgs::msg::CameraInfo> camera_info_map_;
   std::vector<rclcpp::Subscription<sensor_msgs::msg::CameraInfo>::SharedPtr> camera_info_subs_;
+  // projections of the cameras, the transform is only looked up once if it is static
+  std::map<std::size_t, CameraProjection> camera_projection_map_;
+  bool use_static_camera_transform_{false};
 
   rclcpp::TimerBase::SharedPtr timer_;
+  rclcpp::Time timer_start_time_;
   double timeout_ms_{};
+  // timeouts of each camera, timeout_ms_ is used for all of them if empty
+  std::vector<double> rois_timeout_ms_;
   double match_threshold_ms_{};
   std::vector<std::string> input_rois_topics_;
   std::vector<std::string> input_camera_info_topics_;
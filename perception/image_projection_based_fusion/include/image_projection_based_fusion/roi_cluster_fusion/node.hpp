@@ -16,10 +16,13 @@
 #define IMAGE_PROJECTION_BASED_FUSION__ROI_CLUSTER_FUSION__NODE_HPP_
 
 #include "image_projection_based_fusion/fusion_node.hpp"
+#include "image_projection_based_fusion/utils/roi_grid_index.hpp"
 
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
+
 namespace image_projection_based_fusion
 {
 const std::map<std::string, uint8_t> IOU_MODE_MAP{{"iou", 0}, {"iou_x", 1}, {"iou_y", 2}};
@@ -52,11 +55,17 @@ protected:
   double fusion_distance_;
   double trust_object_distance_;
   std::string non_trust_object_iou_mode_{"iou_x"};
+  // values of IOU_MODE_MAP of the iou modes, not to look them up for each pair of ROIs
+  uint8_t trust_object_iou_mode_id_{0};
+  uint8_t non_trust_object_iou_mode_id_{1};
+  // index of the cluster ROIs of an image, only the ones overlapping a ROI can have a non zero IoU
+  RoiGridIndex cluster_roi_index_;
+  std::vector<std::size_t> candidate_cluster_ids_;
   bool is_far_enough(const DetectedObjectWithFeature & obj, const double distance_threshold);
   bool out_of_scope(const DetectedObjectWithFeature & obj);
   double cal_iou_by_mode(
     const sensor_msgs::msg::RegionOfInterest & roi_1,
-    const sensor_msgs::msg::RegionOfInterest & roi_2, const std::string iou_mode);
+    const sensor_msgs::msg::RegionOfInterest & roi_2, const uint8_t iou_mode);
   // bool CheckUnknown(const DetectedObjectsWithFeature & obj);
 };
 
@@ -0,0 +1,94 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef IMAGE_PROJECTION_BASED_FUSION__UTILS__CAMERA_PROJECTION_HPP_
+#define IMAGE_PROJECTION_BASED_FUSION__UTILS__CAMERA_PROJECTION_HPP_
+
+#define EIGEN_MPL2_ONLY
+
+#include <Eigen/Core>
+#include <Eigen/Geometry>
+
+#include <sensor_msgs/msg/camera_info.hpp>
+
+#include <string>
+
+namespace image_projection_based_fusion
+{
+
+/**
+ * @brief Projection of the points of a sensor frame onto the image of a camera.
+ * The projection matrix of the camera info and the transform from the sensor frame to the camera
+ * optical frame are combined into one 3x4 matrix, so that the points are projected without being
+ * transformed to the camera frame first. The third row of the matrix is the depth of the point in
+ * the camera frame, which culls the points behind the camera before the division.
+ */
+class CameraProjection
+{
+public:
+  using Matrix34d = Eigen::Matrix<double, 3, 4>;
+
+  void setCameraInfo(const sensor_msgs::msg::CameraInfo & camera_info);
+  void setTransform(const std::string & source_frame_id, const Eigen::Affine3d & source2camera);
+
+  bool hasCameraInfo() const { return has_camera_info_; }
+  bool hasTransform() const { return has_transform_; }
+  const std::string & getSourceFrameId() const { return source_frame_id_; }
+  const Eigen::Affine3d & getTransform() const { return source2camera_; }
+  /** @brief projection matrix of the camera info, padded to 4x4 */
+  const Eigen::Matrix4d & getCameraProjection() const { return camera_projection_; }
+  /** @brief projection from the source frame to the homogeneous image coordinates */
+  const Matrix34d & getMatrix() const { return source2image_; }
+  double getWidth() const { return width_; }
+  double getHeight() const { return height_; }
+
+  /**
+   * @brief project a point of the source frame onto the image plane
+   * @param point point in the source frame
+   * @param pixel projected point, which may be out of the image
+   * @return false if the point is not in front of the camera, the pixel is then not set
+   */
+  bool project(const Eigen::Vector3d & point, Eigen::Vector2d & pixel) const
+  {
+    const Eigen::Vector3d projected = source2image_ * point.homogeneous();
+    if (projected.z() <= 0.0) {
+      return false;
+    }
+    pixel = projected.head<2>() / projected.z();
+    return true;
+  }
+
+  /** @brief whether the pixel truncated to integers is on the image */
+  bool isOnImage(const Eigen::Vector2d & pixel) const
+  {
+    return 0 <= static_cast<int>(pixel.x()) && static_cast<int>(pixel.x()) <= width_ - 1 &&
+           0 <= static_cast<int>(pixel.y()) && static_cast<int>(pixel.y()) <= height_ - 1;
+  }
+
+private:
+  void updateMatrix();
+
+  bool has_camera_info_{false};
+  bool has_transform_{false};
+  std::string source_frame_id_;
+  double width_{0.0};
+  double height_{0.0};
+  Eigen::Matrix4d camera_projection_{Eigen::Matrix4d::Zero()};
+  Eigen::Affine3d source2camera_{Eigen::Affine3d::Identity()};
+  Matrix34d source2image_{Matrix34d::Zero()};
+};
+
+}  // namespace image_projection_based_fusion
+
+#endif  // IMAGE_PROJECTION_BASED_FUSION__UTILS__CAMERA_PROJECTION_HPP_
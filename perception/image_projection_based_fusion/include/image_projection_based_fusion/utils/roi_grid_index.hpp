@@ -0,0 +1,73 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef IMAGE_PROJECTION_BASED_FUSION__UTILS__ROI_GRID_INDEX_HPP_
+#define IMAGE_PROJECTION_BASED_FUSION__UTILS__ROI_GRID_INDEX_HPP_
+
+#include <sensor_msgs/msg/region_of_interest.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace image_projection_based_fusion
+{
+
+/**
+ * @brief Uniform grid over an image, to find the ROIs which may overlap a given ROI without
+ * comparing it with all of them.
+ * A ROI is added to all the cells its bounds cover, edges included, so that the candidates of a
+ * query are a superset of the ROIs which share at least a point with it.
+ * The cells keep their capacity between frames, so that an index does not allocate once the
+ * number of ROIs is stable.
+ */
+class RoiGridIndex
+{
+public:
+  explicit RoiGridIndex(const std::uint32_t cell_size = 64);
+
+  /** @brief remove all the ROIs and fit the grid to an image */
+  void reset(const std::uint32_t image_width, const std::uint32_t image_height);
+
+  void add(const std::size_t id, const sensor_msgs::msg::RegionOfInterest & roi);
+
+  /**
+   * @brief get the ROIs which may overlap a ROI
+   * @param roi ROI to query, which may be out of the image
+   * @param ids ids of the candidate ROIs, in increasing order
+   */
+  void query(const sensor_msgs::msg::RegionOfInterest & roi, std::vector<std::size_t> & ids);
+
+private:
+  struct CellRange
+  {
+    std::size_t min_x;
+    std::size_t min_y;
+    std::size_t max_x;
+    std::size_t max_y;
+  };
+  CellRange getCellRange(const sensor_msgs::msg::RegionOfInterest & roi) const;
+
+  std::uint32_t cell_size_;
+  std::size_t num_cells_x_{0};
+  std::size_t num_cells_y_{0};
+  std::vector<std::vector<std::size_t>> cells_;
+  // the last query which returned each id, to return it once per query
+  std::vector<std::size_t> last_query_;
+  std::size_t query_count_{0};
+};
+
+}  // namespace image_projection_based_fusion
+
+#endif  // IMAGE_PROJECTION_BASED_FUSION__UTILS__ROI_GRID_INDEX_HPP_
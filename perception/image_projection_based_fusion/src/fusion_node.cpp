@@ -16,6 +16,8 @@
 
 #include "image_projection_based_fusion/fusion_node.hpp"
 
+#include "image_projection_based_fusion/utils/utils.hpp"
+
 #include <Eigen/Core>
 #include <Eigen/Geometry>
 
@@ -23,7 +25,9 @@
 
 #include <boost/optional.hpp>
 
+#include <algorithm>
 #include <cmath>
+#include <iterator>
 
 #ifdef ROS_DISTRO_GALACTIC
 #include <tf2_eigen/tf2_eigen.h>
@@ -80,10 +84,16 @@ FusionNode<Msg, ObjType>::FusionNode(
       "/sensing/camera/camera" + std::to_string(roi_i) + "/image_rect_color");
   }
 
+  use_static_camera_transform_ = declare_parameter("use_static_camera_transform", false);
+
   input_offset_ms_ = declare_parameter("input_offset_ms", std::vector<double>{});
   if (!input_offset_ms_.empty() && rois_number_ != input_offset_ms_.size()) {
     throw std::runtime_error("The number of offsets does not match the number of topics.");
   }
+  rois_timeout_ms_ = declare_parameter("rois_timeout_ms", std::vector<double>{});
+  if (!rois_timeout_ms_.empty() && rois_number_ != rois_timeout_ms_.size()) {
+    throw std::runtime_error("The number of timeouts does not match the number of topics.");
+  }
 
   // sub camera info
   camera_info_subs_.resize(rois_number_);
@@ -152,6 +162,29 @@ void FusionNode<Msg, Obj>::cameraInfoCallback(
   const std::size_t camera_id)
 {
   camera_info_map_[camera_id] = *input_camera_info_msg;
+  camera_projection_map_[camera_id].setCameraInfo(*input_camera_info_msg);
+}
+
+template <class Msg, class Obj>
+const CameraProjection * FusionNode<Msg, Obj>::getCameraProjection(
+  const std::size_t camera_id, const std::string & camera_frame_id,
+  const std::string & source_frame_id, const rclcpp::Time & stamp)
+{
+  auto & camera_projection = camera_projection_map_[camera_id];
+  if (
+    use_static_camera_transform_ && camera_projection.hasTransform() &&
+    camera_projection.getSourceFrameId() == source_frame_id) {
+    return &camera_projection;
+  }
+
+  const auto transform_stamped_optional =
+    getTransformStamped(tf_buffer_, camera_frame_id, source_frame_id, stamp);
+  if (!transform_stamped_optional) {
+    return nullptr;
+  }
+  camera_projection.setTransform(
+    source_frame_id, transformToEigen(transform_stamped_optional.value().transform));
+  return &camera_projection;
 }
 
 template <class Msg, class Obj>
@@ -192,6 +225,7 @@ void FusionNode<Msg, Obj>::subCallback(const typename Msg::ConstSharedPtr input_
     RCLCPP_WARN_THROTTLE(get_logger(), *get_clock(), 5000, "%s", ex.what());
   }
   timer_->reset();
+  timer_start_time_ = this->now();
 
   stop_watch_ptr_->toc("processing_time", true);
 
@@ -211,25 +245,25 @@ void FusionNode<Msg, Obj>::subCallback(const typename Msg::ConstSharedPtr input_
     }
 
     if ((roi_stdmap_.at(roi_i)).size() > 0) {
-      int64_t min_interval = 1e9;
-      int64_t matched_stamp = -1;
-      std::list<int64_t> outdate_stamps;
+      auto & roi_stdmap = roi_stdmap_.at(roi_i);
+      const int64_t new_stamp = timestamp_nsec + input_offset_ms_.at(roi_i) * (int64_t)1e6;
+      const int64_t threshold = match_threshold_ms_ * (int64_t)1e6;
 
-      for (const auto & [k, v] : roi_stdmap_.at(roi_i)) {
-        int64_t new_stamp = timestamp_nsec + input_offset_ms_.at(roi_i) * (int64_t)1e6;
-        int64_t interval = abs(int64_t(k) - new_stamp);
+      // remove outdated stamps, the map is ordered by stamp
+      roi_stdmap.erase(roi_stdmap.begin(), roi_stdmap.lower_bound(new_stamp - threshold));
 
-        if (interval <= min_interval && interval <= match_threshold_ms_ * (int64_t)1e6) {
-          min_interval = interval;
-          matched_stamp = k;
-        } else if (int64_t(k) < new_stamp && interval > match_threshold_ms_ * (int64_t)1e6) {
-          outdate_stamps.push_back(int64_t(k));
-        }
+      // the closest stamp is either the first one not before new_stamp or the one before it, the
+      // later one is preferred when both are as close
+      int64_t matched_stamp = -1;
+      const auto next_itr = roi_stdmap.lower_bound(new_stamp);
+      if (next_itr != roi_stdmap.end() && next_itr->first - new_stamp <= threshold) {
+        matched_stamp = next_itr->first;
       }
-
-      // remove outdated stamps
-      for (auto stamp : outdate_stamps) {
-        (roi_stdmap_.at(roi_i)).erase(stamp);
+      if (next_itr != roi_stdmap.begin()) {
+        const int64_t prev_stamp = std::prev(next_itr)->first;
+        if (matched_stamp == -1 || new_stamp - prev_stamp < matched_stamp - new_stamp) {
+          matched_stamp = prev_stamp;
+        }
       }
 
       // fuseOnSingle
@@ -279,6 +313,9 @@ void FusionNode<Msg, Obj>::subCallback(const typename Msg::ConstSharedPtr input_
   } else {
     sub_std_pair_.first = int64_t(timestamp_nsec);
     sub_std_pair_.second = output_msg;
+    if (!rois_timeout_ms_.empty()) {
+      updateTimeout();
+    }
     processing_time_ms = stop_watch_ptr_->toc("processing_time", true);
   }
 }
@@ -339,6 +376,8 @@ void FusionNode<Msg, Obj>::roiCallback(
             processing_time_ms + stop_watch_ptr_->toc("processing_time", true));
           processing_time_ms = 0;
         }
+      } else if (!rois_timeout_ms_.empty()) {
+        updateTimeout();
       }
       processing_time_ms = processing_time_ms + stop_watch_ptr_->toc("processing_time", true);
       return;
@@ -393,6 +432,30 @@ void FusionNode<Msg, Obj>::timer_callback()
   }
 }
 
+template <class Msg, class Obj>
+void FusionNode<Msg, Obj>::updateTimeout()
+{
+  // wait for the camera which is not fused yet with the longest timeout
+  double timeout_ms = 0.0;
+  for (std::size_t roi_i = 0; roi_i < rois_number_; ++roi_i) {
+    if (!is_fused_.at(roi_i)) {
+      timeout_ms = std::max(timeout_ms, rois_timeout_ms_.at(roi_i));
+    }
+  }
+
+  // the timer is restarted, so its period is the time left until the timeout
+  const double elapsed_ms = (this->now() - timer_start_time_).seconds() * 1e3;
+  constexpr double min_period_ms = 1.0;
+  const auto period = std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::duration<double, std::milli>(std::max(timeout_ms - elapsed_ms, min_period_ms)));
+  try {
+    setPeriod(period.count());
+  } catch (rclcpp::exceptions::RCLError & ex) {
+    RCLCPP_WARN_THROTTLE(get_logger(), *get_clock(), 5000, "%s", ex.what());
+  }
+  timer_->reset();
+}
+
 template <class Msg, class Obj>
 void FusionNode<Msg, Obj>::setPeriod(const int64_t new_period)
 {
@@ -30,18 +30,6 @@
 
 #include <chrono>
 
-namespace
-{
-
-Eigen::Affine3f _transformToEigen(const geometry_msgs::msg::Transform & t)
-{
-  Eigen::Affine3f a;
-  a.matrix() = tf2::transformToEigen(t).matrix().cast<float>();
-  return a;
-}
-
-}  // namespace
-
 namespace image_projection_based_fusion
 {
 
@@ -159,13 +147,6 @@ PointPaintingFusionNode::PointPaintingFusionNode(const rclcpp::NodeOptions & opt
   sub_ = this->create_subscription<sensor_msgs::msg::PointCloud2>(
     "~/input/pointcloud", rclcpp::SensorDataQoS().keep_last(3), sub_callback);
 
-  tan_h_.resize(rois_number_);
-  for (std::size_t roi_i = 0; roi_i < rois_number_; ++roi_i) {
-    auto fx = camera_info_map_[roi_i].k.at(0);
-    auto x0 = camera_info_map_[roi_i].k.at(2);
-    tan_h_[roi_i] = x0 / fx;
-  }
-
   detection_class_remapper_.setParameters(
     allow_remapping_by_area_matrix, min_area_matrix, max_area_matrix);
 
@@ -269,23 +250,14 @@ void PointPaintingFusionNode::fuseOnSingleImage(
   std::vector<sensor_msgs::msg::RegionOfInterest> debug_image_rois;
   std::vector<Eigen::Vector2d> debug_image_points;
 
-  // get transform from cluster frame id to camera optical frame id
-  // geometry_msgs::msg::TransformStamped transform_stamped;
-  Eigen::Affine3f lidar2cam_affine;
-  {
-    const auto transform_stamped_optional = getTransformStamped(
-      tf_buffer_, /*target*/ input_roi_msg.header.frame_id,
-      /*source*/ painted_pointcloud_msg.header.frame_id, input_roi_msg.header.stamp);
-    if (!transform_stamped_optional) {
-      return;
-    }
-    lidar2cam_affine = _transformToEigen(transform_stamped_optional.value().transform);
+  // get projection from pointcloud frame id onto the image of the camera
+  const auto * camera_projection = getCameraProjection(
+    image_id, /*target*/ input_roi_msg.header.frame_id,
+    /*source*/ painted_pointcloud_msg.header.frame_id, input_roi_msg.header.stamp);
+  if (!camera_projection) {
+    return;
   }
 
-  // transform
-  // sensor_msgs::msg::PointCloud2 transformed_pointcloud;
-  // tf2::doTransform(painted_pointcloud_msg, transformed_pointcloud, transform_stamped);
-
   const auto x_offset =
     painted_pointcloud_msg.fields.at(static_cast<size_t>(autoware_point_types::PointIndex::X))
       .offset;
@@ -297,18 +269,10 @@ void PointPaintingFusionNode::fuseOnSingleImage(
       .offset;
   const auto class_offset = painted_pointcloud_msg.fields.at(4).offset;
   const auto p_step = painted_pointcloud_msg.point_step;
-  // projection matrix
-  Eigen::Matrix3f camera_projection;  // use only x,y,z
-  camera_projection << camera_info.p.at(0), camera_info.p.at(1), camera_info.p.at(2),
-    camera_info.p.at(4), camera_info.p.at(5), camera_info.p.at(6);
-  Eigen::Vector3f point_lidar, point_camera;
-  /** dc : don't care
-
-x    | f  x1 x2  dc ||xc|
-y  = | y1  f y2  dc ||yc|
-dc   | dc dc dc  dc ||zc|
-                     |dc|
-   **/
+  // projection from the lidar frame to the homogeneous image coordinates (x * zc, y * zc, zc),
+  // zc being the depth in the camera frame
+  const Eigen::Matrix<float, 3, 4> lidar2image = camera_projection->getMatrix().cast<float>();
+  const float image_width = static_cast<float>(camera_projection->getWidth());
 
   auto objects = input_roi_msg.feature_objects;
   int iterations = painted_pointcloud_msg.data.size() / painted_pointcloud_msg.point_step;
@@ -323,17 +287,16 @@ dc   | dc dc dc  dc ||zc|
     float p_x = *reinterpret_cast<const float *>(&data[stride + x_offset]);
     float p_y = *reinterpret_cast<const float *>(&data[stride + y_offset]);
     float p_z = *reinterpret_cast<const float *>(&data[stride + z_offset]);
-    point_lidar << p_x, p_y, p_z;
-    point_camera = lidar2cam_affine * point_lidar;
-    p_x = point_camera.x();
-    p_y = point_camera.y();
-    p_z = point_camera.z();
+    const Eigen::Vector3f normalized_projected_point =
+      lidar2image * Eigen::Vector4f(p_x, p_y, p_z, 1.0f);
+    p_z = normalized_projected_point.z();
 
-    if (p_z <= 0.0 || p_x > (tan_h_.at(image_id) * p_z) || p_x < (-tan_h_.at(image_id) * p_z)) {
+    // cull the points behind the camera or out of its horizontal field of view
+    if (
+      p_z <= 0.0 || normalized_projected_point.x() < 0.0 ||
+      normalized_projected_point.x() > image_width * p_z) {
       continue;
     }
-    // project
-    Eigen::Vector3f normalized_projected_point = camera_projection * Eigen::Vector3f(p_x, p_y, p_z);
     // iterate 2d bbox
     for (const auto & feature_object : objects) {
       sensor_msgs::msg::RegionOfInterest roi = feature_object.feature.roi;
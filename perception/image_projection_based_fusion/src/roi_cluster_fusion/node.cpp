@@ -46,6 +46,8 @@ RoiClusterFusionNode::RoiClusterFusionNode(const rclcpp::NodeOptions & options)
   remove_unknown_ = declare_parameter<bool>("remove_unknown");
   fusion_distance_ = declare_parameter<double>("fusion_distance");
   trust_object_distance_ = declare_parameter<double>("trust_object_distance");
+  trust_object_iou_mode_id_ = IOU_MODE_MAP.at(trust_object_iou_mode_);
+  non_trust_object_iou_mode_id_ = IOU_MODE_MAP.at(non_trust_object_iou_mode_);
 }
 
 void RoiClusterFusionNode::preprocess(DetectedObjectsWithFeature & output_cluster_msg)
@@ -88,21 +90,12 @@ void RoiClusterFusionNode::fuseOnSingleImage(
   std::vector<sensor_msgs::msg::RegionOfInterest> debug_pointcloud_rois;
   std::vector<Eigen::Vector2d> debug_image_points;
 
-  Eigen::Matrix4d projection;
-  projection << camera_info.p.at(0), camera_info.p.at(1), camera_info.p.at(2), camera_info.p.at(3),
-    camera_info.p.at(4), camera_info.p.at(5), camera_info.p.at(6), camera_info.p.at(7),
-    camera_info.p.at(8), camera_info.p.at(9), camera_info.p.at(10), camera_info.p.at(11);
-
-  // get transform from cluster frame id to camera optical frame id
-  geometry_msgs::msg::TransformStamped transform_stamped;
-  {
-    const auto transform_stamped_optional = getTransformStamped(
-      tf_buffer_, /*target*/ camera_info.header.frame_id,
-      /*source*/ input_cluster_msg.header.frame_id, camera_info.header.stamp);
-    if (!transform_stamped_optional) {
-      return;
-    }
-    transform_stamped = transform_stamped_optional.value();
+  // get projection from cluster frame id onto the image of the camera
+  const auto * camera_projection = getCameraProjection(
+    image_id, /*target*/ camera_info.header.frame_id,
+    /*source*/ input_cluster_msg.header.frame_id, camera_info.header.stamp);
+  if (!camera_projection) {
+    return;
   }
 
   std::map<std::size_t, RegionOfInterest> m_cluster_roi;
@@ -120,32 +113,21 @@ void RoiClusterFusionNode::fuseOnSingleImage(
       continue;
     }
 
-    sensor_msgs::msg::PointCloud2 transformed_cluster;
-    tf2::doTransform(
-      input_cluster_msg.feature_objects.at(i).feature.cluster, transformed_cluster,
-      transform_stamped);
-
+    // the cluster is projected from its own frame, without being transformed to the camera frame
+    const auto & cluster = input_cluster_msg.feature_objects.at(i).feature.cluster;
     int min_x(camera_info.width), min_y(camera_info.height), max_x(0), max_y(0);
     std::vector<Eigen::Vector2d> projected_points;
-    projected_points.reserve(transformed_cluster.data.size());
-    for (sensor_msgs::PointCloud2ConstIterator<float> iter_x(transformed_cluster, "x"),
-         iter_y(transformed_cluster, "y"), iter_z(transformed_cluster, "z");
+    projected_points.reserve(cluster.data.size());
+    for (sensor_msgs::PointCloud2ConstIterator<float> iter_x(cluster, "x"), iter_y(cluster, "y"),
+         iter_z(cluster, "z");
          iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
-      if (*iter_z <= 0.0) {
+      Eigen::Vector2d normalized_projected_point;
+      if (!camera_projection->project(
+            Eigen::Vector3d(*iter_x, *iter_y, *iter_z), normalized_projected_point)) {
         continue;
       }
 
-      Eigen::Vector4d projected_point =
-        projection * Eigen::Vector4d(*iter_x, *iter_y, *iter_z, 1.0);
-      Eigen::Vector2d normalized_projected_point = Eigen::Vector2d(
-        projected_point.x() / projected_point.z(), projected_point.y() / projected_point.z());
-      if (
-        0 <= static_cast<int>(normalized_projected_point.x()) &&
-        static_cast<int>(normalized_projected_point.x()) <=
-          static_cast<int>(camera_info.width) - 1 &&
-        0 <= static_cast<int>(normalized_projected_point.y()) &&
-        static_cast<int>(normalized_projected_point.y()) <=
-          static_cast<int>(camera_info.height) - 1) {
+      if (camera_projection->isOnImage(normalized_projected_point)) {
         min_x = std::min(static_cast<int>(normalized_projected_point.x()), min_x);
         min_y = std::min(static_cast<int>(normalized_projected_point.y()), min_y);
         max_x = std::max(static_cast<int>(normalized_projected_point.x()), max_x);
@@ -168,29 +150,38 @@ void RoiClusterFusionNode::fuseOnSingleImage(
     debug_pointcloud_rois.push_back(roi);
   }
 
+  // all the iou modes are zero if the ROIs do not overlap, so a ROI is only compared with the
+  // cluster ROIs of the cells it covers
+  cluster_roi_index_.reset(camera_info.width, camera_info.height);
+  for (const auto & cluster_map : m_cluster_roi) {
+    cluster_roi_index_.add(cluster_map.first, cluster_map.second);
+  }
+
   for (const auto & feature_obj : input_roi_msg.feature_objects) {
     int index = -1;
     bool associated = false;
     double max_iou = 0.0;
     bool is_roi_label_known =
       feature_obj.object.classification.front().label != ObjectClassification::UNKNOWN;
-    for (const auto & cluster_map : m_cluster_roi) {
+    // the candidates are in increasing order as m_cluster_roi, so ties are broken the same way
+    cluster_roi_index_.query(feature_obj.feature.roi, candidate_cluster_ids_);
+    for (const auto cluster_id : candidate_cluster_ids_) {
+      const auto & cluster_roi = m_cluster_roi.at(cluster_id);
       double iou(0.0);
-      bool is_use_non_trust_object_iou_mode = is_far_enough(
-        input_cluster_msg.feature_objects.at(cluster_map.first), trust_object_distance_);
+      bool is_use_non_trust_object_iou_mode =
+        is_far_enough(input_cluster_msg.feature_objects.at(cluster_id), trust_object_distance_);
       if (is_use_non_trust_object_iou_mode || is_roi_label_known) {
-        iou =
-          cal_iou_by_mode(cluster_map.second, feature_obj.feature.roi, non_trust_object_iou_mode_);
+        iou = cal_iou_by_mode(cluster_roi, feature_obj.feature.roi, non_trust_object_iou_mode_id_);
       } else {
-        iou = cal_iou_by_mode(cluster_map.second, feature_obj.feature.roi, trust_object_iou_mode_);
+        iou = cal_iou_by_mode(cluster_roi, feature_obj.feature.roi, trust_object_iou_mode_id_);
       }
 
       const bool passed_inside_cluster_gate =
         only_allow_inside_cluster_
-          ? is_inside(feature_obj.feature.roi, cluster_map.second, roi_scale_factor_)
+          ? is_inside(feature_obj.feature.roi, cluster_roi, roi_scale_factor_)
           : true;
       if (max_iou < iou && passed_inside_cluster_gate) {
-        index = cluster_map.first;
+        index = cluster_id;
         max_iou = iou;
         associated = true;
       }
@@ -282,9 +273,9 @@ bool RoiClusterFusionNode::is_far_enough(
 
 double RoiClusterFusionNode::cal_iou_by_mode(
   const sensor_msgs::msg::RegionOfInterest & roi_1,
-  const sensor_msgs::msg::RegionOfInterest & roi_2, const std::string iou_mode)
+  const sensor_msgs::msg::RegionOfInterest & roi_2, const uint8_t iou_mode)
 {
-  switch (IOU_MODE_MAP.at(iou_mode)) {
+  switch (iou_mode) {
     case 0 /* use iou mode */:
       return calcIoU(roi_1, roi_2);
 
@@ -76,26 +76,18 @@ void RoiDetectedObjectFusionNode::fuseOnSingleImage(
   const sensor_msgs::msg::CameraInfo & camera_info,
   DetectedObjects & output_object_msg __attribute__((unused)))
 {
-  Eigen::Affine3d object2camera_affine;
-  {
-    const auto transform_stamped_optional = getTransformStamped(
-      tf_buffer_, /*target*/ input_roi_msg.header.frame_id,
-      /*source*/ input_object_msg.header.frame_id, input_roi_msg.header.stamp);
-    if (!transform_stamped_optional) {
-      return;
-    }
-    object2camera_affine = transformToEigen(transform_stamped_optional.value().transform);
+  const auto * camera_projection = getCameraProjection(
+    image_id, /*target*/ input_roi_msg.header.frame_id,
+    /*source*/ input_object_msg.header.frame_id, input_roi_msg.header.stamp);
+  if (!camera_projection) {
+    return;
   }
-
-  Eigen::Matrix4d camera_projection;
-  camera_projection << camera_info.p.at(0), camera_info.p.at(1), camera_info.p.at(2),
-    camera_info.p.at(3), camera_info.p.at(4), camera_info.p.at(5), camera_info.p.at(6),
-    camera_info.p.at(7), camera_info.p.at(8), camera_info.p.at(9), camera_info.p.at(10),
-    camera_info.p.at(11);
+  const auto & object2camera_affine = camera_projection->getTransform();
+  const auto & camera_projection_matrix = camera_projection->getCameraProjection();
 
   const auto object_roi_map = generateDetectedObjectRoIs(
     input_object_msg, static_cast<double>(camera_info.width),
-    static_cast<double>(camera_info.height), object2camera_affine, camera_projection);
+    static_cast<double>(camera_info.height), object2camera_affine, camera_projection_matrix);
   fuseObjectsOnImage(input_object_msg, input_roi_msg.feature_objects, object_roi_map);
 
   if (debugger_) {
@@ -71,10 +71,9 @@ void RoiPointCloudFusionNode::postprocess(__attribute__((unused))
   }
 }
 void RoiPointCloudFusionNode::fuseOnSingleImage(
-  const sensor_msgs::msg::PointCloud2 & input_pointcloud_msg,
-  __attribute__((unused)) const std::size_t image_id,
+  const sensor_msgs::msg::PointCloud2 & input_pointcloud_msg, const std::size_t image_id,
   const DetectedObjectsWithFeature & input_roi_msg,
-  const sensor_msgs::msg::CameraInfo & camera_info,
+  __attribute__((unused)) const sensor_msgs::msg::CameraInfo & camera_info,
   __attribute__((unused)) sensor_msgs::msg::PointCloud2 & output_pointcloud_msg)
 {
   if (input_pointcloud_msg.data.empty()) {
@@ -98,40 +97,26 @@ void RoiPointCloudFusionNode::fuseOnSingleImage(
     return;
   }
 
-  // transform pointcloud to camera optical frame id
-  Eigen::Matrix4d projection;
-  projection << camera_info.p.at(0), camera_info.p.at(1), camera_info.p.at(2), camera_info.p.at(3),
-    camera_info.p.at(4), camera_info.p.at(5), camera_info.p.at(6), camera_info.p.at(7),
-    camera_info.p.at(8), camera_info.p.at(9), camera_info.p.at(10), camera_info.p.at(11);
-  geometry_msgs::msg::TransformStamped transform_stamped;
-  {
-    const auto transform_stamped_optional = getTransformStamped(
-      tf_buffer_, input_roi_msg.header.frame_id, input_pointcloud_msg.header.frame_id,
-      input_roi_msg.header.stamp);
-    if (!transform_stamped_optional) {
-      return;
-    }
-    transform_stamped = transform_stamped_optional.value();
+  // get projection from pointcloud frame id onto the image of the camera
+  const auto * camera_projection = getCameraProjection(
+    image_id, input_roi_msg.header.frame_id, input_pointcloud_msg.header.frame_id,
+    input_roi_msg.header.stamp);
+  if (!camera_projection) {
+    return;
   }
 
-  sensor_msgs::msg::PointCloud2 transformed_cloud;
-  tf2::doTransform(input_pointcloud_msg, transformed_cloud, transform_stamped);
-
   std::vector<PointCloud> clusters;
   clusters.resize(output_objs.size());
 
-  for (sensor_msgs::PointCloud2ConstIterator<float> iter_x(transformed_cloud, "x"),
-       iter_y(transformed_cloud, "y"), iter_z(transformed_cloud, "z"),
-       iter_orig_x(input_pointcloud_msg, "x"), iter_orig_y(input_pointcloud_msg, "y"),
-       iter_orig_z(input_pointcloud_msg, "z");
-       iter_x != iter_x.end();
-       ++iter_x, ++iter_y, ++iter_z, ++iter_orig_x, ++iter_orig_y, ++iter_orig_z) {
-    if (*iter_z <= 0.0) {
+  // the points are projected from the pointcloud frame, without a transformed copy of the cloud
+  for (sensor_msgs::PointCloud2ConstIterator<float> iter_x(input_pointcloud_msg, "x"),
+       iter_y(input_pointcloud_msg, "y"), iter_z(input_pointcloud_msg, "z");
+       iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
+    Eigen::Vector2d normalized_projected_point;
+    if (!camera_projection->project(
+          Eigen::Vector3d(*iter_x, *iter_y, *iter_z), normalized_projected_point)) {
       continue;
     }
-    Eigen::Vector4d projected_point = projection * Eigen::Vector4d(*iter_x, *iter_y, *iter_z, 1.0);
-    Eigen::Vector2d normalized_projected_point = Eigen::Vector2d(
-      projected_point.x() / projected_point.z(), projected_point.y() / projected_point.z());
 
     for (std::size_t i = 0; i < output_objs.size(); ++i) {
       auto & feature_obj = output_objs.at(i);
@@ -143,7 +128,7 @@ void RoiPointCloudFusionNode::fuseOnSingleImage(
         check_roi.y_offset <= normalized_projected_point.y() &&
         check_roi.x_offset + check_roi.width >= normalized_projected_point.x() &&
         check_roi.y_offset + check_roi.height >= normalized_projected_point.y()) {
-        cluster.push_back(pcl::PointXYZ(*iter_orig_x, *iter_orig_y, *iter_orig_z));
+        cluster.push_back(pcl::PointXYZ(*iter_x, *iter_y, *iter_z));
       }
     }
   }
@@ -0,0 +1,46 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "image_projection_based_fusion/utils/camera_projection.hpp"
+
+namespace image_projection_based_fusion
+{
+
+void CameraProjection::setCameraInfo(const sensor_msgs::msg::CameraInfo & camera_info)
+{
+  camera_projection_ << camera_info.p.at(0), camera_info.p.at(1), camera_info.p.at(2),
+    camera_info.p.at(3), camera_info.p.at(4), camera_info.p.at(5), camera_info.p.at(6),
+    camera_info.p.at(7), camera_info.p.at(8), camera_info.p.at(9), camera_info.p.at(10),
+    camera_info.p.at(11), 0.0, 0.0, 0.0, 0.0;
+  width_ = static_cast<double>(camera_info.width);
+  height_ = static_cast<double>(camera_info.height);
+  has_camera_info_ = true;
+  updateMatrix();
+}
+
+void CameraProjection::setTransform(
+  const std::string & source_frame_id, const Eigen::Affine3d & source2camera)
+{
+  source_frame_id_ = source_frame_id;
+  source2camera_ = source2camera;
+  has_transform_ = true;
+  updateMatrix();
+}
+
+void CameraProjection::updateMatrix()
+{
+  source2image_ = camera_projection_.topRows<3>() * source2camera_.matrix();
+}
+
+}  // namespace image_projection_based_fusion
@@ -0,0 +1,83 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "image_projection_based_fusion/utils/roi_grid_index.hpp"
+
+#include <algorithm>
+
+namespace image_projection_based_fusion
+{
+
+RoiGridIndex::RoiGridIndex(const std::uint32_t cell_size) : cell_size_(std::max(cell_size, 1u))
+{
+}
+
+void RoiGridIndex::reset(const std::uint32_t image_width, const std::uint32_t image_height)
+{
+  num_cells_x_ = std::max<std::size_t>(1, (image_width + cell_size_ - 1) / cell_size_);
+  num_cells_y_ = std::max<std::size_t>(1, (image_height + cell_size_ - 1) / cell_size_);
+  cells_.resize(num_cells_x_ * num_cells_y_);
+  for (auto & cell : cells_) {
+    cell.clear();
+  }
+}
+
+void RoiGridIndex::add(const std::size_t id, const sensor_msgs::msg::RegionOfInterest & roi)
+{
+  const auto range = getCellRange(roi);
+  for (std::size_t y = range.min_y; y <= range.max_y; ++y) {
+    for (std::size_t x = range.min_x; x <= range.max_x; ++x) {
+      cells_.at(y * num_cells_x_ + x).push_back(id);
+    }
+  }
+  if (last_query_.size() <= id) {
+    last_query_.resize(id + 1, query_count_);
+  }
+}
+
+void RoiGridIndex::query(
+  const sensor_msgs::msg::RegionOfInterest & roi, std::vector<std::size_t> & ids)
+{
+  ids.clear();
+  ++query_count_;
+  const auto range = getCellRange(roi);
+  for (std::size_t y = range.min_y; y <= range.max_y; ++y) {
+    for (std::size_t x = range.min_x; x <= range.max_x; ++x) {
+      for (const auto id : cells_.at(y * num_cells_x_ + x)) {
+        if (last_query_.at(id) != query_count_) {
+          last_query_.at(id) = query_count_;
+          ids.push_back(id);
+        }
+      }
+    }
+  }
+  std::sort(ids.begin(), ids.end());
+}
+
+RoiGridIndex::CellRange RoiGridIndex::getCellRange(
+  const sensor_msgs::msg::RegionOfInterest & roi) const
+{
+  // the parts of a ROI out of the image are in the cells of its border, so that a query out of
+  // the image still gets the ROIs at the border
+  const auto to_cell = [this](const std::uint64_t pixel, const std::size_t num_cells) {
+    return std::min<std::size_t>(pixel / cell_size_, num_cells - 1);
+  };
+  const std::uint64_t max_x = static_cast<std::uint64_t>(roi.x_offset) + roi.width;
+  const std::uint64_t max_y = static_cast<std::uint64_t>(roi.y_offset) + roi.height;
+  return CellRange{
+    to_cell(roi.x_offset, num_cells_x_), to_cell(roi.y_offset, num_cells_y_),
+    to_cell(max_x, num_cells_x_), to_cell(max_y, num_cells_y_)};
+}
+
+}  // namespace image_projection_based_fusion
@@ -46,9 +46,11 @@
 #ifndef LIDAR_APOLLO_INSTANCE_SEGMENTATION__CLUSTER2D_HPP_
 #define LIDAR_APOLLO_INSTANCE_SEGMENTATION__CLUSTER2D_HPP_
 
+#include "cluster2d_kernel.hpp"
 #include "disjoint_set.hpp"
 #include "util.hpp"
 
+#include <cuda_utils/cuda_unique_ptr.hpp>
 #include <std_msgs/msg/header.hpp>
 #include <tier4_perception_msgs/msg/detected_object_with_feature.hpp>
 #include <tier4_perception_msgs/msg/detected_objects_with_feature.hpp>
@@ -57,6 +59,8 @@
 #include <pcl/point_cloud.h>
 #include <pcl/point_types.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <vector>
 
@@ -100,6 +104,20 @@ public:
     const pcl::PointIndices & valid_indices, float objectness_thresh,
     bool use_all_grids_for_clustering);
 
+  /**
+   * @brief cluster the output of the network on the GPU, with all the grids used for clustering.
+   * Only the sums of the obstacles and the obstacle of each point are copied back, instead of the
+   * whole output, and the obstacles are the same as the ones of cluster() then filter() and
+   * classify(), but for the rounding of the sums.
+   * @param inferred_data_d output of the network on the device
+   * @param points_d points of pc_ptr on the device
+   * @param point_step size of a point in points_d
+   */
+  void clusterOnDevice(
+    const float * inferred_data_d, const std::uint8_t * points_d, const std::size_t point_step,
+    const pcl::PointCloud<pcl::PointXYZI>::Ptr & pc_ptr, float objectness_thresh,
+    cudaStream_t stream);
+
   void filter(const float * inferred_data);
   void classify(const float * inferred_data);
 
@@ -126,6 +144,18 @@ private:
   pcl::PointCloud<pcl::PointXYZI>::Ptr pc_ptr_;
   const std::vector<int> * valid_indices_in_pc_ = nullptr;
 
+  // buffers of clusterOnDevice(), allocated at its first call
+  cuda_utils::CudaUniquePtr<int[]> workspace_d_;
+  cuda_utils::CudaUniquePtr<std::uint8_t[]> workspace_flags_d_;
+  cuda_utils::CudaUniquePtr<int[]> num_obstacles_d_;
+  cuda_utils::CudaUniquePtr<ObstacleSums[]> obstacle_sums_d_;
+  cuda_utils::CudaUniquePtr<int[]> point_obstacle_ids_d_;
+  std::size_t point_obstacle_ids_d_capacity_{0};
+  std::vector<ObstacleSums> obstacle_sums_;
+  // obstacle of each point of pc_ptr_ after clusterOnDevice(), used instead of point2grid_ and
+  // id_img_ while valid_indices_in_pc_ is null
+  std::vector<int> point_obstacle_ids_;
+
   struct Node
   {
     Node * center_node;
@@ -0,0 +1,89 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LIDAR_APOLLO_INSTANCE_SEGMENTATION__CLUSTER2D_KERNEL_HPP_
+#define LIDAR_APOLLO_INSTANCE_SEGMENTATION__CLUSTER2D_KERNEL_HPP_
+
+#include <cuda.h>
+#include <cuda_runtime_api.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace lidar_apollo_instance_segmentation
+{
+constexpr int CLUSTER2D_NUM_CLASSES = 5;
+
+// Geometry of the output of the network, the same as in Cluster2D
+struct Cluster2DLayout
+{
+  int rows;
+  int cols;
+  float range;
+  float scale;
+  float inv_res_x;
+  float inv_res_y;
+  float objectness_thresh;
+};
+
+// Sums over the grids of an obstacle, of which Cluster2D::filter and Cluster2D::classify compute
+// the means
+struct ObstacleSums
+{
+  float grid_num;
+  float score;
+  float height;
+  float heading_x;
+  float heading_y;
+  float meta_type_probabilities[CLUSTER2D_NUM_CLASSES];
+};
+
+// Work buffers of clusterObstacles_launch, with one element per grid each
+struct Cluster2DWorkspace
+{
+  int * next[2];
+  int * min_ids[2];
+  int * labels;
+  int * roots;
+  int * first_grids;
+  int * is_first;
+  int * first_ids;
+  int * obstacle_ids;
+  std::uint8_t * is_object;
+  std::uint8_t * on_cycle;
+  std::uint8_t * is_reached;
+};
+
+// inferred_data (float): output of the network, the same as Cluster2D::cluster
+// obstacle_ids (int): (rows * cols) in workspace, obstacle of each grid or -1
+// num_obstacles (int): (1), the obstacles are numbered in the raster order of their first grid,
+// as in Cluster2D::cluster with all the grids used for clustering
+cudaError_t clusterObstacles_launch(
+  const float * inferred_data, const Cluster2DLayout layout, Cluster2DWorkspace workspace,
+  int * num_obstacles, cudaStream_t stream);
+
+// obstacle_sums (ObstacleSums): (num_obstacles), which are set to zero first
+cudaError_t sumObstacles_launch(
+  const float * inferred_data, const Cluster2DLayout layout, const int * obstacle_ids,
+  const int num_obstacles, ObstacleSums * obstacle_sums, cudaStream_t stream);
+
+// points (uint8): (num_points, point_step), float32 x and y at 0, as in pcl::PointXYZI
+// point_obstacle_ids (int): (num_points), obstacle of the grid of each point or -1
+cudaError_t assignPoints_launch(
+  const std::uint8_t * points, const std::size_t num_points, const std::size_t point_step,
+  const Cluster2DLayout layout, const int * obstacle_ids, int * point_obstacle_ids,
+  cudaStream_t stream);
+}  // namespace lidar_apollo_instance_segmentation
+
+#endif  // LIDAR_APOLLO_INSTANCE_SEGMENTATION__CLUSTER2D_KERNEL_HPP_
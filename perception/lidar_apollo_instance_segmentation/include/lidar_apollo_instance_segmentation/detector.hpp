@@ -64,6 +64,14 @@ private:
   std::string target_frame_;
   float z_offset_;
 
+  // generate the feature map directly in input_d_, instead of on the CPU
+  bool use_gpu_feature_generation_;
+  // cluster the output on the GPU, instead of copying output_d_ back to cluster it on the CPU
+  bool use_gpu_clustering_;
+  CudaUniquePtr<pcl::PointXYZI[]> points_d_;
+  size_t points_d_capacity_{0};
+  CudaUniquePtr<unsigned int[]> top_point_indices_d_;
+
   size_t output_size_;
   CudaUniquePtr<float[]> input_d_;
   CudaUniquePtr<float[]> output_d_;
@@ -15,6 +15,7 @@
 #ifndef LIDAR_APOLLO_INSTANCE_SEGMENTATION__FEATURE_GENERATOR_HPP_
 #define LIDAR_APOLLO_INSTANCE_SEGMENTATION__FEATURE_GENERATOR_HPP_
 
+#include "lidar_apollo_instance_segmentation/feature_generator_kernel.hpp"
 #include "lidar_apollo_instance_segmentation/feature_map.hpp"
 #include "util.hpp"
 
@@ -22,6 +23,7 @@
 #include <pcl/point_types.h>
 
 #include <memory>
+#include <vector>
 
 namespace lidar_apollo_instance_segmentation
 {
@@ -33,6 +35,8 @@ private:
   bool use_intensity_feature_;
   bool use_constant_feature_;
   std::shared_ptr<FeatureMapInterface> map_ptr_;
+  // cell of each point of the last pointcloud, kept for its capacity
+  std::vector<int> point_cells_;
 
 public:
   FeatureGenerator(
@@ -42,6 +46,12 @@ public:
 
   std::shared_ptr<FeatureMapInterface> generate(
     const pcl::PointCloud<pcl::PointXYZI>::Ptr & pc_ptr);
+
+  // feature map of which generate() updates the data, the constant channels included
+  std::shared_ptr<FeatureMapInterface> getFeatureMap() const { return map_ptr_; }
+
+  // layout of the feature map for generateFeatures_launch, which computes generate() on the GPU
+  FeatureMapLayout getFeatureMapLayout() const;
 };
 }  // namespace lidar_apollo_instance_segmentation
 
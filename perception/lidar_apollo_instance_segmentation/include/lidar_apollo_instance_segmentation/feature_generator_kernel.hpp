@@ -0,0 +1,55 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LIDAR_APOLLO_INSTANCE_SEGMENTATION__FEATURE_GENERATOR_KERNEL_HPP_
+#define LIDAR_APOLLO_INSTANCE_SEGMENTATION__FEATURE_GENERATOR_KERNEL_HPP_
+
+#include <cuda.h>
+#include <cuda_runtime_api.h>
+
+#include <cstddef>
+#include <cstdint>
+
+namespace lidar_apollo_instance_segmentation
+{
+// Geometry of a feature map, and the indices of its channels, -1 if a channel is not used.
+// The direction and distance channels do not depend on the pointcloud, so they are not written.
+struct FeatureMapLayout
+{
+  int width;
+  int height;
+  float range;
+  float inv_res_x;
+  float inv_res_y;
+  float min_height;
+  float max_height;
+  int max_height_channel;
+  int mean_height_channel;
+  int count_channel;
+  int top_intensity_channel;
+  int mean_intensity_channel;
+  int nonempty_channel;
+};
+
+// points (uint8): (num_points, point_step), float32 x, y and z at 0 and intensity at
+// intensity_offset, as in pcl::PointXYZI
+// top_point_indices (uint): (height * width), work buffer
+// features (float): (channels, height, width), the same as FeatureGenerator::generate
+cudaError_t generateFeatures_launch(
+  const std::uint8_t * points, const std::size_t num_points, const std::size_t point_step,
+  const std::size_t intensity_offset, const FeatureMapLayout layout,
+  unsigned int * top_point_indices, float * features, cudaStream_t stream);
+}  // namespace lidar_apollo_instance_segmentation
+
+#endif  // LIDAR_APOLLO_INSTANCE_SEGMENTATION__FEATURE_GENERATOR_KERNEL_HPP_
@@ -199,6 +199,92 @@ void Cluster2D::cluster(
   classify(inferred_data);
 }
 
+void Cluster2D::clusterOnDevice(
+  const float * inferred_data_d, const std::uint8_t * points_d, const std::size_t point_step,
+  const pcl::PointCloud<pcl::PointXYZI>::Ptr & pc_ptr, float objectness_thresh,
+  cudaStream_t stream)
+{
+  constexpr int NUM_WORKSPACE_BUFFERS = 10;
+  constexpr int NUM_WORKSPACE_FLAGS = 3;
+  if (!workspace_d_) {
+    workspace_d_ = cuda_utils::make_unique<int[]>(NUM_WORKSPACE_BUFFERS * size_);
+    workspace_flags_d_ = cuda_utils::make_unique<std::uint8_t[]>(NUM_WORKSPACE_FLAGS * size_);
+    num_obstacles_d_ = cuda_utils::make_unique<int[]>(1);
+    obstacle_sums_d_ = cuda_utils::make_unique<ObstacleSums[]>(size_);
+  }
+  const std::size_t num_points = pc_ptr->points.size();
+  if (point_obstacle_ids_d_capacity_ < num_points) {
+    point_obstacle_ids_d_capacity_ = num_points;
+    point_obstacle_ids_d_ = cuda_utils::make_unique<int[]>(point_obstacle_ids_d_capacity_);
+  }
+
+  // the workspace is made of slices of size_ elements of the buffers
+  Cluster2DWorkspace workspace;
+  int * buffer = workspace_d_.get();
+  const auto next_buffer = [this, &buffer]() {
+    int * data = buffer;
+    buffer += size_;
+    return data;
+  };
+  workspace.next[0] = next_buffer();
+  workspace.next[1] = next_buffer();
+  workspace.min_ids[0] = next_buffer();
+  workspace.min_ids[1] = next_buffer();
+  workspace.labels = next_buffer();
+  workspace.roots = next_buffer();
+  workspace.first_grids = next_buffer();
+  workspace.is_first = next_buffer();
+  workspace.first_ids = next_buffer();
+  workspace.obstacle_ids = next_buffer();
+  workspace.is_object = workspace_flags_d_.get();
+  workspace.on_cycle = workspace.is_object + size_;
+  workspace.is_reached = workspace.on_cycle + size_;
+
+  const Cluster2DLayout layout{
+    rows_, cols_, range_, scale_, inv_res_x_, inv_res_y_, objectness_thresh};
+  CHECK_CUDA_ERROR(clusterObstacles_launch(
+    inferred_data_d, layout, workspace, num_obstacles_d_.get(), stream));
+  int num_obstacles = 0;
+  CHECK_CUDA_ERROR(cudaMemcpyAsync(
+    &num_obstacles, num_obstacles_d_.get(), sizeof(int), cudaMemcpyDeviceToHost, stream));
+  CHECK_CUDA_ERROR(cudaStreamSynchronize(stream));
+
+  CHECK_CUDA_ERROR(sumObstacles_launch(
+    inferred_data_d, layout, workspace.obstacle_ids, num_obstacles, obstacle_sums_d_.get(),
+    stream));
+  CHECK_CUDA_ERROR(assignPoints_launch(
+    points_d, num_points, point_step, layout, workspace.obstacle_ids,
+    point_obstacle_ids_d_.get(), stream));
+  obstacle_sums_.resize(num_obstacles);
+  point_obstacle_ids_.resize(num_points);
+  CHECK_CUDA_ERROR(cudaMemcpyAsync(
+    obstacle_sums_.data(), obstacle_sums_d_.get(), num_obstacles * sizeof(ObstacleSums),
+    cudaMemcpyDeviceToHost, stream));
+  CHECK_CUDA_ERROR(cudaMemcpyAsync(
+    point_obstacle_ids_.data(), point_obstacle_ids_d_.get(), num_points * sizeof(int),
+    cudaMemcpyDeviceToHost, stream));
+  CHECK_CUDA_ERROR(cudaStreamSynchronize(stream));
+
+  pc_ptr_ = pc_ptr;
+  valid_indices_in_pc_ = nullptr;
+  obstacles_.assign(num_obstacles, Obstacle());
+  for (int obstacle_id = 0; obstacle_id < num_obstacles; ++obstacle_id) {
+    const ObstacleSums & sums = obstacle_sums_[obstacle_id];
+    Obstacle * obs = &obstacles_[obstacle_id];
+    obs->score = sums.score / sums.grid_num;
+    obs->height = sums.height / sums.grid_num;
+    obs->heading = std::atan2(sums.heading_y, sums.heading_x) * 0.5;
+    int meta_type_id = 0;
+    for (int k = 0; k < CLUSTER2D_NUM_CLASSES; k++) {
+      obs->meta_type_probabilities[k] = sums.meta_type_probabilities[k] / sums.grid_num;
+      if (obs->meta_type_probabilities[k] > obs->meta_type_probabilities[meta_type_id]) {
+        meta_type_id = k;
+      }
+    }
+    obs->meta_type = static_cast<MetaType>(meta_type_id);
+  }
+}
+
 void Cluster2D::filter(const float * inferred_data)
 {
   const float * confidence_pt_data = inferred_data + size_ * 3;
@@ -346,16 +432,25 @@ void Cluster2D::getObjects(
   tier4_perception_msgs::msg::DetectedObjectsWithFeature & objects,
   const std_msgs::msg::Header & in_header)
 {
-  for (size_t i = 0; i < point2grid_.size(); ++i) {
-    int grid = point2grid_[i];
-    if (grid < 0) {
-      continue;
+  // the obstacles of the points are given directly by clusterOnDevice()
+  const bool use_point_obstacle_ids = valid_indices_in_pc_ == nullptr;
+  const size_t num_points =
+    use_point_obstacle_ids ? point_obstacle_ids_.size() : point2grid_.size();
+  for (size_t i = 0; i < num_points; ++i) {
+    int obstacle_id;
+    int point_id;
+    if (use_point_obstacle_ids) {
+      obstacle_id = point_obstacle_ids_[i];
+      point_id = static_cast<int>(i);
+    } else {
+      int grid = point2grid_[i];
+      if (grid < 0) {
+        continue;
+      }
+      obstacle_id = id_img_[grid];
+      point_id = valid_indices_in_pc_->at(i);
     }
 
-    int obstacle_id = id_img_[grid];
-
-    int point_id = valid_indices_in_pc_->at(i);
-
     if (obstacle_id >= 0 && obstacles_[obstacle_id].score >= confidence_thresh) {
       if (
         height_thresh < 0 ||
@@ -0,0 +1,295 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lidar_apollo_instance_segmentation/cluster2d_kernel.hpp"
+
+#include <thrust/execution_policy.h>
+#include <thrust/scan.h>
+
+#include <climits>
+
+namespace
+{
+const std::size_t THREADS_PER_BLOCK = 256;
+
+std::size_t divup(const std::size_t a, const std::size_t b)
+{
+  return (a + b - 1) / b;
+}
+
+__device__ int findRoot(const volatile int * roots, int x)
+{
+  while (roots[x] != x) {
+    x = roots[x];
+  }
+  return x;
+}
+
+// lock free union, the root of a set is its smallest label
+__device__ void unite(int * roots, int a, int b)
+{
+  while (true) {
+    a = findRoot(roots, a);
+    b = findRoot(roots, b);
+    if (a == b) {
+      return;
+    }
+    if (a < b) {
+      const int c = a;
+      a = b;
+      b = c;
+    }
+    const int old = atomicMin(roots + a, b);
+    if (old == a) {
+      return;
+    }
+    // a got another parent in between, which has to be united with b instead
+    a = old;
+  }
+}
+}  // namespace
+
+namespace lidar_apollo_instance_segmentation
+{
+__global__ void initNodes_kernel(
+  const float * inferred_data, const Cluster2DLayout layout, int * next, int * min_ids,
+  std::uint8_t * is_object, std::uint8_t * on_cycle, std::uint8_t * is_reached, int * roots,
+  int * first_grids)
+{
+  const int size = layout.rows * layout.cols;
+  const int grid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (grid >= size) return;
+
+  const float * category_pt_data = inferred_data;
+  const float * instance_pt_x_data = inferred_data + size;
+  const float * instance_pt_y_data = inferred_data + size * 2;
+
+  // the same rounding as on the CPU, without a fused multiply add
+  const int row = grid / layout.cols;
+  const int col = grid % layout.cols;
+  int center_row = roundf(row + __fmul_rn(instance_pt_x_data[grid], layout.scale));
+  int center_col = roundf(col + __fmul_rn(instance_pt_y_data[grid], layout.scale));
+  center_row = min(max(center_row, 0), layout.rows - 1);
+  center_col = min(max(center_col, 0), layout.cols - 1);
+
+  next[grid] = center_row * layout.cols + center_col;
+  min_ids[grid] = grid;
+  is_object[grid] = category_pt_data[grid] >= layout.objectness_thresh;
+  on_cycle[grid] = 0;
+  is_reached[grid] = 0;
+  roots[grid] = grid;
+  first_grids[grid] = INT_MAX;
+}
+
+__global__ void jump_kernel(
+  const int size, const int * next, const int * min_ids, int * next_out, int * min_ids_out)
+{
+  // after k jumps, next is 2^k centers ahead, and min_ids the smallest grid of these 2^k centers
+  const int grid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (grid >= size) return;
+
+  const int center = next[grid];
+  next_out[grid] = next[center];
+  min_ids_out[grid] = min(min_ids[grid], min_ids[center]);
+}
+
+__global__ void findCycles_kernel(
+  const int size, const int * next, const int * min_ids, const std::uint8_t * is_object,
+  int * labels, std::uint8_t * on_cycle, std::uint8_t * is_reached)
+{
+  // the chain of centers of a grid ends in a cycle, on which next is once at least 2^k >= size
+  // centers ahead, and the label of the grid is the smallest grid of the cycle
+  const int grid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (grid >= size) return;
+
+  const int cycle_grid = next[grid];
+  const int label = min_ids[cycle_grid];
+  labels[grid] = label;
+  on_cycle[cycle_grid] = 1;
+  // the CPU traversal only finds the cycles reached from an object
+  if (is_object[grid]) {
+    is_reached[label] = 1;
+  }
+}
+
+__global__ void uniteCenters_kernel(
+  const Cluster2DLayout layout, const int * labels, const std::uint8_t * on_cycle,
+  const std::uint8_t * is_reached, int * roots)
+{
+  const int size = layout.rows * layout.cols;
+  const int grid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (grid >= size) return;
+
+  const auto is_center = [&](const int g) { return on_cycle[g] && is_reached[labels[g]]; };
+  if (!is_center(grid)) return;
+
+  // the right and lower neighbors, the other ones unite the left and upper ones
+  const int col = grid % layout.cols;
+  if (col + 1 < layout.cols && is_center(grid + 1)) {
+    unite(roots, labels[grid], labels[grid + 1]);
+  }
+  if (grid + layout.cols < size && is_center(grid + layout.cols)) {
+    unite(roots, labels[grid], labels[grid + layout.cols]);
+  }
+}
+
+__global__ void findFirstGrids_kernel(
+  const int size, const int * roots, const std::uint8_t * is_object, int * labels,
+  int * first_grids)
+{
+  const int grid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (grid >= size) return;
+
+  const int label = findRoot(roots, labels[grid]);
+  labels[grid] = label;
+  if (is_object[grid]) {
+    atomicMin(first_grids + label, grid);
+  }
+}
+
+__global__ void markFirstGrids_kernel(
+  const int size, const int * labels, const std::uint8_t * is_object, const int * first_grids,
+  int * is_first)
+{
+  const int grid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (grid >= size) return;
+
+  is_first[grid] = is_object[grid] && first_grids[labels[grid]] == grid;
+}
+
+__global__ void setObstacleIds_kernel(
+  const int size, const int * labels, const std::uint8_t * is_object, const int * first_grids,
+  const int * is_first, const int * first_ids, int * obstacle_ids, int * num_obstacles)
+{
+  const int grid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (grid >= size) return;
+
+  obstacle_ids[grid] = is_object[grid] ? first_ids[first_grids[labels[grid]]] : -1;
+  if (grid == size - 1) {
+    *num_obstacles = first_ids[grid] + is_first[grid];
+  }
+}
+
+__global__ void sumObstacles_kernel(
+  const float * inferred_data, const int size, const int * obstacle_ids,
+  ObstacleSums * obstacle_sums)
+{
+  const int grid = blockIdx.x * blockDim.x + threadIdx.x;
+  if (grid >= size) return;
+
+  const int obstacle_id = obstacle_ids[grid];
+  if (obstacle_id < 0) return;
+
+  const float * confidence_pt_data = inferred_data + size * 3;
+  const float * classify_pt_data = inferred_data + size * 4;
+  const float * heading_pt_x_data = inferred_data + size * 9;
+  const float * heading_pt_y_data = inferred_data + size * 10;
+  const float * height_pt_data = inferred_data + size * 11;
+
+  ObstacleSums * sums = obstacle_sums + obstacle_id;
+  atomicAdd(&sums->grid_num, 1.0f);
+  atomicAdd(&sums->score, confidence_pt_data[grid]);
+  atomicAdd(&sums->height, height_pt_data[grid]);
+  atomicAdd(&sums->heading_x, heading_pt_x_data[grid]);
+  atomicAdd(&sums->heading_y, heading_pt_y_data[grid]);
+  for (int k = 0; k < CLUSTER2D_NUM_CLASSES; ++k) {
+    atomicAdd(&sums->meta_type_probabilities[k], classify_pt_data[k * size + grid]);
+  }
+}
+
+__global__ void assignPoints_kernel(
+  const std::uint8_t * points, const std::size_t num_points, const std::size_t point_step,
+  const Cluster2DLayout layout, const int * obstacle_ids, int * point_obstacle_ids)
+{
+  const std::size_t point_idx = blockIdx.x * blockDim.x + threadIdx.x;
+  if (point_idx >= num_points) return;
+
+  // the same grid as F2I in Cluster2D::cluster
+  const float * point = reinterpret_cast<const float *>(points + point_idx * point_step);
+  const int pos_x = static_cast<int>(floorf((layout.range - point[1]) * layout.inv_res_x));
+  const int pos_y = static_cast<int>(floorf((layout.range - point[0]) * layout.inv_res_y));
+  const bool is_valid = 0 <= pos_y && pos_y < layout.rows && 0 <= pos_x && pos_x < layout.cols;
+  point_obstacle_ids[point_idx] = is_valid ? obstacle_ids[pos_y * layout.cols + pos_x] : -1;
+}
+
+cudaError_t clusterObstacles_launch(
+  const float * inferred_data, const Cluster2DLayout layout, Cluster2DWorkspace workspace,
+  int * num_obstacles, cudaStream_t stream)
+{
+  const int size = layout.rows * layout.cols;
+  dim3 blocks(divup(size, THREADS_PER_BLOCK));
+  dim3 threads(THREADS_PER_BLOCK);
+
+  initNodes_kernel<<<blocks, threads, 0, stream>>>(
+    inferred_data, layout, workspace.next[0], workspace.min_ids[0], workspace.is_object,
+    workspace.on_cycle, workspace.is_reached, workspace.roots, workspace.first_grids);
+
+  int current = 0;
+  for (int num_centers = 1; num_centers < size; num_centers *= 2) {
+    jump_kernel<<<blocks, threads, 0, stream>>>(
+      size, workspace.next[current], workspace.min_ids[current], workspace.next[1 - current],
+      workspace.min_ids[1 - current]);
+    current = 1 - current;
+  }
+
+  findCycles_kernel<<<blocks, threads, 0, stream>>>(
+    size, workspace.next[current], workspace.min_ids[current], workspace.is_object,
+    workspace.labels, workspace.on_cycle, workspace.is_reached);
+  uniteCenters_kernel<<<blocks, threads, 0, stream>>>(
+    layout, workspace.labels, workspace.on_cycle, workspace.is_reached, workspace.roots);
+  findFirstGrids_kernel<<<blocks, threads, 0, stream>>>(
+    size, workspace.roots, workspace.is_object, workspace.labels, workspace.first_grids);
+  markFirstGrids_kernel<<<blocks, threads, 0, stream>>>(
+    size, workspace.labels, workspace.is_object, workspace.first_grids, workspace.is_first);
+  thrust::exclusive_scan(
+    thrust::cuda::par.on(stream), workspace.is_first, workspace.is_first + size,
+    workspace.first_ids);
+  setObstacleIds_kernel<<<blocks, threads, 0, stream>>>(
+    size, workspace.labels, workspace.is_object, workspace.first_grids, workspace.is_first,
+    workspace.first_ids, workspace.obstacle_ids, num_obstacles);
+
+  return cudaGetLastError();
+}
+
+cudaError_t sumObstacles_launch(
+  const float * inferred_data, const Cluster2DLayout layout, const int * obstacle_ids,
+  const int num_obstacles, ObstacleSums * obstacle_sums, cudaStream_t stream)
+{
+  const int size = layout.rows * layout.cols;
+  dim3 blocks(divup(size, THREADS_PER_BLOCK));
+  dim3 threads(THREADS_PER_BLOCK);
+
+  cudaMemsetAsync(obstacle_sums, 0, num_obstacles * sizeof(ObstacleSums), stream);
+  sumObstacles_kernel<<<blocks, threads, 0, stream>>>(
+    inferred_data, size, obstacle_ids, obstacle_sums);
+
+  return cudaGetLastError();
+}
+
+cudaError_t assignPoints_launch(
+  const std::uint8_t * points, const std::size_t num_points, const std::size_t point_step,
+  const Cluster2DLayout layout, const int * obstacle_ids, int * point_obstacle_ids,
+  cudaStream_t stream)
+{
+  if (num_points == 0) {
+    return cudaSuccess;
+  }
+  dim3 blocks(divup(num_points, THREADS_PER_BLOCK));
+  dim3 threads(THREADS_PER_BLOCK);
+  assignPoints_kernel<<<blocks, threads, 0, stream>>>(
+    points, num_points, point_step, layout, obstacle_ids, point_obstacle_ids);
+
+  return cudaGetLastError();
+}
+}  // namespace lidar_apollo_instance_segmentation
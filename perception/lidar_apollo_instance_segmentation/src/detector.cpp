@@ -14,12 +14,16 @@
 
 #include "lidar_apollo_instance_segmentation/detector.hpp"
 
+#include "lidar_apollo_instance_segmentation/feature_generator_kernel.hpp"
 #include "lidar_apollo_instance_segmentation/feature_map.hpp"
 
 #include <NvCaffeParser.h>
 #include <NvInfer.h>
 #include <pcl_conversions/pcl_conversions.h>
 
+#include <cstddef>
+#include <cstdint>
+
 namespace lidar_apollo_instance_segmentation
 {
 LidarApolloInstanceSegmentation::LidarApolloInstanceSegmentation(rclcpp::Node * node)
@@ -38,6 +42,8 @@ LidarApolloInstanceSegmentation::LidarApolloInstanceSegmentation(rclcpp::Node *
   target_frame_ = node_->declare_parameter("target_frame", "base_link");
   z_offset_ = node_->declare_parameter<float>("z_offset", -2.0);
   const auto precision = node_->declare_parameter("precision", "fp32");
+  use_gpu_feature_generation_ = node_->declare_parameter("use_gpu_feature_generation", false);
+  use_gpu_clustering_ = node_->declare_parameter("use_gpu_clustering", false);
 
   trt_common_ = std::make_unique<tensorrt_common::TrtCommon>(
     onnx_file, precision, nullptr, tensorrt_common::BatchConfig{1, 1, 1}, 1 << 30);
@@ -62,6 +68,14 @@ LidarApolloInstanceSegmentation::LidarApolloInstanceSegmentation(rclcpp::Node *
   // feature map generator: pre process
   feature_generator_ = std::make_shared<FeatureGenerator>(
     width, height, range, use_intensity_feature, use_constant_feature);
+  if (use_gpu_feature_generation_) {
+    // the constant channels are copied once, the kernels only write the other ones
+    const auto feature_map_ptr = feature_generator_->getFeatureMap();
+    CHECK_CUDA_ERROR(cudaMemcpy(
+      input_d_.get(), feature_map_ptr->map_data.data(),
+      feature_map_ptr->map_data.size() * sizeof(float), cudaMemcpyHostToDevice));
+    top_point_indices_d_ = cuda_utils::make_unique<unsigned int[]>(width * height);
+  }
 
   // cluster: post process
   cluster2d_ = std::make_shared<Cluster2D>(width, height, range);
@@ -122,31 +136,56 @@ bool LidarApolloInstanceSegmentation::detectDynamicObjects(
   pcl::PointCloud<pcl::PointXYZI>::Ptr pcl_pointcloud_raw_ptr(new pcl::PointCloud<pcl::PointXYZI>);
   pcl::fromROSMsg(transformed_cloud, *pcl_pointcloud_raw_ptr);
 
+  const auto & points = pcl_pointcloud_raw_ptr->points;
+  if (use_gpu_feature_generation_ || use_gpu_clustering_) {
+    if (points_d_capacity_ < points.size()) {
+      points_d_capacity_ = points.size();
+      points_d_ = cuda_utils::make_unique<pcl::PointXYZI[]>(points_d_capacity_);
+    }
+    CHECK_CUDA_ERROR(cudaMemcpyAsync(
+      points_d_.get(), points.data(), points.size() * sizeof(pcl::PointXYZI),
+      cudaMemcpyHostToDevice, *stream_));
+  }
+
   // generate feature map
-  std::shared_ptr<FeatureMapInterface> feature_map_ptr =
-    feature_generator_->generate(pcl_pointcloud_raw_ptr);
+  if (use_gpu_feature_generation_) {
+    CHECK_CUDA_ERROR(generateFeatures_launch(
+      reinterpret_cast<const std::uint8_t *>(points_d_.get()), points.size(),
+      sizeof(pcl::PointXYZI), offsetof(pcl::PointXYZI, intensity),
+      feature_generator_->getFeatureMapLayout(), top_point_indices_d_.get(), input_d_.get(),
+      *stream_));
+  } else {
+    std::shared_ptr<FeatureMapInterface> feature_map_ptr =
+      feature_generator_->generate(pcl_pointcloud_raw_ptr);
 
-  CHECK_CUDA_ERROR(cudaMemcpy(
-    input_d_.get(), feature_map_ptr->map_data.data(),
-    feature_map_ptr->map_data.size() * sizeof(float), cudaMemcpyHostToDevice));
+    CHECK_CUDA_ERROR(cudaMemcpy(
+      input_d_.get(), feature_map_ptr->map_data.data(),
+      feature_map_ptr->map_data.size() * sizeof(float), cudaMemcpyHostToDevice));
+  }
 
   std::vector<void *> buffers = {input_d_.get(), output_d_.get()};
 
   trt_common_->enqueueV2(buffers.data(), *stream_, nullptr);
 
-  CHECK_CUDA_ERROR(cudaMemcpyAsync(
-    output_h_.get(), output_d_.get(), sizeof(float) * output_size_, cudaMemcpyDeviceToHost,
-    *stream_));
-  cudaStreamSynchronize(*stream_);
-
   // post process
   const float objectness_thresh = 0.5;
-  pcl::PointIndices valid_idx;
-  valid_idx.indices.resize(pcl_pointcloud_raw_ptr->size());
-  std::iota(valid_idx.indices.begin(), valid_idx.indices.end(), 0);
-  cluster2d_->cluster(
-    output_h_.get(), pcl_pointcloud_raw_ptr, valid_idx, objectness_thresh,
-    true /*use all grids for clustering*/);
+  if (use_gpu_clustering_) {
+    cluster2d_->clusterOnDevice(
+      output_d_.get(), reinterpret_cast<const std::uint8_t *>(points_d_.get()),
+      sizeof(pcl::PointXYZI), pcl_pointcloud_raw_ptr, objectness_thresh, *stream_);
+  } else {
+    CHECK_CUDA_ERROR(cudaMemcpyAsync(
+      output_h_.get(), output_d_.get(), sizeof(float) * output_size_, cudaMemcpyDeviceToHost,
+      *stream_));
+    cudaStreamSynchronize(*stream_);
+
+    pcl::PointIndices valid_idx;
+    valid_idx.indices.resize(pcl_pointcloud_raw_ptr->size());
+    std::iota(valid_idx.indices.begin(), valid_idx.indices.end(), 0);
+    cluster2d_->cluster(
+      output_h_.get(), pcl_pointcloud_raw_ptr, valid_idx, objectness_thresh,
+      true /*use all grids for clustering*/);
+  }
   const float height_thresh = 0.5;
   const int min_pts_num = 3;
   cluster2d_->getObjects(
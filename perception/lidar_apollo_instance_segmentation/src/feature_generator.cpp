@@ -53,49 +53,91 @@ std::shared_ptr<FeatureMapInterface> FeatureGenerator::generate(
   const double epsilon = 1e-6;
   map_ptr_->resetMap(map_ptr_->map_data);
 
-  int size = map_ptr_->height * map_ptr_->width;
+  const int width = map_ptr_->width;
+  const int height = map_ptr_->height;
+  const float range = map_ptr_->range;
+  const int size = height * width;
 
-  const float inv_res_x = 0.5 * map_ptr_->width / map_ptr_->range;
-  const float inv_res_y = 0.5 * map_ptr_->height / map_ptr_->range;
+  const float inv_res_x = 0.5 * width / range;
+  const float inv_res_y = 0.5 * height / range;
 
-  for (size_t i = 0; i < pc_ptr->points.size(); ++i) {
-    if (pc_ptr->points[i].z <= min_height_ || max_height_ <= pc_ptr->points[i].z) {
-      continue;
-    }
+  // the channels are read through locals, so that the compiler knows they are not changed by the
+  // stores to the other channels
+  float * const max_height_data = map_ptr_->max_height_data;
+  float * const mean_height_data = map_ptr_->mean_height_data;
+  float * const count_data = map_ptr_->count_data;
+  float * const top_intensity_data = map_ptr_->top_intensity_data;
+  float * const mean_intensity_data = map_ptr_->mean_intensity_data;
+  float * const nonempty_data = map_ptr_->nonempty_data;
 
-    const int pos_x = std::floor((map_ptr_->range - pc_ptr->points[i].y) * inv_res_x);  // x on grid
-    const int pos_y = std::floor((map_ptr_->range - pc_ptr->points[i].x) * inv_res_y);  // y on grid
-    if (pos_x < 0 || map_ptr_->width <= pos_x || pos_y < 0 || map_ptr_->height <= pos_y) {
+  // cell of each point, -1 if it is out of the map. This pass has no branch, so that it is
+  // vectorized, and the scatter below only reads the cells.
+  const auto & points = pc_ptr->points;
+  point_cells_.resize(points.size());
+  for (size_t i = 0; i < points.size(); ++i) {
+    const auto & point = points[i];
+    const int pos_x = std::floor((range - point.y) * inv_res_x);  // x on grid
+    const int pos_y = std::floor((range - point.x) * inv_res_y);  // y on grid
+    const bool is_valid = !(point.z <= min_height_ || max_height_ <= point.z) && 0 <= pos_x &&
+                          pos_x < width && 0 <= pos_y && pos_y < height;
+    point_cells_[i] = is_valid ? pos_y * width + pos_x : -1;
+  }
+
+  for (size_t i = 0; i < points.size(); ++i) {
+    const int idx = point_cells_[i];
+    if (idx < 0) {
       continue;
     }
-
-    const int idx = pos_y * map_ptr_->width + pos_x;
-
-    if (map_ptr_->max_height_data[idx] < pc_ptr->points[i].z) {
-      map_ptr_->max_height_data[idx] = pc_ptr->points[i].z;
-      if (map_ptr_->top_intensity_data != nullptr) {
-        map_ptr_->top_intensity_data[idx] = normalizeIntensity(pc_ptr->points[i].intensity);
+    const auto & point = points[i];
+    if (max_height_data[idx] < point.z) {
+      max_height_data[idx] = point.z;
+      if (top_intensity_data != nullptr) {
+        top_intensity_data[idx] = normalizeIntensity(point.intensity);
       }
     }
-    map_ptr_->mean_height_data[idx] += static_cast<float>(pc_ptr->points[i].z);
-    if (map_ptr_->mean_intensity_data != nullptr) {
-      map_ptr_->mean_intensity_data[idx] += normalizeIntensity(pc_ptr->points[i].intensity);
+    mean_height_data[idx] += static_cast<float>(point.z);
+    if (mean_intensity_data != nullptr) {
+      mean_intensity_data[idx] += normalizeIntensity(point.intensity);
     }
-    map_ptr_->count_data[idx] += 1.0f;
+    count_data[idx] += 1.0f;
   }
 
+  // the log of the count of an empty cell is 0, which it already is
   for (int i = 0; i < size; ++i) {
-    if (map_ptr_->count_data[i] < epsilon) {
-      map_ptr_->max_height_data[i] = 0.0f;
+    if (count_data[i] < epsilon) {
+      max_height_data[i] = 0.0f;
     } else {
-      map_ptr_->mean_height_data[i] /= map_ptr_->count_data[i];
-      if (map_ptr_->mean_intensity_data != nullptr) {
-        map_ptr_->mean_intensity_data[i] /= map_ptr_->count_data[i];
+      mean_height_data[i] /= count_data[i];
+      if (mean_intensity_data != nullptr) {
+        mean_intensity_data[i] /= count_data[i];
       }
-      map_ptr_->nonempty_data[i] = 1.0f;
+      nonempty_data[i] = 1.0f;
+      count_data[i] = calcApproximateLog(count_data[i]);
     }
-    map_ptr_->count_data[i] = calcApproximateLog(map_ptr_->count_data[i]);
   }
   return map_ptr_;
 }
+
+FeatureMapLayout FeatureGenerator::getFeatureMapLayout() const
+{
+  const int size = map_ptr_->height * map_ptr_->width;
+  const auto channel = [this, size](const float * data) {
+    return data == nullptr ? -1 : static_cast<int>((data - map_ptr_->map_data.data()) / size);
+  };
+  FeatureMapLayout layout;
+  layout.width = map_ptr_->width;
+  layout.height = map_ptr_->height;
+  layout.range = map_ptr_->range;
+  layout.inv_res_x = 0.5 * map_ptr_->width / map_ptr_->range;
+  layout.inv_res_y = 0.5 * map_ptr_->height / map_ptr_->range;
+  layout.min_height = min_height_;
+  layout.max_height = max_height_;
+  layout.max_height_channel = channel(map_ptr_->max_height_data);
+  layout.mean_height_channel = channel(map_ptr_->mean_height_data);
+  layout.count_channel = channel(map_ptr_->count_data);
+  layout.top_intensity_channel = channel(map_ptr_->top_intensity_data);
+  layout.mean_intensity_channel = channel(map_ptr_->mean_intensity_data);
+  layout.nonempty_channel = channel(map_ptr_->nonempty_data);
+  return layout;
+}
 }  // namespace lidar_apollo_instance_segmentation
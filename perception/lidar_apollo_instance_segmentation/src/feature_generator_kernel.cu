@@ -0,0 +1,169 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lidar_apollo_instance_segmentation/feature_generator_kernel.hpp"
+
+#include <climits>
+
+namespace
+{
+const std::size_t THREADS_PER_BLOCK = 256;
+
+std::size_t divup(const std::size_t a, const std::size_t b)
+{
+  return (a + b - 1) / b;
+}
+
+// the order of the floats without the sign bit is the one of their bits as ints, and the order of
+// the ones with it, -0 included, is the reverse of the one of their bits as unsigned ints
+__device__ void atomicMaxFloat(float * address, const float value)
+{
+  if (__float_as_int(value) >= 0) {
+    atomicMax(reinterpret_cast<int *>(address), __float_as_int(value));
+  } else {
+    atomicMin(reinterpret_cast<unsigned int *>(address), __float_as_uint(value));
+  }
+}
+
+// the same cell as FeatureGenerator::generate, -1 if the point is out of the map
+__device__ int pointCell(
+  const float x, const float y, const float z,
+  const lidar_apollo_instance_segmentation::FeatureMapLayout & layout)
+{
+  if (z <= layout.min_height || layout.max_height <= z) {
+    return -1;
+  }
+  const int pos_x = static_cast<int>(floorf((layout.range - y) * layout.inv_res_x));
+  const int pos_y = static_cast<int>(floorf((layout.range - x) * layout.inv_res_y));
+  if (pos_x < 0 || layout.width <= pos_x || pos_y < 0 || layout.height <= pos_y) {
+    return -1;
+  }
+  return pos_y * layout.width + pos_x;
+}
+}  // namespace
+
+namespace lidar_apollo_instance_segmentation
+{
+__global__ void resetFeatures_kernel(
+  const FeatureMapLayout layout, unsigned int * top_point_indices, float * features)
+{
+  const int cell = blockIdx.x * blockDim.x + threadIdx.x;
+  if (cell >= layout.width * layout.height) return;
+
+  const int size = layout.width * layout.height;
+  features[layout.max_height_channel * size + cell] = layout.min_height;
+  features[layout.mean_height_channel * size + cell] = 0.0f;
+  features[layout.count_channel * size + cell] = 0.0f;
+  features[layout.nonempty_channel * size + cell] = 0.0f;
+  if (layout.top_intensity_channel >= 0) {
+    features[layout.top_intensity_channel * size + cell] = 0.0f;
+    top_point_indices[cell] = UINT_MAX;
+  }
+  if (layout.mean_intensity_channel >= 0) {
+    features[layout.mean_intensity_channel * size + cell] = 0.0f;
+  }
+}
+
+__global__ void accumulatePoints_kernel(
+  const std::uint8_t * points, const std::size_t num_points, const std::size_t point_step,
+  const std::size_t intensity_offset, const FeatureMapLayout layout, float * features)
+{
+  const std::size_t point_idx = blockIdx.x * blockDim.x + threadIdx.x;
+  if (point_idx >= num_points) return;
+
+  const float * point = reinterpret_cast<const float *>(points + point_idx * point_step);
+  const int cell = pointCell(point[0], point[1], point[2], layout);
+  if (cell < 0) return;
+
+  const int size = layout.width * layout.height;
+  atomicMaxFloat(features + layout.max_height_channel * size + cell, point[2]);
+  atomicAdd(features + layout.mean_height_channel * size + cell, point[2]);
+  atomicAdd(features + layout.count_channel * size + cell, 1.0f);
+  if (layout.mean_intensity_channel >= 0) {
+    const float intensity =
+      *reinterpret_cast<const float *>(points + point_idx * point_step + intensity_offset);
+    atomicAdd(features + layout.mean_intensity_channel * size + cell, intensity / 255.0f);
+  }
+}
+
+__global__ void findTopPoints_kernel(
+  const std::uint8_t * points, const std::size_t num_points, const std::size_t point_step,
+  const FeatureMapLayout layout, const float * features, unsigned int * top_point_indices)
+{
+  // the top intensity is the one of the first point at the max height, as on the CPU
+  const std::size_t point_idx = blockIdx.x * blockDim.x + threadIdx.x;
+  if (point_idx >= num_points) return;
+
+  const float * point = reinterpret_cast<const float *>(points + point_idx * point_step);
+  const int cell = pointCell(point[0], point[1], point[2], layout);
+  if (cell < 0) return;
+
+  const int size = layout.width * layout.height;
+  if (point[2] == features[layout.max_height_channel * size + cell]) {
+    atomicMin(top_point_indices + cell, static_cast<unsigned int>(point_idx));
+  }
+}
+
+__global__ void finalizeFeatures_kernel(
+  const std::uint8_t * points, const std::size_t point_step, const std::size_t intensity_offset,
+  const FeatureMapLayout layout, const unsigned int * top_point_indices, float * features)
+{
+  const int cell = blockIdx.x * blockDim.x + threadIdx.x;
+  if (cell >= layout.width * layout.height) return;
+
+  const int size = layout.width * layout.height;
+  const float count = features[layout.count_channel * size + cell];
+  if (count < 1e-6f) {
+    features[layout.max_height_channel * size + cell] = 0.0f;
+    return;
+  }
+  features[layout.mean_height_channel * size + cell] /= count;
+  if (layout.mean_intensity_channel >= 0) {
+    features[layout.mean_intensity_channel * size + cell] /= count;
+  }
+  if (layout.top_intensity_channel >= 0) {
+    const float intensity = *reinterpret_cast<const float *>(
+      points + top_point_indices[cell] * point_step + intensity_offset);
+    features[layout.top_intensity_channel * size + cell] = intensity / 255.0f;
+  }
+  features[layout.nonempty_channel * size + cell] = 1.0f;
+  // the counts are integers, for which calcApproximateLog is log1p
+  features[layout.count_channel * size + cell] = log1pf(count);
+}
+
+cudaError_t generateFeatures_launch(
+  const std::uint8_t * points, const std::size_t num_points, const std::size_t point_step,
+  const std::size_t intensity_offset, const FeatureMapLayout layout,
+  unsigned int * top_point_indices, float * features, cudaStream_t stream)
+{
+  const std::size_t size = static_cast<std::size_t>(layout.width) * layout.height;
+  dim3 cell_blocks(divup(size, THREADS_PER_BLOCK));
+  dim3 point_blocks(divup(num_points, THREADS_PER_BLOCK));
+  dim3 threads(THREADS_PER_BLOCK);
+
+  resetFeatures_kernel<<<cell_blocks, threads, 0, stream>>>(layout, top_point_indices, features);
+  if (num_points > 0) {
+    accumulatePoints_kernel<<<point_blocks, threads, 0, stream>>>(
+      points, num_points, point_step, intensity_offset, layout, features);
+    if (layout.top_intensity_channel >= 0) {
+      findTopPoints_kernel<<<point_blocks, threads, 0, stream>>>(
+        points, num_points, point_step, layout, features, top_point_indices);
+    }
+  }
+  finalizeFeatures_kernel<<<cell_blocks, threads, 0, stream>>>(
+    points, point_step, intensity_offset, layout, top_point_indices, features);
+
+  return cudaGetLastError();
+}
+}  // namespace lidar_apollo_instance_segmentation
@@ -75,6 +75,17 @@ public:
     down_grid_size_y_ = grid_size_y_ / downsample_factor_;
   };
 
+  // enable the IoU-based NMS on the device, target_label_mask has an element for each class
+  void setIoUNMSParameters(
+    const std::vector<bool> & target_label_mask, const float search_distance_2d,
+    const float iou_threshold)
+  {
+    use_iou_nms_ = true;
+    iou_nms_target_label_mask_ = target_label_mask;
+    iou_nms_search_distance_2d_ = search_distance_2d;
+    iou_nms_threshold_ = iou_threshold;
+  }
+
   // input params
   std::size_t class_size_{3};
   const std::size_t point_dim_size_{3};  // x, y and z
@@ -107,6 +118,10 @@ public:
   float score_threshold_{0.35f};
   float circle_nms_dist_threshold_{1.5f};
   std::vector<float> yaw_norm_thresholds_{};
+  bool use_iou_nms_{false};
+  std::vector<bool> iou_nms_target_label_mask_{};
+  float iou_nms_search_distance_2d_{0.f};
+  float iou_nms_threshold_{0.f};
 
   // calculated params
   std::size_t grid_size_x_ = (range_max_x_ - range_min_x_) / voxel_size_x_;
@@ -21,6 +21,7 @@
 #include <lidar_centerpoint/preprocess/voxel_generator.hpp>
 
 #include <sensor_msgs/msg/point_cloud2.hpp>
+#include <std_msgs/msg/header.hpp>
 
 #include <pcl/point_cloud.h>
 #include <pcl/point_types.h>
@@ -57,7 +58,8 @@ class CenterPointTRT
 public:
   explicit CenterPointTRT(
     const NetworkParam & encoder_param, const NetworkParam & head_param,
-    const DensificationParam & densification_param, const CenterPointConfig & config);
+    const DensificationParam & densification_param, const CenterPointConfig & config,
+    const bool use_pipelined_inference = false);
 
   ~CenterPointTRT();
 
@@ -65,9 +67,23 @@ public:
     const sensor_msgs::msg::PointCloud2 & input_pointcloud_msg, const tf2_ros::Buffer & tf_buffer,
     std::vector<Box3D> & det_boxes3d);
 
+  /**
+   * Pipelined detect(), with use_pipelined_inference. The network inference of the previous frame
+   * runs on its own stream while `input_pointcloud_msg` is voxelized, and the boxes of the
+   * previous frame are returned, so that the detections are one frame late.
+   * \param[out] det_header the header of the pointcloud the boxes are detected in
+   * \return false when there is no previous frame to return the boxes of
+   */
+  bool detectPipelined(
+    const sensor_msgs::msg::PointCloud2 & input_pointcloud_msg, const tf2_ros::Buffer & tf_buffer,
+    std::vector<Box3D> & det_boxes3d, std_msgs::msg::Header & det_header);
+
 protected:
   void initPtr();
 
+  // Densification and voxelization of the sweeps cached on the device, with use_device_cache
+  std::size_t generateVoxelsOnDevice();
+
   virtual bool preprocess(
     const sensor_msgs::msg::PointCloud2 & input_pointcloud_msg, const tf2_ros::Buffer & tf_buffer);
 
@@ -80,15 +96,24 @@ protected:
   std::unique_ptr<HeadTRT> head_trt_ptr_{nullptr};
   std::unique_ptr<PostProcessCUDA> post_proc_ptr_{nullptr};
   cudaStream_t stream_{nullptr};
+  // the stream of inference() and postProcess(), the same as stream_ unless pipelined
+  cudaStream_t inference_stream_{nullptr};
 
   std::size_t class_size_{0};
   CenterPointConfig config_;
   std::size_t num_voxels_{0};
   std::size_t encoder_in_feature_size_{0};
   std::size_t spatial_features_size_{0};
+  bool use_device_cache_{false};
+  bool use_pipelined_inference_{false};
+  std::size_t points_capacity_{0};
   std::vector<float> voxels_;
   std::vector<int> coordinates_;
   std::vector<float> num_points_per_voxel_;
+  cuda::unique_ptr<float[]> points_d_{nullptr};
+  cuda::unique_ptr<unsigned int[]> grid_num_points_d_{nullptr};
+  cuda::unique_ptr<unsigned int[]> grid_point_indices_d_{nullptr};
+  cuda::unique_ptr<unsigned int[]> num_voxels_d_{nullptr};
   cuda::unique_ptr<float[]> voxels_d_{nullptr};
   cuda::unique_ptr<int[]> coordinates_d_{nullptr};
   cuda::unique_ptr<float[]> num_points_per_voxel_d_{nullptr};
@@ -101,6 +126,14 @@ protected:
   cuda::unique_ptr<float[]> head_out_dim_d_{nullptr};
   cuda::unique_ptr<float[]> head_out_rot_d_{nullptr};
   cuda::unique_ptr<float[]> head_out_vel_d_{nullptr};
+
+  // The second set of the buffers handed from the preprocess to the inference, when pipelined.
+  // They are swapped with coordinates_d_ and encoder_in_features_d_ at every frame.
+  cuda::unique_ptr<int[]> pipelined_coordinates_d_{nullptr};
+  cuda::unique_ptr<float[]> pipelined_encoder_in_features_d_{nullptr};
+  cudaEvent_t preprocessed_event_{nullptr};
+  bool has_pipelined_frame_{false};
+  std_msgs::msg::Header pipelined_header_;
 };
 
 }  // namespace centerpoint
@@ -15,8 +15,6 @@
 #ifndef LIDAR_CENTERPOINT__NODE_HPP_
 #define LIDAR_CENTERPOINT__NODE_HPP_
 
-#include "lidar_centerpoint/postprocess/non_maximum_suppression.hpp"
-
 #include <lidar_centerpoint/centerpoint_trt.hpp>
 #include <lidar_centerpoint/detection_class_remapper.hpp>
 #include <rclcpp/rclcpp.hpp>
@@ -53,8 +51,8 @@ private:
   float score_threshold_{0.0};
   std::vector<std::string> class_names_;
   bool has_twist_{false};
+  bool use_pipelined_inference_{false};
 
-  NonMaximumSuppression iou_bev_nms_;
   DetectionClassRemapper detection_class_remapper_;
 
   std::unique_ptr<CenterPointTRT> detector_ptr_{nullptr};
@@ -0,0 +1,38 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef LIDAR_CENTERPOINT__POSTPROCESS__IOU_NMS_KERNEL_HPP_
+#define LIDAR_CENTERPOINT__POSTPROCESS__IOU_NMS_KERNEL_HPP_
+
+#include <lidar_centerpoint/utils.hpp>
+
+#include <thrust/device_vector.h>
+
+#include <cstdint>
+
+namespace centerpoint
+{
+// Non-maximum suppression (NMS) with the intersection over union (IoU) of the boxes on the xy
+// plane, which is the same as NonMaximumSuppression with NMS_TYPE::IoU_BEV. A box is suppressed
+// if a box with a higher score overlaps it more than iou_threshold, where a pair is compared only
+// if both of the labels are targets or the boxes are within search_distance_2d. The boxes have to
+// be sorted by the score, and target_label_mask has an element for each label of the network.
+std::size_t iouBevNMS(
+  const thrust::device_vector<Box3D> & boxes3d,
+  const thrust::device_vector<std::uint8_t> & target_label_mask, const float search_distance_2d,
+  const float iou_threshold, thrust::device_vector<bool> & keep_mask, cudaStream_t stream);
+
+}  // namespace centerpoint
+
+#endif  // LIDAR_CENTERPOINT__POSTPROCESS__IOU_NMS_KERNEL_HPP_
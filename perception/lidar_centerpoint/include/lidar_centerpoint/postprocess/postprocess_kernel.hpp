@@ -22,6 +22,7 @@
 #include <cuda_runtime_api.h>
 #include <thrust/device_vector.h>
 
+#include <cstdint>
 #include <vector>
 
 namespace centerpoint
@@ -40,6 +41,7 @@ private:
   CenterPointConfig config_;
   thrust::device_vector<Box3D> boxes3d_d_;
   thrust::device_vector<float> yaw_norm_thresholds_d_;
+  thrust::device_vector<std::uint8_t> iou_nms_target_label_mask_d_;
 };
 
 }  // namespace centerpoint
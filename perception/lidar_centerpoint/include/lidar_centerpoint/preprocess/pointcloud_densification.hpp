@@ -23,33 +23,60 @@
 #include <tf2_sensor_msgs/tf2_sensor_msgs.hpp>
 #endif
 
+#include <lidar_centerpoint/cuda_utils.hpp>
+
+#include <cstdint>
 #include <list>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace centerpoint
 {
 class DensificationParam
 {
 public:
-  DensificationParam(const std::string & world_frame_id, const unsigned int num_past_frames)
+  DensificationParam(
+    const std::string & world_frame_id, const unsigned int num_past_frames,
+    const bool use_device_cache = false)
   : world_frame_id_(std::move(world_frame_id)),
-    pointcloud_cache_size_(num_past_frames + /*current frame*/ 1)
+    pointcloud_cache_size_(num_past_frames + /*current frame*/ 1),
+    use_device_cache_(use_device_cache)
   {
   }
 
   std::string world_frame_id() const { return world_frame_id_; }
   unsigned int pointcloud_cache_size() const { return pointcloud_cache_size_; }
+  bool use_device_cache() const { return use_device_cache_; }
 
 private:
   std::string world_frame_id_;
   unsigned int pointcloud_cache_size_{1};
+  bool use_device_cache_{false};
+};
+
+/**
+ * Points of a sweep uploaded to the device once, as the raw data of its PointCloud2.
+ * The sweeps are kept in a ring of pointcloud_cache_size() slots, and the buffer of a slot is only
+ * reallocated when a sweep does not fit in it.
+ */
+struct DeviceSweep
+{
+  cuda::unique_ptr<std::uint8_t[]> data_d{nullptr};
+  std::size_t capacity{0};  // bytes
+  std::size_t num_points{0};
+  std::size_t point_step{0};
+  std::uint32_t x_offset{0};
+  std::uint32_t y_offset{0};
+  std::uint32_t z_offset{0};
 };
 
 struct PointCloudWithTransform
 {
   sensor_msgs::msg::PointCloud2 pointcloud_msg;
   Eigen::Affine3f affine_past2world;
+  // With use_device_cache, pointcloud_msg only holds the header and the points are in this slot
+  std::size_t device_sweep_index{0};
 };
 
 class PointCloudDensification
@@ -57,8 +84,10 @@ class PointCloudDensification
 public:
   explicit PointCloudDensification(const DensificationParam & param);
 
+  // `stream` is the one the sweep is uploaded on, with use_device_cache
   bool enqueuePointCloud(
-    const sensor_msgs::msg::PointCloud2 & input_pointcloud_msg, const tf2_ros::Buffer & tf_buffer);
+    const sensor_msgs::msg::PointCloud2 & input_pointcloud_msg, const tf2_ros::Buffer & tf_buffer,
+    cudaStream_t stream = nullptr);
 
   double getCurrentTimestamp() const { return current_timestamp_; }
   Eigen::Affine3f getAffineWorldToCurrent() const { return affine_world2current_; }
@@ -71,15 +100,22 @@ public:
     return iter == pointcloud_cache_.end();
   }
   unsigned int pointcloud_cache_size() const { return param_.pointcloud_cache_size(); }
+  bool use_device_cache() const { return param_.use_device_cache(); }
+  const DeviceSweep & getDeviceSweep(std::size_t index) const { return device_sweeps_[index]; }
 
 private:
-  void enqueue(const sensor_msgs::msg::PointCloud2 & msg, const Eigen::Affine3f & affine);
+  void enqueue(
+    const sensor_msgs::msg::PointCloud2 & msg, const Eigen::Affine3f & affine, cudaStream_t stream);
   void dequeue();
+  void uploadSweep(
+    const sensor_msgs::msg::PointCloud2 & msg, DeviceSweep & sweep, cudaStream_t stream);
 
   DensificationParam param_;
   double current_timestamp_{0.0};
   Eigen::Affine3f affine_world2current_;
   std::list<PointCloudWithTransform> pointcloud_cache_;
+  std::vector<DeviceSweep> device_sweeps_;
+  std::size_t next_device_sweep_index_{0};
 };
 
 }  // namespace centerpoint
@@ -18,8 +18,36 @@
 #include <cuda.h>
 #include <cuda_runtime_api.h>
 
+#include <cstdint>
+
 namespace centerpoint
 {
+// Row-major 3x4 matrix of an affine transform, passed to the kernel by value
+struct Affine3x4
+{
+  float m[12];
+};
+
+cudaError_t generateSweepPoints_launch(
+  const std::uint8_t * input_points, const std::size_t num_points, const std::size_t point_step,
+  const std::uint32_t x_offset, const std::uint32_t y_offset, const std::uint32_t z_offset,
+  const float time_lag, const Affine3x4 affine_past2current, float * output_points,
+  cudaStream_t stream);
+
+cudaError_t generateVoxels_launch(
+  const float * points, const std::size_t num_points, const float range_min_x,
+  const float range_min_y, const float range_min_z, const float recip_voxel_size_x,
+  const float recip_voxel_size_y, const float recip_voxel_size_z, const int grid_size_x,
+  const int grid_size_y, const int grid_size_z, const std::size_t max_point_in_voxel_size,
+  unsigned int * grid_num_points, unsigned int * grid_point_indices, cudaStream_t stream);
+
+cudaError_t generateBaseFeatures_launch(
+  const float * points, const unsigned int * grid_num_points,
+  const unsigned int * grid_point_indices, const int grid_size_x, const int grid_size_y,
+  const int grid_size_z, const std::size_t max_voxel_size,
+  const std::size_t max_point_in_voxel_size, unsigned int * num_voxels, float * voxels,
+  float * num_points_per_voxel, int * coords, cudaStream_t stream);
+
 cudaError_t generateFeatures_launch(
   const float * voxel_features, const float * voxel_num_points, const int * coords,
   const std::size_t num_voxels, const std::size_t max_voxel_size, const float voxel_size_x,
@@ -20,6 +20,8 @@
 
 #include <sensor_msgs/msg/point_cloud2.hpp>
 
+#include <cuda_runtime_api.h>
+
 #include <memory>
 #include <vector>
 
@@ -36,7 +38,19 @@ public:
     std::vector<float> & num_points_per_voxel) = 0;
 
   bool enqueuePointCloud(
-    const sensor_msgs::msg::PointCloud2 & input_pointcloud_msg, const tf2_ros::Buffer & tf_buffer);
+    const sensor_msgs::msg::PointCloud2 & input_pointcloud_msg, const tf2_ros::Buffer & tf_buffer,
+    cudaStream_t stream = nullptr);
+
+  /** \brief The number of points of all the cached sweeps, with use_device_cache. */
+  std::size_t getNumSweepPoints();
+
+  /**
+   * Transform the cached sweeps on the device into the current frame, with use_device_cache.
+   * \param[out] points_d (getNumSweepPoints(), point_feature_size) device buffer of x, y, z and
+   * time lag, in the same order as the points visited by pointsToVoxels
+   * \return the number of points
+   */
+  std::size_t generateSweepPoints(float * points_d, cudaStream_t stream);
 
 protected:
   std::unique_ptr<PointCloudDensification> pd_ptr_{nullptr};
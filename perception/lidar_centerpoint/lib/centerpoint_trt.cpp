@@ -19,17 +19,22 @@
 #include <lidar_centerpoint/preprocess/preprocess_kernel.hpp>
 #include <tier4_autoware_utils/math/constants.hpp>
 
+#include <algorithm>
 #include <iostream>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace centerpoint
 {
 CenterPointTRT::CenterPointTRT(
   const NetworkParam & encoder_param, const NetworkParam & head_param,
-  const DensificationParam & densification_param, const CenterPointConfig & config)
-: config_(config)
+  const DensificationParam & densification_param, const CenterPointConfig & config,
+  const bool use_pipelined_inference)
+: config_(config),
+  use_device_cache_(densification_param.use_device_cache()),
+  use_pipelined_inference_(use_pipelined_inference)
 {
   vg_ptr_ = std::make_unique<VoxelGenerator>(densification_param, config_);
   post_proc_ptr_ = std::make_unique<PostProcessCUDA>(config_);
@@ -57,14 +62,26 @@ CenterPointTRT::CenterPointTRT(
   initPtr();
 
   cudaStreamCreate(&stream_);
+  inference_stream_ = stream_;
+  if (use_pipelined_inference_) {
+    cudaStreamCreate(&inference_stream_);
+    cudaEventCreateWithFlags(&preprocessed_event_, cudaEventDisableTiming);
+  }
 }
 
 CenterPointTRT::~CenterPointTRT()
 {
+  if (inference_stream_ && inference_stream_ != stream_) {
+    cudaStreamSynchronize(inference_stream_);
+    cudaStreamDestroy(inference_stream_);
+  }
   if (stream_) {
     cudaStreamSynchronize(stream_);
     cudaStreamDestroy(stream_);
   }
+  if (preprocessed_event_) {
+    cudaEventDestroy(preprocessed_event_);
+  }
 }
 
 void CenterPointTRT::initPtr()
@@ -80,11 +97,20 @@ void CenterPointTRT::initPtr()
   const auto grid_xy_size = config_.down_grid_size_x_ * config_.down_grid_size_y_;
 
   // host
-  voxels_.resize(voxels_size);
-  coordinates_.resize(coordinates_size);
-  num_points_per_voxel_.resize(config_.max_voxel_size_);
+  if (!use_device_cache_) {
+    voxels_.resize(voxels_size);
+    coordinates_.resize(coordinates_size);
+    num_points_per_voxel_.resize(config_.max_voxel_size_);
+  }
 
   // device
+  if (use_device_cache_) {
+    const auto grid_size = config_.grid_size_x_ * config_.grid_size_y_ * config_.grid_size_z_;
+    grid_num_points_d_ = cuda::make_unique<unsigned int[]>(grid_size);
+    grid_point_indices_d_ =
+      cuda::make_unique<unsigned int[]>(grid_size * config_.max_point_in_voxel_size_);
+    num_voxels_d_ = cuda::make_unique<unsigned int[]>(1);
+  }
   voxels_d_ = cuda::make_unique<float[]>(voxels_size);
   coordinates_d_ = cuda::make_unique<int[]>(coordinates_size);
   num_points_per_voxel_d_ = cuda::make_unique<float[]>(config_.max_voxel_size_);
@@ -97,19 +123,23 @@ void CenterPointTRT::initPtr()
   head_out_dim_d_ = cuda::make_unique<float[]>(grid_xy_size * config_.head_out_dim_size_);
   head_out_rot_d_ = cuda::make_unique<float[]>(grid_xy_size * config_.head_out_rot_size_);
   head_out_vel_d_ = cuda::make_unique<float[]>(grid_xy_size * config_.head_out_vel_size_);
+  if (use_pipelined_inference_) {
+    pipelined_coordinates_d_ = cuda::make_unique<int[]>(coordinates_size);
+    pipelined_encoder_in_features_d_ = cuda::make_unique<float[]>(encoder_in_feature_size_);
+  }
 }
 
 bool CenterPointTRT::detect(
   const sensor_msgs::msg::PointCloud2 & input_pointcloud_msg, const tf2_ros::Buffer & tf_buffer,
   std::vector<Box3D> & det_boxes3d)
 {
-  std::fill(voxels_.begin(), voxels_.end(), 0);
-  std::fill(coordinates_.begin(), coordinates_.end(), -1);
-  std::fill(num_points_per_voxel_.begin(), num_points_per_voxel_.end(), 0);
+  if (!use_device_cache_) {
+    std::fill(voxels_.begin(), voxels_.end(), 0);
+    std::fill(coordinates_.begin(), coordinates_.end(), -1);
+    std::fill(num_points_per_voxel_.begin(), num_points_per_voxel_.end(), 0);
+  }
   CHECK_CUDA_ERROR(cudaMemsetAsync(
     encoder_in_features_d_.get(), 0, encoder_in_feature_size_ * sizeof(float), stream_));
-  CHECK_CUDA_ERROR(
-    cudaMemsetAsync(spatial_features_d_.get(), 0, spatial_features_size_ * sizeof(float), stream_));
 
   if (!preprocess(input_pointcloud_msg, tf_buffer)) {
     RCLCPP_WARN_STREAM(
@@ -124,31 +154,84 @@ bool CenterPointTRT::detect(
   return true;
 }
 
+bool CenterPointTRT::detectPipelined(
+  const sensor_msgs::msg::PointCloud2 & input_pointcloud_msg, const tf2_ros::Buffer & tf_buffer,
+  std::vector<Box3D> & det_boxes3d, std_msgs::msg::Header & det_header)
+{
+  if (!use_pipelined_inference_) {
+    throw std::runtime_error("detectPipelined() requires use_pipelined_inference.");
+  }
+
+  // Enqueue the inference of the previous frame behind its preprocess. The kernels keep the
+  // pointers of the buffers, so they can be swapped right after.
+  const bool has_previous_frame = has_pipelined_frame_;
+  if (has_previous_frame) {
+    CHECK_CUDA_ERROR(cudaStreamWaitEvent(inference_stream_, preprocessed_event_, 0));
+    inference();
+    det_header = pipelined_header_;
+  }
+  std::swap(coordinates_d_, pipelined_coordinates_d_);
+  std::swap(encoder_in_features_d_, pipelined_encoder_in_features_d_);
+
+  // The buffers written here were last read by the inference of two frames ago, which has been
+  // post-processed already
+  if (!use_device_cache_) {
+    std::fill(voxels_.begin(), voxels_.end(), 0);
+    std::fill(coordinates_.begin(), coordinates_.end(), -1);
+    std::fill(num_points_per_voxel_.begin(), num_points_per_voxel_.end(), 0);
+  }
+  CHECK_CUDA_ERROR(cudaMemsetAsync(
+    encoder_in_features_d_.get(), 0, encoder_in_feature_size_ * sizeof(float), stream_));
+  has_pipelined_frame_ = preprocess(input_pointcloud_msg, tf_buffer);
+  if (has_pipelined_frame_) {
+    CHECK_CUDA_ERROR(cudaEventRecord(preprocessed_event_, stream_));
+    pipelined_header_ = input_pointcloud_msg.header;
+  } else {
+    RCLCPP_WARN_STREAM(
+      rclcpp::get_logger("lidar_centerpoint"), "Fail to preprocess and skip to detect.");
+  }
+
+  if (!has_previous_frame) {
+    return false;
+  }
+  postProcess(det_boxes3d);
+
+  return true;
+}
+
 bool CenterPointTRT::preprocess(
   const sensor_msgs::msg::PointCloud2 & input_pointcloud_msg, const tf2_ros::Buffer & tf_buffer)
 {
-  bool is_success = vg_ptr_->enqueuePointCloud(input_pointcloud_msg, tf_buffer);
+  bool is_success = vg_ptr_->enqueuePointCloud(input_pointcloud_msg, tf_buffer, stream_);
   if (!is_success) {
     return false;
   }
-  num_voxels_ = vg_ptr_->pointsToVoxels(voxels_, coordinates_, num_points_per_voxel_);
-  if (num_voxels_ == 0) {
-    return false;
-  }
+  if (use_device_cache_) {
+    num_voxels_ = generateVoxelsOnDevice();
+    if (num_voxels_ == 0) {
+      return false;
+    }
+  } else {
+    num_voxels_ = vg_ptr_->pointsToVoxels(voxels_, coordinates_, num_points_per_voxel_);
+    if (num_voxels_ == 0) {
+      return false;
+    }
 
-  const auto voxels_size =
-    num_voxels_ * config_.max_point_in_voxel_size_ * config_.point_feature_size_;
-  const auto coordinates_size = num_voxels_ * config_.point_dim_size_;
-  // memcpy from host to device (not copy empty voxels)
-  CHECK_CUDA_ERROR(cudaMemcpyAsync(
-    voxels_d_.get(), voxels_.data(), voxels_size * sizeof(float), cudaMemcpyHostToDevice));
-  CHECK_CUDA_ERROR(cudaMemcpyAsync(
-    coordinates_d_.get(), coordinates_.data(), coordinates_size * sizeof(int),
-    cudaMemcpyHostToDevice));
-  CHECK_CUDA_ERROR(cudaMemcpyAsync(
-    num_points_per_voxel_d_.get(), num_points_per_voxel_.data(), num_voxels_ * sizeof(float),
-    cudaMemcpyHostToDevice));
-  CHECK_CUDA_ERROR(cudaStreamSynchronize(stream_));
+    const auto voxels_size =
+      num_voxels_ * config_.max_point_in_voxel_size_ * config_.point_feature_size_;
+    const auto coordinates_size = num_voxels_ * config_.point_dim_size_;
+    // memcpy from host to device (not copy empty voxels)
+    CHECK_CUDA_ERROR(cudaMemcpyAsync(
+      voxels_d_.get(), voxels_.data(), voxels_size * sizeof(float), cudaMemcpyHostToDevice,
+      stream_));
+    CHECK_CUDA_ERROR(cudaMemcpyAsync(
+      coordinates_d_.get(), coordinates_.data(), coordinates_size * sizeof(int),
+      cudaMemcpyHostToDevice, stream_));
+    CHECK_CUDA_ERROR(cudaMemcpyAsync(
+      num_points_per_voxel_d_.get(), num_points_per_voxel_.data(), num_voxels_ * sizeof(float),
+      cudaMemcpyHostToDevice, stream_));
+    CHECK_CUDA_ERROR(cudaStreamSynchronize(stream_));
+  }
 
   CHECK_CUDA_ERROR(generateFeatures_launch(
     voxels_d_.get(), num_points_per_voxel_d_.get(), coordinates_d_.get(), num_voxels_,
@@ -159,6 +242,46 @@ bool CenterPointTRT::preprocess(
   return true;
 }
 
+std::size_t CenterPointTRT::generateVoxelsOnDevice()
+{
+  const std::size_t num_points = vg_ptr_->getNumSweepPoints();
+  if (num_points == 0) {
+    return 0;
+  }
+  if (num_points > points_capacity_) {
+    points_d_ = cuda::make_unique<float[]>(num_points * config_.point_feature_size_);
+    points_capacity_ = num_points;
+  }
+  vg_ptr_->generateSweepPoints(points_d_.get(), stream_);
+
+  // The voxels are filled in the order of the grid cells instead of the order of the points, so
+  // the points kept in a full voxel and the voxels kept over max_voxel_size can differ from
+  // pointsToVoxels. The order of the voxels does not matter for the scatter.
+  const auto grid_size = config_.grid_size_x_ * config_.grid_size_y_ * config_.grid_size_z_;
+  CHECK_CUDA_ERROR(cudaMemsetAsync(
+    grid_num_points_d_.get(), 0, grid_size * sizeof(unsigned int), stream_));
+  CHECK_CUDA_ERROR(cudaMemsetAsync(num_voxels_d_.get(), 0, sizeof(unsigned int), stream_));
+  CHECK_CUDA_ERROR(generateVoxels_launch(
+    points_d_.get(), num_points, config_.range_min_x_, config_.range_min_y_, config_.range_min_z_,
+    1 / config_.voxel_size_x_, 1 / config_.voxel_size_y_, 1 / config_.voxel_size_z_,
+    static_cast<int>(config_.grid_size_x_), static_cast<int>(config_.grid_size_y_),
+    static_cast<int>(config_.grid_size_z_), config_.max_point_in_voxel_size_,
+    grid_num_points_d_.get(), grid_point_indices_d_.get(), stream_));
+  CHECK_CUDA_ERROR(generateBaseFeatures_launch(
+    points_d_.get(), grid_num_points_d_.get(), grid_point_indices_d_.get(),
+    static_cast<int>(config_.grid_size_x_), static_cast<int>(config_.grid_size_y_),
+    static_cast<int>(config_.grid_size_z_), config_.max_voxel_size_,
+    config_.max_point_in_voxel_size_, num_voxels_d_.get(), voxels_d_.get(),
+    num_points_per_voxel_d_.get(), coordinates_d_.get(), stream_));
+
+  unsigned int num_voxels = 0;
+  CHECK_CUDA_ERROR(cudaMemcpyAsync(
+    &num_voxels, num_voxels_d_.get(), sizeof(unsigned int), cudaMemcpyDeviceToHost, stream_));
+  CHECK_CUDA_ERROR(cudaStreamSynchronize(stream_));
+
+  return std::min<std::size_t>(num_voxels, config_.max_voxel_size_);
+}
+
 void CenterPointTRT::inference()
 {
   if (!encoder_trt_ptr_->context_ || !head_trt_ptr_->context_) {
@@ -167,27 +290,29 @@ void CenterPointTRT::inference()
 
   // pillar encoder network
   std::vector<void *> encoder_buffers{encoder_in_features_d_.get(), pillar_features_d_.get()};
-  encoder_trt_ptr_->context_->enqueueV2(encoder_buffers.data(), stream_, nullptr);
+  encoder_trt_ptr_->context_->enqueueV2(encoder_buffers.data(), inference_stream_, nullptr);
 
   // scatter
+  CHECK_CUDA_ERROR(cudaMemsetAsync(
+    spatial_features_d_.get(), 0, spatial_features_size_ * sizeof(float), inference_stream_));
   CHECK_CUDA_ERROR(scatterFeatures_launch(
     pillar_features_d_.get(), coordinates_d_.get(), num_voxels_, config_.max_voxel_size_,
     config_.encoder_out_feature_size_, config_.grid_size_x_, config_.grid_size_y_,
-    spatial_features_d_.get(), stream_));
+    spatial_features_d_.get(), inference_stream_));
 
   // head network
   std::vector<void *> head_buffers = {spatial_features_d_.get(), head_out_heatmap_d_.get(),
                                       head_out_offset_d_.get(),  head_out_z_d_.get(),
                                       head_out_dim_d_.get(),     head_out_rot_d_.get(),
                                       head_out_vel_d_.get()};
-  head_trt_ptr_->context_->enqueueV2(head_buffers.data(), stream_, nullptr);
+  head_trt_ptr_->context_->enqueueV2(head_buffers.data(), inference_stream_, nullptr);
 }
 
 void CenterPointTRT::postProcess(std::vector<Box3D> & det_boxes3d)
 {
   CHECK_CUDA_ERROR(post_proc_ptr_->generateDetectedBoxes3D_launch(
     head_out_heatmap_d_.get(), head_out_offset_d_.get(), head_out_z_d_.get(), head_out_dim_d_.get(),
-    head_out_rot_d_.get(), head_out_vel_d_.get(), det_boxes3d, stream_));
+    head_out_rot_d_.get(), head_out_vel_d_.get(), det_boxes3d, inference_stream_));
   if (det_boxes3d.size() == 0) {
     RCLCPP_DEBUG_STREAM(rclcpp::get_logger("lidar_centerpoint"), "No detected boxes.");
   }
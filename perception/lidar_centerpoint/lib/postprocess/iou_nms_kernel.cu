@@ -0,0 +1,175 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "lidar_centerpoint/postprocess/iou_nms_kernel.hpp"
+
+#include <lidar_centerpoint/cuda_utils.hpp>
+#include <lidar_centerpoint/utils.hpp>
+
+#include <thrust/count.h>
+#include <thrust/execution_policy.h>
+
+namespace
+{
+const std::size_t THREADS_PER_BLOCK_IOU_NMS = 256;
+// the same as the default of object_recognition_utils::get2dIoU
+const float MIN_UNION_AREA = 0.01f;
+}  // namespace
+
+namespace centerpoint
+{
+
+// corners of the box on the xy plane in the counterclockwise order
+__device__ inline void getCorners(const Box3D & box, float2 * corners)
+{
+  // the yaw of the published object, see box3DToDetectedObject
+  const float yaw = -box.yaw - static_cast<float>(M_PI) / 2.f;
+  const float cos_yaw = cosf(yaw);
+  const float sin_yaw = sinf(yaw);
+  const float half_length = box.length / 2.f;
+  const float half_width = box.width / 2.f;
+  const float dx[4] = {half_length, -half_length, -half_length, half_length};
+  const float dy[4] = {half_width, half_width, -half_width, -half_width};
+  for (int i = 0; i < 4; ++i) {
+    corners[i].x = box.x + cos_yaw * dx[i] - sin_yaw * dy[i];
+    corners[i].y = box.y + sin_yaw * dx[i] + cos_yaw * dy[i];
+  }
+}
+
+// positive if p is on the left of the line from a to b
+__device__ inline float cross(const float2 & a, const float2 & b, const float2 & p)
+{
+  return (b.x - a.x) * (p.y - a.y) - (b.y - a.y) * (p.x - a.x);
+}
+
+// area of the intersection of two convex quadrilaterals, clipping one by the edges of the other
+__device__ float getIntersectionArea(const float2 * subject, const float2 * clip)
+{
+  // each clipping edge adds at most one vertex to the 4 vertices
+  float2 polygon[8];
+  float2 clipped[8];
+  int num_vertices = 4;
+  for (int i = 0; i < 4; ++i) {
+    polygon[i] = subject[i];
+  }
+
+  for (int e = 0; e < 4 && num_vertices > 0; ++e) {
+    const float2 & a = clip[e];
+    const float2 & b = clip[(e + 1) % 4];
+    int num_clipped = 0;
+    for (int i = 0; i < num_vertices; ++i) {
+      const float2 & p = polygon[i];
+      const float2 & q = polygon[(i + 1) % num_vertices];
+      const float cross_p = cross(a, b, p);
+      const float cross_q = cross(a, b, q);
+      if (cross_p >= 0.f) {
+        clipped[num_clipped++] = p;
+      }
+      if ((cross_p >= 0.f) != (cross_q >= 0.f) && num_clipped < 8) {
+        const float t = cross_p / (cross_p - cross_q);
+        clipped[num_clipped].x = p.x + t * (q.x - p.x);
+        clipped[num_clipped].y = p.y + t * (q.y - p.y);
+        ++num_clipped;
+      }
+    }
+    num_vertices = num_clipped;
+    for (int i = 0; i < num_vertices; ++i) {
+      polygon[i] = clipped[i];
+    }
+  }
+
+  float area = 0.f;
+  for (int i = 0; i < num_vertices; ++i) {
+    const float2 & p = polygon[i];
+    const float2 & q = polygon[(i + 1) % num_vertices];
+    area += p.x * q.y - q.x * p.y;
+  }
+  return fabsf(area) / 2.f;
+}
+
+__device__ inline bool isTargetLabel(
+  const int label, const std::uint8_t * target_label_mask, const std::size_t num_labels)
+{
+  return label >= 0 && static_cast<std::size_t>(label) < num_labels && target_label_mask[label];
+}
+
+__global__ void iouBevNMS_Kernel(
+  const Box3D * boxes, const std::size_t num_boxes3d, const std::uint8_t * target_label_mask,
+  const std::size_t num_labels, const float search_dist2d_pow, const float iou_threshold,
+  bool * keep_mask)
+{
+  // params: boxes (N,) sorted by the score
+  // params: keep_mask (N,)
+  const std::size_t target_idx = blockIdx.x * THREADS_PER_BLOCK_IOU_NMS + threadIdx.x;
+  if (target_idx >= num_boxes3d) {
+    return;
+  }
+
+  const Box3D target = boxes[target_idx];
+  float2 target_corners[4];
+  getCorners(target, target_corners);
+  const float target_area = target.length * target.width;
+  const bool is_target_label = isTargetLabel(target.label, target_label_mask, num_labels);
+
+  bool keep = true;
+  for (std::size_t source_idx = 0; source_idx < target_idx; ++source_idx) {
+    const Box3D source = boxes[source_idx];
+    const bool is_target_pair =
+      is_target_label && isTargetLabel(source.label, target_label_mask, num_labels);
+    const float dist2d_pow = powf(target.x - source.x, 2) + powf(target.y - source.y, 2);
+    if (!is_target_pair && dist2d_pow > search_dist2d_pow) {
+      continue;
+    }
+
+    float2 source_corners[4];
+    getCorners(source, source_corners);
+    const float intersection_area = getIntersectionArea(target_corners, source_corners);
+    if (intersection_area == 0.f) {
+      continue;
+    }
+    const float union_area = target_area + source.length * source.width - intersection_area;
+    const float iou =
+      union_area < MIN_UNION_AREA ? 0.f : fminf(1.f, intersection_area / union_area);
+    if (iou > iou_threshold) {
+      keep = false;
+      break;
+    }
+  }
+  keep_mask[target_idx] = keep;
+}
+
+std::size_t iouBevNMS(
+  const thrust::device_vector<Box3D> & boxes3d,
+  const thrust::device_vector<std::uint8_t> & target_label_mask, const float search_distance_2d,
+  const float iou_threshold, thrust::device_vector<bool> & keep_mask, cudaStream_t stream)
+{
+  const auto num_boxes3d = boxes3d.size();
+  keep_mask.resize(num_boxes3d);
+  if (num_boxes3d == 0) {
+    return 0;
+  }
+
+  const dim3 blocks(divup(num_boxes3d, THREADS_PER_BLOCK_IOU_NMS));
+  const dim3 threads(THREADS_PER_BLOCK_IOU_NMS);
+  iouBevNMS_Kernel<<<blocks, threads, 0, stream>>>(
+    thrust::raw_pointer_cast(boxes3d.data()), num_boxes3d,
+    thrust::raw_pointer_cast(target_label_mask.data()), target_label_mask.size(),
+    search_distance_2d * search_distance_2d, iou_threshold,
+    thrust::raw_pointer_cast(keep_mask.data()));
+  CHECK_CUDA_ERROR(cudaGetLastError());
+
+  return thrust::count(thrust::device, keep_mask.begin(), keep_mask.end(), true);
+}
+
+}  // namespace centerpoint
@@ -13,6 +13,7 @@
 // limitations under the License.
 
 #include "lidar_centerpoint/postprocess/circle_nms_kernel.hpp"
+#include "lidar_centerpoint/postprocess/iou_nms_kernel.hpp"
 
 #include <lidar_centerpoint/postprocess/postprocess_kernel.hpp>
 
@@ -115,6 +116,8 @@ PostProcessCUDA::PostProcessCUDA(const CenterPointConfig & config) : config_(con
   boxes3d_d_ = thrust::device_vector<Box3D>(num_raw_boxes3d);
   yaw_norm_thresholds_d_ = thrust::device_vector<float>(
     config_.yaw_norm_thresholds_.begin(), config_.yaw_norm_thresholds_.end());
+  iou_nms_target_label_mask_d_ = thrust::device_vector<std::uint8_t>(
+    config_.iou_nms_target_label_mask_.begin(), config_.iou_nms_target_label_mask_.end());
 }
 
 // cspell: ignore divup
@@ -159,8 +162,21 @@ cudaError_t PostProcessCUDA::generateDetectedBoxes3D_launch(
     thrust::device, det_boxes3d_d.begin(), det_boxes3d_d.end(), final_keep_mask_d.begin(),
     final_det_boxes3d_d.begin(), is_kept());
 
+  // suppress by IoU-based NMS, so that only the final boxes are copied to the host
+  if (config_.use_iou_nms_ && num_final_det_boxes3d > 1) {
+    thrust::device_vector<bool> iou_keep_mask_d;
+    const auto num_iou_det_boxes3d = iouBevNMS(
+      final_det_boxes3d_d, iou_nms_target_label_mask_d_, config_.iou_nms_search_distance_2d_,
+      config_.iou_nms_threshold_, iou_keep_mask_d, stream);
+    thrust::device_vector<Box3D> iou_det_boxes3d_d(num_iou_det_boxes3d);
+    thrust::copy_if(
+      thrust::device, final_det_boxes3d_d.begin(), final_det_boxes3d_d.end(),
+      iou_keep_mask_d.begin(), iou_det_boxes3d_d.begin(), is_kept());
+    final_det_boxes3d_d.swap(iou_det_boxes3d_d);
+  }
+
   // memcpy device to host
-  det_boxes3d.resize(num_final_det_boxes3d);
+  det_boxes3d.resize(final_det_boxes3d_d.size());
   thrust::copy(final_det_boxes3d_d.begin(), final_det_boxes3d_d.end(), det_boxes3d.begin());
 
   return cudaGetLastError();
@@ -25,6 +25,7 @@
 #include <tf2_eigen/tf2_eigen.hpp>
 #endif
 
+#include <stdexcept>
 #include <string>
 #include <utility>
 
@@ -58,10 +59,14 @@ namespace centerpoint
 {
 PointCloudDensification::PointCloudDensification(const DensificationParam & param) : param_(param)
 {
+  if (param_.use_device_cache()) {
+    device_sweeps_.resize(param_.pointcloud_cache_size());
+  }
 }
 
 bool PointCloudDensification::enqueuePointCloud(
-  const sensor_msgs::msg::PointCloud2 & pointcloud_msg, const tf2_ros::Buffer & tf_buffer)
+  const sensor_msgs::msg::PointCloud2 & pointcloud_msg, const tf2_ros::Buffer & tf_buffer,
+  cudaStream_t stream)
 {
   const auto header = pointcloud_msg.header;
 
@@ -73,9 +78,9 @@ bool PointCloudDensification::enqueuePointCloud(
     }
     auto affine_world2current = transformToEigen(transform_world2current.get());
 
-    enqueue(pointcloud_msg, affine_world2current);
+    enqueue(pointcloud_msg, affine_world2current, stream);
   } else {
-    enqueue(pointcloud_msg, Eigen::Affine3f::Identity());
+    enqueue(pointcloud_msg, Eigen::Affine3f::Identity(), stream);
   }
 
   dequeue();
@@ -84,12 +89,25 @@ bool PointCloudDensification::enqueuePointCloud(
 }
 
 void PointCloudDensification::enqueue(
-  const sensor_msgs::msg::PointCloud2 & msg, const Eigen::Affine3f & affine_world2current)
+  const sensor_msgs::msg::PointCloud2 & msg, const Eigen::Affine3f & affine_world2current,
+  cudaStream_t stream)
 {
   affine_world2current_ = affine_world2current;
   current_timestamp_ = rclcpp::Time(msg.header.stamp).seconds();
-  PointCloudWithTransform pointcloud = {msg, affine_world2current.inverse()};
-  pointcloud_cache_.push_front(pointcloud);
+  if (!param_.use_device_cache()) {
+    PointCloudWithTransform pointcloud = {msg, affine_world2current.inverse()};
+    pointcloud_cache_.push_front(pointcloud);
+    return;
+  }
+
+  // The slot of the oldest sweep is reused, which is dequeued right after when the cache is full
+  PointCloudWithTransform pointcloud;
+  pointcloud.pointcloud_msg.header = msg.header;
+  pointcloud.affine_past2world = affine_world2current.inverse();
+  pointcloud.device_sweep_index = next_device_sweep_index_;
+  uploadSweep(msg, device_sweeps_[next_device_sweep_index_], stream);
+  next_device_sweep_index_ = (next_device_sweep_index_ + 1) % device_sweeps_.size();
+  pointcloud_cache_.push_front(std::move(pointcloud));
 }
 
 void PointCloudDensification::dequeue()
@@ -99,4 +117,33 @@ void PointCloudDensification::dequeue()
   }
 }
 
+void PointCloudDensification::uploadSweep(
+  const sensor_msgs::msg::PointCloud2 & msg, DeviceSweep & sweep, cudaStream_t stream)
+{
+  const auto field_offset = [&msg](const std::string & name) {
+    for (const auto & field : msg.fields) {
+      if (field.name == name && field.datatype == sensor_msgs::msg::PointField::FLOAT32) {
+        return field.offset;
+      }
+    }
+    throw std::runtime_error("Field " + name + " of type float32 does not exist");
+  };
+  sweep.x_offset = field_offset("x");
+  sweep.y_offset = field_offset("y");
+  sweep.z_offset = field_offset("z");
+  sweep.point_step = msg.point_step;
+  // the same points as the ones visited by PointCloud2ConstIterator
+  sweep.num_points = msg.point_step > 0 ? msg.data.size() / msg.point_step : 0;
+
+  const std::size_t num_bytes = sweep.num_points * sweep.point_step;
+  if (num_bytes > sweep.capacity) {
+    sweep.data_d = cuda::make_unique<std::uint8_t[]>(num_bytes);
+    sweep.capacity = num_bytes;
+  }
+  if (num_bytes > 0) {
+    CHECK_CUDA_ERROR(cudaMemcpyAsync(
+      sweep.data_d.get(), msg.data.data(), num_bytes, cudaMemcpyHostToDevice, stream));
+  }
+}
+
 }  // namespace centerpoint
@@ -37,10 +37,89 @@ namespace
 const std::size_t MAX_POINT_IN_VOXEL_SIZE = 32;  // the same as max_point_in_voxel_size_ in config
 const std::size_t WARPS_PER_BLOCK = 4;
 const std::size_t ENCODER_IN_FEATURE_SIZE = 9;  // the same as encoder_in_feature_size_ in config
+const std::size_t THREADS_PER_BLOCK = 256;
 }  // namespace
 
 namespace centerpoint
 {
+__global__ void generateSweepPoints_kernel(
+  const std::uint8_t * input_points, const std::size_t num_points, const std::size_t point_step,
+  const std::uint32_t x_offset, const std::uint32_t y_offset, const std::uint32_t z_offset,
+  const float time_lag, const Affine3x4 affine, float4 * output_points)
+{
+  // input_points (uint8): (num_points, point_step), raw PointCloud2 data with float32 x, y and z
+  // output_points (float): (num_points, point_feature_size), x, y, z and time lag
+  const std::size_t point_idx = blockIdx.x * blockDim.x + threadIdx.x;
+  if (point_idx >= num_points) return;
+
+  const std::uint8_t * point = input_points + point_idx * point_step;
+  const float x = *reinterpret_cast<const float *>(point + x_offset);
+  const float y = *reinterpret_cast<const float *>(point + y_offset);
+  const float z = *reinterpret_cast<const float *>(point + z_offset);
+  const float * m = affine.m;
+  output_points[point_idx] = make_float4(
+    m[0] * x + m[1] * y + m[2] * z + m[3], m[4] * x + m[5] * y + m[6] * z + m[7],
+    m[8] * x + m[9] * y + m[10] * z + m[11], time_lag);
+}
+
+__global__ void generateVoxels_kernel(
+  const float4 * points, const std::size_t num_points, const float range_min_x,
+  const float range_min_y, const float range_min_z, const float recip_voxel_size_x,
+  const float recip_voxel_size_y, const float recip_voxel_size_z, const int grid_size_x,
+  const int grid_size_y, const int grid_size_z, const std::size_t max_point_in_voxel_size,
+  unsigned int * grid_num_points, unsigned int * grid_point_indices)
+{
+  // grid_num_points (uint): (grid_size_z * grid_size_y * grid_size_x)
+  // grid_point_indices (uint): (grid_size_z * grid_size_y * grid_size_x, max_point_in_voxel_size)
+  const std::size_t point_idx = blockIdx.x * blockDim.x + threadIdx.x;
+  if (point_idx >= num_points) return;
+
+  // the same truncation as VoxelGenerator::pointsToVoxels
+  const float4 point = points[point_idx];
+  const int x = static_cast<int>((point.x - range_min_x) * recip_voxel_size_x);
+  const int y = static_cast<int>((point.y - range_min_y) * recip_voxel_size_y);
+  const int z = static_cast<int>((point.z - range_min_z) * recip_voxel_size_z);
+  if (x < 0 || x >= grid_size_x || y < 0 || y >= grid_size_y || z < 0 || z >= grid_size_z) {
+    return;
+  }
+
+  const std::size_t grid_idx = (z * grid_size_y + y) * grid_size_x + x;
+  const unsigned int slot = atomicAdd(&grid_num_points[grid_idx], 1);
+  if (slot < max_point_in_voxel_size) {
+    grid_point_indices[grid_idx * max_point_in_voxel_size + slot] = point_idx;
+  }
+}
+
+__global__ void generateBaseFeatures_kernel(
+  const float4 * points, const unsigned int * grid_num_points,
+  const unsigned int * grid_point_indices, const int grid_size_x, const int grid_size_y,
+  const int grid_size_z, const std::size_t max_voxel_size,
+  const std::size_t max_point_in_voxel_size, unsigned int * num_voxels, float4 * voxels,
+  float * num_points_per_voxel, int3 * coords)
+{
+  // voxels (float): (max_voxel_size, max_point_in_voxel_size, point_feature_size)
+  // num_points_per_voxel (float): (max_voxel_size)
+  // coords (int): (max_voxel_size, point_dim_size), in z, y and x order
+  const std::size_t grid_idx = blockIdx.x * blockDim.x + threadIdx.x;
+  if (grid_idx >= static_cast<std::size_t>(grid_size_x) * grid_size_y * grid_size_z) return;
+
+  const unsigned int num_points = min(
+    grid_num_points[grid_idx], static_cast<unsigned int>(max_point_in_voxel_size));
+  if (num_points == 0) return;
+  const unsigned int voxel_idx = atomicAdd(num_voxels, 1);
+  if (voxel_idx >= max_voxel_size) return;
+
+  for (unsigned int i = 0; i < num_points; i++) {
+    voxels[voxel_idx * max_point_in_voxel_size + i] =
+      points[grid_point_indices[grid_idx * max_point_in_voxel_size + i]];
+  }
+  num_points_per_voxel[voxel_idx] = num_points;
+  const int x = grid_idx % grid_size_x;
+  const int y = (grid_idx / grid_size_x) % grid_size_y;
+  const int z = grid_idx / (grid_size_x * grid_size_y);
+  coords[voxel_idx] = make_int3(z, y, x);
+}
+
 __global__ void generateFeatures_kernel(
   const float * voxel_features, const float * voxel_num_points, const int * coords,
   const std::size_t num_voxels, const float voxel_x, const float voxel_y, const float voxel_z,
@@ -157,4 +236,54 @@ cudaError_t generateFeatures_launch(
   return cudaGetLastError();
 }
 
+cudaError_t generateSweepPoints_launch(
+  const std::uint8_t * input_points, const std::size_t num_points, const std::size_t point_step,
+  const std::uint32_t x_offset, const std::uint32_t y_offset, const std::uint32_t z_offset,
+  const float time_lag, const Affine3x4 affine_past2current, float * output_points,
+  cudaStream_t stream)
+{
+  dim3 blocks(divup(num_points, THREADS_PER_BLOCK));
+  dim3 threads(THREADS_PER_BLOCK);
+  generateSweepPoints_kernel<<<blocks, threads, 0, stream>>>(
+    input_points, num_points, point_step, x_offset, y_offset, z_offset, time_lag,
+    affine_past2current, reinterpret_cast<float4 *>(output_points));
+
+  return cudaGetLastError();
+}
+
+cudaError_t generateVoxels_launch(
+  const float * points, const std::size_t num_points, const float range_min_x,
+  const float range_min_y, const float range_min_z, const float recip_voxel_size_x,
+  const float recip_voxel_size_y, const float recip_voxel_size_z, const int grid_size_x,
+  const int grid_size_y, const int grid_size_z, const std::size_t max_point_in_voxel_size,
+  unsigned int * grid_num_points, unsigned int * grid_point_indices, cudaStream_t stream)
+{
+  dim3 blocks(divup(num_points, THREADS_PER_BLOCK));
+  dim3 threads(THREADS_PER_BLOCK);
+  generateVoxels_kernel<<<blocks, threads, 0, stream>>>(
+    reinterpret_cast<const float4 *>(points), num_points, range_min_x, range_min_y, range_min_z,
+    recip_voxel_size_x, recip_voxel_size_y, recip_voxel_size_z, grid_size_x, grid_size_y,
+    grid_size_z, max_point_in_voxel_size, grid_num_points, grid_point_indices);
+
+  return cudaGetLastError();
+}
+
+cudaError_t generateBaseFeatures_launch(
+  const float * points, const unsigned int * grid_num_points,
+  const unsigned int * grid_point_indices, const int grid_size_x, const int grid_size_y,
+  const int grid_size_z, const std::size_t max_voxel_size,
+  const std::size_t max_point_in_voxel_size, unsigned int * num_voxels, float * voxels,
+  float * num_points_per_voxel, int * coords, cudaStream_t stream)
+{
+  const std::size_t grid_size = static_cast<std::size_t>(grid_size_x) * grid_size_y * grid_size_z;
+  dim3 blocks(divup(grid_size, THREADS_PER_BLOCK));
+  dim3 threads(THREADS_PER_BLOCK);
+  generateBaseFeatures_kernel<<<blocks, threads, 0, stream>>>(
+    reinterpret_cast<const float4 *>(points), grid_num_points, grid_point_indices, grid_size_x,
+    grid_size_y, grid_size_z, max_voxel_size, max_point_in_voxel_size, num_voxels,
+    reinterpret_cast<float4 *>(voxels), num_points_per_voxel, reinterpret_cast<int3 *>(coords));
+
+  return cudaGetLastError();
+}
+
 }  // namespace centerpoint
@@ -14,6 +14,8 @@
 
 #include "lidar_centerpoint/preprocess/voxel_generator.hpp"
 
+#include <lidar_centerpoint/preprocess/preprocess_kernel.hpp>
+
 #include <sensor_msgs/point_cloud2_iterator.hpp>
 
 namespace centerpoint
@@ -38,9 +40,53 @@ VoxelGeneratorTemplate::VoxelGeneratorTemplate(
 }
 
 bool VoxelGeneratorTemplate::enqueuePointCloud(
-  const sensor_msgs::msg::PointCloud2 & input_pointcloud_msg, const tf2_ros::Buffer & tf_buffer)
+  const sensor_msgs::msg::PointCloud2 & input_pointcloud_msg, const tf2_ros::Buffer & tf_buffer,
+  cudaStream_t stream)
+{
+  return pd_ptr_->enqueuePointCloud(input_pointcloud_msg, tf_buffer, stream);
+}
+
+std::size_t VoxelGeneratorTemplate::getNumSweepPoints()
+{
+  std::size_t num_points = 0;
+  for (auto pc_cache_iter = pd_ptr_->getPointCloudCacheIter(); !pd_ptr_->isCacheEnd(pc_cache_iter);
+       pc_cache_iter++) {
+    num_points += pd_ptr_->getDeviceSweep(pc_cache_iter->device_sweep_index).num_points;
+  }
+  return num_points;
+}
+
+std::size_t VoxelGeneratorTemplate::generateSweepPoints(float * points_d, cudaStream_t stream)
 {
-  return pd_ptr_->enqueuePointCloud(input_pointcloud_msg, tf_buffer);
+  std::size_t point_cnt = 0;  // @return
+  for (auto pc_cache_iter = pd_ptr_->getPointCloudCacheIter(); !pd_ptr_->isCacheEnd(pc_cache_iter);
+       pc_cache_iter++) {
+    const auto & sweep = pd_ptr_->getDeviceSweep(pc_cache_iter->device_sweep_index);
+    if (sweep.num_points == 0) {
+      continue;
+    }
+    auto affine_past2current =
+      pd_ptr_->pointcloud_cache_size() > 1
+        ? pd_ptr_->getAffineWorldToCurrent() * pc_cache_iter->affine_past2world
+        : Eigen::Affine3f::Identity();
+    float time_lag = static_cast<float>(
+      pd_ptr_->getCurrentTimestamp() -
+      rclcpp::Time(pc_cache_iter->pointcloud_msg.header.stamp).seconds());
+
+    Affine3x4 affine;
+    for (int r = 0; r < 3; r++) {
+      for (int c = 0; c < 4; c++) {
+        affine.m[r * 4 + c] = affine_past2current(r, c);
+      }
+    }
+    CHECK_CUDA_ERROR(generateSweepPoints_launch(
+      sweep.data_d.get(), sweep.num_points, sweep.point_step, sweep.x_offset, sweep.y_offset,
+      sweep.z_offset, time_lag, affine, points_d + point_cnt * config_.point_feature_size_,
+      stream));
+    point_cnt += sweep.num_points;
+  }
+
+  return point_cnt;
 }
 
 std::size_t VoxelGenerator::pointsToVoxels(
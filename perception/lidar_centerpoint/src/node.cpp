@@ -29,8 +29,11 @@
 #include <Eigen/Dense>
 #include <Eigen/Geometry>
 
+#include <algorithm>
+#include <cassert>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace centerpoint
@@ -48,6 +51,8 @@ LidarCenterPointNode::LidarCenterPointNode(const rclcpp::NodeOptions & node_opti
     this->declare_parameter("densification_world_frame_id", "map");
   const int densification_num_past_frames =
     this->declare_parameter("densification_num_past_frames", 1);
+  const bool densification_use_device_cache =
+    this->declare_parameter("densification_use_device_cache", false);
   const std::string trt_precision = this->declare_parameter("trt_precision", "fp16");
   const std::string encoder_onnx_path = this->declare_parameter<std::string>("encoder_onnx_path");
   const std::string encoder_engine_path =
@@ -56,6 +61,7 @@ LidarCenterPointNode::LidarCenterPointNode(const rclcpp::NodeOptions & node_opti
   const std::string head_engine_path = this->declare_parameter<std::string>("head_engine_path");
   class_names_ = this->declare_parameter<std::vector<std::string>>("class_names");
   has_twist_ = this->declare_parameter("has_twist", false);
+  use_pipelined_inference_ = this->declare_parameter("use_pipelined_inference", false);
   const std::size_t point_feature_size =
     static_cast<std::size_t>(this->declare_parameter<std::int64_t>("point_feature_size"));
   const std::size_t max_voxel_size =
@@ -74,20 +80,18 @@ LidarCenterPointNode::LidarCenterPointNode(const rclcpp::NodeOptions & node_opti
   detection_class_remapper_.setParameters(
     allow_remapping_by_area_matrix, min_area_matrix, max_area_matrix);
 
-  {
-    NMSParams p;
-    p.nms_type_ = NMS_TYPE::IoU_BEV;
-    p.target_class_names_ =
-      this->declare_parameter<std::vector<std::string>>("iou_nms_target_class_names");
-    p.search_distance_2d_ = this->declare_parameter<double>("iou_nms_search_distance_2d");
-    p.iou_threshold_ = this->declare_parameter<double>("iou_nms_threshold");
-    iou_bev_nms_.setParameters(p);
-  }
+  const auto iou_nms_target_class_names =
+    this->declare_parameter<std::vector<std::string>>("iou_nms_target_class_names");
+  const double iou_nms_search_distance_2d =
+    this->declare_parameter<double>("iou_nms_search_distance_2d");
+  const double iou_nms_threshold = this->declare_parameter<double>("iou_nms_threshold");
+  assert(iou_nms_search_distance_2d >= 0.0);
+  assert(iou_nms_threshold >= 0.0 && iou_nms_threshold <= 1.0);
 
   NetworkParam encoder_param(encoder_onnx_path, encoder_engine_path, trt_precision);
   NetworkParam head_param(head_onnx_path, head_engine_path, trt_precision);
   DensificationParam densification_param(
-    densification_world_frame_id, densification_num_past_frames);
+    densification_world_frame_id, densification_num_past_frames, densification_use_device_cache);
 
   if (point_cloud_range.size() != 6) {
     RCLCPP_WARN_STREAM(
@@ -103,8 +107,23 @@ LidarCenterPointNode::LidarCenterPointNode(const rclcpp::NodeOptions & node_opti
     class_names_.size(), point_feature_size, max_voxel_size, point_cloud_range, voxel_size,
     downsample_factor, encoder_in_feature_size, score_threshold, circle_nms_dist_threshold,
     yaw_norm_thresholds);
-  detector_ptr_ =
-    std::make_unique<CenterPointTRT>(encoder_param, head_param, densification_param, config);
+  {
+    // the classes are compared by the semantic type, as NonMaximumSuppression does
+    std::vector<bool> iou_nms_target_label_mask;
+    for (const auto & class_name : class_names_) {
+      const auto label = getSemanticType(class_name);
+      iou_nms_target_label_mask.push_back(std::any_of(
+        iou_nms_target_class_names.begin(), iou_nms_target_class_names.end(),
+        [label](const auto & target_class_name) {
+          return getSemanticType(target_class_name) == label;
+        }));
+    }
+    config.setIoUNMSParameters(
+      iou_nms_target_label_mask, static_cast<float>(iou_nms_search_distance_2d),
+      static_cast<float>(iou_nms_threshold));
+  }
+  detector_ptr_ = std::make_unique<CenterPointTRT>(
+    encoder_param, head_param, densification_param, config, use_pipelined_inference_);
 
   pointcloud_sub_ = this->create_subscription<sensor_msgs::msg::PointCloud2>(
     "~/input/pointcloud", rclcpp::SensorDataQoS{}.keep_last(1),
@@ -142,23 +161,25 @@ void LidarCenterPointNode::pointCloudCallback(
   }
 
   std::vector<Box3D> det_boxes3d;
-  bool is_success = detector_ptr_->detect(*input_pointcloud_msg, tf_buffer_, det_boxes3d);
+  std_msgs::msg::Header det_header = input_pointcloud_msg->header;
+  bool is_success =
+    use_pipelined_inference_
+      ? detector_ptr_->detectPipelined(*input_pointcloud_msg, tf_buffer_, det_boxes3d, det_header)
+      : detector_ptr_->detect(*input_pointcloud_msg, tf_buffer_, det_boxes3d);
   if (!is_success) {
     return;
   }
 
-  std::vector<autoware_auto_perception_msgs::msg::DetectedObject> raw_objects;
-  raw_objects.reserve(det_boxes3d.size());
+  // the boxes have been suppressed by NMS on the device
+  autoware_auto_perception_msgs::msg::DetectedObjects output_msg;
+  output_msg.header = det_header;
+  output_msg.objects.reserve(det_boxes3d.size());
   for (const auto & box3d : det_boxes3d) {
     autoware_auto_perception_msgs::msg::DetectedObject obj;
     box3DToDetectedObject(box3d, class_names_, has_twist_, obj);
-    raw_objects.emplace_back(obj);
+    output_msg.objects.emplace_back(std::move(obj));
   }
 
-  autoware_auto_perception_msgs::msg::DetectedObjects output_msg;
-  output_msg.header = input_pointcloud_msg->header;
-  output_msg.objects = iou_bev_nms_.apply(raw_objects);
-
   detection_class_remapper_.mapClasses(output_msg);
 
   if (objects_sub_count > 0) {
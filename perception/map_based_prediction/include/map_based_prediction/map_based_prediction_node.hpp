@@ -34,8 +34,11 @@
 #include <lanelet2_routing/Forward.h>
 #include <lanelet2_traffic_rules/TrafficRules.h>
 
+#include <array>
+#include <cstring>
 #include <deque>
 #include <memory>
+#include <optional>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -81,6 +84,13 @@ struct LaneletData
   float probability;
 };
 
+struct LaneletRoutingData
+{
+  bool is_isolated;
+  std::optional<lanelet::ConstLanelet> left_lanelet;
+  std::optional<lanelet::ConstLanelet> right_lanelet;
+};
+
 struct PredictedRefPath
 {
   float probability;
@@ -88,6 +98,20 @@ struct PredictedRefPath
   Maneuver maneuver;
 };
 
+// the UUID bytes of a tracked object, used as the key of the object histories
+using ObjectId = std::array<uint8_t, 16>;
+
+struct ObjectIdHash
+{
+  size_t operator()(const ObjectId & id) const
+  {
+    // the UUID is random, so a part of its bytes is already a good hash
+    size_t hash;
+    std::memcpy(&hash, id.data(), sizeof(hash));
+    return hash;
+  }
+};
+
 using LaneletsData = std::vector<LaneletData>;
 using ManeuverProbability = std::unordered_map<Maneuver, float>;
 using autoware_auto_mapping_msgs::msg::HADMapBin;
@@ -116,7 +140,7 @@ private:
   rclcpp::Subscription<HADMapBin>::SharedPtr sub_map_;
 
   // Object History
-  std::unordered_map<std::string, std::deque<ObjectData>> objects_history_;
+  std::unordered_map<ObjectId, std::deque<ObjectData>, ObjectIdHash> objects_history_;
 
   // Lanelet Map Pointers
   std::shared_ptr<lanelet::LaneletMap> lanelet_map_ptr_;
@@ -132,6 +156,9 @@ private:
   // Crosswalk Entry Points
   lanelet::ConstLanelets crosswalks_;
 
+  // Neighbors of the lanelets, when use_lanelet_cache_
+  std::unordered_map<lanelet::Id, LaneletRoutingData> lanelet_routing_data_;
+
   // Parameters
   bool enable_delay_compensation_;
   double prediction_time_horizon_;
@@ -158,6 +185,8 @@ private:
   double diff_dist_threshold_to_right_bound_;
   int num_continuous_state_transition_;
   double reference_path_resolution_;
+  bool use_lanelet_cache_;
+  int num_threads_;
 
   // Stop watch
   StopWatch<std::chrono::milliseconds> stop_watch_;
@@ -181,9 +210,15 @@ private:
 
   PredictedObject getPredictedObjectAsCrosswalkUser(const TrackedObject & object);
 
+  std::optional<PredictedObject> predictObject(
+    const TrackedObject & transformed_object, const ObjectClassification::_label_type label,
+    const LaneletsData & current_lanelets, const double objects_detected_time,
+    std::optional<Maneuver> & debug_maneuver);
+
   void removeOldObjectsHistory(const double current_time);
 
   LaneletsData getCurrentLanelets(const TrackedObject & object);
+  std::optional<LaneletsData> getCachedCurrentLanelets(const TrackedObject & object);
   bool checkCloseLaneletCondition(
     const std::pair<double, lanelet::Lanelet> & lanelet, const TrackedObject & object);
   float calculateLocalLikelihood(
@@ -24,7 +24,6 @@
 #include <tier4_autoware_utils/math/constants.hpp>
 #include <tier4_autoware_utils/math/normalization.hpp>
 #include <tier4_autoware_utils/math/unit_conversion.hpp>
-#include <tier4_autoware_utils/ros/uuid_helper.hpp>
 
 #include <autoware_auto_perception_msgs/msg/detected_objects.hpp>
 
@@ -48,6 +47,7 @@
 #include <cmath>
 #include <functional>
 #include <limits>
+#include <utility>
 
 namespace map_based_prediction
 {
@@ -276,6 +276,41 @@ lanelet::ConstLanelets getLeftLineSharingLanelets(
   return output_lanelets;  // return empty
 }
 
+/**
+ * @brief Get the left or right lanelet of the lanelet, which is its routing graph neighbor,
+ * or else the first lanelet sharing its bound
+ * @param lanelet
+ * @param get_left true for the left lanelet
+ * @param routing_graph_ptr
+ * @param lanelet_map_ptr
+ * @return the lanelet, if any
+ */
+std::optional<lanelet::ConstLanelet> getLeftOrRightLanelets(
+  const lanelet::ConstLanelet & lanelet, const bool get_left,
+  const lanelet::routing::RoutingGraphPtr & routing_graph_ptr,
+  const lanelet::LaneletMapPtr & lanelet_map_ptr)
+{
+  const auto opt = get_left ? routing_graph_ptr->left(lanelet) : routing_graph_ptr->right(lanelet);
+  if (!!opt) {
+    return *opt;
+  }
+  const auto adjacent =
+    get_left ? routing_graph_ptr->adjacentLeft(lanelet) : routing_graph_ptr->adjacentRight(lanelet);
+  if (!!adjacent) {
+    return *adjacent;
+  }
+  // search for unconnected lanelet
+  const auto unconnected_lanelets = get_left
+                                      ? getLeftLineSharingLanelets(lanelet, lanelet_map_ptr)
+                                      : getRightLineSharingLanelets(lanelet, lanelet_map_ptr);
+  // just return first candidate of unconnected lanelet for now
+  if (!unconnected_lanelets.empty()) {
+    return unconnected_lanelets.front();
+  }
+  // if no candidate lanelet found, return empty
+  return std::nullopt;
+}
+
 /**
  * @brief Check if the lanelet is isolated in routing graph
  * @param current_lanelet
@@ -713,6 +748,13 @@ void replaceObjectYawWithLaneletsYaw(
   pose_with_cov.pose.orientation = tf2::toMsg(filtered_quaternion);
 }
 
+bool isVehicleLabel(const ObjectClassification::_label_type label)
+{
+  return label == ObjectClassification::CAR || label == ObjectClassification::BUS ||
+         label == ObjectClassification::TRAILER || label == ObjectClassification::MOTORCYCLE ||
+         label == ObjectClassification::TRUCK;
+}
+
 }  // namespace
 
 MapBasedPredictionNode::MapBasedPredictionNode(const rclcpp::NodeOptions & node_options)
@@ -762,6 +804,8 @@ MapBasedPredictionNode::MapBasedPredictionNode(const rclcpp::NodeOptions & node_
       declare_parameter<int>("lane_change_detection.num_continuous_state_transition");
   }
   reference_path_resolution_ = declare_parameter<double>("reference_path_resolution");
+  use_lanelet_cache_ = declare_parameter<bool>("use_lanelet_cache");
+  num_threads_ = declare_parameter<int>("num_threads");
   /* prediction path will disabled when the estimated path length exceeds lanelet length. This
    * parameter control the estimated path length = vx * th * (rate)  */
   prediction_time_horizon_rate_for_validate_lane_length_ =
@@ -820,6 +864,22 @@ void MapBasedPredictionNode::mapCallback(const HADMapBin::ConstSharedPtr msg)
   const auto walkways = lanelet::utils::query::walkwayLanelets(all_lanelets);
   crosswalks_.insert(crosswalks_.end(), crosswalks.begin(), crosswalks.end());
   crosswalks_.insert(crosswalks_.end(), walkways.begin(), walkways.end());
+
+  // The neighbors of the lanelets only depend on the map, so they are searched once here
+  lanelet_routing_data_.clear();
+  if (use_lanelet_cache_) {
+    for (const auto & lanelet : all_lanelets) {
+      lanelet_routing_data_.emplace(
+        lanelet.id(),
+        LaneletRoutingData{
+          isIsolatedLanelet(lanelet, routing_graph_ptr_),
+          getLeftOrRightLanelets(lanelet, true, routing_graph_ptr_, lanelet_map_ptr_),
+          getLeftOrRightLanelets(lanelet, false, routing_graph_ptr_, lanelet_map_ptr_)});
+    }
+    RCLCPP_INFO(
+      get_logger(), "[Map Based Prediction]: Cached the neighbors of %zu lanelets",
+      lanelet_routing_data_.size());
+  }
 }
 
 void MapBasedPredictionNode::objectsCallback(const TrackedObjects::ConstSharedPtr in_objects)
@@ -859,9 +919,16 @@ void MapBasedPredictionNode::objectsCallback(const TrackedObjects::ConstSharedPt
   // result debug
   visualization_msgs::msg::MarkerArray debug_markers;
 
-  for (const auto & object : in_objects->objects) {
-    std::string object_id = tier4_autoware_utils::toHexString(object.object_id);
-    TrackedObject transformed_object = object;
+  // Step 1. Transform the objects and update their histories, which may add new objects to
+  // objects_history_, so this is done sequentially.
+  const size_t num_objects = in_objects->objects.size();
+  std::vector<TrackedObject> transformed_objects(num_objects);
+  std::vector<ObjectClassification::_label_type> labels(num_objects);
+  std::vector<LaneletsData> current_lanelets_set(num_objects);
+  for (size_t i = 0; i < num_objects; ++i) {
+    const auto & object = in_objects->objects.at(i);
+    TrackedObject & transformed_object = transformed_objects.at(i);
+    transformed_object = object;
 
     // transform object frame if it's based on map frame
     if (in_objects->header.frame_id != "map") {
@@ -874,143 +941,167 @@ void MapBasedPredictionNode::objectsCallback(const TrackedObjects::ConstSharedPt
 
     // get tracking label and update it for the prediction
     const auto & label_ = transformed_object.classification.front().label;
-    const auto label = changeLabelForPrediction(label_, object, lanelet_map_ptr_);
-
-    switch (label) {
-      case ObjectClassification::PEDESTRIAN:
-      case ObjectClassification::BICYCLE: {
-        const auto predicted_object_crosswalk =
-          getPredictedObjectAsCrosswalkUser(transformed_object);
-        output.objects.push_back(predicted_object_crosswalk);
-        break;
-      }
-      case ObjectClassification::CAR:
-      case ObjectClassification::BUS:
-      case ObjectClassification::TRAILER:
-      case ObjectClassification::MOTORCYCLE:
-      case ObjectClassification::TRUCK: {
-        // Update object yaw and velocity
-        updateObjectData(transformed_object);
-
-        // Get Closest Lanelet
-        const auto current_lanelets = getCurrentLanelets(transformed_object);
-
-        // Update Objects History
-        updateObjectsHistory(output.header, transformed_object, current_lanelets);
-
-        // For off lane obstacles
-        if (current_lanelets.empty()) {
-          PredictedPath predicted_path =
-            path_generator_->generatePathForOffLaneVehicle(transformed_object);
-          predicted_path.confidence = 1.0;
-          if (predicted_path.path.empty()) break;
-
-          auto predicted_object_vehicle = convertToPredictedObject(transformed_object);
-          predicted_object_vehicle.kinematics.predicted_paths.push_back(predicted_path);
-          output.objects.push_back(predicted_object_vehicle);
-          break;
-        }
+    labels.at(i) = changeLabelForPrediction(label_, object, lanelet_map_ptr_);
 
-        // For too-slow vehicle
-        const double abs_obj_speed = std::hypot(
-          transformed_object.kinematics.twist_with_covariance.twist.linear.x,
-          transformed_object.kinematics.twist_with_covariance.twist.linear.y);
-        if (std::fabs(abs_obj_speed) < min_velocity_for_map_based_prediction_) {
-          PredictedPath predicted_path =
-            path_generator_->generatePathForLowSpeedVehicle(transformed_object);
-          predicted_path.confidence = 1.0;
-          if (predicted_path.path.empty()) break;
-
-          auto predicted_slow_object = convertToPredictedObject(transformed_object);
-          predicted_slow_object.kinematics.predicted_paths.push_back(predicted_path);
-          output.objects.push_back(predicted_slow_object);
-          break;
-        }
+    if (isVehicleLabel(labels.at(i))) {
+      // Update object yaw and velocity
+      updateObjectData(transformed_object);
 
-        // Get Predicted Reference Path for Each Maneuver and current lanelets
-        // return: <probability, paths>
-        const auto ref_paths =
-          getPredictedReferencePath(transformed_object, current_lanelets, objects_detected_time);
-
-        // If predicted reference path is empty, assume this object is out of the lane
-        if (ref_paths.empty()) {
-          PredictedPath predicted_path =
-            path_generator_->generatePathForLowSpeedVehicle(transformed_object);
-          predicted_path.confidence = 1.0;
-          if (predicted_path.path.empty()) break;
-
-          auto predicted_object_out_of_lane = convertToPredictedObject(transformed_object);
-          predicted_object_out_of_lane.kinematics.predicted_paths.push_back(predicted_path);
-          output.objects.push_back(predicted_object_out_of_lane);
-          break;
-        }
+      // Get Closest Lanelet
+      current_lanelets_set.at(i) = getCurrentLanelets(transformed_object);
 
-        // Get Debug Marker for On Lane Vehicles
-        const auto max_prob_path = std::max_element(
-          ref_paths.begin(), ref_paths.end(),
-          [](const PredictedRefPath & a, const PredictedRefPath & b) {
-            return a.probability < b.probability;
-          });
-        const auto debug_marker =
-          getDebugMarker(object, max_prob_path->maneuver, debug_markers.markers.size());
-        debug_markers.markers.push_back(debug_marker);
-
-        // Fix object angle if its orientation unreliable (e.g. far object by radar sensor)
-        // This prevent bending predicted path
-        TrackedObject yaw_fixed_transformed_object = transformed_object;
-        if (
-          transformed_object.kinematics.orientation_availability ==
-          autoware_auto_perception_msgs::msg::TrackedObjectKinematics::UNAVAILABLE) {
-          replaceObjectYawWithLaneletsYaw(current_lanelets, yaw_fixed_transformed_object);
-        }
-        // Generate Predicted Path
-        std::vector<PredictedPath> predicted_paths;
-        for (const auto & ref_path : ref_paths) {
-          PredictedPath predicted_path = path_generator_->generatePathForOnLaneVehicle(
-            yaw_fixed_transformed_object, ref_path.path);
-          if (predicted_path.path.empty()) {
-            continue;
-          }
-          predicted_path.confidence = ref_path.probability;
-          predicted_paths.push_back(predicted_path);
-        }
+      // Update Objects History
+      updateObjectsHistory(output.header, transformed_object, current_lanelets_set.at(i));
+    }
+  }
 
-        // Normalize Path Confidence and output the predicted object
+  // Step 2. Predict the paths of each object. An object only modifies its own history, which
+  // already exists, and writes its results to its own slot, so the objects can be predicted in
+  // parallel.
+  std::vector<std::optional<PredictedObject>> predicted_objects(num_objects);
+  std::vector<std::optional<Maneuver>> debug_maneuvers(num_objects);
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic)
+#endif
+  for (int i = 0; i < static_cast<int>(num_objects); ++i) {
+    predicted_objects.at(i) = predictObject(
+      transformed_objects.at(i), labels.at(i), current_lanelets_set.at(i), objects_detected_time,
+      debug_maneuvers.at(i));
+  }
+
+  // Step 3. Output the results in the order of the input objects
+  for (size_t i = 0; i < num_objects; ++i) {
+    if (debug_maneuvers.at(i)) {
+      const auto debug_marker = getDebugMarker(
+        in_objects->objects.at(i), *debug_maneuvers.at(i), debug_markers.markers.size());
+      debug_markers.markers.push_back(debug_marker);
+    }
+    if (predicted_objects.at(i)) {
+      output.objects.push_back(*predicted_objects.at(i));
+    }
+  }
 
-        float sum_confidence = 0.0;
-        for (const auto & predicted_path : predicted_paths) {
-          sum_confidence += predicted_path.confidence;
-        }
-        const float min_sum_confidence_value = 1e-3;
-        sum_confidence = std::max(sum_confidence, min_sum_confidence_value);
+  // Publish Results
+  pub_objects_->publish(output);
+  pub_debug_markers_->publish(debug_markers);
+  const auto calculation_time_msg = createStringStamped(now(), stop_watch_.toc());
+  pub_calculation_time_->publish(calculation_time_msg);
+}
 
-        auto predicted_object = convertToPredictedObject(transformed_object);
+std::optional<PredictedObject> MapBasedPredictionNode::predictObject(
+  const TrackedObject & transformed_object, const ObjectClassification::_label_type label,
+  const LaneletsData & current_lanelets, const double objects_detected_time,
+  std::optional<Maneuver> & debug_maneuver)
+{
+  switch (label) {
+    case ObjectClassification::PEDESTRIAN:
+    case ObjectClassification::BICYCLE: {
+      return getPredictedObjectAsCrosswalkUser(transformed_object);
+    }
+    case ObjectClassification::CAR:
+    case ObjectClassification::BUS:
+    case ObjectClassification::TRAILER:
+    case ObjectClassification::MOTORCYCLE:
+    case ObjectClassification::TRUCK: {
+      // For off lane obstacles
+      if (current_lanelets.empty()) {
+        PredictedPath predicted_path =
+          path_generator_->generatePathForOffLaneVehicle(transformed_object);
+        predicted_path.confidence = 1.0;
+        if (predicted_path.path.empty()) return std::nullopt;
 
-        for (auto & predicted_path : predicted_paths) {
-          predicted_path.confidence = predicted_path.confidence / sum_confidence;
-          predicted_object.kinematics.predicted_paths.push_back(predicted_path);
-        }
-        output.objects.push_back(predicted_object);
-        break;
+        auto predicted_object_vehicle = convertToPredictedObject(transformed_object);
+        predicted_object_vehicle.kinematics.predicted_paths.push_back(predicted_path);
+        return predicted_object_vehicle;
       }
-      default: {
-        auto predicted_unknown_object = convertToPredictedObject(transformed_object);
+
+      // For too-slow vehicle
+      const double abs_obj_speed = std::hypot(
+        transformed_object.kinematics.twist_with_covariance.twist.linear.x,
+        transformed_object.kinematics.twist_with_covariance.twist.linear.y);
+      if (std::fabs(abs_obj_speed) < min_velocity_for_map_based_prediction_) {
         PredictedPath predicted_path =
-          path_generator_->generatePathForNonVehicleObject(transformed_object);
+          path_generator_->generatePathForLowSpeedVehicle(transformed_object);
         predicted_path.confidence = 1.0;
+        if (predicted_path.path.empty()) return std::nullopt;
 
-        predicted_unknown_object.kinematics.predicted_paths.push_back(predicted_path);
-        output.objects.push_back(predicted_unknown_object);
-        break;
+        auto predicted_slow_object = convertToPredictedObject(transformed_object);
+        predicted_slow_object.kinematics.predicted_paths.push_back(predicted_path);
+        return predicted_slow_object;
       }
+
+      // Get Predicted Reference Path for Each Maneuver and current lanelets
+      // return: <probability, paths>
+      const auto ref_paths =
+        getPredictedReferencePath(transformed_object, current_lanelets, objects_detected_time);
+
+      // If predicted reference path is empty, assume this object is out of the lane
+      if (ref_paths.empty()) {
+        PredictedPath predicted_path =
+          path_generator_->generatePathForLowSpeedVehicle(transformed_object);
+        predicted_path.confidence = 1.0;
+        if (predicted_path.path.empty()) return std::nullopt;
+
+        auto predicted_object_out_of_lane = convertToPredictedObject(transformed_object);
+        predicted_object_out_of_lane.kinematics.predicted_paths.push_back(predicted_path);
+        return predicted_object_out_of_lane;
+      }
+
+      // Get Debug Marker for On Lane Vehicles
+      const auto max_prob_path = std::max_element(
+        ref_paths.begin(), ref_paths.end(),
+        [](const PredictedRefPath & a, const PredictedRefPath & b) {
+          return a.probability < b.probability;
+        });
+      debug_maneuver = max_prob_path->maneuver;
+
+      // Fix object angle if its orientation unreliable (e.g. far object by radar sensor)
+      // This prevent bending predicted path
+      TrackedObject yaw_fixed_transformed_object = transformed_object;
+      if (
+        transformed_object.kinematics.orientation_availability ==
+        autoware_auto_perception_msgs::msg::TrackedObjectKinematics::UNAVAILABLE) {
+        replaceObjectYawWithLaneletsYaw(current_lanelets, yaw_fixed_transformed_object);
+      }
+      // Generate Predicted Path
+      std::vector<PredictedPath> predicted_paths;
+      for (const auto & ref_path : ref_paths) {
+        PredictedPath predicted_path = path_generator_->generatePathForOnLaneVehicle(
+          yaw_fixed_transformed_object, ref_path.path);
+        if (predicted_path.path.empty()) {
+          continue;
+        }
+        predicted_path.confidence = ref_path.probability;
+        predicted_paths.push_back(predicted_path);
+      }
+
+      // Normalize Path Confidence and output the predicted object
+
+      float sum_confidence = 0.0;
+      for (const auto & predicted_path : predicted_paths) {
+        sum_confidence += predicted_path.confidence;
+      }
+      const float min_sum_confidence_value = 1e-3;
+      sum_confidence = std::max(sum_confidence, min_sum_confidence_value);
+
+      auto predicted_object = convertToPredictedObject(transformed_object);
+
+      for (auto & predicted_path : predicted_paths) {
+        predicted_path.confidence = predicted_path.confidence / sum_confidence;
+        predicted_object.kinematics.predicted_paths.push_back(predicted_path);
+      }
+      return predicted_object;
     }
-  }
+    default: {
+      auto predicted_unknown_object = convertToPredictedObject(transformed_object);
+      PredictedPath predicted_path =
+        path_generator_->generatePathForNonVehicleObject(transformed_object);
+      predicted_path.confidence = 1.0;
 
-  // Publish Results
-  pub_objects_->publish(output);
-  pub_debug_markers_->publish(debug_markers);
-  const auto calculation_time_msg = createStringStamped(now(), stop_watch_.toc());
-  pub_calculation_time_->publish(calculation_time_msg);
+      predicted_unknown_object.kinematics.predicted_paths.push_back(predicted_path);
+      return predicted_unknown_object;
+    }
+  }
 }
 
 bool MapBasedPredictionNode::doesPathCrossAnyFence(const PredictedPath & predicted_path)
@@ -1222,14 +1313,12 @@ void MapBasedPredictionNode::updateObjectData(TrackedObject & object)
 
 void MapBasedPredictionNode::removeOldObjectsHistory(const double current_time)
 {
-  std::vector<std::string> invalid_object_id;
-  for (auto iter = objects_history_.begin(); iter != objects_history_.end(); ++iter) {
-    const std::string object_id = iter->first;
+  for (auto iter = objects_history_.begin(); iter != objects_history_.end();) {
     std::deque<ObjectData> & object_data = iter->second;
 
     // If object data is empty, we are going to delete the buffer for the obstacle
     if (object_data.empty()) {
-      invalid_object_id.push_back(object_id);
+      iter = objects_history_.erase(iter);
       continue;
     }
 
@@ -1237,7 +1326,7 @@ void MapBasedPredictionNode::removeOldObjectsHistory(const double current_time)
 
     // Delete Old Objects
     if (current_time - latest_object_time > 2.0) {
-      invalid_object_id.push_back(object_id);
+      iter = objects_history_.erase(iter);
       continue;
     }
 
@@ -1253,18 +1342,21 @@ void MapBasedPredictionNode::removeOldObjectsHistory(const double current_time)
     }
 
     if (object_data.empty()) {
-      invalid_object_id.push_back(object_id);
+      iter = objects_history_.erase(iter);
       continue;
     }
-  }
-
-  for (const auto & key : invalid_object_id) {
-    objects_history_.erase(key);
+    ++iter;
   }
 }
 
 LaneletsData MapBasedPredictionNode::getCurrentLanelets(const TrackedObject & object)
 {
+  if (use_lanelet_cache_) {
+    if (const auto cached_lanelets = getCachedCurrentLanelets(object)) {
+      return *cached_lanelets;
+    }
+  }
+
   // obstacle point
   lanelet::BasicPoint2d search_point(
     object.kinematics.pose_with_covariance.pose.position.x,
@@ -1352,6 +1444,31 @@ LaneletsData MapBasedPredictionNode::getCurrentLanelets(const TrackedObject & ob
   return LaneletsData{};
 }
 
+std::optional<LaneletsData> MapBasedPredictionNode::getCachedCurrentLanelets(
+  const TrackedObject & object)
+{
+  // The current lanelets of the last frame are kept as long as the object is still inside all of
+  // them and they still match its direction. Otherwise, they are searched again.
+  const auto history = objects_history_.find(object.object_id.uuid);
+  if (history == objects_history_.end()) {
+    return std::nullopt;
+  }
+  const auto & prev_lanelets = history->second.back().current_lanelets;
+  if (prev_lanelets.empty()) {
+    return std::nullopt;
+  }
+
+  LaneletsData object_lanelets;
+  for (const auto & prev_lanelet : prev_lanelets) {
+    const auto lanelet = lanelet_map_ptr_->laneletLayer.get(prev_lanelet.id());
+    if (!withinLanelet(object, lanelet) || !checkCloseLaneletCondition({0.0, lanelet}, object)) {
+      return std::nullopt;
+    }
+    object_lanelets.push_back(LaneletData{lanelet, calculateLocalLikelihood(lanelet, object)});
+  }
+  return object_lanelets;
+}
+
 bool MapBasedPredictionNode::checkCloseLaneletCondition(
   const std::pair<double, lanelet::Lanelet> & lanelet, const TrackedObject & object)
 {
@@ -1362,10 +1479,10 @@ bool MapBasedPredictionNode::checkCloseLaneletCondition(
 
   // If the object is in the objects history, we check if the target lanelet is
   // inside the current lanelets id or following lanelets
-  const std::string object_id = tier4_autoware_utils::toHexString(object.object_id);
-  if (objects_history_.count(object_id) != 0) {
+  const auto history = objects_history_.find(object.object_id.uuid);
+  if (history != objects_history_.end()) {
     const std::vector<lanelet::ConstLanelet> & possible_lanelet =
-      objects_history_.at(object_id).back().future_possible_lanelets;
+      history->second.back().future_possible_lanelets;
 
     bool not_in_possible_lanelet =
       std::find(possible_lanelet.begin(), possible_lanelet.end(), lanelet.second) ==
@@ -1436,7 +1553,6 @@ void MapBasedPredictionNode::updateObjectsHistory(
   const std_msgs::msg::Header & header, const TrackedObject & object,
   const LaneletsData & current_lanelets_data)
 {
-  std::string object_id = tier4_autoware_utils::toHexString(object.object_id);
   const auto current_lanelets = getLanelets(current_lanelets_data);
 
   ObjectData single_object_data;
@@ -1456,20 +1572,16 @@ void MapBasedPredictionNode::updateObjectsHistory(
     single_object_data.lateral_kinematics_set[current_lane] = lateral_kinematics;
   }
 
-  if (objects_history_.count(object_id) == 0) {
-    // New Object(Create a new object in object histories)
-    std::deque<ObjectData> object_data = {single_object_data};
-    objects_history_.emplace(object_id, object_data);
-  } else {
-    // Object that is already in the object buffer
-    std::deque<ObjectData> & object_data = objects_history_.at(object_id);
+  // New Object(Create a new object in object histories) or object that is already in the object
+  // buffer
+  std::deque<ObjectData> & object_data = objects_history_[object.object_id.uuid];
+  if (!object_data.empty()) {
     // get previous object data and update
-    const auto prev_object_data = object_data.back();
+    const auto & prev_object_data = object_data.back();
     updateLateralKinematicsVector(
       prev_object_data, single_object_data, routing_graph_ptr_, cutoff_freq_of_velocity_lpf_);
-
-    object_data.push_back(single_object_data);
   }
+  object_data.push_back(std::move(single_object_data));
 }
 
 std::vector<PredictedRefPath> MapBasedPredictionNode::getPredictedReferencePath(
@@ -1489,11 +1601,25 @@ std::vector<PredictedRefPath> MapBasedPredictionNode::getPredictedReferencePath(
     const double validate_time_horizon =
       prediction_time_horizon_ * prediction_time_horizon_rate_for_validate_lane_length_;
 
+    // the neighbors of the lanelets are taken from the table of the map, if it is cached
+    const auto isIsolated = [&](const lanelet::ConstLanelet & lanelet) {
+      const auto cached = lanelet_routing_data_.find(lanelet.id());
+      return cached != lanelet_routing_data_.end() ? cached->second.is_isolated
+                                                   : isIsolatedLanelet(lanelet, routing_graph_ptr_);
+    };
+    const auto getLeftOrRight = [&](const lanelet::ConstLanelet & lanelet, const bool get_left) {
+      const auto cached = lanelet_routing_data_.find(lanelet.id());
+      if (cached != lanelet_routing_data_.end()) {
+        return get_left ? cached->second.left_lanelet : cached->second.right_lanelet;
+      }
+      return getLeftOrRightLanelets(lanelet, get_left, routing_graph_ptr_, lanelet_map_ptr_);
+    };
+
     // lambda function to get possible paths for isolated lanelet
     // isolated is often caused by lanelet with no connection e.g. shoulder-lane
     auto getPathsForNormalOrIsolatedLanelet = [&](const lanelet::ConstLanelet & lanelet) {
       // if lanelet is not isolated, return normal possible paths
-      if (!isIsolatedLanelet(lanelet, routing_graph_ptr_)) {
+      if (!isIsolated(lanelet)) {
         return routing_graph_ptr_->possiblePaths(lanelet, possible_params);
       }
       // if lanelet is isolated, check if it has enough length
@@ -1505,43 +1631,17 @@ std::vector<PredictedRefPath> MapBasedPredictionNode::getPredictedReferencePath(
       }
     };
 
-    // lambda function to extract left/right lanelets
-    auto getLeftOrRightLanelets = [&](
-                                    const lanelet::ConstLanelet & lanelet,
-                                    const bool get_left) -> std::optional<lanelet::ConstLanelet> {
-      const auto opt =
-        get_left ? routing_graph_ptr_->left(lanelet) : routing_graph_ptr_->right(lanelet);
-      if (!!opt) {
-        return *opt;
-      }
-      const auto adjacent = get_left ? routing_graph_ptr_->adjacentLeft(lanelet)
-                                     : routing_graph_ptr_->adjacentRight(lanelet);
-      if (!!adjacent) {
-        return *adjacent;
-      }
-      // search for unconnected lanelet
-      const auto unconnected_lanelets = get_left
-                                          ? getLeftLineSharingLanelets(lanelet, lanelet_map_ptr_)
-                                          : getRightLineSharingLanelets(lanelet, lanelet_map_ptr_);
-      // just return first candidate of unconnected lanelet for now
-      if (!unconnected_lanelets.empty()) {
-        return unconnected_lanelets.front();
-      }
-      // if no candidate lanelet found, return empty
-      return std::nullopt;
-    };
-
     // Step1. Get the path
     // Step1.1 Get the left lanelet
     lanelet::routing::LaneletPaths left_paths;
-    const auto left_lanelet = getLeftOrRightLanelets(current_lanelet_data.lanelet, true);
+    const auto left_lanelet = getLeftOrRight(current_lanelet_data.lanelet, true);
     if (!!left_lanelet) {
       left_paths = getPathsForNormalOrIsolatedLanelet(left_lanelet.value());
     }
 
     // Step1.2 Get the right lanelet
     lanelet::routing::LaneletPaths right_paths;
-    const auto right_lanelet = getLeftOrRightLanelets(current_lanelet_data.lanelet, false);
+    const auto right_lanelet = getLeftOrRight(current_lanelet_data.lanelet, false);
     if (!!right_lanelet) {
       right_paths = getPathsForNormalOrIsolatedLanelet(right_lanelet.value());
     }
@@ -1596,11 +1696,11 @@ Maneuver MapBasedPredictionNode::predictObjectManeuver(
     throw std::logic_error("Lane change detection method is invalid.");
   }();
 
-  const std::string object_id = tier4_autoware_utils::toHexString(object.object_id);
-  if (objects_history_.count(object_id) == 0) {
+  const auto history = objects_history_.find(object.object_id.uuid);
+  if (history == objects_history_.end()) {
     return current_maneuver;
   }
-  auto & object_info = objects_history_.at(object_id);
+  auto & object_info = history->second;
 
   // update maneuver in object history
   if (!object_info.empty()) {
@@ -1635,12 +1735,12 @@ Maneuver MapBasedPredictionNode::predictObjectManeuverByTimeToLaneChange(
   const double /*object_detected_time*/)
 {
   // Step1. Check if we have the object in the buffer
-  const std::string object_id = tier4_autoware_utils::toHexString(object.object_id);
-  if (objects_history_.count(object_id) == 0) {
+  const auto history = objects_history_.find(object.object_id.uuid);
+  if (history == objects_history_.end()) {
     return Maneuver::LANE_FOLLOW;
   }
 
-  const std::deque<ObjectData> & object_info = objects_history_.at(object_id);
+  const std::deque<ObjectData> & object_info = history->second;
 
   // Step2. Check if object history length longer than history_time_length
   const int latest_id = static_cast<int>(object_info.size()) - 1;
@@ -1706,12 +1806,12 @@ Maneuver MapBasedPredictionNode::predictObjectManeuverByLatDiffDistance(
   const double /*object_detected_time*/)
 {
   // Step1. Check if we have the object in the buffer
-  const std::string object_id = tier4_autoware_utils::toHexString(object.object_id);
-  if (objects_history_.count(object_id) == 0) {
+  const auto history = objects_history_.find(object.object_id.uuid);
+  if (history == objects_history_.end()) {
     return Maneuver::LANE_FOLLOW;
   }
 
-  const std::deque<ObjectData> & object_info = objects_history_.at(object_id);
+  const std::deque<ObjectData> & object_info = history->second;
   const double current_time = (this->get_clock()->now()).seconds();
 
   // Step2. Get the previous id
@@ -1734,8 +1834,7 @@ Maneuver MapBasedPredictionNode::predictObjectManeuverByLatDiffDistance(
   // Step3. Get closest previous lanelet ID
   const auto & prev_info = object_info.at(static_cast<size_t>(prev_id));
   const auto prev_pose = prev_info.pose;
-  const lanelet::ConstLanelets prev_lanelets =
-    object_info.at(static_cast<size_t>(prev_id)).current_lanelets;
+  const lanelet::ConstLanelets & prev_lanelets = prev_info.current_lanelets;
   if (prev_lanelets.empty()) {
     return Maneuver::LANE_FOLLOW;
   }
@@ -1867,13 +1966,13 @@ double MapBasedPredictionNode::calcLeftLateralOffset(
 void MapBasedPredictionNode::updateFuturePossibleLanelets(
   const TrackedObject & object, const lanelet::routing::LaneletPaths & paths)
 {
-  std::string object_id = tier4_autoware_utils::toHexString(object.object_id);
-  if (objects_history_.count(object_id) == 0) {
+  const auto history = objects_history_.find(object.object_id.uuid);
+  if (history == objects_history_.end()) {
     return;
   }
 
   std::vector<lanelet::ConstLanelet> & possible_lanelets =
-    objects_history_.at(object_id).back().future_possible_lanelets;
+    history->second.back().future_possible_lanelets;
   for (const auto & path : paths) {
     for (const auto & lanelet : path) {
       bool not_in_buffer = std::find(possible_lanelets.begin(), possible_lanelets.end(), lanelet) ==
@@ -19,13 +19,14 @@
 #ifndef MULTI_OBJECT_TRACKER__DATA_ASSOCIATION__DATA_ASSOCIATION_HPP_
 #define MULTI_OBJECT_TRACKER__DATA_ASSOCIATION__DATA_ASSOCIATION_HPP_
 
+#include <cstdint>
 #include <list>
 #include <memory>
 #include <unordered_map>
 #include <vector>
 
 #define EIGEN_MPL2_ONLY
-#include "multi_object_tracker/data_association/solver/gnn_solver.hpp"
+#include "gnn_solver/gnn_solver.hpp"
 #include "multi_object_tracker/tracker/tracker.hpp"
 
 #include <Eigen/Core>
@@ -35,6 +36,10 @@
 
 class DataAssociation
 {
+public:
+  // row: tracker, col: measurement, with the pairs which pass all the gates
+  using SparseScoreMatrix = gnn_solver::SparseScoreMatrix;
+
 private:
   Eigen::MatrixXi can_assign_matrix_;
   Eigen::MatrixXd max_dist_matrix_;
@@ -43,20 +48,45 @@ private:
   Eigen::MatrixXd max_rad_matrix_;
   Eigen::MatrixXd min_iou_matrix_;
   const double score_threshold_;
+  const int num_threads_;
   std::unique_ptr<gnn_solver::GnnSolverInterface> gnn_solver_ptr_;
 
+  double calcScore(
+    const autoware_auto_perception_msgs::msg::DetectedObject & measurement_object,
+    const std::uint8_t measurement_label,
+    const autoware_auto_perception_msgs::msg::TrackedObject & tracked_object,
+    const std::uint8_t tracker_label) const;
+
 public:
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
   DataAssociation(
     std::vector<int> can_assign_vector, std::vector<double> max_dist_vector,
     std::vector<double> max_area_vector, std::vector<double> min_area_vector,
-    std::vector<double> max_rad_vector, std::vector<double> min_iou_vector);
+    std::vector<double> max_rad_vector, std::vector<double> min_iou_vector,
+    const int num_threads = 1);
   void assign(
     const Eigen::MatrixXd & src, std::unordered_map<int, int> & direct_assignment,
     std::unordered_map<int, int> & reverse_assignment);
   Eigen::MatrixXd calcScoreMatrix(
     const autoware_auto_perception_msgs::msg::DetectedObjects & measurements,
     const std::list<std::shared_ptr<Tracker>> & trackers);
+
+  /**
+   * Same scores as calcScoreMatrix(), for the pairs which pass the gates only.
+   * The measurements are indexed in a grid of the largest max distance, so that a tracker is only
+   * gated against the measurements of the 3x3 cells around it.
+   */
+  SparseScoreMatrix calcSparseScoreMatrix(
+    const autoware_auto_perception_msgs::msg::DetectedObjects & measurements,
+    const std::list<std::shared_ptr<Tracker>> & trackers);
+
+  /**
+   * Same assignment as assign(), up to ties. Each connected component of the bipartite graph of
+   * the gated pairs is solved on its own, in parallel with num_threads.
+   */
+  void assignSparse(
+    const SparseScoreMatrix & src, std::unordered_map<int, int> & direct_assignment,
+    std::unordered_map<int, int> & reverse_assignment);
   virtual ~DataAssociation() {}
 };
 
@@ -0,0 +1,105 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef MULTI_OBJECT_TRACKER__TRACKER__MODEL__BATCH_PREDICTOR_HPP_
+#define MULTI_OBJECT_TRACKER__TRACKER__MODEL__BATCH_PREDICTOR_HPP_
+
+#define EIGEN_MPL2_ONLY
+#include <Eigen/Core>
+#include <kalman_filter/kalman_filter.hpp>
+#include <rclcpp/time.hpp>
+
+#include <array>
+#include <cstddef>
+#include <vector>
+
+/**
+ * Prediction of the EKF of many tracks at once, per motion model.
+ * The states and covariances of the tracks of a model are gathered into structure-of-arrays
+ * buffers of fixed dimension, predicted together in loops over the tracks which the compiler
+ * vectorizes, and written back to the EKF of each track. The buffers are kept between frames, so
+ * that a prediction does not allocate once the number of tracks is stable.
+ * The models are the ones of Tracker::predict(const rclcpp::Time &) of the trackers which add
+ * themselves with Tracker::addToBatchPredictor().
+ */
+class BatchPredictor
+{
+public:
+  /** \brief Static bicycle model of NormalVehicleTracker, BigVehicleTracker and BicycleTracker. */
+  struct BicycleModelParams
+  {
+    double lr;
+    double q_cov_x;
+    double q_cov_y;
+    double q_cov_yaw;
+    double q_cov_vx;
+    double q_cov_slip;
+  };
+
+  /** \brief Constant turn rate and velocity model of PedestrianTracker. */
+  struct CtrvModelParams
+  {
+    double q_cov_x;
+    double q_cov_y;
+    double q_cov_yaw;
+    double q_cov_vx;
+    double q_cov_wz;
+  };
+
+  /** \brief Add a track, its EKF and last update time are updated by the next predict(). */
+  void addBicycleModel(
+    KalmanFilter & ekf, rclcpp::Time & last_update_time, const BicycleModelParams & params);
+  void addCtrvModel(
+    KalmanFilter & ekf, rclcpp::Time & last_update_time, const CtrvModelParams & params);
+
+  std::size_t size() const { return bicycle_.ekfs.size() + ctrv_.ekfs.size(); }
+
+  /** \brief Predict all the added tracks to `time`, then remove them. */
+  void predict(const rclcpp::Time & time);
+
+private:
+  static constexpr int DIM = 5;
+  static constexpr int NUM_PARAMS = 6;
+
+  struct Batch
+  {
+    std::vector<KalmanFilter *> ekfs;
+    std::vector<rclcpp::Time *> last_update_times;
+    std::array<std::vector<double>, NUM_PARAMS> params;
+    std::vector<double> dt;
+    // x[i][k] is the element i of the state of the track k, P[i * DIM + j][k] the element (i, j)
+    // of its covariance, and so are the linearized model A and the process noise Q
+    std::array<std::vector<double>, DIM> x;
+    std::array<std::vector<double>, DIM * DIM> P;
+    std::array<std::vector<double>, DIM * DIM> A;
+    std::array<std::vector<double>, DIM * DIM> Q;
+    std::array<std::vector<double>, DIM * DIM> AP;
+
+    void add(KalmanFilter & ekf, rclcpp::Time & last_update_time, const double * track_params);
+    void clear();
+  };
+
+  void gather(Batch & batch, const rclcpp::Time & time);
+  void scatter(Batch & batch, const rclcpp::Time & time);
+  static void predictBicycleModel(Batch & batch);
+  static void predictCtrvModel(Batch & batch);
+  static void propagateCovariance(Batch & batch);
+
+  Batch bicycle_;
+  Batch ctrv_;
+  Eigen::MatrixXd x_buffer_;
+  Eigen::MatrixXd P_buffer_;
+};
+
+#endif  // MULTI_OBJECT_TRACKER__TRACKER__MODEL__BATCH_PREDICTOR_HPP_
@@ -33,6 +33,8 @@
 
 #include <vector>
 
+class BatchPredictor;
+
 class Tracker
 {
 protected:
@@ -77,6 +79,11 @@ public:
   }
   virtual geometry_msgs::msg::PoseWithCovariance getPoseWithCovariance(
     const rclcpp::Time & time) const;
+  /**
+   * Add the prediction of this tracker to `predictor`, in place of predict().
+   * \return false if the motion model of the tracker is not batched, predict() is then used
+   */
+  virtual bool addToBatchPredictor(BatchPredictor & /*predictor*/) { return false; }
 
   /*
    *　Pure virtual function
@@ -14,14 +14,17 @@
 
 #include "multi_object_tracker/data_association/data_association.hpp"
 
-#include "multi_object_tracker/data_association/solver/gnn_solver.hpp"
+#include "gnn_solver/gnn_solver.hpp"
+#include "gnn_solver/spatial_grid.hpp"
 #include "multi_object_tracker/utils/utils.hpp"
 #include "object_recognition_utils/object_recognition_utils.hpp"
 
 #include <algorithm>
+#include <cmath>
 #include <list>
 #include <memory>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace
@@ -71,8 +74,8 @@ double getFormedYawAngle(
 DataAssociation::DataAssociation(
   std::vector<int> can_assign_vector, std::vector<double> max_dist_vector,
   std::vector<double> max_area_vector, std::vector<double> min_area_vector,
-  std::vector<double> max_rad_vector, std::vector<double> min_iou_vector)
-: score_threshold_(0.01)
+  std::vector<double> max_rad_vector, std::vector<double> min_iou_vector, const int num_threads)
+: score_threshold_(0.01), num_threads_(std::max(num_threads, 1))
 {
   {
     const int assign_label_num = static_cast<int>(std::sqrt(can_assign_vector.size()));
@@ -146,6 +149,63 @@ void DataAssociation::assign(
   }
 }
 
+double DataAssociation::calcScore(
+  const autoware_auto_perception_msgs::msg::DetectedObject & measurement_object,
+  const std::uint8_t measurement_label,
+  const autoware_auto_perception_msgs::msg::TrackedObject & tracked_object,
+  const std::uint8_t tracker_label) const
+{
+  const double max_dist = max_dist_matrix_(tracker_label, measurement_label);
+  const double dist = tier4_autoware_utils::calcDistance2d(
+    measurement_object.kinematics.pose_with_covariance.pose.position,
+    tracked_object.kinematics.pose_with_covariance.pose.position);
+
+  bool passed_gate = true;
+  // dist gate
+  if (passed_gate) {
+    if (max_dist < dist) passed_gate = false;
+  }
+  // area gate
+  if (passed_gate) {
+    const double max_area = max_area_matrix_(tracker_label, measurement_label);
+    const double min_area = min_area_matrix_(tracker_label, measurement_label);
+    const double area = tier4_autoware_utils::getArea(measurement_object.shape);
+    if (area < min_area || max_area < area) passed_gate = false;
+  }
+  // angle gate
+  if (passed_gate) {
+    const double max_rad = max_rad_matrix_(tracker_label, measurement_label);
+    const double angle = getFormedYawAngle(
+      measurement_object.kinematics.pose_with_covariance.pose.orientation,
+      tracked_object.kinematics.pose_with_covariance.pose.orientation, false);
+    if (std::fabs(max_rad) < M_PI && std::fabs(max_rad) < std::fabs(angle)) passed_gate = false;
+  }
+  // mahalanobis dist gate
+  if (passed_gate) {
+    const double mahalanobis_dist = getMahalanobisDistance(
+      measurement_object.kinematics.pose_with_covariance.pose.position,
+      tracked_object.kinematics.pose_with_covariance.pose.position,
+      getXYCovariance(tracked_object.kinematics.pose_with_covariance));
+    if (2.448 /*95%*/ <= mahalanobis_dist) passed_gate = false;
+  }
+  // 2d iou gate
+  if (passed_gate) {
+    const double min_iou = min_iou_matrix_(tracker_label, measurement_label);
+    const double min_union_iou_area = 1e-2;
+    const double iou =
+      object_recognition_utils::get2dIoU(measurement_object, tracked_object, min_union_iou_area);
+    if (iou < min_iou) passed_gate = false;
+  }
+
+  // all gate is passed
+  double score = 0.0;
+  if (passed_gate) {
+    score = (max_dist - std::min(dist, max_dist)) / max_dist;
+    if (score < score_threshold_) score = 0.0;
+  }
+  return score;
+}
+
 Eigen::MatrixXd DataAssociation::calcScoreMatrix(
   const autoware_auto_perception_msgs::msg::DetectedObjects & measurements,
   const std::list<std::shared_ptr<Tracker>> & trackers)
@@ -168,55 +228,7 @@ Eigen::MatrixXd DataAssociation::calcScoreMatrix(
       if (can_assign_matrix_(tracker_label, measurement_label)) {
         autoware_auto_perception_msgs::msg::TrackedObject tracked_object;
         (*tracker_itr)->getTrackedObject(measurements.header.stamp, tracked_object);
-
-        const double max_dist = max_dist_matrix_(tracker_label, measurement_label);
-        const double dist = tier4_autoware_utils::calcDistance2d(
-          measurement_object.kinematics.pose_with_covariance.pose.position,
-          tracked_object.kinematics.pose_with_covariance.pose.position);
-
-        bool passed_gate = true;
-        // dist gate
-        if (passed_gate) {
-          if (max_dist < dist) passed_gate = false;
-        }
-        // area gate
-        if (passed_gate) {
-          const double max_area = max_area_matrix_(tracker_label, measurement_label);
-          const double min_area = min_area_matrix_(tracker_label, measurement_label);
-          const double area = tier4_autoware_utils::getArea(measurement_object.shape);
-          if (area < min_area || max_area < area) passed_gate = false;
-        }
-        // angle gate
-        if (passed_gate) {
-          const double max_rad = max_rad_matrix_(tracker_label, measurement_label);
-          const double angle = getFormedYawAngle(
-            measurement_object.kinematics.pose_with_covariance.pose.orientation,
-            tracked_object.kinematics.pose_with_covariance.pose.orientation, false);
-          if (std::fabs(max_rad) < M_PI && std::fabs(max_rad) < std::fabs(angle))
-            passed_gate = false;
-        }
-        // mahalanobis dist gate
-        if (passed_gate) {
-          const double mahalanobis_dist = getMahalanobisDistance(
-            measurement_object.kinematics.pose_with_covariance.pose.position,
-            tracked_object.kinematics.pose_with_covariance.pose.position,
-            getXYCovariance(tracked_object.kinematics.pose_with_covariance));
-          if (2.448 /*95%*/ <= mahalanobis_dist) passed_gate = false;
-        }
-        // 2d iou gate
-        if (passed_gate) {
-          const double min_iou = min_iou_matrix_(tracker_label, measurement_label);
-          const double min_union_iou_area = 1e-2;
-          const double iou = object_recognition_utils::get2dIoU(
-            measurement_object, tracked_object, min_union_iou_area);
-          if (iou < min_iou) passed_gate = false;
-        }
-
-        // all gate is passed
-        if (passed_gate) {
-          score = (max_dist - std::min(dist, max_dist)) / max_dist;
-          if (score < score_threshold_) score = 0.0;
-        }
+        score = calcScore(measurement_object, measurement_label, tracked_object, tracker_label);
       }
       score_matrix(tracker_idx, measurement_idx) = score;
     }
@@ -224,3 +236,83 @@ Eigen::MatrixXd DataAssociation::calcScoreMatrix(
 
   return score_matrix;
 }
+
+DataAssociation::SparseScoreMatrix DataAssociation::calcSparseScoreMatrix(
+  const autoware_auto_perception_msgs::msg::DetectedObjects & measurements,
+  const std::list<std::shared_ptr<Tracker>> & trackers)
+{
+  const int num_trackers = static_cast<int>(trackers.size());
+  const int num_measurements = static_cast<int>(measurements.objects.size());
+
+  // The trackers are predicted once, instead of once per measurement
+  std::vector<autoware_auto_perception_msgs::msg::TrackedObject> tracked_objects(num_trackers);
+  std::vector<std::uint8_t> tracker_labels(num_trackers);
+  {
+    int tracker_idx = 0;
+    for (const auto & tracker : trackers) {
+      tracker_labels[tracker_idx] = tracker->getHighestProbLabel();
+      tracker->getTrackedObject(measurements.header.stamp, tracked_objects[tracker_idx]);
+      ++tracker_idx;
+    }
+  }
+  std::vector<std::uint8_t> measurement_labels(num_measurements);
+  for (int i = 0; i < num_measurements; ++i) {
+    measurement_labels[i] =
+      object_recognition_utils::getHighestProbLabel(measurements.objects[i].classification);
+  }
+
+  // Grid pre-gate: a pair farther than the largest max distance never passes the dist gate
+  std::vector<double> measurement_xs(num_measurements), measurement_ys(num_measurements);
+  for (int i = 0; i < num_measurements; ++i) {
+    const auto & position = measurements.objects[i].kinematics.pose_with_covariance.pose.position;
+    measurement_xs[i] = position.x;
+    measurement_ys[i] = position.y;
+  }
+  const gnn_solver::SpatialGrid grid(max_dist_matrix_.maxCoeff(), measurement_xs, measurement_ys);
+
+  std::vector<std::vector<std::pair<int, double>>> rows(num_trackers);
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic, 8)
+#endif
+  for (int tracker_idx = 0; tracker_idx < num_trackers; ++tracker_idx) {
+    const auto & tracked_object = tracked_objects[tracker_idx];
+    const std::uint8_t tracker_label = tracker_labels[tracker_idx];
+    const auto & position = tracked_object.kinematics.pose_with_covariance.pose.position;
+    std::vector<int> measurement_indices;
+    grid.findNeighbors(position.x, position.y, measurement_indices);
+    auto & row = rows[tracker_idx];
+    for (const int measurement_idx : measurement_indices) {
+      const std::uint8_t measurement_label = measurement_labels[measurement_idx];
+      if (!can_assign_matrix_(tracker_label, measurement_label)) {
+        continue;
+      }
+      const double score = calcScore(
+        measurements.objects[measurement_idx], measurement_label, tracked_object, tracker_label);
+      if (score > 0.0) {
+        row.emplace_back(measurement_idx, score);
+      }
+    }
+  }
+
+  SparseScoreMatrix score_matrix;
+  score_matrix.rows = num_trackers;
+  score_matrix.cols = num_measurements;
+  score_matrix.row_offsets.reserve(num_trackers + 1);
+  score_matrix.row_offsets.push_back(0);
+  for (const auto & row : rows) {
+    for (const auto & [measurement_idx, score] : row) {
+      score_matrix.col_indices.push_back(measurement_idx);
+      score_matrix.values.push_back(score);
+    }
+    score_matrix.row_offsets.push_back(static_cast<int>(score_matrix.col_indices.size()));
+  }
+  return score_matrix;
+}
+
+void DataAssociation::assignSparse(
+  const SparseScoreMatrix & src, std::unordered_map<int, int> & direct_assignment,
+  std::unordered_map<int, int> & reverse_assignment)
+{
+  gnn_solver_ptr_->maximizeSparseLinearAssignment(
+    src, score_threshold_, num_threads_, &direct_assignment, &reverse_assignment);
+}
@@ -81,6 +81,9 @@ MultiObjectTracker::MultiObjectTracker(const rclcpp::NodeOptions & node_options)
   double publish_rate = declare_parameter<double>("publish_rate", 30.0);
   world_frame_id_ = declare_parameter<std::string>("world_frame_id", "world");
   bool enable_delay_compensation{declare_parameter("enable_delay_compensation", false)};
+  use_sparse_association_ = declare_parameter("use_sparse_association", false);
+  use_batch_prediction_ = declare_parameter("use_batch_prediction", false);
+  const int num_threads = declare_parameter("num_threads", 1);
 
   auto cti = std::make_shared<tf2_ros::CreateTimerROS>(
     this->get_node_base_interface(), this->get_node_timers_interface());
@@ -120,7 +123,7 @@ MultiObjectTracker::MultiObjectTracker(const rclcpp::NodeOptions & node_options)
 
   data_association_ = std::make_unique<DataAssociation>(
     can_assign_matrix, max_dist_matrix, max_area_matrix, min_area_matrix, max_rad_matrix,
-    min_iou_matrix);
+    min_iou_matrix, num_threads);
 }
 
 void MultiObjectTracker::onMeasurement(
@@ -141,14 +144,23 @@ void MultiObjectTracker::onMeasurement(
   /* tracker prediction */
   rclcpp::Time measurement_time = input_objects_msg->header.stamp;
   for (auto itr = list_tracker_.begin(); itr != list_tracker_.end(); ++itr) {
-    (*itr)->predict(measurement_time);
+    if (!use_batch_prediction_ || !(*itr)->addToBatchPredictor(batch_predictor_)) {
+      (*itr)->predict(measurement_time);
+    }
   }
+  batch_predictor_.predict(measurement_time);
 
   /* global nearest neighbor */
   std::unordered_map<int, int> direct_assignment, reverse_assignment;
-  Eigen::MatrixXd score_matrix = data_association_->calcScoreMatrix(
-    transformed_objects, list_tracker_);  // row : tracker, col : measurement
-  data_association_->assign(score_matrix, direct_assignment, reverse_assignment);
+  if (use_sparse_association_) {
+    const auto score_matrix = data_association_->calcSparseScoreMatrix(
+      transformed_objects, list_tracker_);  // row : tracker, col : measurement
+    data_association_->assignSparse(score_matrix, direct_assignment, reverse_assignment);
+  } else {
+    Eigen::MatrixXd score_matrix = data_association_->calcScoreMatrix(
+      transformed_objects, list_tracker_);  // row : tracker, col : measurement
+    data_association_->assign(score_matrix, direct_assignment, reverse_assignment);
+  }
 
   /* tracker measurement update */
   int tracker_idx = 0;
@@ -0,0 +1,247 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "multi_object_tracker/tracker/model/batch_predictor.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+// The state indices shared by the models, the last one is the slip angle or the turn rate
+enum IDX { X = 0, Y = 1, YAW = 2, VX = 3, SLIP = 4, WZ = 4 };
+constexpr int DIM = 5;
+
+constexpr int at(const int row, const int col)
+{
+  return row * DIM + col;
+}
+}  // namespace
+
+void BatchPredictor::Batch::add(
+  KalmanFilter & ekf, rclcpp::Time & last_update_time, const double * track_params)
+{
+  ekfs.push_back(&ekf);
+  last_update_times.push_back(&last_update_time);
+  for (int p = 0; p < NUM_PARAMS; ++p) {
+    params[p].push_back(track_params[p]);
+  }
+}
+
+void BatchPredictor::Batch::clear()
+{
+  ekfs.clear();
+  last_update_times.clear();
+  for (auto & param : params) {
+    param.clear();
+  }
+}
+
+void BatchPredictor::addBicycleModel(
+  KalmanFilter & ekf, rclcpp::Time & last_update_time, const BicycleModelParams & params)
+{
+  const double track_params[NUM_PARAMS] = {params.lr,       params.q_cov_x,  params.q_cov_y,
+                                           params.q_cov_yaw, params.q_cov_vx, params.q_cov_slip};
+  bicycle_.add(ekf, last_update_time, track_params);
+}
+
+void BatchPredictor::addCtrvModel(
+  KalmanFilter & ekf, rclcpp::Time & last_update_time, const CtrvModelParams & params)
+{
+  const double track_params[NUM_PARAMS] = {0.0,              params.q_cov_x,  params.q_cov_y,
+                                           params.q_cov_yaw, params.q_cov_vx, params.q_cov_wz};
+  ctrv_.add(ekf, last_update_time, track_params);
+}
+
+void BatchPredictor::predict(const rclcpp::Time & time)
+{
+  if (!bicycle_.ekfs.empty()) {
+    gather(bicycle_, time);
+    predictBicycleModel(bicycle_);
+    propagateCovariance(bicycle_);
+    scatter(bicycle_, time);
+  }
+  if (!ctrv_.ekfs.empty()) {
+    gather(ctrv_, time);
+    predictCtrvModel(ctrv_);
+    propagateCovariance(ctrv_);
+    scatter(ctrv_, time);
+  }
+  bicycle_.clear();
+  ctrv_.clear();
+}
+
+void BatchPredictor::gather(Batch & batch, const rclcpp::Time & time)
+{
+  const std::size_t num_tracks = batch.ekfs.size();
+  batch.dt.resize(num_tracks);
+  for (auto & x : batch.x) x.resize(num_tracks);
+  for (auto * matrices : {&batch.P, &batch.A, &batch.Q, &batch.AP}) {
+    for (auto & element : *matrices) element.resize(num_tracks);
+  }
+
+  for (std::size_t k = 0; k < num_tracks; ++k) {
+    batch.dt[k] = (time - *batch.last_update_times[k]).seconds();
+    // The buffers keep their size, so that the copies do not allocate
+    batch.ekfs[k]->getX(x_buffer_);
+    batch.ekfs[k]->getP(P_buffer_);
+    for (int i = 0; i < DIM; ++i) {
+      batch.x[i][k] = x_buffer_(i);
+      for (int j = 0; j < DIM; ++j) {
+        batch.P[at(i, j)][k] = P_buffer_(i, j);
+      }
+    }
+  }
+}
+
+void BatchPredictor::scatter(Batch & batch, const rclcpp::Time & time)
+{
+  for (std::size_t k = 0; k < batch.ekfs.size(); ++k) {
+    for (int i = 0; i < DIM; ++i) {
+      x_buffer_(i) = batch.x[i][k];
+      for (int j = 0; j < DIM; ++j) {
+        P_buffer_(i, j) = batch.P[at(i, j)][k];
+      }
+    }
+    batch.ekfs[k]->init(x_buffer_, P_buffer_);
+    *batch.last_update_times[k] = time;
+  }
+}
+
+// Same model as NormalVehicleTracker::predict(const double, KalmanFilter &)
+void BatchPredictor::predictBicycleModel(Batch & batch)
+{
+  const std::size_t num_tracks = batch.dt.size();
+  const double * lr = batch.params[0].data();
+  const double * q_cov_x = batch.params[1].data();
+  const double * q_cov_y = batch.params[2].data();
+  const double * q_cov_yaw = batch.params[3].data();
+  const double * q_cov_vx = batch.params[4].data();
+  const double * q_cov_slip = batch.params[5].data();
+  for (auto & element : batch.A) std::fill(element.begin(), element.end(), 0.0);
+  for (auto & element : batch.Q) std::fill(element.begin(), element.end(), 0.0);
+
+  for (std::size_t k = 0; k < num_tracks; ++k) {
+    const double dt = batch.dt[k];
+    const double yaw = batch.x[IDX::YAW][k];
+    const double slip = batch.x[IDX::SLIP][k];
+    const double vx = batch.x[IDX::VX][k];
+    const double cos_yaw = std::cos(yaw + slip);
+    const double sin_yaw = std::sin(yaw + slip);
+    const double cos_slip = std::cos(slip);
+    const double sin_slip = std::sin(slip);
+    const double sin_2yaw = std::sin(2.0f * yaw);
+
+    for (int i = 0; i < DIM; ++i) batch.A[at(i, i)][k] = 1.0;
+    batch.A[at(IDX::X, IDX::YAW)][k] = -vx * sin_yaw * dt;
+    batch.A[at(IDX::X, IDX::VX)][k] = cos_yaw * dt;
+    batch.A[at(IDX::X, IDX::SLIP)][k] = -vx * sin_yaw * dt;
+    batch.A[at(IDX::Y, IDX::YAW)][k] = vx * cos_yaw * dt;
+    batch.A[at(IDX::Y, IDX::VX)][k] = sin_yaw * dt;
+    batch.A[at(IDX::Y, IDX::SLIP)][k] = vx * cos_yaw * dt;
+    batch.A[at(IDX::YAW, IDX::VX)][k] = 1.0 / lr[k] * sin_slip * dt;
+    batch.A[at(IDX::YAW, IDX::SLIP)][k] = vx / lr[k] * cos_slip * dt;
+
+    // the process noise is rotated by the vehicle yaw, as in the trackers
+    batch.Q[at(IDX::X, IDX::X)][k] =
+      (q_cov_x[k] * cos_yaw * cos_yaw + q_cov_y[k] * sin_yaw * sin_yaw) * dt * dt;
+    batch.Q[at(IDX::X, IDX::Y)][k] = (0.5f * (q_cov_x[k] - q_cov_y[k]) * sin_2yaw) * dt * dt;
+    batch.Q[at(IDX::Y, IDX::Y)][k] =
+      (q_cov_x[k] * sin_yaw * sin_yaw + q_cov_y[k] * cos_yaw * cos_yaw) * dt * dt;
+    batch.Q[at(IDX::Y, IDX::X)][k] = batch.Q[at(IDX::X, IDX::Y)][k];
+    batch.Q[at(IDX::YAW, IDX::YAW)][k] = q_cov_yaw[k] * dt * dt;
+    batch.Q[at(IDX::VX, IDX::VX)][k] = q_cov_vx[k] * dt * dt;
+    batch.Q[at(IDX::SLIP, IDX::SLIP)][k] = q_cov_slip[k] * dt * dt;
+
+    batch.x[IDX::X][k] += vx * cos_yaw * dt;
+    batch.x[IDX::Y][k] += vx * sin_yaw * dt;
+    batch.x[IDX::YAW][k] += vx / lr[k] * sin_slip * dt;
+  }
+}
+
+// Same model as PedestrianTracker::predict(const double, KalmanFilter &)
+void BatchPredictor::predictCtrvModel(Batch & batch)
+{
+  const std::size_t num_tracks = batch.dt.size();
+  const double * q_cov_x = batch.params[1].data();
+  const double * q_cov_y = batch.params[2].data();
+  const double * q_cov_yaw = batch.params[3].data();
+  const double * q_cov_vx = batch.params[4].data();
+  const double * q_cov_wz = batch.params[5].data();
+  for (auto & element : batch.A) std::fill(element.begin(), element.end(), 0.0);
+  for (auto & element : batch.Q) std::fill(element.begin(), element.end(), 0.0);
+
+  for (std::size_t k = 0; k < num_tracks; ++k) {
+    const double dt = batch.dt[k];
+    const double yaw = batch.x[IDX::YAW][k];
+    const double vx = batch.x[IDX::VX][k];
+    const double wz = batch.x[IDX::WZ][k];
+    const double cos_yaw = std::cos(yaw);
+    const double sin_yaw = std::sin(yaw);
+    const double sin_2yaw = std::sin(2.0f * yaw);
+
+    for (int i = 0; i < DIM; ++i) batch.A[at(i, i)][k] = 1.0;
+    batch.A[at(IDX::X, IDX::YAW)][k] = -vx * sin_yaw * dt;
+    batch.A[at(IDX::X, IDX::VX)][k] = cos_yaw * dt;
+    batch.A[at(IDX::Y, IDX::YAW)][k] = vx * cos_yaw * dt;
+    batch.A[at(IDX::Y, IDX::VX)][k] = sin_yaw * dt;
+    batch.A[at(IDX::YAW, IDX::WZ)][k] = dt;
+
+    batch.Q[at(IDX::X, IDX::X)][k] =
+      (q_cov_x[k] * cos_yaw * cos_yaw + q_cov_y[k] * sin_yaw * sin_yaw) * dt * dt;
+    batch.Q[at(IDX::X, IDX::Y)][k] = (0.5f * (q_cov_x[k] - q_cov_y[k]) * sin_2yaw) * dt * dt;
+    batch.Q[at(IDX::Y, IDX::Y)][k] =
+      (q_cov_x[k] * sin_yaw * sin_yaw + q_cov_y[k] * cos_yaw * cos_yaw) * dt * dt;
+    batch.Q[at(IDX::Y, IDX::X)][k] = batch.Q[at(IDX::X, IDX::Y)][k];
+    batch.Q[at(IDX::YAW, IDX::YAW)][k] = q_cov_yaw[k] * dt * dt;
+    batch.Q[at(IDX::VX, IDX::VX)][k] = q_cov_vx[k] * dt * dt;
+    batch.Q[at(IDX::WZ, IDX::WZ)][k] = q_cov_wz[k] * dt * dt;
+
+    batch.x[IDX::X][k] += vx * cos_yaw * dt;
+    batch.x[IDX::Y][k] += vx * sin_yaw * dt;
+    batch.x[IDX::YAW][k] += wz * dt;
+  }
+}
+
+// P = A * P * A^T + Q, element-wise over the tracks
+void BatchPredictor::propagateCovariance(Batch & batch)
+{
+  const std::size_t num_tracks = batch.dt.size();
+  for (int i = 0; i < DIM; ++i) {
+    for (int j = 0; j < DIM; ++j) {
+      double * ap = batch.AP[at(i, j)].data();
+      std::fill(ap, ap + num_tracks, 0.0);
+      for (int l = 0; l < DIM; ++l) {
+        const double * a = batch.A[at(i, l)].data();
+        const double * p = batch.P[at(l, j)].data();
+        for (std::size_t k = 0; k < num_tracks; ++k) {
+          ap[k] += a[k] * p[k];
+        }
+      }
+    }
+  }
+  for (int i = 0; i < DIM; ++i) {
+    for (int j = 0; j < DIM; ++j) {
+      double * p = batch.P[at(i, j)].data();
+      std::copy(batch.Q[at(i, j)].begin(), batch.Q[at(i, j)].end(), p);
+      for (int l = 0; l < DIM; ++l) {
+        const double * ap = batch.AP[at(i, l)].data();
+        const double * a = batch.A[at(j, l)].data();
+        for (std::size_t k = 0; k < num_tracks; ++k) {
+          p[k] += ap[k] * a[k];
+        }
+      }
+    }
+  }
+}
@@ -18,6 +18,7 @@
 
 #include "multi_object_tracker/tracker/model/bicycle_tracker.hpp"
 
+#include "multi_object_tracker/tracker/model/batch_predictor.hpp"
 #include "multi_object_tracker/utils/utils.hpp"
 
 #include <tier4_autoware_utils/geometry/boost_polygon_utils.hpp>
@@ -152,6 +153,15 @@ bool BicycleTracker::predict(const rclcpp::Time & time)
   return ret;
 }
 
+bool BicycleTracker::addToBatchPredictor(BatchPredictor & predictor)
+{
+  predictor.addBicycleModel(
+    ekf_, last_update_time_,
+    {lr_, ekf_params_.q_cov_x, ekf_params_.q_cov_y, ekf_params_.q_cov_yaw, ekf_params_.q_cov_vx,
+     ekf_params_.q_cov_slip});
+  return true;
+}
+
 bool BicycleTracker::predict(const double dt, KalmanFilter & ekf) const
 {
   /*  == Nonlinear model == static bicycle model
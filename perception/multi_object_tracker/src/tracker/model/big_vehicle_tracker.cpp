@@ -28,6 +28,7 @@
 #endif
 
 #define EIGEN_MPL2_ONLY
+#include "multi_object_tracker/tracker/model/batch_predictor.hpp"
 #include "multi_object_tracker/tracker/model/big_vehicle_tracker.hpp"
 #include "multi_object_tracker/utils/utils.hpp"
 #include "object_recognition_utils/object_recognition_utils.hpp"
@@ -167,6 +168,15 @@ bool BigVehicleTracker::predict(const rclcpp::Time & time)
   return ret;
 }
 
+bool BigVehicleTracker::addToBatchPredictor(BatchPredictor & predictor)
+{
+  predictor.addBicycleModel(
+    ekf_, last_update_time_,
+    {lr_, ekf_params_.q_cov_x, ekf_params_.q_cov_y, ekf_params_.q_cov_yaw, ekf_params_.q_cov_vx,
+     ekf_params_.q_cov_slip});
+  return true;
+}
+
 bool BigVehicleTracker::predict(const double dt, KalmanFilter & ekf) const
 {
   /*  == Nonlinear model == static bicycle model
@@ -18,6 +18,8 @@
 
 #include "multi_object_tracker/tracker/model/multiple_vehicle_tracker.hpp"
 
+#include "multi_object_tracker/tracker/model/batch_predictor.hpp"
+
 using Label = autoware_auto_perception_msgs::msg::ObjectClassification;
 
 MultipleVehicleTracker::MultipleVehicleTracker(
@@ -36,6 +38,13 @@ bool MultipleVehicleTracker::predict(const rclcpp::Time & time)
   return true;
 }
 
+bool MultipleVehicleTracker::addToBatchPredictor(BatchPredictor & predictor)
+{
+  big_vehicle_tracker_.addToBatchPredictor(predictor);
+  normal_vehicle_tracker_.addToBatchPredictor(predictor);
+  return true;
+}
+
 bool MultipleVehicleTracker::measure(
   const autoware_auto_perception_msgs::msg::DetectedObject & object, const rclcpp::Time & time,
   const geometry_msgs::msg::Transform & self_transform)
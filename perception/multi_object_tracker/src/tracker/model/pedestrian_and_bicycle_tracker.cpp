@@ -18,6 +18,8 @@
 
 #include "multi_object_tracker/tracker/model/pedestrian_and_bicycle_tracker.hpp"
 
+#include "multi_object_tracker/tracker/model/batch_predictor.hpp"
+
 using Label = autoware_auto_perception_msgs::msg::ObjectClassification;
 
 PedestrianAndBicycleTracker::PedestrianAndBicycleTracker(
@@ -36,6 +38,13 @@ bool PedestrianAndBicycleTracker::predict(const rclcpp::Time & time)
   return true;
 }
 
+bool PedestrianAndBicycleTracker::addToBatchPredictor(BatchPredictor & predictor)
+{
+  pedestrian_tracker_.addToBatchPredictor(predictor);
+  bicycle_tracker_.addToBatchPredictor(predictor);
+  return true;
+}
+
 bool PedestrianAndBicycleTracker::measure(
   const autoware_auto_perception_msgs::msg::DetectedObject & object, const rclcpp::Time & time,
   const geometry_msgs::msg::Transform & self_transform)
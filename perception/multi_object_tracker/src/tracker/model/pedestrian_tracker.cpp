@@ -18,6 +18,7 @@
 
 #include "multi_object_tracker/tracker/model/pedestrian_tracker.hpp"
 
+#include "multi_object_tracker/tracker/model/batch_predictor.hpp"
 #include "multi_object_tracker/utils/utils.hpp"
 #include "object_recognition_utils/object_recognition_utils.hpp"
 
@@ -152,6 +153,15 @@ bool PedestrianTracker::predict(const rclcpp::Time & time)
   return ret;
 }
 
+bool PedestrianTracker::addToBatchPredictor(BatchPredictor & predictor)
+{
+  predictor.addCtrvModel(
+    ekf_, last_update_time_,
+    {ekf_params_.q_cov_x, ekf_params_.q_cov_y, ekf_params_.q_cov_yaw, ekf_params_.q_cov_vx,
+     ekf_params_.q_cov_wz});
+  return true;
+}
+
 bool PedestrianTracker::predict(const double dt, KalmanFilter & ekf) const
 {
   /*  == Nonlinear model ==
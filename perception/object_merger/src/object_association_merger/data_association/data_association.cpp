@@ -14,7 +14,8 @@
 
 #include "object_association_merger/data_association/data_association.hpp"
 
-#include "object_association_merger/data_association/solver/gnn_solver.hpp"
+#include "gnn_solver/gnn_solver.hpp"
+#include "gnn_solver/spatial_grid.hpp"
 #include "object_association_merger/utils/utils.hpp"
 #include "object_recognition_utils/object_recognition_utils.hpp"
 #include "tier4_autoware_utils/geometry/geometry.hpp"
@@ -118,13 +119,28 @@ Eigen::MatrixXd DataAssociation::calcScoreMatrix(
 {
   Eigen::MatrixXd score_matrix =
     Eigen::MatrixXd::Zero(objects1.objects.size(), objects0.objects.size());
+
+  // Grid pre-gate: a pair farther than the largest max distance never passes the dist gate, and
+  // its score stays zero
+  std::vector<double> objects0_xs(objects0.objects.size()), objects0_ys(objects0.objects.size());
+  for (size_t objects0_idx = 0; objects0_idx < objects0.objects.size(); ++objects0_idx) {
+    const auto & position =
+      objects0.objects.at(objects0_idx).kinematics.pose_with_covariance.pose.position;
+    objects0_xs.at(objects0_idx) = position.x;
+    objects0_ys.at(objects0_idx) = position.y;
+  }
+  const gnn_solver::SpatialGrid grid(max_dist_matrix_.maxCoeff(), objects0_xs, objects0_ys);
+  std::vector<int> objects0_indices;
+
   for (size_t objects1_idx = 0; objects1_idx < objects1.objects.size(); ++objects1_idx) {
     const autoware_auto_perception_msgs::msg::DetectedObject & object1 =
       objects1.objects.at(objects1_idx);
     const std::uint8_t object1_label =
       object_recognition_utils::getHighestProbLabel(object1.classification);
 
-    for (size_t objects0_idx = 0; objects0_idx < objects0.objects.size(); ++objects0_idx) {
+    const auto & position1 = object1.kinematics.pose_with_covariance.pose.position;
+    grid.findNeighbors(position1.x, position1.y, objects0_indices);
+    for (const int objects0_idx : objects0_indices) {
       const autoware_auto_perception_msgs::msg::DetectedObject & object0 =
         objects0.objects.at(objects0_idx);
       const std::uint8_t object0_label =
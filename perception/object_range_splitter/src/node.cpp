@@ -14,6 +14,9 @@
 
 #include "object_range_splitter/node.hpp"
 
+#include <memory>
+#include <utility>
+
 namespace object_range_splitter
 {
 ObjectRangeSplitterNode::ObjectRangeSplitterNode(const rclcpp::NodeOptions & node_options)
@@ -32,7 +35,7 @@ ObjectRangeSplitterNode::ObjectRangeSplitterNode(const rclcpp::NodeOptions & nod
 }
 
 void ObjectRangeSplitterNode::objectCallback(
-  const autoware_auto_perception_msgs::msg::DetectedObjects::ConstSharedPtr input_msg)
+  autoware_auto_perception_msgs::msg::DetectedObjects::UniquePtr input_msg)
 {
   // Guard
   if (
@@ -41,25 +44,28 @@ void ObjectRangeSplitterNode::objectCallback(
     return;
   }
   // build output msg
-  autoware_auto_perception_msgs::msg::DetectedObjects output_long_range_object_msg,
-    output_short_range_object_msg;
-  output_long_range_object_msg.header = input_msg->header;
-  output_short_range_object_msg.header = input_msg->header;
+  auto output_long_range_object_msg =
+    std::make_unique<autoware_auto_perception_msgs::msg::DetectedObjects>();
+  auto output_short_range_object_msg =
+    std::make_unique<autoware_auto_perception_msgs::msg::DetectedObjects>();
+  output_long_range_object_msg->header = input_msg->header;
+  output_short_range_object_msg->header = input_msg->header;
 
   // split
-  for (const auto & object : input_msg->objects) {
+  // The input is owned by this callback, so the objects are moved instead of copied.
+  for (auto & object : input_msg->objects) {
     const auto & position = object.kinematics.pose_with_covariance.pose.position;
     const auto object_sq_dist = position.x * position.x + position.y * position.y;
     if (object_sq_dist < spilt_range_ * spilt_range_) {  // short range
-      output_short_range_object_msg.objects.push_back(object);
+      output_short_range_object_msg->objects.push_back(std::move(object));
     } else {  // long range
-      output_long_range_object_msg.objects.push_back(object);
+      output_long_range_object_msg->objects.push_back(std::move(object));
     }
   }
 
   // publish output msg
-  long_range_object_pub_->publish(output_long_range_object_msg);
-  short_range_object_pub_->publish(output_short_range_object_msg);
+  long_range_object_pub_->publish(std::move(output_long_range_object_msg));
+  short_range_object_pub_->publish(std::move(output_short_range_object_msg));
 }
 }  // namespace object_range_splitter
 
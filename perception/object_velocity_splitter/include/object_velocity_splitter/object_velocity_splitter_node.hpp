@@ -44,7 +44,7 @@ private:
   rclcpp::Subscription<DetectedObjects>::SharedPtr sub_objects_{};
 
   // Callback
-  void onObjects(const DetectedObjects::ConstSharedPtr msg);
+  void onObjects(DetectedObjects::UniquePtr msg);
 
   // Data Buffer
   DetectedObjects::ConstSharedPtr objects_data_{};
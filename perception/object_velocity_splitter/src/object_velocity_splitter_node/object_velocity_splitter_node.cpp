@@ -18,6 +18,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace
@@ -65,25 +66,26 @@ ObjectVelocitySplitterNode::ObjectVelocitySplitterNode(const rclcpp::NodeOptions
   pub_low_speed_objects_ = create_publisher<DetectedObjects>("~/output/low_speed_objects", 1);
 }
 
-void ObjectVelocitySplitterNode::onObjects(const DetectedObjects::ConstSharedPtr objects_data_)
+void ObjectVelocitySplitterNode::onObjects(DetectedObjects::UniquePtr objects_data_)
 {
-  DetectedObjects high_speed_objects;
-  DetectedObjects low_speed_objects;
-  high_speed_objects.header = objects_data_->header;
-  low_speed_objects.header = objects_data_->header;
+  auto high_speed_objects = std::make_unique<DetectedObjects>();
+  auto low_speed_objects = std::make_unique<DetectedObjects>();
+  high_speed_objects->header = objects_data_->header;
+  low_speed_objects->header = objects_data_->header;
 
-  for (const auto & object : objects_data_->objects) {
+  // The input is owned by this callback, so the objects are moved instead of copied.
+  for (auto & object : objects_data_->objects) {
     if (
       std::abs(tier4_autoware_utils::calcNorm(
         object.kinematics.twist_with_covariance.twist.linear)) < node_param_.velocity_threshold) {
-      low_speed_objects.objects.emplace_back(object);
+      low_speed_objects->objects.emplace_back(std::move(object));
     } else {
-      high_speed_objects.objects.emplace_back(object);
+      high_speed_objects->objects.emplace_back(std::move(object));
     }
   }
   // publish
-  pub_high_speed_objects_->publish(high_speed_objects);
-  pub_low_speed_objects_->publish(low_speed_objects);
+  pub_high_speed_objects_->publish(std::move(high_speed_objects));
+  pub_low_speed_objects_->publish(std::move(low_speed_objects));
 }
 
 rcl_interfaces::msg::SetParametersResult ObjectVelocitySplitterNode::onSetParam(
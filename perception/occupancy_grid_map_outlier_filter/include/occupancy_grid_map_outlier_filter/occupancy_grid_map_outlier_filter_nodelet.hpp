@@ -36,8 +36,12 @@
 #include <tf2_ros/message_filter.h>
 #include <tf2_ros/transform_listener.h>
 
+#include <cstdint>
+#include <initializer_list>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 namespace occupancy_grid_map_outlier_filter
 {
@@ -65,6 +69,21 @@ private:
   int max_points_;
   long unsigned int max_filter_points_nb_;
   pcl::search::Search<pcl::PointXY>::Ptr kd_tree_;
+
+  /**
+   * Grid of search_radius_ cells instead of the KdTree: the neighbors of a point closer than the
+   * radius are in the 3x3 cells around it. The points are kept sorted by cell in buffers reused
+   * from frame to frame, and the 3 cells of a column around a point are a single range of keys.
+   */
+  void buildGridIndex(std::initializer_list<const PclPointCloud *> clouds);
+  int countGridNeighbors(const pcl::PointXY & point, int max_nn) const;
+  int minPointsThreshold(const pcl::PointXY & point, const Pose & pose) const;
+  bool use_grid_index_;
+  float inverse_cell_size_;
+  std::vector<pcl::PointXY> points_;
+  std::vector<std::pair<std::uint64_t, std::uint32_t>> sorted_cells_;
+  std::vector<std::uint64_t> grid_keys_;
+  std::vector<pcl::PointXY> grid_points_;
 };
 
 class OccupancyGridMapOutlierFilterComponent : public rclcpp::Node
@@ -79,6 +98,9 @@ private:
   void filterByOccupancyGridMap(
     const OccupancyGrid & occupancy_grid_map, const PointCloud2 & pointcloud,
     PclPointCloud & high_confidence, PclPointCloud & low_confidence, PclPointCloud & out_ogm);
+  void filterByOccupancyGridMapBatched(
+    const OccupancyGrid & occupancy_grid_map, const PointCloud2 & pointcloud,
+    PclPointCloud & high_confidence, PclPointCloud & low_confidence, PclPointCloud & out_ogm);
   void splitPointCloudFrontBack(
     const PointCloud2::ConstSharedPtr & input_pc, PointCloud2 & front_pc, PointCloud2 & behind_pc);
 
@@ -121,10 +143,22 @@ private:
   std::unique_ptr<tier4_autoware_utils::StopWatch<std::chrono::milliseconds>> stop_watch_ptr_;
   std::unique_ptr<tier4_autoware_utils::DebugPublisher> debug_publisher_;
 
+  // Buffers of the intermediate clouds, reused from frame to frame
+  PclPointCloud high_confidence_pc_;
+  PclPointCloud low_confidence_pc_;
+  PclPointCloud out_ogm_pc_;
+  PclPointCloud ogm_frame_behind_pc_;
+  PclPointCloud filtered_low_confidence_pc_;
+  PclPointCloud outlier_pc_;
+  PclPointCloud concat_pc_;
+  PclPointCloud projected_pc_;
+  std::vector<std::int16_t> projected_costs_;
+
   // ROS Parameters
   std::string map_frame_;
   std::string base_link_frame_;
   int cost_threshold_;
+  bool use_batched_projection_;
 };
 }  // namespace occupancy_grid_map_outlier_filter
 
@@ -31,6 +31,9 @@
 #endif
 
 #include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
 #include <memory>
 #include <string>
 #include <utility>
@@ -99,6 +102,17 @@ boost::optional<char> getCost(
   return boost::none;
 }
 
+// Grid cells of the points of the radius search, ordered by x then y
+std::uint64_t gridKey(const int cell_x, const int cell_y)
+{
+  constexpr std::uint32_t sign_bit = 0x80000000U;
+  return (static_cast<std::uint64_t>(static_cast<std::uint32_t>(cell_x) ^ sign_bit) << 32) |
+         (static_cast<std::uint32_t>(cell_y) ^ sign_bit);
+}
+
+// Cost of the cells of the points out of the map, below all the costs of OccupancyGrid
+constexpr std::int16_t OUT_OF_MAP_COST = std::numeric_limits<std::int16_t>::min();
+
 }  // namespace
 
 namespace occupancy_grid_map_outlier_filter
@@ -112,12 +126,85 @@ RadiusSearch2dFilter::RadiusSearch2dFilter(rclcpp::Node & node)
   max_points_ = node.declare_parameter("radius_search_2d_filter.max_points", 70);
   max_filter_points_nb_ =
     node.declare_parameter("radius_search_2d_filter.max_filter_points_nb", 15000);
+  use_grid_index_ = node.declare_parameter("radius_search_2d_filter.use_grid_index", false);
   kd_tree_ = pcl::make_shared<pcl::search::KdTree<pcl::PointXY>>(false);
+  // slightly larger than the radius, so that rounding never puts a neighbor two cells away
+  inverse_cell_size_ = 1.0f / (search_radius_ * (1.0f + 1e-4f));
+}
+
+int RadiusSearch2dFilter::minPointsThreshold(const pcl::PointXY & point, const Pose & pose) const
+{
+  const float distance = std::hypot(point.x - pose.position.x, point.y - pose.position.y);
+  return std::min(
+    std::max(static_cast<int>(min_points_and_distance_ratio_ / distance + 0.5f), min_points_),
+    max_points_);
+}
+
+void RadiusSearch2dFilter::buildGridIndex(std::initializer_list<const PclPointCloud *> clouds)
+{
+  points_.clear();
+  for (const auto * cloud : clouds) {
+    for (const auto & point : cloud->points) {
+      pcl::PointXY xy;
+      xy.x = point.x;
+      xy.y = point.y;
+      points_.push_back(xy);
+    }
+  }
+
+  sorted_cells_.resize(points_.size());
+  for (std::size_t i = 0; i < points_.size(); ++i) {
+    const int cell_x = static_cast<int>(std::floor(points_[i].x * inverse_cell_size_));
+    const int cell_y = static_cast<int>(std::floor(points_[i].y * inverse_cell_size_));
+    sorted_cells_[i] = {gridKey(cell_x, cell_y), static_cast<std::uint32_t>(i)};
+  }
+  std::sort(sorted_cells_.begin(), sorted_cells_.end());
+  grid_keys_.resize(sorted_cells_.size());
+  grid_points_.resize(sorted_cells_.size());
+  for (std::size_t i = 0; i < sorted_cells_.size(); ++i) {
+    grid_keys_[i] = sorted_cells_[i].first;
+    grid_points_[i] = points_[sorted_cells_[i].second];
+  }
+}
+
+int RadiusSearch2dFilter::countGridNeighbors(const pcl::PointXY & point, const int max_nn) const
+{
+  // same count as KdTree::radiusSearch(): the point itself included, strictly within the radius
+  const float squared_radius = search_radius_ * search_radius_;
+  const int cell_x = static_cast<int>(std::floor(point.x * inverse_cell_size_));
+  const int cell_y = static_cast<int>(std::floor(point.y * inverse_cell_size_));
+  int num_neighbors = 0;
+  for (int x = cell_x - 1; x <= cell_x + 1; ++x) {
+    const auto begin =
+      std::lower_bound(grid_keys_.begin(), grid_keys_.end(), gridKey(x, cell_y - 1));
+    const auto end = std::upper_bound(begin, grid_keys_.end(), gridKey(x, cell_y + 1));
+    for (auto i = begin - grid_keys_.begin(); i < end - grid_keys_.begin(); ++i) {
+      const float dx = grid_points_[i].x - point.x;
+      const float dy = grid_points_[i].y - point.y;
+      if (dx * dx + dy * dy < squared_radius && ++num_neighbors >= max_nn) {
+        return num_neighbors;
+      }
+    }
+  }
+  return num_neighbors;
 }
 
 void RadiusSearch2dFilter::filter(
   const PclPointCloud & input, const Pose & pose, PclPointCloud & output, PclPointCloud & outlier)
 {
+  if (use_grid_index_) {
+    buildGridIndex({&input});
+    for (size_t i = 0; i < input.points.size(); ++i) {
+      const int min_points_threshold = minPointsThreshold(points_[i], pose);
+      if (min_points_threshold <= countGridNeighbors(points_[i], min_points_threshold)) {
+        output.points.push_back(input.points[i]);
+      } else {
+        outlier.points.push_back(input.points[i]);
+      }
+    }
+    return;
+  }
+
   const auto & xyz_cloud = input;
   pcl::PointCloud<pcl::PointXY>::Ptr xy_cloud(new pcl::PointCloud<pcl::PointXY>);
   xy_cloud->points.resize(xyz_cloud.points.size());
@@ -160,6 +247,19 @@ void RadiusSearch2dFilter::filter(
     return;
   }
 
+  if (use_grid_index_) {
+    buildGridIndex({&low_conf_xyz_cloud, &high_conf_xyz_cloud});
+    for (size_t i = 0; i < low_conf_xyz_cloud.points.size(); ++i) {
+      const int min_points_threshold = minPointsThreshold(points_[i], pose);
+      if (min_points_threshold <= countGridNeighbors(points_[i], min_points_threshold)) {
+        output.points.push_back(low_conf_xyz_cloud.points[i]);
+      } else {
+        outlier.points.push_back(low_conf_xyz_cloud.points[i]);
+      }
+    }
+    return;
+  }
+
   pcl::PointCloud<pcl::PointXY>::Ptr xy_cloud(new pcl::PointCloud<pcl::PointXY>);
   xy_cloud->points.resize(low_conf_xyz_cloud.points.size() + high_conf_xyz_cloud.points.size());
   for (size_t i = 0; i < low_conf_xyz_cloud.points.size(); ++i) {
@@ -209,6 +309,7 @@ OccupancyGridMapOutlierFilterComponent::OccupancyGridMapOutlierFilterComponent(
   map_frame_ = declare_parameter("map_frame", "map");
   base_link_frame_ = declare_parameter("base_link_frame", "base_link");
   cost_threshold_ = declare_parameter("cost_threshold", 45);
+  use_batched_projection_ = declare_parameter("use_batched_projection", false);
   auto use_radius_search_2d_filter = declare_parameter("use_radius_search_2d_filter", true);
   auto enable_debugger = declare_parameter("enable_debugger", false);
 
@@ -272,16 +373,26 @@ void OccupancyGridMapOutlierFilterComponent::onOccupancyGridMapAndPointCloud2(
     return;
   }
   // Occupancy grid map based filter
-  PclPointCloud high_confidence_pc{};
-  PclPointCloud low_confidence_pc{};
-  PclPointCloud out_ogm_pc{};
-  PclPointCloud ogm_frame_behind_pc;
+  auto & high_confidence_pc = high_confidence_pc_;
+  auto & low_confidence_pc = low_confidence_pc_;
+  auto & out_ogm_pc = out_ogm_pc_;
+  auto & ogm_frame_behind_pc = ogm_frame_behind_pc_;
+  high_confidence_pc.clear();
+  low_confidence_pc.clear();
+  out_ogm_pc.clear();
   pcl::fromROSMsg(ogm_frame_input_behind_pc, ogm_frame_behind_pc);
-  filterByOccupancyGridMap(
-    *input_ogm, ogm_frame_pc, high_confidence_pc, low_confidence_pc, out_ogm_pc);
+  if (use_batched_projection_) {
+    filterByOccupancyGridMapBatched(
+      *input_ogm, ogm_frame_pc, high_confidence_pc, low_confidence_pc, out_ogm_pc);
+  } else {
+    filterByOccupancyGridMap(
+      *input_ogm, ogm_frame_pc, high_confidence_pc, low_confidence_pc, out_ogm_pc);
+  }
   // Apply Radius search 2d filter for low confidence pointcloud
-  PclPointCloud filtered_low_confidence_pc{};
-  PclPointCloud outlier_pc{};
+  auto & filtered_low_confidence_pc = filtered_low_confidence_pc_;
+  auto & outlier_pc = outlier_pc_;
+  filtered_low_confidence_pc.clear();
+  outlier_pc.clear();
   if (radius_search_2d_filter_ptr_) {
     auto pc_frame_pose_stamped = getPoseStamped(
       *tf2_, input_ogm->header.frame_id, input_pc->header.frame_id, input_ogm->header.stamp);
@@ -292,8 +403,11 @@ void OccupancyGridMapOutlierFilterComponent::onOccupancyGridMapAndPointCloud2(
     outlier_pc = low_confidence_pc;
   }
   // Concatenate high confidence pointcloud from occupancy grid map and non-outlier pointcloud
-  PclPointCloud concat_pc =
-    high_confidence_pc + filtered_low_confidence_pc + out_ogm_pc + ogm_frame_behind_pc;
+  auto & concat_pc = concat_pc_;
+  concat_pc = high_confidence_pc;
+  concat_pc += filtered_low_confidence_pc;
+  concat_pc += out_ogm_pc;
+  concat_pc += ogm_frame_behind_pc;
   // Convert to ros msg
   {
     PointCloud2 ogm_frame_filtered_pc{};
@@ -343,6 +457,56 @@ void OccupancyGridMapOutlierFilterComponent::filterByOccupancyGridMap(
   }
 }
 
+void OccupancyGridMapOutlierFilterComponent::filterByOccupancyGridMapBatched(
+  const OccupancyGrid & occupancy_grid_map, const PointCloud2 & pointcloud,
+  PclPointCloud & high_confidence, PclPointCloud & low_confidence, PclPointCloud & out_ogm)
+{
+  // Same bounds and cells as getCost(), computed once for the whole map
+  const auto & map_position = occupancy_grid_map.info.origin.position;
+  const auto & resolution = occupancy_grid_map.info.resolution;
+  const double map_min_x = map_position.x;
+  const double map_max_x = map_position.x + occupancy_grid_map.info.width * resolution;
+  const double map_min_y = map_position.y;
+  const double map_max_y = map_position.y + occupancy_grid_map.info.height * resolution;
+  const std::size_t map_width = occupancy_grid_map.info.width;
+  const auto & map_data = occupancy_grid_map.data;
+
+  // Gather the points, then look up the cost of all of them in one pass
+  const std::size_t num_points = pointcloud.width * pointcloud.height;
+  projected_pc_.resize(num_points);
+  {
+    std::size_t i = 0;
+    for (sensor_msgs::PointCloud2ConstIterator<float> x(pointcloud, "x"), y(pointcloud, "y"),
+         z(pointcloud, "z");
+         x != x.end(); ++x, ++y, ++z, ++i) {
+      projected_pc_.points[i] = pcl::PointXYZ(*x, *y, *z);
+    }
+  }
+  projected_costs_.resize(num_points);
+  for (std::size_t i = 0; i < num_points; ++i) {
+    const double x = projected_pc_.points[i].x;
+    const double y = projected_pc_.points[i].y;
+    if (map_min_x < x && x < map_max_x && map_min_y < y && y < map_max_y) {
+      const auto map_cell_x = static_cast<std::size_t>(std::floor((x - map_min_x) / resolution));
+      const auto map_cell_y = static_cast<std::size_t>(std::floor((y - map_min_y) / resolution));
+      projected_costs_[i] = map_data[map_cell_y * map_width + map_cell_x];
+    } else {
+      projected_costs_[i] = OUT_OF_MAP_COST;
+    }
+  }
+
+  for (std::size_t i = 0; i < num_points; ++i) {
+    const auto & point = projected_pc_.points[i];
+    if (projected_costs_[i] == OUT_OF_MAP_COST) {
+      out_ogm.push_back(point);
+    } else if (cost_threshold_ < static_cast<char>(projected_costs_[i])) {
+      high_confidence.push_back(point);
+    } else {
+      low_confidence.push_back(point);
+    }
+  }
+}
+
 OccupancyGridMapOutlierFilterComponent::Debugger::Debugger(
   OccupancyGridMapOutlierFilterComponent & node)
 : node_(node)
@@ -61,7 +61,8 @@ private:
     const PointCloud2::ConstSharedPtr & input_raw_msg);
   OccupancyGrid::UniquePtr OccupancyGridMapToMsgPtr(
     const std::string & frame_id, const Time & stamp, const float & robot_pose_z,
-    const Costmap2D & occupancy_grid_map);
+    const Costmap2D & occupancy_grid_map, const unsigned int ring_offset_x = 0,
+    const unsigned int ring_offset_y = 0);
   inline void onDummyPointCloud2(const LaserScan::ConstSharedPtr & input)
   {
     PointCloud2 dummy;
@@ -59,6 +59,9 @@
 #include <sensor_msgs/msg/laser_scan.hpp>
 #include <sensor_msgs/msg/point_cloud2.hpp>
 
+#include <cstdint>
+#include <vector>
+
 namespace costmap_2d
 {
 using geometry_msgs::msg::Pose;
@@ -79,12 +82,44 @@ public:
     const double source_x, const double source_y, const double target_x, const double target_y,
     const unsigned char cost);
   void setCellValue(const double wx, const double wy, const unsigned char cost);
+
+  /**
+   * Batched raytrace() and setCellValue() for the steps whose rays all write the same cost.
+   * The cells are marked in a bit mask of the grid, small enough to stay in cache, and
+   * applyCellMask() then writes the cost to the marked cells in a single row-major pass.
+   */
+  void raytraceCellMask(
+    const double source_x, const double source_y, const double target_x, const double target_y);
+  void setCellMask(const double wx, const double wy);
+  void applyCellMask(const unsigned char cost);
   using nav2_costmap_2d::Costmap2D::resetMaps;
 
   virtual void initRosParam(rclcpp::Node & node) = 0;
 
+protected:
+  bool use_batched_raytrace_ = false;
+
 private:
   bool worldToMap(double wx, double wy, unsigned int & mx, unsigned int & my) const;
+  bool clipRay(
+    const double source_x, const double source_y, const double target_x, const double target_y,
+    unsigned int & x0, unsigned int & y0, unsigned int & x1, unsigned int & y1) const;
+  void resizeCellMask();
+
+  class MarkCellMask
+  {
+  public:
+    explicit MarkCellMask(std::uint64_t * cell_mask) : cell_mask_(cell_mask) {}
+    inline void operator()(unsigned int offset)
+    {
+      cell_mask_[offset / 64] |= std::uint64_t{1} << (offset % 64);
+    }
+
+  private:
+    std::uint64_t * cell_mask_;
+  };
+
+  std::vector<std::uint64_t> cell_mask_;
 
   rclcpp::Logger logger_{rclcpp::get_logger("pointcloud_based_occupancy_grid_map")};
   rclcpp::Clock clock_{RCL_ROS_TIME};
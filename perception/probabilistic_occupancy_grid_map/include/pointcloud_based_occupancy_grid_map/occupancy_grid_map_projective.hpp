@@ -36,7 +36,10 @@ public:
     const PointCloud2 & raw_pointcloud, const PointCloud2 & obstacle_pointcloud,
     const Pose & robot_pose, const Pose & scan_origin) override;
 
+  using OccupancyGridMapInterface::applyCellMask;
   using OccupancyGridMapInterface::raytrace;
+  using OccupancyGridMapInterface::raytraceCellMask;
+  using OccupancyGridMapInterface::setCellMask;
   using OccupancyGridMapInterface::setCellValue;
   using OccupancyGridMapInterface::updateOrigin;
 
@@ -20,6 +20,8 @@
 #include <Eigen/Core>
 #include <Eigen/Geometry>
 
+#include <array>
+
 namespace costmap_2d
 {
 class OccupancyGridMapBBFUpdater : public OccupancyGridMapUpdaterInterface
@@ -32,9 +34,37 @@ public:
   void initRosParam(rclcpp::Node & node) override;
 
 private:
+  // Window of cells [min_x, max_x) x [min_y, max_y)
+  struct CellRegion
+  {
+    unsigned int min_x;
+    unsigned int min_y;
+    unsigned int max_x;
+    unsigned int max_y;
+    bool empty() const { return min_x >= max_x || min_y >= max_y; }
+  };
+
   inline unsigned char applyBBF(const unsigned char & z, const unsigned char & o);
+  void initLookupTable();
+  bool updateWithLookupTable(const Costmap2D & single_frame_occupancy_grid_map);
+  CellRegion observedRegion(const Costmap2D & single_frame_occupancy_grid_map) const;
   Eigen::Matrix2f probability_matrix_;
   double v_ratio_;
+
+  /**
+   * applyBBF() of every measurement and prior cost. The measurements only take 4 classes
+   * (occupied, free, no information and others), so the table is 4 x 256 costs, which stays in L1.
+   */
+  bool use_lookup_table_update_{false};
+  std::array<unsigned char, 256> measurement_class_{};
+  std::array<unsigned char, 4 * 256> fused_cost_{};
+
+  /**
+   * A cell whose measurement is NO_INFORMATION and whose cost is a fixed point of that update
+   * keeps its cost, so only the observed cells and the cells yet to converge are updated.
+   */
+  bool update_dirty_region_only_{false};
+  CellRegion unconverged_region_{0, 0, 0, 0};
 };
 
 }  // namespace costmap_2d
@@ -34,6 +34,32 @@ public:
   virtual ~OccupancyGridMapUpdaterInterface() = default;
   virtual bool update(const Costmap2D & single_frame_occupancy_grid_map) = 0;
   virtual void initRosParam(rclcpp::Node & node) = 0;
+
+  /**
+   * Store the cells in a rolling window: the cost array is a torus, and updateOrigin() only moves
+   * the index of the first cell and clears the rows and columns which enter the window, instead
+   * of moving all the cells. getCharMap() and getIndex() are then in the storage order, so the
+   * cells must be accessed through getRingIndex(). To be set before the first update.
+   */
+  void setUseRollingWindow(const bool use_rolling_window)
+  {
+    use_rolling_window_ = use_rolling_window;
+  }
+  void updateOrigin(double new_origin_x, double new_origin_y) override;
+
+  /** \brief Index in the cost array of the cell (mx, my) of the window */
+  unsigned int getRingIndex(const unsigned int mx, const unsigned int my) const
+  {
+    return ((my + ring_offset_y_) % size_y_) * size_x_ + (mx + ring_offset_x_) % size_x_;
+  }
+  unsigned int getRingOffsetX() const { return ring_offset_x_; }
+  unsigned int getRingOffsetY() const { return ring_offset_y_; }
+
+protected:
+  bool use_rolling_window_{false};
+  // storage position of the cell (0, 0) of the window
+  unsigned int ring_offset_x_{0};
+  unsigned int ring_offset_y_{0};
 };
 
 }  // namespace costmap_2d
@@ -104,6 +104,8 @@ LaserscanBasedOccupancyGridMapNode::LaserscanBasedOccupancyGridMapNode(
       map_length / map_resolution, map_width / map_resolution, map_resolution);
   }
   occupancy_grid_map_updater_ptr_->initRosParam(*this);
+  occupancy_grid_map_updater_ptr_->setUseRollingWindow(
+    this->declare_parameter<bool>("use_rolling_window", false));
 }
 
 PointCloud2::SharedPtr LaserscanBasedOccupancyGridMapNode::convertLaserscanToPointCLoud2(
@@ -200,13 +202,15 @@ void LaserscanBasedOccupancyGridMapNode::onLaserscanPointCloud2WithObstacleAndRa
     // publish
     occupancy_grid_map_pub_->publish(OccupancyGridMapToMsgPtr(
       map_frame_, laserscan_pc_ptr->header.stamp, gridmap_origin.position.z,
-      *occupancy_grid_map_updater_ptr_));
+      *occupancy_grid_map_updater_ptr_, occupancy_grid_map_updater_ptr_->getRingOffsetX(),
+      occupancy_grid_map_updater_ptr_->getRingOffsetY()));
   }
 }
 
 OccupancyGrid::UniquePtr LaserscanBasedOccupancyGridMapNode::OccupancyGridMapToMsgPtr(
   const std::string & frame_id, const Time & stamp, const float & robot_pose_z,
-  const Costmap2D & occupancy_grid_map)
+  const Costmap2D & occupancy_grid_map, const unsigned int ring_offset_x,
+  const unsigned int ring_offset_y)
 {
   auto msg_ptr = std::make_unique<OccupancyGrid>();
 
@@ -227,9 +231,20 @@ OccupancyGrid::UniquePtr LaserscanBasedOccupancyGridMapNode::OccupancyGridMapToM
 
   msg_ptr->data.resize(msg_ptr->info.width * msg_ptr->info.height);
 
+  // unroll the rolling window, whose cell (0, 0) is stored at (ring_offset_x, ring_offset_y)
   unsigned char * data = occupancy_grid_map.getCharMap();
-  for (unsigned int i = 0; i < msg_ptr->data.size(); ++i) {
-    msg_ptr->data[i] = occupancy_cost_value::cost_translation_table[data[i]];
+  const unsigned int width = msg_ptr->info.width;
+  const unsigned int height = msg_ptr->info.height;
+  const unsigned int wrap_x = width - ring_offset_x;
+  for (unsigned int y = 0; y < height; ++y) {
+    const unsigned char * row = data + ((y + ring_offset_y) % height) * width;
+    auto * msg_row = &msg_ptr->data[y * width];
+    for (unsigned int x = 0; x < wrap_x; ++x) {
+      msg_row[x] = occupancy_cost_value::cost_translation_table[row[x + ring_offset_x]];
+    }
+    for (unsigned int x = wrap_x; x < width; ++x) {
+      msg_row[x] = occupancy_cost_value::cost_translation_table[row[x - wrap_x]];
+    }
   }
   return msg_ptr;
 }
@@ -167,6 +167,72 @@ void OccupancyGridMapInterface::raytrace(
 {
   unsigned int x0{};
   unsigned int y0{};
+  unsigned int x1{};
+  unsigned int y1{};
+  if (!clipRay(source_x, source_y, target_x, target_y, x0, y0, x1, y1)) {
+    return;
+  }
+
+  constexpr unsigned int cell_raytrace_range = 10000;  // large number to ignore range threshold
+  MarkCell marker(costmap_, cost);
+  raytraceLine(marker, x0, y0, x1, y1, cell_raytrace_range);
+}
+
+void OccupancyGridMapInterface::raytraceCellMask(
+  const double source_x, const double source_y, const double target_x, const double target_y)
+{
+  unsigned int x0{};
+  unsigned int y0{};
+  unsigned int x1{};
+  unsigned int y1{};
+  if (!clipRay(source_x, source_y, target_x, target_y, x0, y0, x1, y1)) {
+    return;
+  }
+
+  resizeCellMask();
+  constexpr unsigned int cell_raytrace_range = 10000;  // large number to ignore range threshold
+  MarkCellMask marker(cell_mask_.data());
+  raytraceLine(marker, x0, y0, x1, y1, cell_raytrace_range);
+}
+
+void OccupancyGridMapInterface::setCellMask(const double wx, const double wy)
+{
+  unsigned int mx{};
+  unsigned int my{};
+  if (!worldToMap(wx, wy, mx, my)) {
+    RCLCPP_DEBUG(logger_, "Computing map coords failed");
+    return;
+  }
+  resizeCellMask();
+  MarkCellMask marker(cell_mask_.data());
+  marker(getIndex(mx, my));
+}
+
+void OccupancyGridMapInterface::applyCellMask(const unsigned char cost)
+{
+  resizeCellMask();
+  for (size_t w = 0; w < cell_mask_.size(); ++w) {
+    std::uint64_t word = cell_mask_[w];
+    cell_mask_[w] = 0;
+    while (word) {
+      costmap_[w * 64 + __builtin_ctzll(word)] = cost;
+      word &= word - 1;
+    }
+  }
+}
+
+void OccupancyGridMapInterface::resizeCellMask()
+{
+  const size_t num_words = (static_cast<size_t>(size_x_) * size_y_ + 63) / 64;
+  if (cell_mask_.size() != num_words) {
+    cell_mask_.assign(num_words, 0);
+  }
+}
+
+bool OccupancyGridMapInterface::clipRay(
+  const double source_x, const double source_y, const double target_x, const double target_y,
+  unsigned int & x0, unsigned int & y0, unsigned int & x1, unsigned int & y1) const
+{
   const double ox{source_x};
   const double oy{source_y};
   if (!worldToMap(ox, oy, x0, y0)) {
@@ -175,7 +241,7 @@ void OccupancyGridMapInterface::raytrace(
       "The origin for the sensor at (%.2f, %.2f) is out of map bounds. So, the costmap cannot "
       "raytrace for it.",
       ox, oy);
-    return;
+    return false;
   }
 
   // we can pre-compute the endpoints of the map outside of the inner loop... we'll need these later
@@ -216,17 +282,8 @@ void OccupancyGridMapInterface::raytrace(
   }
 
   // now that the vector is scaled correctly... we'll get the map coordinates of its endpoint
-  unsigned int x1{};
-  unsigned int y1{};
-
   // check for legality just in case
-  if (!worldToMap(wx, wy, x1, y1)) {
-    return;
-  }
-
-  constexpr unsigned int cell_raytrace_range = 10000;  // large number to ignore range threshold
-  MarkCell marker(costmap_, cost);
-  raytraceLine(marker, x0, y0, x1, y1, cell_raytrace_range);
+  return worldToMap(wx, wy, x1, y1);
 }
 
 }  // namespace costmap_2d
@@ -136,10 +136,18 @@ void OccupancyGridMapFixedBlindSpot::updateWithPointCloud(
                        ? raw_pointcloud_angle_bin.back()
                        : obstacle_pointcloud_angle_bin.back();
     }
+    if (use_batched_raytrace_) {
+      raytraceCellMask(
+        scan_origin.position.x, scan_origin.position.y, end_distance.wx, end_distance.wy);
+      continue;
+    }
     raytrace(
       scan_origin.position.x, scan_origin.position.y, end_distance.wx, end_distance.wy,
       occupancy_cost_value::FREE_SPACE);
   }
+  if (use_batched_raytrace_) {
+    applyCellMask(occupancy_cost_value::FREE_SPACE);
+  }
 
   // Second step: Add unknown cell
   for (size_t bin_index = 0; bin_index < obstacle_pointcloud_angle_bins.size(); ++bin_index) {
@@ -205,7 +213,11 @@ void OccupancyGridMapFixedBlindSpot::updateWithPointCloud(
     auto & obstacle_pointcloud_angle_bin = obstacle_pointcloud_angle_bins.at(bin_index);
     for (size_t dist_index = 0; dist_index < obstacle_pointcloud_angle_bin.size(); ++dist_index) {
       const auto & source = obstacle_pointcloud_angle_bin.at(dist_index);
-      setCellValue(source.wx, source.wy, occupancy_cost_value::LETHAL_OBSTACLE);
+      if (use_batched_raytrace_) {
+        setCellMask(source.wx, source.wy);
+      } else {
+        setCellValue(source.wx, source.wy, occupancy_cost_value::LETHAL_OBSTACLE);
+      }
 
       if (dist_index + 1 == obstacle_pointcloud_angle_bin.size()) {
         continue;
@@ -217,17 +229,27 @@ void OccupancyGridMapFixedBlindSpot::updateWithPointCloud(
       if (next_obstacle_point_distance <= distance_margin_) {
         const auto & source = obstacle_pointcloud_angle_bin.at(dist_index);
         const auto & target = obstacle_pointcloud_angle_bin.at(dist_index + 1);
-        raytrace(source.wx, source.wy, target.wx, target.wy, occupancy_cost_value::LETHAL_OBSTACLE);
+        if (use_batched_raytrace_) {
+          raytraceCellMask(source.wx, source.wy, target.wx, target.wy);
+        } else {
+          raytrace(
+            source.wx, source.wy, target.wx, target.wy, occupancy_cost_value::LETHAL_OBSTACLE);
+        }
         continue;
       }
     }
   }
+  if (use_batched_raytrace_) {
+    applyCellMask(occupancy_cost_value::LETHAL_OBSTACLE);
+  }
 }
 
 void OccupancyGridMapFixedBlindSpot::initRosParam(rclcpp::Node & node)
 {
   distance_margin_ =
     node.declare_parameter<double>("OccupancyGridMapFixedBlindSpot.distance_margin");
+  use_batched_raytrace_ =
+    node.declare_parameter<bool>("OccupancyGridMapFixedBlindSpot.use_batched_raytrace", false);
 }
 
 }  // namespace costmap_2d
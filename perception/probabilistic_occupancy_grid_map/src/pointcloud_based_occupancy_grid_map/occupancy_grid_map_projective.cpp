@@ -194,10 +194,18 @@ void OccupancyGridMapProjectiveBlindSpot::updateWithPointCloud(
                   ? farthest_raw_this_bin
                   : farthest_obstacle_this_bin;
     }
+    if (use_batched_raytrace_) {
+      raytraceCellMask(
+        scan_origin.position.x, scan_origin.position.y, ray_end.wx, ray_end.wy);
+      continue;
+    }
     raytrace(
       scan_origin.position.x, scan_origin.position.y, ray_end.wx, ray_end.wy,
       occupancy_cost_value::FREE_SPACE);
   }
+  if (use_batched_raytrace_) {
+    applyCellMask(occupancy_cost_value::FREE_SPACE);
+  }
 
   if (pub_debug_grid_)
     converter.addLayerFromCostmap2D(*this, "filled_free_to_farthest", debug_grid_);
@@ -273,7 +281,11 @@ void OccupancyGridMapProjectiveBlindSpot::updateWithPointCloud(
     auto & obstacle_pointcloud_angle_bin = obstacle_pointcloud_angle_bins.at(bin_index);
     for (size_t dist_index = 0; dist_index < obstacle_pointcloud_angle_bin.size(); ++dist_index) {
       const auto & source = obstacle_pointcloud_angle_bin.at(dist_index);
-      setCellValue(source.wx, source.wy, occupancy_cost_value::LETHAL_OBSTACLE);
+      if (use_batched_raytrace_) {
+        setCellMask(source.wx, source.wy);
+      } else {
+        setCellValue(source.wx, source.wy, occupancy_cost_value::LETHAL_OBSTACLE);
+      }
 
       if (dist_index + 1 == obstacle_pointcloud_angle_bin.size()) {
         continue;
@@ -285,11 +297,19 @@ void OccupancyGridMapProjectiveBlindSpot::updateWithPointCloud(
       if (next_obstacle_point_distance <= obstacle_separation_threshold_) {
         const auto & source = obstacle_pointcloud_angle_bin.at(dist_index);
         const auto & target = obstacle_pointcloud_angle_bin.at(dist_index + 1);
-        raytrace(source.wx, source.wy, target.wx, target.wy, occupancy_cost_value::LETHAL_OBSTACLE);
+        if (use_batched_raytrace_) {
+          raytraceCellMask(source.wx, source.wy, target.wx, target.wy);
+        } else {
+          raytrace(
+            source.wx, source.wy, target.wx, target.wy, occupancy_cost_value::LETHAL_OBSTACLE);
+        }
         continue;
       }
     }
   }
+  if (use_batched_raytrace_) {
+    applyCellMask(occupancy_cost_value::LETHAL_OBSTACLE);
+  }
 
   if (pub_debug_grid_) converter.addLayerFromCostmap2D(*this, "added_obstacle", debug_grid_);
   if (pub_debug_grid_) {
@@ -305,6 +325,8 @@ void OccupancyGridMapProjectiveBlindSpot::initRosParam(rclcpp::Node & node)
     "OccupancyGridMapProjectiveBlindSpot.obstacle_separation_threshold");
   pub_debug_grid_ =
     node.declare_parameter<bool>("OccupancyGridMapProjectiveBlindSpot.pub_debug_grid");
+  use_batched_raytrace_ = node.declare_parameter<bool>(
+    "OccupancyGridMapProjectiveBlindSpot.use_batched_raytrace", false);
   debug_grid_map_publisher_ptr_ = node.create_publisher<grid_map_msgs::msg::GridMap>(
     "~/debug/grid_map", rclcpp::QoS(1).durability_volatile());
 }
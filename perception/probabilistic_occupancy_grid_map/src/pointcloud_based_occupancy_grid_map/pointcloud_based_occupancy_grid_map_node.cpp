@@ -93,6 +93,8 @@ PointcloudBasedOccupancyGridMapNode::PointcloudBasedOccupancyGridMapNode(
       map_length / map_resolution, map_length / map_resolution, map_resolution);
   }
   occupancy_grid_map_updater_ptr_->initRosParam(*this);
+  occupancy_grid_map_updater_ptr_->setUseRollingWindow(
+    this->declare_parameter<bool>("use_rolling_window", false));
 
   const std::string grid_map_type = this->declare_parameter<std::string>("grid_map_type");
   if (grid_map_type == "OccupancyGridMapProjectiveBlindSpot") {
@@ -200,7 +202,8 @@ void PointcloudBasedOccupancyGridMapNode::onPointcloudWithObstacleAndRaw(
     // publish
     occupancy_grid_map_pub_->publish(OccupancyGridMapToMsgPtr(
       map_frame_, input_raw_msg->header.stamp, robot_pose.position.z,
-      *occupancy_grid_map_updater_ptr_));
+      *occupancy_grid_map_updater_ptr_, occupancy_grid_map_updater_ptr_->getRingOffsetX(),
+      occupancy_grid_map_updater_ptr_->getRingOffsetY()));
   }
 
   if (debug_publisher_ptr_ && stop_watch_ptr_) {
@@ -215,7 +218,8 @@ void PointcloudBasedOccupancyGridMapNode::onPointcloudWithObstacleAndRaw(
 
 OccupancyGrid::UniquePtr PointcloudBasedOccupancyGridMapNode::OccupancyGridMapToMsgPtr(
   const std::string & frame_id, const Time & stamp, const float & robot_pose_z,
-  const Costmap2D & occupancy_grid_map)
+  const Costmap2D & occupancy_grid_map, const unsigned int ring_offset_x,
+  const unsigned int ring_offset_y)
 {
   auto msg_ptr = std::make_unique<OccupancyGrid>();
 
@@ -236,9 +240,20 @@ OccupancyGrid::UniquePtr PointcloudBasedOccupancyGridMapNode::OccupancyGridMapTo
 
   msg_ptr->data.resize(msg_ptr->info.width * msg_ptr->info.height);
 
+  // unroll the rolling window, whose cell (0, 0) is stored at (ring_offset_x, ring_offset_y)
   unsigned char * data = occupancy_grid_map.getCharMap();
-  for (unsigned int i = 0; i < msg_ptr->data.size(); ++i) {
-    msg_ptr->data[i] = occupancy_cost_value::cost_translation_table[data[i]];
+  const unsigned int width = msg_ptr->info.width;
+  const unsigned int height = msg_ptr->info.height;
+  const unsigned int wrap_x = width - ring_offset_x;
+  for (unsigned int y = 0; y < height; ++y) {
+    const unsigned char * row = data + ((y + ring_offset_y) % height) * width;
+    auto * msg_row = &msg_ptr->data[y * width];
+    for (unsigned int x = 0; x < wrap_x; ++x) {
+      msg_row[x] = occupancy_cost_value::cost_translation_table[row[x + ring_offset_x]];
+    }
+    for (unsigned int x = wrap_x; x < width; ++x) {
+      msg_row[x] = occupancy_cost_value::cost_translation_table[row[x - wrap_x]];
+    }
   }
   return msg_ptr;
 }
@@ -17,6 +17,18 @@
 #include "cost_value.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace
+{
+// Classes of the measurement costs in the lookup table
+constexpr unsigned char OCCUPIED_CLASS = 0;
+constexpr unsigned char FREE_CLASS = 1;
+constexpr unsigned char NO_INFORMATION_CLASS = 2;
+constexpr unsigned char OTHER_CLASS = 3;
+}  // namespace
 
 namespace costmap_2d
 {
@@ -38,6 +50,27 @@ void OccupancyGridMapBBFUpdater::initRosParam(rclcpp::Node & node)
   probability_matrix_(Index::OCCUPIED, Index::FREE) =
     node.declare_parameter<double>("probability_matrix.free_to_occupied");
   v_ratio_ = node.declare_parameter<double>("v_ratio");
+  use_lookup_table_update_ = node.declare_parameter<bool>("use_lookup_table_update", false);
+  update_dirty_region_only_ = node.declare_parameter<bool>("update_dirty_region_only", false);
+  initLookupTable();
+}
+
+void OccupancyGridMapBBFUpdater::initLookupTable()
+{
+  for (unsigned int z = 0; z < 256; ++z) {
+    unsigned char measurement_class = OTHER_CLASS;
+    if (z == occupancy_cost_value::LETHAL_OBSTACLE) {
+      measurement_class = OCCUPIED_CLASS;
+    } else if (z == occupancy_cost_value::FREE_SPACE) {
+      measurement_class = FREE_CLASS;
+    } else if (z == occupancy_cost_value::NO_INFORMATION) {
+      measurement_class = NO_INFORMATION_CLASS;
+    }
+    measurement_class_[z] = measurement_class;
+    for (unsigned int o = 0; o < 256; ++o) {
+      fused_cost_[measurement_class * 256 + o] = applyBBF(z, o);
+    }
+  }
 }
 
 inline unsigned char OccupancyGridMapBBFUpdater::applyBBF(
@@ -67,15 +100,129 @@ inline unsigned char OccupancyGridMapBBFUpdater::applyBBF(
 
 bool OccupancyGridMapBBFUpdater::update(const Costmap2D & single_frame_occupancy_grid_map)
 {
+  if (use_lookup_table_update_) {
+    return updateWithLookupTable(single_frame_occupancy_grid_map);
+  }
+
   updateOrigin(
     single_frame_occupancy_grid_map.getOriginX(), single_frame_occupancy_grid_map.getOriginY());
   for (unsigned int x = 0; x < getSizeInCellsX(); x++) {
     for (unsigned int y = 0; y < getSizeInCellsY(); y++) {
-      unsigned int index = getIndex(x, y);
+      unsigned int index = getRingIndex(x, y);
       costmap_[index] = applyBBF(single_frame_occupancy_grid_map.getCost(x, y), costmap_[index]);
     }
   }
   return true;
 }
 
+bool OccupancyGridMapBBFUpdater::updateWithLookupTable(
+  const Costmap2D & single_frame_occupancy_grid_map)
+{
+  const double previous_origin_x = origin_x_;
+  const double previous_origin_y = origin_y_;
+  updateOrigin(
+    single_frame_occupancy_grid_map.getOriginX(), single_frame_occupancy_grid_map.getOriginY());
+
+  const unsigned char * no_information_fused_cost = &fused_cost_[NO_INFORMATION_CLASS * 256];
+  CellRegion region{0, 0, size_x_, size_y_};
+  // The cells shifted in by updateOrigin() are reset to NO_INFORMATION, they must not need updates
+  const bool is_default_converged =
+    no_information_fused_cost[occupancy_cost_value::NO_INFORMATION] ==
+    occupancy_cost_value::NO_INFORMATION;
+  if (update_dirty_region_only_ && is_default_converged) {
+    // the origin stays grid-aligned, so the shift is an exact number of cells
+    const int shift_x = std::lround((origin_x_ - previous_origin_x) / resolution_);
+    const int shift_y = std::lround((origin_y_ - previous_origin_y) / resolution_);
+    const auto shift = [](unsigned int value, int offset, unsigned int size) {
+      return static_cast<unsigned int>(
+        std::clamp(static_cast<int>(value) - offset, 0, static_cast<int>(size)));
+    };
+    CellRegion unconverged{
+      shift(unconverged_region_.min_x, shift_x, size_x_),
+      shift(unconverged_region_.min_y, shift_y, size_y_),
+      shift(unconverged_region_.max_x, shift_x, size_x_),
+      shift(unconverged_region_.max_y, shift_y, size_y_)};
+    const CellRegion observed = observedRegion(single_frame_occupancy_grid_map);
+    if (unconverged.empty()) {
+      region = observed;
+    } else if (observed.empty()) {
+      region = unconverged;
+    } else {
+      region = CellRegion{
+        std::min(unconverged.min_x, observed.min_x), std::min(unconverged.min_y, observed.min_y),
+        std::max(unconverged.max_x, observed.max_x), std::max(unconverged.max_y, observed.max_y)};
+    }
+  }
+
+  // Row-major pass over the region, keeping the bounds of the cells which are not converged
+  const unsigned char * measurements = single_frame_occupancy_grid_map.getCharMap();
+  CellRegion unconverged{size_x_, size_y_, 0, 0};
+  // the rows of a rolling window wrap around at wrap_x
+  const unsigned int wrap_x = size_x_ - ring_offset_x_;
+  for (unsigned int y = region.min_y; y < region.max_y; ++y) {
+    const unsigned char * measurement_row = measurements + y * size_x_;
+    unsigned char * cost_row = costmap_ + ((y + ring_offset_y_) % size_y_) * size_x_;
+    unsigned int first_x = size_x_;
+    unsigned int last_x = 0;
+    for (unsigned int x = region.min_x; x < region.max_x; ++x) {
+      unsigned char & prior = cost_row[x < wrap_x ? x + ring_offset_x_ : x - wrap_x];
+      const unsigned char cost = fused_cost_[measurement_class_[measurement_row[x]] * 256 + prior];
+      prior = cost;
+      if (no_information_fused_cost[cost] != cost) {
+        first_x = std::min(first_x, x);
+        last_x = x + 1;
+      }
+    }
+    if (first_x < last_x) {
+      unconverged.min_x = std::min(unconverged.min_x, first_x);
+      unconverged.max_x = std::max(unconverged.max_x, last_x);
+      unconverged.min_y = std::min(unconverged.min_y, y);
+      unconverged.max_y = y + 1;
+    }
+  }
+  unconverged_region_ = unconverged;
+  return true;
+}
+
+OccupancyGridMapBBFUpdater::CellRegion OccupancyGridMapBBFUpdater::observedRegion(
+  const Costmap2D & single_frame_occupancy_grid_map) const
+{
+  // Rows are compared 8 cells at a time against NO_INFORMATION
+  constexpr std::uint64_t no_information_word =
+    0x0101010101010101ULL * occupancy_cost_value::NO_INFORMATION;
+  const auto is_no_information_word = [&](const unsigned char * cells) {
+    std::uint64_t word{};
+    std::memcpy(&word, cells, sizeof(word));
+    return word == no_information_word;
+  };
+
+  const unsigned char * measurements = single_frame_occupancy_grid_map.getCharMap();
+  CellRegion observed{size_x_, size_y_, 0, 0};
+  for (unsigned int y = 0; y < size_y_; ++y) {
+    const unsigned char * row = measurements + y * size_x_;
+    unsigned int first_x = 0;
+    while (first_x + 8 <= size_x_ && is_no_information_word(row + first_x)) {
+      first_x += 8;
+    }
+    while (first_x < size_x_ && row[first_x] == occupancy_cost_value::NO_INFORMATION) {
+      ++first_x;
+    }
+    if (first_x == size_x_) {
+      continue;
+    }
+    unsigned int last_x = size_x_;
+    while (last_x >= first_x + 8 && is_no_information_word(row + last_x - 8)) {
+      last_x -= 8;
+    }
+    while (row[last_x - 1] == occupancy_cost_value::NO_INFORMATION) {
+      --last_x;
+    }
+    observed.min_x = std::min(observed.min_x, first_x);
+    observed.max_x = std::max(observed.max_x, last_x);
+    observed.min_y = std::min(observed.min_y, y);
+    observed.max_y = y + 1;
+  }
+  return observed;
+}
+
 }  // namespace costmap_2d
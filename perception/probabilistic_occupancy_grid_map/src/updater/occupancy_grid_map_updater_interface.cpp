@@ -0,0 +1,71 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "updater/occupancy_grid_map_updater_interface.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
+
+namespace costmap_2d
+{
+
+void OccupancyGridMapUpdaterInterface::updateOrigin(double new_origin_x, double new_origin_y)
+{
+  if (!use_rolling_window_) {
+    Costmap2D::updateOrigin(new_origin_x, new_origin_y);
+    return;
+  }
+
+  // same grid-aligned shift as Costmap2D::updateOrigin()
+  const int cell_ox = static_cast<int>((new_origin_x - origin_x_) / resolution_);
+  const int cell_oy = static_cast<int>((new_origin_y - origin_y_) / resolution_);
+  origin_x_ = origin_x_ + cell_ox * resolution_;
+  origin_y_ = origin_y_ + cell_oy * resolution_;
+
+  const int size_x = static_cast<int>(size_x_);
+  const int size_y = static_cast<int>(size_y_);
+  if (std::abs(cell_ox) >= size_x || std::abs(cell_oy) >= size_y) {
+    resetMaps();
+    ring_offset_x_ = 0;
+    ring_offset_y_ = 0;
+    return;
+  }
+  ring_offset_x_ = (static_cast<int>(ring_offset_x_) + cell_ox + size_x) % size_x;
+  ring_offset_y_ = (static_cast<int>(ring_offset_y_) + cell_oy + size_y) % size_y;
+
+  // clear the columns [begin_x, end_x) and the rows [begin_y, end_y) which enter the window
+  const unsigned int begin_x = cell_ox > 0 ? size_x - cell_ox : 0;
+  const unsigned int end_x = cell_ox > 0 ? size_x_ : -cell_ox;
+  const unsigned int begin_y = cell_oy > 0 ? size_y - cell_oy : 0;
+  const unsigned int end_y = cell_oy > 0 ? size_y_ : -cell_oy;
+  for (unsigned int my = begin_y; my < end_y; ++my) {
+    const unsigned int y = (my + ring_offset_y_) % size_y_;
+    std::memset(costmap_ + y * size_x_, default_value_, size_x_);
+  }
+  if (begin_x == end_x) {
+    return;
+  }
+  // the cleared columns are contiguous in storage, possibly wrapping around the end of the rows
+  const unsigned int first_x = (begin_x + ring_offset_x_) % size_x_;
+  const unsigned int num_x = end_x - begin_x;
+  const unsigned int num_x_before_wrap = std::min(num_x, size_x_ - first_x);
+  for (unsigned int y = 0; y < size_y_; ++y) {
+    unsigned char * row = costmap_ + y * size_x_;
+    std::memset(row + first_x, default_value_, num_x_before_wrap);
+    std::memset(row, default_value_, num_x - num_x_before_wrap);
+  }
+}
+
+}  // namespace costmap_2d
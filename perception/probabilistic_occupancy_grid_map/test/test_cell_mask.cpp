@@ -0,0 +1,59 @@
+// Copyright 2023 TIER IV, INC.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <gtest/gtest.h>
+
+#include <random>
+// autoware
+#include "cost_value.hpp"
+#include "pointcloud_based_occupancy_grid_map/occupancy_grid_map_fixed.hpp"
+
+using costmap_2d::OccupancyGridMapFixedBlindSpot;
+
+// the batched raytrace marks the same cells as raytrace() and setCellValue()
+TEST(OccupancyGridMapInterfaceTest, CellMaskMatchesRaytrace)
+{
+  OccupancyGridMapFixedBlindSpot expected(100, 100, 0.5);
+  OccupancyGridMapFixedBlindSpot batched(100, 100, 0.5);
+  expected.updateOrigin(-25.0, -25.0);
+  batched.updateOrigin(-25.0, -25.0);
+
+  std::mt19937 engine(0);
+  std::uniform_real_distribution<double> in_map(-24.9, 24.9);
+  std::uniform_real_distribution<double> target(-40.0, 40.0);  // partly out of the map
+  for (int i = 0; i < 500; ++i) {
+    const double source_x = in_map(engine);
+    const double source_y = in_map(engine);
+    const double target_x = target(engine);
+    const double target_y = target(engine);
+    expected.raytrace(
+      source_x, source_y, target_x, target_y, occupancy_cost_value::LETHAL_OBSTACLE);
+    batched.raytraceCellMask(source_x, source_y, target_x, target_y);
+    expected.setCellValue(target_x, target_y, occupancy_cost_value::LETHAL_OBSTACLE);
+    batched.setCellMask(target_x, target_y);
+  }
+  batched.applyCellMask(occupancy_cost_value::LETHAL_OBSTACLE);
+
+  const unsigned char * expected_map = expected.getCharMap();
+  const unsigned char * batched_map = batched.getCharMap();
+  for (unsigned int index = 0; index < 100 * 100; ++index) {
+    EXPECT_EQ(expected_map[index], batched_map[index]) << "cell " << index;
+  }
+
+  // the mask is cleared once applied
+  batched.applyCellMask(occupancy_cost_value::FREE_SPACE);
+  for (unsigned int index = 0; index < 100 * 100; ++index) {
+    EXPECT_EQ(expected_map[index], batched_map[index]) << "cell " << index;
+  }
+}
@@ -90,10 +90,26 @@ public:
   Output update(const Input & input);
 
 private:
+  // Uniform grid of the radar positions on the bird's-eye view to find the radars around the
+  // objects without testing every pair of an object and a radar
+  struct RadarGrid
+  {
+    double cell_size{};
+    double min_x{};
+    double min_y{};
+    int width{};
+    int height{};
+    std::vector<size_t> cell_begin{};  // range in indices for each cell
+    std::vector<size_t> indices{};     // indices of the radars sorted by the cell
+  };
+
   rclcpp::Logger logger_;
   Param param_{};
+  RadarGrid radar_grid_{};
+  void buildRadarGrid(const std::vector<RadarInput> & radars, RadarGrid & radar_grid);
   std::shared_ptr<std::vector<RadarInput>> filterRadarWithinObject(
-    const DetectedObject & object, const std::shared_ptr<std::vector<RadarInput>> & radars);
+    const DetectedObject & object, const std::shared_ptr<std::vector<RadarInput>> & radars,
+    const RadarGrid & radar_grid);
   // TODO(Satoshi Tanaka): Implement
   // std::vector<DetectedObject> splitObject(
   //   const DetectedObject & object, const std::shared_ptr<std::vector<RadarInput>> & radars);
@@ -111,7 +127,6 @@ private:
   TwistWithCovariance toTwistWithCovariance(const Eigen::Vector2d & vector2d);
 
   double getTwistNorm(const Twist & twist);
-  LinearRing2d createObject2dWithMargin(const Point2d object_size, const double margin);
 };
 }  // namespace radar_fusion_to_detected_object
 
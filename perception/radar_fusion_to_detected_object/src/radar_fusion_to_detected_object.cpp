@@ -18,10 +18,10 @@
 #include <tier4_autoware_utils/geometry/geometry.hpp>
 #include <tier4_autoware_utils/math/normalization.hpp>
 
-#include <boost/geometry.hpp>
-
 #include <algorithm>
+#include <cmath>
 #include <iostream>
+#include <limits>
 #include <memory>
 #include <numeric>
 #include <string>
@@ -29,6 +29,14 @@
 
 namespace radar_fusion_to_detected_object
 {
+namespace
+{
+// cell size of the radar grid [m], which is comparable to the size of the objects with margin
+constexpr double radar_grid_cell_size = 4.0;
+// upper limit of the number of cells in the radar grid to bound the memory for sparse radars
+constexpr double radar_grid_max_cell_num = 1 << 16;
+}  // namespace
+
 using autoware_auto_perception_msgs::msg::DetectedObject;
 using autoware_auto_perception_msgs::msg::DetectedObjects;
 using geometry_msgs::msg::Point;
@@ -81,10 +89,12 @@ RadarFusionToDetectedObject::Output RadarFusionToDetectedObject::update(
     return output;
   }
 
+  buildRadarGrid(*input.radars, radar_grid_);
+
   for (auto & object : input.objects->objects) {
     // Link between 3d bounding box and radar data
     std::shared_ptr<std::vector<RadarInput>> radars_within_object =
-      filterRadarWithinObject(object, input.radars);
+      filterRadarWithinObject(object, input.radars, radar_grid_);
 
     // TODO(Satoshi Tanaka): Implement
     // Split the object going in a different direction
@@ -100,7 +110,10 @@ RadarFusionToDetectedObject::Output RadarFusionToDetectedObject::update(
         radars_within_split_object = radars_within_object;
       } else {
         // If object is split, then filter radar again
-        radars_within_split_object = filterRadarWithinObject(split_object, radars_within_object);
+        RadarGrid split_radar_grid{};
+        buildRadarGrid(*radars_within_object, split_radar_grid);
+        radars_within_split_object =
+          filterRadarWithinObject(split_object, radars_within_object, split_radar_grid);
       }
 
       // Estimate twist of object
@@ -165,28 +178,125 @@ bool RadarFusionToDetectedObject::isYawCorrect(
   }
 }
 
+// Sort the radars by the cell of a uniform grid with a counting sort.
+void RadarFusionToDetectedObject::buildRadarGrid(
+  const std::vector<RadarInput> & radars, RadarGrid & radar_grid)
+{
+  radar_grid.cell_begin.clear();
+  radar_grid.indices.clear();
+  radar_grid.width = 0;
+  radar_grid.height = 0;
+  if (radars.empty()) {
+    return;
+  }
+
+  double min_x = std::numeric_limits<double>::max();
+  double min_y = std::numeric_limits<double>::max();
+  double max_x = std::numeric_limits<double>::lowest();
+  double max_y = std::numeric_limits<double>::lowest();
+  for (const auto & radar : radars) {
+    const auto & position = radar.pose_with_covariance.pose.position;
+    min_x = std::min(min_x, position.x);
+    min_y = std::min(min_y, position.y);
+    max_x = std::max(max_x, position.x);
+    max_y = std::max(max_y, position.y);
+  }
+  const double extent_x = max_x - min_x;
+  const double extent_y = max_y - min_y;
+  radar_grid.cell_size = std::max(
+    {radar_grid_cell_size, std::sqrt(extent_x * extent_y / radar_grid_max_cell_num),
+     std::max(extent_x, extent_y) / radar_grid_max_cell_num});
+  radar_grid.min_x = min_x;
+  radar_grid.min_y = min_y;
+  radar_grid.width = static_cast<int>(extent_x / radar_grid.cell_size) + 1;
+  radar_grid.height = static_cast<int>(extent_y / radar_grid.cell_size) + 1;
+
+  std::vector<size_t> radar_cells(radars.size());
+  radar_grid.cell_begin.assign(static_cast<size_t>(radar_grid.width) * radar_grid.height + 1, 0);
+  for (size_t i = 0; i < radars.size(); ++i) {
+    const auto & position = radars.at(i).pose_with_covariance.pose.position;
+    const int cell_x = std::min(
+      static_cast<int>((position.x - min_x) / radar_grid.cell_size), radar_grid.width - 1);
+    const int cell_y = std::min(
+      static_cast<int>((position.y - min_y) / radar_grid.cell_size), radar_grid.height - 1);
+    radar_cells.at(i) = static_cast<size_t>(cell_y) * radar_grid.width + cell_x;
+    ++radar_grid.cell_begin.at(radar_cells.at(i) + 1);
+  }
+  for (size_t cell = 1; cell < radar_grid.cell_begin.size(); ++cell) {
+    radar_grid.cell_begin.at(cell) += radar_grid.cell_begin.at(cell - 1);
+  }
+  radar_grid.indices.resize(radars.size());
+  std::vector<size_t> cell_end(radar_grid.cell_begin.begin(), radar_grid.cell_begin.end() - 1);
+  for (size_t i = 0; i < radars.size(); ++i) {
+    radar_grid.indices.at(cell_end.at(radar_cells.at(i))++) = i;
+  }
+}
+
 // Choose radar pointcloud/objects within 3D bounding box from lidar-base detection with margin
 // space from bird's-eye view.
+// Only the radars in the cells overlapping the bounding box are tested, and each of them is
+// tested in the frame of the object as an oriented box.
 std::shared_ptr<std::vector<RadarFusionToDetectedObject::RadarInput>>
 RadarFusionToDetectedObject::filterRadarWithinObject(
   const DetectedObject & object,
-  const std::shared_ptr<std::vector<RadarFusionToDetectedObject::RadarInput>> & radars)
+  const std::shared_ptr<std::vector<RadarFusionToDetectedObject::RadarInput>> & radars,
+  const RadarGrid & radar_grid)
 {
-  std::vector<RadarInput> outputs{};
-
-  tier4_autoware_utils::Point2d object_size{object.shape.dimensions.x, object.shape.dimensions.y};
-  LinearRing2d object_box = createObject2dWithMargin(object_size, param_.bounding_box_margin);
-  object_box = tier4_autoware_utils::transformVector(
-    object_box, tier4_autoware_utils::pose2transform(object.kinematics.pose_with_covariance.pose));
-
-  for (const auto & radar : (*radars)) {
-    Point2d radar_point{
-      radar.pose_with_covariance.pose.position.x, radar.pose_with_covariance.pose.position.y};
-    if (boost::geometry::within(radar_point, object_box)) {
-      outputs.emplace_back(radar);
+  auto outputs = std::make_shared<std::vector<RadarInput>>();
+  if (radar_grid.width == 0 || radar_grid.height == 0) {
+    return outputs;
+  }
+
+  const auto & object_pose = object.kinematics.pose_with_covariance.pose;
+  const double half_length = object.shape.dimensions.x / 2.0 + param_.bounding_box_margin;
+  const double half_width = object.shape.dimensions.y / 2.0 + param_.bounding_box_margin;
+  const double yaw = tf2::getYaw(object_pose.orientation);
+  const double cos_yaw = std::cos(yaw);
+  const double sin_yaw = std::sin(yaw);
+
+  // cells overlapping the axis-aligned bounding box of the object box
+  const double extent_x = std::abs(cos_yaw) * half_length + std::abs(sin_yaw) * half_width;
+  const double extent_y = std::abs(sin_yaw) * half_length + std::abs(cos_yaw) * half_width;
+  const auto to_cell = [&](const double value, const double min_value, const int size) {
+    const double cell = std::floor((value - min_value) / radar_grid.cell_size);
+    return static_cast<int>(std::clamp(cell, -1.0, static_cast<double>(size)));
+  };
+  const int begin_x =
+    std::max(to_cell(object_pose.position.x - extent_x, radar_grid.min_x, radar_grid.width), 0);
+  const int end_x = std::min(
+    to_cell(object_pose.position.x + extent_x, radar_grid.min_x, radar_grid.width),
+    radar_grid.width - 1);
+  const int begin_y =
+    std::max(to_cell(object_pose.position.y - extent_y, radar_grid.min_y, radar_grid.height), 0);
+  const int end_y = std::min(
+    to_cell(object_pose.position.y + extent_y, radar_grid.min_y, radar_grid.height),
+    radar_grid.height - 1);
+
+  std::vector<size_t> indices_within_object{};
+  for (int y = begin_y; y <= end_y; ++y) {
+    for (int x = begin_x; x <= end_x; ++x) {
+      const size_t cell = static_cast<size_t>(y) * radar_grid.width + x;
+      for (size_t i = radar_grid.cell_begin.at(cell); i < radar_grid.cell_begin.at(cell + 1); ++i) {
+        const size_t index = radar_grid.indices.at(i);
+        const auto & position = radars->at(index).pose_with_covariance.pose.position;
+        const double dx = position.x - object_pose.position.x;
+        const double dy = position.y - object_pose.position.y;
+        const double local_x = cos_yaw * dx + sin_yaw * dy;
+        const double local_y = -sin_yaw * dx + cos_yaw * dy;
+        if (std::abs(local_x) < half_length && std::abs(local_y) < half_width) {
+          indices_within_object.push_back(index);
+        }
+      }
     }
   }
-  return std::make_shared<std::vector<RadarFusionToDetectedObject::RadarInput>>(outputs);
+
+  // keep the order of the input radars
+  std::sort(indices_within_object.begin(), indices_within_object.end());
+  outputs->reserve(indices_within_object.size());
+  for (const auto index : indices_within_object) {
+    outputs->emplace_back(radars->at(index));
+  }
+  return outputs;
 }
 
 // TODO(Satoshi Tanaka): Implementation
@@ -338,22 +448,4 @@ double RadarFusionToDetectedObject::getTwistNorm(const Twist & twist)
     twist.linear.z * twist.linear.z);
   return output;
 }
-
-LinearRing2d RadarFusionToDetectedObject::createObject2dWithMargin(
-  const Point2d object_size, const double margin)
-{
-  const double x_front = object_size.x() / 2.0 + margin;
-  const double x_rear = -object_size.x() / 2.0 - margin;
-  const double y_left = object_size.y() / 2.0 + margin;
-  const double y_right = -object_size.y() / 2.0 - margin;
-
-  LinearRing2d box{};
-  box.push_back(Point2d{x_front, y_left});
-  box.push_back(Point2d{x_front, y_right});
-  box.push_back(Point2d{x_rear, y_right});
-  box.push_back(Point2d{x_rear, y_left});
-  box.push_back(Point2d{x_front, y_left});
-
-  return box;
-}
 }  // namespace radar_fusion_to_detected_object
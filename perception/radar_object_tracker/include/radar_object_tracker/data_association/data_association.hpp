@@ -19,14 +19,15 @@
 #ifndef RADAR_OBJECT_TRACKER__DATA_ASSOCIATION__DATA_ASSOCIATION_HPP_
 #define RADAR_OBJECT_TRACKER__DATA_ASSOCIATION__DATA_ASSOCIATION_HPP_
 
+#include <cstdint>
 #include <list>
 #include <memory>
 #include <unordered_map>
 #include <vector>
 
 #define EIGEN_MPL2_ONLY
+#include "gnn_solver/gnn_solver.hpp"
 #include "object_recognition_utils/object_recognition_utils.hpp"
-#include "radar_object_tracker/data_association/solver/gnn_solver.hpp"
 #include "radar_object_tracker/tracker/tracker.hpp"
 
 #include <Eigen/Core>
@@ -34,9 +35,15 @@
 
 #include <autoware_auto_perception_msgs/msg/detected_objects.hpp>
 
+#include <nlohmann/json.hpp>
+
 #include <string>
 class DataAssociation
 {
+public:
+  // row: tracker, col: measurement, with the pairs which pass all the gates
+  using SparseScoreMatrix = gnn_solver::SparseScoreMatrix;
+
 private:
   Eigen::MatrixXi can_assign_matrix_;
   Eigen::MatrixXd max_dist_matrix_;
@@ -47,6 +54,13 @@ private:
   const double score_threshold_;
   std::unique_ptr<gnn_solver::GnnSolverInterface> gnn_solver_ptr_;
 
+  // The gate results are written to pair_log_data if it is not null
+  double calcScore(
+    const autoware_auto_perception_msgs::msg::DetectedObject & measurement_object,
+    const std::uint8_t measurement_label,
+    const autoware_auto_perception_msgs::msg::TrackedObject & tracked_object,
+    const std::uint8_t tracker_label, nlohmann::json * pair_log_data) const;
+
 public:
   EIGEN_MAKE_ALIGNED_OPERATOR_NEW
   DataAssociation(
@@ -60,6 +74,23 @@ public:
     const autoware_auto_perception_msgs::msg::DetectedObjects & measurements,
     const std::list<std::shared_ptr<Tracker>> & trackers, const bool debug_log,
     const std::string & file_name);
+
+  /**
+   * Same scores as calcScoreMatrix(), for the pairs which pass the gates only.
+   * The measurements are indexed in a grid of the largest max distance, so that a tracker is only
+   * gated against the measurements of the 3x3 cells around it.
+   */
+  SparseScoreMatrix calcSparseScoreMatrix(
+    const autoware_auto_perception_msgs::msg::DetectedObjects & measurements,
+    const std::list<std::shared_ptr<Tracker>> & trackers);
+
+  /**
+   * Same assignment as assign(), up to ties. Each connected component of the bipartite graph of
+   * the gated pairs is solved on its own.
+   */
+  void assignSparse(
+    const SparseScoreMatrix & src, std::unordered_map<int, int> & direct_assignment,
+    std::unordered_map<int, int> & reverse_assignment);
   virtual ~DataAssociation() {}
 };
 
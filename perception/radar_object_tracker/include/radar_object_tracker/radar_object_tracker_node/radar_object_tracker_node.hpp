@@ -46,10 +46,13 @@
 #include <tf2_ros/buffer.h>
 #include <tf2_ros/transform_listener.h>
 
+#include <array>
 #include <list>
 #include <map>
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 using autoware_auto_mapping_msgs::msg::HADMapBin;
 using autoware_auto_perception_msgs::msg::DetectedObject;
@@ -112,6 +115,15 @@ private:
   std::shared_ptr<lanelet::LaneletMap> lanelet_map_ptr_;
   std::shared_ptr<lanelet::routing::RoutingGraph> routing_graph_ptr_;
   std::shared_ptr<lanelet::traffic_rules::TrafficRules> traffic_rules_ptr_;
+  // nearest lanelets of each tracker, reused while the tracker stays close to the search point
+  struct NearestLanelets
+  {
+    lanelet::BasicPoint2d search_point;
+    std::vector<std::pair<double, lanelet::Lanelet>> lanelets;
+  };
+  std::map<std::array<uint8_t, 16>, NearestLanelets> nearest_lanelets_cache_;
+  const std::vector<std::pair<double, lanelet::Lanelet>> & getNearestLanelets(
+    const std::shared_ptr<Tracker> & tracker, const TrackedObject & object);
   // Crosswalk Entry Points
   // lanelet::ConstLanelets crosswalks_;
 
@@ -17,7 +17,7 @@
 
 #include "radar_object_tracker/tracker/model/tracker_base.hpp"
 
-#include <kalman_filter/kalman_filter.hpp>
+#include <kalman_filter/kalman_filter_n.hpp>
 
 #include <string>
 
@@ -29,14 +29,17 @@ private:
   rclcpp::Logger logger_;
 
 private:
-  KalmanFilter ekf_;
-  rclcpp::Time last_update_time_;
   enum IDX { X = 0, Y = 1, VX = 2, VY = 3, AX = 4, AY = 5 };
+  static constexpr int DIM_X = 6;
+  using Ekf = KalmanFilterN<DIM_X>;
+  using StateVector = Ekf::StateVector;
+  using StateMatrix = Ekf::StateMatrix;
+
+  Ekf ekf_;
+  rclcpp::Time last_update_time_;
 
   struct EkfParams
   {
-    // dimension
-    char dim_x = 6;
     // system noise
     double q_cov_ax;
     double q_cov_ay;
@@ -98,7 +101,7 @@ public:
 
   static void loadDefaultModelParameters(const std::string & path);
   bool predict(const rclcpp::Time & time) override;
-  bool predict(const double dt, KalmanFilter & ekf) const;
+  bool predict(const double dt, Ekf & ekf) const;
   bool measure(
     const autoware_auto_perception_msgs::msg::DetectedObject & object, const rclcpp::Time & time,
     const geometry_msgs::msg::Transform & self_transform) override;
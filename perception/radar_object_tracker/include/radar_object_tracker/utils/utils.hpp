@@ -22,6 +22,7 @@
 #include <Eigen/Core>
 #include <Eigen/Dense>
 #include <Eigen/Geometry>
+#include <kalman_filter/kalman_filter_n.hpp>
 
 #include <autoware_auto_perception_msgs/msg/detected_object.hpp>
 #include <autoware_auto_perception_msgs/msg/shape.hpp>
@@ -75,9 +76,55 @@ enum MSG_COV_IDX {
   YAW_YAW = 35
 };
 
-// matrix concatenate
-Eigen::MatrixXd stackMatricesVertically(const std::vector<Eigen::MatrixXd> & matrices);
-Eigen::MatrixXd stackMatricesDiagonally(const std::vector<Eigen::MatrixXd> & matrices);
+/**
+ * @brief measurements stacked in matrices of a fixed maximum size
+ * @details The observation matrices and the measurement vectors are stacked vertically, and the
+ * measurement covariances diagonally, so that building the measurement does not allocate.
+ */
+template <int StateDim, int MaxMeasDim>
+struct StackedMeasurement
+{
+  Eigen::Matrix<double, MaxMeasDim, 1> Y = Eigen::Matrix<double, MaxMeasDim, 1>::Zero();
+  Eigen::Matrix<double, MaxMeasDim, StateDim> C =
+    Eigen::Matrix<double, MaxMeasDim, StateDim>::Zero();
+  Eigen::Matrix<double, MaxMeasDim, MaxMeasDim> R =
+    Eigen::Matrix<double, MaxMeasDim, MaxMeasDim>::Zero();
+  int rows = 0;
+
+  template <int Dim>
+  void add(
+    const Eigen::Matrix<double, Dim, 1> & y, const Eigen::Matrix<double, Dim, StateDim> & c,
+    const Eigen::Matrix<double, Dim, Dim> & r)
+  {
+    static_assert(Dim <= MaxMeasDim);
+    Y.template segment<Dim>(rows) = y;
+    C.template middleRows<Dim>(rows) = c;
+    R.template block<Dim, Dim>(rows, rows) = r;
+    rows += Dim;
+  }
+};
+
+/**
+ * @brief update the kalman filter with the stacked measurements, of the fixed-size dimension of
+ * the number of the stacked rows
+ * @return false if there is no measurement or the update fails
+ */
+template <int Dim = 1, int StateDim, int MaxMeasDim>
+bool updateWithStackedMeasurement(
+  KalmanFilterN<StateDim> & ekf, const StackedMeasurement<StateDim, MaxMeasDim> & measurement)
+{
+  if constexpr (Dim > MaxMeasDim) {
+    return false;
+  } else {
+    if (measurement.rows != Dim) {
+      return updateWithStackedMeasurement<Dim + 1>(ekf, measurement);
+    }
+    const Eigen::Matrix<double, Dim, 1> Y = measurement.Y.template head<Dim>();
+    const Eigen::Matrix<double, Dim, StateDim> C = measurement.C.template topRows<Dim>();
+    const Eigen::Matrix<double, Dim, Dim> R = measurement.R.template topLeftCorner<Dim, Dim>();
+    return ekf.template update<Dim>(Y, C, R);
+  }
+}
 
 }  // namespace utils
 
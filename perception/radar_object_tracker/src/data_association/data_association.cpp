@@ -14,8 +14,6 @@
 
 #include "radar_object_tracker/data_association/data_association.hpp"
 
-#include "radar_object_tracker/data_association/solver/gnn_solver.hpp"
-
 #include <nlohmann/json.hpp>
 
 // #include "multi_object_tracker/utils/utils.hpp"
@@ -25,6 +23,7 @@
 #include <list>
 #include <memory>
 #include <unordered_map>
+#include <utility>
 #include <vector>
 
 namespace
@@ -149,6 +148,97 @@ void DataAssociation::assign(
   }
 }
 
+double DataAssociation::calcScore(
+  const autoware_auto_perception_msgs::msg::DetectedObject & measurement_object,
+  const std::uint8_t measurement_label,
+  const autoware_auto_perception_msgs::msg::TrackedObject & tracked_object,
+  const std::uint8_t tracker_label, nlohmann::json * pair_log_data) const
+{
+  const auto set_gate_log = [pair_log_data](
+                              const char * gate_name, const double gate_value,
+                              const double gate_threshold) {
+    if (pair_log_data) {
+      (*pair_log_data)["gate_name"] = gate_name;
+      (*pair_log_data)["gate_value"] = gate_value;
+      (*pair_log_data)["gate_threshold"] = gate_threshold;
+    }
+  };
+
+  const double max_dist = max_dist_matrix_(tracker_label, measurement_label);
+  const double dist = tier4_autoware_utils::calcDistance2d(
+    measurement_object.kinematics.pose_with_covariance.pose.position,
+    tracked_object.kinematics.pose_with_covariance.pose.position);
+
+  bool passed_gate = true;
+  // dist gate
+  if (passed_gate) {
+    if (max_dist < dist) {
+      passed_gate = false;
+    }
+    set_gate_log("dist gate", dist, max_dist);
+  }
+  // area gate
+  if (passed_gate) {
+    const double max_area = max_area_matrix_(tracker_label, measurement_label);
+    const double min_area = min_area_matrix_(tracker_label, measurement_label);
+    const double area = tier4_autoware_utils::getArea(measurement_object.shape);
+    if (area < min_area || max_area < area) {
+      passed_gate = false;
+    }
+    set_gate_log("area gate", area, max_area);
+  }
+  // angle gate
+  if (passed_gate) {
+    const double max_rad = max_rad_matrix_(tracker_label, measurement_label);
+    const double angle = getFormedYawAngle(
+      measurement_object.kinematics.pose_with_covariance.pose.orientation,
+      tracked_object.kinematics.pose_with_covariance.pose.orientation, false);
+    if (std::fabs(max_rad) < M_PI && std::fabs(max_rad) < std::fabs(angle)) {
+      passed_gate = false;
+    }
+    set_gate_log("angle gate", angle, max_rad);
+  }
+  // mahalanobis dist gate
+  if (passed_gate) {
+    const double mahalanobis_dist = getMahalanobisDistance(
+      measurement_object.kinematics.pose_with_covariance.pose.position,
+      tracked_object.kinematics.pose_with_covariance.pose.position,
+      getXYCovariance(tracked_object.kinematics.pose_with_covariance));
+    if (2.448 /*95%*/ <= mahalanobis_dist) {
+      passed_gate = false;
+    }
+    set_gate_log("mahalanobis dist gate", mahalanobis_dist, 2.448);
+  }
+  // 2d iou gate
+  if (passed_gate) {
+    const double min_iou = min_iou_matrix_(tracker_label, measurement_label);
+    const double min_union_iou_area = 1e-2;
+    const double iou =
+      object_recognition_utils::get2dIoU(measurement_object, tracked_object, min_union_iou_area);
+    if (iou < min_iou) {
+      passed_gate = false;
+    }
+    set_gate_log("2d iou gate", iou, min_iou);
+  }
+
+  // all gate is passed
+  double score = 0.0;
+  if (passed_gate) {
+    if (pair_log_data) {
+      (*pair_log_data)["gate_name"] = "all gate passed";
+    }
+    score = (max_dist - std::min(dist, max_dist)) / max_dist;
+    if (score < score_threshold_) {
+      score = 0.0;
+    }
+  }
+  if (pair_log_data) {
+    (*pair_log_data)["passed_gate"] = passed_gate;
+    (*pair_log_data)["score"] = score;
+  }
+  return score;
+}
+
 Eigen::MatrixXd DataAssociation::calcScoreMatrix(
   const autoware_auto_perception_msgs::msg::DetectedObjects & measurements,
   const std::list<std::shared_ptr<Tracker>> & trackers, const bool debug_log,
@@ -202,83 +292,8 @@ Eigen::MatrixXd DataAssociation::calcScoreMatrix(
 
       double score = 0.0;
       if (can_assign_matrix_(tracker_label, measurement_label)) {
-        const double max_dist = max_dist_matrix_(tracker_label, measurement_label);
-        const double dist = tier4_autoware_utils::calcDistance2d(
-          measurement_object.kinematics.pose_with_covariance.pose.position,
-          tracked_object.kinematics.pose_with_covariance.pose.position);
-
-        bool passed_gate = true;
-        // dist gate
-        if (passed_gate) {
-          if (max_dist < dist) {
-            passed_gate = false;
-          }
-          pair_log_data["gate_name"] = "dist gate";
-          pair_log_data["gate_value"] = dist;
-          pair_log_data["gate_threshold"] = max_dist;
-        }
-        // area gate
-        if (passed_gate) {
-          const double max_area = max_area_matrix_(tracker_label, measurement_label);
-          const double min_area = min_area_matrix_(tracker_label, measurement_label);
-          const double area = tier4_autoware_utils::getArea(measurement_object.shape);
-          if (area < min_area || max_area < area) {
-            passed_gate = false;
-          }
-          pair_log_data["gate_name"] = "area gate";
-          pair_log_data["gate_value"] = area;
-          pair_log_data["gate_threshold"] = max_area;
-        }
-        // angle gate
-        if (passed_gate) {
-          const double max_rad = max_rad_matrix_(tracker_label, measurement_label);
-          const double angle = getFormedYawAngle(
-            measurement_object.kinematics.pose_with_covariance.pose.orientation,
-            tracked_object.kinematics.pose_with_covariance.pose.orientation, false);
-          if (std::fabs(max_rad) < M_PI && std::fabs(max_rad) < std::fabs(angle)) {
-            passed_gate = false;
-          }
-          pair_log_data["gate_name"] = "angle gate";
-          pair_log_data["gate_value"] = angle;
-          pair_log_data["gate_threshold"] = max_rad;
-        }
-        // mahalanobis dist gate
-        if (passed_gate) {
-          const double mahalanobis_dist = getMahalanobisDistance(
-            measurement_object.kinematics.pose_with_covariance.pose.position,
-            tracked_object.kinematics.pose_with_covariance.pose.position,
-            getXYCovariance(tracked_object.kinematics.pose_with_covariance));
-          if (2.448 /*95%*/ <= mahalanobis_dist) {
-            passed_gate = false;
-          }
-          pair_log_data["gate_name"] = "mahalanobis dist gate";
-          pair_log_data["gate_value"] = mahalanobis_dist;
-          pair_log_data["gate_threshold"] = 2.448;
-        }
-        // 2d iou gate
-        if (passed_gate) {
-          const double min_iou = min_iou_matrix_(tracker_label, measurement_label);
-          const double min_union_iou_area = 1e-2;
-          const double iou = object_recognition_utils::get2dIoU(
-            measurement_object, tracked_object, min_union_iou_area);
-          if (iou < min_iou) {
-            passed_gate = false;
-          }
-          pair_log_data["gate_name"] = "2d iou gate";
-          pair_log_data["gate_value"] = iou;
-          pair_log_data["gate_threshold"] = min_iou;
-        }
-
-        // all gate is passed
-        if (passed_gate) {
-          pair_log_data["gate_name"] = "all gate passed";
-          score = (max_dist - std::min(dist, max_dist)) / max_dist;
-          if (score < score_threshold_) {
-            score = 0.0;
-          }
-        }
-        pair_log_data["passed_gate"] = passed_gate;
-        pair_log_data["score"] = score;
+        score = calcScore(
+          measurement_object, measurement_label, tracked_object, tracker_label, &pair_log_data);
         data_array.push_back(pair_log_data);
       }
       score_matrix(tracker_idx, measurement_idx) = score;
@@ -294,3 +309,64 @@ Eigen::MatrixXd DataAssociation::calcScoreMatrix(
 
   return score_matrix;
 }
+
+DataAssociation::SparseScoreMatrix DataAssociation::calcSparseScoreMatrix(
+  const autoware_auto_perception_msgs::msg::DetectedObjects & measurements,
+  const std::list<std::shared_ptr<Tracker>> & trackers)
+{
+  const int num_trackers = static_cast<int>(trackers.size());
+  const int num_measurements = static_cast<int>(measurements.objects.size());
+
+  std::vector<std::uint8_t> measurement_labels(num_measurements);
+  std::vector<double> measurement_xs(num_measurements), measurement_ys(num_measurements);
+  for (int i = 0; i < num_measurements; ++i) {
+    const auto & measurement_object = measurements.objects[i];
+    measurement_labels[i] =
+      object_recognition_utils::getHighestProbLabel(measurement_object.classification);
+    const auto & position = measurement_object.kinematics.pose_with_covariance.pose.position;
+    measurement_xs[i] = position.x;
+    measurement_ys[i] = position.y;
+  }
+
+  // Grid pre-gate: a pair farther than the largest max distance never passes the dist gate
+  const gnn_solver::SpatialGrid grid(max_dist_matrix_.maxCoeff(), measurement_xs, measurement_ys);
+
+  SparseScoreMatrix score_matrix;
+  score_matrix.rows = num_trackers;
+  score_matrix.cols = num_measurements;
+  score_matrix.row_offsets.reserve(num_trackers + 1);
+  score_matrix.row_offsets.push_back(0);
+  std::vector<int> measurement_indices;
+  for (const auto & tracker : trackers) {
+    // The tracker is predicted once, instead of once per measurement
+    const std::uint8_t tracker_label = tracker->getHighestProbLabel();
+    autoware_auto_perception_msgs::msg::TrackedObject tracked_object;
+    tracker->getTrackedObject(measurements.header.stamp, tracked_object);
+
+    const auto & position = tracked_object.kinematics.pose_with_covariance.pose.position;
+    grid.findNeighbors(position.x, position.y, measurement_indices);
+    for (const int measurement_idx : measurement_indices) {
+      const std::uint8_t measurement_label = measurement_labels[measurement_idx];
+      if (!can_assign_matrix_(tracker_label, measurement_label)) {
+        continue;
+      }
+      const double score = calcScore(
+        measurements.objects[measurement_idx], measurement_label, tracked_object, tracker_label,
+        nullptr);
+      if (score > 0.0) {
+        score_matrix.col_indices.push_back(measurement_idx);
+        score_matrix.values.push_back(score);
+      }
+    }
+    score_matrix.row_offsets.push_back(static_cast<int>(score_matrix.col_indices.size()));
+  }
+  return score_matrix;
+}
+
+void DataAssociation::assignSparse(
+  const SparseScoreMatrix & src, std::unordered_map<int, int> & direct_assignment,
+  std::unordered_map<int, int> & reverse_assignment)
+{
+  gnn_solver_ptr_->maximizeSparseLinearAssignment(
+    src, score_threshold_, 1, &direct_assignment, &reverse_assignment);
+}
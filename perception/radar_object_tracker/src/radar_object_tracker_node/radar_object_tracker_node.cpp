@@ -26,9 +26,11 @@
 #include <tf2_ros/create_timer_interface.h>
 #include <tf2_ros/create_timer_ros.h>
 
+#include <algorithm>
 #include <iterator>
 #include <list>
 #include <memory>
+#include <set>
 #include <string>
 #include <unordered_map>
 #include <utility>
@@ -120,18 +122,10 @@ bool checkCloseLaneletCondition(
 }
 
 lanelet::ConstLanelets getClosestValidLanelets(
-  const TrackedObject & object, const lanelet::LaneletMapPtr & lanelet_map_ptr,
+  const TrackedObject & object,
+  const std::vector<std::pair<double, lanelet::Lanelet>> & surrounding_lanelets,
   const double max_distance_from_lane, const double max_angle_diff_from_lane)
 {
-  // obstacle point
-  lanelet::BasicPoint2d search_point(
-    object.kinematics.pose_with_covariance.pose.position.x,
-    object.kinematics.pose_with_covariance.pose.position.y);
-
-  // nearest lanelet
-  std::vector<std::pair<double, lanelet::Lanelet>> surrounding_lanelets =
-    lanelet::geometry::findNearest(lanelet_map_ptr->laneletLayer, search_point, 10);
-
   // No Closest Lanelets
   if (surrounding_lanelets.empty()) {
     return {};
@@ -278,6 +272,7 @@ void RadarObjectTrackerNode::onMap(const HADMapBin::ConstSharedPtr msg)
   lanelet::utils::conversion::fromBinMsg(
     *msg, lanelet_map_ptr_, &traffic_rules_ptr_, &routing_graph_ptr_);
   RCLCPP_INFO(get_logger(), "[Radar Object Tracker]: Map is loaded");
+  nearest_lanelets_cache_.clear();
   map_is_loaded_ = true;
 }
 
@@ -304,10 +299,17 @@ void RadarObjectTrackerNode::onMeasurement(
 
   /* global nearest neighbor */
   std::unordered_map<int, int> direct_assignment, reverse_assignment;
-  Eigen::MatrixXd score_matrix = data_association_->calcScoreMatrix(
-    transformed_objects, list_tracker_,  // row : tracker, col : measurement
-    logging_.enable, logging_.path);
-  data_association_->assign(score_matrix, direct_assignment, reverse_assignment);
+  if (logging_.enable) {
+    // the log has the gate results of every pair of the labels which can be assigned
+    Eigen::MatrixXd score_matrix = data_association_->calcScoreMatrix(
+      transformed_objects, list_tracker_,  // row : tracker, col : measurement
+      logging_.enable, logging_.path);
+    data_association_->assign(score_matrix, direct_assignment, reverse_assignment);
+  } else {
+    const auto score_matrix = data_association_->calcSparseScoreMatrix(
+      transformed_objects, list_tracker_);  // row : tracker, col : measurement
+    data_association_->assignSparse(score_matrix, direct_assignment, reverse_assignment);
+  }
 
   /* tracker measurement update */
   int tracker_idx = 0;
@@ -420,15 +422,59 @@ void RadarObjectTrackerNode::checkTrackerLifeCycle(
   }
 }
 
+const std::vector<std::pair<double, lanelet::Lanelet>> &
+RadarObjectTrackerNode::getNearestLanelets(
+  const std::shared_ptr<Tracker> & tracker, const TrackedObject & object)
+{
+  // distance the tracker can move before its nearest lanelets are searched again
+  constexpr double max_cache_distance = 1.0;
+
+  const lanelet::BasicPoint2d search_point(
+    object.kinematics.pose_with_covariance.pose.position.x,
+    object.kinematics.pose_with_covariance.pose.position.y);
+  auto & nearest_lanelets = nearest_lanelets_cache_[tracker->getUUID().uuid];
+  if (
+    !nearest_lanelets.lanelets.empty() &&
+    (search_point - nearest_lanelets.search_point).norm() < max_cache_distance) {
+    // the candidates are kept, and only their distances are updated
+    for (auto & lanelet : nearest_lanelets.lanelets) {
+      lanelet.first = lanelet::geometry::distance2d(lanelet.second, search_point);
+    }
+    std::sort(
+      nearest_lanelets.lanelets.begin(), nearest_lanelets.lanelets.end(),
+      [](const auto & a, const auto & b) { return a.first < b.first; });
+    return nearest_lanelets.lanelets;
+  }
+
+  nearest_lanelets.search_point = search_point;
+  nearest_lanelets.lanelets =
+    lanelet::geometry::findNearest(lanelet_map_ptr_->laneletLayer, search_point, 10);
+  return nearest_lanelets.lanelets;
+}
+
 // remove objects by lanelet information
 void RadarObjectTrackerNode::mapBasedNoiseFilter(
   std::list<std::shared_ptr<Tracker>> & list_tracker, const rclcpp::Time & time)
 {
+  // drop the cached lanelets of the removed trackers
+  std::set<std::array<uint8_t, 16>> tracker_uuids;
+  for (const auto & tracker : list_tracker) {
+    tracker_uuids.insert(tracker->getUUID().uuid);
+  }
+  for (auto itr = nearest_lanelets_cache_.begin(); itr != nearest_lanelets_cache_.end();) {
+    if (tracker_uuids.count(itr->first) == 0) {
+      itr = nearest_lanelets_cache_.erase(itr);
+    } else {
+      ++itr;
+    }
+  }
+
   for (auto itr = list_tracker.begin(); itr != list_tracker.end(); ++itr) {
     autoware_auto_perception_msgs::msg::TrackedObject object;
     (*itr)->getTrackedObject(time, object);
     const auto closest_lanelets = getClosestValidLanelets(
-      object, lanelet_map_ptr_, max_distance_from_lane_, max_angle_diff_from_lane_);
+      object, getNearestLanelets(*itr, object), max_distance_from_lane_,
+      max_angle_diff_from_lane_);
 
     // 1. If the object is not close to any lanelet, delete the tracker
     const bool no_closest_lanelet = closest_lanelets.empty();
@@ -471,13 +517,31 @@ void RadarObjectTrackerNode::sanitizeTracker(
   constexpr float min_iou = 0.1;
   constexpr float min_iou_for_unknown_object = 0.001;
   constexpr double distance_threshold = 5.0;
+  // predict each tracker once, instead of once for every pair
+  std::vector<std::list<std::shared_ptr<Tracker>>::iterator> itrs;
+  std::vector<TrackedObject> objects;
+  itrs.reserve(list_tracker.size());
+  objects.reserve(list_tracker.size());
+  for (auto itr = list_tracker.begin(); itr != list_tracker.end(); ++itr) {
+    itrs.push_back(itr);
+    objects.emplace_back();
+    (*itr)->getTrackedObject(time, objects.back());
+  }
+  std::vector<bool> is_deleted(itrs.size(), false);
+
   /* delete collision tracker */
-  for (auto itr1 = list_tracker.begin(); itr1 != list_tracker.end(); ++itr1) {
-    autoware_auto_perception_msgs::msg::TrackedObject object1;
-    (*itr1)->getTrackedObject(time, object1);
-    for (auto itr2 = std::next(itr1); itr2 != list_tracker.end(); ++itr2) {
-      autoware_auto_perception_msgs::msg::TrackedObject object2;
-      (*itr2)->getTrackedObject(time, object2);
+  for (size_t i = 0; i < itrs.size(); ++i) {
+    if (is_deleted[i]) {
+      continue;
+    }
+    const auto & itr1 = itrs[i];
+    const auto & object1 = objects[i];
+    for (size_t j = i + 1; j < itrs.size(); ++j) {
+      if (is_deleted[j]) {
+        continue;
+      }
+      const auto & itr2 = itrs[j];
+      const auto & object2 = objects[j];
       const double distance = std::hypot(
         object1.kinematics.pose_with_covariance.pose.position.x -
           object2.kinematics.pose_with_covariance.pose.position.x,
@@ -521,15 +585,19 @@ void RadarObjectTrackerNode::sanitizeTracker(
       }
 
       if (should_delete_tracker1) {
-        itr1 = list_tracker.erase(itr1);
-        --itr1;
+        is_deleted[i] = true;
         break;
       } else if (should_delete_tracker2) {
-        itr2 = list_tracker.erase(itr2);
-        --itr2;
+        is_deleted[j] = true;
       }
     }
   }
+
+  for (size_t i = 0; i < itrs.size(); ++i) {
+    if (is_deleted[i]) {
+      list_tracker.erase(itrs[i]);
+    }
+  }
 }
 
 inline bool RadarObjectTrackerNode::shouldTrackerPublish(
@@ -76,7 +76,7 @@ ConstantTurnRateMotionTracker::ConstantTurnRateMotionTracker(
   cylinder_ = {0.3, 1.7};
 
   // initialize X matrix and position
-  Eigen::MatrixXd X(ekf_params_.dim_x, 1);
+  StateVector X;
   X(IDX::X) = object.kinematics.pose_with_covariance.pose.position.x;
   X(IDX::Y) = object.kinematics.pose_with_covariance.pose.position.y;
   const auto yaw = tf2::getYaw(object.kinematics.pose_with_covariance.pose.orientation);
@@ -93,7 +93,7 @@ ConstantTurnRateMotionTracker::ConstantTurnRateMotionTracker(
   X(IDX::WZ) = 0.0;
 
   // initialize P matrix
-  Eigen::MatrixXd P = Eigen::MatrixXd::Zero(ekf_params_.dim_x, ekf_params_.dim_x);
+  StateMatrix P = StateMatrix::Zero();
 
   // create rotation matrix to rotate covariance matrix
   const double cos_yaw = std::cos(yaw);
@@ -222,7 +222,7 @@ bool ConstantTurnRateMotionTracker::predict(const rclcpp::Time & time)
   return ret;
 }
 
-bool ConstantTurnRateMotionTracker::predict(const double dt, KalmanFilter & ekf) const
+bool ConstantTurnRateMotionTracker::predict(const double dt, Ekf & ekf) const
 {
   /*  == Nonlinear model ==
    *
@@ -246,8 +246,7 @@ bool ConstantTurnRateMotionTracker::predict(const double dt, KalmanFilter & ekf)
   const double yaw_rate_coeff = assume_zero_yaw_rate_ ? 0.0 : 1.0;
 
   // X t
-  Eigen::MatrixXd X_t(ekf_params_.dim_x, 1);  // predicted state
-  ekf.getX(X_t);
+  const StateVector & X_t = ekf.getX();
   const auto x = X_t(IDX::X);
   const auto y = X_t(IDX::Y);
   const auto yaw = X_t(IDX::YAW);
@@ -255,7 +254,7 @@ bool ConstantTurnRateMotionTracker::predict(const double dt, KalmanFilter & ekf)
   const auto wz = X_t(IDX::WZ);
 
   // X t+1
-  Eigen::MatrixXd X_next_t(ekf_params_.dim_x, 1);
+  StateVector X_next_t;
   X_next_t(IDX::X) = x + vx * std::cos(yaw) * dt;
   X_next_t(IDX::Y) = y + vx * std::sin(yaw) * dt;
   X_next_t(IDX::YAW) = yaw + wz * dt * yaw_rate_coeff;
@@ -263,7 +262,7 @@ bool ConstantTurnRateMotionTracker::predict(const double dt, KalmanFilter & ekf)
   X_next_t(IDX::WZ) = wz * yaw_rate_coeff;
 
   // A: state transition matrix
-  Eigen::MatrixXd A = Eigen::MatrixXd::Identity(ekf_params_.dim_x, ekf_params_.dim_x);
+  StateMatrix A = StateMatrix::Identity();
   A(IDX::X, IDX::YAW) = -vx * std::sin(yaw) * dt;
   A(IDX::Y, IDX::YAW) = vx * std::cos(yaw) * dt;
   A(IDX::X, IDX::VX) = std::cos(yaw) * dt;
@@ -271,14 +270,14 @@ bool ConstantTurnRateMotionTracker::predict(const double dt, KalmanFilter & ekf)
   A(IDX::YAW, IDX::WZ) = dt * yaw_rate_coeff;
 
   // Q: system noise
-  Eigen::MatrixXd Q = Eigen::MatrixXd::Zero(ekf_params_.dim_x, ekf_params_.dim_x);
+  StateMatrix Q = StateMatrix::Zero();
 
   // Rotate the covariance matrix according to the vehicle yaw
   // because q_cov_x and y are in the vehicle coordinate system.
-  Eigen::MatrixXd Q_xy_local = Eigen::MatrixXd::Zero(2, 2);
-  Eigen::MatrixXd Q_xy_global = Eigen::MatrixXd::Zero(2, 2);
+  Eigen::Matrix2d Q_xy_local = Eigen::Matrix2d::Zero();
+  Eigen::Matrix2d Q_xy_global = Eigen::Matrix2d::Zero();
   Q_xy_local << ekf_params_.q_cov_x, 0.0, 0.0, ekf_params_.q_cov_y;
-  Eigen::MatrixXd R = Eigen::MatrixXd::Zero(2, 2);
+  Eigen::Matrix2d R = Eigen::Matrix2d::Zero();
   R << cos(yaw), -sin(yaw), sin(yaw), cos(yaw);
   Q_xy_global = R * Q_xy_local * R.transpose();
   Q.block<2, 2>(IDX::X, IDX::X) = Q_xy_global;
@@ -287,10 +286,6 @@ bool ConstantTurnRateMotionTracker::predict(const double dt, KalmanFilter & ekf)
   Q(IDX::VX, IDX::VX) = ekf_params_.q_cov_vx;
   Q(IDX::WZ, IDX::WZ) = ekf_params_.q_cov_wz;
 
-  // may be unused
-  Eigen::MatrixXd B = Eigen::MatrixXd::Zero(ekf_params_.dim_x, ekf_params_.dim_x);
-  Eigen::MatrixXd u = Eigen::MatrixXd::Zero(ekf_params_.dim_x, 1);
-
   // call kalman filter library
   if (!ekf.predict(X_next_t, A, Q)) {
     RCLCPP_WARN(logger_, "Cannot predict");
@@ -315,9 +310,7 @@ bool ConstantTurnRateMotionTracker::measureWithPose(
   // - measurement covariance: R
 
   // get current state
-  Eigen::MatrixXd X(ekf_params_.dim_x, 1);
-  ekf_.getX(X);
-  const auto yaw_state = X(IDX::YAW);
+  const auto yaw_state = ekf_.getXelement(IDX::YAW);
 
   // rotation matrix
   Eigen::Matrix2d RotationYaw;
@@ -342,27 +335,23 @@ bool ConstantTurnRateMotionTracker::measureWithPose(
   Eigen::Vector2d pose_diff_in_base_link = RotationBaseLink * pose_diff_in_map;
   const auto depth = abs(pose_diff_in_base_link(0));
 
-  // gather matrices as vector
-  std::vector<Eigen::MatrixXd> C_list;
-  std::vector<Eigen::MatrixXd> Y_list;
-  std::vector<Eigen::MatrixXd> R_block_list;
+  // gather matrices
+  utils::StackedMeasurement<DIM_X, 4> measurement;
 
   // 1. add position measurement
   const bool enable_position_measurement = true;  // assume position is always measured
   if (enable_position_measurement) {
-    Eigen::MatrixXd Cxy = Eigen::MatrixXd::Zero(2, ekf_params_.dim_x);
+    Eigen::Matrix<double, 2, DIM_X> Cxy = Eigen::Matrix<double, 2, DIM_X>::Zero();
     Cxy(0, IDX::X) = 1;
     Cxy(1, IDX::Y) = 1;
-    C_list.push_back(Cxy);
 
-    Eigen::MatrixXd Yxy = Eigen::MatrixXd::Zero(2, 1);
+    Eigen::Vector2d Yxy;
     Yxy << object.kinematics.pose_with_covariance.pose.position.x,
       object.kinematics.pose_with_covariance.pose.position.y;
-    Y_list.push_back(Yxy);
 
     // covariance need to be rotated since it is in the vehicle coordinate system
-    Eigen::MatrixXd Rxy_local = Eigen::MatrixXd::Zero(2, 2);
-    Eigen::MatrixXd Rxy = Eigen::MatrixXd::Zero(2, 2);
+    Eigen::Matrix2d Rxy_local = Eigen::Matrix2d::Zero();
+    Eigen::Matrix2d Rxy = Eigen::Matrix2d::Zero();
     if (!object.kinematics.has_position_covariance) {
       // switch noise covariance in polar coordinate or cartesian coordinate
       const auto r_cov_y = use_polar_coordinate_in_measurement_noise_
@@ -378,7 +367,7 @@ bool ConstantTurnRateMotionTracker::measureWithPose(
           .covariance[utils::MSG_COV_IDX::Y_Y];  // xy in vehicle coordinate
       Rxy = RotationYaw * Rxy_local * RotationYaw.transpose();
     }
-    R_block_list.push_back(Rxy);
+    measurement.add<2>(Yxy, Cxy, Rxy);
   }
 
   // 2. add yaw measurement
@@ -387,11 +376,10 @@ bool ConstantTurnRateMotionTracker::measureWithPose(
   const bool enable_yaw_measurement = trust_yaw_input_ && object_has_orientation;
 
   if (enable_yaw_measurement) {
-    Eigen::MatrixXd Cyaw = Eigen::MatrixXd::Zero(1, ekf_params_.dim_x);
+    Eigen::Matrix<double, 1, DIM_X> Cyaw = Eigen::Matrix<double, 1, DIM_X>::Zero();
     Cyaw(0, IDX::YAW) = 1;
-    C_list.push_back(Cyaw);
 
-    Eigen::MatrixXd Yyaw = Eigen::MatrixXd::Zero(1, 1);
+    Eigen::Matrix<double, 1, 1> Yyaw;
     const auto yaw = [&] {
       auto obj_yaw = tier4_autoware_utils::normalizeRadian(
         tf2::getYaw(object.kinematics.pose_with_covariance.pose.orientation));
@@ -405,58 +393,46 @@ bool ConstantTurnRateMotionTracker::measureWithPose(
     }();
 
     Yyaw << yaw;
-    Y_list.push_back(Yyaw);
 
-    Eigen::MatrixXd Ryaw = Eigen::MatrixXd::Zero(1, 1);
+    Eigen::Matrix<double, 1, 1> Ryaw;
     Ryaw << ekf_params_.r_cov_yaw;
-    R_block_list.push_back(Ryaw);
+    measurement.add<1>(Yyaw, Cyaw, Ryaw);
   }
 
   // 3. add linear velocity measurement
   const bool enable_velocity_measurement = object.kinematics.has_twist && trust_twist_input_;
   if (enable_velocity_measurement) {
-    Eigen::MatrixXd C_vx = Eigen::MatrixXd::Zero(1, ekf_params_.dim_x);
+    Eigen::Matrix<double, 1, DIM_X> C_vx = Eigen::Matrix<double, 1, DIM_X>::Zero();
     C_vx(0, IDX::VX) = 1;
-    C_list.push_back(C_vx);
 
     // measure absolute velocity
-    Eigen::MatrixXd Vx = Eigen::MatrixXd::Zero(1, 1);
+    Eigen::Matrix<double, 1, 1> Vx;
     Vx << object.kinematics.twist_with_covariance.twist.linear.x;
 
-    Eigen::Matrix2d R_vx = Eigen::MatrixXd::Zero(1, 1);
+    Eigen::Matrix<double, 1, 1> R_vx;
     if (!object.kinematics.has_twist_covariance) {
       R_vx << ekf_params_.r_cov_vx;
     } else {
       R_vx << object.kinematics.twist_with_covariance.covariance[utils::MSG_COV_IDX::X_X];
     }
-    R_block_list.push_back(R_vx);
+    measurement.add<1>(Vx, C_vx, R_vx);
   }
 
-  // 4. sum up matrices
-  const auto row_number = std::accumulate(
-    C_list.begin(), C_list.end(), 0,
-    [](const auto & sum, const auto & C) { return sum + C.rows(); });
-  if (row_number == 0) {
+  // 4. check the stacked matrices
+  if (measurement.rows == 0) {
     RCLCPP_WARN(logger_, "No measurement is available");
     return false;
   }
 
-  // stacking matrices vertically or diagonally
-  const auto C = utils::stackMatricesVertically(C_list);
-  const auto Y = utils::stackMatricesVertically(Y_list);
-  const auto R = utils::stackMatricesDiagonally(R_block_list);
-
   // 4. EKF update
-  if (!ekf_.update(Y, C, R)) {
+  if (!utils::updateWithStackedMeasurement(ekf_, measurement)) {
     RCLCPP_WARN(logger_, "Cannot update");
   }
 
   // 5. normalize: limit vx
   {
-    Eigen::MatrixXd X_t(ekf_params_.dim_x, 1);
-    Eigen::MatrixXd P_t(ekf_params_.dim_x, ekf_params_.dim_x);
-    ekf_.getX(X_t);
-    ekf_.getP(P_t);
+    StateVector X_t = ekf_.getX();
+    const StateMatrix P_t = ekf_.getP();
     if (!(-max_vx_ <= X_t(IDX::VX) && X_t(IDX::VX) <= max_vx_)) {
       X_t(IDX::VX) = X_t(IDX::VX) < 0 ? -max_vx_ : max_vx_;
     }
@@ -521,15 +497,13 @@ bool ConstantTurnRateMotionTracker::getTrackedObject(
   object.classification = getClassification();
 
   // predict kinematics
-  KalmanFilter tmp_ekf_for_no_update = ekf_;
+  Ekf tmp_ekf_for_no_update = ekf_;
   const double dt = (time - last_update_time_).seconds();
   if (0.001 /*1msec*/ < dt) {
     predict(dt, tmp_ekf_for_no_update);
   }
-  Eigen::MatrixXd X_t(ekf_params_.dim_x, 1);                // predicted state
-  Eigen::MatrixXd P(ekf_params_.dim_x, ekf_params_.dim_x);  // predicted state
-  tmp_ekf_for_no_update.getX(X_t);
-  tmp_ekf_for_no_update.getP(P);
+  const StateVector & X_t = tmp_ekf_for_no_update.getX();  // predicted state
+  const StateMatrix & P = tmp_ekf_for_no_update.getP();    // predicted state
 
   auto & pose_with_cov = object.kinematics.pose_with_covariance;
   auto & twist_with_cov = object.kinematics.twist_with_covariance;
@@ -76,7 +76,7 @@ LinearMotionTracker::LinearMotionTracker(
   cylinder_ = {0.3, 1.7};
 
   // initialize X matrix and position
-  Eigen::MatrixXd X(ekf_params_.dim_x, 1);
+  StateVector X;
   X(IDX::X) = object.kinematics.pose_with_covariance.pose.position.x;
   X(IDX::Y) = object.kinematics.pose_with_covariance.pose.position.y;
   const auto yaw = tf2::getYaw(object.kinematics.pose_with_covariance.pose.orientation);
@@ -96,7 +96,7 @@ LinearMotionTracker::LinearMotionTracker(
   X(IDX::AY) = 0.0;
 
   // initialize P matrix
-  Eigen::MatrixXd P = Eigen::MatrixXd::Zero(ekf_params_.dim_x, ekf_params_.dim_x);
+  StateMatrix P = StateMatrix::Zero();
 
   // create rotation matrix to rotate covariance matrix
   const double cos_yaw = std::cos(yaw);
@@ -251,7 +251,7 @@ bool LinearMotionTracker::predict(const rclcpp::Time & time)
   return ret;
 }
 
-bool LinearMotionTracker::predict(const double dt, KalmanFilter & ekf) const
+bool LinearMotionTracker::predict(const double dt, Ekf & ekf) const
 {
   /*  == Linear model ==
    *
@@ -276,8 +276,7 @@ bool LinearMotionTracker::predict(const double dt, KalmanFilter & ekf) const
   const double acc_coeff = estimate_acc_ ? 1.0 : 0.0;
 
   // X t
-  Eigen::MatrixXd X_t(ekf_params_.dim_x, 1);  // predicted state
-  ekf.getX(X_t);
+  const StateVector & X_t = ekf.getX();
   const auto x = X_t(IDX::X);
   const auto y = X_t(IDX::Y);
   const auto vx = X_t(IDX::VX);
@@ -286,7 +285,7 @@ bool LinearMotionTracker::predict(const double dt, KalmanFilter & ekf) const
   const auto ay = X_t(IDX::AY);
 
   // X t+1
-  Eigen::MatrixXd X_next_t(ekf_params_.dim_x, 1);
+  StateVector X_next_t;
   X_next_t(IDX::X) = x + vx * dt + 0.5 * ax * dt * dt * acc_coeff;
   X_next_t(IDX::Y) = y + vy * dt + 0.5 * ay * dt * dt * acc_coeff;
   X_next_t(IDX::VX) = vx + ax * dt * acc_coeff;
@@ -295,7 +294,7 @@ bool LinearMotionTracker::predict(const double dt, KalmanFilter & ekf) const
   X_next_t(IDX::AY) = ay;
 
   // A: state transition matrix
-  Eigen::MatrixXd A = Eigen::MatrixXd::Identity(ekf_params_.dim_x, ekf_params_.dim_x);
+  StateMatrix A = StateMatrix::Identity();
   A(IDX::X, IDX::VX) = dt;
   A(IDX::Y, IDX::VY) = dt;
   A(IDX::X, IDX::AX) = 0.5 * dt * dt * acc_coeff;
@@ -304,21 +303,21 @@ bool LinearMotionTracker::predict(const double dt, KalmanFilter & ekf) const
   A(IDX::VY, IDX::AY) = dt * acc_coeff;
 
   // Q: system noise
-  Eigen::MatrixXd Q = Eigen::MatrixXd::Zero(ekf_params_.dim_x, ekf_params_.dim_x);
-  Eigen::MatrixXd Q_local = Eigen::MatrixXd::Zero(ekf_params_.dim_x, ekf_params_.dim_x);
+  StateMatrix Q = StateMatrix::Zero();
+  StateMatrix Q_local = StateMatrix::Zero();
 
   // system noise in local coordinate
   // we assume acceleration random walk model
   //
   // Q_local = [dt^3/6 0 dt^2/2 0 dt 0] ^ T q_cov_ax [dt^3/6 0 dt^2/2 0 dt 0]
   //           + [0 dt^3/6 0 dt^2/2 0 dt] ^ T q_cov_ay [0 dt^3/6 0 dt^2/2 0 dt]
-  // Eigen::MatrixXd qx = Eigen::MatrixXd::Zero(ekf_params_.dim_x, 1);
-  // Eigen::MatrixXd qy = Eigen::MatrixXd::Zero(ekf_params_.dim_x, 1);
+  // Eigen::MatrixXd qx = Eigen::MatrixXd::Zero(DIM_X, 1);
+  // Eigen::MatrixXd qy = Eigen::MatrixXd::Zero(DIM_X, 1);
   // qx << dt * dt * dt / 6, 0, dt * dt / 2, 0, dt, 0;
   // qy << 0, dt * dt * dt / 6, 0, dt * dt / 2, 0, dt;
   // Q_local = qx * ekf_params_.q_cov_ax * qx.transpose() + qy * ekf_params_.q_cov_ay *
   // qy.transpose(); just create diag matrix
-  Eigen::VectorXd q_diag_vector = Eigen::VectorXd::Zero(ekf_params_.dim_x);
+  StateVector q_diag_vector = StateVector::Zero();
   q_diag_vector << ekf_params_.q_cov_x, ekf_params_.q_cov_y, ekf_params_.q_cov_vx,
     ekf_params_.q_cov_vy, ekf_params_.q_cov_ax, ekf_params_.q_cov_ay;
   Q_local = q_diag_vector.asDiagonal();
@@ -330,17 +329,14 @@ bool LinearMotionTracker::predict(const double dt, KalmanFilter & ekf) const
   // [R 0 0]             [R^T 0 0]
   // [0 R 0] * Q_local * [0 R^T 0]
   // [0 0 R]             [0 0 R^T]
-  Eigen::MatrixXd R = Eigen::MatrixXd::Zero(2, 2);
+  Eigen::Matrix2d R;
   R << cos(yaw_), -sin(yaw_), sin(yaw_), cos(yaw_);
-  Eigen::MatrixXd RotateCovMatrix = Eigen::MatrixXd::Zero(ekf_params_.dim_x, ekf_params_.dim_x);
+  StateMatrix RotateCovMatrix = StateMatrix::Zero();
   RotateCovMatrix.block<2, 2>(IDX::X, IDX::X) = R;
   RotateCovMatrix.block<2, 2>(IDX::VX, IDX::VX) = R;
   RotateCovMatrix.block<2, 2>(IDX::AX, IDX::AX) = R;
   Q = RotateCovMatrix * Q_local * RotateCovMatrix.transpose();
 
-  Eigen::MatrixXd B = Eigen::MatrixXd::Zero(ekf_params_.dim_x, ekf_params_.dim_x);
-  Eigen::MatrixXd u = Eigen::MatrixXd::Zero(ekf_params_.dim_x, 1);
-
   // call kalman filter library
   if (!ekf.predict(X_next_t, A, Q)) {
     RCLCPP_WARN(logger_, "Cannot predict");
@@ -386,27 +382,23 @@ bool LinearMotionTracker::measureWithPose(
   Eigen::Vector2d pose_diff_in_base_link = RotationBaseLink * pose_diff_in_map;
   const auto depth = abs(pose_diff_in_base_link(0));
 
-  // gather matrices as vector
-  std::vector<Eigen::MatrixXd> C_list;
-  std::vector<Eigen::MatrixXd> Y_list;
-  std::vector<Eigen::MatrixXd> R_block_list;
+  // gather matrices
+  utils::StackedMeasurement<DIM_X, 4> measurement;
 
   // 1. add position measurement
   const bool enable_position_measurement = true;  // assume position is always measured
   if (enable_position_measurement) {
-    Eigen::MatrixXd Cxy = Eigen::MatrixXd::Zero(2, ekf_params_.dim_x);
+    Eigen::Matrix<double, 2, DIM_X> Cxy = Eigen::Matrix<double, 2, DIM_X>::Zero();
     Cxy(0, IDX::X) = 1;
     Cxy(1, IDX::Y) = 1;
-    C_list.push_back(Cxy);
 
-    Eigen::MatrixXd Yxy = Eigen::MatrixXd::Zero(2, 1);
+    Eigen::Vector2d Yxy;
     Yxy << object.kinematics.pose_with_covariance.pose.position.x,
       object.kinematics.pose_with_covariance.pose.position.y;
-    Y_list.push_back(Yxy);
 
     // covariance need to be rotated since it is in the vehicle coordinate system
-    Eigen::MatrixXd Rxy_local = Eigen::MatrixXd::Zero(2, 2);
-    Eigen::MatrixXd Rxy = Eigen::MatrixXd::Zero(2, 2);
+    Eigen::Matrix2d Rxy_local = Eigen::Matrix2d::Zero();
+    Eigen::Matrix2d Rxy = Eigen::Matrix2d::Zero();
     if (!object.kinematics.has_position_covariance) {
       // switch noise covariance in polar coordinate or cartesian coordinate
       const auto r_cov_y = use_polar_coordinate_in_measurement_noise_
@@ -422,27 +414,24 @@ bool LinearMotionTracker::measureWithPose(
           .covariance[utils::MSG_COV_IDX::Y_Y];  // xy in vehicle coordinate
       Rxy = RotationYaw * Rxy_local * RotationYaw.transpose();
     }
-    R_block_list.push_back(Rxy);
+    measurement.add<2>(Yxy, Cxy, Rxy);
   }
 
   // 2. add linear velocity measurement
   const bool enable_velocity_measurement = object.kinematics.has_twist && trust_twist_input_;
   if (enable_velocity_measurement) {
-    Eigen::MatrixXd C_vx_vy = Eigen::MatrixXd::Zero(2, ekf_params_.dim_x);
+    Eigen::Matrix<double, 2, DIM_X> C_vx_vy = Eigen::Matrix<double, 2, DIM_X>::Zero();
     C_vx_vy(0, IDX::VX) = 1;
     C_vx_vy(1, IDX::VY) = 1;
-    C_list.push_back(C_vx_vy);
 
     // velocity is in the target vehicle coordinate system
-    Eigen::MatrixXd Vxy_local = Eigen::MatrixXd::Zero(2, 1);
-    Eigen::MatrixXd Vxy = Eigen::MatrixXd::Zero(2, 1);
+    Eigen::Vector2d Vxy_local;
     Vxy_local << object.kinematics.twist_with_covariance.twist.linear.x,
       object.kinematics.twist_with_covariance.twist.linear.y;
-    Vxy = RotationYaw * Vxy_local;
-    Y_list.push_back(Vxy);
+    const Eigen::Vector2d Vxy = RotationYaw * Vxy_local;
 
-    Eigen::Matrix2d R_v_xy_local = Eigen::MatrixXd::Zero(2, 2);
-    Eigen::MatrixXd R_v_xy = Eigen::MatrixXd::Zero(2, 2);
+    Eigen::Matrix2d R_v_xy_local = Eigen::Matrix2d::Zero();
+    Eigen::Matrix2d R_v_xy = Eigen::Matrix2d::Zero();
     if (!object.kinematics.has_twist_covariance) {
       R_v_xy_local << ekf_params_.r_cov_vx, 0, 0, ekf_params_.r_cov_vy;
       R_v_xy = RotationBaseLink * R_v_xy_local * RotationBaseLink.transpose();
@@ -451,37 +440,24 @@ bool LinearMotionTracker::measureWithPose(
         0, 0, object.kinematics.twist_with_covariance.covariance[utils::MSG_COV_IDX::Y_Y];
       R_v_xy = RotationYaw * R_v_xy_local * RotationYaw.transpose();
     }
-    R_block_list.push_back(R_v_xy);
+    measurement.add<2>(Vxy, C_vx_vy, R_v_xy);
   }
 
-  // 3. sum up matrices
-  const auto row_number = std::accumulate(
-    C_list.begin(), C_list.end(), 0,
-    [](const auto & sum, const auto & C) { return sum + C.rows(); });
-  if (row_number == 0) {
+  // 3. check the stacked matrices
+  if (measurement.rows == 0) {
     RCLCPP_WARN(logger_, "No measurement is available");
     return false;
   }
-  // Eigen::MatrixXd C = Eigen::MatrixXd::Zero(row_number, ekf_params_.dim_x);
-  // Eigen::MatrixXd Y = Eigen::MatrixXd::Zero(row_number, 1);
-  // Eigen::MatrixXd R = Eigen::MatrixXd::Zero(row_number, row_number);
-
-  // stacking matrices vertically or diagonally
-  const auto C = utils::stackMatricesVertically(C_list);
-  const auto Y = utils::stackMatricesVertically(Y_list);
-  const auto R = utils::stackMatricesDiagonally(R_block_list);
 
   // 4. EKF update
-  if (!ekf_.update(Y, C, R)) {
+  if (!utils::updateWithStackedMeasurement(ekf_, measurement)) {
     RCLCPP_WARN(logger_, "Cannot update");
   }
 
   // 5. normalize: limit vx, vy
   {
-    Eigen::MatrixXd X_t(ekf_params_.dim_x, 1);
-    Eigen::MatrixXd P_t(ekf_params_.dim_x, ekf_params_.dim_x);
-    ekf_.getX(X_t);
-    ekf_.getP(P_t);
+    StateVector X_t = ekf_.getX();
+    const StateMatrix P_t = ekf_.getP();
     if (!(-max_vx_ <= X_t(IDX::VX) && X_t(IDX::VX) <= max_vx_)) {
       X_t(IDX::VX) = X_t(IDX::VX) < 0 ? -max_vx_ : max_vx_;
     }
@@ -496,8 +472,7 @@ bool LinearMotionTracker::measureWithPose(
   const float gain = filter_tau_ / (filter_tau_ + filter_dt_);
   z_ = gain * z_ + (1.0 - gain) * object.kinematics.pose_with_covariance.pose.position.z;
   // get yaw from twist atan
-  Eigen::MatrixXd X_t(ekf_params_.dim_x, 1);
-  ekf_.getX(X_t);
+  const StateVector & X_t = ekf_.getX();
   const auto twist_yaw =
     std::atan2(X_t(IDX::VY), X_t(IDX::VX));  // calc from lateral and longitudinal velocity
   if (trust_yaw_input_) {
@@ -559,15 +534,13 @@ bool LinearMotionTracker::getTrackedObject(
   object.classification = getClassification();
 
   // predict kinematics
-  KalmanFilter tmp_ekf_for_no_update = ekf_;
+  Ekf tmp_ekf_for_no_update = ekf_;
   const double dt = (time - last_update_time_).seconds();
   if (0.001 /*1msec*/ < dt) {
     predict(dt, tmp_ekf_for_no_update);
   }
-  Eigen::MatrixXd X_t(ekf_params_.dim_x, 1);                // predicted state
-  Eigen::MatrixXd P(ekf_params_.dim_x, ekf_params_.dim_x);  // predicted state
-  tmp_ekf_for_no_update.getX(X_t);
-  tmp_ekf_for_no_update.getP(P);
+  const StateVector & X_t = tmp_ekf_for_no_update.getX();  // predicted state
+  const StateMatrix & P = tmp_ekf_for_no_update.getP();    // predicted state
 
   auto & pose_with_cov = object.kinematics.pose_with_covariance;
   auto & twist_with_cov = object.kinematics.twist_with_covariance;
@@ -32,13 +32,19 @@ private:
     const pcl::PointCloud<pcl::PointXYZ> & cluster, const float min_angle, const float max_angle);
   float boostOptimize(
     const pcl::PointCloud<pcl::PointXYZ> & cluster, const float min_angle, const float max_angle);
+  float rotatingCalipersOptimize(
+    const pcl::PointCloud<pcl::PointXYZ> & cluster, const float min_angle, const float max_angle);
 
 public:
   BoundingBoxShapeModel();
   explicit BoundingBoxShapeModel(
-    const boost::optional<ReferenceYawInfo> & ref_yaw_info, bool use_boost_bbox_optimizer = false);
+    const boost::optional<ReferenceYawInfo> & ref_yaw_info, bool use_boost_bbox_optimizer = false,
+    bool use_rotating_calipers = false);
   boost::optional<ReferenceYawInfo> ref_yaw_info_;
   bool use_boost_bbox_optimizer_;
+  // fit the minimum area rectangle, whose sides rest on the convex hull edges, instead of the
+  // angle sweep of the closeness criterion
+  bool use_rotating_calipers_;
 
   ~BoundingBoxShapeModel() {}
 
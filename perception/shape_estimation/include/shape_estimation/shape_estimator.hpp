@@ -25,7 +25,9 @@
 #include <pcl/point_types.h>
 #include <pcl_conversions/pcl_conversions.h>
 
+#include <algorithm>
 #include <string>
+#include <vector>
 
 struct ReferenceYawInfo
 {
@@ -45,6 +47,19 @@ struct ReferenceShapeSizeInfo
   Mode mode;
 };
 
+/** \brief Inputs and outputs of one cluster of ShapeEstimator::estimateShapesAndPoses(). */
+struct ShapeEstimationItem
+{
+  uint8_t label;
+  pcl::PointCloud<pcl::PointXYZ> cluster;
+  boost::optional<ReferenceYawInfo> ref_yaw_info;
+  boost::optional<ReferenceShapeSizeInfo> ref_shape_size_info;
+
+  bool estimated_success{false};
+  autoware_auto_perception_msgs::msg::Shape shape_output;
+  geometry_msgs::msg::Pose pose_output;
+};
+
 class ShapeEstimator
 {
 private:
@@ -64,9 +79,16 @@ private:
   bool use_corrector_;
   bool use_filter_;
   bool use_boost_bbox_optimizer_;
+  bool use_rotating_calipers_;
+  int num_threads_{1};
 
 public:
-  ShapeEstimator(bool use_corrector, bool use_filter, bool use_boost_bbox_optimizer = false);
+  ShapeEstimator(
+    bool use_corrector, bool use_filter, bool use_boost_bbox_optimizer = false,
+    bool use_rotating_calipers = false);
+
+  /** \brief Number of threads of estimateShapesAndPoses(), when built with OpenMP */
+  void setNumThreads(const int num_threads) { num_threads_ = std::max(num_threads, 1); }
 
   virtual ~ShapeEstimator() = default;
 
@@ -76,6 +98,12 @@ public:
     const boost::optional<ReferenceShapeSizeInfo> & ref_shape_size_info,
     autoware_auto_perception_msgs::msg::Shape & shape_output,
     geometry_msgs::msg::Pose & pose_output);
+
+  /**
+   * estimateShapeAndPose() of all the clusters of a frame. The clusters are independent, so they
+   * are estimated in parallel.
+   */
+  void estimateShapesAndPoses(std::vector<ShapeEstimationItem> & items);
 };
 
 #endif  // SHAPE_ESTIMATION__SHAPE_ESTIMATOR_HPP_
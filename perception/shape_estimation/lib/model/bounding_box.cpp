@@ -35,6 +35,7 @@
 
 #include <algorithm>
 #include <cmath>
+#include <limits>
 #include <utility>
 #include <vector>
 
@@ -45,13 +46,16 @@
 constexpr float epsilon = 0.001;
 
 BoundingBoxShapeModel::BoundingBoxShapeModel()
-: ref_yaw_info_(boost::none), use_boost_bbox_optimizer_(false)
+: ref_yaw_info_(boost::none), use_boost_bbox_optimizer_(false), use_rotating_calipers_(false)
 {
 }
 
 BoundingBoxShapeModel::BoundingBoxShapeModel(
-  const boost::optional<ReferenceYawInfo> & ref_yaw_info, bool use_boost_bbox_optimizer)
-: ref_yaw_info_(ref_yaw_info), use_boost_bbox_optimizer_(use_boost_bbox_optimizer)
+  const boost::optional<ReferenceYawInfo> & ref_yaw_info, bool use_boost_bbox_optimizer,
+  bool use_rotating_calipers)
+: ref_yaw_info_(ref_yaw_info),
+  use_boost_bbox_optimizer_(use_boost_bbox_optimizer),
+  use_rotating_calipers_(use_rotating_calipers)
 {
 }
 
@@ -89,7 +93,9 @@ bool BoundingBoxShapeModel::fitLShape(
 
   // Paper : Algo.2 Search-Based Rectangle Fitting
   double theta_star;
-  if (use_boost_bbox_optimizer_) {
+  if (use_rotating_calipers_) {
+    theta_star = rotatingCalipersOptimize(cluster, min_angle, max_angle);
+  } else if (use_boost_bbox_optimizer_) {
     theta_star = boostOptimize(cluster, min_angle, max_angle);
   } else {
     theta_star = optimize(cluster, min_angle, max_angle);
@@ -171,25 +177,17 @@ float BoundingBoxShapeModel::calcClosenessCriterion(
   const float min_c_2 = *std::min_element(C_2.begin(), C_2.end());  // col.3, Algo.4
   const float max_c_2 = *std::max_element(C_2.begin(), C_2.end());  // col.3, Algo.4
 
-  std::vector<float> D_1;  // col.4, Algo.4
-  for (const auto & c_1_element : C_1) {
-    const float v = std::min(max_c_1 - c_1_element, c_1_element - min_c_1);
-    D_1.push_back(v * v);
-  }
-
-  std::vector<float> D_2;  // col.5, Algo.4
-  for (const auto & c_2_element : C_2) {
-    const float v = std::min(max_c_2 - c_2_element, c_2_element - min_c_2);
-    D_2.push_back(v * v);
-  }
   constexpr float d_min = 0.1 * 0.1;
   constexpr float d_max = 0.4 * 0.4;
   float beta = 0;  // col.6, Algo.4
-  for (size_t i = 0; i < D_1.size(); ++i) {
-    if (d_max < std::min(D_1.at(i), D_2.at(i))) {
+  for (size_t i = 0; i < C_1.size(); ++i) {
+    const float v_1 = std::min(max_c_1 - C_1[i], C_1[i] - min_c_1);
+    const float v_2 = std::min(max_c_2 - C_2[i], C_2[i] - min_c_2);
+    const float min_d = std::min(v_1 * v_1, v_2 * v_2);  // col.4 and col.5, Algo.4
+    if (d_max < min_d) {
       continue;
     }
-    const float d = std::max(std::min(D_1.at(i), D_2.at(i)), d_min);
+    const float d = std::max(min_d, d_min);
     beta += 1.0 / d;
   }
   return beta;
@@ -200,13 +198,17 @@ float BoundingBoxShapeModel::optimize(
 {
   std::vector<std::pair<float /*theta*/, float /*q*/>> Q;
   constexpr float angle_resolution = M_PI / 180.0;
+  std::vector<float> C_1;  // col.5, Algo.2
+  std::vector<float> C_2;  // col.6, Algo.2
+  C_1.reserve(cluster.size());
+  C_2.reserve(cluster.size());
   for (float theta = min_angle; theta <= max_angle + epsilon; theta += angle_resolution) {
     Eigen::Vector2f e_1;
     e_1 << std::cos(theta), std::sin(theta);  // col.3, Algo.2
     Eigen::Vector2f e_2;
     e_2 << -std::sin(theta), std::cos(theta);  // col.4, Algo.2
-    std::vector<float> C_1;                    // col.5, Algo.2
-    std::vector<float> C_2;                    // col.6, Algo.2
+    C_1.clear();
+    C_2.clear();
     for (const auto & point : cluster) {
       C_1.push_back(point.x * e_1.x() + point.y * e_1.y());
       C_2.push_back(point.x * e_2.x() + point.y * e_2.y());
@@ -252,3 +254,60 @@ float BoundingBoxShapeModel::boostOptimize(
   float theta_star = min.first;
   return theta_star;
 }
+
+float BoundingBoxShapeModel::rotatingCalipersOptimize(
+  const pcl::PointCloud<pcl::PointXYZ> & cluster, const float min_angle, const float max_angle)
+{
+  std::vector<cv::Point2f> points;
+  points.reserve(cluster.size());
+  for (const auto & point : cluster) {
+    points.emplace_back(point.x, point.y);
+  }
+  std::vector<cv::Point2f> hull;
+  cv::convexHull(points, hull);
+
+  // The minimum area rectangle has a side on a hull edge. Within [min_angle, max_angle], the area
+  // between two edge directions is minimum at one of their ends, so the edge directions in the
+  // range and the range bounds are the only candidates.
+  std::vector<float> candidates{min_angle, max_angle};
+  constexpr float half_pi = M_PI * 0.5;
+  for (size_t i = 0; i < hull.size(); ++i) {
+    const cv::Point2f edge = hull[(i + 1) % hull.size()] - hull[i];
+    if (edge.x == 0.0f && edge.y == 0.0f) {
+      continue;
+    }
+    // the rectangle of an angle is the same for the angle plus k * pi / 2
+    const float edge_angle = std::atan2(edge.y, edge.x);
+    const float first_angle =
+      edge_angle + half_pi * std::ceil((min_angle - edge_angle) / half_pi);
+    for (float theta = first_angle; theta <= max_angle; theta += half_pi) {
+      candidates.push_back(theta);
+    }
+  }
+
+  // Only the hull vertices bound the projections
+  float theta_star = min_angle;
+  float min_area = std::numeric_limits<float>::max();
+  for (const float theta : candidates) {
+    const float cos_theta = std::cos(theta);
+    const float sin_theta = std::sin(theta);
+    float min_c_1 = std::numeric_limits<float>::max();
+    float max_c_1 = std::numeric_limits<float>::lowest();
+    float min_c_2 = std::numeric_limits<float>::max();
+    float max_c_2 = std::numeric_limits<float>::lowest();
+    for (const auto & vertex : hull) {
+      const float c_1 = vertex.x * cos_theta + vertex.y * sin_theta;
+      const float c_2 = -vertex.x * sin_theta + vertex.y * cos_theta;
+      min_c_1 = std::min(min_c_1, c_1);
+      max_c_1 = std::max(max_c_1, c_1);
+      min_c_2 = std::min(min_c_2, c_2);
+      max_c_2 = std::max(max_c_2, c_2);
+    }
+    const float area = (max_c_1 - min_c_1) * (max_c_2 - min_c_2);
+    if (area < min_area) {
+      min_area = area;
+      theta_star = theta;
+    }
+  }
+  return theta_star;
+}
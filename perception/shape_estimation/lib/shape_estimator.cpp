@@ -23,10 +23,12 @@
 
 using Label = autoware_auto_perception_msgs::msg::ObjectClassification;
 
-ShapeEstimator::ShapeEstimator(bool use_corrector, bool use_filter, bool use_boost_bbox_optimizer)
+ShapeEstimator::ShapeEstimator(
+  bool use_corrector, bool use_filter, bool use_boost_bbox_optimizer, bool use_rotating_calipers)
 : use_corrector_(use_corrector),
   use_filter_(use_filter),
-  use_boost_bbox_optimizer_(use_boost_bbox_optimizer)
+  use_boost_bbox_optimizer_(use_boost_bbox_optimizer),
+  use_rotating_calipers_(use_rotating_calipers)
 {
 }
 
@@ -63,6 +65,20 @@ bool ShapeEstimator::estimateShapeAndPose(
   return true;
 }
 
+void ShapeEstimator::estimateShapesAndPoses(std::vector<ShapeEstimationItem> & items)
+{
+  // the cluster sizes vary a lot, so the clusters are handed out one by one
+#ifdef _OPENMP
+#pragma omp parallel for num_threads(num_threads_) schedule(dynamic)
+#endif
+  for (size_t i = 0; i < items.size(); ++i) {
+    auto & item = items[i];
+    item.estimated_success = estimateShapeAndPose(
+      item.label, item.cluster, item.ref_yaw_info, item.ref_shape_size_info, item.shape_output,
+      item.pose_output);
+  }
+}
+
 bool ShapeEstimator::estimateOriginalShapeAndPose(
   const uint8_t label, const pcl::PointCloud<pcl::PointXYZ> & cluster,
   const boost::optional<ReferenceYawInfo> & ref_yaw_info,
@@ -73,7 +89,8 @@ bool ShapeEstimator::estimateOriginalShapeAndPose(
   if (
     label == Label::CAR || label == Label::TRUCK || label == Label::BUS ||
     label == Label::TRAILER || label == Label::MOTORCYCLE || label == Label::BICYCLE) {
-    model_ptr.reset(new BoundingBoxShapeModel(ref_yaw_info, use_boost_bbox_optimizer_));
+    model_ptr.reset(
+      new BoundingBoxShapeModel(ref_yaw_info, use_boost_bbox_optimizer_, use_rotating_calipers_));
   } else if (label == Label::PEDESTRIAN) {
     model_ptr.reset(new CylinderShapeModel());
   } else {
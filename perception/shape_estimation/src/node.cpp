@@ -31,6 +31,8 @@
 
 #include <memory>
 #include <string>
+#include <utility>
+#include <vector>
 
 using Label = autoware_auto_perception_msgs::msg::ObjectClassification;
 
@@ -47,9 +49,12 @@ ShapeEstimationNode::ShapeEstimationNode(const rclcpp::NodeOptions & node_option
   use_vehicle_reference_yaw_ = declare_parameter("use_vehicle_reference_yaw", true);
   use_vehicle_reference_shape_size_ = declare_parameter("use_vehicle_reference_shape_size", true);
   bool use_boost_bbox_optimizer = declare_parameter("use_boost_bbox_optimizer", false);
+  bool use_rotating_calipers_bbox_fitting =
+    declare_parameter("use_rotating_calipers_bbox_fitting", false);
   RCLCPP_INFO(this->get_logger(), "using boost shape estimation : %d", use_boost_bbox_optimizer);
-  estimator_ =
-    std::make_unique<ShapeEstimator>(use_corrector, use_filter, use_boost_bbox_optimizer);
+  estimator_ = std::make_unique<ShapeEstimator>(
+    use_corrector, use_filter, use_boost_bbox_optimizer, use_rotating_calipers_bbox_fitting);
+  estimator_->setNumThreads(declare_parameter("num_threads", 1));
 }
 
 void ShapeEstimationNode::callback(const DetectedObjectsWithFeature::ConstSharedPtr input_msg)
@@ -63,8 +68,12 @@ void ShapeEstimationNode::callback(const DetectedObjectsWithFeature::ConstShared
   DetectedObjectsWithFeature output_msg;
   output_msg.header = input_msg->header;
 
-  // Estimate shape for each object and pack msg
-  for (const auto & feature_object : input_msg->feature_objects) {
+  // Gather the clusters and their references
+  std::vector<ShapeEstimationItem> items;
+  std::vector<size_t> feature_object_indices;
+  items.reserve(input_msg->feature_objects.size());
+  for (size_t i = 0; i < input_msg->feature_objects.size(); ++i) {
+    const auto & feature_object = input_msg->feature_objects[i];
     const auto & object = feature_object.object;
     const auto & label = object.classification.front().label;
     const auto & feature = feature_object.feature;
@@ -72,38 +81,42 @@ void ShapeEstimationNode::callback(const DetectedObjectsWithFeature::ConstShared
                             Label::TRAILER == label;
 
     // convert ros to pcl
-    pcl::PointCloud<pcl::PointXYZ>::Ptr cluster(new pcl::PointCloud<pcl::PointXYZ>);
-    pcl::fromROSMsg(feature.cluster, *cluster);
+    ShapeEstimationItem item;
+    item.label = label;
+    pcl::fromROSMsg(feature.cluster, item.cluster);
 
     // check cluster data
-    if (cluster->empty()) {
+    if (item.cluster.empty()) {
       continue;
     }
 
-    // estimate shape and pose
-    autoware_auto_perception_msgs::msg::Shape shape;
-    geometry_msgs::msg::Pose pose;
-    boost::optional<ReferenceYawInfo> ref_yaw_info = boost::none;
-    boost::optional<ReferenceShapeSizeInfo> ref_shape_size_info = boost::none;
     if (use_vehicle_reference_yaw_ && is_vehicle) {
-      ref_yaw_info = ReferenceYawInfo{
+      item.ref_yaw_info = ReferenceYawInfo{
         static_cast<float>(tf2::getYaw(object.kinematics.pose_with_covariance.pose.orientation)),
         tier4_autoware_utils::deg2rad(10)};
     }
     if (use_vehicle_reference_shape_size_ && is_vehicle) {
-      ref_shape_size_info = ReferenceShapeSizeInfo{object.shape, ReferenceShapeSizeInfo::Mode::Min};
+      item.ref_shape_size_info =
+        ReferenceShapeSizeInfo{object.shape, ReferenceShapeSizeInfo::Mode::Min};
     }
-    const bool estimated_success = estimator_->estimateShapeAndPose(
-      label, *cluster, ref_yaw_info, ref_shape_size_info, shape, pose);
+    items.push_back(std::move(item));
+    feature_object_indices.push_back(i);
+  }
+
+  // estimate shape and pose of all the clusters
+  estimator_->estimateShapesAndPoses(items);
 
+  // Pack msg
+  for (size_t i = 0; i < items.size(); ++i) {
     // If the shape estimation fails, ignore it.
-    if (!estimated_success) {
+    if (!items[i].estimated_success) {
       continue;
     }
 
-    output_msg.feature_objects.push_back(feature_object);
-    output_msg.feature_objects.back().object.shape = shape;
-    output_msg.feature_objects.back().object.kinematics.pose_with_covariance.pose = pose;
+    output_msg.feature_objects.push_back(input_msg->feature_objects[feature_object_indices[i]]);
+    output_msg.feature_objects.back().object.shape = items[i].shape_output;
+    output_msg.feature_objects.back().object.kinematics.pose_with_covariance.pose =
+      items[i].pose_output;
   }
 
   // Publish
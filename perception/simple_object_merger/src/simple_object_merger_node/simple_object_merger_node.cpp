@@ -18,6 +18,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace
@@ -39,28 +40,29 @@ bool update_param(
   return true;
 }
 
-autoware_auto_perception_msgs::msg::DetectedObjects::SharedPtr getTransformedObjects(
-  autoware_auto_perception_msgs::msg::DetectedObjects::ConstSharedPtr objects,
+// Copies the objects into the output in the target frame. The input is shared with the other
+// subscribers and kept for the next cycles, so it is not modified.
+void appendTransformedObjects(
+  const autoware_auto_perception_msgs::msg::DetectedObjects & objects,
   const std::string & target_frame_id,
-  geometry_msgs::msg::TransformStamped::ConstSharedPtr transform)
+  geometry_msgs::msg::TransformStamped::ConstSharedPtr transform,
+  std::vector<autoware_auto_perception_msgs::msg::DetectedObject> & output_objects)
 {
-  autoware_auto_perception_msgs::msg::DetectedObjects::SharedPtr output_objects =
-    std::const_pointer_cast<autoware_auto_perception_msgs::msg::DetectedObjects>(objects);
-
-  if (objects->header.frame_id == target_frame_id) {
-    return output_objects;
-  }
+  const bool is_same_frame = objects.header.frame_id == target_frame_id;
+  for (const auto & object : objects.objects) {
+    output_objects.push_back(object);
+    if (is_same_frame) {
+      continue;
+    }
 
-  output_objects->header.frame_id = target_frame_id;
-  for (auto & object : output_objects->objects) {
     // convert by tf
+    auto & pose = output_objects.back().kinematics.pose_with_covariance.pose;
     geometry_msgs::msg::PoseStamped pose_stamped{};
-    pose_stamped.pose = object.kinematics.pose_with_covariance.pose;
+    pose_stamped.pose = pose;
     geometry_msgs::msg::PoseStamped transformed_pose_stamped{};
     tf2::doTransform(pose_stamped, transformed_pose_stamped, *transform);
-    object.kinematics.pose_with_covariance.pose = transformed_pose_stamped.pose;
+    pose = transformed_pose_stamped.pose;
   }
-  return output_objects;
 }
 
 }  // namespace
@@ -165,9 +167,15 @@ void SimpleObjectMergerNode::onTimer()
     return;
   }
 
-  DetectedObjects output_objects;
-  output_objects.header = objects_data_.at(0)->header;
-  output_objects.header.frame_id = node_param_.new_frame_id;
+  auto output_objects = std::make_unique<DetectedObjects>();
+  output_objects->header = objects_data_.at(0)->header;
+  output_objects->header.frame_id = node_param_.new_frame_id;
+
+  size_t num_objects = 0;
+  for (const auto & objects : objects_data_) {
+    num_objects += objects->objects.size();
+  }
+  output_objects->objects.reserve(num_objects);
 
   for (size_t i = 0; i < input_topic_size; i++) {
     double time_diff = rclcpp::Time(objects_data_.at(i)->header.stamp).seconds() -
@@ -177,12 +185,8 @@ void SimpleObjectMergerNode::onTimer()
         node_param_.new_frame_id, objects_data_.at(i)->header.frame_id,
         objects_data_.at(i)->header.stamp, rclcpp::Duration::from_seconds(0.01));
 
-      DetectedObjects::SharedPtr transformed_objects =
-        getTransformedObjects(objects_data_.at(i), node_param_.new_frame_id, transform_);
-
-      output_objects.objects.insert(
-        output_objects.objects.end(), std::begin(transformed_objects->objects),
-        std::end(transformed_objects->objects));
+      appendTransformedObjects(
+        *objects_data_.at(i), node_param_.new_frame_id, transform_, output_objects->objects);
     } else {
       RCLCPP_INFO(
         rclcpp::get_logger("simple_object_merger"), "Topic of %s is timeout by %f sec",
@@ -190,7 +194,7 @@ void SimpleObjectMergerNode::onTimer()
     }
   }
 
-  pub_objects_->publish(output_objects);
+  pub_objects_->publish(std::move(output_objects));
 }
 
 }  // namespace simple_object_merger
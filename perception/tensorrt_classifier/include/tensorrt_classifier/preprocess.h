@@ -178,4 +178,25 @@ extern void multi_scale_resize_bilinear_letterbox_nhwc_to_nchw32_batch_gpu(
   float * dst, unsigned char * src, int d_w, int d_h, int d_c, Roi * d_roi, int s_w, int s_h,
   int s_c, int batch, float norm, cudaStream_t stream);
 
+/**
+ * @brief Optimized preprocessing including crop, resize, letterbox, nhwc2nchw, toFloat and
+ * normalization with mean and std for the regions of interest in a single image on gpus
+ * @param[out] dst processed images, one image for each region of interest
+ * @param[in] src image including all the regions of interest
+ * @param[in] d_w width for output
+ * @param[in] d_h height for output
+ * @param[in] d_c channel for output
+ * @param[in] d_roi regions of interest for cropping
+ * @param[in] s_w width for input
+ * @param[in] s_h height for input
+ * @param[in] s_c channel for input
+ * @param[in] batch number of regions of interest
+ * @param[in] d_mean mean for each channel
+ * @param[in] d_inv_std inverse of std for each channel
+ * @param[in] stream cuda stream
+ */
+extern void crop_resize_bilinear_letterbox_nhwc_to_nchw32_batch_normalize_gpu(
+  float * dst, const unsigned char * src, int d_w, int d_h, int d_c, const Roi * d_roi, int s_w,
+  int s_h, int s_c, int batch, const float * d_mean, const float * d_inv_std, cudaStream_t stream);
+
 #endif  // TENSORRT_CLASSIFIER__PREPROCESS_H_
@@ -19,6 +19,7 @@
 #include <cuda_utils/cuda_unique_ptr.hpp>
 #include <cuda_utils/stream_unique_ptr.hpp>
 #include <opencv2/opencv.hpp>
+#include <tensorrt_classifier/preprocess.h>
 #include <tensorrt_common/tensorrt_common.hpp>
 
 #include <memory>
@@ -75,6 +76,26 @@ public:
     const std::vector<cv::Mat> & images, std::vector<int> & results,
     std::vector<float> & probabilities);
 
+  /**
+   * @brief run inference for the regions of interest in an image, with pre-process on GPU
+   * @param[in] image RGB image including all the regions of interest
+   * @param[in] rois regions of interest in the image
+   * @param[out] results class index for each region of interest
+   * @param[out] probabilities probability for each region of interest
+   * @details The image is uploaded to GPU once and all the regions of interest are cropped,
+   * resized and normalized by a single kernel into the input of the engine. They are classified
+   * by one inference for every batch of the engine.
+   */
+  bool doInference(
+    const cv::Mat & image, const std::vector<cv::Rect> & rois, std::vector<int> & results,
+    std::vector<float> & probabilities);
+
+  /**
+   * @brief write the latency histograms of the preprocess, feedforward and layers as CSV
+   * @warning the histograms are only recorded with profile_per_layer of the build config
+   */
+  void writeProfilingReport(std::ostream & out) const;
+
   /**
    * @brief allocate buffer for preprocess on GPU
    * @param[in] width original image width
@@ -98,9 +119,19 @@ private:
    */
   void preprocessGpu(const std::vector<cv::Mat> & images);
 
+  /**
+   * @brief upload an image and the regions of interest in it to GPU
+   * @param[in] image RGB image including all the regions of interest
+   * @param[in] rois regions of interest in the image
+   */
+  void uploadRoiImage(const cv::Mat & image, const std::vector<cv::Rect> & rois);
+
+  /**
+   * @brief run inference and append the results of the batch
+   * @param[in] batch_size number of valid images in the input of the engine
+   */
   bool feedforwardAndDecode(
-    const std::vector<cv::Mat> & images, std::vector<int> & results,
-    std::vector<float> & probabilities);
+    const int batch_size, std::vector<int> & results, std::vector<float> & probabilities);
 
   std::unique_ptr<tensorrt_common::TrtCommon> trt_common_;
 
@@ -118,6 +149,14 @@ private:
   // std for preprocessing
   std::vector<float> std_;
   std::vector<float> inv_std_;
+  // mean and inverse of std on GPU for preprocessing of regions of interest
+  CudaUniquePtr<float[]> mean_d_;
+  CudaUniquePtr<float[]> inv_std_d_;
+  // device buffers for preprocessing of regions of interest
+  CudaUniquePtr<unsigned char[]> roi_image_d_;
+  size_t roi_image_capacity_{0};
+  CudaUniquePtr<Roi[]> roi_d_;
+  size_t roi_capacity_{0};
   // flg for preprocessing on GPU
   bool m_cuda;
   // host buffer for preprocessing on GPU
@@ -594,3 +594,61 @@ void multi_scale_resize_bilinear_letterbox_nhwc_to_nchw32_batch_gpu(
   multi_scale_resize_bilinear_letterbox_nhwc_to_nchw32_batch_kernel<<<
     cuda_gridsize(N), BLOCK, 0, stream>>>(N, dst, src, d_h, d_w, s_h, s_w, d_roi, norm, batch);
 }
+
+__global__ void crop_resize_bilinear_letterbox_nhwc_to_nchw32_batch_normalize_kernel(
+  int N, float * dst_img, const unsigned char * src_img, int dst_h, int dst_w, int src_w,
+  const Roi * d_roi, const float * d_mean, const float * d_inv_std)
+{
+  // one thread for each pixel of each ROI
+  int index = (blockIdx.x + blockIdx.y * gridDim.x) * blockDim.x + threadIdx.x;
+
+  if (index >= N) return;
+  int C = 3;
+  int H = dst_h;
+  int W = dst_w;
+  int w = index % W;
+  int h = (index / W) % H;
+  int b = index / (W * H);
+
+  const Roi roi = d_roi[b];
+  const float scale = fminf(W / (float)roi.w, H / (float)roi.h);
+  const int letter_right = max((int)(scale * roi.w), 1);
+  const int letter_bot = max((int)(scale * roi.h), 1);
+  const bool is_letterbox = (w >= letter_right || h >= letter_bot);
+
+  // same sampling points as cv::resize with INTER_LINEAR
+  float src_x = ((float)w + 0.5f) * roi.w / (float)letter_right - 0.5f;
+  float src_y = ((float)h + 0.5f) * roi.h / (float)letter_bot - 0.5f;
+  src_x = fminf(fmaxf(src_x, 0.0f), (float)(roi.w - 1));
+  src_y = fminf(fmaxf(src_y, 0.0f), (float)(roi.h - 1));
+  const int x0 = (int)src_x;
+  const int y0 = (int)src_y;
+  const int x1 = min(x0 + 1, roi.w - 1);
+  const int y1 = min(y0 + 1, roi.h - 1);
+  const float fx = src_x - x0;
+  const float fy = src_y - y0;
+
+  int stride = src_w * C;
+  const unsigned char * row0 = src_img + (roi.y + y0) * stride + roi.x * C;
+  const unsigned char * row1 = src_img + (roi.y + y1) * stride + roi.x * C;
+  for (int c = 0; c < C; c++) {
+    float value = 0.0f;
+    if (!is_letterbox) {
+      const float top = row0[x0 * C + c] + (row0[x1 * C + c] - row0[x0 * C + c]) * fx;
+      const float bot = row1[x0 * C + c] + (row1[x1 * C + c] - row1[x0 * C + c]) * fx;
+      value = (float)lroundf(top + (bot - top) * fy);
+    }
+    // NCHW
+    int dst_index = w + (W * h) + (W * H * c) + b * (W * H * C);
+    dst_img[dst_index] = (value - d_mean[c]) * d_inv_std[c];
+  }
+}
+
+void crop_resize_bilinear_letterbox_nhwc_to_nchw32_batch_normalize_gpu(
+  float * dst, const unsigned char * src, int d_w, int d_h, int d_c, const Roi * d_roi, int s_w,
+  int s_h, int s_c, int batch, const float * d_mean, const float * d_inv_std, cudaStream_t stream)
+{
+  int N = d_w * d_h * batch;
+  crop_resize_bilinear_letterbox_nhwc_to_nchw32_batch_normalize_kernel<<<
+    cuda_gridsize(N), BLOCK, 0, stream>>>(N, dst, src, d_h, d_w, s_w, d_roi, d_mean, d_inv_std);
+}
@@ -19,6 +19,7 @@
 #include <tensorrt_classifier/preprocess.h>
 
 #include <algorithm>
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <numeric>
@@ -178,6 +179,13 @@ TrtClassifier::TrtClassifier(
   out_prob_d_ = cuda_utils::make_unique<float[]>(out_elem_num_);
   out_prob_h_ = cuda_utils::make_unique_host<float[]>(out_elem_num_, cudaHostAllocPortable);
 
+  mean_d_ = cuda_utils::make_unique<float[]>(mean_.size());
+  inv_std_d_ = cuda_utils::make_unique<float[]>(inv_std_.size());
+  CHECK_CUDA_ERROR(cudaMemcpy(
+    mean_d_.get(), mean_.data(), mean_.size() * sizeof(float), cudaMemcpyHostToDevice));
+  CHECK_CUDA_ERROR(cudaMemcpy(
+    inv_std_d_.get(), inv_std_.data(), inv_std_.size() * sizeof(float), cudaMemcpyHostToDevice));
+
   if (cuda) {
     m_cuda = true;
     h_img_ = NULL;
@@ -348,22 +356,112 @@ bool TrtClassifier::doInference(
   if (!trt_common_->isInitialized()) {
     return false;
   }
+  results.clear();
+  probabilities.clear();
+  const auto start = std::chrono::steady_clock::now();
   preprocess_opt(images);
 
-  return feedforwardAndDecode(images, results, probabilities);
+  const auto preprocess_end = std::chrono::steady_clock::now();
+  const bool ret = feedforwardAndDecode(static_cast<int>(images.size()), results, probabilities);
+  const auto end = std::chrono::steady_clock::now();
+
+  trt_common_->reportStageTime(
+    "preprocess", std::chrono::duration<float, std::milli>(preprocess_end - start).count());
+  trt_common_->reportStageTime(
+    "feedforward", std::chrono::duration<float, std::milli>(end - preprocess_end).count());
+  return ret;
 }
 
-bool TrtClassifier::feedforwardAndDecode(
-  const std::vector<cv::Mat> & images, std::vector<int> & results,
+void TrtClassifier::uploadRoiImage(const cv::Mat & image, const std::vector<cv::Rect> & rois)
+{
+  const size_t image_size = image.total() * image.elemSize();
+  if (roi_image_capacity_ < image_size) {
+    roi_image_d_ = cuda_utils::make_unique<unsigned char[]>(image_size);
+    roi_image_capacity_ = image_size;
+  }
+  if (roi_capacity_ < rois.size()) {
+    roi_d_ = cuda_utils::make_unique<Roi[]>(rois.size());
+    roi_capacity_ = rois.size();
+  }
+
+  std::vector<Roi> rois_h;
+  rois_h.reserve(rois.size());
+  for (const auto & roi : rois) {
+    rois_h.push_back({roi.x, roi.y, roi.width, roi.height});
+  }
+  // the copies from pageable memory return after the host buffers are staged
+  CHECK_CUDA_ERROR(cudaMemcpyAsync(
+    roi_image_d_.get(), image.data, image_size, cudaMemcpyHostToDevice, *stream_));
+  CHECK_CUDA_ERROR(cudaMemcpyAsync(
+    roi_d_.get(), rois_h.data(), rois_h.size() * sizeof(Roi), cudaMemcpyHostToDevice, *stream_));
+}
+
+bool TrtClassifier::doInference(
+  const cv::Mat & image, const std::vector<cv::Rect> & rois, std::vector<int> & results,
   std::vector<float> & probabilities)
 {
+  if (!trt_common_->isInitialized()) {
+    return false;
+  }
+  if (image.type() != CV_8UC3 || !image.isContinuous()) {
+    return false;
+  }
+  const cv::Rect image_rect(0, 0, image.cols, image.rows);
+  for (const auto & roi : rois) {
+    if (roi.empty() || (roi & image_rect) != roi) {
+      return false;
+    }
+  }
   results.clear();
   probabilities.clear();
+  if (rois.empty()) {
+    return true;
+  }
+
+  auto input_dims = trt_common_->getBindingDimensions(0);
+  input_dims.d[0] = batch_size_;
+  trt_common_->setBindingDimensions(0, input_dims);
+  const int input_height = input_dims.d[2];
+  const int input_width = input_dims.d[3];
+
+  float preprocess_time = 0.0;
+  float feedforward_time = 0.0;
+  auto start = std::chrono::steady_clock::now();
+  uploadRoiImage(image, rois);
+
+  bool ret = true;
+  for (size_t offset = 0; ret && offset < rois.size(); offset += batch_size_) {
+    // the rest of the input is left as it is when the batch is not full
+    const int batch_size = static_cast<int>(std::min<size_t>(batch_size_, rois.size() - offset));
+    crop_resize_bilinear_letterbox_nhwc_to_nchw32_batch_normalize_gpu(
+      input_d_.get(), roi_image_d_.get(), input_width, input_height, 3, roi_d_.get() + offset,
+      image.cols, image.rows, 3, batch_size, mean_d_.get(), inv_std_d_.get(), *stream_);
+
+    const auto preprocess_end = std::chrono::steady_clock::now();
+    ret = feedforwardAndDecode(batch_size, results, probabilities);
+    const auto end = std::chrono::steady_clock::now();
+
+    preprocess_time += std::chrono::duration<float, std::milli>(preprocess_end - start).count();
+    feedforward_time += std::chrono::duration<float, std::milli>(end - preprocess_end).count();
+    start = end;
+  }
+
+  trt_common_->reportStageTime("preprocess", preprocess_time);
+  trt_common_->reportStageTime("feedforward", feedforward_time);
+  return ret;
+}
+
+void TrtClassifier::writeProfilingReport(std::ostream & out) const
+{
+  trt_common_->writeProfilingReport(out);
+}
+
+bool TrtClassifier::feedforwardAndDecode(
+  const int batch_size, std::vector<int> & results, std::vector<float> & probabilities)
+{
   std::vector<void *> buffers = {input_d_.get(), out_prob_d_.get()};
   trt_common_->enqueueV2(buffers.data(), *stream_, nullptr);
 
-  int batch_size = static_cast<int>(images.size());
-
   CHECK_CUDA_ERROR(cudaMemcpyAsync(
     out_prob_h_.get(), out_prob_d_.get(), sizeof(float) * out_elem_num_, cudaMemcpyDeviceToHost,
     *stream_));
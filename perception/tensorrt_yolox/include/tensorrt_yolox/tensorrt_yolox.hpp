@@ -130,6 +130,11 @@ public:
    */
   void printProfiling(void);
 
+  /**
+   * @brief write the latency histograms of the preprocess, feedforward and layers as CSV
+   */
+  void writeProfilingReport(std::ostream & out) const;
+
 private:
   /**
    * @brief run preprocess including resizing, letterbox, NHWC2NCHW and toFloat on CPU
@@ -231,6 +236,9 @@ private:
   int batch_size_;
   CudaUniquePtrHost<float[]> out_prob_h_;
 
+  // flag whether the stage times are recorded, with the per-layer profiler
+  bool profile_per_layer_;
+
   // flag whether preprocess are performed on GPU
   bool use_gpu_preprocess_;
   // host buffer for preprocessing on GPU
@@ -244,6 +252,8 @@ private:
 
   int src_width_;
   int src_height_;
+  // batch size of the binding set by preprocessGpu
+  int preprocess_batch_size_{0};
 
   // host pointer for ROI
   CudaUniquePtrHost<Roi[]> roi_h_;
@@ -47,18 +47,43 @@ public:
   explicit TrtYoloXNode(const rclcpp::NodeOptions & node_options);
 
 private:
+  using ObjectsPublisher =
+    rclcpp::Publisher<tier4_perception_msgs::msg::DetectedObjectsWithFeature>::SharedPtr;
+
+  // The topics of a camera and its latest image, with multiple cameras
+  struct Camera
+  {
+    image_transport::Publisher image_pub;
+    ObjectsPublisher objects_pub;
+    image_transport::Subscriber image_sub;
+    sensor_msgs::msg::Image::ConstSharedPtr pending_image;
+  };
+
   void onConnect();
   void onImage(const sensor_msgs::msg::Image::ConstSharedPtr msg);
+  void onCameraImage(const sensor_msgs::msg::Image::ConstSharedPtr msg, std::size_t camera_id);
+  void onBatchTimer();
+  void inferBatch();
+  void publishObjects(
+    const tensorrt_yolox::ObjectArray & yolox_objects, cv_bridge::CvImagePtr in_image_ptr,
+    const ObjectsPublisher & objects_pub, image_transport::Publisher & image_pub);
   bool readLabelFile(const std::string & label_path);
   void replaceLabelMap();
 
   image_transport::Publisher image_pub_;
-  rclcpp::Publisher<tier4_perception_msgs::msg::DetectedObjectsWithFeature>::SharedPtr objects_pub_;
+  ObjectsPublisher objects_pub_;
 
   image_transport::Subscriber image_sub_;
 
   rclcpp::TimerBase::SharedPtr timer_;
 
+  // With num_cameras > 0, the images of all the cameras are batched in a single inference
+  std::vector<Camera> cameras_;
+  rclcpp::Duration batch_window_{0, 0};
+  rclcpp::Time first_pending_time_;
+  std::size_t num_pending_images_{0};
+  rclcpp::TimerBase::SharedPtr batch_timer_;
+
   LabelMap label_map_;
   std::unique_ptr<tensorrt_yolox::TrtYoloX> trt_yolox_;
 };
@@ -20,6 +20,7 @@
 #include <tensorrt_yolox/tensorrt_yolox.hpp>
 
 #include <algorithm>
+#include <chrono>
 #include <functional>
 #include <memory>
 #include <numeric>
@@ -112,6 +113,7 @@ TrtYoloX::TrtYoloX(
   src_height_ = -1;
   norm_factor_ = norm_factor;
   batch_size_ = batch_config[2];
+  profile_per_layer_ = build_config.profile_per_layer;
   if (precision == "int8") {
     if (build_config.clip_value <= 0.0) {
       if (calibration_image_list_path.empty()) {
@@ -302,6 +304,11 @@ void TrtYoloX::printProfiling(void)
   trt_common_->printProfiling();
 }
 
+void TrtYoloX::writeProfilingReport(std::ostream & out) const
+{
+  trt_common_->writeProfilingReport(out);
+}
+
 void TrtYoloX::preprocessGpu(const std::vector<cv::Mat> & images)
 {
   const auto batch_size = images.size();
@@ -326,33 +333,33 @@ void TrtYoloX::preprocessGpu(const std::vector<cv::Mat> & images)
     src_width_ = width;
     src_height_ = height;
   }
-  if (!image_buf_h_) {
+  // The buffers hold the images of the largest batch, so that a batch of another size only
+  // updates the binding dimensions
+  if (!image_buf_h_ || static_cast<int>(batch_size) != preprocess_batch_size_) {
     trt_common_->setBindingDimensions(0, input_dims);
-    scales_.clear();
+    preprocess_batch_size_ = batch_size;
   }
   const float input_height = static_cast<float>(input_dims.d[2]);
   const float input_width = static_cast<float>(input_dims.d[3]);
+  const auto image_size = images[0].cols * images[0].rows * 3;
+  if (!image_buf_h_) {
+    image_buf_h_ = cuda_utils::make_unique_host<unsigned char[]>(
+      image_size * batch_size_, cudaHostAllocWriteCombined);
+    image_buf_d_ = cuda_utils::make_unique<unsigned char[]>(image_size * batch_size_);
+  }
+  scales_.clear();
   int b = 0;
   for (const auto & image : images) {
-    if (!image_buf_h_) {
-      const float scale = std::min(input_width / image.cols, input_height / image.rows);
-      scales_.emplace_back(scale);
-      image_buf_h_ = cuda_utils::make_unique_host<unsigned char[]>(
-        image.cols * image.rows * 3 * batch_size, cudaHostAllocWriteCombined);
-      image_buf_d_ =
-        cuda_utils::make_unique<unsigned char[]>(image.cols * image.rows * 3 * batch_size);
-    }
-    int index = b * image.cols * image.rows * 3;
+    const float scale = std::min(input_width / image.cols, input_height / image.rows);
+    scales_.emplace_back(scale);
+    int index = b * image_size;
     // Copy into pinned memory
-    memcpy(
-      image_buf_h_.get() + index, &image.data[0],
-      image.cols * image.rows * 3 * sizeof(unsigned char));
+    memcpy(image_buf_h_.get() + index, &image.data[0], image_size * sizeof(unsigned char));
     b++;
   }
   // Copy into device memory
   CHECK_CUDA_ERROR(cudaMemcpyAsync(
-    image_buf_d_.get(), image_buf_h_.get(),
-    images[0].cols * images[0].rows * 3 * batch_size * sizeof(unsigned char),
+    image_buf_d_.get(), image_buf_h_.get(), image_size * batch_size * sizeof(unsigned char),
     cudaMemcpyHostToDevice, *stream_));
   // Preprocess on GPU
   resize_bilinear_letterbox_nhwc_to_nchw32_batch_gpu(
@@ -411,18 +418,31 @@ bool TrtYoloX::doInference(const std::vector<cv::Mat> & images, ObjectArrays & o
   if (!trt_common_->isInitialized()) {
     return false;
   }
+  if (images.size() > static_cast<std::size_t>(batch_size_)) {
+    throw std::runtime_error("The number of images exceeds the max batch size of the engine.");
+  }
 
+  const auto start = std::chrono::steady_clock::now();
   if (use_gpu_preprocess_) {
     preprocessGpu(images);
   } else {
     preprocess(images);
   }
-
-  if (needs_output_decode_) {
-    return feedforwardAndDecode(images, objects);
-  } else {
-    return feedforward(images, objects);
+  if (profile_per_layer_) {
+    // The kernels of the GPU preprocess are only attributed to it once they are done
+    cudaStreamSynchronize(*stream_);
   }
+
+  const auto preprocess_end = std::chrono::steady_clock::now();
+  const bool ret = needs_output_decode_ ? feedforwardAndDecode(images, objects)
+                                        : feedforward(images, objects);
+  const auto end = std::chrono::steady_clock::now();
+
+  trt_common_->reportStageTime(
+    "preprocess", std::chrono::duration<float, std::milli>(preprocess_end - start).count());
+  trt_common_->reportStageTime(
+    "feedforward", std::chrono::duration<float, std::milli>(end - preprocess_end).count());
+  return ret;
 }
 
 void TrtYoloX::preprocessWithRoiGpu(
@@ -662,17 +682,26 @@ bool TrtYoloX::doInferenceWithRoi(
   if (!trt_common_->isInitialized()) {
     return false;
   }
+  const auto start = std::chrono::steady_clock::now();
   if (use_gpu_preprocess_) {
     preprocessWithRoiGpu(images, rois);
   } else {
     preprocessWithRoi(images, rois);
   }
-
-  if (needs_output_decode_) {
-    return feedforwardAndDecode(images, objects);
-  } else {
-    return feedforward(images, objects);
+  if (profile_per_layer_) {
+    cudaStreamSynchronize(*stream_);
   }
+
+  const auto preprocess_end = std::chrono::steady_clock::now();
+  const bool ret = needs_output_decode_ ? feedforwardAndDecode(images, objects)
+                                        : feedforward(images, objects);
+  const auto end = std::chrono::steady_clock::now();
+
+  trt_common_->reportStageTime(
+    "preprocess", std::chrono::duration<float, std::milli>(preprocess_end - start).count());
+  trt_common_->reportStageTime(
+    "feedforward", std::chrono::duration<float, std::milli>(end - preprocess_end).count());
+  return ret;
 }
 
 bool TrtYoloX::doMultiScaleInference(
@@ -19,6 +19,7 @@
 #include <autoware_auto_perception_msgs/msg/object_classification.hpp>
 
 #include <algorithm>
+#include <map>
 #include <memory>
 #include <string>
 #include <utility>
@@ -87,6 +88,14 @@ TrtYoloXNode::TrtYoloXNode(const rclcpp::NodeOptions & node_options)
     "calibration_image_list_path", "",
     ("Path to a file which contains path to images."
      "Those images will be used for int8 quantization."));
+  const int num_cameras = declare_parameter_with_description(
+    "num_cameras", 0,
+    ("If positive, the images of this number of cameras are detected in batches by one engine, "
+     "from ~/in/image<i> to ~/out/objects<i> and ~/out/image<i>."));
+  const double batch_window_ms = declare_parameter_with_description(
+    "batch_window_ms", 10.0,
+    ("With num_cameras, the time to wait for the images of the other cameras after the first one "
+     "of a batch"));
 
   if (!readLabelFile(label_path)) {
     RCLCPP_ERROR(this->get_logger(), "Could not find label file");
@@ -98,16 +107,33 @@ TrtYoloXNode::TrtYoloXNode(const rclcpp::NodeOptions & node_options)
     calibration_algorithm, dla_core_id, quantize_first_layer, quantize_last_layer,
     profile_per_layer, clip_value);
 
+  // The batch size of the engine is dynamic up to the number of cameras
+  const int max_batch_size = std::max(1, num_cameras);
+  const tensorrt_common::BatchConfig batch_config{1, max_batch_size, max_batch_size};
   trt_yolox_ = std::make_unique<tensorrt_yolox::TrtYoloX>(
     model_path, precision, label_map_.size(), score_threshold, nms_threshold, build_config,
-    preprocess_on_gpu, calibration_image_list_path);
+    preprocess_on_gpu, calibration_image_list_path, 1.0, "", batch_config);
 
   timer_ =
     rclcpp::create_timer(this, get_clock(), 100ms, std::bind(&TrtYoloXNode::onConnect, this));
 
-  objects_pub_ = this->create_publisher<tier4_perception_msgs::msg::DetectedObjectsWithFeature>(
-    "~/out/objects", 1);
-  image_pub_ = image_transport::create_publisher(this, "~/out/image");
+  if (num_cameras > 0) {
+    cameras_.resize(num_cameras);
+    for (int i = 0; i < num_cameras; ++i) {
+      const auto id = std::to_string(i);
+      cameras_[i].objects_pub =
+        this->create_publisher<tier4_perception_msgs::msg::DetectedObjectsWithFeature>(
+          "~/out/objects" + id, 1);
+      cameras_[i].image_pub = image_transport::create_publisher(this, "~/out/image" + id);
+    }
+    batch_window_ = rclcpp::Duration::from_seconds(batch_window_ms * 1e-3);
+    batch_timer_ = rclcpp::create_timer(
+      this, get_clock(), batch_window_, std::bind(&TrtYoloXNode::onBatchTimer, this));
+  } else {
+    objects_pub_ = this->create_publisher<tier4_perception_msgs::msg::DetectedObjectsWithFeature>(
+      "~/out/objects", 1);
+    image_pub_ = image_transport::create_publisher(this, "~/out/image");
+  }
 
   if (declare_parameter("build_only", false)) {
     RCLCPP_INFO(this->get_logger(), "TensorRT engine file is built and exit.");
@@ -118,6 +144,23 @@ TrtYoloXNode::TrtYoloXNode(const rclcpp::NodeOptions & node_options)
 void TrtYoloXNode::onConnect()
 {
   using std::placeholders::_1;
+  for (std::size_t i = 0; i < cameras_.size(); ++i) {
+    auto & camera = cameras_[i];
+    if (
+      camera.objects_pub->get_subscription_count() == 0 &&
+      camera.objects_pub->get_intra_process_subscription_count() == 0 &&
+      camera.image_pub.getNumSubscribers() == 0) {
+      camera.image_sub.shutdown();
+    } else if (!camera.image_sub) {
+      camera.image_sub = image_transport::create_subscription(
+        this, "~/in/image" + std::to_string(i),
+        std::bind(&TrtYoloXNode::onCameraImage, this, _1, i), "raw", rmw_qos_profile_sensor_data);
+    }
+  }
+  if (!cameras_.empty()) {
+    return;
+  }
+
   if (
     objects_pub_->get_subscription_count() == 0 &&
     objects_pub_->get_intra_process_subscription_count() == 0 &&
@@ -132,8 +175,6 @@ void TrtYoloXNode::onConnect()
 
 void TrtYoloXNode::onImage(const sensor_msgs::msg::Image::ConstSharedPtr msg)
 {
-  tier4_perception_msgs::msg::DetectedObjectsWithFeature out_objects;
-
   cv_bridge::CvImagePtr in_image_ptr;
   try {
     in_image_ptr = cv_bridge::toCvCopy(msg, sensor_msgs::image_encodings::BGR8);
@@ -141,15 +182,91 @@ void TrtYoloXNode::onImage(const sensor_msgs::msg::Image::ConstSharedPtr msg)
     RCLCPP_ERROR(this->get_logger(), "cv_bridge exception: %s", e.what());
     return;
   }
-  const auto width = in_image_ptr->image.cols;
-  const auto height = in_image_ptr->image.rows;
 
   tensorrt_yolox::ObjectArrays objects;
   if (!trt_yolox_->doInference({in_image_ptr->image}, objects)) {
     RCLCPP_WARN(this->get_logger(), "Fail to inference");
     return;
   }
-  for (const auto & yolox_object : objects.at(0)) {
+  publishObjects(objects.at(0), in_image_ptr, objects_pub_, image_pub_);
+}
+
+void TrtYoloXNode::onCameraImage(
+  const sensor_msgs::msg::Image::ConstSharedPtr msg, std::size_t camera_id)
+{
+  auto & camera = cameras_[camera_id];
+  if (!camera.pending_image) {
+    if (num_pending_images_ == 0) {
+      first_pending_time_ = this->now();
+    }
+    ++num_pending_images_;
+  }
+  // a newer image of the same camera replaces the pending one
+  camera.pending_image = msg;
+  if (num_pending_images_ == cameras_.size()) {
+    inferBatch();
+  }
+}
+
+void TrtYoloXNode::onBatchTimer()
+{
+  if (num_pending_images_ > 0 && this->now() - first_pending_time_ >= batch_window_) {
+    inferBatch();
+  }
+}
+
+void TrtYoloXNode::inferBatch()
+{
+  std::vector<cv_bridge::CvImagePtr> in_image_ptrs(cameras_.size());
+  // The batched preprocess takes images of a single size, so there is one batch per image size
+  std::map<std::pair<int, int>, std::vector<std::size_t>> camera_ids_by_size;
+  for (std::size_t i = 0; i < cameras_.size(); ++i) {
+    auto & camera = cameras_[i];
+    if (!camera.pending_image) {
+      continue;
+    }
+    try {
+      in_image_ptrs[i] =
+        cv_bridge::toCvCopy(camera.pending_image, sensor_msgs::image_encodings::BGR8);
+    } catch (cv_bridge::Exception & e) {
+      RCLCPP_ERROR(this->get_logger(), "cv_bridge exception: %s", e.what());
+    }
+    camera.pending_image.reset();
+    if (in_image_ptrs[i]) {
+      const auto & image = in_image_ptrs[i]->image;
+      camera_ids_by_size[{image.cols, image.rows}].push_back(i);
+    }
+  }
+  num_pending_images_ = 0;
+
+  for (const auto & [size, camera_ids] : camera_ids_by_size) {
+    std::vector<cv::Mat> images;
+    images.reserve(camera_ids.size());
+    for (const auto i : camera_ids) {
+      images.push_back(in_image_ptrs[i]->image);
+    }
+    tensorrt_yolox::ObjectArrays objects;
+    if (!trt_yolox_->doInference(images, objects)) {
+      RCLCPP_WARN(this->get_logger(), "Fail to inference");
+      continue;
+    }
+    for (std::size_t b = 0; b < camera_ids.size(); ++b) {
+      auto & camera = cameras_[camera_ids[b]];
+      publishObjects(
+        objects.at(b), in_image_ptrs[camera_ids[b]], camera.objects_pub, camera.image_pub);
+    }
+  }
+}
+
+void TrtYoloXNode::publishObjects(
+  const tensorrt_yolox::ObjectArray & yolox_objects, cv_bridge::CvImagePtr in_image_ptr,
+  const ObjectsPublisher & objects_pub, image_transport::Publisher & image_pub)
+{
+  tier4_perception_msgs::msg::DetectedObjectsWithFeature out_objects;
+  const auto width = in_image_ptr->image.cols;
+  const auto height = in_image_ptr->image.rows;
+
+  for (const auto & yolox_object : yolox_objects) {
     tier4_perception_msgs::msg::DetectedObjectWithFeature object;
     object.feature.roi.x_offset = yolox_object.x_offset;
     object.feature.roi.y_offset = yolox_object.y_offset;
@@ -169,10 +286,10 @@ void TrtYoloXNode::onImage(const sensor_msgs::msg::Image::ConstSharedPtr msg)
       in_image_ptr->image, cv::Point(left, top), cv::Point(right, bottom), cv::Scalar(0, 0, 255), 3,
       8, 0);
   }
-  image_pub_.publish(in_image_ptr->toImageMsg());
+  image_pub.publish(in_image_ptr->toImageMsg());
 
-  out_objects.header = msg->header;
-  objects_pub_->publish(out_objects);
+  out_objects.header = in_image_ptr->header;
+  objects_pub->publish(out_objects);
 }
 
 bool TrtYoloXNode::readLabelFile(const std::string & label_path)
@@ -25,7 +25,7 @@
 #include <vector>
 
 #define EIGEN_MPL2_ONLY
-#include "tracking_object_merger/data_association/solver/gnn_solver.hpp"
+#include "gnn_solver/gnn_solver.hpp"
 #include "tracking_object_merger/utils/tracker_state.hpp"
 
 #include <Eigen/Core>
@@ -62,6 +62,8 @@ public:
   Eigen::MatrixXd calcScoreMatrix(
     const autoware_auto_perception_msgs::msg::TrackedObjects & objects0,
     const std::vector<TrackerState> & trackers);
+  // largest max distance of the dist gate, beyond which no pair is assigned
+  double getMaxDist() const;
   double calcScoreBetweenObjects(
     const autoware_auto_perception_msgs::msg::TrackedObject & object0,
     const autoware_auto_perception_msgs::msg::TrackedObject & object1) const;
@@ -14,9 +14,10 @@
 
 #include "tracking_object_merger/data_association/data_association.hpp"
 
+#include "gnn_solver/gnn_solver.hpp"
+#include "gnn_solver/spatial_grid.hpp"
 #include "object_recognition_utils/object_recognition_utils.hpp"
 #include "tier4_autoware_utils/geometry/geometry.hpp"
-#include "tracking_object_merger/data_association/solver/gnn_solver.hpp"
 #include "tracking_object_merger/utils/utils.hpp"
 
 #include <algorithm>
@@ -45,6 +46,18 @@ double getFormedYawAngle(
   }
   return std::fabs(fixed_yaw0 - yaw1);
 }
+
+gnn_solver::SpatialGrid buildSpatialGrid(
+  const double cell_size, const autoware_auto_perception_msgs::msg::TrackedObjects & objects)
+{
+  std::vector<double> xs(objects.objects.size()), ys(objects.objects.size());
+  for (size_t idx = 0; idx < objects.objects.size(); ++idx) {
+    const auto & position = objects.objects.at(idx).kinematics.pose_with_covariance.pose.position;
+    xs.at(idx) = position.x;
+    ys.at(idx) = position.y;
+  }
+  return gnn_solver::SpatialGrid(cell_size, xs, ys);
+}
 }  // namespace
 
 DataAssociation::DataAssociation(
@@ -134,9 +147,14 @@ Eigen::MatrixXd DataAssociation::calcScoreMatrix(
 {
   Eigen::MatrixXd score_matrix =
     Eigen::MatrixXd::Zero(objects1.objects.size(), objects0.objects.size());
+  // a pair farther than the largest max distance never passes the dist gate
+  const auto grid = buildSpatialGrid(getMaxDist(), objects0);
+  std::vector<int> objects0_indices;
   for (size_t objects1_idx = 0; objects1_idx < objects1.objects.size(); ++objects1_idx) {
     const auto & object1 = objects1.objects.at(objects1_idx);
-    for (size_t objects0_idx = 0; objects0_idx < objects0.objects.size(); ++objects0_idx) {
+    const auto & position1 = object1.kinematics.pose_with_covariance.pose.position;
+    grid.findNeighbors(position1.x, position1.y, objects0_indices);
+    for (const int objects0_idx : objects0_indices) {
       const auto & object0 = objects0.objects.at(objects0_idx);
       const double score = calcScoreBetweenObjects(object0, object1);
 
@@ -158,10 +176,14 @@ Eigen::MatrixXd DataAssociation::calcScoreMatrix(
   const std::vector<TrackerState> & trackers)
 {
   Eigen::MatrixXd score_matrix = Eigen::MatrixXd::Zero(trackers.size(), objects0.objects.size());
+  const auto grid = buildSpatialGrid(getMaxDist(), objects0);
+  std::vector<int> objects0_indices;
   for (size_t trackers_idx = 0; trackers_idx < trackers.size(); ++trackers_idx) {
     const auto & object1 = trackers.at(trackers_idx).getObject();
 
-    for (size_t objects0_idx = 0; objects0_idx < objects0.objects.size(); ++objects0_idx) {
+    const auto & position1 = object1.kinematics.pose_with_covariance.pose.position;
+    grid.findNeighbors(position1.x, position1.y, objects0_indices);
+    for (const int objects0_idx : objects0_indices) {
       const auto & object0 = objects0.objects.at(objects0_idx);
       const double score = calcScoreBetweenObjects(object0, object1);
 
@@ -171,6 +193,11 @@ Eigen::MatrixXd DataAssociation::calcScoreMatrix(
   return score_matrix;
 }
 
+double DataAssociation::getMaxDist() const
+{
+  return max_dist_matrix_.maxCoeff();
+}
+
 double DataAssociation::calcScoreBetweenObjects(
   const autoware_auto_perception_msgs::msg::TrackedObject & object0,
   const autoware_auto_perception_msgs::msg::TrackedObject & object1) const
@@ -14,14 +14,17 @@
 
 #include "tracking_object_merger/decorative_tracker_merger.hpp"
 
+#include "gnn_solver/spatial_grid.hpp"
+#include "gnn_solver/successive_shortest_path.hpp"
 #include "object_recognition_utils/object_recognition_utils.hpp"
-#include "tracking_object_merger/data_association/solver/successive_shortest_path.hpp"
 #include "tracking_object_merger/utils/utils.hpp"
 
 #include <boost/optional.hpp>
 
+#include <algorithm>
 #include <chrono>
 #include <unordered_map>
+#include <vector>
 
 #define EIGEN_MPL2_ONLY
 #include <Eigen/Core>
@@ -55,12 +58,30 @@ Eigen::MatrixXd calcScoreMatrixForAssociation(
 
   // calc score matrix
   Eigen::MatrixXd score_matrix = Eigen::MatrixXd::Zero(trackers.size(), objects0.objects.size());
+
+  // a pair farther than the largest max distance of all the associations is never assigned
+  double max_dist = 0.0;
+  for (const auto & [name, data_association] : data_association_map) {
+    max_dist = std::max(max_dist, data_association->getMaxDist());
+  }
+  std::vector<double> objects0_xs(objects0.objects.size()), objects0_ys(objects0.objects.size());
+  for (size_t objects0_idx = 0; objects0_idx < objects0.objects.size(); ++objects0_idx) {
+    const auto & position =
+      objects0.objects.at(objects0_idx).kinematics.pose_with_covariance.pose.position;
+    objects0_xs.at(objects0_idx) = position.x;
+    objects0_ys.at(objects0_idx) = position.y;
+  }
+  const gnn_solver::SpatialGrid grid(max_dist, objects0_xs, objects0_ys);
+  std::vector<int> objects0_indices;
+
   for (size_t trackers_idx = 0; trackers_idx < trackers.size(); ++trackers_idx) {
     const auto & tracker_obj = trackers.at(trackers_idx);
     const auto & object1 = tracker_obj.getObject();
     const auto & tracker_state = tracker_obj.getCurrentMeasurementState(current_time);
 
-    for (size_t objects0_idx = 0; objects0_idx < objects0.objects.size(); ++objects0_idx) {
+    const auto & position1 = object1.kinematics.pose_with_covariance.pose.position;
+    grid.findNeighbors(position1.x, position1.y, objects0_indices);
+    for (const int objects0_idx : objects0_indices) {
       const auto & object0 = objects0.objects.at(objects0_idx);
       // switch calc score function by input and trackers measurement state
       // we assume that lidar and radar are exclusive
@@ -60,6 +60,15 @@ public:
     tier4_perception_msgs::msg::TrafficSignalArray & traffic_signals) override;
 
 private:
+  /**
+   * @brief get the image which all the ROI images are cropped from
+   * @param[in] images ROI images
+   * @param[out] source_image image including all the ROIs
+   * @param[out] rois ROIs in the source image
+   * @return false if the ROI images do not share one continuous RGB image
+   */
+  bool getSourceImage(
+    const std::vector<cv::Mat> & images, cv::Mat & source_image, std::vector<cv::Rect> & rois);
   void postProcess(int cls, float prob, tier4_perception_msgs::msg::TrafficSignal & traffic_signal);
   bool readLabelfile(std::string filepath, std::vector<std::string> & labels);
   bool isColorLabel(const std::string label);
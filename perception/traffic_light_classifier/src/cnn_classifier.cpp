@@ -71,6 +71,28 @@ bool CNNClassifier::getTrafficSignals(
     RCLCPP_WARN(node_ptr_->get_logger(), "image number should be equal to traffic signal number!");
     return false;
   }
+
+  // classify all the ROIs by uploading the camera image to GPU once if they are cropped from it
+  cv::Mat source_image;
+  std::vector<cv::Rect> rois;
+  if (getSourceImage(images, source_image, rois)) {
+    std::vector<float> probabilities;
+    std::vector<int> classes;
+    bool res = classifier_->doInference(source_image, rois, classes, probabilities);
+    if (!res || classes.size() != images.size() || probabilities.size() != images.size()) {
+      return false;
+    }
+    for (size_t i = 0; i < images.size(); i++) {
+      postProcess(classes[i], probabilities[i], traffic_signals.signals[i]);
+      /* debug */
+      if (0 < image_pub_.getNumSubscribers()) {
+        cv::Mat debug_image = images[i].clone();
+        outputDebugImage(debug_image, traffic_signals.signals[i]);
+      }
+    }
+    return true;
+  }
+
   std::vector<cv::Mat> image_batch;
   int signal_i = 0;
 
@@ -105,6 +127,29 @@ bool CNNClassifier::getTrafficSignals(
   return true;
 }
 
+bool CNNClassifier::getSourceImage(
+  const std::vector<cv::Mat> & images, cv::Mat & source_image, std::vector<cv::Rect> & rois)
+{
+  if (images.empty()) {
+    return false;
+  }
+  cv::Size whole_size;
+  cv::Point offset;
+  for (const auto & image : images) {
+    if (image.type() != CV_8UC3 || image.datastart != images.front().datastart) {
+      return false;
+    }
+    image.locateROI(whole_size, offset);
+    rois.emplace_back(offset, image.size());
+  }
+  const auto step = images.front().step[0];
+  if (step != static_cast<size_t>(whole_size.width) * images.front().elemSize()) {
+    return false;
+  }
+  source_image = cv::Mat(whole_size, CV_8UC3, const_cast<uchar *>(images.front().datastart), step);
+  return true;
+}
+
 void CNNClassifier::outputDebugImage(
   cv::Mat & debug_image, const tier4_perception_msgs::msg::TrafficSignal & traffic_signal)
 {
@@ -17,7 +17,6 @@
 #include <lanelet2_extension/utility/message_conversion.hpp>
 #include <lanelet2_extension/utility/utilities.hpp>
 #include <lanelet2_extension/visualization/visualization.hpp>
-#include <tier4_autoware_utils/math/normalization.hpp>
 #include <tier4_autoware_utils/math/unit_conversion.hpp>
 
 #include <lanelet2_core/Exceptions.h>
@@ -27,16 +26,18 @@
 #include <tf2/LinearMath/Matrix3x3.h>
 #include <tf2/LinearMath/Transform.h>
 
-#define EIGEN_MPL2_ONLY
-#include <Eigen/Core>
-#include <Eigen/Geometry>
-
 #ifdef ROS_DISTRO_GALACTIC
 #include <tf2_geometry_msgs/tf2_geometry_msgs.h>
 #else
 #include <tf2_geometry_msgs/tf2_geometry_msgs.hpp>
 #endif
 
+#include <algorithm>
+#include <limits>
+#include <memory>
+#include <utility>
+#include <vector>
+
 namespace
 {
 cv::Point2d calcRawImagePointFromPoint3D(
@@ -56,7 +57,7 @@ cv::Point2d calcRawImagePointFromPoint3D(
 void roundInImageFrame(
   const image_geometry::PinholeCameraModel & pinhole_camera_model, cv::Point2d & point)
 {
-  const sensor_msgs::msg::CameraInfo camera_info = pinhole_camera_model.cameraInfo();
+  const sensor_msgs::msg::CameraInfo & camera_info = pinhole_camera_model.cameraInfo();
   point.x =
     std::max(std::min(point.x, static_cast<double>(static_cast<int>(camera_info.width) - 1)), 0.0);
   point.y =
@@ -71,13 +72,37 @@ bool isInDistanceRange(
   return sq_dist < (max_distance_range * max_distance_range);
 }
 
-bool isInAngleRange(const double & tl_yaw, const double & camera_yaw, const double max_angle_range)
+bool isInAngleRange(
+  const tf2::Vector3 & tl_direction, const tf2::Vector3 & camera_direction,
+  const double cos_max_angle_range)
+{
+  // both the directions are unit vectors on the xy plane
+  return tl_direction.dot(camera_direction) > cos_max_angle_range;
+}
+
+tf2::Vector3 getTrafficLightDirection(const lanelet::ConstLineString3d & traffic_light)
 {
-  Eigen::Vector2d vec1, vec2;
-  vec1 << std::cos(tl_yaw), std::sin(tl_yaw);
-  vec2 << std::cos(camera_yaw), std::sin(camera_yaw);
-  const double diff_angle = std::acos(vec1.dot(vec2));
-  return std::fabs(diff_angle) < max_angle_range;
+  // normal of the traffic light from the bottom left to the bottom right, rotated by +90 degree
+  const auto & tl_bl = traffic_light.front();
+  const auto & tl_br = traffic_light.back();
+  const double dx = tl_br.x() - tl_bl.x();
+  const double dy = tl_br.y() - tl_bl.y();
+  const double length = std::hypot(dx, dy);
+  if (length == 0.0) {
+    return tf2::Vector3(0.0, 1.0, 0.0);
+  }
+  return tf2::Vector3(-dy / length, dx / length, 0.0);
+}
+
+tf2::Vector3 getCameraDirection(const tf2::Transform & tf_map2camera)
+{
+  // direction of the z axis of the camera on the xy plane
+  const tf2::Vector3 camera_z_dir = tf_map2camera.getBasis().getColumn(2);
+  const double length = std::hypot(camera_z_dir.x(), camera_z_dir.y());
+  if (length == 0.0) {
+    return tf2::Vector3(1.0, 0.0, 0.0);
+  }
+  return tf2::Vector3(camera_z_dir.x() / length, camera_z_dir.y() / length, 0.0);
 }
 
 bool isInImageFrame(
@@ -228,6 +253,13 @@ void MapBasedDetector::cameraInfoCallback(
   if (tf_map2camera_vec.empty()) {
     tf_map2camera_vec.push_back(tf_map2camera);
   }
+  // the inverse transformations are shared by all the traffic lights
+  const tf2::Transform tf_camera2map = tf_map2camera.inverse();
+  std::vector<tf2::Transform> tf_camera2map_vec;
+  tf_camera2map_vec.reserve(tf_map2camera_vec.size());
+  for (const auto & tf : tf_map2camera_vec) {
+    tf_camera2map_vec.push_back(tf.inverse());
+  }
 
   /*
    * visible_traffic_lights : for each traffic light in map check if in range and in view angle of
@@ -237,11 +269,13 @@ void MapBasedDetector::cameraInfoCallback(
   // If get a route, use only traffic lights on the route.
   if (route_traffic_lights_ptr_ != nullptr) {
     getVisibleTrafficLights(
-      *route_traffic_lights_ptr_, tf_map2camera_vec, pinhole_camera_model, visible_traffic_lights);
+      *route_traffic_lights_ptr_, tf_map2camera_vec, tf_camera2map_vec, pinhole_camera_model,
+      visible_traffic_lights);
     // If don't get a route, use the traffic lights around ego vehicle.
   } else if (all_traffic_lights_ptr_ != nullptr) {
     getVisibleTrafficLights(
-      *all_traffic_lights_ptr_, tf_map2camera_vec, pinhole_camera_model, visible_traffic_lights);
+      *all_traffic_lights_ptr_, tf_map2camera_vec, tf_camera2map_vec, pinhole_camera_model,
+      visible_traffic_lights);
     // This shouldn't run.
   } else {
     return;
@@ -263,11 +297,11 @@ void MapBasedDetector::cameraInfoCallback(
   for (const auto & traffic_light : visible_traffic_lights) {
     tier4_perception_msgs::msg::TrafficLightRoi rough_roi, expect_roi;
     if (!getTrafficLightRoi(
-          tf_map2camera, pinhole_camera_model, traffic_light, expect_roi_cfg, expect_roi)) {
+          tf_camera2map, pinhole_camera_model, traffic_light, expect_roi_cfg, expect_roi)) {
       continue;
     }
     if (!getTrafficLightRoi(
-          tf_map2camera_vec, pinhole_camera_model, traffic_light, config_, rough_roi)) {
+          tf_camera2map_vec, pinhole_camera_model, traffic_light, config_, rough_roi)) {
       continue;
     }
     output_msg.rois.push_back(rough_roi);
@@ -281,7 +315,7 @@ void MapBasedDetector::cameraInfoCallback(
 }
 
 bool MapBasedDetector::getTrafficLightRoi(
-  const tf2::Transform & tf_map2camera,
+  const tf2::Transform & tf_camera2map,
   const image_geometry::PinholeCameraModel & pinhole_camera_model,
   const lanelet::ConstLineString3d traffic_light, const Config & config,
   tier4_perception_msgs::msg::TrafficLightRoi & roi) const
@@ -291,7 +325,7 @@ bool MapBasedDetector::getTrafficLightRoi(
   // for roi.x_offset and roi.y_offset
   {
     tf2::Vector3 map2tl = getTrafficLightTopLeft(traffic_light);
-    tf2::Vector3 camera2tl = tf_map2camera.inverse() * map2tl;
+    tf2::Vector3 camera2tl = tf_camera2map * map2tl;
     // max vibration
     const double max_vibration_x =
       std::sin(config.max_vibration_yaw * 0.5) * camera2tl.z() + config.max_vibration_width * 0.5;
@@ -315,7 +349,7 @@ bool MapBasedDetector::getTrafficLightRoi(
   // for roi.width and roi.height
   {
     tf2::Vector3 map2tl = getTrafficLightBottomRight(traffic_light);
-    tf2::Vector3 camera2tl = tf_map2camera.inverse() * map2tl;
+    tf2::Vector3 camera2tl = tf_camera2map * map2tl;
     // max vibration
     const double max_vibration_x =
       std::sin(config.max_vibration_yaw * 0.5) * camera2tl.z() + config.max_vibration_width * 0.5;
@@ -343,15 +377,15 @@ bool MapBasedDetector::getTrafficLightRoi(
 }
 
 bool MapBasedDetector::getTrafficLightRoi(
-  const std::vector<tf2::Transform> & tf_map2camera_vec,
+  const std::vector<tf2::Transform> & tf_camera2map_vec,
   const image_geometry::PinholeCameraModel & pinhole_camera_model,
   const lanelet::ConstLineString3d traffic_light, const Config & config,
   tier4_perception_msgs::msg::TrafficLightRoi & out_roi) const
 {
   std::vector<tier4_perception_msgs::msg::TrafficLightRoi> rois;
-  for (const auto & tf_map2camera : tf_map2camera_vec) {
+  for (const auto & tf_camera2map : tf_camera2map_vec) {
     tier4_perception_msgs::msg::TrafficLightRoi roi;
-    if (getTrafficLightRoi(tf_map2camera, pinhole_camera_model, traffic_light, config, roi)) {
+    if (getTrafficLightRoi(tf_camera2map, pinhole_camera_model, traffic_light, config, roi)) {
       rois.push_back(roi);
     }
   }
@@ -388,7 +422,7 @@ void MapBasedDetector::mapCallback(
   lanelet::ConstLanelets all_lanelets = lanelet::utils::query::laneletLayer(lanelet_map_ptr_);
   std::vector<lanelet::AutowareTrafficLightConstPtr> all_lanelet_traffic_lights =
     lanelet::utils::query::autowareTrafficLights(all_lanelets);
-  all_traffic_lights_ptr_ = std::make_shared<MapBasedDetector::TrafficLightSet>();
+  MapBasedDetector::TrafficLightSet all_traffic_lights;
   for (auto tl_itr = all_lanelet_traffic_lights.begin(); tl_itr != all_lanelet_traffic_lights.end();
        ++tl_itr) {
     lanelet::AutowareTrafficLightConstPtr tl = *tl_itr;
@@ -398,9 +432,10 @@ void MapBasedDetector::mapCallback(
       if (!lsp.isLineString()) {  // traffic lights must be linestrings
         continue;
       }
-      all_traffic_lights_ptr_->insert(static_cast<lanelet::ConstLineString3d>(lsp));
+      all_traffic_lights.insert(static_cast<lanelet::ConstLineString3d>(lsp));
     }
   }
+  all_traffic_lights_ptr_ = createTrafficLightIndex(all_traffic_lights);
 }
 
 void MapBasedDetector::routeCallback(
@@ -423,7 +458,7 @@ void MapBasedDetector::routeCallback(
   }
   std::vector<lanelet::AutowareTrafficLightConstPtr> route_lanelet_traffic_lights =
     lanelet::utils::query::autowareTrafficLights(route_lanelets);
-  route_traffic_lights_ptr_ = std::make_shared<MapBasedDetector::TrafficLightSet>();
+  MapBasedDetector::TrafficLightSet route_traffic_lights;
   for (auto tl_itr = route_lanelet_traffic_lights.begin();
        tl_itr != route_lanelet_traffic_lights.end(); ++tl_itr) {
     lanelet::AutowareTrafficLightConstPtr tl = *tl_itr;
@@ -433,63 +468,100 @@ void MapBasedDetector::routeCallback(
       if (!lsp.isLineString()) {  // traffic lights must be linestrings
         continue;
       }
-      route_traffic_lights_ptr_->insert(static_cast<lanelet::ConstLineString3d>(lsp));
+      route_traffic_lights.insert(static_cast<lanelet::ConstLineString3d>(lsp));
     }
   }
+  route_traffic_lights_ptr_ = createTrafficLightIndex(route_traffic_lights);
 }
 
-void MapBasedDetector::getVisibleTrafficLights(
-  const MapBasedDetector::TrafficLightSet & all_traffic_lights,
-  const std::vector<tf2::Transform> & tf_map2camera_vec,
-  const image_geometry::PinholeCameraModel & pinhole_camera_model,
-  std::vector<lanelet::ConstLineString3d> & visible_traffic_lights) const
+std::shared_ptr<MapBasedDetector::TrafficLightIndex> MapBasedDetector::createTrafficLightIndex(
+  const MapBasedDetector::TrafficLightSet & traffic_lights)
 {
-  for (const auto & traffic_light : all_traffic_lights) {
+  auto index = std::make_shared<TrafficLightIndex>();
+  std::vector<std::pair<tier4_autoware_utils::Point2d, size_t>> centers;
+  for (const auto & traffic_light : traffic_lights) {
     // some "Traffic Light" are actually not traffic lights
     if (
       traffic_light.hasAttribute("subtype") == false ||
       traffic_light.attribute("subtype").value() == "solid") {
       continue;
     }
-    // traffic light bottom left
-    const auto & tl_bl = traffic_light.front();
-    // traffic light bottom right
-    const auto & tl_br = traffic_light.back();
-    // check distance range
-    tf2::Vector3 tl_center = getTrafficLightCenter(traffic_light);
+    TrafficLightInfo info;
+    info.traffic_light = traffic_light;
+    info.top_left = getTrafficLightTopLeft(traffic_light);
+    info.bottom_right = getTrafficLightBottomRight(traffic_light);
+    info.center = getTrafficLightCenter(traffic_light);
+    info.direction = getTrafficLightDirection(traffic_light);
+    centers.emplace_back(
+      tier4_autoware_utils::Point2d(info.center.x(), info.center.y()),
+      index->traffic_lights.size());
+    index->traffic_lights.push_back(info);
+  }
+  index->rtree = TrafficLightRtree(centers.begin(), centers.end());
+  return index;
+}
+
+void MapBasedDetector::getVisibleTrafficLights(
+  const MapBasedDetector::TrafficLightIndex & all_traffic_lights,
+  const std::vector<tf2::Transform> & tf_map2camera_vec,
+  const std::vector<tf2::Transform> & tf_camera2map_vec,
+  const image_geometry::PinholeCameraModel & pinhole_camera_model,
+  std::vector<lanelet::ConstLineString3d> & visible_traffic_lights) const
+{
+  // query the traffic lights in the detection range of any camera pose
+  const double range = config_.max_detection_range;
+  double min_x = std::numeric_limits<double>::max();
+  double min_y = std::numeric_limits<double>::max();
+  double max_x = std::numeric_limits<double>::lowest();
+  double max_y = std::numeric_limits<double>::lowest();
+  std::vector<tf2::Vector3> camera_directions;
+  camera_directions.reserve(tf_map2camera_vec.size());
+  for (const auto & tf_map2camera : tf_map2camera_vec) {
+    const auto & origin = tf_map2camera.getOrigin();
+    min_x = std::min(min_x, origin.x());
+    min_y = std::min(min_y, origin.y());
+    max_x = std::max(max_x, origin.x());
+    max_y = std::max(max_y, origin.y());
+    camera_directions.push_back(getCameraDirection(tf_map2camera));
+  }
+  const tier4_autoware_utils::Box2d search_box(
+    tier4_autoware_utils::Point2d(min_x - range, min_y - range),
+    tier4_autoware_utils::Point2d(max_x + range, max_y + range));
+  std::vector<size_t> candidates;
+  for (auto itr = all_traffic_lights.rtree.qbegin(boost::geometry::index::intersects(search_box));
+       itr != all_traffic_lights.rtree.qend(); ++itr) {
+    candidates.push_back(itr->second);
+  }
+  // keep the order of the id
+  std::sort(candidates.begin(), candidates.end());
+
+  constexpr double max_angle_range = tier4_autoware_utils::deg2rad(40.0);
+  const double cos_max_angle_range = std::cos(max_angle_range);
+  for (const size_t candidate : candidates) {
+    const auto & info = all_traffic_lights.traffic_lights.at(candidate);
     // for every possible transformation, check if the tl is visible.
     // If under any tf the tl is visible, keep it
-    for (const auto & tf_map2camera : tf_map2camera_vec) {
-      if (!isInDistanceRange(tl_center, tf_map2camera.getOrigin(), config_.max_detection_range)) {
+    for (size_t i = 0; i < tf_map2camera_vec.size(); ++i) {
+      // check distance range
+      if (!isInDistanceRange(info.center, tf_map2camera_vec[i].getOrigin(), range)) {
         continue;
       }
 
       // check angle range
-      const double tl_yaw = tier4_autoware_utils::normalizeRadian(
-        std::atan2(tl_br.y() - tl_bl.y(), tl_br.x() - tl_bl.x()) + M_PI_2);
-      constexpr double max_angle_range = tier4_autoware_utils::deg2rad(40.0);
-
-      // get direction of z axis
-      tf2::Vector3 camera_z_dir(0, 0, 1);
-      tf2::Matrix3x3 camera_rotation_matrix(tf_map2camera.getRotation());
-      camera_z_dir = camera_rotation_matrix * camera_z_dir;
-      double camera_yaw = std::atan2(camera_z_dir.y(), camera_z_dir.x());
-      camera_yaw = tier4_autoware_utils::normalizeRadian(camera_yaw);
-      if (!isInAngleRange(tl_yaw, camera_yaw, max_angle_range)) {
+      if (!isInAngleRange(info.direction, camera_directions[i], cos_max_angle_range)) {
         continue;
       }
 
       // check within image frame
       // cspell: ignore tltl
-      tf2::Vector3 tf_camera2tltl = tf_map2camera.inverse() * getTrafficLightTopLeft(traffic_light);
-      tf2::Vector3 tf_camera2tlbr =
-        tf_map2camera.inverse() * getTrafficLightBottomRight(traffic_light);
+      tf2::Vector3 tf_camera2tltl = tf_camera2map_vec[i] * info.top_left;
+      tf2::Vector3 tf_camera2tlbr = tf_camera2map_vec[i] * info.bottom_right;
       if (
         !isInImageFrame(pinhole_camera_model, tf_camera2tltl) &&
         !isInImageFrame(pinhole_camera_model, tf_camera2tlbr)) {
         continue;
       }
-      visible_traffic_lights.push_back(traffic_light);
+      visible_traffic_lights.push_back(info.traffic_light);
       break;
     }
   }
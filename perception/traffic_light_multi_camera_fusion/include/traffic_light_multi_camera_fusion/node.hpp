@@ -33,6 +33,7 @@
 #include <map>
 #include <memory>
 #include <set>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -44,17 +45,24 @@ namespace mf = message_filters;
 struct FusionRecord
 {
   std_msgs::msg::Header header;
-  sensor_msgs::msg::CameraInfo cam_info;
+  sensor_msgs::msg::CameraInfo::ConstSharedPtr cam_info;
   tier4_perception_msgs::msg::TrafficLightRoi roi;
   tier4_perception_msgs::msg::TrafficSignal signal;
 };
 
+/*
+the received messages are shared instead of copied, since a record array is kept until its
+lifespan expires and is fused again for every message received in the meantime
+*/
 struct FusionRecordArr
 {
   std_msgs::msg::Header header;
-  sensor_msgs::msg::CameraInfo cam_info;
-  tier4_perception_msgs::msg::TrafficLightRoiArray rois;
-  tier4_perception_msgs::msg::TrafficSignalArray signals;
+  sensor_msgs::msg::CameraInfo::ConstSharedPtr cam_info;
+  tier4_perception_msgs::msg::TrafficLightRoiArray::ConstSharedPtr rois;
+  tier4_perception_msgs::msg::TrafficSignalArray::ConstSharedPtr signals;
+  // the index in signals for every traffic light id
+  std::unordered_map<tier4_perception_msgs::msg::TrafficSignal::_traffic_light_id_type, size_t>
+    signal_indices;
 };
 
 bool operator<(const FusionRecordArr & r1, const FusionRecordArr & r2)
@@ -111,7 +119,7 @@ private:
   /*
   the mapping from traffic light id (instance id) to regulatory element id (group id)
   */
-  std::map<lanelet::Id, std::vector<lanelet::Id>> traffic_light_id_to_regulatory_ele_id_;
+  std::unordered_map<lanelet::Id, std::vector<lanelet::Id>> traffic_light_id_to_regulatory_ele_id_;
   /*
   save record arrays by increasing timestamp order.
   use multiset in case there are multiple cameras publishing images at exactly the same time
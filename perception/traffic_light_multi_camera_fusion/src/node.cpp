@@ -20,6 +20,7 @@
 #include <algorithm>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace
@@ -47,8 +48,8 @@ int calVisibleScore(const traffic_light::FusionRecord & record)
   uint32_t y1 = record.roi.roi.y_offset;
   uint32_t y2 = record.roi.roi.y_offset + record.roi.roi.height;
   if (
-    x1 <= boundary || (record.cam_info.width - x2) <= boundary || y1 <= boundary ||
-    (record.cam_info.height - y2) <= boundary) {
+    x1 <= boundary || (record.cam_info->width - x2) <= boundary || y1 <= boundary ||
+    (record.cam_info->height - y2) <= boundary) {
     return 0;
   } else {
     return 1;
@@ -191,8 +192,13 @@ void MultiCameraFusion::trafficSignalRoiCallback(
   Insert the received record array to the table.
   Attention should be payed that this record array might not have the newest timestamp
   */
-  record_arr_set_.insert(
-    FusionRecordArr{cam_info_msg->header, *cam_info_msg, *roi_msg, *signal_msg});
+  FusionRecordArr record_arr{cam_info_msg->header, cam_info_msg, roi_msg, signal_msg, {}};
+  record_arr.signal_indices.reserve(signal_msg->signals.size());
+  for (size_t i = 0; i < signal_msg->signals.size(); ++i) {
+    // keep the first signal of the id as std::find_if did
+    record_arr.signal_indices.emplace(signal_msg->signals[i].traffic_light_id, i);
+  }
+  record_arr_set_.insert(std::move(record_arr));
 
   std::map<IdType, FusionRecord> fused_record_map, grouped_record_map;
   multiCameraFusion(fused_record_map);
@@ -210,6 +216,7 @@ void MultiCameraFusion::mapCallback(
   lanelet::LaneletMapPtr lanelet_map_ptr = std::make_shared<lanelet::LaneletMap>();
 
   lanelet::utils::conversion::fromBinMsg(*input_msg, lanelet_map_ptr);
+  traffic_light_id_to_regulatory_ele_id_.clear();
   lanelet::ConstLanelets all_lanelets = lanelet::utils::query::laneletLayer(lanelet_map_ptr);
   std::vector<lanelet::AutowareTrafficLightConstPtr> all_lanelet_traffic_lights =
     lanelet::utils::query::autowareTrafficLights(all_lanelets);
@@ -265,26 +272,24 @@ void MultiCameraFusion::multiCameraFusion(std::map<IdType, FusionRecord> & fused
       generate fused record result with the saved records
       */
       const FusionRecordArr & record_arr = *it;
-      for (size_t i = 0; i < record_arr.rois.rois.size(); i++) {
-        const RoiType & roi = record_arr.rois.rois[i];
-        auto signal_it = std::find_if(
-          record_arr.signals.signals.begin(), record_arr.signals.signals.end(),
-          [roi](const SignalType & s1) { return roi.traffic_light_id == s1.traffic_light_id; });
+      for (const RoiType & roi : record_arr.rois->rois) {
+        const auto signal_index_it = record_arr.signal_indices.find(roi.traffic_light_id);
         /*
         failed to find corresponding signal. skip it
         */
-        if (signal_it == record_arr.signals.signals.end()) {
+        if (signal_index_it == record_arr.signal_indices.end()) {
           continue;
         }
-        FusionRecord record{record_arr.header, record_arr.cam_info, roi, *signal_it};
+        FusionRecord record{
+          record_arr.header, record_arr.cam_info, roi,
+          record_arr.signals->signals[signal_index_it->second]};
         /*
         if this traffic light is not detected yet or can be updated by higher priority record,
         update it
         */
-        if (
-          fused_record_map.find(roi.traffic_light_id) == fused_record_map.end() ||
-          ::compareRecord(record, fused_record_map[roi.traffic_light_id]) >= 0) {
-          fused_record_map[roi.traffic_light_id] = record;
+        const auto [fused_it, inserted] = fused_record_map.try_emplace(roi.traffic_light_id);
+        if (inserted || ::compareRecord(record, fused_it->second) >= 0) {
+          fused_it->second = std::move(record);
         }
       }
       it++;
@@ -299,10 +304,11 @@ void MultiCameraFusion::groupFusion(
   grouped_record_map.clear();
   for (auto & p : fused_record_map) {
     IdType roi_id = p.second.roi.traffic_light_id;
+    const auto reg_ele_id_it = traffic_light_id_to_regulatory_ele_id_.find(roi_id);
     /*
     this should not happen
     */
-    if (traffic_light_id_to_regulatory_ele_id_.count(roi_id) == 0) {
+    if (reg_ele_id_it == traffic_light_id_to_regulatory_ele_id_.end()) {
       RCLCPP_WARN_STREAM(
         get_logger(), "Found Traffic Light Id = " << roi_id << " which is not defined in Map");
       continue;
@@ -311,13 +317,10 @@ void MultiCameraFusion::groupFusion(
     /*
     keep the best record for every regulatory element id
     */
-    const auto reg_ele_id_vec =
-      traffic_light_id_to_regulatory_ele_id_[p.second.roi.traffic_light_id];
-    for (const auto & reg_ele_id : reg_ele_id_vec) {
-      if (
-        grouped_record_map.count(reg_ele_id) == 0 ||
-        ::compareRecord(p.second, grouped_record_map[reg_ele_id]) >= 0) {
-        grouped_record_map[reg_ele_id] = p.second;
+    for (const auto & reg_ele_id : reg_ele_id_it->second) {
+      const auto [grouped_it, inserted] = grouped_record_map.try_emplace(reg_ele_id);
+      if (inserted || ::compareRecord(p.second, grouped_it->second) >= 0) {
+        grouped_it->second = p.second;
       }
     }
   }
@@ -64,7 +64,13 @@ public:
     std::vector<int> & occlusion_ratios);
 
 private:
-  uint32_t predict(const pcl::PointXYZ & roi_top_left, const pcl::PointXYZ & roi_bottom_right);
+  uint32_t predict(const std::vector<Ray> & tl_sample_rays) const;
+
+  bool isOccluded(const Ray & tl_ray) const;
+
+  void buildRangeImage(
+    const pcl::PointCloud<pcl::PointXYZ> & cloud_roi,
+    const std::vector<std::vector<Ray> > & tl_sample_rays);
 
   void filterCloud(
     const pcl::PointCloud<pcl::PointXYZ> & cloud_in, const std::vector<pcl::PointXYZ> & roi_tls,
@@ -81,7 +87,17 @@ private:
     const std::map<lanelet::Id, tf2::Vector3> & traffic_light_position_map,
     const tf2::Transform & tf_camera2map, pcl::PointXYZ & top_left, pcl::PointXYZ & bottom_right);
 
-  std::map<int, std::map<int, std::vector<Ray> > > lidar_rays_;
+  // range image of the lidar rays around the traffic lights, with cells of the occlusion
+  // resolution. The rays are sorted by cell, with the ones of the cell i from
+  // cell_ray_offsets_[i] to cell_ray_offsets_[i + 1], and their minimum distance in
+  // cell_min_dists_[i]
+  float image_min_azimuth_;
+  float image_min_elevation_;
+  int image_cols_;
+  int image_rows_;
+  std::vector<uint32_t> cell_ray_offsets_;
+  std::vector<float> cell_min_dists_;
+  std::vector<Ray> cell_rays_;
   rclcpp::Node * node_ptr_;
   float max_valid_pt_distance_;
   float azimuth_occlusion_resolution_deg_;
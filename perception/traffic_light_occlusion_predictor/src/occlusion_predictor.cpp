@@ -15,9 +15,15 @@
 
 #include "traffic_light_occlusion_predictor/occlusion_predictor.hpp"
 
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
 namespace
 {
 
+const float min_dist_from_occlusion_to_tl = 5.0f;
+
 traffic_light::Ray point2ray(const pcl::PointXYZ & pt)
 {
   traffic_light::Ray ray;
@@ -38,7 +44,11 @@ CloudOcclusionPredictor::CloudOcclusionPredictor(
 : node_ptr_(node_ptr),
   max_valid_pt_distance_(max_valid_pt_distance),
   azimuth_occlusion_resolution_deg_(azimuth_occlusion_resolution_deg),
-  elevation_occlusion_resolution_deg_(elevation_occlusion_resolution_deg)
+  elevation_occlusion_resolution_deg_(elevation_occlusion_resolution_deg),
+  image_min_azimuth_(0),
+  image_min_elevation_(0),
+  image_cols_(0),
+  image_rows_(0)
 {
 }
 
@@ -93,7 +103,6 @@ void CloudOcclusionPredictor::predict(
       roi_brs[i]);
   }
 
-  lidar_rays_.clear();
   // points in camera frame
   pcl::PointCloud<pcl::PointXYZ> cloud_camera;
   // points within roi
@@ -102,12 +111,22 @@ void CloudOcclusionPredictor::predict(
 
   filterCloud(cloud_camera, roi_tls, roi_brs, cloud_roi);
 
-  for (const pcl::PointXYZ & pt : cloud_roi) {
-    Ray ray = ::point2ray(pt);
-    lidar_rays_[static_cast<int>(ray.azimuth)][static_cast<int>(ray.elevation)].push_back(ray);
+  const uint32_t horizontal_sample_num = 20;
+  const uint32_t vertical_sample_num = 20;
+  static_assert(horizontal_sample_num > 1 && vertical_sample_num > 1);
+  std::vector<std::vector<Ray> > tl_sample_rays(roi_tls.size());
+  pcl::PointCloud<pcl::PointXYZ> tl_sample_cloud;
+  for (size_t i = 0; i < roi_tls.size(); i++) {
+    sampleTrafficLightRoi(
+      roi_tls[i], roi_brs[i], horizontal_sample_num, vertical_sample_num, tl_sample_cloud);
+    for (const pcl::PointXYZ & tl_pt : tl_sample_cloud) {
+      tl_sample_rays[i].push_back(::point2ray(tl_pt));
+    }
   }
+
+  buildRangeImage(cloud_roi, tl_sample_rays);
   for (size_t i = 0; i < roi_tls.size(); i++) {
-    occlusion_ratios[i] = predict(roi_tls[i], roi_brs[i]);
+    occlusion_ratios[i] = predict(tl_sample_rays[i]);
   }
 }
 
@@ -202,49 +221,171 @@ void CloudOcclusionPredictor::sampleTrafficLightRoi(
   }
 }
 
-uint32_t CloudOcclusionPredictor::predict(
-  const pcl::PointXYZ & roi_top_left, const pcl::PointXYZ & roi_bottom_right)
+void CloudOcclusionPredictor::buildRangeImage(
+  const pcl::PointCloud<pcl::PointXYZ> & cloud_roi,
+  const std::vector<std::vector<Ray> > & tl_sample_rays)
 {
-  const uint32_t horizontal_sample_num = 20;
-  const uint32_t vertical_sample_num = 20;
-  static_assert(horizontal_sample_num > 1 && vertical_sample_num > 1);
-  const float min_dist_from_occlusion_to_tl = 5.0f;
+  float min_azimuth = std::numeric_limits<float>::max();
+  float max_azimuth = std::numeric_limits<float>::lowest();
+  float min_elevation = std::numeric_limits<float>::max();
+  float max_elevation = std::numeric_limits<float>::lowest();
+  float max_occluder_dist = std::numeric_limits<float>::lowest();
+  for (const auto & rays : tl_sample_rays) {
+    for (const Ray & ray : rays) {
+      max_occluder_dist = std::max(max_occluder_dist, ray.dist - min_dist_from_occlusion_to_tl);
+      min_azimuth = std::min(min_azimuth, ray.azimuth);
+      max_azimuth = std::max(max_azimuth, ray.azimuth);
+      min_elevation = std::min(min_elevation, ray.elevation);
+      max_elevation = std::max(max_elevation, ray.elevation);
+    }
+  }
+  // the image covers the ranges searched around the samples, with a margin of one cell on each
+  // side for the rounding of the angles
+  image_cols_ = 0;
+  image_rows_ = 0;
+  if (min_azimuth <= max_azimuth) {
+    image_min_azimuth_ = min_azimuth - 2 * azimuth_occlusion_resolution_deg_;
+    image_min_elevation_ = min_elevation - 2 * elevation_occlusion_resolution_deg_;
+    image_cols_ =
+      static_cast<int>((max_azimuth - min_azimuth) / azimuth_occlusion_resolution_deg_) + 5;
+    image_rows_ =
+      static_cast<int>((max_elevation - min_elevation) / elevation_occlusion_resolution_deg_) + 5;
+  }
 
-  pcl::PointCloud<pcl::PointXYZ> tl_sample_cloud;
-  sampleTrafficLightRoi(
-    roi_top_left, roi_bottom_right, horizontal_sample_num, vertical_sample_num, tl_sample_cloud);
-  uint32_t occluded_num = 0;
-  for (const pcl::PointXYZ & tl_pt : tl_sample_cloud) {
-    Ray tl_ray = ::point2ray(tl_pt);
-    bool occluded = false;
-    // the azimuth and elevation range to search for points that may occlude tl_pt
-    int min_azimuth = static_cast<int>(tl_ray.azimuth - azimuth_occlusion_resolution_deg_);
-    int max_azimuth = static_cast<int>(tl_ray.azimuth + azimuth_occlusion_resolution_deg_);
-    int min_elevation = static_cast<int>(tl_ray.elevation - elevation_occlusion_resolution_deg_);
-    int max_elevation = static_cast<int>(tl_ray.elevation + elevation_occlusion_resolution_deg_);
-    /**
-     * search among lidar rays whose azimuth and elevation angle are close to the tl_ray.
-     * for a lidar ray r1 whose azimuth and elevation are very close to tl_pt,
-     * and the distance from r1 to camera is smaller than the distance from tl_pt to camera,
-     * then tl_pt is occluded by r1.
-     */
-    for (int azimuth = min_azimuth; (azimuth <= max_azimuth) && !occluded; azimuth++) {
-      for (int elevation = min_elevation; (elevation <= max_elevation) && !occluded; elevation++) {
-        for (const Ray & lidar_ray : lidar_rays_[azimuth][elevation]) {
-          if (
-            std::abs(lidar_ray.azimuth - tl_ray.azimuth) <= azimuth_occlusion_resolution_deg_ &&
-            std::abs(lidar_ray.elevation - tl_ray.elevation) <=
-              elevation_occlusion_resolution_deg_ &&
-            lidar_ray.dist < tl_ray.dist - min_dist_from_occlusion_to_tl) {
-            occluded = true;
-            break;
-          }
+  const size_t cell_num = static_cast<size_t>(image_cols_) * image_rows_;
+  cell_ray_offsets_.assign(cell_num + 1, 0);
+  cell_min_dists_.assign(cell_num, std::numeric_limits<float>::max());
+  // the tangents of the image bounds, widened by one more cell, reject most of the points out of
+  // the image before their angles are computed
+  const float min_image_azimuth = image_min_azimuth_ - azimuth_occlusion_resolution_deg_;
+  const float max_image_azimuth =
+    image_min_azimuth_ + (image_cols_ + 1) * azimuth_occlusion_resolution_deg_;
+  const float min_image_elevation = image_min_elevation_ - elevation_occlusion_resolution_deg_;
+  const float max_image_elevation =
+    image_min_elevation_ + (image_rows_ + 1) * elevation_occlusion_resolution_deg_;
+  const float max_tan_angle_deg = 89.0f;
+  const bool use_azimuth_tans =
+    -max_tan_angle_deg < min_image_azimuth && max_image_azimuth < max_tan_angle_deg;
+  const float min_azimuth_tan = std::tan(DEG2RAD(min_image_azimuth));
+  const float max_azimuth_tan = std::tan(DEG2RAD(max_image_azimuth));
+  const float min_elevation_tan = -max_tan_angle_deg < min_image_elevation
+                                    ? std::tan(DEG2RAD(min_image_elevation))
+                                    : std::numeric_limits<float>::lowest();
+  const float max_elevation_tan = max_image_elevation < max_tan_angle_deg
+                                    ? std::tan(DEG2RAD(max_image_elevation))
+                                    : std::numeric_limits<float>::max();
+
+  std::vector<Ray> rays;
+  std::vector<size_t> ray_cells;
+  rays.reserve(cloud_roi.size());
+  ray_cells.reserve(cloud_roi.size());
+  for (const pcl::PointXYZ & pt : cloud_roi) {
+    // the points behind all the traffic lights can not occlude them
+    if (std::sqrt(pt.x * pt.x + pt.y * pt.y + pt.z * pt.z) >= max_occluder_dist) {
+      continue;
+    }
+    if (
+      use_azimuth_tans &&
+      (pt.z <= 0 || pt.x < pt.z * min_azimuth_tan || pt.x > pt.z * max_azimuth_tan)) {
+      continue;
+    }
+    const float horizontal_dist = std::sqrt(pt.x * pt.x + pt.z * pt.z);
+    if (pt.y < horizontal_dist * min_elevation_tan || pt.y > horizontal_dist * max_elevation_tan) {
+      continue;
+    }
+    Ray ray = ::point2ray(pt);
+    const int col = static_cast<int>(
+      std::floor((ray.azimuth - image_min_azimuth_) / azimuth_occlusion_resolution_deg_));
+    const int row = static_cast<int>(
+      std::floor((ray.elevation - image_min_elevation_) / elevation_occlusion_resolution_deg_));
+    if (col < 0 || col >= image_cols_ || row < 0 || row >= image_rows_) {
+      continue;
+    }
+    const size_t cell = static_cast<size_t>(row) * image_cols_ + col;
+    rays.push_back(ray);
+    ray_cells.push_back(cell);
+    cell_ray_offsets_[cell + 1]++;
+    cell_min_dists_[cell] = std::min(cell_min_dists_[cell], ray.dist);
+  }
+
+  std::partial_sum(cell_ray_offsets_.begin(), cell_ray_offsets_.end(), cell_ray_offsets_.begin());
+  std::vector<uint32_t> cell_ends(cell_ray_offsets_.begin(), cell_ray_offsets_.end() - 1);
+  cell_rays_.resize(rays.size());
+  for (size_t i = 0; i < rays.size(); i++) {
+    cell_rays_[cell_ends[ray_cells[i]]++] = rays[i];
+  }
+}
+
+bool CloudOcclusionPredictor::isOccluded(const Ray & tl_ray) const
+{
+  const float max_occluder_dist = tl_ray.dist - min_dist_from_occlusion_to_tl;
+  // the azimuth and elevation range to search for points that may occlude tl_ray, in cells
+  const float min_col_pos =
+    (tl_ray.azimuth - azimuth_occlusion_resolution_deg_ - image_min_azimuth_) /
+    azimuth_occlusion_resolution_deg_;
+  const float max_col_pos =
+    (tl_ray.azimuth + azimuth_occlusion_resolution_deg_ - image_min_azimuth_) /
+    azimuth_occlusion_resolution_deg_;
+  const float min_row_pos =
+    (tl_ray.elevation - elevation_occlusion_resolution_deg_ - image_min_elevation_) /
+    elevation_occlusion_resolution_deg_;
+  const float max_row_pos =
+    (tl_ray.elevation + elevation_occlusion_resolution_deg_ - image_min_elevation_) /
+    elevation_occlusion_resolution_deg_;
+  // with a margin of one cell on each side for the rounding of the angles
+  const int min_col = std::max(static_cast<int>(std::floor(min_col_pos)) - 1, 0);
+  const int max_col = std::min(static_cast<int>(std::floor(max_col_pos)) + 1, image_cols_ - 1);
+  const int min_row = std::max(static_cast<int>(std::floor(min_row_pos)) - 1, 0);
+  const int max_row = std::min(static_cast<int>(std::floor(max_row_pos)) + 1, image_rows_ - 1);
+  // all the rays of the cells well inside of the range are close to tl_ray, so only their
+  // minimum distance is checked
+  const float rounding_margin = 0.01f;
+  const auto is_inner_cell = [&](const int row, const int col) {
+    return min_col_pos + rounding_margin <= col && col + 1 <= max_col_pos - rounding_margin &&
+           min_row_pos + rounding_margin <= row && row + 1 <= max_row_pos - rounding_margin;
+  };
+  for (int row = min_row; row <= max_row; row++) {
+    for (int col = min_col; col <= max_col; col++) {
+      const size_t cell = static_cast<size_t>(row) * image_cols_ + col;
+      if (is_inner_cell(row, col) && cell_min_dists_[cell] < max_occluder_dist) {
+        return true;
+      }
+    }
+  }
+  /**
+   * search among lidar rays whose azimuth and elevation angle are close to the tl_ray.
+   * for a lidar ray r1 whose azimuth and elevation are very close to tl_pt,
+   * and the distance from r1 to camera is smaller than the distance from tl_pt to camera,
+   * then tl_pt is occluded by r1.
+   */
+  for (int row = min_row; row <= max_row; row++) {
+    for (int col = min_col; col <= max_col; col++) {
+      const size_t cell = static_cast<size_t>(row) * image_cols_ + col;
+      if (is_inner_cell(row, col) || cell_min_dists_[cell] >= max_occluder_dist) {
+        continue;
+      }
+      for (uint32_t i = cell_ray_offsets_[cell]; i < cell_ray_offsets_[cell + 1]; i++) {
+        const Ray & lidar_ray = cell_rays_[i];
+        if (
+          std::abs(lidar_ray.azimuth - tl_ray.azimuth) <= azimuth_occlusion_resolution_deg_ &&
+          std::abs(lidar_ray.elevation - tl_ray.elevation) <=
+            elevation_occlusion_resolution_deg_ &&
+          lidar_ray.dist < max_occluder_dist) {
+          return true;
         }
       }
     }
-    occluded_num += occluded;
   }
-  return 100 * occluded_num / tl_sample_cloud.size();
+  return false;
+}
+
+uint32_t CloudOcclusionPredictor::predict(const std::vector<Ray> & tl_sample_rays) const
+{
+  uint32_t occluded_num = 0;
+  for (const Ray & tl_ray : tl_sample_rays) {
+    occluded_num += isOccluded(tl_ray);
+  }
+  return 100 * occluded_num / tl_sample_rays.size();
 }
 
 }  // namespace traffic_light
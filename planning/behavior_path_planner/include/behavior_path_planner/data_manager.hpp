@@ -17,8 +17,10 @@
 
 #include "behavior_path_planner/parameters.hpp"
 #include "behavior_path_planner/turn_signal_decider.hpp"
+#include "behavior_path_planner/utils/drivable_area_expansion/map_utils.hpp"
 #include "behavior_path_planner/utils/drivable_area_expansion/parameters.hpp"
 #include "motion_utils/trajectory/trajectory.hpp"
+#include "tier4_autoware_utils/geometry/boost_polygon_utils.hpp"
 
 #include <lanelet2_extension/regulatory_elements/Forward.hpp>
 #include <rclcpp/rclcpp.hpp>
@@ -40,9 +42,12 @@
 
 #include <lanelet2_core/primitives/Lanelet.h>
 
+#include <array>
 #include <limits>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <optional>
 #include <string>
 #include <vector>
 
@@ -143,6 +148,51 @@ struct CandidateOutput
   double finish_distance_to_path_change{std::numeric_limits<double>::lowest()};
 };
 
+/**
+ * @brief data derived from the planner data, which is computed at most once per cycle and shared
+ *        by the scene modules. it is cleared by PlannerManager::run before the modules are run.
+ * @note the modules may run in parallel, so that the cache is accessed with the mutex locked.
+ */
+struct PlannerDataCache
+{
+  PlannerDataCache() = default;
+  PlannerDataCache(const PlannerDataCache & other) { *this = other; }
+  PlannerDataCache & operator=(const PlannerDataCache & other)
+  {
+    if (this != &other) {
+      std::scoped_lock lock(mutex, other.mutex);
+      current_lanes = other.current_lanes;
+      current_lanes_odometry = other.current_lanes_odometry;
+      object_polygons = other.object_polygons;
+    }
+    return *this;
+  }
+
+  struct ObjectPolygon
+  {
+    geometry_msgs::msg::Pose pose;
+    autoware_auto_perception_msgs::msg::Shape shape;
+    tier4_autoware_utils::Polygon2d polygon;
+  };
+
+  // current lanes with the common backward/forward path length, and the odometry for them
+  std::optional<lanelet::ConstLanelets> current_lanes{};
+  Odometry::ConstSharedPtr current_lanes_odometry{};
+
+  // object polygons by the object uuid
+  std::map<std::array<uint8_t, 16>, ObjectPolygon> object_polygons{};
+
+  mutable std::mutex mutex;
+
+  void clear()
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    current_lanes.reset();
+    current_lanes_odometry.reset();
+    object_polygons.clear();
+  }
+};
+
 struct PlannerData
 {
   Odometry::ConstSharedPtr self_odometry{};
@@ -162,7 +212,10 @@ struct PlannerData
 
   mutable std::vector<geometry_msgs::msg::Pose> drivable_area_expansion_prev_path_poses{};
   mutable std::vector<double> drivable_area_expansion_prev_curvatures{};
+  mutable drivable_area_expansion::UncrossableSegmentsCache
+    drivable_area_expansion_uncrossable_segments{};
   mutable TurnSignalDecider turn_signal_decider;
+  mutable PlannerDataCache cache{};
 
   TurnIndicatorsCommand getTurnSignal(
     const PathWithLaneId & path, const TurnSignalInfo & turn_signal_info,
@@ -189,6 +242,20 @@ struct PlannerData
     return traffic_light_id_map.at(id);
   }
 
+  // the polygon of the object, which is computed once per cycle unless the object is moved
+  tier4_autoware_utils::Polygon2d getObjectPolygon(const PredictedObject & object) const
+  {
+    const auto & pose = object.kinematics.initial_pose_with_covariance.pose;
+    std::lock_guard<std::mutex> lock(cache.mutex);
+    auto & cached = cache.object_polygons[object.object_id.uuid];
+    if (cached.polygon.outer().empty() || cached.pose != pose || cached.shape != object.shape) {
+      cached.pose = pose;
+      cached.shape = object.shape;
+      cached.polygon = tier4_autoware_utils::toPolygon2d(object);
+    }
+    return cached.polygon;
+  }
+
   template <class T>
   size_t findEgoIndex(const std::vector<T> & points) const
   {
@@ -77,6 +77,7 @@ struct BehaviorPathPlannerParameters
 {
   bool verbose;
   size_t max_iteration_num{100};
+  bool enable_parallel_request_modules{false};
   double traffic_light_signal_timeout{1.0};
 
   ModuleConfigParameters config_avoidance;
@@ -94,7 +94,9 @@ struct SceneModuleStatus
 class PlannerManager
 {
 public:
-  PlannerManager(rclcpp::Node & node, const size_t max_iteration_num, const bool verbose);
+  PlannerManager(
+    rclcpp::Node & node, const size_t max_iteration_num, const bool verbose,
+    const bool enable_parallel_request_modules = false);
 
   /**
    * @brief run all candidate and approved modules.
@@ -260,7 +262,9 @@ private:
     const SceneModulePtr & module_ptr, const std::shared_ptr<PlannerData> & planner_data,
     const BehaviorModuleOutput & previous_module_output) const
   {
-    stop_watch_.tic(module_ptr->name());
+    // not the member stop watch, since the modules may run in parallel
+    StopWatch<std::chrono::milliseconds> stop_watch;
+    stop_watch.tic(module_ptr->name());
 
     module_ptr->setData(planner_data);
     module_ptr->setPreviousModuleOutput(previous_module_output);
@@ -275,7 +279,7 @@ private:
 
     module_ptr->publishRTCStatus();
 
-    processing_time_.at(module_ptr->name()) += stop_watch_.toc(module_ptr->name(), true);
+    processing_time_.at(module_ptr->name()) += stop_watch.toc(module_ptr->name(), true);
 
     return result;
   }
@@ -419,6 +423,18 @@ private:
     const std::vector<SceneModulePtr> & request_modules, const std::shared_ptr<PlannerData> & data,
     const BehaviorModuleOutput & previous_module_output);
 
+  /**
+   * @brief run the modules of different managers in parallel. the modules of the same manager are
+   *        run one after another on the same thread, since they share the manager.
+   * @param request modules.
+   * @param planner data.
+   * @param previous module output.
+   * @return planning results in the order of the request modules.
+   */
+  std::vector<BehaviorModuleOutput> runInParallel(
+    const std::vector<SceneModulePtr> & request_modules, const std::shared_ptr<PlannerData> & data,
+    const BehaviorModuleOutput & previous_module_output) const;
+
   std::string getNames(const std::vector<SceneModulePtr> & modules) const;
 
   boost::optional<lanelet::ConstLanelet> root_lanelet_{boost::none};
@@ -446,6 +462,8 @@ private:
   size_t max_iteration_num_{100};
 
   bool verbose_{false};
+
+  bool enable_parallel_request_modules_{false};
 };
 }  // namespace behavior_path_planner
 
@@ -606,6 +606,8 @@ private:
 
   mutable ObjectDataArray stopped_objects_;
 
+  mutable ObjectGeometryCacheMap object_geometry_cache_;
+
   mutable DebugData debug_data_;
 
   mutable std::shared_ptr<AvoidanceDebugMsgArray> debug_msg_ptr_;
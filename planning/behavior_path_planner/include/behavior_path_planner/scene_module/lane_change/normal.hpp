@@ -18,7 +18,9 @@
 #include "behavior_path_planner/scene_module/lane_change/base_class.hpp"
 
 #include <memory>
+#include <optional>
 #include <string>
+#include <tuple>
 #include <unordered_map>
 #include <utility>
 #include <vector>
@@ -178,6 +180,51 @@ protected:
   double getStopTime() const { return stop_time_; }
 
   double stop_time_{0.0};
+
+  // the candidate paths of a prepare duration and a longitudinal acceleration, before the checks
+  // which depend on the objects or on the stop time
+  struct LaneChangeCandidates
+  {
+    LaneChangePaths paths{};
+    bool is_start_behind_target_lanes{false};
+  };
+
+  // everything the candidates depend on, other than the parameters
+  struct LaneChangeCandidateCacheKey
+  {
+    Pose ego_pose{};
+    double ego_velocity{0.0};
+    std_msgs::msg::Header route_header{};
+    unique_identifier_msgs::msg::UUID route_uuid{};
+    std::vector<uint64_t> current_lane_ids{};
+    std::vector<uint64_t> target_lane_ids{};
+    Direction direction{Direction::NONE};
+    PathWithLaneId reference_path{};
+    std::vector<double> prepare_durations{};
+    std::vector<double> longitudinal_acc_values{};
+
+    bool operator==(const LaneChangeCandidateCacheKey & other) const
+    {
+      return std::tie(
+               ego_pose, ego_velocity, route_header, route_uuid, current_lane_ids,
+               target_lane_ids, direction, reference_path, prepare_durations,
+               longitudinal_acc_values) ==
+             std::tie(
+               other.ego_pose, other.ego_velocity, other.route_header, other.route_uuid,
+               other.current_lane_ids, other.target_lane_ids, other.direction,
+               other.reference_path, other.prepare_durations, other.longitudinal_acc_values);
+    }
+  };
+
+  // the candidates are carried over while the key is unchanged, e.g. while ego stops to wait for a
+  // gap, or for the retry with the margin for stuck in the same cycle
+  struct LaneChangeCandidateCache
+  {
+    LaneChangeCandidateCacheKey key{};
+    std::vector<std::optional<LaneChangeCandidates>> candidates{};
+  };
+
+  mutable LaneChangeCandidateCache candidate_cache_{};
 };
 }  // namespace behavior_path_planner
 #endif  // BEHAVIOR_PATH_PLANNER__SCENE_MODULE__LANE_CHANGE__NORMAL_HPP_
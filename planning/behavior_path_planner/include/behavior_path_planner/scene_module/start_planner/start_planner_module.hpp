@@ -53,6 +53,14 @@ using geometry_msgs::msg::PoseArray;
 using lane_departure_checker::LaneDepartureChecker;
 using PriorityOrder = std::vector<std::pair<size_t, std::shared_ptr<PullOutPlannerBase>>>;
 
+struct PullOutCandidate
+{
+  PullOutPath path{};
+  Pose start_pose{};
+  PlannerType planner_type{PlannerType::NONE};
+  bool driving_forward{true};
+};
+
 struct PullOutStatus
 {
   PullOutPath pull_out_path{};
@@ -143,6 +151,10 @@ private:
     const std::vector<Pose> & start_pose_candidates, const size_t index,
     const std::shared_ptr<PullOutPlannerBase> & planner, const Pose & refined_start_pose,
     const Pose & goal_pose);
+  boost::optional<PullOutCandidate> planPullOutCandidate(
+    const std::vector<Pose> & start_pose_candidates, const size_t index,
+    const std::shared_ptr<PullOutPlannerBase> & planner, const Pose & refined_start_pose,
+    const Pose & goal_pose) const;
   void updateStatusWithCurrentPath(
     const behavior_path_planner::PullOutPath & path, const Pose & start_pose,
     const behavior_path_planner::PlannerType & planner_type);
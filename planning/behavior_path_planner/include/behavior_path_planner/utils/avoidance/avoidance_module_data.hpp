@@ -250,6 +250,12 @@ struct AvoidanceParameters
   // lost_count and the registered object will be removed when the count exceeds this max count.
   double object_last_seen_threshold{0.0};
 
+  // Reuse the envelope polygon, the overhang and the road shoulder distance of an object in the
+  // next cycles, while neither the object nor the reference path around it moves more than the
+  // threshold.
+  bool enable_object_geometry_cache{false};
+  double object_geometry_cache_threshold{0.0};
+
   // The avoidance path generation is performed when the shift distance of the
   // avoidance points is greater than this threshold.
   // In multiple targets case: if there are multiple vehicles in a row to be avoided, no new
@@ -398,6 +404,28 @@ struct ObjectData  // avoidance target
 };
 using ObjectDataArray = std::vector<ObjectData>;
 
+struct ObjectGeometryCache  // geometry of an object reused over the cycles
+{
+  // the object and the reference path when the geometry was calculated
+  Polygon2d object_polygon{};
+  Pose closest_path_pose{};
+  std::vector<int64_t> closest_path_lane_ids{};
+  double distance_factor{0.0};
+
+  Polygon2d envelope_poly{};
+  Point2d centroid{};
+  double lateral{0.0};
+  double overhang_dist{0.0};
+  Pose overhang_pose{};
+
+  // set once the road shoulder is calculated for the geometry above
+  bool has_road_shoulder{false};
+  lanelet::ConstLanelet overhang_lanelet{};
+  lanelet::ConstLineString3d road_shoulder_line{};
+  double to_road_shoulder_distance{0.0};
+};
+using ObjectGeometryCacheMap = std::unordered_map<std::string, ObjectGeometryCache>;
+
 /*
  * Shift point with additional info for avoidance planning
  */
@@ -114,6 +114,12 @@ void fillObjectEnvelopePolygon(
   ObjectData & object_data, const ObjectDataArray & registered_objects, const Pose & closest_pose,
   const std::shared_ptr<AvoidanceParameters> & parameters);
 
+// true if neither the object footprint nor the closest path point moved more than the threshold
+bool isObjectGeometryCacheValid(
+  const ObjectGeometryCache & cache, const Polygon2d & object_polygon,
+  const PathPointWithLaneId & closest_path_point, const double distance_factor,
+  const double threshold);
+
 void fillObjectMovingTime(
   ObjectData & object_data, ObjectDataArray & stopped_objects,
   const std::shared_ptr<AvoidanceParameters> & parameters);
@@ -134,10 +140,12 @@ void compensateDetectionLost(
   const ObjectDataArray & registered_objects, ObjectDataArray & now_objects,
   ObjectDataArray & other_objects);
 
+// the road shoulder of the objects in the geometry cache is calculated once for their geometry
 void filterTargetObjects(
   ObjectDataArray & objects, AvoidancePlanningData & data, DebugData & debug,
   const std::shared_ptr<const PlannerData> & planner_data,
-  const std::shared_ptr<AvoidanceParameters> & parameters);
+  const std::shared_ptr<AvoidanceParameters> & parameters,
+  ObjectGeometryCacheMap * geometry_cache = nullptr);
 
 double extendToRoadShoulderDistanceWithPolygon(
   const std::shared_ptr<route_handler::RouteHandler> & rh,
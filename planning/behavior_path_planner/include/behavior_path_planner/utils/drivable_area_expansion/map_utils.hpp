@@ -20,11 +20,34 @@
 
 #include <lanelet2_core/LaneletMap.h>
 
+#include <mutex>
 #include <string>
 #include <vector>
 
 namespace drivable_area_expansion
 {
+/// @brief Uncrossable segments of the whole lanelet map, extracted again only if the map changes
+struct UncrossableSegmentsCache
+{
+  UncrossableSegmentsCache() = default;
+  UncrossableSegmentsCache(const UncrossableSegmentsCache & other) { *this = other; }
+  UncrossableSegmentsCache & operator=(const UncrossableSegmentsCache & other)
+  {
+    if (this != &other) {
+      std::scoped_lock lock(mutex, other.mutex);
+      lanelet_map = other.lanelet_map;
+      linestring_types = other.linestring_types;
+      segments = other.segments;
+    }
+    return *this;
+  }
+
+  lanelet::LaneletMapConstPtr lanelet_map{};
+  std::vector<std::string> linestring_types{};
+  SegmentRtree segments{};
+  mutable std::mutex mutex;
+};
+
 /// @brief Extract uncrossable segments from the lanelet map that are in range of ego
 /// @param[in] lanelet_map lanelet map
 /// @param[in] ego_point point of the current ego position
@@ -34,6 +57,17 @@ SegmentRtree extract_uncrossable_segments(
   const lanelet::LaneletMap & lanelet_map, const Point & ego_point,
   const DrivableAreaExpansionParameters & params);
 
+/// @brief Extract uncrossable segments from the lanelet map that are in range of ego
+/// @details the segments of the whole map are taken from the cache, which is updated if needed
+/// @param[in] lanelet_map_ptr lanelet map
+/// @param[in] ego_point point of the current ego position
+/// @param[in] params parameters with linestring types that cannot be crossed and maximum range
+/// @param[inout] cache uncrossable segments of the whole map
+/// @return the uncrossable segments stored in a rtree
+SegmentRtree extract_uncrossable_segments(
+  const lanelet::LaneletMapConstPtr & lanelet_map_ptr, const Point & ego_point,
+  const DrivableAreaExpansionParameters & params, UncrossableSegmentsCache & cache);
+
 /// @brief Determine if the given linestring has one of the given types
 /// @param[in] ls linestring to check
 /// @param[in] types type strings to check
@@ -66,6 +66,7 @@ struct GoalPlannerParameters
   bool use_occupancy_grid_for_goal_longitudinal_margin{false};
   bool use_occupancy_grid_for_path_collision_check{false};
   double occupancy_grid_collision_check_margin{0.0};
+  bool use_occupancy_grid_distance_field{false};
   int theta_size{0};
   int obstacle_threshold{0};
 
@@ -84,6 +85,7 @@ struct GoalPlannerParameters
   double maximum_jerk{0.0};
   std::string path_priority;  // "efficient_path" or "close_goal"
   std::vector<std::string> efficient_path_order{};
+  bool enable_parallel_path_planning{false};
 
   // shift path
   bool enable_shift_parking{false};
@@ -40,6 +40,7 @@ struct LaneChangeParameters
   double prediction_time_resolution{0.5};
   int longitudinal_acc_sampling_num{10};
   int lateral_acc_sampling_num{10};
+  bool enable_parallel_path_generation{false};
 
   // parked vehicle
   double object_check_min_road_shoulder_width{0.5};
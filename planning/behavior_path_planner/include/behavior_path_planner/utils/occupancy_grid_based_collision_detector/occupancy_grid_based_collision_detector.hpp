@@ -48,6 +48,12 @@ struct IndexXY
   int y;
 };
 
+struct CollisionCircle
+{
+  double x;  // offset from the base in costmap frame [m]
+  double y;  // offset from the base in costmap frame [m]
+};
+
 IndexXYT pose2index(
   const nav_msgs::msg::OccupancyGrid & costmap, const geometry_msgs::msg::Pose & pose_local,
   const int theta_size);
@@ -76,6 +82,9 @@ struct OccupancyGridMapParam
   // costmap configs
   int theta_size;          // discretized angle table size [-]
   int obstacle_threshold;  // obstacle threshold on grid [-]
+
+  // check the footprint with circles on a distance field instead of with its cells
+  bool use_distance_field{false};
 };
 
 struct PlannerWaypoint
@@ -97,19 +106,26 @@ public:
   void setParam(const OccupancyGridMapParam & param) { param_ = param; };
   OccupancyGridMapParam getParam() const { return param_; };
   void setMap(const nav_msgs::msg::OccupancyGrid & costmap);
-  nav_msgs::msg::OccupancyGrid getMap() const { return costmap_; };
+  const nav_msgs::msg::OccupancyGrid & getMap() const { return costmap_; };
   void setVehicleShape(const VehicleShape & vehicle_shape) { param_.vehicle_shape = vehicle_shape; }
   bool hasObstacleOnPath(
     const geometry_msgs::msg::PoseArray & path, const bool check_out_of_range) const;
   bool hasObstacleOnPath(
     const autoware_auto_planning_msgs::msg::PathWithLaneId & path,
     const bool check_out_of_range) const;
+  bool hasObstacleOnPath(
+    const std::vector<geometry_msgs::msg::Pose> & poses, const bool check_out_of_range) const;
   const PlannerWaypoints & getWaypoints() const { return waypoints_; }
   bool detectCollision(const IndexXYT & base_index, const bool check_out_of_range) const;
   virtual ~OccupancyGridBasedCollisionDetector() {}
 
 protected:
   void computeCollisionIndexes(int theta_index, std::vector<IndexXY> & indexes);
+  void computeCollisionCircles(int theta_index, std::vector<CollisionCircle> & circles);
+  void computeDistanceField();
+  bool detectCollisionOnDistanceField(
+    const IndexXYT & base_index, const bool check_out_of_range) const;
+  IndexXYT globalPose2Index(const geometry_msgs::msg::Pose & pose_global) const;
   inline bool isOutOfRange(const IndexXYT & index) const
   {
     if (index.x < 0 || static_cast<int>(costmap_.info.width) <= index.x) {
@@ -139,6 +155,16 @@ protected:
   // is_obstacle's table
   std::vector<std::vector<bool>> is_obstacle_table_;
 
+  // distance from each cell center to the nearest obstacle cell center, row-major [m]
+  std::vector<double> distance_field_;
+
+  // circles covering the footprint for each theta, with a common radius
+  std::vector<std::vector<CollisionCircle>> coll_circles_table_;
+  double coll_circle_radius_{0.0};
+
+  // inverse of the costmap origin, computed once per costmap
+  tf2::Transform tf_global2local_;
+
   // pose in costmap frame
   geometry_msgs::msg::Pose start_pose_;
   geometry_msgs::msg::Pose goal_pose_;
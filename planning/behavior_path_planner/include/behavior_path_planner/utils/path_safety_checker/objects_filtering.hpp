@@ -130,6 +130,9 @@ void filterObjectsByClass(
 /**
  * @brief Separate index of the obstacles into two part based on whether the object is within
  * lanelet.
+ * @note The condition is checked only with the lanelets whose bounding boxes intersect with the
+ * bounding box of the object footprint and centroid, which holds for isPolygonOverlapLanelet and
+ * isCentroidWithinLanelet.
  * @return Indices of objects pair. first objects are in the lanelet, and second others are out of
  * lanelet.
  */
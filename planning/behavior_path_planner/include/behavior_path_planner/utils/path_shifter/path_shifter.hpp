@@ -116,6 +116,8 @@ public:
 
   /**
    * @brief  Generate a shifted path according to the given reference path and shift points.
+   * @details The buffers of shifted_path are reused, so evaluating several sets of shift points
+   *          on the same reference path does not reallocate them.
    * @return False if the path is empty or shift points have conflicts.
    */
   bool generate(
@@ -163,6 +165,12 @@ private:
   // The reference path along which the shift will be performed.
   PathWithLaneId reference_path_;
 
+  // Arc length of each point of the reference path, updated by setPath().
+  std::vector<double> reference_arclength_;
+
+  // Left unit normal (-sin(yaw), cos(yaw)) of each point of the reference path.
+  std::vector<std::pair<double, double>> reference_normals_;
+
   // Shift points used for shifted-path generation.
   ShiftLineArray shift_lines_;
 
@@ -205,17 +213,19 @@ private:
   void sortShiftLinesAlongPath(ShiftLineArray & shift_lines) const;
 
   /**
-   * @brief Generate shifted path from reference_path_ and shift_lines_ with linear shifting.
+   * @brief Calculate the shift length of each point of reference_path_ for shift_lines_ with
+   *        linear shifting.
    */
-  void applyLinearShifter(ShiftedPath * shifted_path) const;
+  void applyLinearShifter(std::vector<double> & shift_length) const;
 
   /**
-   * @brief Generate shifted path from reference_path_ and shift_lines_ with spline_based shifting.
+   * @brief Calculate the shift length of each point of reference_path_ for shift_lines_ with
+   *        spline_based shifting.
    * @details Calculate the shift so that the horizontal jerk remains constant. This is achieved by
    *          dividing the shift interval into four parts and apply a cubic spline to them.
    *          The resultant shifting shape is closed to the Clothoid curve.
    */
-  void applySplineShifter(ShiftedPath * shifted_path, const bool offset_back) const;
+  void applySplineShifter(std::vector<double> & shift_length, const bool offset_back) const;
 
   ////////////////////////////////////////
   // Helper Functions
@@ -226,9 +236,16 @@ private:
    */
   bool checkShiftLinesAlignment(const ShiftLineArray & shift_lines) const;
 
-  void addLateralOffsetOnIndexPoint(ShiftedPath * path, double offset, size_t index) const;
+  void addLateralOffsetOnIndexPoint(
+    std::vector<double> & shift_length, double offset, size_t index) const;
+
+  void shiftBaseLength(std::vector<double> & shift_length, double offset) const;
 
-  void shiftBaseLength(ShiftedPath * path, double offset) const;
+  /**
+   * @brief Move the points of shifted_path, a copy of reference_path_, by their shift length
+   *        along the normals of the reference path.
+   */
+  void applyShiftLength(ShiftedPath * shifted_path) const;
 
   void setBaseOffset(const double val)
   {
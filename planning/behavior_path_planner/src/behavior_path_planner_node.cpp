@@ -140,7 +140,8 @@ BehaviorPathPlannerNode::BehaviorPathPlannerNode(const rclcpp::NodeOptions & nod
     const std::lock_guard<std::mutex> lock(mutex_manager_);  // for planner_manager_
 
     const auto & p = planner_data_->parameters;
-    planner_manager_ = std::make_shared<PlannerManager>(*this, p.max_iteration_num, p.verbose);
+    planner_manager_ = std::make_shared<PlannerManager>(
+      *this, p.max_iteration_num, p.verbose, p.enable_parallel_request_modules);
 
     const auto register_and_create_publisher =
       [&](const auto & manager, const bool create_publishers) {
@@ -281,6 +282,8 @@ BehaviorPathPlannerParameters BehaviorPathPlannerNode::getCommonParam()
 
   p.verbose = declare_parameter<bool>("verbose");
   p.max_iteration_num = declare_parameter<int>("max_iteration_num");
+  p.enable_parallel_request_modules =
+    declare_parameter<bool>("enable_parallel_request_modules", false);
   p.traffic_light_signal_timeout = declare_parameter<double>("traffic_light_signal_timeout");
 
   const auto get_scene_module_manager_param = [&](std::string && ns) {
@@ -23,17 +23,22 @@
 
 #include <boost/format.hpp>
 
+#include <exception>
 #include <memory>
 #include <string>
+#include <thread>
+#include <unordered_map>
 
 namespace behavior_path_planner
 {
 PlannerManager::PlannerManager(
-  rclcpp::Node & node, const size_t max_iteration_num, const bool verbose)
+  rclcpp::Node & node, const size_t max_iteration_num, const bool verbose,
+  const bool enable_parallel_request_modules)
 : logger_(node.get_logger().get_child("planner_manager")),
   clock_(*node.get_clock()),
   max_iteration_num_{max_iteration_num},
-  verbose_{verbose}
+  verbose_{verbose},
+  enable_parallel_request_modules_{enable_parallel_request_modules}
 {
   processing_time_.emplace("total_time", 0.0);
   debug_publisher_ptr_ = std::make_unique<DebugPublisher>(&node, "~/debug");
@@ -44,6 +49,7 @@ BehaviorModuleOutput PlannerManager::run(const std::shared_ptr<PlannerData> & da
   resetProcessingTime();
   stop_watch_.tic("total_time");
   debug_info_.clear();
+  data->cache.clear();
 
   if (!root_lanelet_) {
     root_lanelet_ = updateRootLanelet(data);
@@ -486,7 +492,17 @@ std::pair<SceneModulePtr, BehaviorModuleOutput> PlannerManager::runRequestModule
         std::weak_ptr<SceneModuleInterface>(module_ptr), previous_module_output);
     }
 
-    results.emplace(module_ptr->name(), run(module_ptr, data, previous_module_output));
+    if (!enable_parallel_request_modules_) {
+      results.emplace(module_ptr->name(), run(module_ptr, data, previous_module_output));
+    }
+  }
+
+  if (enable_parallel_request_modules_) {
+    // the results are added in the priority order, which is the same as the sequential run.
+    const auto outputs = runInParallel(executable_modules, data, previous_module_output);
+    for (size_t i = 0; i < executable_modules.size(); ++i) {
+      results.emplace(executable_modules.at(i)->name(), outputs.at(i));
+    }
   }
 
   /**
@@ -922,6 +938,59 @@ std::shared_ptr<SceneModuleVisitor> PlannerManager::getDebugMsg()
   return debug_msg_ptr_;
 }
 
+std::vector<BehaviorModuleOutput> PlannerManager::runInParallel(
+  const std::vector<SceneModulePtr> & request_modules, const std::shared_ptr<PlannerData> & data,
+  const BehaviorModuleOutput & previous_module_output) const
+{
+  std::vector<BehaviorModuleOutput> outputs(request_modules.size());
+
+  // indices of the request modules grouped by the manager
+  std::vector<std::vector<size_t>> groups;
+  std::unordered_map<SceneModuleManagerPtr, size_t> group_indices;
+  for (size_t i = 0; i < request_modules.size(); ++i) {
+    const auto [itr, is_new_group] =
+      group_indices.emplace(getManager(request_modules.at(i)), groups.size());
+    if (is_new_group) {
+      groups.emplace_back();
+    }
+    groups.at(itr->second).push_back(i);
+  }
+
+  if (groups.empty()) {
+    return outputs;
+  }
+
+  std::vector<std::exception_ptr> exceptions(groups.size());
+  const auto run_group = [&](const size_t group_index) {
+    try {
+      for (const auto i : groups.at(group_index)) {
+        outputs.at(i) = run(request_modules.at(i), data, previous_module_output);
+      }
+    } catch (...) {
+      exceptions.at(group_index) = std::current_exception();
+    }
+  };
+
+  // the first group is run on this thread
+  std::vector<std::thread> threads;
+  threads.reserve(groups.size() - 1);
+  for (size_t group_index = 1; group_index < groups.size(); ++group_index) {
+    threads.emplace_back(run_group, group_index);
+  }
+  run_group(0);
+  for (auto & thread : threads) {
+    thread.join();
+  }
+
+  for (const auto & exception : exceptions) {
+    if (exception) {
+      std::rethrow_exception(exception);
+    }
+  }
+
+  return outputs;
+}
+
 std::string PlannerManager::getNames(const std::vector<SceneModulePtr> & modules) const
 {
   std::stringstream ss;
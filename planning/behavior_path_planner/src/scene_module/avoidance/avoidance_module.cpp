@@ -37,10 +37,12 @@
 #include <boost/geometry/strategies/cartesian/centroid_bashein_detmer.hpp>
 
 #include <algorithm>
+#include <iterator>
 #include <limits>
 #include <memory>
 #include <set>
 #include <string>
+#include <unordered_set>
 #include <vector>
 
 // set as macro so that calling function name will be printed.
@@ -337,13 +339,26 @@ void AvoidanceModule::fillAvoidanceTargetObjects(
     data.other_objects.push_back(other_object);
   }
 
+  // Drop the cached geometry of the objects which are not candidates anymore.
+  if (parameters_->enable_object_geometry_cache) {
+    std::unordered_set<std::string> object_ids;
+    for (const auto & object : object_within_target_lane.objects) {
+      object_ids.insert(toHexString(object.object_id));
+    }
+    for (auto itr = object_geometry_cache_.begin(); itr != object_geometry_cache_.end();) {
+      itr = object_ids.count(itr->first) == 0 ? object_geometry_cache_.erase(itr) : std::next(itr);
+    }
+  }
+
   ObjectDataArray objects;
   for (const auto & object : object_within_target_lane.objects) {
     objects.push_back(createObjectData(data, object));
   }
 
   // Filter out the objects to determine the ones to be avoided.
-  filterTargetObjects(objects, data, debug, planner_data_, parameters_);
+  filterTargetObjects(
+    objects, data, debug, planner_data_, parameters_,
+    parameters_->enable_object_geometry_cache ? &object_geometry_cache_ : nullptr);
 
   // Calculate the distance needed to safely decelerate the ego vehicle to a stop line.
   const auto feasible_stop_distance = helper_.getFeasibleDecelDistance(0.0, false);
@@ -395,22 +410,59 @@ ObjectData AvoidanceModule::createObjectData(
     std::clamp(calcDistance2d(getEgoPose(), object_pose) - lower, 0.0, upper) / upper;
   object_data.distance_factor = object_parameter.max_expand_ratio * clamp + 1.0;
 
-  // Calc envelop polygon.
-  utils::avoidance::fillObjectEnvelopePolygon(
-    object_data, registered_objects_, object_closest_pose, parameters_);
+  // Reuse the geometry while neither the object nor the path around it moves.
+  const auto & closest_path_point = path_points.at(object_closest_index);
+  const auto object_polygon = parameters_->enable_object_geometry_cache
+                                ? planner_data_->getObjectPolygon(object)
+                                : Polygon2d{};
+  const auto id = toHexString(object.object_id);
+  const auto cached_geometry = object_geometry_cache_.find(id);
+  const auto is_cached = parameters_->enable_object_geometry_cache &&
+                         cached_geometry != object_geometry_cache_.end() &&
+                         utils::avoidance::isObjectGeometryCacheValid(
+                           cached_geometry->second, object_polygon, closest_path_point,
+                           object_data.distance_factor,
+                           parameters_->object_geometry_cache_threshold);
+
+  if (is_cached) {
+    const auto & geometry = cached_geometry->second;
+    object_data.envelope_poly = geometry.envelope_poly;
+    object_data.centroid = geometry.centroid;
+    object_data.lateral = geometry.lateral;
+    object_data.overhang_dist = geometry.overhang_dist;
+    object_data.overhang_pose = geometry.overhang_pose;
+  } else {
+    // Calc envelop polygon.
+    utils::avoidance::fillObjectEnvelopePolygon(
+      object_data, registered_objects_, object_closest_pose, parameters_);
 
-  // calc object centroid.
-  object_data.centroid = return_centroid<Point2d>(object_data.envelope_poly);
+    // calc object centroid.
+    object_data.centroid = return_centroid<Point2d>(object_data.envelope_poly);
 
-  // Calc moving time.
-  utils::avoidance::fillObjectMovingTime(object_data, stopped_objects_, parameters_);
+    // Calc lateral deviation from path to target object.
+    object_data.lateral = calcLateralDeviation(object_closest_pose, object_pose.position);
+
+    // Find the footprint point closest to the path, set to object_data.overhang_distance.
+    object_data.overhang_dist = utils::avoidance::calcEnvelopeOverhangDistance(
+      object_data, data.reference_path, object_data.overhang_pose.position);
 
-  // Calc lateral deviation from path to target object.
-  object_data.lateral = calcLateralDeviation(object_closest_pose, object_pose.position);
+    if (parameters_->enable_object_geometry_cache) {
+      ObjectGeometryCache geometry{};
+      geometry.object_polygon = object_polygon;
+      geometry.closest_path_pose = object_closest_pose;
+      geometry.closest_path_lane_ids = closest_path_point.lane_ids;
+      geometry.distance_factor = object_data.distance_factor;
+      geometry.envelope_poly = object_data.envelope_poly;
+      geometry.centroid = object_data.centroid;
+      geometry.lateral = object_data.lateral;
+      geometry.overhang_dist = object_data.overhang_dist;
+      geometry.overhang_pose = object_data.overhang_pose;
+      object_geometry_cache_[id] = geometry;
+    }
+  }
 
-  // Find the footprint point closest to the path, set to object_data.overhang_distance.
-  object_data.overhang_dist = utils::avoidance::calcEnvelopeOverhangDistance(
-    object_data, data.reference_path, object_data.overhang_pose.position);
+  // Calc moving time.
+  utils::avoidance::fillObjectMovingTime(object_data, stopped_objects_, parameters_);
 
   // Check whether the the ego should avoid the object.
   const auto & vehicle_width = planner_data_->parameters.vehicle_width;
@@ -2534,6 +2586,7 @@ void AvoidanceModule::initVariables()
   original_unique_id = 0;
   is_avoidance_maneuver_starts = false;
   arrived_path_end_ = false;
+  object_geometry_cache_.clear();
 }
 
 void AvoidanceModule::initRTCStatus()
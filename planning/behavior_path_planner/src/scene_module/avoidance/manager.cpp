@@ -118,6 +118,12 @@ AvoidanceModuleManager::AvoidanceModuleManager(
       getOrDeclareParameter<double>(*node, ns + "object_last_seen_threshold");
   }
 
+  {
+    std::string ns = "avoidance.target_filtering.geometry_cache.";
+    p.enable_object_geometry_cache = getOrDeclareParameter<bool>(*node, ns + "enable");
+    p.object_geometry_cache_threshold = getOrDeclareParameter<double>(*node, ns + "threshold");
+  }
+
   {
     std::string ns = "avoidance.target_filtering.force_avoidance.";
     p.enable_force_avoidance_for_stopped_vehicle =
@@ -32,9 +32,11 @@
 #include <rclcpp/rclcpp.hpp>
 
 #include <algorithm>
+#include <exception>
 #include <limits>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -167,11 +169,53 @@ void GoalPlannerModule::onTimer()
   std::vector<PullOverPath> path_candidates{};
   std::optional<Pose> closest_start_pose{};
   double min_start_arc_length = std::numeric_limits<double>::max();
-  const auto planCandidatePaths = [&](
-                                    const std::shared_ptr<PullOverPlannerBase> & planner,
-                                    const GoalCandidate & goal_candidate) {
-    planner->setPlannerData(planner_data_);
-    auto pull_over_path = planner->plan(goal_candidate.goal_pose);
+
+  // A planner is not shared among threads, so the planners are run in parallel with each other
+  // and each of them plans for the goal candidates in order.
+  std::vector<std::vector<boost::optional<PullOverPath>>> planned_paths(
+    pull_over_planners_.size());
+  if (parameters_->enable_parallel_path_planning) {
+    std::vector<std::exception_ptr> exceptions(pull_over_planners_.size());
+    const auto plan_all_goals = [&](const size_t planner_index) {
+      try {
+        const auto & planner = pull_over_planners_.at(planner_index);
+        planner->setPlannerData(planner_data_);
+        auto & paths = planned_paths.at(planner_index);
+        paths.reserve(goal_candidates.size());
+        for (const auto & goal_candidate : goal_candidates) {
+          paths.push_back(planner->plan(goal_candidate.goal_pose));
+        }
+      } catch (...) {
+        exceptions.at(planner_index) = std::current_exception();
+      }
+    };
+    std::vector<std::thread> threads;
+    for (size_t i = 1; i < pull_over_planners_.size(); ++i) {
+      threads.emplace_back(plan_all_goals, i);
+    }
+    if (!pull_over_planners_.empty()) {
+      plan_all_goals(0);
+    }
+    for (auto & thread : threads) {
+      thread.join();
+    }
+    for (const auto & exception : exceptions) {
+      if (exception) {
+        std::rethrow_exception(exception);
+      }
+    }
+  }
+
+  const auto planCandidatePaths = [&](const size_t planner_index, const size_t goal_index) {
+    const auto & goal_candidate = goal_candidates.at(goal_index);
+    auto pull_over_path = std::invoke([&]() {
+      if (parameters_->enable_parallel_path_planning) {
+        return planned_paths.at(planner_index).at(goal_index);
+      }
+      const auto & planner = pull_over_planners_.at(planner_index);
+      planner->setPlannerData(planner_data_);
+      return planner->plan(goal_candidate.goal_pose);
+    });
     if (pull_over_path && isCrossingPossible(*pull_over_path)) {
       pull_over_path->goal_id = goal_candidate.id;
       path_candidates.push_back(*pull_over_path);
@@ -187,15 +231,15 @@ void GoalPlannerModule::onTimer()
   };
   // plan candidate paths and set them to the member variable
   if (parameters_->path_priority == "efficient_path") {
-    for (const auto & planner : pull_over_planners_) {
-      for (const auto & goal_candidate : goal_candidates) {
-        planCandidatePaths(planner, goal_candidate);
+    for (size_t i = 0; i < pull_over_planners_.size(); ++i) {
+      for (size_t j = 0; j < goal_candidates.size(); ++j) {
+        planCandidatePaths(i, j);
       }
     }
   } else if (parameters_->path_priority == "close_goal") {
-    for (const auto & goal_candidate : goal_candidates) {
-      for (const auto & planner : pull_over_planners_) {
-        planCandidatePaths(planner, goal_candidate);
+    for (size_t j = 0; j < goal_candidates.size(); ++j) {
+      for (size_t i = 0; i < pull_over_planners_.size(); ++i) {
+        planCandidatePaths(i, j);
       }
     }
   } else {
@@ -273,6 +317,7 @@ void GoalPlannerModule::initializeOccupancyGridMap()
     planner_data_->parameters.base_link2rear + margin;
   occupancy_grid_map_param.theta_size = parameters_->theta_size;
   occupancy_grid_map_param.obstacle_threshold = parameters_->obstacle_threshold;
+  occupancy_grid_map_param.use_distance_field = parameters_->use_occupancy_grid_distance_field;
   occupancy_grid_map_->setParam(occupancy_grid_map_param);
 }
 
@@ -1360,7 +1405,7 @@ bool GoalPlannerModule::checkCollision(const PathWithLaneId & path) const
     pull_over_lane_objects, parameters_->th_moving_object_velocity);
   std::vector<Polygon2d> obj_polygons;
   for (const auto & object : pull_over_lane_stop_objects.objects) {
-    obj_polygons.push_back(tier4_autoware_utils::toPolygon2d(object));
+    obj_polygons.push_back(planner_data_->getObjectPolygon(object));
   }
 
   std::vector<Polygon2d> ego_polygons_expanded;
@@ -86,6 +86,8 @@ GoalPlannerModuleManager::GoalPlannerModuleManager(
       node->declare_parameter<bool>(ns + "use_occupancy_grid_for_goal_longitudinal_margin");
     p.occupancy_grid_collision_check_margin =
       node->declare_parameter<double>(ns + "occupancy_grid_collision_check_margin");
+    p.use_occupancy_grid_distance_field =
+      node->declare_parameter<bool>(ns + "use_occupancy_grid_distance_field", false);
     p.theta_size = node->declare_parameter<int>(ns + "theta_size");
     p.obstacle_threshold = node->declare_parameter<int>(ns + "obstacle_threshold");
   }
@@ -116,6 +118,8 @@ GoalPlannerModuleManager::GoalPlannerModuleManager(
     p.path_priority = node->declare_parameter<std::string>(ns + "path_priority");
     p.efficient_path_order =
       node->declare_parameter<std::vector<std::string>>(ns + "efficient_path_order");
+    p.enable_parallel_path_planning =
+      node->declare_parameter<bool>(ns + "enable_parallel_path_planning", false);
   }
 
   // shift parking
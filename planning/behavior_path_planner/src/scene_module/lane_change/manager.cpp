@@ -48,6 +48,8 @@ LaneChangeModuleManager::LaneChangeModuleManager(
     getOrDeclareParameter<int>(*node, parameter("longitudinal_acceleration_sampling_num"));
   p.lateral_acc_sampling_num =
     getOrDeclareParameter<int>(*node, parameter("lateral_acceleration_sampling_num"));
+  p.enable_parallel_path_generation =
+    getOrDeclareParameter<bool>(*node, parameter("enable_parallel_path_generation"));
 
   // parked vehicle detection
   p.object_check_min_road_shoulder_width =
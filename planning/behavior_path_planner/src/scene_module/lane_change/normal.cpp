@@ -29,9 +29,11 @@
 #include <lanelet2_core/geometry/Polygon.h>
 
 #include <algorithm>
+#include <exception>
 #include <limits>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -1148,184 +1150,271 @@ bool NormalLaneChange::getLaneChangePaths(
     logger_, "lane change sampling start. Sampling num for prep_time: %lu, acc: %lu",
     prepare_durations.size(), longitudinal_acc_sampling_values.size());
 
-  for (const auto & prepare_duration : prepare_durations) {
-    for (const auto & sampled_longitudinal_acc : longitudinal_acc_sampling_values) {
-      const auto debug_print = [&](const auto & s) {
-        RCLCPP_DEBUG_STREAM(
-          logger_, "  -  " << s << " : prep_time = " << prepare_duration
-                           << ", lon_acc = " << sampled_longitudinal_acc);
-      };
+  const auto target_lane_polygon =
+    lanelet::utils::getPolygonFromArcLength(target_lanes, 0, std::numeric_limits<double>::max());
+  const auto target_lane_poly_2d = lanelet::utils::to2D(target_lane_polygon).basicPolygon();
+
+  const double s_goal =
+    is_goal_in_route
+      ? lanelet::utils::getArcCoordinates(target_lanes, route_handler.getGoalPose()).length
+      : 0.0;
+  const double backward_buffer =
+    is_goal_in_route &&
+        std::abs(route_handler.getNumLaneToPreferredLane(target_lanes.back(), direction)) != 0
+      ? common_parameters.backward_length_buffer_for_end_of_lane
+      : 0.0;
+
+  // the candidates do not depend on the objects, thus they are generated without the safety check
+  const auto generate_candidates = [&](
+                                     const double prepare_duration,
+                                     const double sampled_longitudinal_acc) {
+    LaneChangeCandidates candidates{};
+
+    const auto debug_print = [&](const auto & s) {
+      RCLCPP_DEBUG_STREAM(
+        logger_, "  -  " << s << " : prep_time = " << prepare_duration
+                         << ", lon_acc = " << sampled_longitudinal_acc);
+    };
 
-      // get path on original lanes
-      const auto prepare_velocity = std::max(
-        current_velocity + sampled_longitudinal_acc * prepare_duration,
-        minimum_lane_changing_velocity);
+    // get path on original lanes
+    const auto prepare_velocity = std::max(
+      current_velocity + sampled_longitudinal_acc * prepare_duration,
+      minimum_lane_changing_velocity);
 
-      // compute actual longitudinal acceleration
-      const double longitudinal_acc_on_prepare =
-        (prepare_duration < 1e-3) ? 0.0
-                                  : ((prepare_velocity - current_velocity) / prepare_duration);
+    // compute actual longitudinal acceleration
+    const double longitudinal_acc_on_prepare =
+      (prepare_duration < 1e-3) ? 0.0 : ((prepare_velocity - current_velocity) / prepare_duration);
 
-      const double prepare_length =
-        current_velocity * prepare_duration +
-        0.5 * longitudinal_acc_on_prepare * std::pow(prepare_duration, 2);
+    const double prepare_length = current_velocity * prepare_duration +
+                                  0.5 * longitudinal_acc_on_prepare * std::pow(prepare_duration, 2);
 
-      auto prepare_segment = getPrepareSegment(current_lanes, backward_path_length, prepare_length);
+    auto prepare_segment = getPrepareSegment(current_lanes, backward_path_length, prepare_length);
 
-      if (prepare_segment.points.empty()) {
-        debug_print("prepare segment is empty...? Unexpected.");
-        continue;
-      }
+    if (prepare_segment.points.empty()) {
+      debug_print("prepare segment is empty...? Unexpected.");
+      return candidates;
+    }
 
-      // lane changing start getEgoPose() is at the end of prepare segment
-      const auto & lane_changing_start_pose = prepare_segment.points.back().point.pose;
-      const auto target_length_from_lane_change_start_pose = utils::getArcLengthToTargetLanelet(
-        current_lanes, target_lanes.front(), lane_changing_start_pose);
+    // lane changing start getEgoPose() is at the end of prepare segment
+    const auto & lane_changing_start_pose = prepare_segment.points.back().point.pose;
+    const auto target_length_from_lane_change_start_pose = utils::getArcLengthToTargetLanelet(
+      current_lanes, target_lanes.front(), lane_changing_start_pose);
 
-      // Check if the lane changing start point is not on the lanes next to target lanes,
-      if (target_length_from_lane_change_start_pose > 0.0) {
-        debug_print("lane change start getEgoPose() is behind target lanelet!");
-        break;
-      }
+    // Check if the lane changing start point is not on the lanes next to target lanes,
+    if (target_length_from_lane_change_start_pose > 0.0) {
+      debug_print("lane change start getEgoPose() is behind target lanelet!");
+      candidates.is_start_behind_target_lanes = true;
+      return candidates;
+    }
 
-      const auto shift_length =
-        lanelet::utils::getLateralDistanceToClosestLanelet(target_lanes, lane_changing_start_pose);
+    // the start point is common to the lateral acceleration samples, thus it is checked once
+    // before any of them is generated
+    const lanelet::BasicPoint2d lc_start_point(
+      lane_changing_start_pose.position.x, lane_changing_start_pose.position.y);
+    const auto is_valid_start_point =
+      boost::geometry::covered_by(lc_start_point, target_neighbor_preferred_lane_poly_2d) ||
+      boost::geometry::covered_by(lc_start_point, target_lane_poly_2d);
+    if (!is_valid_start_point) {
+      debug_print(
+        "Reject: lane changing points are not inside of the target preferred lanes or its "
+        "neighbors");
+      return candidates;
+    }
 
-      const auto initial_lane_changing_velocity = prepare_velocity;
-      const auto max_path_velocity = prepare_segment.points.back().point.longitudinal_velocity_mps;
+    const auto shift_length =
+      lanelet::utils::getLateralDistanceToClosestLanelet(target_lanes, lane_changing_start_pose);
 
-      // get lateral acceleration range
-      const auto [min_lateral_acc, max_lateral_acc] =
-        common_parameters.lane_change_lat_acc_map.find(initial_lane_changing_velocity);
-      const auto lateral_acc_resolution =
-        std::abs(max_lateral_acc - min_lateral_acc) / lateral_acc_sampling_num;
+    const auto initial_lane_changing_velocity = prepare_velocity;
+    const auto max_path_velocity = prepare_segment.points.back().point.longitudinal_velocity_mps;
 
-      std::vector<double> sample_lat_acc;
-      constexpr double eps = 0.01;
-      for (double a = min_lateral_acc; a < max_lateral_acc + eps; a += lateral_acc_resolution) {
-        sample_lat_acc.push_back(a);
-      }
-      RCLCPP_DEBUG(logger_, "  -  sampling num for lat_acc: %lu", sample_lat_acc.size());
+    // get lateral acceleration range
+    const auto [min_lateral_acc, max_lateral_acc] =
+      common_parameters.lane_change_lat_acc_map.find(initial_lane_changing_velocity);
+    const auto lateral_acc_resolution =
+      std::abs(max_lateral_acc - min_lateral_acc) / lateral_acc_sampling_num;
 
-      for (const auto & lateral_acc : sample_lat_acc) {
-        const auto debug_print = [&](const auto & s) {
-          RCLCPP_DEBUG_STREAM(
-            logger_, "    -  " << s << " : prep_time = " << prepare_duration << ", lon_acc = "
-                               << sampled_longitudinal_acc << ", lat_acc = " << lateral_acc);
-        };
+    std::vector<double> sample_lat_acc;
+    constexpr double eps = 0.01;
+    for (double a = min_lateral_acc; a < max_lateral_acc + eps; a += lateral_acc_resolution) {
+      sample_lat_acc.push_back(a);
+    }
+    RCLCPP_DEBUG(logger_, "  -  sampling num for lat_acc: %lu", sample_lat_acc.size());
+
+    const double s_start =
+      is_goal_in_route
+        ? lanelet::utils::getArcCoordinates(target_lanes, lane_changing_start_pose).length
+        : 0.0;
 
-        const auto lane_changing_time = PathShifter::calcShiftTimeFromJerk(
-          shift_length, common_parameters.lane_changing_lateral_jerk, lateral_acc);
-        const double longitudinal_acc_on_lane_changing =
-          utils::lane_change::calcLaneChangingAcceleration(
-            initial_lane_changing_velocity, max_path_velocity, lane_changing_time,
-            sampled_longitudinal_acc);
-        const auto lane_changing_length =
-          initial_lane_changing_velocity * lane_changing_time +
-          0.5 * longitudinal_acc_on_lane_changing * lane_changing_time * lane_changing_time;
-        const auto terminal_lane_changing_velocity =
-          initial_lane_changing_velocity + longitudinal_acc_on_lane_changing * lane_changing_time;
-        utils::lane_change::setPrepareVelocity(
-          prepare_segment, current_velocity, terminal_lane_changing_velocity);
-
-        if (lane_changing_length + prepare_length > dist_to_end_of_current_lanes) {
+    for (const auto & lateral_acc : sample_lat_acc) {
+      const auto debug_print = [&](const auto & s) {
+        RCLCPP_DEBUG_STREAM(
+          logger_, "    -  " << s << " : prep_time = " << prepare_duration << ", lon_acc = "
+                             << sampled_longitudinal_acc << ", lat_acc = " << lateral_acc);
+      };
+
+      const auto lane_changing_time = PathShifter::calcShiftTimeFromJerk(
+        shift_length, common_parameters.lane_changing_lateral_jerk, lateral_acc);
+      const double longitudinal_acc_on_lane_changing =
+        utils::lane_change::calcLaneChangingAcceleration(
+          initial_lane_changing_velocity, max_path_velocity, lane_changing_time,
+          sampled_longitudinal_acc);
+      const auto lane_changing_length =
+        initial_lane_changing_velocity * lane_changing_time +
+        0.5 * longitudinal_acc_on_lane_changing * lane_changing_time * lane_changing_time;
+      const auto terminal_lane_changing_velocity =
+        initial_lane_changing_velocity + longitudinal_acc_on_lane_changing * lane_changing_time;
+      utils::lane_change::setPrepareVelocity(
+        prepare_segment, current_velocity, terminal_lane_changing_velocity);
+
+      if (lane_changing_length + prepare_length > dist_to_end_of_current_lanes) {
+        debug_print("Reject: length of lane changing path is longer than length to goal!!");
+        continue;
+      }
+
+      if (is_goal_in_route) {
+        const double finish_judge_buffer = common_parameters.lane_change_finish_judge_buffer;
+        if (
+          s_start + lane_changing_length + finish_judge_buffer + backward_buffer +
+            next_lane_change_buffer >
+          s_goal) {
           debug_print("Reject: length of lane changing path is longer than length to goal!!");
           continue;
         }
+      }
 
-        if (is_goal_in_route) {
-          const double s_start =
-            lanelet::utils::getArcCoordinates(target_lanes, lane_changing_start_pose).length;
-          const double s_goal =
-            lanelet::utils::getArcCoordinates(target_lanes, route_handler.getGoalPose()).length;
-          const auto num =
-            std::abs(route_handler.getNumLaneToPreferredLane(target_lanes.back(), direction));
-          const double backward_buffer =
-            num == 0 ? 0.0 : common_parameters.backward_length_buffer_for_end_of_lane;
-          const double finish_judge_buffer = common_parameters.lane_change_finish_judge_buffer;
-          if (
-            s_start + lane_changing_length + finish_judge_buffer + backward_buffer +
-              next_lane_change_buffer >
-            s_goal) {
-            debug_print("Reject: length of lane changing path is longer than length to goal!!");
-            continue;
-          }
-        }
+      const auto target_segment = getTargetSegment(
+        target_lanes, lane_changing_start_pose, target_lane_length, lane_changing_length,
+        initial_lane_changing_velocity, next_lane_change_buffer);
 
-        const auto target_segment = getTargetSegment(
-          target_lanes, lane_changing_start_pose, target_lane_length, lane_changing_length,
-          initial_lane_changing_velocity, next_lane_change_buffer);
+      if (target_segment.points.empty()) {
+        debug_print("Reject: target segment is empty!! something wrong...");
+        continue;
+      }
 
-        if (target_segment.points.empty()) {
-          debug_print("Reject: target segment is empty!! something wrong...");
-          continue;
-        }
+      LaneChangeInfo lane_change_info;
+      lane_change_info.longitudinal_acceleration =
+        LaneChangePhaseInfo{longitudinal_acc_on_prepare, longitudinal_acc_on_lane_changing};
+      lane_change_info.duration = LaneChangePhaseInfo{prepare_duration, lane_changing_time};
+      lane_change_info.velocity =
+        LaneChangePhaseInfo{prepare_velocity, initial_lane_changing_velocity};
+      lane_change_info.length = LaneChangePhaseInfo{prepare_length, lane_changing_length};
+      lane_change_info.current_lanes = current_lanes;
+      lane_change_info.target_lanes = target_lanes;
+      lane_change_info.lane_changing_start = prepare_segment.points.back().point.pose;
+      lane_change_info.lane_changing_end = target_segment.points.front().point.pose;
+      lane_change_info.lateral_acceleration = lateral_acc;
+      lane_change_info.terminal_lane_changing_velocity = terminal_lane_changing_velocity;
+
+      const auto resample_interval = utils::lane_change::calcLaneChangeResampleInterval(
+        lane_changing_length, initial_lane_changing_velocity);
+      const auto target_lane_reference_path = utils::lane_change::getReferencePathFromTargetLane(
+        route_handler, target_lanes, lane_changing_start_pose, target_lane_length,
+        lane_changing_length, forward_path_length, resample_interval, is_goal_in_route,
+        next_lane_change_buffer);
+
+      if (target_lane_reference_path.points.empty()) {
+        debug_print("Reject: target_lane_reference_path is empty!!");
+        continue;
+      }
 
-        const lanelet::BasicPoint2d lc_start_point(
-          prepare_segment.points.back().point.pose.position.x,
-          prepare_segment.points.back().point.pose.position.y);
-
-        const auto target_lane_polygon = lanelet::utils::getPolygonFromArcLength(
-          target_lanes, 0, std::numeric_limits<double>::max());
-        const auto target_lane_poly_2d = lanelet::utils::to2D(target_lane_polygon).basicPolygon();
-
-        const auto is_valid_start_point =
-          boost::geometry::covered_by(lc_start_point, target_neighbor_preferred_lane_poly_2d) ||
-          boost::geometry::covered_by(lc_start_point, target_lane_poly_2d);
-
-        LaneChangeInfo lane_change_info;
-        lane_change_info.longitudinal_acceleration =
-          LaneChangePhaseInfo{longitudinal_acc_on_prepare, longitudinal_acc_on_lane_changing};
-        lane_change_info.duration = LaneChangePhaseInfo{prepare_duration, lane_changing_time};
-        lane_change_info.velocity =
-          LaneChangePhaseInfo{prepare_velocity, initial_lane_changing_velocity};
-        lane_change_info.length = LaneChangePhaseInfo{prepare_length, lane_changing_length};
-        lane_change_info.current_lanes = current_lanes;
-        lane_change_info.target_lanes = target_lanes;
-        lane_change_info.lane_changing_start = prepare_segment.points.back().point.pose;
-        lane_change_info.lane_changing_end = target_segment.points.front().point.pose;
-        lane_change_info.lateral_acceleration = lateral_acc;
-        lane_change_info.terminal_lane_changing_velocity = terminal_lane_changing_velocity;
-
-        if (!is_valid_start_point) {
-          debug_print(
-            "Reject: lane changing points are not inside of the target preferred lanes or its "
-            "neighbors");
-          continue;
-        }
+      lane_change_info.shift_line = utils::lane_change::getLaneChangingShiftLine(
+        prepare_segment, target_segment, target_lane_reference_path, shift_length);
 
-        const auto resample_interval = utils::lane_change::calcLaneChangeResampleInterval(
-          lane_changing_length, initial_lane_changing_velocity);
-        const auto target_lane_reference_path = utils::lane_change::getReferencePathFromTargetLane(
-          route_handler, target_lanes, lane_changing_start_pose, target_lane_length,
-          lane_changing_length, forward_path_length, resample_interval, is_goal_in_route,
-          next_lane_change_buffer);
+      const auto candidate_path = utils::lane_change::constructCandidatePath(
+        lane_change_info, prepare_segment, target_segment, target_lane_reference_path,
+        sorted_lane_ids);
 
-        if (target_lane_reference_path.points.empty()) {
-          debug_print("Reject: target_lane_reference_path is empty!!");
-          continue;
-        }
+      if (!candidate_path) {
+        debug_print("Reject: failed to generate candidate path!!");
+        continue;
+      }
 
-        lane_change_info.shift_line = utils::lane_change::getLaneChangingShiftLine(
-          prepare_segment, target_segment, target_lane_reference_path, shift_length);
+      if (!hasEnoughLength(*candidate_path, current_lanes, target_lanes, direction)) {
+        debug_print("Reject: invalid candidate path!!");
+        continue;
+      }
 
-        const auto candidate_path = utils::lane_change::constructCandidatePath(
-          lane_change_info, prepare_segment, target_segment, target_lane_reference_path,
-          sorted_lane_ids);
+      candidates.paths.push_back(*candidate_path);
+    }
 
-        if (!candidate_path) {
-          debug_print("Reject: failed to generate candidate path!!");
-          continue;
-        }
+    return candidates;
+  };
 
-        if (!hasEnoughLength(*candidate_path, current_lanes, target_lanes, direction)) {
-          debug_print("Reject: invalid candidate path!!");
-          continue;
+  LaneChangeCandidateCacheKey cache_key{};
+  cache_key.ego_pose = getEgoPose();
+  cache_key.ego_velocity = current_velocity;
+  cache_key.route_header = route_handler.getRouteHeader();
+  cache_key.route_uuid = route_handler.getRouteUuid();
+  cache_key.current_lane_ids = utils::getIds(current_lanes);
+  cache_key.target_lane_ids = utils::getIds(target_lanes);
+  cache_key.direction = direction;
+  cache_key.reference_path = prev_module_path_;
+  cache_key.prepare_durations = prepare_durations;
+  cache_key.longitudinal_acc_values = longitudinal_acc_sampling_values;
+  if (!(candidate_cache_.key == cache_key)) {
+    candidate_cache_.key = std::move(cache_key);
+    candidate_cache_.candidates.assign(
+      prepare_durations.size() * longitudinal_acc_sampling_values.size(), std::nullopt);
+  }
+  auto & cached_candidates = candidate_cache_.candidates;
+  const auto get_candidates = [&](const size_t i, const size_t j) -> const LaneChangeCandidates & {
+    auto & candidates = cached_candidates.at(i * longitudinal_acc_sampling_values.size() + j);
+    if (!candidates) {
+      candidates = generate_candidates(
+        prepare_durations.at(i), longitudinal_acc_sampling_values.at(j));
+    }
+    return *candidates;
+  };
+
+  // all the candidates are generated at once, and are checked in the same order as they would be
+  // if they were generated one by one
+  if (lane_change_parameters_->enable_parallel_path_generation) {
+    std::vector<std::exception_ptr> exceptions(cached_candidates.size());
+    std::vector<std::thread> threads;
+    for (size_t k = 0; k < cached_candidates.size(); ++k) {
+      if (cached_candidates.at(k)) {
+        continue;
+      }
+      threads.emplace_back([&, k]() {
+        try {
+          get_candidates(
+            k / longitudinal_acc_sampling_values.size(),
+            k % longitudinal_acc_sampling_values.size());
+        } catch (...) {
+          exceptions.at(k) = std::current_exception();
         }
+      });
+    }
+    for (auto & thread : threads) {
+      thread.join();
+    }
+    for (const auto & exception : exceptions) {
+      if (exception) {
+        std::rethrow_exception(exception);
+      }
+    }
+  }
+
+  const auto filtered_objects = filterObjectsInTargetLane(target_objects, target_lanes);
+
+  for (size_t i = 0; i < prepare_durations.size(); ++i) {
+    for (size_t j = 0; j < longitudinal_acc_sampling_values.size(); ++j) {
+      const auto & candidates = get_candidates(i, j);
+      if (candidates.is_start_behind_target_lanes) {
+        break;
+      }
+
+      for (const auto & candidate_path : candidates.paths) {
+        const auto debug_print = [&](const auto & s) {
+          RCLCPP_DEBUG_STREAM(
+            logger_, "    -  " << s << " : prep_time = " << prepare_durations.at(i)
+                               << ", lon_acc = " << longitudinal_acc_sampling_values.at(j)
+                               << ", lat_acc = " << candidate_path.info.lateral_acceleration);
+        };
 
         if (
           lane_change_parameters_->regulate_on_crosswalk &&
-          !hasEnoughLengthToCrosswalk(*candidate_path, current_lanes)) {
+          !hasEnoughLengthToCrosswalk(candidate_path, current_lanes)) {
           if (getStopTime() < lane_change_parameters_->stop_time_threshold) {
             debug_print("Reject: including crosswalk!!");
             continue;
@@ -1336,7 +1425,7 @@ bool NormalLaneChange::getLaneChangePaths(
 
         if (
           lane_change_parameters_->regulate_on_intersection &&
-          !hasEnoughLengthToIntersection(*candidate_path, current_lanes)) {
+          !hasEnoughLengthToIntersection(candidate_path, current_lanes)) {
           if (getStopTime() < lane_change_parameters_->stop_time_threshold) {
             debug_print("Reject: including intersection!!");
             continue;
@@ -1345,13 +1434,11 @@ bool NormalLaneChange::getLaneChangePaths(
             logger_, "Stop time is over threshold. Allow lane change in intersection.");
         }
 
-        candidate_paths->push_back(*candidate_path);
+        candidate_paths->push_back(candidate_path);
 
-        std::vector<ExtendedPredictedObject> filtered_objects =
-          filterObjectsInTargetLane(target_objects, target_lanes);
         if (
           !is_stuck && utils::lane_change::passParkedObject(
-                         route_handler, *candidate_path, filtered_objects, lane_change_buffer,
+                         route_handler, candidate_path, filtered_objects, lane_change_buffer,
                          is_goal_in_route, *lane_change_parameters_, object_debug_)) {
           debug_print(
             "Reject: parking vehicle exists in the target lane, and the ego is not in stuck. Skip "
@@ -1365,7 +1452,7 @@ bool NormalLaneChange::getLaneChangePaths(
         }
 
         const auto [is_safe, is_object_coming_from_rear] = isLaneChangePathSafe(
-          *candidate_path, target_objects, rss_params, is_stuck, object_debug_);
+          candidate_path, target_objects, rss_params, is_stuck, object_debug_);
 
         if (is_safe) {
           debug_print("ACCEPT!!!: it is valid and safe!");
@@ -31,8 +31,10 @@
 #include <lanelet2_core/geometry/Lanelet.h>
 
 #include <algorithm>
+#include <atomic>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -503,12 +505,55 @@ void StartPlannerModule::planWithPriority(
   const PriorityOrder order_priority =
     determinePriorityOrder(search_priority, start_pose_candidates.size());
 
-  for (const auto & [index, planner] : order_priority) {
-    if (findPullOutPath(start_pose_candidates, index, planner, refined_start_pose, goal_pose))
+  // The planners do not share any state, so each planner searches its own candidates on its own
+  // thread in the priority order. A search stops as soon as a candidate of a higher priority has
+  // been found, so the result is the same as the sequential search.
+  std::vector<boost::optional<PullOutCandidate>> candidates(order_priority.size());
+  std::atomic<size_t> found_priority{order_priority.size()};
+  const auto search = [&](const std::shared_ptr<PullOutPlannerBase> & planner) {
+    for (size_t priority = 0; priority < order_priority.size(); ++priority) {
+      if (found_priority.load() < priority) {
+        return;
+      }
+      const auto & [index, candidate_planner] = order_priority.at(priority);
+      if (candidate_planner != planner) {
+        continue;
+      }
+      candidates.at(priority) =
+        planPullOutCandidate(start_pose_candidates, index, planner, refined_start_pose, goal_pose);
+      if (!candidates.at(priority)) {
+        continue;
+      }
+      size_t current = found_priority.load();
+      while (priority < current && !found_priority.compare_exchange_weak(current, priority)) {
+      }
       return;
+    }
+  };
+
+  for (const auto & planner : start_planners_) {
+    planner->setPlannerData(planner_data_);
+  }
+  std::vector<std::thread> threads;
+  for (size_t i = 1; i < start_planners_.size(); ++i) {
+    threads.emplace_back(search, start_planners_.at(i));
+  }
+  if (!start_planners_.empty()) {
+    search(start_planners_.front());
+  }
+  for (auto & thread : threads) {
+    thread.join();
+  }
+
+  if (found_priority.load() == order_priority.size()) {
+    updateStatusIfNoSafePathFound();
+    return;
   }
 
-  updateStatusIfNoSafePathFound();
+  const auto & candidate = *candidates.at(found_priority.load());
+  candidate.driving_forward
+    ? updateStatusWithCurrentPath(candidate.path, candidate.start_pose, candidate.planner_type)
+    : updateStatusWithNextPath(candidate.path, candidate.start_pose, candidate.planner_type);
 }
 
 PriorityOrder StartPlannerModule::determinePriorityOrder(
@@ -538,41 +583,56 @@ bool StartPlannerModule::findPullOutPath(
   const std::vector<Pose> & start_pose_candidates, const size_t index,
   const std::shared_ptr<PullOutPlannerBase> & planner, const Pose & refined_start_pose,
   const Pose & goal_pose)
+{
+  planner->setPlannerData(planner_data_);
+  const auto candidate =
+    planPullOutCandidate(start_pose_candidates, index, planner, refined_start_pose, goal_pose);
+  if (!candidate) {
+    return false;
+  }
+
+  candidate->driving_forward
+    ? updateStatusWithCurrentPath(candidate->path, candidate->start_pose, candidate->planner_type)
+    : updateStatusWithNextPath(candidate->path, candidate->start_pose, candidate->planner_type);
+  return true;
+}
+
+boost::optional<PullOutCandidate> StartPlannerModule::planPullOutCandidate(
+  const std::vector<Pose> & start_pose_candidates, const size_t index,
+  const std::shared_ptr<PullOutPlannerBase> & planner, const Pose & refined_start_pose,
+  const Pose & goal_pose) const
 {
   // Ensure the index is within the bounds of the start_pose_candidates vector
-  if (index >= start_pose_candidates.size()) return false;
+  if (index >= start_pose_candidates.size()) return {};
 
   const Pose & pull_out_start_pose = start_pose_candidates.at(index);
   const bool is_driving_forward =
     tier4_autoware_utils::calcDistance2d(pull_out_start_pose, refined_start_pose) < 0.01;
 
-  planner->setPlannerData(planner_data_);
   const auto pull_out_path = planner->plan(pull_out_start_pose, goal_pose);
 
-  // If no path is found, return false
+  // If no path is found, return none
   if (!pull_out_path) {
-    return false;
+    return {};
   }
 
-  // If driving forward, update status with the current path and return true
+  // If driving forward, the current path is the candidate
   if (is_driving_forward) {
-    updateStatusWithCurrentPath(*pull_out_path, pull_out_start_pose, planner->getPlannerType());
-    return true;
+    return PullOutCandidate{*pull_out_path, pull_out_start_pose, planner->getPlannerType(), true};
   }
 
-  // If this is the last start pose candidate, return false
-  if (index == start_pose_candidates.size() - 1) return false;
+  // If this is the last start pose candidate, return none
+  if (index == start_pose_candidates.size() - 1) return {};
 
   const Pose & next_pull_out_start_pose = start_pose_candidates.at(index + 1);
   const auto next_pull_out_path = planner->plan(next_pull_out_start_pose, goal_pose);
 
-  // If no next path is found, return false
-  if (!next_pull_out_path) return false;
+  // If no next path is found, return none
+  if (!next_pull_out_path) return {};
 
-  // Update status with the next path and return true
-  updateStatusWithNextPath(
-    *next_pull_out_path, next_pull_out_start_pose, planner->getPlannerType());
-  return true;
+  // The next path is the candidate
+  return PullOutCandidate{
+    *next_pull_out_path, next_pull_out_start_pose, planner->getPlannerType(), false};
 }
 
 void StartPlannerModule::updateStatusWithCurrentPath(
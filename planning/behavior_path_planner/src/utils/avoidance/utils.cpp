@@ -796,6 +796,38 @@ void fillObjectEnvelopePolygon(
   object_data.envelope_poly = one_shot_envelope_poly;
 }
 
+bool isObjectGeometryCacheValid(
+  const ObjectGeometryCache & cache, const Polygon2d & object_polygon,
+  const PathPointWithLaneId & closest_path_point, const double distance_factor,
+  const double threshold)
+{
+  constexpr double DISTANCE_FACTOR_EPSILON = 1e-3;
+  if (std::abs(cache.distance_factor - distance_factor) > DISTANCE_FACTOR_EPSILON) {
+    return false;
+  }
+
+  // the reference path around the object
+  if (
+    cache.closest_path_lane_ids != closest_path_point.lane_ids ||
+    calcDistance2d(cache.closest_path_pose, closest_path_point.point.pose) > threshold) {
+    return false;
+  }
+
+  // every vertex of the object footprint, so that the rotation is also taken into account
+  const auto & cached_outer = cache.object_polygon.outer();
+  const auto & outer = object_polygon.outer();
+  if (cached_outer.size() != outer.size()) {
+    return false;
+  }
+  for (size_t i = 0; i < outer.size(); ++i) {
+    if (boost::geometry::distance(cached_outer.at(i), outer.at(i)) > threshold) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 void fillObjectMovingTime(
   ObjectData & object_data, ObjectDataArray & stopped_objects,
   const std::shared_ptr<AvoidanceParameters> & parameters)
@@ -1010,7 +1042,7 @@ void compensateDetectionLost(
 void filterTargetObjects(
   ObjectDataArray & objects, AvoidancePlanningData & data, DebugData & debug,
   const std::shared_ptr<const PlannerData> & planner_data,
-  const std::shared_ptr<AvoidanceParameters> & parameters)
+  const std::shared_ptr<AvoidanceParameters> & parameters, ObjectGeometryCacheMap * geometry_cache)
 {
   using boost::geometry::return_centroid;
   using boost::geometry::within;
@@ -1104,12 +1136,22 @@ void filterTargetObjects(
       continue;
     }
 
-    lanelet::ConstLanelet overhang_lanelet;
-    if (!rh->getClosestLaneletWithinRoute(object_closest_pose, &overhang_lanelet)) {
-      continue;
+    ObjectGeometryCache * cached_geometry = nullptr;
+    if (geometry_cache != nullptr) {
+      const auto itr = geometry_cache->find(toHexString(o.object.object_id));
+      if (itr != geometry_cache->end()) {
+        cached_geometry = &itr->second;
+      }
     }
 
-    if (overhang_lanelet.id()) {
+    lanelet::ConstLanelet overhang_lanelet;
+    if (cached_geometry != nullptr && cached_geometry->has_road_shoulder) {
+      o.overhang_lanelet = cached_geometry->overhang_lanelet;
+      o.to_road_shoulder_distance = cached_geometry->to_road_shoulder_distance;
+      debug.bounds.push_back(cached_geometry->road_shoulder_line);
+    } else if (!rh->getClosestLaneletWithinRoute(object_closest_pose, &overhang_lanelet)) {
+      continue;
+    } else if (overhang_lanelet.id()) {
       o.overhang_lanelet = overhang_lanelet;
       lanelet::BasicPoint3d overhang_basic_pose(
         o.overhang_pose.position.x, o.overhang_pose.position.y, o.overhang_pose.position.z);
@@ -1164,6 +1206,13 @@ void filterTargetObjects(
       }
 
       debug.bounds.push_back(target_line);
+
+      if (cached_geometry != nullptr) {
+        cached_geometry->has_road_shoulder = true;
+        cached_geometry->overhang_lanelet = o.overhang_lanelet;
+        cached_geometry->road_shoulder_line = target_line;
+        cached_geometry->to_road_shoulder_distance = o.to_road_shoulder_distance;
+      }
     }
 
     // calculate avoid_margin dynamically
@@ -1758,7 +1807,7 @@ std::pair<PredictedObjects, PredictedObjects> separateObjectsByPath(
 
   const auto objects = planner_data->dynamic_object->objects;
   std::for_each(objects.begin(), objects.end(), [&](const auto & object) {
-    const auto obj_polygon = tier4_autoware_utils::toPolygon2d(object);
+    const auto obj_polygon = planner_data->getObjectPolygon(object);
     if (boost::geometry::disjoint(obj_polygon, attention_area)) {
       other_objects.objects.push_back(object);
     } else {
@@ -29,17 +29,32 @@
 
 #include <boost/geometry.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <limits>
+#include <vector>
 
 namespace drivable_area_expansion
 {
 
 namespace
 {
+using Box2d = boost::geometry::model::box<Point2d>;
+
 Point2d convert_point(const Point & p)
 {
   return Point2d{p.x, p.y};
 }
+
+// lower bound of the distance between two geometries with these envelopes
+double calculate_envelope_distance(const Box2d & a, const Box2d & b)
+{
+  const auto dx = std::max(
+    {0.0, a.min_corner().x() - b.max_corner().x(), b.min_corner().x() - a.max_corner().x()});
+  const auto dy = std::max(
+    {0.0, a.min_corner().y() - b.max_corner().y(), b.min_corner().y() - a.max_corner().y()});
+  return std::hypot(dx, dy);
+}
 }  // namespace
 
 void reuse_previous_poses(
@@ -185,8 +200,12 @@ std::vector<double> calculate_maximum_distance(
   LineString2d bound_ls;
   for (const auto & p : bound) bound_ls.push_back(convert_point(p));
   for (const auto & p : path_poses) path_ls.push_back(convert_point(p.position));
+  std::vector<Box2d> uncrossable_poly_envelopes;
+  for (const auto & uncrossable_poly : uncrossable_polygons)
+    uncrossable_poly_envelopes.push_back(boost::geometry::return_envelope<Box2d>(uncrossable_poly));
   for (auto i = 0UL; i + 1 < bound_ls.size(); ++i) {
     const Segment2d segment_ls = {bound_ls[i], bound_ls[i + 1]};
+    const auto segment_envelope = boost::geometry::return_envelope<Box2d>(segment_ls);
     std::vector<Segment2d> query_result;
     boost::geometry::index::query(
       uncrossable_segments, boost::geometry::index::nearest(segment_ls, 1),
@@ -197,8 +216,17 @@ std::vector<double> calculate_maximum_distance(
       maximum_distances[i] = std::min(maximum_distances[i], dist_limit);
       maximum_distances[i + 1] = std::min(maximum_distances[i + 1], dist_limit);
     }
-    for (const auto & uncrossable_poly : uncrossable_polygons) {
-      const auto bound_to_poly_dist = boost::geometry::distance(segment_ls, uncrossable_poly);
+    for (auto poly_idx = 0UL; poly_idx < uncrossable_polygons.size(); ++poly_idx) {
+      // skip the polygons too far to reduce the distances, before calculating the exact distance
+      auto max_dist = std::max(maximum_distances[i], maximum_distances[i + 1]);
+      if (params.max_expansion_distance > 0.0)
+        max_dist = std::min(params.max_expansion_distance, max_dist);
+      if (
+        calculate_envelope_distance(segment_envelope, uncrossable_poly_envelopes[poly_idx]) >=
+        max_dist)
+        continue;
+      const auto bound_to_poly_dist =
+        boost::geometry::distance(segment_ls, uncrossable_polygons[poly_idx]);
       maximum_distances[i] = std::min(maximum_distances[i], bound_to_poly_dist);
       maximum_distances[i + 1] = std::min(maximum_distances[i + 1], bound_to_poly_dist);
     }
@@ -275,7 +303,8 @@ void expand_drivable_area(
   const auto & params = planner_data->drivable_area_expansion_parameters;
   const auto & route_handler = *planner_data->route_handler;
   const auto uncrossable_segments = extract_uncrossable_segments(
-    *route_handler.getLaneletMapPtr(), planner_data->self_odometry->pose.pose.position, params);
+    route_handler.getLaneletMapPtr(), planner_data->self_odometry->pose.pose.position, params,
+    planner_data->drivable_area_expansion_uncrossable_segments);
   const auto uncrossable_polygons = create_object_footprints(*planner_data->dynamic_object, params);
   const auto preprocessing_ms = stop_watch.toc("preprocessing");
 
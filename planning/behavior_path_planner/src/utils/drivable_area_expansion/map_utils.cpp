@@ -21,6 +21,8 @@
 #include <lanelet2_core/primitives/LineString.h>
 
 #include <algorithm>
+#include <iterator>
+#include <vector>
 
 namespace drivable_area_expansion
 {
@@ -46,6 +48,44 @@ SegmentRtree extract_uncrossable_segments(
   return uncrossable_segments_in_range;
 }
 
+SegmentRtree extract_uncrossable_segments(
+  const lanelet::LaneletMapConstPtr & lanelet_map_ptr, const Point & ego_point,
+  const DrivableAreaExpansionParameters & params, UncrossableSegmentsCache & cache)
+{
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  if (
+    cache.lanelet_map != lanelet_map_ptr ||
+    cache.linestring_types != params.avoid_linestring_types) {
+    std::vector<Segment2d> segments;
+    LineString2d line;
+    for (const auto & ls : lanelet_map_ptr->lineStringLayer) {
+      if (has_types(ls, params.avoid_linestring_types)) {
+        line.clear();
+        for (const auto & p : ls) line.push_back(Point2d{p.x(), p.y()});
+        for (auto segment_idx = 0LU; segment_idx + 1 < line.size(); ++segment_idx)
+          segments.push_back({line[segment_idx], line[segment_idx + 1]});
+      }
+    }
+    cache.segments = SegmentRtree(segments.begin(), segments.end());
+    cache.lanelet_map = lanelet_map_ptr;
+    cache.linestring_types = params.avoid_linestring_types;
+  }
+
+  const auto range = params.max_path_arc_length;
+  if (range <= 0.0) return {};
+  const auto ego_p = Point2d{ego_point.x, ego_point.y};
+  const boost::geometry::model::box<Point2d> range_box(
+    Point2d{ego_p.x() - range, ego_p.y() - range}, Point2d{ego_p.x() + range, ego_p.y() + range});
+  std::vector<Segment2d> segments_in_range;
+  cache.segments.query(
+    boost::geometry::index::intersects(range_box) &&
+      boost::geometry::index::satisfies([&](const Segment2d & segment) {
+        return boost::geometry::distance(segment, ego_p) < range;
+      }),
+    std::back_inserter(segments_in_range));
+  return SegmentRtree(segments_in_range.begin(), segments_in_range.end());
+}
+
 bool has_types(const lanelet::ConstLineString3d & ls, const std::vector<std::string> & types)
 {
   constexpr auto no_type = "";
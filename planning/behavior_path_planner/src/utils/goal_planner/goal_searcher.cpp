@@ -27,6 +27,8 @@
 
 #include <lanelet2_core/geometry/Polygon.h>
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
 #include <vector>
 
@@ -238,23 +240,33 @@ void GoalSearcher::countObjectsToAvoid(
     goal_candidate.num_objects_to_avoid = 0;
   }
 
+  // the footprints along the path and the goal arc lengths, which are the same for all objects
+  std::vector<LinearRing2d> transformed_vehicle_footprints;
+  transformed_vehicle_footprints.reserve(current_center_line_path.points.size());
+  for (const auto & p : current_center_line_path.points) {
+    transformed_vehicle_footprints.push_back(
+      transformVector(vehicle_footprint_, tier4_autoware_utils::pose2transform(p.point.pose)));
+  }
+  std::vector<double> s_goals;
+  s_goals.reserve(goal_candidates.size());
+  for (const auto & goal_candidate : goal_candidates) {
+    s_goals.push_back(
+      lanelet::utils::getArcCoordinates(current_lanes, goal_candidate.goal_pose).length);
+  }
+
   // count number of objects to avoid
   for (const auto & object : objects.objects) {
-    for (const auto & p : current_center_line_path.points) {
-      const auto transformed_vehicle_footprint =
-        transformVector(vehicle_footprint_, tier4_autoware_utils::pose2transform(p.point.pose));
-      const auto obj_polygon = tier4_autoware_utils::toPolygon2d(object);
+    const auto obj_polygon = planner_data_->getObjectPolygon(object);
+    for (const auto & transformed_vehicle_footprint : transformed_vehicle_footprints) {
       const double distance = boost::geometry::distance(obj_polygon, transformed_vehicle_footprint);
       if (distance > parameters_.object_recognition_collision_check_margin) {
         continue;
       }
       const Pose & object_pose = object.kinematics.initial_pose_with_covariance.pose;
       const double s_object = lanelet::utils::getArcCoordinates(current_lanes, object_pose).length;
-      for (auto & goal_candidate : goal_candidates) {
-        const Pose & goal_pose = goal_candidate.goal_pose;
-        const double s_goal = lanelet::utils::getArcCoordinates(current_lanes, goal_pose).length;
-        if (s_object < s_goal) {
-          goal_candidate.num_objects_to_avoid++;
+      for (size_t i = 0; i < goal_candidates.size(); ++i) {
+        if (s_object < s_goals.at(i)) {
+          goal_candidates.at(i).num_objects_to_avoid++;
         }
       }
       break;
@@ -289,12 +301,55 @@ void GoalSearcher::update(GoalCandidates & goal_candidates) const
       SortByLongitudinalDistance(parameters_.prioritize_goals_before_objects));
   }
 
+  // Only the objects around a goal candidate can collide with its footprint or be within its
+  // longitudinal margin, thus the others are not checked for the candidate. An object is bounded
+  // by the circle around its position which contains its polygon.
+  const double margin = parameters_.object_recognition_collision_check_margin;
+  double footprint_radius = 0.0;
+  for (const auto & p : vehicle_footprint_) {
+    footprint_radius = std::max(footprint_radius, std::hypot(p.x(), p.y()));
+  }
+  const double longitudinal_range = std::max(
+                                      std::abs(planner_data_->parameters.base_link2front),
+                                      std::abs(planner_data_->parameters.base_link2rear)) +
+                                    parameters_.longitudinal_margin;
+  const double lateral_range = planner_data_->parameters.vehicle_width / 2.0 + margin;
+  std::vector<double> object_radii;
+  object_radii.reserve(pull_over_lane_stop_objects.objects.size());
+  for (const auto & object : pull_over_lane_stop_objects.objects) {
+    const auto & position = object.kinematics.initial_pose_with_covariance.pose.position;
+    double radius = 0.0;
+    for (const auto & p : planner_data_->getObjectPolygon(object).outer()) {
+      radius = std::max(radius, std::hypot(p.x() - position.x, p.y() - position.y));
+    }
+    object_radii.push_back(radius);
+  }
+  const auto getObjectsAround = [&](const Pose & goal_pose) {
+    constexpr double eps = 1e-3;
+    PredictedObjects objects_around{};
+    objects_around.header = pull_over_lane_stop_objects.header;
+    for (size_t i = 0; i < pull_over_lane_stop_objects.objects.size(); ++i) {
+      const auto & object = pull_over_lane_stop_objects.objects.at(i);
+      const double radius = object_radii.at(i);
+      const double range = std::max(
+        footprint_radius + margin + radius,
+        std::hypot(longitudinal_range + radius, lateral_range + radius));
+      const double distance = tier4_autoware_utils::calcDistance2d(
+        goal_pose, object.kinematics.initial_pose_with_covariance.pose);
+      if (distance < range + eps) {
+        objects_around.objects.push_back(object);
+      }
+    }
+    return objects_around;
+  };
+
   // update is_safe
   for (auto & goal_candidate : goal_candidates) {
     const Pose goal_pose = goal_candidate.goal_pose;
+    const auto objects_around = getObjectsAround(goal_pose);
 
     // check collision with footprint
-    if (checkCollision(goal_pose, pull_over_lane_stop_objects)) {
+    if (checkCollision(goal_pose, objects_around)) {
       goal_candidate.is_safe = false;
       continue;
     }
@@ -302,8 +357,7 @@ void GoalSearcher::update(GoalCandidates & goal_candidates) const
     // check longitudinal margin with pull over lane objects
     constexpr bool filter_inside = true;
     const auto target_objects = goal_planner_utils::filterObjectsByLateralDistance(
-      goal_pose, planner_data_->parameters.vehicle_width, pull_over_lane_stop_objects,
-      parameters_.object_recognition_collision_check_margin, filter_inside);
+      goal_pose, planner_data_->parameters.vehicle_width, objects_around, margin, filter_inside);
     if (checkCollisionWithLongitudinalDistance(goal_pose, target_objects)) {
       goal_candidate.is_safe = false;
       continue;
@@ -17,6 +17,9 @@
 #include <tier4_autoware_utils/geometry/geometry.hpp>
 #include <tier4_autoware_utils/math/normalization.hpp>
 
+#include <algorithm>
+#include <cmath>
+#include <limits>
 #include <vector>
 
 namespace behavior_path_planner
@@ -25,6 +28,45 @@ using tier4_autoware_utils::createQuaternionFromYaw;
 using tier4_autoware_utils::normalizeRadian;
 using tier4_autoware_utils::transformPose;
 
+namespace
+{
+// squared distance transform of a sampled function in one dimension, by the lower envelope of the
+// parabolas rooted at its samples (Felzenszwalb and Huttenlocher)
+void computeDistanceTransform1d(
+  const std::vector<double> & f, std::vector<double> & d, std::vector<int> & v,
+  std::vector<double> & z)
+{
+  const int n = static_cast<int>(f.size());
+  const auto intersection = [&](const int q, const int p) {
+    return ((f[q] + q * q) - (f[p] + p * p)) / (2.0 * (q - p));
+  };
+
+  int k = 0;
+  v[0] = 0;
+  z[0] = -std::numeric_limits<double>::infinity();
+  z[1] = std::numeric_limits<double>::infinity();
+  for (int q = 1; q < n; ++q) {
+    double s = intersection(q, v[k]);
+    while (s <= z[k]) {
+      --k;
+      s = intersection(q, v[k]);
+    }
+    ++k;
+    v[k] = q;
+    z[k] = s;
+    z[k + 1] = std::numeric_limits<double>::infinity();
+  }
+
+  k = 0;
+  for (int q = 0; q < n; ++q) {
+    while (z[k + 1] < q) {
+      ++k;
+    }
+    d[q] = (q - v[k]) * (q - v[k]) + f[v[k]];
+  }
+}
+}  // namespace
+
 int discretizeAngle(const double theta, const int theta_size)
 {
   const double one_angle_range = 2.0 * M_PI / theta_size;
@@ -101,8 +143,25 @@ void OccupancyGridBasedCollisionDetector::setMap(const nav_msgs::msg::OccupancyG
   }
   is_obstacle_table_ = is_obstacle_table;
 
-  // construct collision indexes table
+  tf2::Transform tf_origin;
+  tf2::convert(costmap_.info.origin, tf_origin);
+  tf_global2local_ = tf_origin.inverse();
+
   coll_indexes_table_.clear();
+  coll_circles_table_.clear();
+  distance_field_.clear();
+  if (param_.use_distance_field) {
+    // construct collision circles table, so that a pose is checked with a few lookups
+    for (int i = 0; i < param_.theta_size; i++) {
+      std::vector<CollisionCircle> circles;
+      computeCollisionCircles(i, circles);
+      coll_circles_table_.push_back(circles);
+    }
+    computeDistanceField();
+    return;
+  }
+
+  // construct collision indexes table
   for (int i = 0; i < param_.theta_size; i++) {
     std::vector<IndexXY> indexes_2d;
     computeCollisionIndexes(i, indexes_2d);
@@ -110,6 +169,46 @@ void OccupancyGridBasedCollisionDetector::setMap(const nav_msgs::msg::OccupancyG
   }
 }
 
+void OccupancyGridBasedCollisionDetector::computeDistanceField()
+{
+  const int height = static_cast<int>(costmap_.info.height);
+  const int width = static_cast<int>(costmap_.info.width);
+  if (height == 0 || width == 0) {
+    return;
+  }
+
+  // squared distance in cells, by the transform along the columns and then along the rows
+  constexpr double inf = 1e20;
+  const int size = std::max(height, width);
+  std::vector<double> f(height);
+  std::vector<double> d(height);
+  std::vector<int> v(size);
+  std::vector<double> z(size + 1);
+  std::vector<double> squared_distances(height * width);
+  for (int j = 0; j < width; j++) {
+    for (int i = 0; i < height; i++) {
+      f[i] = is_obstacle_table_[i][j] ? 0.0 : inf;
+    }
+    computeDistanceTransform1d(f, d, v, z);
+    for (int i = 0; i < height; i++) {
+      squared_distances[i * width + j] = d[i];
+    }
+  }
+  f.resize(width);
+  d.resize(width);
+  for (int i = 0; i < height; i++) {
+    std::copy_n(squared_distances.begin() + i * width, width, f.begin());
+    computeDistanceTransform1d(f, d, v, z);
+    std::copy_n(d.begin(), width, squared_distances.begin() + i * width);
+  }
+
+  distance_field_.resize(height * width);
+  const double resolution = costmap_.info.resolution;
+  for (int i = 0; i < height * width; i++) {
+    distance_field_[i] = std::sqrt(squared_distances[i]) * resolution;
+  }
+}
+
 void OccupancyGridBasedCollisionDetector::computeCollisionIndexes(
   int theta_index, std::vector<IndexXY> & indexes_2d)
 {
@@ -152,9 +251,69 @@ void OccupancyGridBasedCollisionDetector::computeCollisionIndexes(
   addIndex2d(front, left);
 }
 
+void OccupancyGridBasedCollisionDetector::computeCollisionCircles(
+  int theta_index, std::vector<CollisionCircle> & circles)
+{
+  IndexXYT base_index{0, 0, theta_index};
+  const VehicleShape & vehicle_shape = param_.vehicle_shape;
+
+  // Cover the robot rectangle with circles along its length, as far apart as half its width
+  const double back = -1.0 * vehicle_shape.base2back;
+  const double half_width = vehicle_shape.width / 2.0;
+  const int circle_num =
+    half_width > 0.0 ? std::max(1, static_cast<int>(std::ceil(vehicle_shape.length / half_width)))
+                     : 1;
+  const double interval = vehicle_shape.length / circle_num;
+  coll_circle_radius_ = std::hypot(half_width, interval / 2.0);
+
+  const auto base_pose = index2pose(costmap_, base_index, param_.theta_size);
+  const auto base_theta = tf2::getYaw(base_pose.orientation);
+
+  for (int i = 0; i < circle_num; i++) {
+    const double x = back + interval * (i + 0.5);
+    circles.push_back({std::cos(base_theta) * x, std::sin(base_theta) * x});
+  }
+}
+
+bool OccupancyGridBasedCollisionDetector::detectCollisionOnDistanceField(
+  const IndexXYT & base_index, const bool check_out_of_range) const
+{
+  const int height = static_cast<int>(costmap_.info.height);
+  const int width = static_cast<int>(costmap_.info.width);
+  const double resolution = costmap_.info.resolution;
+  const double radius = coll_circle_radius_;
+  // from a cell center to its corners, so that the obstacle cells touching a circle are not missed
+  const double cell_margin = resolution / std::sqrt(2.0);
+
+  const double base_x = base_index.x * resolution;
+  const double base_y = base_index.y * resolution;
+  for (const auto & circle : coll_circles_table_[base_index.theta]) {
+    const double x = base_x + circle.x;
+    const double y = base_y + circle.y;
+    const bool is_out_of_range = x < radius || y < radius || width * resolution < x + radius ||
+                                 height * resolution < y + radius;
+    if (check_out_of_range && is_out_of_range) {
+      return true;
+    }
+
+    // the distance from the circle center is bounded by the one of the nearest cell in the map
+    const int index_x = std::clamp(static_cast<int>(std::floor(x / resolution)), 0, width - 1);
+    const int index_y = std::clamp(static_cast<int>(std::floor(y / resolution)), 0, height - 1);
+    const double offset =
+      std::hypot(x - (index_x + 0.5) * resolution, y - (index_y + 0.5) * resolution);
+    if (distance_field_[index_y * width + index_x] - offset - cell_margin < radius) {
+      return true;
+    }
+  }
+  return false;
+}
+
 bool OccupancyGridBasedCollisionDetector::detectCollision(
   const IndexXYT & base_index, const bool check_out_of_range) const
 {
+  if (param_.use_distance_field && !distance_field_.empty()) {
+    return detectCollisionOnDistanceField(base_index, check_out_of_range);
+  }
   if (coll_indexes_table_.empty()) {
     std::cerr << "[occupancy_grid_based_collision_detector] setMap has not yet been done."
               << std::endl;
@@ -177,14 +336,29 @@ bool OccupancyGridBasedCollisionDetector::detectCollision(
   return false;
 }
 
+IndexXYT OccupancyGridBasedCollisionDetector::globalPose2Index(
+  const geometry_msgs::msg::Pose & pose_global) const
+{
+  // same as global2local, without converting the costmap origin for each pose
+  tf2::Transform tf_pose_global;
+  tf2::fromMsg(pose_global, tf_pose_global);
+  geometry_msgs::msg::Pose pose_local;
+  tf2::toMsg(tf_global2local_ * tf_pose_global, pose_local);
+  return pose2index(costmap_, pose_local, param_.theta_size);
+}
+
 bool OccupancyGridBasedCollisionDetector::hasObstacleOnPath(
   const geometry_msgs::msg::PoseArray & path, const bool check_out_of_range) const
 {
-  for (const auto & pose : path.poses) {
-    const auto pose_local = global2local(costmap_, pose);
-    const auto index = pose2index(costmap_, pose_local, param_.theta_size);
+  return hasObstacleOnPath(path.poses, check_out_of_range);
+}
 
-    if (detectCollision(index, check_out_of_range)) {
+bool OccupancyGridBasedCollisionDetector::hasObstacleOnPath(
+  const autoware_auto_planning_msgs::msg::PathWithLaneId & path,
+  const bool check_out_of_range) const
+{
+  for (const auto & p : path.points) {
+    if (detectCollision(globalPose2Index(p.point.pose), check_out_of_range)) {
       return true;
     }
   }
@@ -193,14 +367,10 @@ bool OccupancyGridBasedCollisionDetector::hasObstacleOnPath(
 }
 
 bool OccupancyGridBasedCollisionDetector::hasObstacleOnPath(
-  const autoware_auto_planning_msgs::msg::PathWithLaneId & path,
-  const bool check_out_of_range) const
+  const std::vector<geometry_msgs::msg::Pose> & poses, const bool check_out_of_range) const
 {
-  for (const auto & p : path.points) {
-    const auto pose_local = global2local(costmap_, p.point.pose);
-    const auto index = pose2index(costmap_, pose_local, param_.theta_size);
-
-    if (detectCollision(index, check_out_of_range)) {
+  for (const auto & pose : poses) {
+    if (detectCollision(globalPose2Index(pose), check_out_of_range)) {
       return true;
     }
   }
@@ -21,9 +21,65 @@
 #include <tier4_autoware_utils/geometry/boost_polygon_utils.hpp>
 
 #include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/expand.hpp>
+#include <boost/geometry/index/rtree.hpp>
+
+#include <lanelet2_core/geometry/Lanelet.h>
+
+#include <algorithm>
+#include <iterator>
+#include <utility>
+#include <vector>
 
 namespace behavior_path_planner::utils::path_safety_checker
 {
+namespace
+{
+using tier4_autoware_utils::Box2d;
+using tier4_autoware_utils::Point2d;
+using ObjectBoxRtree =
+  boost::geometry::index::rtree<std::pair<Box2d, size_t>, boost::geometry::index::rstar<16>>;
+
+// the rtree of the bounding boxes of the object footprints and centroids
+ObjectBoxRtree createObjectBoxRtree(const std::vector<PredictedObject> & objects)
+{
+  std::vector<std::pair<Box2d, size_t>> object_boxes;
+  object_boxes.reserve(objects.size());
+  for (size_t i = 0; i < objects.size(); ++i) {
+    const auto & object = objects.at(i);
+    const auto & position = object.kinematics.initial_pose_with_covariance.pose.position;
+    Box2d box(Point2d(position.x, position.y), Point2d(position.x, position.y));
+    boost::geometry::expand(
+      box, boost::geometry::return_envelope<Box2d>(tier4_autoware_utils::toPolygon2d(object)));
+    object_boxes.emplace_back(box, i);
+  }
+  return ObjectBoxRtree(object_boxes.begin(), object_boxes.end());
+}
+
+// for each object, the indices of the lanelets whose bounding boxes intersect with the object box,
+// in the order of the lanelets
+std::vector<std::vector<size_t>> getCandidateLaneletIndices(
+  const ObjectBoxRtree & object_box_rtree, const size_t object_num,
+  const lanelet::ConstLanelets & lanelets)
+{
+  std::vector<std::vector<size_t>> candidate_lanelet_indices(object_num);
+  std::vector<std::pair<Box2d, size_t>> query_result;
+  for (size_t i = 0; i < lanelets.size(); ++i) {
+    const auto bounding_box = lanelet::geometry::boundingBox2d(lanelets.at(i));
+    const Box2d lanelet_box(
+      Point2d(bounding_box.min().x(), bounding_box.min().y()),
+      Point2d(bounding_box.max().x(), bounding_box.max().y()));
+    query_result.clear();
+    object_box_rtree.query(
+      boost::geometry::index::intersects(lanelet_box), std::back_inserter(query_result));
+    for (const auto & [object_box, object_index] : query_result) {
+      candidate_lanelet_indices.at(object_index).push_back(i);
+    }
+  }
+  return candidate_lanelet_indices;
+}
+}  // namespace
 
 bool isCentroidWithinLanelet(const PredictedObject & object, const lanelet::ConstLanelet & lanelet)
 {
@@ -110,9 +166,21 @@ void filterObjectsByPosition(
   // Reserve space in the vector to avoid reallocations
   filtered.objects.reserve(objects.objects.size());
 
+  // the nearest segment of ego is the same for all the objects
+  const size_t ego_seg_idx =
+    path_points.empty() ? 0 : motion_utils::findNearestSegmentIndex(path_points, current_pose);
+  const auto calc_dist_ego_to_obj = [&](const geometry_msgs::msg::Point & obj_position) {
+    if (path_points.empty()) {
+      return motion_utils::calcSignedArcLength(path_points, current_pose, obj_position);
+    }
+    return motion_utils::calcSignedArcLength(
+      path_points, current_pose, ego_seg_idx, obj_position,
+      motion_utils::findNearestSegmentIndex(path_points, obj_position));
+  };
+
   for (const auto & obj : objects.objects) {
-    const double dist_ego_to_obj = motion_utils::calcSignedArcLength(
-      path_points, current_pose, obj.kinematics.initial_pose_with_covariance.pose.position);
+    const double dist_ego_to_obj =
+      calc_dist_ego_to_obj(obj.kinematics.initial_pose_with_covariance.pose.position);
 
     if (-backward_distance < dist_ego_to_obj && dist_ego_to_obj < forward_distance) {
       filtered.objects.push_back(obj);
@@ -153,10 +221,14 @@ std::pair<std::vector<size_t>, std::vector<size_t>> separateObjectIndicesByLanel
   std::vector<size_t> target_indices;
   std::vector<size_t> other_indices;
 
+  // the condition is checked only with the lanelets near the object
+  const auto candidate_lanelet_indices = getCandidateLaneletIndices(
+    createObjectBoxRtree(objects.objects), objects.objects.size(), target_lanelets);
+
   for (size_t i = 0; i < objects.objects.size(); i++) {
     bool is_filtered_object = false;
-    for (const auto & llt : target_lanelets) {
-      if (condition(objects.objects.at(i), llt)) {
+    for (const size_t lanelet_index : candidate_lanelet_indices.at(i)) {
+      if (condition(objects.objects.at(i), target_lanelets.at(lanelet_index))) {
         target_indices.push_back(i);
         is_filtered_object = true;
         break;
@@ -342,14 +414,23 @@ TargetObjectsOnLane createTargetObjectsOnLane(
   }
 
   TargetObjectsOnLane target_objects_on_lane{};
+  const auto object_box_rtree = createObjectBoxRtree(filtered_objects.objects);
   const auto append_objects_on_lane = [&](auto & lane_objects, const auto & check_lanes) {
-    std::for_each(
-      filtered_objects.objects.begin(), filtered_objects.objects.end(), [&](const auto & object) {
-        if (isCentroidWithinLanelets(object, check_lanes)) {
-          lane_objects.push_back(
-            transform(object, safety_check_time_horizon, safety_check_time_resolution));
-        }
-      });
+    // the centroid is checked only with the lanelets near the object
+    const auto candidate_lanelet_indices = getCandidateLaneletIndices(
+      object_box_rtree, filtered_objects.objects.size(), check_lanes);
+    for (size_t i = 0; i < filtered_objects.objects.size(); ++i) {
+      const auto & object = filtered_objects.objects.at(i);
+      const auto & candidates = candidate_lanelet_indices.at(i);
+      const bool is_on_lane =
+        std::any_of(candidates.begin(), candidates.end(), [&](const size_t lanelet_index) {
+          return isCentroidWithinLanelet(object, check_lanes.at(lanelet_index));
+        });
+      if (is_on_lane) {
+        lane_objects.push_back(
+          transform(object, safety_check_time_horizon, safety_check_time_resolution));
+      }
+    }
   };
 
   // TODO(Sugahara): Consider shoulder and other lane objects
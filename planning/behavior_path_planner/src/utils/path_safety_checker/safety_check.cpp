@@ -22,11 +22,104 @@
 #include <boost/geometry/algorithms/overlaps.hpp>
 #include <boost/geometry/strategies/strategies.hpp>
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <vector>
+
 namespace behavior_path_planner::utils::path_safety_checker
 {
 
 namespace bg = boost::geometry;
 
+namespace
+{
+// a box in the frame of a 2D pose, for the rejection test before the polygons are created
+struct OrientedBox
+{
+  double center_x;
+  double center_y;
+  double cos_yaw;
+  double sin_yaw;
+  double half_length;
+  double half_width;
+};
+
+OrientedBox createOrientedBox(
+  const Pose & pose, const double yaw, const double min_x, const double max_x, const double min_y,
+  const double max_y)
+{
+  const double cos_yaw = std::cos(yaw);
+  const double sin_yaw = std::sin(yaw);
+  const double mid_x = (min_x + max_x) / 2.0;
+  const double mid_y = (min_y + max_y) / 2.0;
+  return OrientedBox{
+    pose.position.x + cos_yaw * mid_x - sin_yaw * mid_y,
+    pose.position.y + sin_yaw * mid_x + cos_yaw * mid_y,
+    cos_yaw,
+    sin_yaw,
+    (max_x - min_x) / 2.0,
+    (max_y - min_y) / 2.0};
+}
+
+// separating axis test of the boxes, which are separated by more than the margin if true
+bool isSeparated(const OrientedBox & a, const OrientedBox & b, const double margin)
+{
+  const double dx = b.center_x - a.center_x;
+  const double dy = b.center_y - a.center_y;
+  const std::array<std::array<double, 2>, 4> axes{{
+    {a.cos_yaw, a.sin_yaw},
+    {-a.sin_yaw, a.cos_yaw},
+    {b.cos_yaw, b.sin_yaw},
+    {-b.sin_yaw, b.cos_yaw},
+  }};
+  for (const auto & axis : axes) {
+    const double distance = std::abs(dx * axis[0] + dy * axis[1]);
+    const double radius_a = a.half_length * std::abs(a.cos_yaw * axis[0] + a.sin_yaw * axis[1]) +
+                            a.half_width * std::abs(-a.sin_yaw * axis[0] + a.cos_yaw * axis[1]);
+    const double radius_b = b.half_length * std::abs(b.cos_yaw * axis[0] + b.sin_yaw * axis[1]) +
+                            b.half_width * std::abs(-b.sin_yaw * axis[0] + b.cos_yaw * axis[1]);
+    if (distance > radius_a + radius_b + margin) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// same as calcInterpolatedPoseWithVelocity, but starts the search from the index of the previous
+// search, which is valid as long as the relative time does not decrease
+boost::optional<PoseWithVelocityStamped> calcInterpolatedPoseWithVelocity(
+  const std::vector<PoseWithVelocityStamped> & path, const double relative_time,
+  size_t & start_idx)
+{
+  if (path.empty() || relative_time < 0.0) {
+    return boost::none;
+  }
+
+  constexpr double epsilon = 1e-6;
+  for (size_t path_idx = std::max<size_t>(start_idx, 1); path_idx < path.size(); ++path_idx) {
+    const auto & pt = path.at(path_idx);
+    const auto & prev_pt = path.at(path_idx - 1);
+    if (relative_time < pt.time + epsilon) {
+      start_idx = path_idx;
+      const double offset = relative_time - prev_pt.time;
+      const double time_step = pt.time - prev_pt.time;
+      const double ratio = std::clamp(offset / time_step, 0.0, 1.0);
+      const auto interpolated_pose =
+        tier4_autoware_utils::calcInterpolatedPose(prev_pt.pose, pt.pose, ratio, false);
+      const double interpolated_velocity =
+        interpolation::lerp(prev_pt.velocity, pt.velocity, ratio);
+      return PoseWithVelocityStamped{relative_time, interpolated_pose, interpolated_velocity};
+    }
+  }
+
+  start_idx = path.size();
+  return boost::none;
+}
+}  // namespace
+
 void appendPointToPolygon(Polygon2d & polygon, const geometry_msgs::msg::Point & geom_point)
 {
   Point2d point;
@@ -301,8 +394,29 @@ std::vector<Polygon2d> getCollidedPolygons(
     debug.current_obj_pose = target_object.initial_pose.pose;
   }
 
+  const auto & ego_vehicle_info = common_parameters.vehicle_info;
+  const double base_to_front = ego_vehicle_info.max_longitudinal_offset_m;
+  const double base_to_rear = ego_vehicle_info.rear_overhang_m;
+  const double ego_width = ego_vehicle_info.vehicle_width_m;
+  const double lat_margin = rss_parameters.lateral_distance_max_threshold * hysteresis_factor;
+
+  // bounds of the object shape in the object frame, from which the extended polygon is created
+  double shape_min_x = std::numeric_limits<double>::max();
+  double shape_max_x = std::numeric_limits<double>::lowest();
+  double shape_min_y = std::numeric_limits<double>::max();
+  double shape_max_y = std::numeric_limits<double>::lowest();
+  const auto shape_polygon = tier4_autoware_utils::toPolygon2d(Pose{}, target_object.shape);
+  for (const auto & p : shape_polygon.outer()) {
+    shape_min_x = std::min(shape_min_x, p.x());
+    shape_max_x = std::max(shape_max_x, p.x());
+    shape_min_y = std::min(shape_min_y, p.y());
+    shape_max_y = std::max(shape_max_y, p.y());
+  }
+
   std::vector<Polygon2d> collided_polygons{};
   collided_polygons.reserve(target_object_path.path.size());
+  size_t ego_path_idx = 0;
+  double prev_time = std::numeric_limits<double>::lowest();
   for (const auto & obj_pose_with_poly : target_object_path.path) {
     const auto & current_time = obj_pose_with_poly.time;
 
@@ -312,18 +426,73 @@ std::vector<Polygon2d> getCollidedPolygons(
     const auto & object_velocity = obj_pose_with_poly.velocity;
 
     // get ego information at current time
-    // Note: we can create these polygons in advance. However, it can decrease the readability and
-    // variability
-    const auto & ego_vehicle_info = common_parameters.vehicle_info;
-    const auto interpolated_data = getInterpolatedPoseWithVelocityAndPolygonStamped(
-      predicted_ego_path, current_time, ego_vehicle_info);
+    if (current_time < prev_time) {
+      ego_path_idx = 0;
+    }
+    prev_time = current_time;
+    const auto interpolated_data =
+      calcInterpolatedPoseWithVelocity(predicted_ego_path, current_time, ego_path_idx);
     if (!interpolated_data) {
       continue;
     }
     const auto & ego_pose = interpolated_data->pose;
-    const auto & ego_polygon = interpolated_data->poly;
     const auto & ego_velocity = interpolated_data->velocity;
 
+    // skip the polygon creation and the overlap checks below if the boxes that contain both the
+    // polygons and the extended polygons are separated
+    const bool is_separated = std::invoke([&]() {
+      if (obj_polygon.outer().empty()) {
+        return false;
+      }
+
+      const auto calc_lon_offset = [&](const double front_velocity, const double rear_velocity) {
+        return std::max(
+          calcRssDistance(front_velocity, rear_velocity, rss_parameters),
+          calcMinimumLongitudinalLength(front_velocity, rear_velocity, rss_parameters));
+      };
+      const double max_lon_offset = std::max(
+        0.0, std::max(
+               calc_lon_offset(object_velocity, ego_velocity),
+               calc_lon_offset(ego_velocity, object_velocity)) *
+               hysteresis_factor);
+      const double max_lat_margin = std::max(0.0, lat_margin);
+
+      const double ego_yaw = tf2::getYaw(ego_pose.orientation);
+      const auto ego_box = createOrientedBox(
+        ego_pose, ego_yaw, -base_to_rear - max_lon_offset / 2, base_to_front + max_lon_offset,
+        -ego_width / 2.0 - max_lat_margin, ego_width / 2.0 + max_lat_margin);
+
+      const double obj_yaw = tf2::getYaw(obj_pose.orientation);
+      const double cos_obj_yaw = std::cos(obj_yaw);
+      const double sin_obj_yaw = std::sin(obj_yaw);
+      double min_x = shape_min_x;
+      double max_x = shape_max_x;
+      double min_y = shape_min_y;
+      double max_y = shape_max_y;
+      for (const auto & p : obj_polygon.outer()) {
+        const double dx = p.x() - obj_pose.position.x;
+        const double dy = p.y() - obj_pose.position.y;
+        const double x = cos_obj_yaw * dx + sin_obj_yaw * dy;
+        const double y = -sin_obj_yaw * dx + cos_obj_yaw * dy;
+        min_x = std::min(min_x, x);
+        max_x = std::max(max_x, x);
+        min_y = std::min(min_y, y);
+        max_y = std::max(max_y, y);
+      }
+      const auto obj_box = createOrientedBox(
+        obj_pose, obj_yaw, min_x - max_lon_offset / 2, max_x + max_lon_offset,
+        min_y - max_lat_margin, max_y + max_lat_margin);
+
+      constexpr double margin = 1e-3;
+      return isSeparated(ego_box, obj_box, margin);
+    });
+    if (is_separated) {
+      continue;
+    }
+
+    const auto ego_polygon =
+      tier4_autoware_utils::toFootprint(ego_pose, base_to_front, base_to_rear, ego_width);
+
     // check overlap
     if (boost::geometry::overlaps(ego_polygon, obj_polygon)) {
       debug.unsafe_reason = "overlap_polygon";
@@ -351,7 +520,6 @@ std::vector<Polygon2d> getCollidedPolygons(
       calcMinimumLongitudinalLength(front_object_velocity, rear_object_velocity, rss_parameters);
 
     const auto & lon_offset = std::max(rss_dist, min_lon_length) * hysteresis_factor;
-    const auto & lat_margin = rss_parameters.lateral_distance_max_threshold * hysteresis_factor;
     // TODO(watanabe) fix hard coding value
     const bool is_stopped_object = object_velocity < 0.3;
     const auto & extended_ego_polygon = is_object_front ? createExtendedPolygon(
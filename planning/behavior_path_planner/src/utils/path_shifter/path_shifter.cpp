@@ -59,6 +59,13 @@ using motion_utils::removeOverlapPoints;
 void PathShifter::setPath(const PathWithLaneId & path)
 {
   reference_path_ = path;
+  reference_arclength_ = utils::calcPathArcLengthArray(reference_path_);
+  reference_normals_.clear();
+  reference_normals_.reserve(reference_path_.points.size());
+  for (const auto & p : reference_path_.points) {
+    const double yaw = tf2::getYaw(p.point.pose.orientation);
+    reference_normals_.emplace_back(-std::sin(yaw), std::cos(yaw));
+  }
 
   updateShiftLinesIndices(shift_lines_);
   sortShiftLinesAlongPath(shift_lines_);
@@ -105,13 +112,15 @@ bool PathShifter::generate(
     return false;
   }
 
+  // the copy assignment reuses the storage of the previous result
   shifted_path->path = reference_path_;
-  shifted_path->shift_length.resize(reference_path_.points.size(), 0.0);
+  shifted_path->shift_length.assign(reference_path_.points.size(), 0.0);
 
   if (shift_lines_.empty()) {
     RCLCPP_DEBUG_STREAM_THROTTLE(
       logger_, clock_, 3000, "shift_lines_ is empty. Return reference with base offset.");
-    shiftBaseLength(shifted_path, base_offset_);
+    shiftBaseLength(shifted_path->shift_length, base_offset_);
+    applyShiftLength(shifted_path);
     return true;
   }
 
@@ -143,8 +152,9 @@ bool PathShifter::generate(
   }
 
   // Calculate shifted path
-  type == SHIFT_TYPE::SPLINE ? applySplineShifter(shifted_path, offset_back)
-                             : applyLinearShifter(shifted_path);
+  type == SHIFT_TYPE::SPLINE ? applySplineShifter(shifted_path->shift_length, offset_back)
+                             : applyLinearShifter(shifted_path->shift_length);
+  applyShiftLength(shifted_path);
 
   shifted_path->path.points = removeOverlapPoints(shifted_path->path.points);
   // Use orientation before shift to remove points in reverse order
@@ -167,23 +177,23 @@ bool PathShifter::generate(
   return true;
 }
 
-void PathShifter::applyLinearShifter(ShiftedPath * shifted_path) const
+void PathShifter::applyLinearShifter(std::vector<double> & shift_length) const
 {
-  const auto arclength_arr = utils::calcPathArcLengthArray(reference_path_);
+  const auto & arclength_arr = reference_arclength_;
 
-  shiftBaseLength(shifted_path, base_offset_);
+  shiftBaseLength(shift_length, base_offset_);
 
   constexpr double epsilon = 1.0e-8;  // to avoid 0 division
 
   // For all shift_lines_,
   for (const auto & shift_line : shift_lines_) {
-    const auto current_shift = shifted_path->shift_length.at(shift_line.end_idx);
+    const auto current_shift = shift_length.at(shift_line.end_idx);
     const auto delta_shift = shift_line.end_shift_length - current_shift;
     const auto shifting_arclength = std::max(
       arclength_arr.at(shift_line.end_idx) - arclength_arr.at(shift_line.start_idx), epsilon);
 
     // For all path.points,
-    for (size_t i = 0; i < shifted_path->path.points.size(); ++i) {
+    for (size_t i = 0; i < shift_length.size(); ++i) {
       // Set shift length.
       double ith_shift_length;
       if (i < shift_line.start_idx) {
@@ -196,24 +206,28 @@ void PathShifter::applyLinearShifter(ShiftedPath * shifted_path) const
       }
 
       // Apply shifting.
-      addLateralOffsetOnIndexPoint(shifted_path, ith_shift_length, i);
+      addLateralOffsetOnIndexPoint(shift_length, ith_shift_length, i);
     }
   }
 }
 
-void PathShifter::applySplineShifter(ShiftedPath * shifted_path, const bool offset_back) const
+void PathShifter::applySplineShifter(
+  std::vector<double> & shift_length, const bool offset_back) const
 {
-  const auto arclength_arr = utils::calcPathArcLengthArray(reference_path_);
+  const auto & arclength_arr = reference_arclength_;
 
-  shiftBaseLength(shifted_path, base_offset_);
+  shiftBaseLength(shift_length, base_offset_);
 
   constexpr double epsilon = 1.0e-8;  // to avoid 0 division
 
+  std::vector<double> query_distance;
+  std::vector<double> query_length;
+
   // For all shift_lines,
   for (const auto & shift_line : shift_lines_) {
     // calc delta shift at the sp.end_idx so that the sp.end_idx on the path will have
     // the desired shift length.
-    const auto current_shift = shifted_path->shift_length.at(shift_line.end_idx);
+    const auto current_shift = shift_length.at(shift_line.end_idx);
     const auto delta_shift = shift_line.end_shift_length - current_shift;
 
     RCLCPP_DEBUG(
@@ -235,7 +249,8 @@ void PathShifter::applySplineShifter(ShiftedPath * shifted_path, const bool offs
       logger_, "base_distance = %s, base_length = %s", toStr(base_distance).c_str(),
       toStr(base_length).c_str());
 
-    std::vector<double> query_distance, query_length;
+    query_distance.clear();
+    query_length.clear();
 
     // For all path.points,
     // Note: start_idx is not included since shift = 0,
@@ -252,20 +267,20 @@ void PathShifter::applySplineShifter(ShiftedPath * shifted_path, const bool offs
     {
       size_t i = shift_line.start_idx + 1;
       for (const auto & itr : query_length) {
-        addLateralOffsetOnIndexPoint(shifted_path, itr, i);
+        addLateralOffsetOnIndexPoint(shift_length, itr, i);
         ++i;
       }
     }
 
     if (offset_back == true) {
       // Apply shifting after shift
-      for (size_t i = shift_line.end_idx; i < shifted_path->path.points.size(); ++i) {
-        addLateralOffsetOnIndexPoint(shifted_path, delta_shift, i);
+      for (size_t i = shift_line.end_idx; i < shift_length.size(); ++i) {
+        addLateralOffsetOnIndexPoint(shift_length, delta_shift, i);
       }
     } else {
       // Apply shifting before shift
       for (size_t i = 0; i < shift_line.start_idx + 1; ++i) {
-        addLateralOffsetOnIndexPoint(shifted_path, query_length.front(), i);
+        addLateralOffsetOnIndexPoint(shift_length, query_length.front(), i);
       }
     }
   }
@@ -391,7 +406,7 @@ std::pair<std::vector<double>, std::vector<double>> PathShifter::calcBaseLengths
 
 std::vector<double> PathShifter::calcLateralJerk() const
 {
-  const auto arclength_arr = utils::calcPathArcLengthArray(reference_path_);
+  const auto & arclength_arr = reference_arclength_;
 
   constexpr double epsilon = 1.0e-8;  // to avoid 0 division
 
@@ -513,30 +528,36 @@ void PathShifter::removeBehindShiftLineAndSetBaseOffset(const size_t nearest_idx
 }
 
 void PathShifter::addLateralOffsetOnIndexPoint(
-  ShiftedPath * path, double offset, size_t index) const
+  std::vector<double> & shift_length, double offset, size_t index) const
 {
   if (fabs(offset) < 1.0e-8) {
     return;
   }
 
-  auto & p = path->path.points.at(index).point.pose;
-  double yaw = tf2::getYaw(p.orientation);
-  p.position.x -= std::sin(yaw) * offset;
-  p.position.y += std::cos(yaw) * offset;
-
-  path->shift_length.at(index) += offset;
+  shift_length.at(index) += offset;
 }
 
-void PathShifter::shiftBaseLength(ShiftedPath * path, double offset) const
+void PathShifter::shiftBaseLength(std::vector<double> & shift_length, double offset) const
 {
   constexpr double BASE_OFFSET_THR = 1.0e-4;
   if (std::abs(offset) > BASE_OFFSET_THR) {
-    for (size_t i = 0; i < path->path.points.size(); ++i) {
-      addLateralOffsetOnIndexPoint(path, offset, i);
+    for (size_t i = 0; i < shift_length.size(); ++i) {
+      addLateralOffsetOnIndexPoint(shift_length, offset, i);
     }
   }
 }
 
+void PathShifter::applyShiftLength(ShiftedPath * shifted_path) const
+{
+  // The offsets of all the shift lines are along the same normal, so their sum is applied once.
+  for (size_t i = 0; i < shifted_path->path.points.size(); ++i) {
+    const auto & [normal_x, normal_y] = reference_normals_.at(i);
+    auto & p = shifted_path->path.points.at(i).point.pose.position;
+    p.x += normal_x * shifted_path->shift_length.at(i);
+    p.y += normal_y * shifted_path->shift_length.at(i);
+  }
+}
+
 double PathShifter::calcShiftTimeFromJerk(const double lateral, const double jerk, const double acc)
 {
   const double j = std::abs(jerk);
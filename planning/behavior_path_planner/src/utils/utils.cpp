@@ -3015,9 +3015,16 @@ lanelet::ConstLanelets getCurrentLanes(
 
 lanelet::ConstLanelets getCurrentLanes(const std::shared_ptr<const PlannerData> & planner_data)
 {
-  const auto & common_parameters = planner_data->parameters;
-  return getCurrentLanes(
-    planner_data, common_parameters.backward_path_length, common_parameters.forward_path_length);
+  // shared by the modules in the cycle
+  auto & cache = planner_data->cache;
+  std::lock_guard<std::mutex> lock(cache.mutex);
+  if (!cache.current_lanes || cache.current_lanes_odometry != planner_data->self_odometry) {
+    const auto & common_parameters = planner_data->parameters;
+    cache.current_lanes = getCurrentLanes(
+      planner_data, common_parameters.backward_path_length, common_parameters.forward_path_length);
+    cache.current_lanes_odometry = planner_data->self_odometry;
+  }
+  return *cache.current_lanes;
 }
 
 lanelet::ConstLanelets getCurrentLanesFromPath(
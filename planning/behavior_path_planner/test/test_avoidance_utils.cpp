@@ -40,3 +40,47 @@ TEST(BehaviorPathPlanningAvoidanceUtilsTest, shiftLengthDirectionTest)
   ASSERT_TRUE(isSameDirectionShift(isOnRight(left_obj), zero_shift_length));
   ASSERT_FALSE(isSameDirectionShift(isOnRight(right_obj), zero_shift_length));
 }
+
+TEST(BehaviorPathPlanningAvoidanceUtilsTest, objectGeometryCacheValidityTest)
+{
+  using behavior_path_planner::ObjectGeometryCache;
+  using behavior_path_planner::PathPointWithLaneId;
+  using behavior_path_planner::utils::avoidance::isObjectGeometryCacheValid;
+  using tier4_autoware_utils::Point2d;
+  using tier4_autoware_utils::Polygon2d;
+
+  const auto create_polygon = [](const double x, const double y) {
+    Polygon2d polygon;
+    polygon.outer() = {
+      Point2d{x + 2.0, y + 1.0}, Point2d{x + 2.0, y - 1.0}, Point2d{x - 2.0, y - 1.0},
+      Point2d{x - 2.0, y + 1.0}, Point2d{x + 2.0, y + 1.0}};
+    return polygon;
+  };
+
+  PathPointWithLaneId closest_path_point;
+  closest_path_point.lane_ids = {1};
+
+  ObjectGeometryCache cache;
+  cache.object_polygon = create_polygon(10.0, 2.0);
+  cache.closest_path_pose = closest_path_point.point.pose;
+  cache.closest_path_lane_ids = closest_path_point.lane_ids;
+  cache.distance_factor = 1.0;
+
+  constexpr double threshold = 0.1;
+  EXPECT_TRUE(isObjectGeometryCacheValid(
+    cache, create_polygon(10.05, 2.0), closest_path_point, 1.0, threshold));
+  EXPECT_FALSE(isObjectGeometryCacheValid(
+    cache, create_polygon(10.2, 2.0), closest_path_point, 1.0, threshold));
+  EXPECT_FALSE(isObjectGeometryCacheValid(
+    cache, create_polygon(10.0, 2.0), closest_path_point, 1.5, threshold));
+
+  auto moved_path_point = closest_path_point;
+  moved_path_point.point.pose.position.y = 0.5;
+  EXPECT_FALSE(
+    isObjectGeometryCacheValid(cache, create_polygon(10.0, 2.0), moved_path_point, 1.0, threshold));
+
+  auto other_lane_point = closest_path_point;
+  other_lane_point.lane_ids = {2};
+  EXPECT_FALSE(
+    isObjectGeometryCacheValid(cache, create_polygon(10.0, 2.0), other_lane_point, 1.0, threshold));
+}
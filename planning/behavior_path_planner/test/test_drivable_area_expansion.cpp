@@ -14,6 +14,7 @@
 
 #include "behavior_path_planner/data_manager.hpp"
 #include "behavior_path_planner/utils/drivable_area_expansion/drivable_area_expansion.hpp"
+#include "behavior_path_planner/utils/drivable_area_expansion/map_utils.hpp"
 #include "behavior_path_planner/utils/drivable_area_expansion/path_projection.hpp"
 #include "behavior_path_planner/utils/drivable_area_expansion/types.hpp"
 #include "lanelet2_extension/utility/message_conversion.hpp"
@@ -271,3 +272,34 @@ TEST(DrivableAreaExpansionProjection, expand_drivable_area)
   EXPECT_LT(path.right_bound[1].y, -1.0);
   EXPECT_LT(path.right_bound[2].y, -1.0);
 }
+
+TEST(DrivableAreaExpansionProjection, extract_uncrossable_segments_from_cache)
+{
+  drivable_area_expansion::DrivableAreaExpansionParameters params;
+  params.avoid_linestring_types = {"road_border"};
+  params.max_path_arc_length = 10.0;
+  auto lanelet_map_ptr = std::make_shared<lanelet::LaneletMap>();
+  const auto add_linestring = [&](const lanelet::Id id, const double y, const std::string & type) {
+    lanelet::LineString3d ls(
+      id, {lanelet::Point3d(id + 1, 0.0, y, 0.0), lanelet::Point3d(id + 2, 5.0, y, 0.0),
+           lanelet::Point3d(id + 3, 10.0, y, 0.0)});
+    ls.attributes()[lanelet::AttributeName::Type] = type;
+    lanelet_map_ptr->add(ls);
+  };
+  add_linestring(10, 2.0, "road_border");
+  add_linestring(20, -2.0, "line_thin");
+  add_linestring(30, 50.0, "road_border");
+
+  drivable_area_expansion::UncrossableSegmentsCache cache;
+  for (const auto y : {0.0, 45.0}) {
+    drivable_area_expansion::Point ego_point;
+    ego_point.y = y;
+    const auto segments =
+      drivable_area_expansion::extract_uncrossable_segments(*lanelet_map_ptr, ego_point, params);
+    const auto cached_segments = drivable_area_expansion::extract_uncrossable_segments(
+      lanelet_map_ptr, ego_point, params, cache);
+    EXPECT_EQ(cached_segments.size(), 2ul);
+    EXPECT_EQ(cached_segments.size(), segments.size());
+  }
+  EXPECT_EQ(cache.segments.size(), 4ul);
+}
@@ -201,3 +201,72 @@ TEST(BehaviorPathPlanningSafetyUtilsTest, calcRssDistance)
     EXPECT_NEAR(calcRssDistance(front_vel, rear_vel, params), 63.75, epsilon);
   }
 }
+
+TEST(BehaviorPathPlanningSafetyUtilsTest, getCollidedPolygons)
+{
+  using behavior_path_planner::BehaviorPathPlannerParameters;
+  using behavior_path_planner::PathWithLaneId;
+  using behavior_path_planner::utils::path_safety_checker::ExtendedPredictedObject;
+  using behavior_path_planner::utils::path_safety_checker::getCollidedPolygons;
+  using behavior_path_planner::utils::path_safety_checker::PoseWithVelocityAndPolygonStamped;
+  using behavior_path_planner::utils::path_safety_checker::PoseWithVelocityStamped;
+  using behavior_path_planner::utils::path_safety_checker::PredictedPathWithPolygon;
+  using behavior_path_planner::utils::path_safety_checker::RSSparams;
+
+  BehaviorPathPlannerParameters common_parameters;
+  common_parameters.vehicle_info.max_longitudinal_offset_m = 4.0;
+  common_parameters.vehicle_info.vehicle_width_m = 2.0;
+  common_parameters.vehicle_info.rear_overhang_m = 1.0;
+  RSSparams rss_parameters;
+  rss_parameters.rear_vehicle_reaction_time = 1.0;
+  rss_parameters.rear_vehicle_safety_time_margin = 1.0;
+  rss_parameters.lateral_distance_max_threshold = 0.5;
+  rss_parameters.longitudinal_distance_min_threshold = 2.0;
+  rss_parameters.longitudinal_velocity_delta_time = 0.5;
+  rss_parameters.front_vehicle_deceleration = -1.0;
+  rss_parameters.rear_vehicle_deceleration = -1.0;
+
+  // ego drives along the x axis at 5 m/s
+  std::vector<PoseWithVelocityStamped> ego_path;
+  for (size_t i = 0; i <= 10; ++i) {
+    Pose pose;
+    pose.position = tier4_autoware_utils::createPoint(5.0 * i, 0.0, 0.0);
+    pose.orientation = tier4_autoware_utils::createQuaternionFromYaw(0.0);
+    ego_path.emplace_back(static_cast<double>(i), pose, 5.0);
+  }
+
+  // a stopped object at the lateral offset
+  const auto create_object = [](const double x, const double y) {
+    ExtendedPredictedObject object;
+    object.shape.type = Shape::BOUNDING_BOX;
+    object.shape.dimensions.x = 4.0;
+    object.shape.dimensions.y = 2.0;
+    object.initial_pose.pose.position = tier4_autoware_utils::createPoint(x, y, 0.0);
+    object.initial_pose.pose.orientation = tier4_autoware_utils::createQuaternionFromYaw(0.0);
+    PredictedPathWithPolygon object_path;
+    for (size_t i = 0; i <= 10; ++i) {
+      const auto & pose = object.initial_pose.pose;
+      object_path.path.emplace_back(
+        static_cast<double>(i), pose, 0.0, tier4_autoware_utils::toPolygon2d(pose, object.shape));
+    }
+    return std::make_pair(object, object_path);
+  };
+
+  {  // far from the ego path
+    const auto [object, object_path] = create_object(20.0, 30.0);
+    CollisionCheckDebug debug;
+    EXPECT_TRUE(getCollidedPolygons(
+                  PathWithLaneId{}, ego_path, object, object_path, common_parameters,
+                  rss_parameters, 1.0, debug)
+                  .empty());
+  }
+
+  {  // on the ego path
+    const auto [object, object_path] = create_object(20.0, 0.5);
+    CollisionCheckDebug debug;
+    EXPECT_FALSE(getCollidedPolygons(
+                   PathWithLaneId{}, ego_path, object, object_path, common_parameters,
+                   rss_parameters, 1.0, debug)
+                   .empty());
+  }
+}
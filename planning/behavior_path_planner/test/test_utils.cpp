@@ -11,6 +11,7 @@
 // WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 // See the License for the specific language governing permissions and
 // limitations under the License.
+#include "behavior_path_planner/utils/occupancy_grid_based_collision_detector/occupancy_grid_based_collision_detector.hpp"
 #include "behavior_path_planner/utils/utils.hpp"
 #include "input.hpp"
 #include "lanelet2_core/Attribute.h"
@@ -156,3 +157,61 @@ TEST(BehaviorPathPlanningUtilitiesBehaviorTest, expandLanelets)
     EXPECT_NEAR(r_dist, right_bound, 1E-03);
   }
 }
+
+TEST(BehaviorPathPlanningUtilitiesBehaviorTest, getObjectPolygonFromCache)
+{
+  behavior_path_planner::PlannerData planner_data;
+  behavior_path_planner::PredictedObject object;
+  object.object_id.uuid.fill(1);
+  object.shape.type = autoware_auto_perception_msgs::msg::Shape::BOUNDING_BOX;
+  object.shape.dimensions.x = 4.0;
+  object.shape.dimensions.y = 2.0;
+  object.kinematics.initial_pose_with_covariance.pose =
+    behavior_path_planner::generateEgoSamplePose(1.0f, 2.0f, 0.0);
+
+  const auto polygon = planner_data.getObjectPolygon(object);
+  EXPECT_EQ(planner_data.cache.object_polygons.size(), 1u);
+  EXPECT_TRUE(boost::geometry::equals(polygon, tier4_autoware_utils::toPolygon2d(object)));
+  EXPECT_TRUE(boost::geometry::equals(planner_data.getObjectPolygon(object), polygon));
+
+  // the moved object is not taken from the cache
+  object.kinematics.initial_pose_with_covariance.pose.position.x = 11.0;
+  EXPECT_TRUE(boost::geometry::equals(
+    planner_data.getObjectPolygon(object), tier4_autoware_utils::toPolygon2d(object)));
+  EXPECT_FALSE(boost::geometry::equals(planner_data.getObjectPolygon(object), polygon));
+
+  planner_data.cache.clear();
+  EXPECT_TRUE(planner_data.cache.object_polygons.empty());
+}
+
+TEST(BehaviorPathPlanningUtilitiesBehaviorTest, detectCollisionOnDistanceField)
+{
+  nav_msgs::msg::OccupancyGrid costmap;
+  costmap.info.resolution = 0.1;
+  costmap.info.width = 100;
+  costmap.info.height = 100;
+  costmap.data.assign(100 * 100, 0);
+  for (int y = 50; y < 53; ++y) {
+    for (int x = 50; x < 53; ++x) {
+      costmap.data[y * 100 + x] = 100;
+    }
+  }
+
+  for (const bool use_distance_field : {false, true}) {
+    behavior_path_planner::OccupancyGridMapParam param{};
+    param.vehicle_shape = {2.0, 1.0, 0.5};
+    param.theta_size = 360;
+    param.obstacle_threshold = 60;
+    param.use_distance_field = use_distance_field;
+    behavior_path_planner::OccupancyGridBasedCollisionDetector detector;
+    detector.setParam(param);
+    detector.setMap(costmap);
+
+    const auto free_pose = behavior_path_planner::generateEgoSamplePose(2.0f, 2.0f, 0.0);
+    const auto obstacle_pose = behavior_path_planner::generateEgoSamplePose(5.1f, 5.1f, 0.0);
+    const auto edge_pose = behavior_path_planner::generateEgoSamplePose(0.2f, 2.0f, 0.0);
+    EXPECT_FALSE(detector.hasObstacleOnPath(std::vector<Pose>{free_pose}, true));
+    EXPECT_TRUE(detector.hasObstacleOnPath(std::vector<Pose>{free_pose, obstacle_pose}, true));
+    EXPECT_TRUE(detector.hasObstacleOnPath(std::vector<Pose>{edge_pose}, true));
+  }
+}
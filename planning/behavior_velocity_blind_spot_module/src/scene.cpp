@@ -245,7 +245,8 @@ bool BlindSpotModule::generateStopLine(
 
   /* spline interpolation */
   autoware_auto_planning_msgs::msg::PathWithLaneId path_ip;
-  if (!splineInterpolate(*path, interval, path_ip, logger_)) {
+  if (!planner_data_->interpolated_path_cache_->splineInterpolate(
+        *path, interval, path_ip, logger_)) {
     return false;
   }
 
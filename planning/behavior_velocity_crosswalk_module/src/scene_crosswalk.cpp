@@ -25,6 +25,9 @@
 #include <tier4_autoware_utils/geometry/geometry.hpp>
 #include <tier4_autoware_utils/ros/uuid_helper.hpp>
 
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+
 #include <lanelet2_routing/RoutingGraph.h>
 #include <lanelet2_routing/RoutingGraphContainer.h>
 
@@ -199,6 +202,7 @@ CrosswalkModule::CrosswalkModule(
     }
     crosswalk_ = lanelet_map_ptr->laneletLayer.get(module_id);
   }
+  crosswalk_polygon_ = crosswalk_.polygon2d().basicPolygon();
 
   collision_info_pub_ =
     node.create_publisher<tier4_debug_msgs::msg::StringStamped>("~/debug/collision_info", 1);
@@ -222,14 +226,14 @@ bool CrosswalkModule::modifyPathVelocity(PathWithLaneId * path, StopReason * sto
 
   // Initialize debug data
   debug_data_ = DebugData(planner_data_);
-  for (const auto & p : crosswalk_.polygon2d().basicPolygon()) {
+  for (const auto & p : crosswalk_polygon_) {
     debug_data_.crosswalk_polygon.push_back(createPoint(p.x(), p.y(), ego_pos.z));
   }
   recordTime(1);
 
   // Calculate intersection between path and crosswalks
   const auto path_intersects =
-    getPolygonIntersects(*path, crosswalk_.polygon2d().basicPolygon(), ego_pos, 2);
+    getPolygonIntersects(*path, crosswalk_polygon_, ego_pos, 2);
 
   // Apply safety slow down speed if defined in Lanelet2 map
   if (crosswalk_.hasAttribute("safety_slow_down_speed")) {
@@ -248,8 +252,11 @@ bool CrosswalkModule::modifyPathVelocity(PathWithLaneId * path, StopReason * sto
 
   // Resample path sparsely for less computation cost
   constexpr double resample_interval = 4.0;
-  const auto sparse_resample_path =
-    resamplePath(*path, resample_interval, false, true, true, false);
+  PathWithLaneId sparse_resample_path;
+  if (!planner_data_->interpolated_path_cache_->splineInterpolate(
+        *path, resample_interval, sparse_resample_path, logger_)) {
+    sparse_resample_path = resamplePath(*path, resample_interval, false, true, true, false);
+  }
 
   // Decide to stop for crosswalk users
   const auto stop_factor_for_crosswalk_users = checkStopForCrosswalkUsers(
@@ -602,6 +609,23 @@ std::optional<CollisionPoint> CrosswalkModule::getCollisionPoint(
   const auto obj_polygon =
     createObjectPolygon(object.shape.dimensions.x, object.shape.dimensions.y);
 
+  // the object polygon at a step cannot overlap the attention area when the object position is out
+  // of the bounding box of the attention area expanded by the object radius
+  const double obj_radius = std::hypot(object.shape.dimensions.x, object.shape.dimensions.y) / 2.0;
+  const auto attention_area_box = [&]() {
+    tier4_autoware_utils::Box2d box{};
+    if (attention_area.outer().empty()) {
+      // NOTE: an inverted box does not cover any point
+      return tier4_autoware_utils::Box2d{
+        {std::numeric_limits<double>::max(), std::numeric_limits<double>::max()},
+        {std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest()}};
+    }
+    bg::envelope(attention_area, box);
+    return tier4_autoware_utils::Box2d{
+      {box.min_corner().x() - obj_radius, box.min_corner().y() - obj_radius},
+      {box.max_corner().x() + obj_radius, box.max_corner().y() + obj_radius}};
+  }();
+
   double minimum_stop_dist = std::numeric_limits<double>::max();
   std::optional<CollisionPoint> nearest_collision_point{std::nullopt};
   for (const auto & obj_path : object.kinematics.predicted_paths) {
@@ -609,10 +633,14 @@ std::optional<CollisionPoint> CrosswalkModule::getCollisionPoint(
     bool is_start_idx_initialized{false};
     for (size_t i = 0; i < obj_path.path.size(); ++i) {
       // For effective computation, the point and polygon intersection is calculated first.
-      const auto obj_one_step_polygon = createMultiStepPolygon(obj_path.path, obj_polygon, i, i);
-      const auto one_step_intersection_polygons =
-        calcOverlappingPoints(obj_one_step_polygon, attention_area);
-      if (!one_step_intersection_polygons.empty()) {
+      const auto & obj_step_pos = obj_path.path.at(i).position;
+      const bool may_overlap =
+        bg::covered_by(Point2d{obj_step_pos.x, obj_step_pos.y}, attention_area_box);
+      if (
+        may_overlap &&
+        !calcOverlappingPoints(
+           createMultiStepPolygon(obj_path.path, obj_polygon, i, i), attention_area)
+           .empty()) {
         if (!is_start_idx_initialized) {
           start_idx = i;
           is_start_idx_initialized = true;
@@ -927,7 +955,7 @@ void CrosswalkModule::updateObjectState(
       getCollisionPoint(sparse_resample_path, object, crosswalk_attention_range, attention_area);
     object_info_manager_.update(
       obj_uuid, obj_pos, std::hypot(obj_vel.x, obj_vel.y), clock_->now(), is_ego_yielding,
-      has_traffic_light, collision_point, planner_param_, crosswalk_.polygon2d().basicPolygon());
+      has_traffic_light, collision_point, planner_param_, crosswalk_polygon_);
 
     if (collision_point) {
       const auto collision_state = object_info_manager_.getCollisionState(obj_uuid);
@@ -406,6 +406,9 @@ private:
 
   lanelet::ConstLanelet crosswalk_;
 
+  // the polygon of crosswalk_, which is built once since it does not change
+  lanelet::BasicPolygon2d crosswalk_polygon_;
+
   lanelet::ConstLineStrings3d stop_lines_;
 
   // Parameter
@@ -278,7 +278,8 @@ std::vector<geometry_msgs::msg::Point> DetectionAreaModule::getObstaclePoints()
   std::vector<geometry_msgs::msg::Point> obstacle_points;
 
   const auto detection_areas = detection_area_reg_elem_.detectionAreas();
-  const auto & points = *(planner_data_->no_ground_pointcloud);
+  const auto points_ptr = planner_data_->no_ground_pointcloud->get();
+  const auto & points = *points_ptr;
 
   for (const auto & detection_area : detection_areas) {
     const auto poly = lanelet::utils::to2D(detection_area);
@@ -27,7 +27,10 @@
 
 #include <boost/geometry/algorithms/convex_hull.hpp>
 #include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/covered_by.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
 #include <boost/geometry/algorithms/intersection.hpp>
+#include <boost/geometry/algorithms/intersects.hpp>
 
 #include <lanelet2_core/geometry/LineString.h>
 #include <lanelet2_core/geometry/Point.h>
@@ -36,10 +39,12 @@
 #include <lanelet2_core/primitives/LineString.h>
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <map>
 #include <memory>
 #include <tuple>
+#include <utility>
 #include <vector>
 namespace behavior_velocity_planner
 {
@@ -69,6 +74,29 @@ Polygon2d createOneStepPolygon(
 
   return convex_one_step_poly;
 }
+
+// the radius of the circle around the object position that contains its footprint
+double calcFootprintRadius(const autoware_auto_perception_msgs::msg::Shape & shape)
+{
+  if (shape.type == autoware_auto_perception_msgs::msg::Shape::POLYGON) {
+    double radius = 0.0;
+    for (const auto & point : shape.footprint.points) {
+      radius = std::max(radius, std::hypot(point.x, point.y));
+    }
+    return radius;
+  }
+  if (shape.type == autoware_auto_perception_msgs::msg::Shape::CYLINDER) {
+    return shape.dimensions.x / 2.0;
+  }
+  return std::hypot(shape.dimensions.x, shape.dimensions.y) / 2.0;
+}
+
+tier4_autoware_utils::Box2d expandBox(const tier4_autoware_utils::Box2d & box, const double margin)
+{
+  return tier4_autoware_utils::Box2d{
+    {box.min_corner().x() - margin, box.min_corner().y() - margin},
+    {box.max_corner().x() + margin, box.max_corner().y() + margin}};
+}
 }  // namespace
 
 static bool isTargetCollisionVehicleType(
@@ -93,8 +121,7 @@ static bool isTargetCollisionVehicleType(
 }
 
 IntersectionModule::IntersectionModule(
-  const int64_t module_id, const int64_t lane_id,
-  [[maybe_unused]] std::shared_ptr<const PlannerData> planner_data,
+  const int64_t module_id, const int64_t lane_id, std::shared_ptr<const PlannerData> planner_data,
   const PlannerParam & planner_param, const std::set<int> & associative_ids,
   const std::string & turn_direction, const bool has_traffic_light,
   const bool enable_occlusion_detection, const bool is_private_area, rclcpp::Node & node,
@@ -113,6 +140,12 @@ IntersectionModule::IntersectionModule(
   velocity_factor_.init(VelocityFactor::INTERSECTION);
   planner_param_ = planner_param;
 
+  {
+    const auto lanelet_map_ptr = planner_data->route_handler_->getLaneletMapPtr();
+    const auto & assigned_lanelet = lanelet_map_ptr->laneletLayer.get(lane_id_);
+    intersection_area_ = util::getIntersectionArea(assigned_lanelet, lanelet_map_ptr);
+  }
+
   {
     collision_state_machine_.setMarginTime(
       planner_param_.collision_detection.state_transit_margin_time);
@@ -939,7 +972,8 @@ IntersectionModule::DecisionResult IntersectionModule::modifyPathVelocityDetail(
 
   // spline interpolation
   const auto interpolated_path_info_opt = util::generateInterpolatedPath(
-    lane_id_, associative_ids_, *path, planner_param_.common.path_interpolation_ds, logger_);
+    lane_id_, associative_ids_, *path, planner_param_.common.path_interpolation_ds,
+    *planner_data_->interpolated_path_cache_, logger_);
   if (!interpolated_path_info_opt) {
     return IntersectionModule::Indecisive{"splineInterpolate failed"};
   }
@@ -1130,10 +1164,7 @@ IntersectionModule::DecisionResult IntersectionModule::modifyPathVelocityDetail(
   debug_data_.occlusion_attention_area = occlusion_attention_area;
   debug_data_.adjacent_area = intersection_lanelets.adjacent_area();
 
-  // get intersection area
-  const auto intersection_area = util::getIntersectionArea(assigned_lanelet, lanelet_map_ptr);
-
-  auto target_objects = generateTargetObjects(intersection_lanelets, intersection_area);
+  auto target_objects = generateTargetObjects(intersection_lanelets, intersection_area_);
 
   // If there are any vehicles on the attention area when ego entered the intersection on green
   // light, do pseudo collision detection because the vehicles are very slow and no collisions may
@@ -1212,7 +1243,7 @@ IntersectionModule::DecisionResult IntersectionModule::modifyPathVelocityDetail(
   auto occlusion_status =
     (enable_occlusion_detection_ && !occlusion_attention_lanelets.empty() && !is_prioritized)
       ? getOcclusionStatus(
-          *planner_data_->occupancy_grid, occlusion_attention_area, adjacent_lanelets,
+          planner_data_->occupancy_grid, occlusion_attention_area, adjacent_lanelets,
           first_attention_area, interpolated_path_info, occlusion_attention_divisions,
           target_objects, current_pose, occlusion_dist_thr)
       : OcclusionType::NOT_OCCLUDED;
@@ -1494,6 +1525,24 @@ bool IntersectionModule::checkCollision(
   const auto & ego_lane = path_lanelets.ego_or_entry2exit;
   debug_data_.ego_lane = ego_lane.polygon3d();
   const auto ego_poly = ego_lane.polygon2d().basicPolygon();
+  const double concat_lanelets_length = lanelet::utils::getLaneletLength2d(concat_lanelets);
+
+  // the bounding box of the ego lane, to skip the object steps that are far from it before
+  // building their polygons
+  tier4_autoware_utils::Box2d ego_poly_box{
+    {std::numeric_limits<double>::max(), std::numeric_limits<double>::max()},
+    {std::numeric_limits<double>::lowest(), std::numeric_limits<double>::lowest()}};
+  for (const auto & p : ego_poly) {
+    ego_poly_box.min_corner().x(std::min(ego_poly_box.min_corner().x(), p.x()));
+    ego_poly_box.min_corner().y(std::min(ego_poly_box.min_corner().y(), p.y()));
+    ego_poly_box.max_corner().x(std::max(ego_poly_box.max_corner().x(), p.x()));
+    ego_poly_box.max_corner().y(std::max(ego_poly_box.max_corner().y(), p.y()));
+  }
+
+  // the trimmed ego lane polygon only depends on the ego passing interval, which is shared by
+  // many predicted paths
+  std::map<std::pair<size_t, size_t>, std::pair<Polygon2d, tier4_autoware_utils::Box2d>>
+    trimmed_ego_polygons;
 
   // change TTC margin based on ego traffic light color
   const auto [collision_start_margin_time, collision_end_margin_time] = [&]() {
@@ -1582,6 +1631,16 @@ bool IntersectionModule::checkCollision(
   bool collision_detected = false;
   for (const auto & target_object : target_objects->all_attention_objects) {
     const auto & object = target_object.object;
+    const double footprint_radius = calcFootprintRadius(object.shape);
+    const auto ego_poly_search_box = expandBox(ego_poly_box, footprint_radius);
+    const auto intersectsEgoLane = [&](const auto & a, const auto & b) {
+      const tier4_autoware_utils::LineString2d step{
+        {a.position.x, a.position.y}, {b.position.x, b.position.y}};
+      if (!bg::intersects(step, ego_poly_search_box)) {
+        return false;
+      }
+      return bg::intersects(ego_poly, createOneStepPolygon(a, b, object.shape));
+    };
     // If the vehicle is expected to stop before their stopline, ignore
     const bool expected_to_stop_before_stopline = expectedToStopBeforeStopLine(target_object);
     if (
@@ -1607,16 +1666,10 @@ bool IntersectionModule::checkCollision(
 
       // collision point
       const auto first_itr = std::adjacent_find(
-        predicted_path.path.cbegin(), predicted_path.path.cend(),
-        [&ego_poly, &object](const auto & a, const auto & b) {
-          return bg::intersects(ego_poly, createOneStepPolygon(a, b, object.shape));
-        });
+        predicted_path.path.cbegin(), predicted_path.path.cend(), intersectsEgoLane);
       if (first_itr == predicted_path.path.cend()) continue;
       const auto last_itr = std::adjacent_find(
-        predicted_path.path.crbegin(), predicted_path.path.crend(),
-        [&ego_poly, &object](const auto & a, const auto & b) {
-          return bg::intersects(ego_poly, createOneStepPolygon(a, b, object.shape));
-        });
+        predicted_path.path.crbegin(), predicted_path.path.crend(), intersectsEgoLane);
       if (last_itr == predicted_path.path.crend()) continue;
 
       // possible collision time interval
@@ -1648,29 +1701,48 @@ bool IntersectionModule::checkCollision(
         // so ego's position interval is up to the end of intersection lane
         end_time_distance_itr = time_distance_array.end() - 1;
       }
-      const double start_arc_length = std::max(
-        0.0, closest_arc_coords.length + (*start_time_distance_itr).second -
-               planner_data_->vehicle_info_.rear_overhang_m);
-      const double end_arc_length = std::min(
-        closest_arc_coords.length + (*end_time_distance_itr).second +
-          planner_data_->vehicle_info_.max_longitudinal_offset_m,
-        lanelet::utils::getLaneletLength2d(concat_lanelets));
-
-      const auto trimmed_ego_polygon =
-        getPolygonFromArcLength(concat_lanelets, start_arc_length, end_arc_length);
-
-      if (trimmed_ego_polygon.empty()) {
-        continue;
+      const auto trimmed_ego_polygon_key = std::make_pair(
+        static_cast<size_t>(start_time_distance_itr - time_distance_array.begin()),
+        static_cast<size_t>(end_time_distance_itr - time_distance_array.begin()));
+      if (trimmed_ego_polygons.count(trimmed_ego_polygon_key) == 0) {
+        const double start_arc_length = std::max(
+          0.0, closest_arc_coords.length + (*start_time_distance_itr).second -
+                 planner_data_->vehicle_info_.rear_overhang_m);
+        const double end_arc_length = std::min(
+          closest_arc_coords.length + (*end_time_distance_itr).second +
+            planner_data_->vehicle_info_.max_longitudinal_offset_m,
+          concat_lanelets_length);
+
+        const auto trimmed_ego_polygon =
+          getPolygonFromArcLength(concat_lanelets, start_arc_length, end_arc_length);
+
+        Polygon2d polygon{};
+        for (const auto & p : trimmed_ego_polygon) {
+          polygon.outer().emplace_back(p.x(), p.y());
+        }
+        bg::correct(polygon);
+        tier4_autoware_utils::Box2d polygon_box{};
+        if (!polygon.outer().empty()) {
+          bg::envelope(polygon, polygon_box);
+        }
+        trimmed_ego_polygons.emplace(
+          trimmed_ego_polygon_key, std::make_pair(std::move(polygon), polygon_box));
       }
+      const auto & [polygon, polygon_box] = trimmed_ego_polygons.at(trimmed_ego_polygon_key);
 
-      Polygon2d polygon{};
-      for (const auto & p : trimmed_ego_polygon) {
-        polygon.outer().emplace_back(p.x(), p.y());
+      if (polygon.outer().empty()) {
+        continue;
       }
-      bg::correct(polygon);
+
       debug_data_.candidate_collision_ego_lane_polygon = toGeomPoly(polygon);
 
+      const auto polygon_search_box = expandBox(polygon_box, footprint_radius);
       for (auto itr = first_itr; itr != last_itr.base(); ++itr) {
+        if (!bg::covered_by(
+              tier4_autoware_utils::Point2d{itr->position.x, itr->position.y},
+              polygon_search_box)) {
+          continue;
+        }
         const auto footprint_polygon = tier4_autoware_utils::toPolygon2d(*itr, object.shape);
         if (bg::intersects(polygon, footprint_polygon)) {
           collision_detected = true;
@@ -1713,7 +1785,7 @@ bool IntersectionModule::checkCollision(
 }
 
 IntersectionModule::OcclusionType IntersectionModule::getOcclusionStatus(
-  const nav_msgs::msg::OccupancyGrid & occ_grid,
+  const nav_msgs::msg::OccupancyGrid::ConstSharedPtr & occ_grid_ptr,
   const std::vector<lanelet::CompoundPolygon3d> & attention_areas,
   const lanelet::ConstLanelets & adjacent_lanelets,
   const lanelet::CompoundPolygon3d & first_attention_area,
@@ -1739,6 +1811,7 @@ IntersectionModule::OcclusionType IntersectionModule::getOcclusionStatus(
       : lane_interval_ip;
   const auto [lane_start_idx, lane_end_idx] = lane_attention_interval_ip;
 
+  const auto & occ_grid = *occ_grid_ptr;
   const int width = occ_grid.info.width;
   const int height = occ_grid.info.height;
   const double resolution = occ_grid.info.resolution;
@@ -1816,24 +1889,31 @@ IntersectionModule::OcclusionType IntersectionModule::getOcclusionStatus(
   // In OpenCV the pixel at (X=x, Y=y) (with left-upper origin) is accessed by img[y, x]
   // unknown: 255
   // not-unknown: 0
-  cv::Mat unknown_mask_raw(width, height, CV_8UC1, cv::Scalar(0));
-  cv::Mat unknown_mask(width, height, CV_8UC1, cv::Scalar(0));
-  for (int x = 0; x < width; x++) {
-    for (int y = 0; y < height; y++) {
-      const int idx = y * width + x;
-      const unsigned char intensity = occ_grid.data.at(idx);
-      if (
-        planner_param_.occlusion.free_space_max <= intensity &&
-        intensity < planner_param_.occlusion.occupied_min) {
-        unknown_mask_raw.at<unsigned char>(height - 1 - y, x) = 255;
+  // NOTE: the unknown mask only depends on the occupancy grid, so it is reused until the next
+  // occupancy grid arrives
+  if (unknown_mask_occupancy_grid_ != occ_grid_ptr) {
+    cv::Mat unknown_mask_raw(width, height, CV_8UC1, cv::Scalar(0));
+    cv::Mat unknown_mask(width, height, CV_8UC1, cv::Scalar(0));
+    for (int x = 0; x < width; x++) {
+      for (int y = 0; y < height; y++) {
+        const int idx = y * width + x;
+        const unsigned char intensity = occ_grid.data.at(idx);
+        if (
+          planner_param_.occlusion.free_space_max <= intensity &&
+          intensity < planner_param_.occlusion.occupied_min) {
+          unknown_mask_raw.at<unsigned char>(height - 1 - y, x) = 255;
+        }
       }
     }
-  }
-  // (2.1) apply morphologyEx
-  const int morph_size = static_cast<int>(planner_param_.occlusion.denoise_kernel / resolution);
-  cv::morphologyEx(
-    unknown_mask_raw, unknown_mask, cv::MORPH_OPEN,
-    cv::getStructuringElement(cv::MORPH_RECT, cv::Size(morph_size, morph_size)));
+    // (2.1) apply morphologyEx
+    const int morph_size = static_cast<int>(planner_param_.occlusion.denoise_kernel / resolution);
+    cv::morphologyEx(
+      unknown_mask_raw, unknown_mask, cv::MORPH_OPEN,
+      cv::getStructuringElement(cv::MORPH_RECT, cv::Size(morph_size, morph_size)));
+    unknown_mask_occupancy_grid_ = occ_grid_ptr;
+    unknown_mask_ = unknown_mask;
+  }
+  const cv::Mat & unknown_mask = unknown_mask_;
 
   // (3) occlusion mask
   static constexpr unsigned char OCCLUDED = 255;
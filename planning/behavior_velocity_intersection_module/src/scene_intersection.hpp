@@ -22,7 +22,10 @@
 #include <motion_utils/marker/virtual_wall_marker_creator.hpp>
 #include <rclcpp/rclcpp.hpp>
 
+#include <opencv2/core.hpp>
+
 #include <autoware_auto_planning_msgs/msg/path_with_lane_id.hpp>
+#include <nav_msgs/msg/occupancy_grid.hpp>
 #include <std_msgs/msg/string.hpp>
 #include <tier4_debug_msgs/msg/float64_multi_array_stamped.hpp>
 
@@ -297,11 +300,16 @@ private:
   PlannerParam planner_param_;
 
   std::optional<util::IntersectionLanelets> intersection_lanelets_{std::nullopt};
+  // the intersection area only depends on the map and the assigned lane, so it is built once
+  std::optional<Polygon2d> intersection_area_{std::nullopt};
 
   // for occlusion detection
   const bool enable_occlusion_detection_;
   std::optional<std::vector<lanelet::ConstLineString3d>> occlusion_attention_divisions_{
     std::nullopt};
+  // the denoised unknown cells of the occupancy grid, kept until the next occupancy grid arrives
+  nav_msgs::msg::OccupancyGrid::ConstSharedPtr unknown_mask_occupancy_grid_{nullptr};
+  cv::Mat unknown_mask_;
   StateMachine collision_state_machine_;     //! for stable collision checking
   StateMachine before_creep_state_machine_;  //! for two phase stop
   StateMachine occlusion_stop_state_machine_;
@@ -349,7 +357,7 @@ private:
     const double time_delay, const util::TrafficPrioritizedLevel & traffic_prioritized_level);
 
   OcclusionType getOcclusionStatus(
-    const nav_msgs::msg::OccupancyGrid & occ_grid,
+    const nav_msgs::msg::OccupancyGrid::ConstSharedPtr & occ_grid_ptr,
     const std::vector<lanelet::CompoundPolygon3d> & attention_areas,
     const lanelet::ConstLanelets & adjacent_lanelets,
     const lanelet::CompoundPolygon3d & first_attention_area,
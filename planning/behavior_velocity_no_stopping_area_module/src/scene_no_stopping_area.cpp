@@ -286,7 +286,8 @@ Polygon2d NoStoppingAreaModule::generateEgoNoStoppingAreaLanePolygon(
   const double interpolation_interval = 0.5;
   bool is_in_area = false;
   autoware_auto_planning_msgs::msg::PathWithLaneId interpolated_path;
-  if (!splineInterpolate(path, interpolation_interval, interpolated_path, logger_)) {
+  if (!planner_data_->interpolated_path_cache_->splineInterpolate(
+        path, interpolation_interval, interpolated_path, logger_)) {
     return ego_area;
   }
   auto & pp = interpolated_path.points;
@@ -364,24 +364,45 @@ void toQuantizedImage(
 void denoiseOccupancyGridCV(
   const OccupancyGrid::ConstSharedPtr occupancy_grid_ptr,
   const Polygons2d & stuck_vehicle_foot_prints, const Polygons2d & moving_vehicle_foot_prints,
-  grid_map::GridMap & grid_map, const GridParam & param, const bool is_show_debug_window,
-  const int num_iter, const bool use_object_footprints, const bool use_object_ray_casts)
+  grid_map::GridMap & grid_map, QuantizedGridImages & quantized_grid_images,
+  const GridParam & param, const bool is_show_debug_window, const int num_iter,
+  const bool use_object_footprints, const bool use_object_ray_casts)
 {
   OccupancyGrid occupancy_grid = *occupancy_grid_ptr;
-  cv::Mat border_image(
-    occupancy_grid.info.width, occupancy_grid.info.height, CV_8UC1,
-    cv::Scalar(grid_utils::occlusion_cost_value::FREE_SPACE));
-  cv::Mat occlusion_image(
-    occupancy_grid.info.width, occupancy_grid.info.height, CV_8UC1,
-    cv::Scalar(grid_utils::occlusion_cost_value::FREE_SPACE));
-  toQuantizedImage(occupancy_grid, &border_image, &occlusion_image, param);
+  //! the quantized images only depend on the occupancy grid, so they are kept until it is updated
+  if (
+    quantized_grid_images.occupancy_grid != occupancy_grid_ptr ||
+    quantized_grid_images.num_iter != num_iter) {
+    cv::Mat border_image(
+      occupancy_grid.info.width, occupancy_grid.info.height, CV_8UC1,
+      cv::Scalar(grid_utils::occlusion_cost_value::FREE_SPACE));
+    cv::Mat occlusion_image(
+      occupancy_grid.info.width, occupancy_grid.info.height, CV_8UC1,
+      cv::Scalar(grid_utils::occlusion_cost_value::FREE_SPACE));
+    toQuantizedImage(occupancy_grid, &border_image, &occlusion_image, param);
 
-  //! show original occupancy grid to compare difference
-  if (is_show_debug_window) {
-    cv::namedWindow("occlusion_image", cv::WINDOW_NORMAL);
-    cv::imshow("occlusion_image", occlusion_image);
-    cv::moveWindow("occlusion_image", 0, 0);
+    //! show original occupancy grid to compare difference
+    if (is_show_debug_window) {
+      cv::namedWindow("occlusion_image", cv::WINDOW_NORMAL);
+      cv::imshow("occlusion_image", occlusion_image);
+      cv::moveWindow("occlusion_image", 0, 0);
+    }
+
+    //!< @brief erode occlusion to make sure occlusion candidates are big enough
+    cv::Mat kernel(2, 2, CV_8UC1, cv::Scalar(1));
+    cv::erode(occlusion_image, occlusion_image, kernel, cv::Point(-1, -1), num_iter);
+    if (is_show_debug_window) {
+      cv::namedWindow("morph", cv::WINDOW_NORMAL);
+      cv::imshow("morph", occlusion_image);
+      cv::moveWindow("morph", 0, 300);
+    }
+
+    quantized_grid_images.occupancy_grid = occupancy_grid_ptr;
+    quantized_grid_images.num_iter = num_iter;
+    quantized_grid_images.border_image = border_image;
+    quantized_grid_images.occlusion_image = occlusion_image;
   }
+  cv::Mat border_image = quantized_grid_images.border_image.clone();
 
   //! raycast object shadow using vehicle
   if (use_object_footprints || use_object_ray_casts) {
@@ -395,16 +416,7 @@ void denoiseOccupancyGridCV(
     }
   }
 
-  //!< @brief erode occlusion to make sure occlusion candidates are big enough
-  cv::Mat kernel(2, 2, CV_8UC1, cv::Scalar(1));
-  cv::erode(occlusion_image, occlusion_image, kernel, cv::Point(-1, -1), num_iter);
-  if (is_show_debug_window) {
-    cv::namedWindow("morph", cv::WINDOW_NORMAL);
-    cv::imshow("morph", occlusion_image);
-    cv::moveWindow("morph", 0, 300);
-  }
-
-  border_image += occlusion_image;
+  border_image += quantized_grid_images.occlusion_image;
   if (is_show_debug_window) {
     cv::namedWindow("merge", cv::WINDOW_NORMAL);
     cv::imshow("merge", border_image);
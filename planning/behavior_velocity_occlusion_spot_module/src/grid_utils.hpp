@@ -91,6 +91,15 @@ struct GridParam
   int occupied_min;    // minimum value of an occupied cell in the occupancy grid
 };
 
+//!< @brief quantized images of an occupancy grid, reused until the next occupancy grid arrives
+struct QuantizedGridImages
+{
+  OccupancyGrid::ConstSharedPtr occupancy_grid;
+  int num_iter{-1};
+  cv::Mat border_image;     // occupied cells
+  cv::Mat occlusion_image;  // eroded unknown cells
+};
+
 //!< @brief Find all occlusion spots inside the given lanelet
 void findOcclusionSpots(
   std::vector<grid_map::Position> & occlusion_spot_positions, const grid_map::GridMap & grid,
@@ -111,12 +120,14 @@ cv::Point toCVPoint(
   const Point & geom_point, const double width_m, const double height_m, const double resolution);
 void imageToOccupancyGrid(const cv::Mat & cv_image, nav_msgs::msg::OccupancyGrid * occupancy_grid);
 void toQuantizedImage(
-  const nav_msgs::msg::OccupancyGrid & occupancy_grid, cv::Mat * cv_image, const GridParam & param);
+  const nav_msgs::msg::OccupancyGrid & occupancy_grid, cv::Mat * border_image,
+  cv::Mat * occlusion_image, const GridParam & param);
 void denoiseOccupancyGridCV(
   const OccupancyGrid::ConstSharedPtr occupancy_grid_ptr,
   const Polygons2d & stuck_vehicle_foot_prints, const Polygons2d & moving_vehicle_foot_prints,
-  grid_map::GridMap & grid_map, const GridParam & param, const bool is_show_debug_window,
-  const int num_iter, const bool use_object_footprints, const bool use_object_ray_casts);
+  grid_map::GridMap & grid_map, QuantizedGridImages & quantized_grid_images,
+  const GridParam & param, const bool is_show_debug_window, const int num_iter,
+  const bool use_object_footprints, const bool use_object_ray_casts);
 }  // namespace grid_utils
 }  // namespace behavior_velocity_planner
 
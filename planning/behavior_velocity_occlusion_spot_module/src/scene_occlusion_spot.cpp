@@ -164,9 +164,9 @@ bool OcclusionSpotModule::modifyPathVelocity(
     const int num_iter = static_cast<int>(
       (param_.detection_area.min_occlusion_spot_size / occ_grid_ptr->info.resolution) - 1);
     grid_utils::denoiseOccupancyGridCV(
-      occ_grid_ptr, stuck_vehicle_foot_prints, moving_vehicle_foot_prints, grid_map, param_.grid,
-      param_.is_show_cv_window, num_iter, param_.use_object_info,
-      param_.use_moving_object_ray_cast);
+      occ_grid_ptr, stuck_vehicle_foot_prints, moving_vehicle_foot_prints, grid_map,
+      quantized_grid_images_, param_.grid, param_.is_show_cv_window, num_iter,
+      param_.use_object_info, param_.use_moving_object_ray_cast);
     DEBUG_PRINT(show_time, "grid [ms]: ", stop_watch_.toc("processing_time", true));
     // Note: Don't consider offset from path start to ego here
     if (!utils::generatePossibleCollisionsFromGridMap(
@@ -19,11 +19,18 @@
 
 #include <geometry_msgs/msg/pose.hpp>
 
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/index/rtree.hpp>
+
+#include <lanelet2_core/geometry/BoundingBox.h>
 #include <lanelet2_core/geometry/LaneletMap.h>
 #include <tf2/utils.h>
 
 #include <algorithm>
+#include <iterator>
 #include <limits>
+#include <utility>
+#include <vector>
 
 namespace behavior_velocity_planner::out_of_lane
 {
@@ -69,15 +76,49 @@ Overlap calculate_overlap(
   return overlap;
 }
 
+namespace
+{
+using FootprintBox = std::pair<lanelet::BoundingBox2d, size_t>;
+using FootprintRtree =
+  boost::geometry::index::rtree<FootprintBox, boost::geometry::index::rstar<16>>;
+
+FootprintRtree build_footprint_rtree(const std::vector<lanelet::BasicPolygon2d> & path_footprints)
+{
+  std::vector<FootprintBox> boxes;
+  boxes.reserve(path_footprints.size());
+  for (auto i = 0UL; i < path_footprints.size(); ++i)
+    boxes.emplace_back(
+      boost::geometry::return_envelope<lanelet::BoundingBox2d>(path_footprints[i]), i);
+  return FootprintRtree(boxes);
+}
+
+/// @brief flag the footprints whose bounding box intersects the one of the lanelet
+std::vector<bool> find_candidate_footprints(
+  const FootprintRtree & footprint_rtree, const size_t footprint_size,
+  const lanelet::ConstLanelet & lanelet)
+{
+  std::vector<bool> is_candidate(footprint_size, false);
+  std::vector<FootprintBox> candidates;
+  footprint_rtree.query(
+    boost::geometry::index::intersects(
+      boost::geometry::return_envelope<lanelet::BoundingBox2d>(lanelet.polygon2d().basicPolygon())),
+    std::back_inserter(candidates));
+  for (const auto & candidate : candidates) is_candidate[candidate.second] = true;
+  return is_candidate;
+}
+
+/// @brief calculate the overlapping ranges, skipping the footprints that cannot overlap the lanelet
 OverlapRanges calculate_overlapping_ranges(
   const std::vector<lanelet::BasicPolygon2d> & path_footprints,
-  const lanelet::ConstLanelets & path_lanelets, const lanelet::ConstLanelet & lanelet,
-  const PlannerParam & params)
+  const std::vector<bool> & is_candidate, const lanelet::ConstLanelets & path_lanelets,
+  const lanelet::ConstLanelet & lanelet, const PlannerParam & params)
 {
   OverlapRanges ranges;
   OtherLane other_lane(lanelet);
   for (auto i = 0UL; i < path_footprints.size(); ++i) {
-    const auto overlap = calculate_overlap(path_footprints[i], path_lanelets, lanelet);
+    const auto overlap = is_candidate[i]
+                           ? calculate_overlap(path_footprints[i], path_lanelets, lanelet)
+                           : Overlap{};
     const auto has_overlap = overlap.inside_distance > params.overlap_min_dist;
     if (has_overlap) {  // open/update the range
       if (!other_lane.range_is_open) {
@@ -100,6 +141,18 @@ OverlapRanges calculate_overlapping_ranges(
   if (other_lane.range_is_open) ranges.push_back(other_lane.close_range());
   return ranges;
 }
+}  // namespace
+
+OverlapRanges calculate_overlapping_ranges(
+  const std::vector<lanelet::BasicPolygon2d> & path_footprints,
+  const lanelet::ConstLanelets & path_lanelets, const lanelet::ConstLanelet & lanelet,
+  const PlannerParam & params)
+{
+  const auto footprint_rtree = build_footprint_rtree(path_footprints);
+  return calculate_overlapping_ranges(
+    path_footprints, find_candidate_footprints(footprint_rtree, path_footprints.size(), lanelet),
+    path_lanelets, lanelet, params);
+}
 
 OverlapRanges calculate_overlapping_ranges(
   const std::vector<lanelet::BasicPolygon2d> & path_footprints,
@@ -107,9 +160,12 @@ OverlapRanges calculate_overlapping_ranges(
   const PlannerParam & params)
 {
   OverlapRanges ranges;
+  // the footprint boxes are indexed once and queried for each lanelet
+  const auto footprint_rtree = build_footprint_rtree(path_footprints);
   for (auto & lanelet : lanelets) {
-    const auto lanelet_ranges =
-      calculate_overlapping_ranges(path_footprints, path_lanelets, lanelet, params);
+    const auto lanelet_ranges = calculate_overlapping_ranges(
+      path_footprints, find_candidate_footprints(footprint_rtree, path_footprints.size(), lanelet),
+      path_lanelets, lanelet, params);
     ranges.insert(ranges.end(), lanelet_ranges.begin(), lanelet_ranges.end());
   }
   return ranges;
@@ -242,18 +242,13 @@ void BehaviorVelocityPlannerNode::onNoGroundPointCloud(
     return;
   }
 
-  pcl::PointCloud<pcl::PointXYZ> pc;
-  pcl::fromROSMsg(*msg, pc);
-
-  Eigen::Affine3f affine = tf2::transformToEigen(transform.transform).cast<float>();
-  pcl::PointCloud<pcl::PointXYZ>::Ptr pc_transformed(new pcl::PointCloud<pcl::PointXYZ>);
-  if (!pc.empty()) {
-    tier4_autoware_utils::transformPointCloud(pc, *pc_transformed, affine);
-  }
+  // the pointcloud is converted only when a scene module uses it
+  const Eigen::Affine3f affine = tf2::transformToEigen(transform.transform).cast<float>();
+  const auto no_ground_pointcloud = std::make_shared<const LazyTransformedPointCloud>(msg, affine);
 
   {
     std::lock_guard<std::mutex> lock(mutex_);
-    planner_data_.no_ground_pointcloud = pc_transformed;
+    planner_data_.no_ground_pointcloud = no_ground_pointcloud;
   }
 }
 
@@ -400,8 +395,10 @@ autoware_auto_planning_msgs::msg::Path BehaviorVelocityPlannerNode::generatePath
   }
 
   // Plan path velocity
-  const auto velocity_planned_path = planner_manager_.planPathVelocity(
-    std::make_shared<const PlannerData>(planner_data), *input_path_msg);
+  auto cycle_planner_data = std::make_shared<PlannerData>(planner_data);
+  cycle_planner_data->interpolated_path_cache_ = std::make_shared<InterpolatedPathCache>();
+  const auto velocity_planned_path =
+    planner_manager_.planPathVelocity(cycle_planner_data, *input_path_msg);
 
   // screening
   const auto filtered_path = filterLitterPathPoint(to_path(velocity_planned_path));
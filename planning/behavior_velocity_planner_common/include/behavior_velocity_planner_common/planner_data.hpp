@@ -17,8 +17,10 @@
 
 #include "route_handler/route_handler.hpp"
 
+#include <behavior_velocity_planner_common/utilization/path_utilization.hpp>
 #include <behavior_velocity_planner_common/utilization/util.hpp>
 #include <motion_velocity_smoother/smoother/smoother_base.hpp>
+#include <tier4_autoware_utils/transform/transforms.hpp>
 #include <vehicle_info_util/vehicle_info_util.hpp>
 
 #include <autoware_auto_mapping_msgs/msg/had_map_bin.hpp>
@@ -37,18 +39,58 @@
 
 #include <boost/optional.hpp>
 
+#include <Eigen/Geometry>
+
 #include <pcl/point_cloud.h>
 #include <pcl/point_types.h>
+#include <pcl_conversions/pcl_conversions.h>
 
 #include <algorithm>
 #include <deque>
 #include <map>
 #include <memory>
+#include <mutex>
+#include <utility>
 #include <vector>
 
 namespace behavior_velocity_planner
 {
 class BehaviorVelocityPlannerNode;
+
+/**
+ * @brief Pointcloud transformed by the given transform on the first access, so that a large
+ * pointcloud is not converted when no scene module uses it.
+ */
+class LazyTransformedPointCloud
+{
+public:
+  LazyTransformedPointCloud(
+    sensor_msgs::msg::PointCloud2::ConstSharedPtr msg, const Eigen::Affine3f & transform)
+  : msg_(std::move(msg)), transform_(transform)
+  {
+  }
+
+  pcl::PointCloud<pcl::PointXYZ>::ConstPtr get() const
+  {
+    std::call_once(transformed_flag_, [this]() {
+      pcl::PointCloud<pcl::PointXYZ> pc;
+      pcl::fromROSMsg(*msg_, pc);
+      pcl::PointCloud<pcl::PointXYZ>::Ptr pc_transformed(new pcl::PointCloud<pcl::PointXYZ>);
+      if (!pc.empty()) {
+        tier4_autoware_utils::transformPointCloud(pc, *pc_transformed, transform_);
+      }
+      transformed_ = pc_transformed;
+    });
+    return transformed_;
+  }
+
+private:
+  sensor_msgs::msg::PointCloud2::ConstSharedPtr msg_;
+  Eigen::Affine3f transform_;
+  mutable std::once_flag transformed_flag_;
+  mutable pcl::PointCloud<pcl::PointXYZ>::ConstPtr transformed_;
+};
+
 struct PlannerData
 {
   explicit PlannerData(rclcpp::Node & node)
@@ -68,7 +110,8 @@ struct PlannerData
   static constexpr double velocity_buffer_time_sec = 10.0;
   std::deque<geometry_msgs::msg::TwistStamped> velocity_buffer;
   autoware_auto_perception_msgs::msg::PredictedObjects::ConstSharedPtr predicted_objects;
-  pcl::PointCloud<pcl::PointXYZ>::ConstPtr no_ground_pointcloud;
+  // transformed to the map frame when a scene module gets it
+  std::shared_ptr<const LazyTransformedPointCloud> no_ground_pointcloud;
   // occupancy grid
   nav_msgs::msg::OccupancyGrid::ConstSharedPtr occupancy_grid;
 
@@ -85,6 +128,9 @@ struct PlannerData
   std::shared_ptr<motion_velocity_smoother::SmootherBase> velocity_smoother_;
   // route handler
   std::shared_ptr<route_handler::RouteHandler> route_handler_;
+  // interpolated paths shared by the scene modules, renewed in every planning cycle
+  std::shared_ptr<InterpolatedPathCache> interpolated_path_cache_{
+    std::make_shared<InterpolatedPathCache>()};
   // parameters
   vehicle_info_util::VehicleInfo vehicle_info_;
 
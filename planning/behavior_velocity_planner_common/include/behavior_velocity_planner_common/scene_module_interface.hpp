@@ -136,6 +136,10 @@ public:
 protected:
   virtual void modifyPathVelocity(autoware_auto_planning_msgs::msg::PathWithLaneId * path);
 
+  void planSceneModulesInParallel(
+    autoware_auto_planning_msgs::msg::PathWithLaneId * path, std::vector<StopReason> * stop_reasons,
+    std::vector<boost::optional<int>> * first_stop_path_point_indices);
+
   virtual void launchNewModules(const autoware_auto_planning_msgs::msg::PathWithLaneId & path) = 0;
 
   virtual std::function<bool(const std::shared_ptr<SceneModuleInterface> &)>
@@ -164,6 +168,8 @@ protected:
   boost::optional<int> first_stop_path_point_index_;
   rclcpp::Node & node_;
   rclcpp::Clock::SharedPtr clock_;
+  // plan the scene modules in parallel on the same input path and merge their velocities afterwards
+  bool enable_parallel_scene_planning_ = {false};
   // Debug
   bool is_publish_debug_path_ = {false};  // note : this is very heavy debug topic option
   rclcpp::Logger logger_;
@@ -20,10 +20,40 @@
 #include <autoware_auto_planning_msgs/msg/path.hpp>
 #include <autoware_auto_planning_msgs/msg/path_with_lane_id.hpp>
 
+#include <mutex>
 #include <vector>
 
 namespace behavior_velocity_planner
 {
+/**
+ * @brief Cache of the spline interpolated paths shared by the scene modules in a planning cycle.
+ * The scene modules that interpolate the same input path with the same interval get the result of
+ * the first one instead of interpolating it again.
+ */
+class InterpolatedPathCache
+{
+public:
+  /**
+   * @brief same as the splineInterpolate function, reusing the result of a previous call with the
+   * same input path and interval
+   */
+  bool splineInterpolate(
+    const autoware_auto_planning_msgs::msg::PathWithLaneId & input, const double interval,
+    autoware_auto_planning_msgs::msg::PathWithLaneId & output, const rclcpp::Logger logger);
+
+private:
+  struct Entry
+  {
+    double interval;
+    autoware_auto_planning_msgs::msg::PathWithLaneId input;
+    autoware_auto_planning_msgs::msg::PathWithLaneId output;
+  };
+
+  std::mutex mutex_;
+  std::vector<Entry> entries_;
+};
+
+
 bool splineInterpolate(
   const autoware_auto_planning_msgs::msg::PathWithLaneId & input, const double interval,
   autoware_auto_planning_msgs::msg::PathWithLaneId & output, const rclcpp::Logger logger);
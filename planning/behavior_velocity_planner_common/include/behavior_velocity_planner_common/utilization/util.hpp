@@ -220,6 +220,15 @@ boost::optional<geometry_msgs::msg::Pose> insertStopPoint(
 boost::optional<geometry_msgs::msg::Pose> insertStopPoint(
   const geometry_msgs::msg::Point & stop_point, const size_t stop_seg_idx, PathWithLaneId & output);
 
+/*
+  @brief merge the velocities of paths that were planned independently from the same base path.
+  Each path is the base path with inserted points and lowered velocities. The merged path has the
+  inserted points of all the paths, and each of its points gets the minimum velocity of the paths at
+  its arc length, where the velocity of a path holds from one of its points until the next one.
+ */
+PathWithLaneId mergePathVelocities(
+  const PathWithLaneId & base_path, const std::vector<PathWithLaneId> & paths);
+
 /*
   @brief return 'associative' lanes in the intersection. 'associative' means that a lane shares same
   or lane-changeable parent lanes with `lane` and has same turn_direction value.
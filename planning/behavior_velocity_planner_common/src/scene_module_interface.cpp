@@ -19,7 +19,9 @@
 #include <tier4_autoware_utils/system/stop_watch.hpp>
 
 #include <algorithm>
+#include <exception>
 #include <limits>
+#include <thread>
 
 namespace behavior_velocity_planner
 {
@@ -56,6 +58,13 @@ SceneModuleManagerInterface::SceneModuleManagerInterface(
   } else {
     is_publish_debug_path_ = node.get_parameter("is_publish_debug_path").as_bool();
   }
+  if (!node.has_parameter("enable_parallel_scene_planning")) {
+    enable_parallel_scene_planning_ =
+      node.declare_parameter<bool>("enable_parallel_scene_planning");
+  } else {
+    enable_parallel_scene_planning_ =
+      node.get_parameter("enable_parallel_scene_planning").as_bool();
+  }
   if (is_publish_debug_path_) {
     pub_debug_path_ = node.create_publisher<autoware_auto_planning_msgs::msg::PathWithLaneId>(
       std::string("~/debug/path_with_lane_id/") + module_name, 1);
@@ -108,11 +117,26 @@ void SceneModuleManagerInterface::modifyPathVelocity(
   infrastructure_command_array.stamp = clock_->now();
 
   first_stop_path_point_index_ = static_cast<int>(path->points.size()) - 1;
+  std::vector<StopReason> stop_reasons(scene_modules_.size());
+  std::vector<boost::optional<int>> first_stop_path_point_indices(scene_modules_.size());
+  if (enable_parallel_scene_planning_) {
+    planSceneModulesInParallel(path, &stop_reasons, &first_stop_path_point_indices);
+  } else {
+    size_t i = 0;
+    for (const auto & scene_module : scene_modules_) {
+      scene_module->resetVelocityFactor();
+      scene_module->setPlannerData(planner_data_);
+      scene_module->modifyPathVelocity(path, &stop_reasons.at(i));
+      first_stop_path_point_indices.at(i) = scene_module->getFirstStopPathPointIndex();
+      ++i;
+    }
+  }
+
+  size_t i = 0;
   for (const auto & scene_module : scene_modules_) {
-    tier4_planning_msgs::msg::StopReason stop_reason;
-    scene_module->resetVelocityFactor();
-    scene_module->setPlannerData(planner_data_);
-    scene_module->modifyPathVelocity(path, &stop_reason);
+    const auto & stop_reason = stop_reasons.at(i);
+    const auto & first_stop_path_point_index = first_stop_path_point_indices.at(i);
+    ++i;
 
     // The velocity factor must be called after modifyPathVelocity.
     const auto velocity_factor = scene_module->getVelocityFactor();
@@ -127,8 +151,8 @@ void SceneModuleManagerInterface::modifyPathVelocity(
       infrastructure_command_array.commands.push_back(*command);
     }
 
-    if (scene_module->getFirstStopPathPointIndex() < first_stop_path_point_index_) {
-      first_stop_path_point_index_ = scene_module->getFirstStopPathPointIndex();
+    if (first_stop_path_point_index < first_stop_path_point_index_) {
+      first_stop_path_point_index_ = first_stop_path_point_index;
     }
 
     for (const auto & marker : scene_module->createDebugMarkerArray().markers) {
@@ -155,6 +179,55 @@ void SceneModuleManagerInterface::modifyPathVelocity(
     std::string(getModuleName()) + "/processing_time_ms", stop_watch.toc("Total"));
 }
 
+void SceneModuleManagerInterface::planSceneModulesInParallel(
+  autoware_auto_planning_msgs::msg::PathWithLaneId * path, std::vector<StopReason> * stop_reasons,
+  std::vector<boost::optional<int>> * first_stop_path_point_indices)
+{
+  // Each scene module plans on its own copy of the input path, and the velocities are merged in the
+  // order of scene_modules_ afterwards, so the result does not depend on the thread scheduling.
+  const std::vector<std::shared_ptr<SceneModuleInterface>> scene_modules(
+    scene_modules_.begin(), scene_modules_.end());
+  std::vector<autoware_auto_planning_msgs::msg::PathWithLaneId> planned_paths(
+    scene_modules.size(), *path);
+  std::vector<std::exception_ptr> exceptions(scene_modules.size());
+  std::vector<std::thread> threads;
+  threads.reserve(scene_modules.size());
+  for (size_t i = 0; i < scene_modules.size(); ++i) {
+    threads.emplace_back([&, i]() {
+      try {
+        const auto & scene_module = scene_modules.at(i);
+        scene_module->resetVelocityFactor();
+        scene_module->setPlannerData(planner_data_);
+        scene_module->modifyPathVelocity(&planned_paths.at(i), &stop_reasons->at(i));
+      } catch (...) {
+        exceptions.at(i) = std::current_exception();
+      }
+    });
+  }
+  for (auto & thread : threads) {
+    thread.join();
+  }
+  for (const auto & exception : exceptions) {
+    if (exception) {
+      std::rethrow_exception(exception);
+    }
+  }
+
+  *path = planning_utils::mergePathVelocities(*path, planned_paths);
+
+  // the stop point index of each scene module refers to its own path
+  for (size_t i = 0; i < scene_modules.size(); ++i) {
+    const auto stop_idx = scene_modules.at(i)->getFirstStopPathPointIndex();
+    const auto & planned_points = planned_paths.at(i).points;
+    if (!stop_idx || *stop_idx < 0 || planned_points.size() <= static_cast<size_t>(*stop_idx)) {
+      first_stop_path_point_indices->at(i) = stop_idx;
+      continue;
+    }
+    first_stop_path_point_indices->at(i) = static_cast<int>(motion_utils::findNearestIndex(
+      path->points, planned_points.at(*stop_idx).point.pose.position));
+  }
+}
+
 void SceneModuleManagerInterface::deleteExpiredModules(
   const autoware_auto_planning_msgs::msg::PathWithLaneId & path)
 {
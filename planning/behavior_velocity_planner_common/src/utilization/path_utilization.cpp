@@ -39,6 +39,36 @@ bool splineInterpolate(
   return true;
 }
 
+bool InterpolatedPathCache::splineInterpolate(
+  const autoware_auto_planning_msgs::msg::PathWithLaneId & input, const double interval,
+  autoware_auto_planning_msgs::msg::PathWithLaneId & output, const rclcpp::Logger logger)
+{
+  // the input paths of the scene modules differ only when a previous module inserted a point or
+  // changed a velocity, so the entries of a cycle are few
+  constexpr size_t max_entry_num = 16;
+
+  {
+    std::lock_guard<std::mutex> lock(mutex_);
+    for (const auto & entry : entries_) {
+      if (entry.interval == interval && entry.input == input) {
+        output = entry.output;
+        return true;
+      }
+    }
+  }
+
+  if (!behavior_velocity_planner::splineInterpolate(input, interval, output, logger)) {
+    return false;
+  }
+
+  std::lock_guard<std::mutex> lock(mutex_);
+  if (max_entry_num <= entries_.size()) {
+    entries_.erase(entries_.begin());
+  }
+  entries_.push_back(Entry{interval, input, output});
+  return true;
+}
+
 /*
  * Interpolate the path with a fixed interval by spline.
  * In order to correctly inherit the position of the planned velocity points, the position of the
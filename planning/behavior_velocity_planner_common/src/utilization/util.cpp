@@ -32,6 +32,7 @@
 #endif
 
 #include <algorithm>
+#include <cmath>
 #include <limits>
 #include <string>
 #include <vector>
@@ -663,6 +664,65 @@ boost::optional<geometry_msgs::msg::Pose> insertStopPoint(
   return tier4_autoware_utils::getPose(output.points.at(insert_idx.get()));
 }
 
+PathWithLaneId mergePathVelocities(
+  const PathWithLaneId & base_path, const std::vector<PathWithLaneId> & paths)
+{
+  // same threshold as motion_utils::insertTargetPoint uses to reuse an existing point
+  constexpr double overlap_threshold = 1e-3;
+
+  const auto calcArcLengths = [](const PathWithLaneId & path) {
+    std::vector<double> arc_lengths(path.points.size(), 0.0);
+    for (size_t i = 1; i < path.points.size(); ++i) {
+      arc_lengths.at(i) =
+        arc_lengths.at(i - 1) + tier4_autoware_utils::calcDistance2d(
+                                  path.points.at(i - 1).point, path.points.at(i).point);
+    }
+    return arc_lengths;
+  };
+
+  PathWithLaneId merged_path = base_path;
+  std::vector<double> merged_arc_lengths = calcArcLengths(merged_path);
+  for (const auto & path : paths) {
+    if (path.points.empty()) {
+      continue;
+    }
+    const auto arc_lengths = calcArcLengths(path);
+
+    size_t i = 0;
+    size_t j = 0;
+    boost::optional<float> holding_velocity{};
+    while (j < merged_path.points.size()) {
+      auto & merged_velocity = merged_path.points.at(j).point.longitudinal_velocity_mps;
+      if (
+        i < path.points.size() &&
+        std::abs(arc_lengths.at(i) - merged_arc_lengths.at(j)) < overlap_threshold) {
+        holding_velocity = path.points.at(i).point.longitudinal_velocity_mps;
+        merged_velocity = std::min(merged_velocity, *holding_velocity);
+        ++i;
+        ++j;
+      } else if (i < path.points.size() && arc_lengths.at(i) < merged_arc_lengths.at(j)) {
+        // a point inserted in this path, which starts from the merged velocity held before it
+        auto inserted_point = path.points.at(i);
+        holding_velocity = inserted_point.point.longitudinal_velocity_mps;
+        if (0 < j) {
+          inserted_point.point.longitudinal_velocity_mps = std::min(
+            *holding_velocity, merged_path.points.at(j - 1).point.longitudinal_velocity_mps);
+        }
+        merged_path.points.insert(merged_path.points.begin() + j, inserted_point);
+        merged_arc_lengths.insert(merged_arc_lengths.begin() + j, arc_lengths.at(i));
+        ++i;
+        ++j;
+      } else {
+        if (holding_velocity) {
+          merged_velocity = std::min(merged_velocity, *holding_velocity);
+        }
+        ++j;
+      }
+    }
+  }
+  return merged_path;
+}
+
 std::set<int> getAssociativeIntersectionLanelets(
   lanelet::ConstLanelet lane, const lanelet::LaneletMapPtr lanelet_map,
   const lanelet::routing::RoutingGraphPtr routing_graph)
@@ -21,7 +21,9 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
 #include <iostream>
+#include <iterator>
 
 #define DEBUG_PRINT_PATH(path)                                                        \
   {                                                                                   \
@@ -174,3 +176,83 @@ TEST(specialInterpolation, specialInterpolation)
     EXPECT_DOUBLE_EQ(calcInterpolatedStopDist(px, vx), expected);
   }
 }
+
+TEST(mergePathVelocities, nominal)
+{
+  using behavior_velocity_planner::planning_utils::mergePathVelocities;
+
+  auto base_path = test::generatePath(0.0, 0.0, 10.0, 0.0, 11);
+  for (auto & p : base_path.points) {
+    p.point.longitudinal_velocity_mps = 10.0;
+  }
+
+  // insert a point at x and limit the velocity from there
+  const auto insertVelocity = [&](const double x, const float v) {
+    auto path = base_path;
+    const auto itr = std::find_if(path.points.begin(), path.points.end(), [&](const auto & p) {
+      return x < p.point.pose.position.x;
+    });
+    auto inserted_point = *std::prev(itr);
+    inserted_point.point.pose.position.x = x;
+    const auto inserted_itr = path.points.insert(itr, inserted_point);
+    for (auto it = inserted_itr; it != path.points.end(); ++it) {
+      it->point.longitudinal_velocity_mps = std::min(it->point.longitudinal_velocity_mps, v);
+    }
+    return path;
+  };
+
+  // no planned path
+  {
+    const auto merged_path = mergePathVelocities(base_path, {});
+    EXPECT_EQ(merged_path.points.size(), base_path.points.size());
+  }
+
+  // a slow down from x=2.5 and a stop from x=6.5
+  {
+    const auto merged_path =
+      mergePathVelocities(base_path, {insertVelocity(6.5, 0.0), insertVelocity(2.5, 3.0)});
+    ASSERT_EQ(merged_path.points.size(), 13U);
+    for (const auto & p : merged_path.points) {
+      const auto x = p.point.pose.position.x;
+      const auto expected_velocity = x < 2.0 + 1e-3 ? 10.0 : x < 6.0 + 1e-3 ? 3.0 : 0.0;
+      EXPECT_DOUBLE_EQ(p.point.longitudinal_velocity_mps, expected_velocity) << "x: " << x;
+    }
+  }
+
+  // the same stop point planned by two paths is not duplicated
+  {
+    const auto merged_path =
+      mergePathVelocities(base_path, {insertVelocity(6.5, 0.0), insertVelocity(6.5, 2.0)});
+    ASSERT_EQ(merged_path.points.size(), 12U);
+    EXPECT_DOUBLE_EQ(merged_path.points.at(7).point.pose.position.x, 6.5);
+    EXPECT_DOUBLE_EQ(merged_path.points.at(7).point.longitudinal_velocity_mps, 0.0);
+  }
+}
+
+TEST(InterpolatedPathCache, splineInterpolate)
+{
+  using behavior_velocity_planner::InterpolatedPathCache;
+  using behavior_velocity_planner::splineInterpolate;
+
+  const auto logger = rclcpp::get_logger("test_utilization");
+  const auto path = test::generatePath(0.0, 0.0, 10.0, 0.0, 11);
+  auto stopped_path = path;
+  stopped_path.points.back().point.longitudinal_velocity_mps = 0.0;
+
+  InterpolatedPathCache cache;
+  for (const double interval : {0.5, 0.5, 0.2}) {
+    for (const auto & input : {path, stopped_path}) {
+      autoware_auto_planning_msgs::msg::PathWithLaneId expected;
+      autoware_auto_planning_msgs::msg::PathWithLaneId cached;
+      ASSERT_TRUE(splineInterpolate(input, interval, expected, logger));
+      ASSERT_TRUE(cache.splineInterpolate(input, interval, cached, logger));
+      EXPECT_EQ(cached, expected);
+    }
+  }
+
+  // a path that cannot be interpolated
+  autoware_auto_planning_msgs::msg::PathWithLaneId single_point_path;
+  single_point_path.points.push_back(path.points.front());
+  autoware_auto_planning_msgs::msg::PathWithLaneId output;
+  EXPECT_FALSE(cache.splineInterpolate(single_point_path, 0.5, output, logger));
+}
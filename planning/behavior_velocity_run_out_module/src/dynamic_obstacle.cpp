@@ -26,7 +26,10 @@
 #include <pcl/filters/voxel_grid.h>
 
 #include <algorithm>
+#include <cmath>
 #include <string>
+#include <unordered_map>
+#include <vector>
 
 namespace behavior_velocity_planner
 {
@@ -131,23 +134,58 @@ pcl::PointCloud<pcl::PointXYZ> extractObstaclePointsWithinPolygon(
     return empty_points;
   }
 
+  // bin the points into a grid once, so that each polygon only visits the points in the cells
+  // overlapping with its bounding box instead of all the points
+  constexpr double cell_size = 1.0;
+  const auto toCellIndex = [](const double v) {
+    return static_cast<int64_t>(std::floor(v / cell_size));
+  };
+  const auto toCellKey = [](const int64_t ix, const int64_t iy) {
+    return static_cast<int64_t>(
+      (static_cast<uint64_t>(ix) << 32) ^ (static_cast<uint64_t>(iy) & 0xffffffff));
+  };
+  std::unordered_map<int64_t, std::vector<size_t>> point_indices_in_cell;
+  for (size_t i = 0; i < input_points.size(); ++i) {
+    const auto & p = input_points.at(i);
+    point_indices_in_cell[toCellKey(toCellIndex(p.x), toCellIndex(p.y))].push_back(i);
+  }
+
   pcl::PointCloud<pcl::PointXYZ> output_points;
   output_points.header = input_points.header;
   for (const auto & poly : polys) {
     const auto bounding_box = bg::return_envelope<tier4_autoware_utils::Box2d>(poly);
-    for (const auto & p : input_points) {
-      Point2d point(p.x, p.y);
-
-      // filter with bounding box to reduce calculation time
-      if (!bg::covered_by(point, bounding_box)) {
-        continue;
-      }
-
-      if (!bg::covered_by(point, poly)) {
-        continue;
+    std::vector<size_t> point_indices_in_poly;
+    for (int64_t ix = toCellIndex(bounding_box.min_corner().x());
+         ix <= toCellIndex(bounding_box.max_corner().x()); ++ix) {
+      for (int64_t iy = toCellIndex(bounding_box.min_corner().y());
+           iy <= toCellIndex(bounding_box.max_corner().y()); ++iy) {
+        const auto cell = point_indices_in_cell.find(toCellKey(ix, iy));
+        if (cell == point_indices_in_cell.end()) {
+          continue;
+        }
+
+        for (const auto i : cell->second) {
+          const auto & p = input_points.at(i);
+          Point2d point(p.x, p.y);
+
+          // filter with bounding box to reduce calculation time
+          if (!bg::covered_by(point, bounding_box)) {
+            continue;
+          }
+
+          if (!bg::covered_by(point, poly)) {
+            continue;
+          }
+
+          point_indices_in_poly.push_back(i);
+        }
       }
+    }
 
-      output_points.push_back(p);
+    // keep the order of the input points
+    std::sort(point_indices_in_poly.begin(), point_indices_in_poly.end());
+    for (const auto i : point_indices_in_poly) {
+      output_points.push_back(input_points.at(i));
     }
   }
 
@@ -126,6 +126,17 @@ private:
 
   std::vector<std::vector<geometry_msgs::msg::Point>> primitives_points_;
 
+  // the primitives layer only depends on the map and the pose of the grid, so it is reused as long
+  // as the grid does not move
+  struct PrimitivesCostmapCache
+  {
+    bool is_valid{false};
+    grid_map::Position position;
+    geometry_msgs::msg::Transform transform;
+    grid_map::Matrix costmap;
+  };
+  PrimitivesCostmapCache primitives_costmap_cache_;
+
   PointsToCostmap points2costmap_;
   ObjectsToCostmap objects2costmap_;
 
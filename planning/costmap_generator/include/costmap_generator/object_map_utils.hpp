@@ -96,6 +96,24 @@ void FillPolygonAreas(
   const std::string & in_tf_target_frame, const std::string & in_tf_source_frame,
   const tf2_ros::Buffer & in_tf_buffer);
 
+/*!
+ * Projects the in_area_points forming the road, stores the result in out_grid_map.
+ * @param[out] out_grid_map GridMap object to add the road grid
+ * @param[in] in_points Array of points containing the selected primitives
+ * @param[in] in_grid_layer_name Name to assign to the layer
+ * @param[in] in_layer_background_value Empty state value
+ * @param[in] in_fill_color Value to fill on selected primitives
+ * @param[in] in_layer_min_value Minimum value in the layer
+ * @param[in] in_layer_max_value Maximum value in the layer
+ * @param[in] in_transform Transformation from the frame of the points to the frame of the grid
+ */
+void FillPolygonAreas(
+  grid_map::GridMap & out_grid_map,
+  const std::vector<std::vector<geometry_msgs::msg::Point>> & in_points,
+  const std::string & in_grid_layer_name, const int in_layer_background_value,
+  const int in_fill_color, const int in_layer_min_value, const int in_layer_max_value,
+  const geometry_msgs::msg::TransformStamped & in_transform);
+
 }  // namespace object_map
 
 #endif  // COSTMAP_GENERATOR__OBJECT_MAP_UTILS_HPP_
@@ -275,6 +275,8 @@ void CostmapGenerator::onLaneletMapBin(
   if (use_parkinglot_) {
     loadParkingAreasFromLaneletMap(lanelet_map_, &primitives_points_);
   }
+
+  primitives_costmap_cache_.is_valid = false;
 }
 
 void CostmapGenerator::onObjects(
@@ -429,32 +431,50 @@ grid_map::Matrix CostmapGenerator::generateObjectsCostmap(
 
 grid_map::Matrix CostmapGenerator::generatePrimitivesCostmap()
 {
-  grid_map::GridMap lanelet2_costmap = costmap_;
+  const auto transform = tf_buffer_.lookupTransform(
+    costmap_frame_, map_frame_, rclcpp::Time(0), rclcpp::Duration::from_seconds(1.0));
+
+  auto & cache = primitives_costmap_cache_;
+  if (
+    cache.is_valid && cache.position == costmap_.getPosition() &&
+    cache.transform == transform.transform) {
+    return cache.costmap;
+  }
+
+  // only the primitives layer is needed to rasterize the polygons
+  grid_map::GridMap lanelet2_costmap({LayerName::primitives});
+  lanelet2_costmap.setFrameId(costmap_.getFrameId());
+  lanelet2_costmap.setGeometry(costmap_.getLength(), costmap_.getResolution());
+  lanelet2_costmap.setPosition(costmap_.getPosition());
+  lanelet2_costmap[LayerName::primitives] = costmap_[LayerName::primitives];
   if (!primitives_points_.empty()) {
     object_map::FillPolygonAreas(
       lanelet2_costmap, primitives_points_, LayerName::primitives, grid_max_value_, grid_min_value_,
-      grid_min_value_, grid_max_value_, costmap_frame_, map_frame_, tf_buffer_);
+      grid_min_value_, grid_max_value_, transform);
   }
-  return lanelet2_costmap[LayerName::primitives];
+
+  cache.is_valid = true;
+  cache.position = costmap_.getPosition();
+  cache.transform = transform.transform;
+  cache.costmap = lanelet2_costmap[LayerName::primitives];
+  return cache.costmap;
 }
 
 grid_map::Matrix CostmapGenerator::generateCombinedCostmap()
 {
   // assuming combined_costmap is calculated by element wise max operation
-  grid_map::GridMap combined_costmap = costmap_;
-
-  combined_costmap[LayerName::combined].setConstant(grid_min_value_);
-
-  combined_costmap[LayerName::combined] =
-    combined_costmap[LayerName::combined].cwiseMax(combined_costmap[LayerName::points]);
-
-  combined_costmap[LayerName::combined] =
-    combined_costmap[LayerName::combined].cwiseMax(combined_costmap[LayerName::primitives]);
-
-  combined_costmap[LayerName::combined] =
-    combined_costmap[LayerName::combined].cwiseMax(combined_costmap[LayerName::objects]);
-
-  return combined_costmap[LayerName::combined];
+  // the layers are combined in a single expression without copying the whole costmap
+  const auto & points = costmap_[LayerName::points];
+  const auto & primitives = costmap_[LayerName::primitives];
+  const auto & objects = costmap_[LayerName::objects];
+
+  const grid_map::Matrix combined_costmap =
+    grid_map::Matrix::Constant(points.rows(), points.cols(), grid_min_value_)
+      .cwiseMax(points)
+      .cwiseMax(primitives)
+      .cwiseMax(objects);
+
+  return combined_costmap;
 }
 
 void CostmapGenerator::publishCostmap(const grid_map::GridMap & costmap)
@@ -64,6 +64,21 @@ void FillPolygonAreas(
   const int in_fill_color, const int in_layer_min_value, const int in_layer_max_value,
   const std::string & in_tf_target_frame, const std::string & in_tf_source_frame,
   const tf2_ros::Buffer & in_tf_buffer)
+{
+  const auto transform = in_tf_buffer.lookupTransform(
+    in_tf_target_frame, in_tf_source_frame, rclcpp::Time(0), rclcpp::Duration::from_seconds(1.0));
+
+  FillPolygonAreas(
+    out_grid_map, in_points, in_grid_layer_name, in_layer_background_value, in_fill_color,
+    in_layer_min_value, in_layer_max_value, transform);
+}
+
+void FillPolygonAreas(
+  grid_map::GridMap & out_grid_map,
+  const std::vector<std::vector<geometry_msgs::msg::Point>> & in_points,
+  const std::string & in_grid_layer_name, const int in_layer_background_value,
+  const int in_fill_color, const int in_layer_min_value, const int in_layer_max_value,
+  const geometry_msgs::msg::TransformStamped & in_transform)
 {
   if (!out_grid_map.exists(in_grid_layer_name)) {
     out_grid_map.add(in_grid_layer_name);
@@ -75,26 +90,24 @@ void FillPolygonAreas(
     out_grid_map, in_grid_layer_name, CV_8UC1, in_layer_min_value, in_layer_max_value,
     original_image);
 
-  cv::Mat merged_filled_image = original_image.clone();
-
-  geometry_msgs::msg::TransformStamped transform;
-  transform = in_tf_buffer.lookupTransform(
-    in_tf_target_frame, in_tf_source_frame, rclcpp::Time(0), rclcpp::Duration::from_seconds(1.0));
-
   // calculate out_grid_map position
   grid_map::Position map_pos = out_grid_map.getPosition();
   const double origin_x_offset = out_grid_map.getLength().x() / 2.0 - map_pos.x();
   const double origin_y_offset = out_grid_map.getLength().y() / 2.0 - map_pos.y();
 
+  // all polygons are drawn in a single mask instead of merging one filled image per polygon,
+  // the pixels covered by any polygon take the value (original & fill) as before
+  cv::Mat polygons_mask = cv::Mat::zeros(original_image.size(), CV_8UC1);
   for (const auto & points : in_points) {
     std::vector<cv::Point> cv_polygon;
+    cv_polygon.reserve(points.size());
 
     for (const auto & p : points) {
       // transform to GridMap coordinate
       geometry_msgs::msg::Point transformed_point;
       geometry_msgs::msg::PointStamped output_stamped, input_stamped;
       input_stamped.point = p;
-      tf2::doTransform(input_stamped, output_stamped, transform);
+      tf2::doTransform(input_stamped, output_stamped, in_transform);
       transformed_point = output_stamped.point;
 
       // coordinate conversion for cv image
@@ -105,15 +118,16 @@ void FillPolygonAreas(
       cv_polygon.emplace_back(cv_x, cv_y);
     }
 
-    cv::Mat filled_image = original_image.clone();
-
     std::vector<std::vector<cv::Point>> cv_polygons;
     cv_polygons.push_back(cv_polygon);
-    cv::fillPoly(filled_image, cv_polygons, cv::Scalar(in_fill_color));
-
-    merged_filled_image &= filled_image;
+    cv::fillPoly(polygons_mask, cv_polygons, cv::Scalar(255));
   }
 
+  cv::Mat filled_image(original_image.size(), CV_8UC1, cv::Scalar(in_fill_color));
+  filled_image &= original_image;
+  cv::Mat merged_filled_image = original_image.clone();
+  filled_image.copyTo(merged_filled_image, polygons_mask);
+
   // convert to ROS msg
   grid_map::GridMapCvConverter::addLayerFromImage<unsigned char, 1>(
     merged_filled_image, in_grid_layer_name, out_grid_map, in_layer_min_value, in_layer_max_value);
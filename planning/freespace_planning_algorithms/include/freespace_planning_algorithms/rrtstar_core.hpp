@@ -24,11 +24,13 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <cstdint>
 #include <iostream>
 #include <limits>
 #include <memory>
 #include <random>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace rrtstar_core
@@ -101,6 +103,7 @@ struct Node
   boost::optional<double> cost_to_parent = boost::none;
   NodeWeakPtr parent = NodeWeakPtr();
   std::vector<NodeSharedPtr> childs = std::vector<NodeSharedPtr>();
+  size_t order = 0;  // order in which the node is added to the tree
 
   bool isRoot() const { return getParent() == nullptr; }
 
@@ -147,12 +150,27 @@ private:
   NodeConstSharedPtr getReconnectTargeNode(
     const NodeConstSharedPtr node_new,
     const std::vector<NodeConstSharedPtr> & neighbor_nodes) const;
+  int64_t toCellIndex(const double v) const { return static_cast<int64_t>(std::floor(v / mu_)); }
+  static int64_t toCellKey(const int64_t ix, const int64_t iy);
+  void addToNodeGrid(const NodeSharedPtr & node);
+  std::vector<NodeSharedPtr> getNodesInRing(const Pose & pose, const int64_t ring) const;
 
   NodeSharedPtr node_start_;
   NodeSharedPtr node_goal_;
   std::vector<NodeSharedPtr> nodes_;
   std::vector<NodeSharedPtr> reached_nodes_;
   // std::vector<Node> nodes_;
+
+  // nodes_ binned on a x-y grid whose cell size is mu_. As the euclidean distance is a lower bound
+  // of the reeds-shepp distance, only the nodes in the cells around a pose are checked in
+  // findNearestNode and findNeighborNodes.
+  std::unordered_map<int64_t, std::vector<NodeSharedPtr>> node_grid_;
+  int64_t min_ix_{0};
+  int64_t max_ix_{-1};
+  int64_t min_iy_{0};
+  int64_t max_iy_{-1};
+  size_t node_count_{0};
+
   const double mu_;
   const double collision_check_resolution_;
   const bool is_informed_;
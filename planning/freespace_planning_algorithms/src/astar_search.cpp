@@ -15,6 +15,7 @@
 #include "freespace_planning_algorithms/astar_search.hpp"
 
 #include <tier4_autoware_utils/geometry/geometry.hpp>
+#include <tier4_autoware_utils/math/normalization.hpp>
 #include <tier4_autoware_utils/math/unit_conversion.hpp>
 
 #include <tf2/utils.h>
@@ -217,12 +218,13 @@ double AstarSearch::estimateCost(const geometry_msgs::msg::Pose & pose) const
 
 bool AstarSearch::search()
 {
-  const rclcpp::Time begin = rclcpp::Clock(RCL_ROS_TIME).now();
+  rclcpp::Clock clock(RCL_ROS_TIME);
+  const rclcpp::Time begin = clock.now();
 
   // Start A* search
   while (!openlist_.empty()) {
     // Check time and terminate if the search reaches the time limit
-    const rclcpp::Time now = rclcpp::Clock(RCL_ROS_TIME).now();
+    const rclcpp::Time now = clock.now();
     const double msec = (now - begin).seconds() * 1000.0;
     if (msec > planner_common_param_.time_limit) {
       return false;
@@ -248,12 +250,16 @@ bool AstarSearch::search()
                                  ? planner_common_param_.reverse_weight * transition.distance
                                  : transition.distance;
 
-      // Calculate index of the next state
-      geometry_msgs::msg::Pose next_pose;
-      next_pose.position.x = current_node->x + transition.shift_x;
-      next_pose.position.y = current_node->y + transition.shift_y;
-      setYaw(&next_pose.orientation, current_node->theta + transition.shift_theta);
-      const auto next_index = pose2index(costmap_, next_pose, planner_common_param_.theta_size);
+      // Calculate index of the next state, same as pose2index without converting the yaw to a
+      // quaternion and back
+      const double next_x = current_node->x + transition.shift_x;
+      const double next_y = current_node->y + transition.shift_y;
+      const double next_theta =
+        tier4_autoware_utils::normalizeRadian(current_node->theta + transition.shift_theta);
+      const IndexXYT next_index{
+        static_cast<int>(next_x / costmap_.info.resolution),
+        static_cast<int>(next_y / costmap_.info.resolution),
+        discretizeAngle(next_theta, planner_common_param_.theta_size)};
 
       if (detectCollision(next_index)) {
         continue;
@@ -262,10 +268,15 @@ bool AstarSearch::search()
       // Compare cost
       AstarNode * next_node = getNodeRef(next_index);
       if (next_node->status == NodeStatus::None) {
+        geometry_msgs::msg::Pose next_pose;
+        next_pose.position.x = next_x;
+        next_pose.position.y = next_y;
+        setYaw(&next_pose.orientation, next_theta);
+
         next_node->status = NodeStatus::Open;
-        next_node->x = next_pose.position.x;
-        next_node->y = next_pose.position.y;
-        next_node->theta = tf2::getYaw(next_pose.orientation);
+        next_node->x = next_x;
+        next_node->y = next_y;
+        next_node->theta = next_theta;
         next_node->gc = current_node->gc + move_cost;
         next_node->hc = estimateCost(next_pose);
         next_node->is_back = transition.is_back;
@@ -16,6 +16,7 @@
 
 #include <nlohmann/json.hpp>
 
+#include <algorithm>
 #include <fstream>
 #include <functional>
 #include <memory>
@@ -137,7 +138,9 @@ RRTStar::RRTStar(
 {
   node_goal_ = std::make_shared<Node>(Node{x_goal, boost::none, 0.0});
   node_start_ = std::make_shared<Node>(Node{x_start, 0.0});
+  node_start_->order = node_count_++;
   nodes_.push_back(node_start_);
+  addToNodeGrid(node_start_);
 }
 
 void RRTStar::extend()
@@ -257,6 +260,13 @@ void RRTStar::deleteNodeUsingBranchAndBound()
   for (const size_t delete_idx : delete_indices_vec) {
     nodes_.erase(nodes_.begin() + delete_idx);
   }
+
+  node_grid_.clear();
+  min_ix_ = min_iy_ = 0;
+  max_ix_ = max_iy_ = -1;
+  for (const auto & node : nodes_) {
+    addToNodeGrid(node);
+  }
 }
 
 std::vector<Pose> RRTStar::sampleSolutionWaypoints() const
@@ -328,18 +338,95 @@ void RRTStar::dumpState(std::string filename) const
   file.close();
 }
 
+int64_t RRTStar::toCellKey(const int64_t ix, const int64_t iy)
+{
+  return static_cast<int64_t>(
+    (static_cast<uint64_t>(ix) << 32) ^ (static_cast<uint64_t>(iy) & 0xffffffff));
+}
+
+void RRTStar::addToNodeGrid(const NodeSharedPtr & node)
+{
+  const auto ix = toCellIndex(node->pose.x);
+  const auto iy = toCellIndex(node->pose.y);
+  if (node_grid_.empty()) {
+    min_ix_ = max_ix_ = ix;
+    min_iy_ = max_iy_ = iy;
+  }
+  min_ix_ = std::min(min_ix_, ix);
+  max_ix_ = std::max(max_ix_, ix);
+  min_iy_ = std::min(min_iy_, iy);
+  max_iy_ = std::max(max_iy_, iy);
+  node_grid_[toCellKey(ix, iy)].push_back(node);
+}
+
+std::vector<NodeSharedPtr> RRTStar::getNodesInRing(const Pose & pose, const int64_t ring) const
+{
+  const auto cx = toCellIndex(pose.x);
+  const auto cy = toCellIndex(pose.y);
+
+  std::vector<NodeSharedPtr> nodes;
+  const auto add_cell_nodes = [&](const int64_t ix, const int64_t iy) {
+    const auto cell = node_grid_.find(toCellKey(ix, iy));
+    if (cell != node_grid_.end()) {
+      nodes.insert(nodes.end(), cell->second.begin(), cell->second.end());
+    }
+  };
+  for (auto ix = std::max(cx - ring, min_ix_); ix <= std::min(cx + ring, max_ix_); ++ix) {
+    if (std::abs(ix - cx) == ring) {
+      for (auto iy = std::max(cy - ring, min_iy_); iy <= std::min(cy + ring, max_iy_); ++iy) {
+        add_cell_nodes(ix, iy);
+      }
+      continue;
+    }
+    add_cell_nodes(ix, cy - ring);
+    add_cell_nodes(ix, cy + ring);
+  }
+  return nodes;
+}
+
 NodeConstSharedPtr RRTStar::findNearestNode(const Pose & x_rand) const
 {
   double dist_min = inf;
   NodeConstSharedPtr node_nearest;
-  for (const auto & node : nodes_) {
-    if (cspace_.distanceLowerBound(node->pose, x_rand) < dist_min) {
+  const auto update = [&](const NodeSharedPtr & node) {
+    if (cspace_.distanceLowerBound(node->pose, x_rand) <= dist_min) {
       const double dist_real = cspace_.distance(node->pose, x_rand);
-      if (dist_real < dist_min) {
+      // keep the first added node among the nearest nodes as the linear search does
+      if (
+        dist_real < dist_min ||
+        (node_nearest && dist_real == dist_min && node->order < node_nearest->order)) {
         dist_min = dist_real;
         node_nearest = node;
       }
     }
+  };
+
+  // visit the cells ring by ring around x_rand. the nodes in the ring r are at least
+  // (r - 1) * mu_ away from x_rand, so the search stops once the nearest node found so far is
+  // closer than that.
+  const auto cx = toCellIndex(x_rand.x);
+  const auto cy = toCellIndex(x_rand.y);
+  const auto max_ring = std::max(
+    {std::abs(cx - min_ix_), std::abs(max_ix_ - cx), std::abs(cy - min_iy_),
+     std::abs(max_iy_ - cy)});
+  size_t visited_cell_num = 0;
+  for (int64_t r = 0; r <= max_ring; ++r) {
+    if (node_nearest && dist_min < static_cast<double>(r - 1) * mu_) {
+      break;
+    }
+    // x_rand is far from the nodes, so the grid does not help
+    visited_cell_num += r == 0 ? 1 : 8 * r;
+    if (nodes_.size() < visited_cell_num) {
+      dist_min = inf;
+      node_nearest = nullptr;
+      for (const auto & node : nodes_) {
+        update(node);
+      }
+      return node_nearest;
+    }
+    for (const auto & node : getNodesInRing(x_rand, r)) {
+      update(node);
+    }
   }
   return node_nearest;
 }
@@ -359,8 +446,17 @@ std::vector<NodeConstSharedPtr> RRTStar::findNeighborNodes(const Pose & x_new) c
 
   const double radius_neighbor = mu_;
 
+  // the cell size of node_grid_ is mu_, so the neighbors are in the cells next to the one of x_new.
+  // they are sorted in the order of nodes_ as the results depend on the order of the neighbors.
+  auto candidate_nodes = getNodesInRing(x_new, 0);
+  const auto ring_nodes = getNodesInRing(x_new, 1);
+  candidate_nodes.insert(candidate_nodes.end(), ring_nodes.begin(), ring_nodes.end());
+  std::sort(
+    candidate_nodes.begin(), candidate_nodes.end(),
+    [](const NodeSharedPtr & a, const NodeSharedPtr & b) { return a->order < b->order; });
+
   std::vector<NodeConstSharedPtr> nodes;
-  for (auto & node : nodes_) {
+  for (auto & node : candidate_nodes) {
     if (cspace_.distanceLowerBound(node->pose, x_new) > radius_neighbor) continue;
     const bool is_neighbor = (cspace_.distance(node->pose, x_new) < radius_neighbor);
     if (is_neighbor) {
@@ -376,7 +472,9 @@ NodeSharedPtr RRTStar::addNewNode(const Pose & pose, NodeSharedPtr node_parent)
   const double cost_from_start = *(node_parent->cost_from_start) + cost_to_parent;
   auto node_new =
     std::make_shared<Node>(Node{pose, cost_from_start, boost::none, cost_to_parent, node_parent});
+  node_new->order = node_count_++;
   nodes_.push_back(node_new);
+  addToNodeGrid(node_new);
   node_parent->childs.push_back(node_new);
   return node_new;
 }
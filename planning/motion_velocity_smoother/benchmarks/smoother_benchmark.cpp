@@ -0,0 +1,142 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Runs apply() of each smoother over curved trajectories of increasing length, and prints one CSV
+// line per smoother and trajectory to stdout and the latency histograms to stderr:
+//   smoother, length_m, points, p50_us, p90_us, p99_us, max_us, failures
+// Usage: smoother_benchmark [iterations]
+
+#include "ament_index_cpp/get_package_share_directory.hpp"
+#include "motion_velocity_smoother/smoother/analytical_jerk_constrained_smoother/analytical_jerk_constrained_smoother.hpp"
+#include "motion_velocity_smoother/smoother/jerk_filtered_smoother.hpp"
+#include "motion_velocity_smoother/smoother/l2_pseudo_jerk_smoother.hpp"
+#include "motion_velocity_smoother/smoother/linf_pseudo_jerk_smoother.hpp"
+#include "planning_interface_test_manager/planning_benchmark_utils.hpp"
+#include "planning_interface_test_manager/planning_interface_test_manager_utils.hpp"
+
+#include <rclcpp/rclcpp.hpp>
+
+#include <algorithm>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace
+{
+using autoware_auto_planning_msgs::msg::Trajectory;
+using motion_velocity_smoother::SmootherBase;
+using motion_velocity_smoother::TrajectoryPoints;
+
+constexpr double ego_nearest_dist_threshold = 3.0;
+constexpr double ego_nearest_yaw_threshold = 1.046;
+
+struct Smoother
+{
+  std::string name;
+  std::function<std::shared_ptr<SmootherBase>(rclcpp::Node &)> make;
+};
+
+// A node per smoother, since the smoothers declare the parameters of the same names
+std::shared_ptr<rclcpp::Node> makeParameterNode(const std::string & algorithm)
+{
+  const auto motion_velocity_smoother_dir =
+    ament_index_cpp::get_package_share_directory("motion_velocity_smoother");
+  rclcpp::NodeOptions node_options;
+  node_options.arguments(
+    {"--ros-args", "--params-file",
+     motion_velocity_smoother_dir + "/config/default_motion_velocity_smoother.param.yaml",
+     "--params-file", motion_velocity_smoother_dir + "/config/default_common.param.yaml",
+     "--params-file", motion_velocity_smoother_dir + "/config/" + algorithm + ".param.yaml"});
+  return std::make_shared<rclcpp::Node>("smoother_benchmark_" + algorithm, node_options);
+}
+
+/**
+ * A curve of a constant curvature with the velocity limit of 15 m/s and a stop at the end. It is
+ * resampled as the node does before apply().
+ */
+TrajectoryPoints makeFixture(SmootherBase & smoother, const double length, const double v0)
+{
+  constexpr double interval = 1.0;
+  constexpr double curvature = 0.01;
+  const auto num_points = static_cast<size_t>(length / interval) + 1;
+  const auto trajectory = test_utils::generateTrajectory<Trajectory>(
+    num_points, interval, 15.0, 0.0, curvature * interval);
+  const TrajectoryPoints points(trajectory.points.begin(), trajectory.points.end());
+
+  auto resampled = smoother.resampleTrajectory(
+    points, v0, points.front().pose, ego_nearest_dist_threshold, ego_nearest_yaw_threshold);
+  if (!resampled.empty()) {
+    resampled.back().longitudinal_velocity_mps = 0.0;
+  }
+  return resampled;
+}
+}  // namespace
+
+int main(int argc, char ** argv)
+{
+  const int iterations = argc > 1 ? std::max(1, std::atoi(argv[1])) : 100;
+  rclcpp::init(1, argv);
+
+  using motion_velocity_smoother::AnalyticalJerkConstrainedSmoother;
+  using motion_velocity_smoother::JerkFilteredSmoother;
+  using motion_velocity_smoother::L2PseudoJerkSmoother;
+  using motion_velocity_smoother::LinfPseudoJerkSmoother;
+  const std::vector<Smoother> smoothers = {
+    {"JerkFiltered",
+     [](rclcpp::Node & node) { return std::make_shared<JerkFilteredSmoother>(node); }},
+    {"L2", [](rclcpp::Node & node) { return std::make_shared<L2PseudoJerkSmoother>(node); }},
+    {"Linf", [](rclcpp::Node & node) { return std::make_shared<LinfPseudoJerkSmoother>(node); }},
+    {"Analytical",
+     [](rclcpp::Node & node) {
+       return std::make_shared<AnalyticalJerkConstrainedSmoother>(node);
+     }},
+  };
+
+  std::printf("smoother, length_m, points, p50_us, p90_us, p99_us, max_us, failures\n");
+  for (const auto & smoother : smoothers) {
+    const auto node = makeParameterNode(smoother.name);
+    for (const double length : {50.0, 100.0, 200.0}) {
+      // a new instance for each trajectory, so that the previous solution is not carried over
+      const auto instance = smoother.make(*node);
+      const auto input = makeFixture(*instance, length, 10.0);
+
+      // The initial velocity changes every call as it does while driving, so that the QP solvers
+      // do not reuse the previous solution as it is.
+      int failures = 0;
+      TrajectoryPoints output;
+      std::vector<TrajectoryPoints> debug_trajectories;
+      const auto histogram = planning_test_utils::measureLatency(
+        [&](const int i) {
+          const double initial_vel = 10.0 + 0.05 * (i % 20);
+          if (!instance->apply(initial_vel, 0.0, input, output, debug_trajectories)) {
+            ++failures;
+          }
+        },
+        iterations);
+
+      std::printf(
+        "%s, %.0f, %zu, %.1f, %.1f, %.1f, %.1f, %d\n", smoother.name.c_str(), length, input.size(),
+        histogram.percentile(0.5), histogram.percentile(0.9), histogram.percentile(0.99),
+        histogram.percentile(1.0), failures);
+      std::fprintf(stderr, "%s, %.0f m\n", smoother.name.c_str(), length);
+      histogram.print(stderr);
+    }
+  }
+
+  rclcpp::shutdown();
+  return 0;
+}
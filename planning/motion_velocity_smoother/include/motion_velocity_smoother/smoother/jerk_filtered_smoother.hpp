@@ -24,6 +24,8 @@
 
 #include "boost/optional.hpp"
 
+#include <Eigen/Core>
+
 #include <vector>
 
 namespace motion_velocity_smoother
@@ -55,8 +57,24 @@ public:
   Param getParam() const;
 
 private:
+  // QP of the previous cycle and its solution. The solution is shifted by the travelled distance
+  // to warm start the next optimization, and is reused as it is when the QP is unchanged.
+  struct PrevSolution
+  {
+    TrajectoryPoints trajectory;     // resampled trajectory which the QP was built on
+    std::vector<double> arc_length;  // arc length of the optimized points
+    Eigen::MatrixXd P;
+    Eigen::MatrixXd A;
+    std::vector<double> q;
+    std::vector<double> lower_bound;
+    std::vector<double> upper_bound;
+    std::vector<double> primal;
+    std::vector<double> dual;
+  };
+
   Param smoother_param_;
   autoware::common::osqp::OSQPInterface qp_solver_;
+  boost::optional<PrevSolution> prev_solution_;
   rclcpp::Logger logger_{rclcpp::get_logger("smoother").get_child("jerk_filtered_smoother")};
 
   TrajectoryPoints forwardJerkFilter(
@@ -68,6 +86,7 @@ private:
   TrajectoryPoints mergeFilteredTrajectory(
     const double v0, const double a0, const double a_min, const double j_min,
     const TrajectoryPoints & forward_filtered, const TrajectoryPoints & backward_filtered) const;
+  bool setWarmStart(const TrajectoryPoints & trajectory, const std::vector<double> & arc_length);
 };
 }  // namespace motion_velocity_smoother
 
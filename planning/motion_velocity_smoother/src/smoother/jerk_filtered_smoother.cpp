@@ -23,12 +23,63 @@
 #include <cmath>
 #include <limits>
 #include <numeric>
+#include <utility>
 #include <vector>
 
 #define VERBOSE_TRAJECTORY_VELOCITY false
 
 namespace motion_velocity_smoother
 {
+namespace
+{
+// the QP is regarded as unchanged and the previous solution is reused when the difference of all
+// the QP data is smaller than this value
+constexpr double same_qp_eps = 1.0e-6;
+
+// the previous solution is not used for the warm start when the new trajectory is laterally far
+// from the previous one, e.g. when the route is changed
+constexpr double max_warm_start_lateral_offset = 1.0;
+
+bool isNear(const std::vector<double> & a, const std::vector<double> & b)
+{
+  return a.size() == b.size() && std::equal(a.begin(), a.end(), b.begin(), [](double x, double y) {
+           return std::abs(x - y) < same_qp_eps;
+         });
+}
+
+bool isNear(const Eigen::MatrixXd & a, const Eigen::MatrixXd & b)
+{
+  return a.rows() == b.rows() && a.cols() == b.cols() &&
+         (a.size() == 0 || (a - b).cwiseAbs().maxCoeff() < same_qp_eps);
+}
+
+// linearly interpolates the values of the nodes at the query arc lengths. The queries out of the
+// base range are clamped to the ends. Both arc lengths must be sorted in ascending order.
+void interpolateNodeValues(
+  const std::vector<double> & base_s, const double * base_values, const size_t base_num,
+  const std::vector<double> & query_s, const size_t query_num, double * query_values)
+{
+  size_t j = 0;
+  for (size_t i = 0; i < query_num; ++i) {
+    const double s = query_s.at(i);
+    if (base_num == 1 || s <= base_s.front()) {
+      query_values[i] = base_values[0];
+      continue;
+    }
+    if (base_s.at(base_num - 1) <= s) {
+      query_values[i] = base_values[base_num - 1];
+      continue;
+    }
+    while (base_s.at(j + 1) < s) {
+      ++j;
+    }
+    const double ds = base_s.at(j + 1) - base_s.at(j);
+    const double ratio = ds < 1.0e-6 ? 0.0 : (s - base_s.at(j)) / ds;
+    query_values[i] = base_values[j] + ratio * (base_values[j + 1] - base_values[j]);
+  }
+}
+}  // namespace
+
 JerkFilteredSmoother::JerkFilteredSmoother(rclcpp::Node & node) : SmootherBase(node)
 {
   auto & p = smoother_param_;
@@ -291,19 +342,56 @@ bool JerkFilteredSmoother::apply(
     ++constr_idx;
   }
 
-  // execute optimization
-  const auto result = qp_solver_.optimize(P, A, q, lower_bound, upper_bound);
-  const std::vector<double> optval = std::get<0>(result);
-  const int status_val = std::get<3>(result);
-  if (status_val != 1) {
-    RCLCPP_WARN(logger_, "optimization failed : %s", qp_solver_.getStatusMessage().c_str());
-    return false;
+  // arc length of the optimized points, which is used to shift the solution in the next cycle
+  std::vector<double> arc_length(N, 0.0);
+  for (size_t i = 1; i < N; ++i) {
+    arc_length.at(i) = arc_length.at(i - 1) + interval_dist_arr.at(i - 1);
   }
-  const auto has_nan =
-    std::any_of(optval.begin(), optval.end(), [](const auto v) { return std::isnan(v); });
-  if (has_nan) {
-    RCLCPP_WARN(logger_, "optimization failed: result contains NaN values");
-    return false;
+
+  // execute optimization
+  std::vector<double> optval;
+  std::vector<double> dual;
+  const bool is_same_qp = prev_solution_ && isNear(prev_solution_->P, P) &&
+                          isNear(prev_solution_->A, A) && isNear(prev_solution_->q, q) &&
+                          isNear(prev_solution_->lower_bound, lower_bound) &&
+                          isNear(prev_solution_->upper_bound, upper_bound);
+  if (is_same_qp) {
+    // e.g. while the ego is stopping, the same QP is given every cycle
+    RCLCPP_DEBUG(logger_, "QP is unchanged. The previous solution is reused.");
+    optval = prev_solution_->primal;
+    dual = prev_solution_->dual;
+  } else {
+    // NOTE: the workspace is kept when the sparsity pattern is unchanged
+    qp_solver_.updateProblem(P, A, q, lower_bound, upper_bound);
+    if (!setWarmStart(opt_resampled_trajectory, arc_length)) {
+      RCLCPP_DEBUG(logger_, "warm start with the previous solution is skipped.");
+    }
+    const auto result = qp_solver_.optimize();
+    optval = std::get<0>(result);
+    dual = std::get<1>(result);
+    const int status_val = std::get<3>(result);
+    if (status_val != 1) {
+      RCLCPP_WARN(logger_, "optimization failed : %s", qp_solver_.getStatusMessage().c_str());
+      prev_solution_ = boost::none;
+      return false;
+    }
+    const auto has_nan =
+      std::any_of(optval.begin(), optval.end(), [](const auto v) { return std::isnan(v); });
+    if (has_nan) {
+      RCLCPP_WARN(logger_, "optimization failed: result contains NaN values");
+      prev_solution_ = boost::none;
+      return false;
+    }
+
+    qp_solver_.logUnsolvedStatus("[motion_velocity_smoother]");
+
+    const int status_polish = std::get<2>(result);
+    if (status_polish != 1) {
+      const auto msg = status_polish == 0    ? "unperformed"
+                       : status_polish == -1 ? "unsuccessful"
+                                             : "unknown";
+      RCLCPP_DEBUG(logger_, "osqp polish process failed : %s. The result may be inaccurate", msg);
+    }
   }
 
   const auto tf1 = std::chrono::system_clock::now();
@@ -322,16 +410,6 @@ bool JerkFilteredSmoother::apply(
     output.at(i).acceleration_mps2 = a_stop_decel;
   }
 
-  qp_solver_.logUnsolvedStatus("[motion_velocity_smoother]");
-
-  const int status_polish = std::get<2>(result);
-  if (status_polish != 1) {
-    const auto msg = status_polish == 0    ? "unperformed"
-                     : status_polish == -1 ? "unsuccessful"
-                                           : "unknown";
-    RCLCPP_DEBUG(logger_, "osqp polish process failed : %s. The result may be inaccurate", msg);
-  }
-
   if (VERBOSE_TRAJECTORY_VELOCITY) {
     const auto s_output = trajectory_utils::calcArclengthArray(output);
 
@@ -349,9 +427,74 @@ bool JerkFilteredSmoother::apply(
     }
   }
 
+  if (!is_same_qp) {
+    prev_solution_ = PrevSolution{
+      std::move(opt_resampled_trajectory),
+      std::move(arc_length),
+      std::move(P),
+      std::move(A),
+      std::move(q),
+      std::move(lower_bound),
+      std::move(upper_bound),
+      std::move(optval),
+      std::move(dual)};
+  }
+
   return true;
 }
 
+bool JerkFilteredSmoother::setWarmStart(
+  const TrajectoryPoints & trajectory, const std::vector<double> & arc_length)
+{
+  if (!prev_solution_ || trajectory.empty()) {
+    return false;
+  }
+  const auto & prev = *prev_solution_;
+  const auto & start_point = trajectory.front().pose.position;
+
+  const double lateral_offset = motion_utils::calcLateralOffset(prev.trajectory, start_point);
+  if (!(std::abs(lateral_offset) < max_warm_start_lateral_offset)) {
+    return false;
+  }
+
+  // the previous solution is shifted by the distance the ego travelled since the last cycle
+  const double travelled_dist = motion_utils::calcSignedArcLength(prev.trajectory, 0, start_point);
+  if (!std::isfinite(travelled_dist)) {
+    return false;
+  }
+  std::vector<double> query_s(arc_length.size());
+  std::transform(
+    arc_length.begin(), arc_length.end(), query_s.begin(),
+    [&](const double s) { return s + travelled_dist; });
+
+  // variables: b, a, delta, sigma, gamma for each point
+  const size_t N = arc_length.size();
+  const size_t prev_N = prev.arc_length.size();
+  std::vector<double> primal(5 * N);
+  for (size_t k = 0; k < 5; ++k) {
+    interpolateNodeValues(
+      prev.arc_length, prev.primal.data() + k * prev_N, prev_N, query_s, N,
+      primal.data() + k * N);
+  }
+
+  // constraints: velocity and acceleration for each point, jerk and b' for each interval, the
+  // initial b and a, and the last empty row
+  std::vector<double> dual(4 * N + 1, 0.0);
+  const std::vector<size_t> prev_offsets{0, prev_N, 2 * prev_N, 3 * prev_N - 1};
+  const std::vector<size_t> offsets{0, N, 2 * N, 3 * N - 1};
+  const std::vector<size_t> prev_sizes{prev_N, prev_N, prev_N - 1, prev_N - 1};
+  const std::vector<size_t> sizes{N, N, N - 1, N - 1};
+  for (size_t k = 0; k < 4; ++k) {
+    interpolateNodeValues(
+      prev.arc_length, prev.dual.data() + prev_offsets.at(k), prev_sizes.at(k), query_s,
+      sizes.at(k), dual.data() + offsets.at(k));
+  }
+  dual.at(4 * N - 2) = prev.dual.at(4 * prev_N - 2);
+  dual.at(4 * N - 1) = prev.dual.at(4 * prev_N - 1);
+
+  return qp_solver_.setWarmStart(primal, dual);
+}
+
 TrajectoryPoints JerkFilteredSmoother::forwardJerkFilter(
   const double v0, const double a0, const double a_max, const double a_start, const double j_max,
   const TrajectoryPoints & input) const
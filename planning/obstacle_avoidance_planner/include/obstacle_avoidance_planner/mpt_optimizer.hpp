@@ -128,15 +128,17 @@ private:
     Eigen::SparseMatrix<double> R;
   };
 
+  // NOTE: hessian and linear are assembled with sparsity patterns which only depend on the
+  //       problem size and the constraint settings, so that OSQP can be updated by values.
   struct ObjectiveMatrix
   {
-    Eigen::MatrixXd hessian;
+    Eigen::SparseMatrix<double> hessian;
     Eigen::VectorXd gradient;
   };
 
   struct ConstraintMatrix
   {
-    Eigen::MatrixXd linear;
+    Eigen::SparseMatrix<double> linear;
     Eigen::VectorXd lower_bound;
     Eigen::VectorXd upper_bound;
   };
@@ -238,6 +240,8 @@ private:
   // previous data
   int prev_mat_n_ = 0;
   int prev_mat_m_ = 0;
+  autoware::common::osqp::CSC_Matrix prev_P_csc_;
+  autoware::common::osqp::CSC_Matrix prev_A_csc_;
   int prev_solution_status_ = 0;
   std::shared_ptr<std::vector<ReferencePoint>> prev_ref_points_ptr_{nullptr};
   std::shared_ptr<std::vector<TrajectoryPoint>> prev_optimized_traj_points_ptr_{nullptr};
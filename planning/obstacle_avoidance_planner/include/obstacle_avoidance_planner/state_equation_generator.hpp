@@ -29,10 +29,12 @@ struct ReferencePoint;
 class StateEquationGenerator
 {
 public:
+  // NOTE: A and B are block-banded, so they are stored as sparse matrices.
+  //       Their sparsity patterns only depend on the number of reference points.
   struct Matrix
   {
-    Eigen::MatrixXd A;
-    Eigen::MatrixXd B;
+    Eigen::SparseMatrix<double> A;
+    Eigen::SparseMatrix<double> B;
     Eigen::VectorXd W;
   };
 
@@ -1266,14 +1266,30 @@ MPTOptimizer::ObjectiveMatrix MPTOptimizer::calcObjectiveMatrix(
   sparse_T_mat.setFromTriplets(triplet_T_vec.begin(), triplet_T_vec.end());
 
   // NOTE: min J(v) = min (v'Hv + v'g)
-  Eigen::MatrixXd H_x = Eigen::MatrixXd::Zero(N_x, N_x);
-  H_x.triangularView<Eigen::Upper>() =
-    Eigen::MatrixXd(sparse_T_mat.transpose() * val_mat.Q * sparse_T_mat);
-  H_x.triangularView<Eigen::Lower>() = H_x.transpose();
-
-  Eigen::MatrixXd H = Eigen::MatrixXd::Zero(N_v, N_v);
-  H.block(0, 0, N_x, N_x) = H_x;
-  H.block(N_x, N_x, N_u, N_u) = val_mat.R;
+  //       H_x is symmetric and block diagonal. Its upper triangle is mirrored to the lower one.
+  const Eigen::SparseMatrix<double> H_x = sparse_T_mat.transpose() * val_mat.Q * sparse_T_mat;
+
+  std::vector<Eigen::Triplet<double>> H_triplet_vec;
+  H_triplet_vec.reserve(2 * H_x.nonZeros() + val_mat.R.nonZeros());
+  for (int k = 0; k < H_x.outerSize(); ++k) {
+    for (Eigen::SparseMatrix<double>::InnerIterator itr(H_x, k); itr; ++itr) {
+      if (itr.row() > itr.col()) {
+        continue;
+      }
+      H_triplet_vec.push_back(Eigen::Triplet<double>(itr.row(), itr.col(), itr.value()));
+      if (itr.row() < itr.col()) {
+        H_triplet_vec.push_back(Eigen::Triplet<double>(itr.col(), itr.row(), itr.value()));
+      }
+    }
+  }
+  for (int k = 0; k < val_mat.R.outerSize(); ++k) {
+    for (Eigen::SparseMatrix<double>::InnerIterator itr(val_mat.R, k); itr; ++itr) {
+      H_triplet_vec.push_back(
+        Eigen::Triplet<double>(N_x + itr.row(), N_x + itr.col(), itr.value()));
+    }
+  }
+  Eigen::SparseMatrix<double> H(N_v, N_v);
+  H.setFromTriplets(H_triplet_vec.begin(), H_triplet_vec.end());
 
   Eigen::VectorXd g = Eigen::VectorXd::Zero(N_v);
   g.segment(0, N_x) = T_vec.transpose() * val_mat.Q * sparse_T_mat;
@@ -1335,15 +1351,36 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
     A_rows += N_u;
   }
 
-  // NOTE: The following takes 1 [ms]
-  Eigen::MatrixXd A = Eigen::MatrixXd::Zero(A_rows, N_v);
+  // NOTE: A is assembled by triplets whose entries are pushed regardless of their values, so
+  //       that its sparsity pattern only depends on the problem size and the constraint settings.
+  std::vector<Eigen::Triplet<double>> A_triplet_vec;
   Eigen::VectorXd lb = Eigen::VectorXd::Constant(A_rows, -autoware::common::osqp::INF);
   Eigen::VectorXd ub = Eigen::VectorXd::Constant(A_rows, autoware::common::osqp::INF);
   size_t A_rows_end = 0;
 
+  const auto add_sparse_block = [&](
+                                  const Eigen::SparseMatrix<double> & mat, const size_t row_offset,
+                                  const size_t col_offset, const double scale) {
+    for (int k = 0; k < mat.outerSize(); ++k) {
+      for (Eigen::SparseMatrix<double>::InnerIterator itr(mat, k); itr; ++itr) {
+        A_triplet_vec.push_back(Eigen::Triplet<double>(
+          row_offset + itr.row(), col_offset + itr.col(), scale * itr.value()));
+      }
+    }
+  };
+  const auto add_identity_block = [&](
+                                    const size_t size, const size_t row_offset,
+                                    const size_t col_offset) {
+    for (size_t i = 0; i < size; ++i) {
+      A_triplet_vec.push_back(Eigen::Triplet<double>(row_offset + i, col_offset + i, 1.0));
+    }
+  };
+
   // 1. State equation
-  A.block(0, 0, N_x, N_x) = Eigen::MatrixXd::Identity(N_x, N_x) - mpt_mat.A;
-  A.block(0, N_x, N_x, N_u) = -mpt_mat.B;
+  // [I - A | -B] where A and B are block-banded
+  add_identity_block(N_x, 0, 0);
+  add_sparse_block(mpt_mat.A, 0, 0, -1.0);
+  add_sparse_block(mpt_mat.B, 0, N_x, -1.0);
   lb.segment(0, N_x) = mpt_mat.W;
   ub.segment(0, N_x) = mpt_mat.W;
   A_rows_end += N_x;
@@ -1379,16 +1416,13 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
       // A := [C | O | ... | O | I | O | ...
       //      -C | O | ... | O | I | O | ...
       //          O    | O | ... | O | I | O | ... ]
-      Eigen::MatrixXd A_blk = Eigen::MatrixXd::Zero(A_blk_rows, N_v);
-      A_blk.block(0, 0, N_ref, N_x) = C_sparse_mat;
-      A_blk.block(N_ref, 0, N_ref, N_x) = -C_sparse_mat;
+      add_sparse_block(C_sparse_mat, A_rows_end, 0, 1.0);
+      add_sparse_block(C_sparse_mat, A_rows_end + N_ref, 0, -1.0);
 
       const size_t local_A_offset_cols = N_x + N_u + (!mpt_param_.l_inf_norm ? N_ref * l_idx : 0);
-      A_blk.block(0, local_A_offset_cols, N_ref, N_ref) = Eigen::MatrixXd::Identity(N_ref, N_ref);
-      A_blk.block(N_ref, local_A_offset_cols, N_ref, N_ref) =
-        Eigen::MatrixXd::Identity(N_ref, N_ref);
-      A_blk.block(2 * N_ref, local_A_offset_cols, N_ref, N_ref) =
-        Eigen::MatrixXd::Identity(N_ref, N_ref);
+      add_identity_block(N_ref, A_rows_end, local_A_offset_cols);
+      add_identity_block(N_ref, A_rows_end + N_ref, local_A_offset_cols);
+      add_identity_block(N_ref, A_rows_end + 2 * N_ref, local_A_offset_cols);
 
       // lb := [lower_bound - C
       //        C - upper_bound
@@ -1397,7 +1431,6 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
       lb_blk.segment(0, N_ref) = -C_vec + part_lb;
       lb_blk.segment(N_ref, N_ref) = C_vec - part_ub;
 
-      A.block(A_rows_end, 0, A_blk_rows, N_v) = A_blk;
       lb.segment(A_rows_end, A_blk_rows) = lb_blk;
 
       A_rows_end += A_blk_rows;
@@ -1407,10 +1440,8 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
     if (mpt_param_.hard_constraint) {
       const size_t A_blk_rows = N_ref;
 
-      Eigen::MatrixXd A_blk = Eigen::MatrixXd::Zero(A_blk_rows, N_v);
-      A_blk.block(0, 0, N_ref, N_ref) = C_sparse_mat;
+      add_sparse_block(C_sparse_mat, A_rows_end, 0, 1.0);
 
-      A.block(A_rows_end, 0, A_blk_rows, N_v) = A_blk;
       lb.segment(A_rows_end, A_blk_rows) = part_lb - C_vec;
       ub.segment(A_rows_end, A_blk_rows) = part_ub - C_vec;
 
@@ -1421,7 +1452,7 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
   // 3. fixed points constraint
   // X = B v + w where point is fixed
   for (const size_t i : fixed_points_indices) {
-    A.block(A_rows_end, D_x * i, D_x, D_x) = Eigen::MatrixXd::Identity(D_x, D_x);
+    add_identity_block(D_x, A_rows_end, D_x * i);
 
     lb.segment(A_rows_end, D_x) = ref_points.at(i).fixed_kinematic_state->toEigenVector();
     ub.segment(A_rows_end, D_x) = ref_points.at(i).fixed_kinematic_state->toEigenVector();
@@ -1431,7 +1462,7 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
 
   // 4. steer angle limit
   if (mpt_param_.steer_limit_constraint) {
-    A.block(A_rows_end, N_x, N_u, N_u) = Eigen::MatrixXd::Identity(N_u, N_u);
+    add_identity_block(N_u, A_rows_end, N_x);
 
     // TODO(murooka) use curvature by stabling optimization
     // Currently, when using curvature, the optimization result is weird with sample_map.
@@ -1448,6 +1479,9 @@ MPTOptimizer::ConstraintMatrix MPTOptimizer::calcConstraintMatrix(
     A_rows_end += N_u;
   }
 
+  Eigen::SparseMatrix<double> A(A_rows, N_v);
+  A.setFromTriplets(A_triplet_vec.begin(), A_triplet_vec.end());
+
   time_keeper_ptr_->toc(__func__, "        ");
   return ConstraintMatrix{A, lb, ub};
 }
@@ -1500,8 +1534,8 @@ std::optional<Eigen::VectorXd> MPTOptimizer::calcOptimizedSteerAngles(
     updateMatrixForManualWarmStart(obj_mat, const_mat, u0);
 
   // calculate matrices for qp
-  const Eigen::MatrixXd & H = updated_obj_mat.hessian;
-  const Eigen::MatrixXd & A = updated_const_mat.linear;
+  const Eigen::SparseMatrix<double> & H = updated_obj_mat.hessian;
+  const Eigen::SparseMatrix<double> & A = updated_const_mat.linear;
   const auto f = toStdVector(updated_obj_mat.gradient);
   const auto upper_bound = toStdVector(updated_const_mat.upper_bound);
   const auto lower_bound = toStdVector(updated_const_mat.lower_bound);
@@ -1512,9 +1546,15 @@ std::optional<Eigen::VectorXd> MPTOptimizer::calcOptimizedSteerAngles(
   const autoware::common::osqp::CSC_Matrix P_csc =
     autoware::common::osqp::calCSCMatrixTrapezoidal(H);
   const autoware::common::osqp::CSC_Matrix A_csc = autoware::common::osqp::calCSCMatrix(A);
+  // NOTE: OSQP can be updated by values only when the sparsity patterns are same as the previous
+  //       ones.
+  const auto is_same_pattern = [](const auto & csc, const auto & prev_csc) {
+    return csc.m_row_idxs == prev_csc.m_row_idxs && csc.m_col_idxs == prev_csc.m_col_idxs;
+  };
   if (
     prev_solution_status_ == 1 && mpt_param_.enable_warm_start && prev_mat_n_ == H.rows() &&
-    prev_mat_m_ == A.rows()) {
+    prev_mat_m_ == A.rows() && is_same_pattern(P_csc, prev_P_csc_) &&
+    is_same_pattern(A_csc, prev_A_csc_)) {
     RCLCPP_INFO_EXPRESSION(logger_, enable_debug_info_, "warm start");
     osqp_solver_ptr_->updateCscP(P_csc);
     osqp_solver_ptr_->updateQ(f);
@@ -1528,6 +1568,8 @@ std::optional<Eigen::VectorXd> MPTOptimizer::calcOptimizedSteerAngles(
   }
   prev_mat_n_ = H.rows();
   prev_mat_m_ = A.rows();
+  prev_P_csc_ = P_csc;
+  prev_A_csc_ = A_csc;
 
   time_keeper_ptr_->toc("initOsqp", "          ");
 
@@ -1620,8 +1662,8 @@ MPTOptimizer::updateMatrixForManualWarmStart(
     return {obj_mat, const_mat};
   }
 
-  const Eigen::MatrixXd & H = obj_mat.hessian;
-  const Eigen::MatrixXd & A = const_mat.linear;
+  const Eigen::SparseMatrix<double> & H = obj_mat.hessian;
+  const Eigen::SparseMatrix<double> & A = const_mat.linear;
 
   auto updated_obj_mat = obj_mat;
   auto updated_const_mat = const_mat;
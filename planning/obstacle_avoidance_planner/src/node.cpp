@@ -23,6 +23,8 @@
 
 #include <chrono>
 #include <limits>
+#include <memory>
+#include <utility>
 
 namespace obstacle_avoidance_planner
 {
@@ -88,12 +90,19 @@ ObstacleAvoidancePlanner::ObstacleAvoidancePlanner(const rclcpp::NodeOptions & n
   time_keeper_ptr_(std::make_shared<TimeKeeper>())
 {
   // interface publisher
-  traj_pub_ = create_publisher<Trajectory>("~/output/path", 1);
+  // NOTE: the trajectory is handed over to the next planner in the same container with
+  // intra-process communication, which does not serialize nor copy the message
+  rclcpp::PublisherOptions traj_pub_options;
+  traj_pub_options.use_intra_process_comm = rclcpp::IntraProcessSetting::Enable;
+  traj_pub_ = create_publisher<Trajectory>("~/output/path", 1, traj_pub_options);
   virtual_wall_pub_ = create_publisher<MarkerArray>("~/virtual_wall", 1);
 
   // interface subscriber
+  rclcpp::SubscriptionOptions path_sub_options;
+  path_sub_options.use_intra_process_comm = rclcpp::IntraProcessSetting::Enable;
   path_sub_ = create_subscription<Path>(
-    "~/input/path", 1, std::bind(&ObstacleAvoidancePlanner::onPath, this, std::placeholders::_1));
+    "~/input/path", 1, std::bind(&ObstacleAvoidancePlanner::onPath, this, std::placeholders::_1),
+    path_sub_options);
   odom_sub_ = create_subscription<Odometry>(
     "~/input/odometry", 1, [this](const Odometry::ConstSharedPtr msg) { ego_state_ptr_ = msg; });
 
@@ -236,8 +245,8 @@ void ObstacleAvoidancePlanner::onPath(const Path::ConstSharedPtr path_ptr)
       "Backward path is NOT supported. Just converting path to trajectory");
 
     const auto traj_points = trajectory_utils::convertToTrajectoryPoints(path_ptr->points);
-    const auto output_traj_msg = trajectory_utils::createTrajectory(path_ptr->header, traj_points);
-    traj_pub_->publish(output_traj_msg);
+    auto output_traj_msg = trajectory_utils::createTrajectory(path_ptr->header, traj_points);
+    traj_pub_->publish(std::make_unique<Trajectory>(std::move(output_traj_msg)));
     return;
   }
 
@@ -267,9 +276,8 @@ void ObstacleAvoidancePlanner::onPath(const Path::ConstSharedPtr path_ptr)
   debug_calculation_time_float_pub_->publish(
     createFloat64Stamped(now(), time_keeper_ptr_->getAccumulatedTime()));
 
-  const auto output_traj_msg =
-    trajectory_utils::createTrajectory(path_ptr->header, full_traj_points);
-  traj_pub_->publish(output_traj_msg);
+  auto output_traj_msg = trajectory_utils::createTrajectory(path_ptr->header, full_traj_points);
+  traj_pub_->publish(std::make_unique<Trajectory>(std::move(output_traj_msg)));
 }
 
 bool ObstacleAvoidancePlanner::isDataReady(const Path & path, rclcpp::Clock clock) const
@@ -33,8 +33,10 @@ StateEquationGenerator::Matrix StateEquationGenerator::calcMatrix(
   const size_t N_u = (N_ref - 1) * D_u;
 
   // matrices for whole state equation
-  Eigen::MatrixXd A = Eigen::MatrixXd::Zero(N_x, N_x);
-  Eigen::MatrixXd B = Eigen::MatrixXd::Zero(N_x, N_u);
+  std::vector<Eigen::Triplet<double>> A_triplet_vec;
+  std::vector<Eigen::Triplet<double>> B_triplet_vec;
+  A_triplet_vec.reserve(D_x + (N_ref - 1) * D_x * D_x);
+  B_triplet_vec.reserve((N_ref - 1) * D_x * D_u);
   Eigen::VectorXd W = Eigen::VectorXd::Zero(N_x);
 
   // matrices for one-step state equation
@@ -42,7 +44,9 @@ StateEquationGenerator::Matrix StateEquationGenerator::calcMatrix(
   Eigen::MatrixXd Bd(D_x, D_u);
   Eigen::MatrixXd Wd(D_x, 1);
 
-  A.block(0, 0, D_x, D_x) = Eigen::MatrixXd::Identity(D_x, D_x);
+  for (size_t j = 0; j < D_x; ++j) {
+    A_triplet_vec.push_back(Eigen::Triplet<double>(j, j, 1.0));
+  }
 
   // calculate one-step state equation considering kinematics N_ref times
   for (size_t i = 1; i < N_ref; ++i) {
@@ -55,11 +59,24 @@ StateEquationGenerator::Matrix StateEquationGenerator::calcMatrix(
     // p.delta_arc_length);
     vehicle_model_ptr_->calculateStateEquationMatrix(Ad, Bd, Wd, 0.0, p.delta_arc_length);
 
-    A.block(i * D_x, (i - 1) * D_x, D_x, D_x) = Ad;
-    B.block(i * D_x, (i - 1) * D_u, D_x, D_u) = Bd;
+    // NOTE: all the entries of the blocks are stored even if they are zero to keep the sparsity
+    //       pattern fixed.
+    for (size_t r = 0; r < D_x; ++r) {
+      for (size_t c = 0; c < D_x; ++c) {
+        A_triplet_vec.push_back(Eigen::Triplet<double>(i * D_x + r, (i - 1) * D_x + c, Ad(r, c)));
+      }
+      for (size_t c = 0; c < D_u; ++c) {
+        B_triplet_vec.push_back(Eigen::Triplet<double>(i * D_x + r, (i - 1) * D_u + c, Bd(r, c)));
+      }
+    }
     W.segment(i * D_x, D_x) = Wd;
   }
 
+  Eigen::SparseMatrix<double> A(N_x, N_x);
+  A.setFromTriplets(A_triplet_vec.begin(), A_triplet_vec.end());
+  Eigen::SparseMatrix<double> B(N_x, N_u);
+  B.setFromTriplets(B_triplet_vec.begin(), B_triplet_vec.end());
+
   time_keeper_ptr_->toc(__func__, "        ");
   return Matrix{A, B, W};
 }
@@ -15,6 +15,7 @@
 #ifndef OBSTACLE_CRUISE_PLANNER__NODE_HPP_
 #define OBSTACLE_CRUISE_PLANNER__NODE_HPP_
 
+#include "motion_utils/trajectory/trajectory_footprint.hpp"
 #include "obstacle_cruise_planner/common_structs.hpp"
 #include "obstacle_cruise_planner/optimization_based_planner/optimization_based_planner.hpp"
 #include "obstacle_cruise_planner/pid_based_planner/pid_based_planner.hpp"
@@ -60,25 +61,27 @@ private:
   std::vector<TrajectoryPoint> decimateTrajectoryPoints(
     const std::vector<TrajectoryPoint> & traj_points) const;
   std::optional<StopObstacle> createStopObstacle(
-    const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polys,
-    const Obstacle & obstacle, const double precise_lateral_dist) const;
+    const std::vector<TrajectoryPoint> & traj_points,
+    const motion_utils::TrajectoryFootprint & traj_footprint, const Obstacle & obstacle,
+    const double precise_lateral_dist) const;
   bool isStopObstacle(const uint8_t label) const;
   bool isInsideCruiseObstacle(const uint8_t label) const;
   bool isOutsideCruiseObstacle(const uint8_t label) const;
   bool isCruiseObstacle(const uint8_t label) const;
   bool isSlowDownObstacle(const uint8_t label) const;
   std::optional<geometry_msgs::msg::Point> createCollisionPointForStopObstacle(
-    const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polys,
-    const Obstacle & obstacle) const;
+    const std::vector<TrajectoryPoint> & traj_points,
+    const motion_utils::TrajectoryFootprint & traj_footprint, const Obstacle & obstacle) const;
   std::optional<CruiseObstacle> createCruiseObstacle(
-    const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polys,
-    const Obstacle & obstacle, const double precise_lat_dist);
+    const std::vector<TrajectoryPoint> & traj_points,
+    const motion_utils::TrajectoryFootprint & traj_footprint, const Obstacle & obstacle,
+    const double precise_lat_dist);
   std::optional<std::vector<PointWithStamp>> createCollisionPointsForInsideCruiseObstacle(
-    const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polys,
-    const Obstacle & obstacle) const;
+    const std::vector<TrajectoryPoint> & traj_points,
+    const motion_utils::TrajectoryFootprint & traj_footprint, const Obstacle & obstacle) const;
   std::optional<std::vector<PointWithStamp>> createCollisionPointsForOutsideCruiseObstacle(
-    const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polys,
-    const Obstacle & obstacle) const;
+    const std::vector<TrajectoryPoint> & traj_points,
+    const motion_utils::TrajectoryFootprint & traj_footprint, const Obstacle & obstacle) const;
   bool isObstacleCrossing(
     const std::vector<TrajectoryPoint> & traj_points, const Obstacle & obstacle) const;
   double calcCollisionTimeMargin(
@@ -15,6 +15,7 @@
 #ifndef OBSTACLE_CRUISE_PLANNER__POLYGON_UTILS_HPP_
 #define OBSTACLE_CRUISE_PLANNER__POLYGON_UTILS_HPP_
 
+#include "motion_utils/trajectory/trajectory_footprint.hpp"
 #include "obstacle_cruise_planner/common_structs.hpp"
 #include "obstacle_cruise_planner/type_alias.hpp"
 #include "tier4_autoware_utils/geometry/boost_geometry.hpp"
@@ -39,14 +40,15 @@ Polygon2d createOneStepPolygon(
   const vehicle_info_util::VehicleInfo & vehicle_info, const double lat_margin);
 
 std::optional<geometry_msgs::msg::Point> getCollisionPoint(
-  const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polygons,
-  const Obstacle & obstacle, const bool is_driving_forward);
+  const std::vector<TrajectoryPoint> & traj_points,
+  const motion_utils::TrajectoryFootprint & traj_footprint, const Obstacle & obstacle,
+  const bool is_driving_forward);
 
 std::vector<PointWithStamp> getCollisionPoints(
-  const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polygons,
-  const rclcpp::Time & obstacle_stamp, const PredictedPath & predicted_path, const Shape & shape,
-  const rclcpp::Time & current_time, const bool is_driving_forward,
-  std::vector<size_t> & collision_index,
+  const std::vector<TrajectoryPoint> & traj_points,
+  const motion_utils::TrajectoryFootprint & traj_footprint, const rclcpp::Time & obstacle_stamp,
+  const PredictedPath & predicted_path, const Shape & shape, const rclcpp::Time & current_time,
+  const bool is_driving_forward, std::vector<size_t> & collision_index,
   const double max_lat_dist = std::numeric_limits<double>::max(),
   const double max_prediction_time_for_collision_check = std::numeric_limits<double>::max());
 
@@ -353,9 +353,13 @@ ObstacleCruisePlannerNode::ObstacleCruisePlannerNode(const rclcpp::NodeOptions &
   using std::placeholders::_1;
 
   // subscriber
+  // NOTE: the trajectory is received from the previous planner in the same container with
+  // intra-process communication, which does not serialize nor copy the message
+  rclcpp::SubscriptionOptions traj_sub_options;
+  traj_sub_options.use_intra_process_comm = rclcpp::IntraProcessSetting::Enable;
   traj_sub_ = create_subscription<Trajectory>(
     "~/input/trajectory", rclcpp::QoS{1},
-    std::bind(&ObstacleCruisePlannerNode::onTrajectory, this, _1));
+    std::bind(&ObstacleCruisePlannerNode::onTrajectory, this, _1), traj_sub_options);
   objects_sub_ = create_subscription<PredictedObjects>(
     "~/input/objects", rclcpp::QoS{1},
     [this](const PredictedObjects::ConstSharedPtr msg) { objects_ptr_ = msg; });
@@ -716,9 +720,9 @@ ObstacleCruisePlannerNode::determineEgoBehaviorAgainstObstacles(
 
   // calculated decimated trajectory points and trajectory polygon
   const auto decimated_traj_points = decimateTrajectoryPoints(traj_points);
-  const auto decimated_traj_polys =
-    createOneStepPolygons(decimated_traj_points, vehicle_info_, ego_odom_ptr_->pose.pose);
-  debug_data_ptr_->detection_polygons = decimated_traj_polys;
+  const motion_utils::TrajectoryFootprint decimated_traj_footprint(
+    createOneStepPolygons(decimated_traj_points, vehicle_info_, ego_odom_ptr_->pose.pose));
+  debug_data_ptr_->detection_polygons = decimated_traj_footprint.getFootprints();
 
   // determine ego's behavior from stop, cruise and slow down
   std::vector<StopObstacle> stop_obstacles;
@@ -729,21 +733,17 @@ ObstacleCruisePlannerNode::determineEgoBehaviorAgainstObstacles(
     const auto obstacle_poly = obstacle.toPolygon();
 
     // Calculate distance between trajectory and obstacle first
-    double precise_lat_dist = std::numeric_limits<double>::max();
-    for (const auto & traj_poly : decimated_traj_polys) {
-      const double current_precise_lat_dist = bg::distance(traj_poly, obstacle_poly);
-      precise_lat_dist = std::min(precise_lat_dist, current_precise_lat_dist);
-    }
+    const double precise_lat_dist = decimated_traj_footprint.calcDistance(obstacle_poly);
 
     // Filter obstacles for cruise, stop and slow down
-    const auto cruise_obstacle =
-      createCruiseObstacle(decimated_traj_points, decimated_traj_polys, obstacle, precise_lat_dist);
+    const auto cruise_obstacle = createCruiseObstacle(
+      decimated_traj_points, decimated_traj_footprint, obstacle, precise_lat_dist);
     if (cruise_obstacle) {
       cruise_obstacles.push_back(*cruise_obstacle);
       continue;
     }
-    const auto stop_obstacle =
-      createStopObstacle(decimated_traj_points, decimated_traj_polys, obstacle, precise_lat_dist);
+    const auto stop_obstacle = createStopObstacle(
+      decimated_traj_points, decimated_traj_footprint, obstacle, precise_lat_dist);
     if (stop_obstacle) {
       stop_obstacles.push_back(*stop_obstacle);
       continue;
@@ -799,8 +799,9 @@ std::vector<TrajectoryPoint> ObstacleCruisePlannerNode::decimateTrajectoryPoints
 }
 
 std::optional<CruiseObstacle> ObstacleCruisePlannerNode::createCruiseObstacle(
-  const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polys,
-  const Obstacle & obstacle, const double precise_lat_dist)
+  const std::vector<TrajectoryPoint> & traj_points,
+  const motion_utils::TrajectoryFootprint & traj_footprint, const Obstacle & obstacle,
+  const double precise_lat_dist)
 {
   const auto & object_id = obstacle.uuid.substr(0, 4);
   const auto & p = behavior_determination_param_;
@@ -828,10 +829,10 @@ std::optional<CruiseObstacle> ObstacleCruisePlannerNode::createCruiseObstacle(
     constexpr double epsilon = 1e-6;
     if (precise_lat_dist < epsilon) {
       // obstacle is inside the trajectory
-      return createCollisionPointsForInsideCruiseObstacle(traj_points, traj_polys, obstacle);
+      return createCollisionPointsForInsideCruiseObstacle(traj_points, traj_footprint, obstacle);
     }
     // obstacle is outside the trajectory
-    return createCollisionPointsForOutsideCruiseObstacle(traj_points, traj_polys, obstacle);
+    return createCollisionPointsForOutsideCruiseObstacle(traj_points, traj_footprint, obstacle);
   }();
   if (!collision_points) {
     return std::nullopt;
@@ -844,8 +845,8 @@ std::optional<CruiseObstacle> ObstacleCruisePlannerNode::createCruiseObstacle(
 
 std::optional<std::vector<PointWithStamp>>
 ObstacleCruisePlannerNode::createCollisionPointsForInsideCruiseObstacle(
-  const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polys,
-  const Obstacle & obstacle) const
+  const std::vector<TrajectoryPoint> & traj_points,
+  const motion_utils::TrajectoryFootprint & traj_footprint, const Obstacle & obstacle) const
 {
   const auto & object_id = obstacle.uuid.substr(0, 4);
   const auto & p = behavior_determination_param_;
@@ -889,15 +890,15 @@ ObstacleCruisePlannerNode::createCollisionPointsForInsideCruiseObstacle(
   // calculate nearest collision point
   std::vector<size_t> collision_index;
   const auto collision_points = polygon_utils::getCollisionPoints(
-    traj_points, traj_polys, obstacle.stamp, resampled_predicted_path, obstacle.shape, now(),
+    traj_points, traj_footprint, obstacle.stamp, resampled_predicted_path, obstacle.shape, now(),
     is_driving_forward_, collision_index);
   return collision_points;
 }
 
 std::optional<std::vector<PointWithStamp>>
 ObstacleCruisePlannerNode::createCollisionPointsForOutsideCruiseObstacle(
-  const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polys,
-  const Obstacle & obstacle) const
+  const std::vector<TrajectoryPoint> & traj_points,
+  const motion_utils::TrajectoryFootprint & traj_footprint, const Obstacle & obstacle) const
 {
   const auto & p = behavior_determination_param_;
   const auto & object_id = obstacle.uuid.substr(0, 4);
@@ -928,7 +929,7 @@ ObstacleCruisePlannerNode::createCollisionPointsForOutsideCruiseObstacle(
   // calculate collision condition for cruise
   std::vector<size_t> collision_index;
   const auto collision_points = polygon_utils::getCollisionPoints(
-    traj_points, traj_polys, obstacle.stamp, resampled_predicted_path, obstacle.shape, now(),
+    traj_points, traj_footprint, obstacle.stamp, resampled_predicted_path, obstacle.shape, now(),
     is_driving_forward_, collision_index,
     vehicle_info_.vehicle_width_m + p.max_lat_margin_for_cruise,
     p.max_prediction_time_for_collision_check);
@@ -967,8 +968,9 @@ ObstacleCruisePlannerNode::createCollisionPointsForOutsideCruiseObstacle(
 }
 
 std::optional<StopObstacle> ObstacleCruisePlannerNode::createStopObstacle(
-  const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polys,
-  const Obstacle & obstacle, const double precise_lat_dist) const
+  const std::vector<TrajectoryPoint> & traj_points,
+  const motion_utils::TrajectoryFootprint & traj_footprint, const Obstacle & obstacle,
+  const double precise_lat_dist) const
 {
   const auto & p = behavior_determination_param_;
 
@@ -992,7 +994,7 @@ std::optional<StopObstacle> ObstacleCruisePlannerNode::createStopObstacle(
   }
 
   const auto collision_point =
-    createCollisionPointForStopObstacle(traj_points, traj_polys, obstacle);
+    createCollisionPointForStopObstacle(traj_points, traj_footprint, obstacle);
   if (!collision_point) {
     return std::nullopt;
   }
@@ -1004,8 +1006,8 @@ std::optional<StopObstacle> ObstacleCruisePlannerNode::createStopObstacle(
 
 std::optional<geometry_msgs::msg::Point>
 ObstacleCruisePlannerNode::createCollisionPointForStopObstacle(
-  const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polys,
-  const Obstacle & obstacle) const
+  const std::vector<TrajectoryPoint> & traj_points,
+  const motion_utils::TrajectoryFootprint & traj_footprint, const Obstacle & obstacle) const
 {
   const auto & p = behavior_determination_param_;
   const auto & object_id = obstacle.uuid.substr(0, 4);
@@ -1023,7 +1025,7 @@ ObstacleCruisePlannerNode::createCollisionPointForStopObstacle(
 
     std::vector<size_t> collision_index;
     const auto collision_points = polygon_utils::getCollisionPoints(
-      traj_points, traj_polys, obstacle.stamp, resampled_predicted_path, obstacle.shape, now(),
+      traj_points, traj_footprint, obstacle.stamp, resampled_predicted_path, obstacle.shape, now(),
       is_driving_forward_, collision_index);
     if (collision_points.empty()) {
       RCLCPP_INFO_EXPRESSION(
@@ -1049,10 +1051,10 @@ ObstacleCruisePlannerNode::createCollisionPointForStopObstacle(
   }
 
   // calculate collision points with trajectory with lateral stop margin
-  const auto traj_polys_with_lat_margin = createOneStepPolygons(
-    traj_points, vehicle_info_, ego_odom_ptr_->pose.pose, p.max_lat_margin_for_stop);
+  const motion_utils::TrajectoryFootprint traj_footprint_with_lat_margin(createOneStepPolygons(
+    traj_points, vehicle_info_, ego_odom_ptr_->pose.pose, p.max_lat_margin_for_stop));
   const auto collision_point = polygon_utils::getCollisionPoint(
-    traj_points, traj_polys_with_lat_margin, obstacle, is_driving_forward_);
+    traj_points, traj_footprint_with_lat_margin, obstacle, is_driving_forward_);
   return collision_point;
 }
 
@@ -1111,17 +1113,23 @@ std::optional<SlowDownObstacle> ObstacleCruisePlannerNode::createSlowDownObstacl
 
   // calculate collision points with trajectory with lateral stop margin
   // NOTE: For additional margin, hysteresis is not divided by two.
-  const auto traj_polys_with_lat_margin = createOneStepPolygons(
+  const motion_utils::TrajectoryFootprint traj_footprint_with_lat_margin(createOneStepPolygons(
     traj_points, vehicle_info_, ego_odom_ptr_->pose.pose,
-    p.max_lat_margin_for_slow_down + p.lat_hysteresis_margin_for_slow_down);
+    p.max_lat_margin_for_slow_down + p.lat_hysteresis_margin_for_slow_down));
 
   std::vector<Polygon2d> front_collision_polygons;
   size_t front_seg_idx = 0;
   std::vector<Polygon2d> back_collision_polygons;
   size_t back_seg_idx = 0;
-  for (size_t i = 0; i < traj_polys_with_lat_margin.size(); ++i) {
+  size_t back_collision_idx = 0;
+  // NOTE: the footprints which are not the candidates have no collision.
+  for (const size_t i : traj_footprint_with_lat_margin.getCandidateIndices(obstacle_poly)) {
+    if (!back_collision_polygons.empty() && back_collision_idx + 1 != i) {
+      break;  // for efficient calculation
+    }
+
     std::vector<Polygon2d> collision_polygons;
-    bg::intersection(traj_polys_with_lat_margin.at(i), obstacle_poly, collision_polygons);
+    bg::intersection(traj_footprint_with_lat_margin.at(i), obstacle_poly, collision_polygons);
 
     if (!collision_polygons.empty()) {
       if (front_collision_polygons.empty()) {
@@ -1130,6 +1138,7 @@ std::optional<SlowDownObstacle> ObstacleCruisePlannerNode::createSlowDownObstacl
       }
       back_collision_polygons = collision_polygons;
       back_seg_idx = i == 0 ? i : i - 1;
+      back_collision_idx = i;
     } else {
       if (!back_collision_polygons.empty()) {
         break;  // for efficient calculation
@@ -244,7 +244,9 @@ VelocityOptimizer::OptimizationResult VelocityOptimizer::optimize(const Optimiza
   }
 
   // execute optimization
-  const auto result = qp_solver_.optimize(P, A, q, lower_bound, upper_bound);
+  // NOTE: the workspace is kept and warm started when the sparsity pattern is unchanged
+  qp_solver_.updateProblem(P, A, q, lower_bound, upper_bound);
+  const auto result = qp_solver_.optimize();
   const std::vector<double> optval = std::get<0>(result);
 
   const int status_val = std::get<3>(result);
@@ -58,12 +58,15 @@ PointWithStamp calcNearestCollisionPoint(
 // NOTE: max_lat_dist is used for efficient calculation to suppress boost::geometry's polygon
 // calculation.
 std::optional<std::pair<size_t, std::vector<PointWithStamp>>> getCollisionIndex(
-  const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polygons,
+  const std::vector<TrajectoryPoint> & traj_points,
+  const motion_utils::TrajectoryFootprint & traj_footprint,
   const geometry_msgs::msg::Pose & object_pose, const rclcpp::Time & object_time,
   const Shape & object_shape, const double max_lat_dist = std::numeric_limits<double>::max())
 {
   const auto obj_polygon = tier4_autoware_utils::toPolygon2d(object_pose, object_shape);
-  for (size_t i = 0; i < traj_polygons.size(); ++i) {
+  // NOTE: the footprints whose bounding boxes are apart from the object are skipped since they
+  // never have the collision.
+  for (const size_t i : traj_footprint.getCandidateIndices(obj_polygon)) {
     const double approximated_dist =
       tier4_autoware_utils::calcDistance2d(traj_points.at(i).pose, object_pose);
     if (approximated_dist > max_lat_dist) {
@@ -71,7 +74,7 @@ std::optional<std::pair<size_t, std::vector<PointWithStamp>>> getCollisionIndex(
     }
 
     std::vector<Polygon2d> collision_polygons;
-    boost::geometry::intersection(traj_polygons.at(i), obj_polygon, collision_polygons);
+    boost::geometry::intersection(traj_footprint.at(i), obj_polygon, collision_polygons);
 
     std::vector<PointWithStamp> collision_geom_points;
     bool has_collision = false;
@@ -135,11 +138,12 @@ Polygon2d createOneStepPolygon(
 }
 
 std::optional<geometry_msgs::msg::Point> getCollisionPoint(
-  const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polygons,
-  const Obstacle & obstacle, const bool is_driving_forward)
+  const std::vector<TrajectoryPoint> & traj_points,
+  const motion_utils::TrajectoryFootprint & traj_footprint, const Obstacle & obstacle,
+  const bool is_driving_forward)
 {
   const auto collision_info =
-    getCollisionIndex(traj_points, traj_polygons, obstacle.pose, obstacle.stamp, obstacle.shape);
+    getCollisionIndex(traj_points, traj_footprint, obstacle.pose, obstacle.stamp, obstacle.shape);
   if (collision_info) {
     const auto nearest_collision_point = calcNearestCollisionPoint(
       collision_info->first, collision_info->second, traj_points, is_driving_forward);
@@ -152,10 +156,10 @@ std::optional<geometry_msgs::msg::Point> getCollisionPoint(
 // NOTE: max_lat_dist is used for efficient calculation to suppress boost::geometry's polygon
 // calculation.
 std::vector<PointWithStamp> getCollisionPoints(
-  const std::vector<TrajectoryPoint> & traj_points, const std::vector<Polygon2d> & traj_polygons,
-  const rclcpp::Time & obstacle_stamp, const PredictedPath & predicted_path, const Shape & shape,
-  const rclcpp::Time & current_time, const bool is_driving_forward,
-  std::vector<size_t> & collision_index, const double max_lat_dist,
+  const std::vector<TrajectoryPoint> & traj_points,
+  const motion_utils::TrajectoryFootprint & traj_footprint, const rclcpp::Time & obstacle_stamp,
+  const PredictedPath & predicted_path, const Shape & shape, const rclcpp::Time & current_time,
+  const bool is_driving_forward, std::vector<size_t> & collision_index, const double max_lat_dist,
   const double max_prediction_time_for_collision_check)
 {
   std::vector<PointWithStamp> collision_points;
@@ -174,7 +178,7 @@ std::vector<PointWithStamp> getCollisionPoints(
     }
 
     const auto collision_info = getCollisionIndex(
-      traj_points, traj_polygons, predicted_path.path.at(i), object_time, shape, max_lat_dist);
+      traj_points, traj_footprint, predicted_path.path.at(i), object_time, shape, max_lat_dist);
     if (collision_info) {
       const auto nearest_collision_point = calcNearestCollisionPoint(
         collision_info->first, collision_info->second, traj_points, is_driving_forward);
@@ -66,6 +66,9 @@ struct NodeParam
   // buffer for z axis filtering [m]
   double z_axis_filtering_buffer;
 
+  // set True, search the obstacle pointcloud with a 2D grid of the points
+  bool enable_pointcloud_grid_search;
+
   // max velocity [m/s]
   double max_velocity;
 
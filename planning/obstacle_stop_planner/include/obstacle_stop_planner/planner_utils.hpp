@@ -31,8 +31,10 @@
 #include <boost/optional.hpp>
 #include <boost/variant.hpp>
 
+#include <cstdint>
 #include <map>
 #include <string>
+#include <unordered_map>
 #include <utility>
 #include <vector>
 
@@ -89,6 +91,37 @@ bool withinPolyhedron(
   const Point2d & next_point, PointCloud::Ptr candidate_points_ptr,
   PointCloud::Ptr within_points_ptr, double z_min, double z_max);
 
+/**
+ * @brief 2D grid of the pointcloud indices, which is used to find the points around positions
+ * without visiting all the points.
+ */
+class PointCloudGrid
+{
+public:
+  PointCloudGrid(const PointCloud::ConstPtr & points, const double cell_size);
+
+  /**
+   * @brief get the indices of the points in the cells which overlap the circles of the radius
+   * around the centers. The returned indices are sorted in ascending order, so a superset of the
+   * points within the radius is given in the original order.
+   */
+  std::vector<size_t> getIndicesAround(
+    const std::vector<Point2d> & centers, const double radius) const;
+
+  /**
+   * @brief get the points of getIndicesAround()
+   */
+  PointCloud::Ptr getPointsAround(const std::vector<Point2d> & centers, const double radius) const;
+
+private:
+  int64_t toCellIndex(const double v) const;
+  static int64_t toCellKey(const int64_t ix, const int64_t iy);
+
+  PointCloud::ConstPtr points_;
+  double cell_size_;
+  std::unordered_map<int64_t, std::vector<size_t>> cells_;
+};
+
 void appendPointToPolygon(Polygon2d & polygon, const geometry_msgs::msg::Point & geom_point);
 
 void createOneStepPolygon(
@@ -67,6 +67,7 @@ ObstacleStopPlannerNode::ObstacleStopPlannerNode(const rclcpp::NodeOptions & nod
     p.enable_z_axis_obstacle_filtering =
       declare_parameter<bool>("enable_z_axis_obstacle_filtering");
     p.z_axis_filtering_buffer = declare_parameter<double>("z_axis_filtering_buffer");
+    p.enable_pointcloud_grid_search = declare_parameter<bool>("enable_pointcloud_grid_search");
     p.max_velocity = declare_parameter<double>("max_velocity");
     p.chattering_threshold = declare_parameter<double>("chattering_threshold");
     p.ego_nearest_dist_threshold = declare_parameter<double>("ego_nearest_dist_threshold");
@@ -220,10 +221,14 @@ ObstacleStopPlannerNode::ObstacleStopPlannerNode(const rclcpp::NodeOptions & nod
       createSubscriptionOptions(this));
   }
 
+  // NOTE: the trajectory is received from the previous planner in the same container with
+  // intra-process communication, which does not serialize nor copy the message
+  auto sub_trajectory_options = createSubscriptionOptions(this);
+  sub_trajectory_options.use_intra_process_comm = rclcpp::IntraProcessSetting::Enable;
   sub_trajectory_ = this->create_subscription<Trajectory>(
     "~/input/trajectory", 1,
     std::bind(&ObstacleStopPlannerNode::onTrigger, this, std::placeholders::_1),
-    createSubscriptionOptions(this));
+    sub_trajectory_options);
 
   sub_odometry_ = this->create_subscription<Odometry>(
     "~/input/odometry", 1,
@@ -401,6 +406,17 @@ void ObstacleStopPlannerNode::searchObstacle(
     return;
   }
 
+  // grid of the candidate points to check only the points around each step
+  boost::optional<PointCloudGrid> candidate_grid;
+  if (node_param_.enable_pointcloud_grid_search) {
+    candidate_grid.emplace(obstacle_candidate_pointcloud_ptr, stop_param.stop_search_radius);
+  }
+  const auto get_candidate_points = [&](const auto & prev_point, const auto & next_point,
+                                        const double radius) {
+    return candidate_grid ? candidate_grid->getPointsAround({prev_point, next_point}, radius)
+                          : obstacle_candidate_pointcloud_ptr;
+  };
+
   const auto now = this->now();
 
   updateObstacleHistory(now);
@@ -426,15 +442,17 @@ void ObstacleStopPlannerNode::searchObstacle(
       debug_ptr_->pushPolygon(
         one_step_move_slow_down_range_polygon, p_front.position.z, PolygonType::SlowDownRange);
 
+      const auto slow_down_candidate_pointcloud_ptr = get_candidate_points(
+        prev_center_point, next_center_point, slow_down_param_.slow_down_search_radius);
       if (node_param_.enable_z_axis_obstacle_filtering) {
         planner_data.found_slow_down_points = withinPolyhedron(
           one_step_move_slow_down_range_polygon, slow_down_param_.slow_down_search_radius,
-          prev_center_point, next_center_point, obstacle_candidate_pointcloud_ptr,
+          prev_center_point, next_center_point, slow_down_candidate_pointcloud_ptr,
           slow_down_pointcloud_ptr, z_axis_min, z_axis_max);
       } else {
         planner_data.found_slow_down_points = withinPolygon(
           one_step_move_slow_down_range_polygon, slow_down_param_.slow_down_search_radius,
-          prev_center_point, next_center_point, obstacle_candidate_pointcloud_ptr,
+          prev_center_point, next_center_point, slow_down_candidate_pointcloud_ptr,
           slow_down_pointcloud_ptr);
       }
       const auto found_first_slow_down_points =
@@ -457,7 +475,8 @@ void ObstacleStopPlannerNode::searchObstacle(
       }
 
     } else {
-      slow_down_pointcloud_ptr = obstacle_candidate_pointcloud_ptr;
+      slow_down_pointcloud_ptr =
+        get_candidate_points(prev_center_point, next_center_point, stop_param.stop_search_radius);
     }
 
     {
@@ -1485,16 +1504,46 @@ bool ObstacleStopPlannerNode::searchPointcloudNearTrajectory(
   for (const auto & trajectory_point : trajectory) {
     center_points.push_back(getVehicleCenterFromBase(trajectory_point.pose, vehicle_info).position);
   }
-  for (const auto & point : transformed_points_ptr->points) {
+  const auto is_near_trajectory = [&](const pcl::PointXYZ & point) {
     for (const auto & center_point : center_points) {
       const double x = center_point.x - point.x;
       const double y = center_point.y - point.y;
       const double squared_distance = x * x + y * y;
       if (squared_distance < squared_radius) {
+        return true;
+      }
+    }
+    return false;
+  };
+
+  if (!node_param_.enable_pointcloud_grid_search) {
+    for (const auto & point : transformed_points_ptr->points) {
+      if (is_near_trajectory(point)) {
         output_points_ptr->points.push_back(point);
-        break;
       }
     }
+    return true;
+  }
+
+  // check only the points in the grid cells around each center point
+  const PointCloudGrid grid(transformed_points_ptr, search_radius);
+  std::vector<size_t> near_indices;
+  for (const auto & center_point : center_points) {
+    for (const auto idx : grid.getIndicesAround(
+           {Point2d(center_point.x, center_point.y)}, search_radius)) {
+      const auto & point = transformed_points_ptr->points.at(idx);
+      const double x = center_point.x - point.x;
+      const double y = center_point.y - point.y;
+      if (x * x + y * y < squared_radius) {
+        near_indices.push_back(idx);
+      }
+    }
+  }
+  // keep the order of the input pointcloud
+  std::sort(near_indices.begin(), near_indices.end());
+  near_indices.erase(std::unique(near_indices.begin(), near_indices.end()), near_indices.end());
+  for (const auto idx : near_indices) {
+    output_points_ptr->points.push_back(transformed_points_ptr->points.at(idx));
   }
   return true;
 }
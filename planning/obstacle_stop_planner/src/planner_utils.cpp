@@ -29,6 +29,10 @@
 
 #include <pcl_conversions/pcl_conversions.h>
 
+#include <algorithm>
+#include <cmath>
+#include <unordered_set>
+
 namespace motion_planning
 {
 
@@ -304,6 +308,66 @@ bool withinPolyhedron(
   return find_within_points;
 }
 
+PointCloudGrid::PointCloudGrid(const PointCloud::ConstPtr & points, const double cell_size)
+: points_(points), cell_size_(cell_size)
+{
+  for (size_t i = 0; i < points_->size(); ++i) {
+    const auto & p = points_->at(i);
+    // the points of NaN are never within any range
+    if (!std::isfinite(p.x) || !std::isfinite(p.y)) {
+      continue;
+    }
+    cells_[toCellKey(toCellIndex(p.x), toCellIndex(p.y))].push_back(i);
+  }
+}
+
+int64_t PointCloudGrid::toCellIndex(const double v) const
+{
+  return static_cast<int64_t>(std::floor(v / cell_size_));
+}
+
+int64_t PointCloudGrid::toCellKey(const int64_t ix, const int64_t iy)
+{
+  return static_cast<int64_t>(
+    (static_cast<uint64_t>(ix) << 32) ^ (static_cast<uint64_t>(iy) & 0xffffffff));
+}
+
+std::vector<size_t> PointCloudGrid::getIndicesAround(
+  const std::vector<Point2d> & centers, const double radius) const
+{
+  std::vector<size_t> indices;
+  std::unordered_set<int64_t> visited_keys;
+  for (const auto & center : centers) {
+    const auto ix_min = toCellIndex(center.x() - radius);
+    const auto ix_max = toCellIndex(center.x() + radius);
+    const auto iy_min = toCellIndex(center.y() - radius);
+    const auto iy_max = toCellIndex(center.y() + radius);
+    for (auto ix = ix_min; ix <= ix_max; ++ix) {
+      for (auto iy = iy_min; iy <= iy_max; ++iy) {
+        const auto key = toCellKey(ix, iy);
+        const auto cell = cells_.find(key);
+        if (cell == cells_.end() || !visited_keys.insert(key).second) {
+          continue;
+        }
+        indices.insert(indices.end(), cell->second.begin(), cell->second.end());
+      }
+    }
+  }
+  std::sort(indices.begin(), indices.end());
+  return indices;
+}
+
+PointCloud::Ptr PointCloudGrid::getPointsAround(
+  const std::vector<Point2d> & centers, const double radius) const
+{
+  PointCloud::Ptr output_points_ptr(new PointCloud);
+  output_points_ptr->header = points_->header;
+  for (const auto idx : getIndicesAround(centers, radius)) {
+    output_points_ptr->push_back(points_->at(idx));
+  }
+  return output_points_ptr;
+}
+
 void appendPointToPolygon(Polygon2d & polygon, const geometry_msgs::msg::Point & geom_point)
 {
   Point2d point;
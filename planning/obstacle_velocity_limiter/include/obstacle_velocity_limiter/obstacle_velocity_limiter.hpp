@@ -113,10 +113,13 @@ std::vector<multi_linestring_t> createProjectedLines(
 /// @param[in] footprints footprint of the forward projection at each trajectory point
 /// @param[in] projection_params projection parameters
 /// @param[in] velocity_params velocity parameters
+/// @param[in] num_threads number of threads calculating the distances to collision of the
+/// trajectory points (0: the number of the cores)
 void limitVelocity(
   Trajectory & trajectory, const CollisionChecker & collision_checker,
   const std::vector<multi_linestring_t> & projections, const std::vector<polygon_t> & footprints,
-  ProjectionParameters & projection_params, const VelocityParameters & velocity_params);
+  ProjectionParameters & projection_params, const VelocityParameters & velocity_params,
+  const size_t num_threads = 1);
 
 /// @brief copy the velocity profile of a downsampled trajectory to the original trajectory
 /// @param[in] downsampled_trajectory downsampled trajectory
@@ -16,6 +16,7 @@
 #define OBSTACLE_VELOCITY_LIMITER__OBSTACLE_VELOCITY_LIMITER_NODE_HPP_
 
 #include "obstacle_velocity_limiter/obstacles.hpp"
+#include "obstacle_velocity_limiter/occupancy_grid_utils.hpp"
 #include "obstacle_velocity_limiter/parameters.hpp"
 #include "obstacle_velocity_limiter/types.hpp"
 #include "tier4_autoware_utils/ros/logger_level_configure.hpp"
@@ -73,6 +74,7 @@ private:
   // cached inputs
   PredictedObjects::ConstSharedPtr dynamic_obstacles_ptr_;
   OccupancyGrid::ConstSharedPtr occupancy_grid_ptr_;
+  ThresholdedGridMapCache thresholded_grid_map_cache_;
   PointCloud::ConstSharedPtr pointcloud_ptr_;
   lanelet::LaneletMapPtr lanelet_map_ptr_{new lanelet::LaneletMap};
   multi_linestring_t static_map_obstacles_;
@@ -84,6 +86,7 @@ private:
   ObstacleParameters obstacle_params_;
   VelocityParameters velocity_params_;
   Float distance_buffer_ = static_cast<Float>(declare_parameter<Float>("distance_buffer"));
+  size_t num_threads_ = static_cast<size_t>(declare_parameter<int>("num_threads"));
   Float vehicle_lateral_offset_;
   Float vehicle_front_offset_;
 
@@ -18,6 +18,7 @@
 #include "obstacle_velocity_limiter/parameters.hpp"
 #include "obstacle_velocity_limiter/types.hpp"
 
+#include <grid_map_core/GridMap.hpp>
 #include <tier4_autoware_utils/ros/transform_listener.hpp>
 
 #include <autoware_auto_perception_msgs/msg/predicted_objects.hpp>
@@ -179,6 +180,24 @@ void addSensorObstacles(
   const ObstacleMasks & masks, tier4_autoware_utils::TransformListener & transform_listener,
   const std::string & target_frame, const ObstacleParameters & obstacle_params);
 
+/// @brief add obstacles obtained from sensors to the given Obstacles object
+/// @details same as the other overload but uses the given thresholded grid map of the occupancy
+/// grid instead of converting and thresholding the occupancy grid
+/// @param[out] obstacles Obstacles object in which to add the sensor obstacles
+/// @param[in] occupancy_grid occupancy grid
+/// @param[in] thresholded_grid_map grid map of the occupancy grid thresholded with the
+/// occupancy_grid_threshold of the obstacle parameters
+/// @param[in] pointcloud pointcloud
+/// @param[in] masks masks used to discard some obstacles
+/// @param[in] transform_listener object used to retrieve the latest transform
+/// @param[in] target_frame frame of the returned obstacles
+/// @param[in] obstacle_params obstacle parameters
+void addSensorObstacles(
+  Obstacles & obstacles, const OccupancyGrid & occupancy_grid,
+  const grid_map::GridMap & thresholded_grid_map, const PointCloud & pointcloud,
+  const ObstacleMasks & masks, tier4_autoware_utils::TransformListener & transform_listener,
+  const std::string & target_frame, const ObstacleParameters & obstacle_params);
+
 /// @brief filter obstacles with the given negative and positive masks
 /// @param[in] obstacles obstacles to filter
 /// @param[in] masks masks used to discard some obstacles
@@ -37,6 +37,25 @@ void threshold(grid_map::GridMap & grid_map, const float threshold);
 
 grid_map::GridMap convertToGridMap(const OccupancyGrid & occupancy_grid);
 
+/// @brief thresholded grid map of the latest occupancy grid
+/// @details the conversion and the thresholding are only done again when a different occupancy grid
+/// message or threshold is given
+class ThresholdedGridMapCache
+{
+public:
+  /// @brief get the thresholded grid map of the given occupancy grid
+  /// @param[in] occupancy_grid input occupancy grid
+  /// @param[in] threshold threshold applied to the grid map
+  /// @return grid map of the occupancy grid after applying the threshold
+  const grid_map::GridMap & get(
+    const OccupancyGrid::ConstSharedPtr & occupancy_grid, const int8_t threshold);
+
+private:
+  OccupancyGrid::ConstSharedPtr occupancy_grid_;
+  int8_t threshold_{};
+  grid_map::GridMap grid_map_;
+};
+
 /// @brief extract obstacles from an occupancy grid
 /// @param[in] occupancy_grid input occupancy grid
 /// @param[in] occupied_threshold threshold to use for identifying obstacles in the occupancy grid
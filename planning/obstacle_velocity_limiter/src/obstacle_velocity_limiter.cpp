@@ -22,6 +22,12 @@
 #include <boost/geometry.hpp>
 #include <boost/geometry/algorithms/correct.hpp>
 
+#include <algorithm>
+#include <exception>
+#include <optional>
+#include <thread>
+#include <vector>
+
 namespace obstacle_velocity_limiter
 {
 
@@ -115,8 +121,48 @@ std::vector<multi_linestring_t> createProjectedLines(
 void limitVelocity(
   Trajectory & trajectory, const CollisionChecker & collision_checker,
   const std::vector<multi_linestring_t> & projections, const std::vector<polygon_t> & footprints,
-  ProjectionParameters & projection_params, const VelocityParameters & velocity_params)
+  ProjectionParameters & projection_params, const VelocityParameters & velocity_params,
+  const size_t num_threads)
 {
+  // the distances to collision of the trajectory points are independent of each other, so they are
+  // calculated first by chunks of points, each chunk on its own thread
+  const auto points_num = trajectory.points.size();
+  const size_t max_threads = num_threads == 0 ? std::thread::hardware_concurrency() : num_threads;
+  const size_t thread_num = std::clamp<size_t>(max_threads, 1, std::max<size_t>(points_num, 1));
+  const size_t chunk_size = (points_num + thread_num - 1) / thread_num;
+
+  std::vector<std::optional<double>> distances_to_collision(points_num);
+  const auto calc_chunk_distances = [&](const size_t begin, ProjectionParameters params) {
+    const size_t end = std::min(begin + chunk_size, points_num);
+    for (size_t i = begin; i < end; ++i) {
+      // First linestring is used to calculate distance
+      if (projections[i].empty()) continue;
+      params.update(trajectory.points[i]);
+      distances_to_collision[i] =
+        distanceToClosestCollision(projections[i][0], footprints[i], collision_checker, params);
+    }
+  };
+
+  std::vector<std::exception_ptr> exceptions(thread_num);
+  std::vector<std::thread> threads;
+  for (size_t t = 1; t < thread_num; ++t) {
+    threads.emplace_back([&, t]() {
+      try {
+        calc_chunk_distances(t * chunk_size, projection_params);
+      } catch (...) {
+        exceptions[t] = std::current_exception();
+      }
+    });
+  }
+  try {
+    calc_chunk_distances(0, projection_params);
+  } catch (...) {
+    exceptions[0] = std::current_exception();
+  }
+  for (auto & thread : threads) thread.join();
+  for (const auto & exception : exceptions)
+    if (exception) std::rethrow_exception(exception);
+
   Float time = 0.0;
   for (size_t i = 0; i < trajectory.points.size(); ++i) {
     auto & trajectory_point = trajectory.points[i];
@@ -126,11 +172,9 @@ void limitVelocity(
         tier4_autoware_utils::calcDistance2d(prev_point, trajectory_point) /
         prev_point.longitudinal_velocity_mps);
     }
-    // First linestring is used to calculate distance
     if (projections[i].empty()) continue;
     projection_params.update(trajectory_point);
-    const auto dist_to_collision = distanceToClosestCollision(
-      projections[i][0], footprints[i], collision_checker, projection_params);
+    const auto & dist_to_collision = distances_to_collision[i];
     if (dist_to_collision) {
       const auto min_feasible_velocity =
         velocity_params.current_ego_velocity - velocity_params.max_deceleration * time;
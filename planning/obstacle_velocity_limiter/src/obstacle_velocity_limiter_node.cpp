@@ -33,6 +33,8 @@
 
 #include <algorithm>
 #include <chrono>
+#include <memory>
+#include <utility>
 
 namespace obstacle_velocity_limiter
 {
@@ -43,8 +45,13 @@ ObstacleVelocityLimiterNode::ObstacleVelocityLimiterNode(const rclcpp::NodeOptio
   obstacle_params_(*this),
   velocity_params_(*this)
 {
+  // NOTE: the trajectories are handed over between the planners in the same container with
+  // intra-process communication, which does not serialize nor copy the messages
+  rclcpp::SubscriptionOptions sub_trajectory_options;
+  sub_trajectory_options.use_intra_process_comm = rclcpp::IntraProcessSetting::Enable;
   sub_trajectory_ = create_subscription<Trajectory>(
-    "~/input/trajectory", 1, [this](const Trajectory::ConstSharedPtr msg) { onTrajectory(msg); });
+    "~/input/trajectory", 1, [this](const Trajectory::ConstSharedPtr msg) { onTrajectory(msg); },
+    sub_trajectory_options);
   sub_occupancy_grid_ = create_subscription<OccupancyGrid>(
     "~/input/occupancy_grid", 1,
     [this](const OccupancyGrid::ConstSharedPtr msg) { occupancy_grid_ptr_ = msg; });
@@ -65,7 +72,10 @@ ObstacleVelocityLimiterNode::ObstacleVelocityLimiterNode(const rclcpp::NodeOptio
         extractStaticObstacles(*lanelet_map_ptr_, obstacle_params_.static_map_tags);
     });
 
-  pub_trajectory_ = create_publisher<Trajectory>("~/output/trajectory", 1);
+  rclcpp::PublisherOptions pub_trajectory_options;
+  pub_trajectory_options.use_intra_process_comm = rclcpp::IntraProcessSetting::Enable;
+  pub_trajectory_ =
+    create_publisher<Trajectory>("~/output/trajectory", 1, pub_trajectory_options);
   pub_debug_markers_ =
     create_publisher<visualization_msgs::msg::MarkerArray>("~/output/debug_markers", 1);
   pub_runtime_ =
@@ -93,6 +103,13 @@ rcl_interfaces::msg::SetParametersResult ObstacleVelocityLimiterNode::onParamete
     if (parameter.get_name() == "distance_buffer") {
       distance_buffer_ = static_cast<Float>(parameter.as_double());
       projection_params_.extra_length = vehicle_front_offset_ + distance_buffer_;
+    } else if (parameter.get_name() == "num_threads") {
+      if (parameter.as_int() >= 0) {
+        num_threads_ = static_cast<size_t>(parameter.as_int());
+      } else {
+        result.successful = false;
+        result.reason = "num_threads must be positive or 0";
+      }
       // Preprocessing parameters
     } else if (parameter.get_name() == PreprocessingParameters::START_DIST_PARAM) {
       preprocessing_params_.start_distance = static_cast<Float>(parameter.as_double());
@@ -207,20 +224,28 @@ void ObstacleVelocityLimiterNode::onTrajectory(const Trajectory::ConstSharedPtr
   if (obstacle_params_.dynamic_source != ObstacleParameters::STATIC_ONLY) {
     if (obstacle_params_.filter_envelope)
       obstacle_masks.positive_mask = createEnvelopePolygon(footprint_polygons);
-    addSensorObstacles(
-      obstacles, *occupancy_grid_ptr_, *pointcloud_ptr_, obstacle_masks, transform_listener_,
-      original_traj.header.frame_id, obstacle_params_);
+    if (obstacle_params_.dynamic_source == ObstacleParameters::OCCUPANCY_GRID)
+      addSensorObstacles(
+        obstacles, *occupancy_grid_ptr_,
+        thresholded_grid_map_cache_.get(
+          occupancy_grid_ptr_, obstacle_params_.occupancy_grid_threshold),
+        *pointcloud_ptr_, obstacle_masks, transform_listener_, original_traj.header.frame_id,
+        obstacle_params_);
+    else
+      addSensorObstacles(
+        obstacles, *occupancy_grid_ptr_, *pointcloud_ptr_, obstacle_masks, transform_listener_,
+        original_traj.header.frame_id, obstacle_params_);
   }
   limitVelocity(
     downsampled_traj,
     CollisionChecker(
       obstacles, obstacle_params_.rtree_min_points, obstacle_params_.rtree_min_segments),
-    projected_linestrings, footprint_polygons, projection_params_, velocity_params_);
+    projected_linestrings, footprint_polygons, projection_params_, velocity_params_, num_threads_);
   auto safe_trajectory = copyDownsampledVelocity(
     downsampled_traj, original_traj, start_idx, preprocessing_params_.downsample_factor);
   safe_trajectory.header.stamp = now();
 
-  pub_trajectory_->publish(safe_trajectory);
+  pub_trajectory_->publish(std::make_unique<Trajectory>(std::move(safe_trajectory)));
 
   const auto t_end = std::chrono::system_clock::now();
   const auto runtime = std::chrono::duration_cast<std::chrono::microseconds>(t_end - t_start);
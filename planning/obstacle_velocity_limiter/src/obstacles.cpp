@@ -80,9 +80,24 @@ void addSensorObstacles(
   const ObstacleMasks & masks, tier4_autoware_utils::TransformListener & transform_listener,
   const std::string & target_frame, const ObstacleParameters & obstacle_params)
 {
+  grid_map::GridMap grid_map;
   if (obstacle_params.dynamic_source == ObstacleParameters::OCCUPANCY_GRID) {
-    auto grid_map = convertToGridMap(occupancy_grid);
+    grid_map = convertToGridMap(occupancy_grid);
     threshold(grid_map, obstacle_params.occupancy_grid_threshold);
+  }
+  addSensorObstacles(
+    obstacles, occupancy_grid, grid_map, pointcloud, masks, transform_listener, target_frame,
+    obstacle_params);
+}
+
+void addSensorObstacles(
+  Obstacles & obstacles, const OccupancyGrid & occupancy_grid,
+  const grid_map::GridMap & thresholded_grid_map, const PointCloud & pointcloud,
+  const ObstacleMasks & masks, tier4_autoware_utils::TransformListener & transform_listener,
+  const std::string & target_frame, const ObstacleParameters & obstacle_params)
+{
+  if (obstacle_params.dynamic_source == ObstacleParameters::OCCUPANCY_GRID) {
+    auto grid_map = thresholded_grid_map;
     maskPolygons(grid_map, masks);
     const auto obstacle_lines = extractObstacles(grid_map, occupancy_grid);
     obstacles.lines.insert(obstacles.lines.end(), obstacle_lines.begin(), obstacle_lines.end());
@@ -24,6 +24,8 @@
 #include <opencv2/imgproc.hpp>
 #include <opencv2/opencv.hpp>
 
+#include <vector>
+
 namespace obstacle_velocity_limiter
 {
 void maskPolygons(grid_map::GridMap & grid_map, const ObstacleMasks & obstacle_masks)
@@ -39,16 +41,18 @@ void maskPolygons(grid_map::GridMap & grid_map, const ObstacleMasks & obstacle_m
   if (!obstacle_masks.positive_mask.outer().empty()) {
     const auto layer_copy = grid_map["layer"];
     layer.setConstant(0.0);
-    grid_map::Position position;
-    for (grid_map_utils::PolygonIterator iterator(grid_map, convert(obstacle_masks.positive_mask));
-         !iterator.isPastEnd(); ++iterator)
-      layer((*iterator)(0), (*iterator)(1)) = layer_copy((*iterator)(0), (*iterator)(1));
+    for (const auto & span : grid_map_utils::PolygonIterator::calculateSpans(
+           grid_map, convert(obstacle_masks.positive_mask))) {
+      const auto size = span.col_end - span.col_begin;
+      layer.row(span.row).segment(span.col_begin, size) =
+        layer_copy.row(span.row).segment(span.col_begin, size);
+    }
   }
 
+  std::vector<grid_map::Polygon> negative_polygons;
   for (const auto & negative_mask : obstacle_masks.negative_masks)
-    for (grid_map_utils::PolygonIterator iterator(grid_map, convert(negative_mask));
-         !iterator.isPastEnd(); ++iterator)
-      layer((*iterator)(0), (*iterator)(1)) = 0.0;
+    negative_polygons.push_back(convert(negative_mask));
+  grid_map_utils::fillPolygons(grid_map, "layer", negative_polygons, 0.0);
 }
 
 void threshold(grid_map::GridMap & grid_map, const float threshold)
@@ -69,6 +73,18 @@ grid_map::GridMap convertToGridMap(const OccupancyGrid & occupancy_grid)
   return grid_map;
 }
 
+const grid_map::GridMap & ThresholdedGridMapCache::get(
+  const OccupancyGrid::ConstSharedPtr & occupancy_grid, const int8_t threshold)
+{
+  if (occupancy_grid != occupancy_grid_ || threshold != threshold_) {
+    grid_map_ = convertToGridMap(*occupancy_grid);
+    obstacle_velocity_limiter::threshold(grid_map_, threshold);
+    occupancy_grid_ = occupancy_grid;
+    threshold_ = threshold;
+  }
+  return grid_map_;
+}
+
 multi_linestring_t extractObstacles(
   const grid_map::GridMap & grid_map, const OccupancyGrid & occupancy_grid)
 {
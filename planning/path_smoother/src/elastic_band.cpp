@@ -20,53 +20,35 @@
 #include "path_smoother/utils/trajectory_utils.hpp"
 #include "tf2/utils.h"
 
+#include <Eigen/Sparse>
+
 #include <algorithm>
 #include <chrono>
 #include <limits>
 
 namespace
 {
-Eigen::MatrixXd makePMatrix(const int num_points)
+// coefficient (r, c) of the smoothing cost matrix of one coordinate, which is pentadiagonal
+double calcSmoothCostCoef(const int num_points, const int r, const int c)
 {
-  // create P block matrix
-  Eigen::MatrixXd P_quarter = Eigen::MatrixXd::Zero(num_points, num_points);
-  for (int r = 0; r < num_points; ++r) {
-    for (int c = 0; c < num_points; ++c) {
-      if (r == c) {
-        if (r == 0 || r == num_points - 1) {
-          P_quarter(r, c) = 1.0;
-        } else if (r == 1 || r == num_points - 2) {
-          P_quarter(r, c) = 5.0;
-        } else {
-          P_quarter(r, c) = 6.0;
-        }
-      } else if (std::abs(c - r) == 1) {
-        if (r == 0 || r == num_points - 1) {
-          P_quarter(r, c) = -2.0;
-        } else if (c == 0 || c == num_points - 1) {
-          P_quarter(r, c) = -2.0;
-        } else {
-          P_quarter(r, c) = -4.0;
-        }
-      } else if (std::abs(c - r) == 2) {
-        P_quarter(r, c) = 1.0;
-      } else {
-        P_quarter(r, c) = 0.0;
-      }
+  if (r == c) {
+    if (r == 0 || r == num_points - 1) {
+      return 1.0;
+    } else if (r == 1 || r == num_points - 2) {
+      return 5.0;
     }
+    return 6.0;
+  } else if (std::abs(c - r) == 1) {
+    if (r == 0 || r == num_points - 1) {
+      return -2.0;
+    } else if (c == 0 || c == num_points - 1) {
+      return -2.0;
+    }
+    return -4.0;
+  } else if (std::abs(c - r) == 2) {
+    return 1.0;
   }
-
-  // create P matrix
-  Eigen::MatrixXd P = Eigen::MatrixXd::Zero(num_points * 2, num_points * 2);
-  P.block(0, 0, num_points, num_points) = P_quarter;
-  P.block(num_points, num_points, num_points, num_points) = P_quarter;
-
-  return P;
-}
-
-std::vector<double> toStdVector(const Eigen::VectorXd & eigen_vec)
-{
-  return {eigen_vec.data(), eigen_vec.data() + eigen_vec.rows()};
+  return 0.0;
 }
 
 std_msgs::msg::Header createHeader(const rclcpp::Time & now)
@@ -311,7 +293,6 @@ void EBPathSmoother::updateConstraint(
 
   std::vector<TrajectoryPoint> debug_fixed_traj_points;  // for debug
 
-  const Eigen::MatrixXd A = Eigen::MatrixXd::Identity(p.num_points, p.num_points);
   std::vector<double> upper_bound(p.num_points, 0.0);
   std::vector<double> lower_bound(p.num_points, 0.0);
   for (size_t i = 0; i < static_cast<size_t>(p.num_points); ++i) {
@@ -343,37 +324,51 @@ void EBPathSmoother::updateConstraint(
     }
   }
 
-  Eigen::VectorXd x_mat(2 * p.num_points);
-  Eigen::MatrixXd theta_mat = Eigen::MatrixXd::Zero(p.num_points, 2 * p.num_points);
+  // The smoothing cost is theta * blockdiag(Q, Q) * theta^T with the pentadiagonal Q, where theta
+  // maps the lateral offset of each point to x and y. Since theta has only two entries per row,
+  // P and q are calculated directly on the band of Q instead of multiplying dense matrices.
+  // All the band entries are stored regardless of their values so that the sparsity pattern is
+  // fixed and the solver workspace can be updated by values.
+  std::vector<double> sin_yaw(p.num_points);
+  std::vector<double> cos_yaw(p.num_points);
   for (size_t i = 0; i < static_cast<size_t>(p.num_points); ++i) {
-    x_mat(i) = traj_points.at(i).pose.position.x;
-    x_mat(i + p.num_points) = traj_points.at(i).pose.position.y;
-
     const double yaw = tf2::getYaw(traj_points.at(i).pose.orientation);
-    theta_mat(i, i) = -std::sin(yaw);
-    theta_mat(i, i + p.num_points) = std::cos(yaw);
+    sin_yaw.at(i) = -std::sin(yaw);
+    cos_yaw.at(i) = std::cos(yaw);
   }
 
-  // calculate P
-  const Eigen::MatrixXd raw_P_for_smooth = p.smooth_weight * makePMatrix(p.num_points);
-  const Eigen::MatrixXd P_for_smooth = theta_mat * raw_P_for_smooth * theta_mat.transpose();
-  const Eigen::MatrixXd P_for_lat_error =
-    p.lat_error_weight * Eigen::MatrixXd::Identity(p.num_points, p.num_points);
-  const Eigen::MatrixXd P = P_for_smooth + P_for_lat_error;
+  std::vector<Eigen::Triplet<double>> P_triplets;
+  P_triplets.reserve(5 * p.num_points);
+  std::vector<double> q(p.num_points, 0.0);
+  for (int r = 0; r < p.num_points; ++r) {
+    for (int c = std::max(0, r - 2); c <= std::min(p.num_points - 1, r + 2); ++c) {
+      const double coef = p.smooth_weight * calcSmoothCostCoef(p.num_points, r, c);
+      const double sin_coef = sin_yaw.at(r) * coef;
+      const double cos_coef = cos_yaw.at(r) * coef;
+
+      const double lat_error_coef = r == c ? p.lat_error_weight : 0.0;
+      P_triplets.emplace_back(
+        r, c, sin_coef * sin_yaw.at(c) + cos_coef * cos_yaw.at(c) + lat_error_coef);
+
+      const auto & position = traj_points.at(c).pose.position;
+      q.at(r) += sin_coef * position.x + cos_coef * position.y;
+    }
+  }
+  Eigen::SparseMatrix<double> P(p.num_points, p.num_points);
+  P.setFromTriplets(P_triplets.begin(), P_triplets.end());
 
-  // calculate q
-  const Eigen::VectorXd raw_q_for_smooth = theta_mat * raw_P_for_smooth * x_mat;
-  const auto q = toStdVector(raw_q_for_smooth);
+  Eigen::SparseMatrix<double> A(p.num_points, p.num_points);
+  A.setIdentity();
 
   if (p.enable_warm_start && osqp_solver_ptr_) {
-    osqp_solver_ptr_->updateP(P);
-    osqp_solver_ptr_->updateQ(q);
-    osqp_solver_ptr_->updateA(A);
-    osqp_solver_ptr_->updateBounds(lower_bound, upper_bound);
+    // the workspace is kept and the previous solution is used as the initial one when the size
+    // of the problem is same as before
+    osqp_solver_ptr_->updateProblem(P, A, q, lower_bound, upper_bound);
     osqp_solver_ptr_->updateEpsRel(p.qp_param.eps_rel);
   } else {
     osqp_solver_ptr_ = std::make_unique<autoware::common::osqp::OSQPInterface>(
-      P, A, q, lower_bound, upper_bound, p.qp_param.eps_abs);
+      autoware::common::osqp::calCSCMatrixTrapezoidal(P),
+      autoware::common::osqp::calCSCMatrix(A), q, lower_bound, upper_bound, p.qp_param.eps_abs);
     osqp_solver_ptr_->updateEpsRel(p.qp_param.eps_rel);
     osqp_solver_ptr_->updateEpsAbs(p.qp_param.eps_abs);
     osqp_solver_ptr_->updateMaxIter(p.qp_param.max_iteration);
@@ -21,6 +21,8 @@
 
 #include <chrono>
 #include <limits>
+#include <memory>
+#include <utility>
 
 namespace path_smoother
 {
@@ -73,7 +75,11 @@ ElasticBandSmoother::ElasticBandSmoother(const rclcpp::NodeOptions & node_option
 {
   // interface publisher
   traj_pub_ = create_publisher<Trajectory>("~/output/traj", 1);
-  path_pub_ = create_publisher<Path>("~/output/path", 1);
+  // NOTE: the path is handed over to the next planner in the same container with intra-process
+  // communication, which does not serialize nor copy the message
+  rclcpp::PublisherOptions path_pub_options;
+  path_pub_options.use_intra_process_comm = rclcpp::IntraProcessSetting::Enable;
+  path_pub_ = create_publisher<Path>("~/output/path", 1, path_pub_options);
 
   // interface subscriber
   path_sub_ = create_subscription<Path>(
@@ -222,8 +228,8 @@ void ElasticBandSmoother::onPath(const Path::ConstSharedPtr path_ptr)
   const auto output_traj_msg =
     trajectory_utils::createTrajectory(path_ptr->header, full_traj_points);
   traj_pub_->publish(output_traj_msg);
-  const auto output_path_msg = trajectory_utils::create_path(*path_ptr, full_traj_points);
-  path_pub_->publish(output_path_msg);
+  auto output_path_msg = trajectory_utils::create_path(*path_ptr, full_traj_points);
+  path_pub_->publish(std::make_unique<Path>(std::move(output_path_msg)));
 }
 
 bool ElasticBandSmoother::isDataReady(const Path & path, rclcpp::Clock clock) const
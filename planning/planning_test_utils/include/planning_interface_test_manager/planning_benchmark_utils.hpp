@@ -0,0 +1,116 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef PLANNING_INTERFACE_TEST_MANAGER__PLANNING_BENCHMARK_UTILS_HPP_
+#define PLANNING_INTERFACE_TEST_MANAGER__PLANNING_BENCHMARK_UTILS_HPP_
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace planning_test_utils
+{
+/**
+ * @brief per-call latencies of a benchmark
+ * @details The percentiles are computed from all the samples, and the histogram groups them into
+ * power-of-two buckets in microseconds so that a long tail is visible in a few lines.
+ */
+class LatencyHistogram
+{
+public:
+  void add(const double duration_us) { durations_us_.push_back(duration_us); }
+  void reserve(const size_t size) { durations_us_.reserve(size); }
+  size_t size() const { return durations_us_.size(); }
+
+  // p in [0, 1], e.g. 0.5 for the median
+  double percentile(const double p) const
+  {
+    if (durations_us_.empty()) {
+      return 0.0;
+    }
+    auto sorted = durations_us_;
+    const auto rank = static_cast<size_t>(std::max(0.0, p) * static_cast<double>(sorted.size()));
+    const auto index = std::min(sorted.size() - 1, rank);
+    std::nth_element(sorted.begin(), sorted.begin() + index, sorted.end());
+    return sorted.at(index);
+  }
+
+  double mean() const
+  {
+    if (durations_us_.empty()) {
+      return 0.0;
+    }
+    double sum = 0.0;
+    for (const auto d : durations_us_) sum += d;
+    return sum / static_cast<double>(durations_us_.size());
+  }
+
+  // one line per non-empty bucket: "[lower, upper) us | count | bar"
+  void print(FILE * stream = stdout, const size_t max_bar_width = 50) const
+  {
+    std::vector<size_t> counts;
+    for (const auto d : durations_us_) {
+      const auto bucket = d < 1.0 ? 0 : static_cast<size_t>(std::log2(d)) + 1;
+      if (counts.size() <= bucket) {
+        counts.resize(bucket + 1, 0);
+      }
+      ++counts.at(bucket);
+    }
+    const size_t max_count = counts.empty() ? 0 : *std::max_element(counts.begin(), counts.end());
+    for (size_t bucket = 0; bucket < counts.size(); ++bucket) {
+      if (counts.at(bucket) == 0) {
+        continue;
+      }
+      const double lower = bucket == 0 ? 0.0 : std::ldexp(1.0, static_cast<int>(bucket) - 1);
+      const double upper = std::ldexp(1.0, static_cast<int>(bucket));
+      const auto bar_width = counts.at(bucket) * max_bar_width / max_count;
+      std::fprintf(
+        stream, "  [%8.0f, %8.0f) us | %6zu | %s\n", lower, upper, counts.at(bucket),
+        std::string(std::max<size_t>(bar_width, 1), '#').c_str());
+    }
+  }
+
+private:
+  std::vector<double> durations_us_;
+};
+
+/**
+ * @brief measure the latency of each call of run(i) for i in [0, iterations)
+ * @details run() is called warmup_iterations times beforehand so that the first allocations and the
+ * solver setup are not recorded.
+ */
+template <class Function>
+LatencyHistogram measureLatency(
+  Function && run, const int iterations, const int warmup_iterations = 5)
+{
+  for (int i = 0; i < warmup_iterations; ++i) {
+    run(i);
+  }
+
+  LatencyHistogram histogram;
+  histogram.reserve(std::max(iterations, 0));
+  for (int i = 0; i < iterations; ++i) {
+    const auto start = std::chrono::steady_clock::now();
+    run(i);
+    const auto end = std::chrono::steady_clock::now();
+    histogram.add(std::chrono::duration<double, std::micro>(end - start).count());
+  }
+  return histogram;
+}
+}  // namespace planning_test_utils
+
+#endif  // PLANNING_INTERFACE_TEST_MANAGER__PLANNING_BENCHMARK_UTILS_HPP_
@@ -17,7 +17,9 @@
 
 #include "planning_validator/debug_marker.hpp"
 #include "planning_validator/msg/planning_validator_status.hpp"
+#include "tier4_autoware_utils/ros/latency_tracer.hpp"
 #include "tier4_autoware_utils/ros/logger_level_configure.hpp"
+#include "tier4_autoware_utils/ros/processing_time_publisher.hpp"
 #include "tier4_autoware_utils/system/stop_watch.hpp"
 #include "vehicle_info_util/vehicle_info_util.hpp"
 
@@ -31,6 +33,7 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
 namespace planning_validator
 {
@@ -40,6 +43,8 @@ using diagnostic_updater::DiagnosticStatusWrapper;
 using diagnostic_updater::Updater;
 using nav_msgs::msg::Odometry;
 using planning_validator::msg::PlanningValidatorStatus;
+using tier4_autoware_utils::LatencyTracer;
+using tier4_autoware_utils::ProcessingTimePublisher;
 using tier4_autoware_utils::StopWatch;
 using tier4_debug_msgs::msg::Float64Stamped;
 
@@ -76,6 +81,15 @@ public:
   bool checkValidVelocityDeviation(const Trajectory & trajectory);
   bool checkValidDistanceDeviation(const Trajectory & trajectory);
 
+  // the overloads taking the curvatures of the trajectory (as given by calcCurvature) share them
+  // between the checks instead of recalculating them for each one
+  bool checkValidCurvature(const Trajectory & trajectory, const std::vector<double> & curvatures);
+  bool checkValidLateralAcceleration(
+    const Trajectory & trajectory, const std::vector<double> & curvatures);
+  bool checkValidSteering(const Trajectory & trajectory, const std::vector<double> & curvatures);
+  bool checkValidSteeringRate(
+    const Trajectory & trajectory, const std::vector<double> & curvatures);
+
 private:
   void setupDiag();
 
@@ -128,6 +142,10 @@ private:
   std::unique_ptr<tier4_autoware_utils::LoggerLevelConfigure> logger_configure_;
 
   StopWatch<std::chrono::milliseconds> stop_watch_;
+
+  // latency of the trajectory since its header stamp, i.e. through the planning pipeline
+  LatencyTracer latency_tracer_;
+  std::unique_ptr<ProcessingTimePublisher> latency_publisher_;
 };
 }  // namespace planning_validator
 
@@ -43,12 +43,24 @@ void calcCurvature(
 void calcSteeringAngles(
   const Trajectory & trajectory, const double wheelbase, std::vector<double> & steering_array);
 
+void calcSteeringAngles(
+  const std::vector<double> & curvatures, const double wheelbase,
+  std::vector<double> & steering_array);
+
 std::pair<double, size_t> calcMaxCurvature(const Trajectory & trajectory);
 
+// the overloads taking the curvatures of the trajectory (as given by calcCurvature) share them
+// between the metrics instead of recalculating them for each one
+std::pair<double, size_t> calcMaxCurvature(
+  const Trajectory & trajectory, const std::vector<double> & curvatures);
+
 std::pair<double, size_t> calcMaxIntervalDistance(const Trajectory & trajectory);
 
 std::pair<double, size_t> calcMaxLateralAcceleration(const Trajectory & trajectory);
 
+std::pair<double, size_t> calcMaxLateralAcceleration(
+  const Trajectory & trajectory, const std::vector<double> & curvatures);
+
 std::pair<double, size_t> getMaxLongitudinalAcc(const Trajectory & trajectory);
 
 std::pair<double, size_t> getMinLongitudinalAcc(const Trajectory & trajectory);
@@ -58,9 +70,15 @@ std::pair<double, size_t> calcMaxRelativeAngles(const Trajectory & trajectory);
 std::pair<double, size_t> calcMaxSteeringAngles(
   const Trajectory & trajectory, const double wheelbase);
 
+std::pair<double, size_t> calcMaxSteeringAngles(
+  const Trajectory & trajectory, const double wheelbase, const std::vector<double> & curvatures);
+
 std::pair<double, size_t> calcMaxSteeringRates(
   const Trajectory & trajectory, const double wheelbase);
 
+std::pair<double, size_t> calcMaxSteeringRates(
+  const Trajectory & trajectory, const double wheelbase, const std::vector<double> & curvatures);
+
 bool checkFinite(const TrajectoryPoint & point);
 
 void shiftPose(geometry_msgs::msg::Pose & pose, double longitudinal);
@@ -22,6 +22,7 @@
 #include <memory>
 #include <string>
 #include <utility>
+#include <vector>
 
 namespace planning_validator
 {
@@ -42,6 +43,7 @@ PlanningValidator::PlanningValidator(const rclcpp::NodeOptions & options)
   pub_status_ = create_publisher<PlanningValidatorStatus>("~/output/validation_status", 1);
   pub_markers_ = create_publisher<visualization_msgs::msg::MarkerArray>("~/output/markers", 1);
   pub_processing_time_ms_ = create_publisher<Float64Stamped>("~/debug/processing_time_ms", 1);
+  latency_publisher_ = std::make_unique<ProcessingTimePublisher>(this, "~/debug/latency_ms");
 
   debug_pose_publisher_ = std::make_shared<PlanningValidatorDebugMarkerPublisher>(this);
 
@@ -166,6 +168,7 @@ bool PlanningValidator::isDataReady()
 void PlanningValidator::onTrajectory(const Trajectory::ConstSharedPtr msg)
 {
   stop_watch_.tic(__func__);
+  latency_tracer_.start(msg->header.stamp, now());
 
   current_trajectory_ = msg;
 
@@ -182,9 +185,11 @@ void PlanningValidator::onTrajectory(const Trajectory::ConstSharedPtr msg)
   diag_updater_->force_update();
 
   publishTrajectory();
+  latency_tracer_.stop(now());
 
   // for debug
   publishProcessingTime(stop_watch_.toc(__func__));
+  latency_publisher_->publish(latency_tracer_.getSummary());
   publishDebugInfo();
   displayStatus();
 }
@@ -260,7 +265,11 @@ void PlanningValidator::validate(const Trajectory & trajectory)
 
   s.is_valid_finite_value = checkValidFiniteValue(trajectory);
   s.is_valid_interval = checkValidInterval(trajectory);
-  s.is_valid_lateral_acc = checkValidLateralAcceleration(trajectory);
+
+  // the curvatures are shared by the checks using them
+  std::vector<double> curvatures;
+  calcCurvature(trajectory, curvatures);
+  s.is_valid_lateral_acc = checkValidLateralAcceleration(trajectory, curvatures);
   s.is_valid_longitudinal_max_acc = checkValidMaxLongitudinalAcceleration(trajectory);
   s.is_valid_longitudinal_min_acc = checkValidMinLongitudinalAcceleration(trajectory);
   s.is_valid_velocity_deviation = checkValidVelocityDeviation(trajectory);
@@ -271,10 +280,13 @@ void PlanningValidator::validate(const Trajectory & trajectory)
   constexpr auto min_interval = 1.0;
   const auto resampled = resampleTrajectory(trajectory, min_interval);
 
+  std::vector<double> resampled_curvatures;
+  calcCurvature(resampled, resampled_curvatures);
+
   s.is_valid_relative_angle = checkValidRelativeAngle(resampled);
-  s.is_valid_curvature = checkValidCurvature(resampled);
-  s.is_valid_steering = checkValidSteering(resampled);
-  s.is_valid_steering_rate = checkValidSteeringRate(resampled);
+  s.is_valid_curvature = checkValidCurvature(resampled, resampled_curvatures);
+  s.is_valid_steering = checkValidSteering(resampled, resampled_curvatures);
+  s.is_valid_steering_rate = checkValidSteeringRate(resampled, resampled_curvatures);
 
   s.invalid_count = isAllValid(s) ? 0 : s.invalid_count + 1;
 }
@@ -323,7 +335,15 @@ bool PlanningValidator::checkValidRelativeAngle(const Trajectory & trajectory)
 
 bool PlanningValidator::checkValidCurvature(const Trajectory & trajectory)
 {
-  const auto [max_curvature, i] = calcMaxCurvature(trajectory);
+  std::vector<double> curvatures;
+  calcCurvature(trajectory, curvatures);
+  return checkValidCurvature(trajectory, curvatures);
+}
+
+bool PlanningValidator::checkValidCurvature(
+  const Trajectory & trajectory, const std::vector<double> & curvatures)
+{
+  const auto [max_curvature, i] = calcMaxCurvature(trajectory, curvatures);
   validation_status_.max_curvature = max_curvature;
   if (max_curvature > validation_params_.curvature_threshold) {
     const auto & p = trajectory.points;
@@ -339,7 +359,15 @@ bool PlanningValidator::checkValidCurvature(const Trajectory & trajectory)
 
 bool PlanningValidator::checkValidLateralAcceleration(const Trajectory & trajectory)
 {
-  const auto [max_lateral_acc, i] = calcMaxLateralAcceleration(trajectory);
+  std::vector<double> curvatures;
+  calcCurvature(trajectory, curvatures);
+  return checkValidLateralAcceleration(trajectory, curvatures);
+}
+
+bool PlanningValidator::checkValidLateralAcceleration(
+  const Trajectory & trajectory, const std::vector<double> & curvatures)
+{
+  const auto [max_lateral_acc, i] = calcMaxLateralAcceleration(trajectory, curvatures);
   validation_status_.max_lateral_acc = max_lateral_acc;
   if (max_lateral_acc > validation_params_.lateral_acc_threshold) {
     debug_pose_publisher_->pushPoseMarker(trajectory.points.at(i), "lateral_acceleration");
@@ -374,7 +402,16 @@ bool PlanningValidator::checkValidMaxLongitudinalAcceleration(const Trajectory &
 
 bool PlanningValidator::checkValidSteering(const Trajectory & trajectory)
 {
-  const auto [max_steering, i] = calcMaxSteeringAngles(trajectory, vehicle_info_.wheel_base_m);
+  std::vector<double> curvatures;
+  calcCurvature(trajectory, curvatures);
+  return checkValidSteering(trajectory, curvatures);
+}
+
+bool PlanningValidator::checkValidSteering(
+  const Trajectory & trajectory, const std::vector<double> & curvatures)
+{
+  const auto [max_steering, i] =
+    calcMaxSteeringAngles(trajectory, vehicle_info_.wheel_base_m, curvatures);
   validation_status_.max_steering = max_steering;
 
   if (max_steering > validation_params_.steering_threshold) {
@@ -386,7 +423,16 @@ bool PlanningValidator::checkValidSteering(const Trajectory & trajectory)
 
 bool PlanningValidator::checkValidSteeringRate(const Trajectory & trajectory)
 {
-  const auto [max_steering_rate, i] = calcMaxSteeringRates(trajectory, vehicle_info_.wheel_base_m);
+  std::vector<double> curvatures;
+  calcCurvature(trajectory, curvatures);
+  return checkValidSteeringRate(trajectory, curvatures);
+}
+
+bool PlanningValidator::checkValidSteeringRate(
+  const Trajectory & trajectory, const std::vector<double> & curvatures)
+{
+  const auto [max_steering_rate, i] =
+    calcMaxSteeringRates(trajectory, vehicle_info_.wheel_base_m, curvatures);
   validation_status_.max_steering_rate = max_steering_rate;
 
   if (max_steering_rate > validation_params_.steering_rate_threshold) {
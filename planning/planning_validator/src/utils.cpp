@@ -17,6 +17,8 @@
 #include <motion_utils/trajectory/trajectory.hpp>
 #include <tier4_autoware_utils/geometry/geometry.hpp>
 
+#include <algorithm>
+#include <cmath>
 #include <memory>
 #include <string>
 #include <utility>
@@ -109,29 +111,46 @@ void calcCurvature(
   // initialize with 0 curvature
   curvature_arr = std::vector<double>(trajectory.points.size(), 0.0);
 
+  // the arc length is non-decreasing, so the previous and next points that meet the distance
+  // requirement never move backward as i increases and are searched incrementally.
+  // this does not hold if the arc length is not finite, which is searched from scratch instead.
+  const bool is_arc_length_finite = std::isfinite(arc_length.back());
+  size_t prev_candidate_idx = 0;
+  size_t next_candidate_idx = 1;
+
   size_t first_distant_index = 0;
   size_t last_distant_index = trajectory.points.size() - 1;
   for (size_t i = 1; i < trajectory.points.size() - 1; ++i) {
     // find the previous point
     size_t prev_idx = 0;
-    for (size_t j = i - 1; j > 0; --j) {
-      if (arc_length.at(i) - arc_length.at(j) > curvature_distance) {
-        if (first_distant_index == 0) {
-          first_distant_index = i;  // save first index that meets distance requirement
+    if (is_arc_length_finite) {
+      while (prev_candidate_idx + 1 < i &&
+             arc_length.at(i) - arc_length.at(prev_candidate_idx + 1) > curvature_distance) {
+        ++prev_candidate_idx;
+      }
+      prev_idx = prev_candidate_idx;
+    } else {
+      for (size_t j = i - 1; j > 0; --j) {
+        if (arc_length.at(i) - arc_length.at(j) > curvature_distance) {
+          prev_idx = j;
+          break;
         }
-        prev_idx = j;
-        break;
       }
     }
+    if (prev_idx > 0 && first_distant_index == 0) {
+      first_distant_index = i;  // save first index that meets distance requirement
+    }
 
     // find the next point
     size_t next_idx = trajectory.points.size() - 1;
-    for (size_t j = i + 1; j < trajectory.points.size(); ++j) {
-      if (arc_length.at(j) - arc_length.at(i) > curvature_distance) {
-        last_distant_index = i;  // save last index that meets distance requirement
-        next_idx = j;
-        break;
-      }
+    next_candidate_idx = is_arc_length_finite ? std::max(next_candidate_idx, i + 1) : i + 1;
+    while (next_candidate_idx < trajectory.points.size() &&
+           !(arc_length.at(next_candidate_idx) - arc_length.at(i) > curvature_distance)) {
+      ++next_candidate_idx;
+    }
+    if (next_candidate_idx < trajectory.points.size()) {
+      last_distant_index = i;  // save last index that meets distance requirement
+      next_idx = next_candidate_idx;
     }
 
     const auto p1 = getPoint(trajectory.points.at(prev_idx));
@@ -162,6 +181,16 @@ std::pair<double, size_t> calcMaxCurvature(const Trajectory & trajectory)
   std::vector<double> curvature_arr;
   calcCurvature(trajectory, curvature_arr);
 
+  return calcMaxCurvature(trajectory, curvature_arr);
+}
+
+std::pair<double, size_t> calcMaxCurvature(
+  const Trajectory & trajectory, const std::vector<double> & curvature_arr)
+{
+  if (trajectory.points.size() < 3) {
+    return {0.0, 0};
+  }
+
   const auto max_curvature_it = std::max_element(curvature_arr.begin(), curvature_arr.end());
   const size_t index = std::distance(curvature_arr.begin(), max_curvature_it);
 
@@ -190,6 +219,12 @@ std::pair<double, size_t> calcMaxLateralAcceleration(const Trajectory & trajecto
   std::vector<double> curvatures;
   calcCurvature(trajectory, curvatures);
 
+  return calcMaxLateralAcceleration(trajectory, curvatures);
+}
+
+std::pair<double, size_t> calcMaxLateralAcceleration(
+  const Trajectory & trajectory, const std::vector<double> & curvatures)
+{
   double max_lat_acc = 0.0;
   size_t max_index = 0;
   for (size_t i = 0; i < curvatures.size(); ++i) {
@@ -250,15 +285,23 @@ std::pair<double, size_t> calcMaxRelativeAngles(const Trajectory & trajectory)
 
 void calcSteeringAngles(
   const Trajectory & trajectory, const double wheelbase, std::vector<double> & steering_array)
+{
+  std::vector<double> curvatures;
+  calcCurvature(trajectory, curvatures);
+
+  calcSteeringAngles(curvatures, wheelbase, steering_array);
+}
+
+void calcSteeringAngles(
+  const std::vector<double> & curvatures, const double wheelbase,
+  std::vector<double> & steering_array)
 {
   const auto curvatureToSteering = [](const auto k, const auto wheelbase) {
     return std::atan(k * wheelbase);
   };
 
-  std::vector<double> curvatures;
-  calcCurvature(trajectory, curvatures);
-
   steering_array.clear();
+  steering_array.reserve(curvatures.size());
   for (const auto k : curvatures) {
     steering_array.push_back(curvatureToSteering(k, wheelbase));
   }
@@ -266,9 +309,19 @@ void calcSteeringAngles(
 
 std::pair<double, size_t> calcMaxSteeringAngles(
   const Trajectory & trajectory, const double wheelbase)
+{
+  std::vector<double> curvatures;
+  calcCurvature(trajectory, curvatures);
+
+  return calcMaxSteeringAngles(trajectory, wheelbase, curvatures);
+}
+
+std::pair<double, size_t> calcMaxSteeringAngles(
+  [[maybe_unused]] const Trajectory & trajectory, const double wheelbase,
+  const std::vector<double> & curvatures)
 {
   std::vector<double> steering_array;
-  calcSteeringAngles(trajectory, wheelbase, steering_array);
+  calcSteeringAngles(curvatures, wheelbase, steering_array);
 
   return getAbsMaxValAndIdx(steering_array);
 }
@@ -280,8 +333,21 @@ std::pair<double, size_t> calcMaxSteeringRates(
     return {0.0, 0};
   }
 
+  std::vector<double> curvatures;
+  calcCurvature(trajectory, curvatures);
+
+  return calcMaxSteeringRates(trajectory, wheelbase, curvatures);
+}
+
+std::pair<double, size_t> calcMaxSteeringRates(
+  const Trajectory & trajectory, const double wheelbase, const std::vector<double> & curvatures)
+{
+  if (trajectory.points.size() < 1) {
+    return {0.0, 0};
+  }
+
   std::vector<double> steering_array;
-  calcSteeringAngles(trajectory, wheelbase, steering_array);
+  calcSteeringAngles(curvatures, wheelbase, steering_array);
 
   double max_steering_rate = 0.0;
   size_t max_index = 0;
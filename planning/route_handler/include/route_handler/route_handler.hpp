@@ -27,10 +27,16 @@
 #include <lanelet2_core/Forward.h>
 #include <lanelet2_core/primitives/Lanelet.h>
 #include <lanelet2_routing/Forward.h>
+#include <lanelet2_routing/LaneletPath.h>
 #include <lanelet2_traffic_rules/TrafficRules.h>
 
 #include <limits>
+#include <map>
 #include <memory>
+#include <mutex>
+#include <tuple>
+#include <unordered_set>
+#include <utility>
 #include <vector>
 
 namespace route_handler
@@ -376,8 +382,48 @@ private:
   Pose original_start_pose_;
   Pose original_goal_pose_;
 
+  // memoized routing graph queries. the cache is replaced (not cleared) whenever the map or the
+  // route changes, so copies of a handler never see the results of each other's routes.
+  struct QueryCache
+  {
+    std::mutex mutex;
+    std::unordered_set<lanelet::Id> route_lanelet_ids;
+    std::unordered_set<lanelet::Id> shoulder_lanelet_ids;
+    std::map<std::tuple<lanelet::Id, double, bool>, lanelet::ConstLanelets> sequence_after;
+    std::map<std::tuple<lanelet::Id, double, bool>, lanelet::ConstLanelets> sequence_up_to;
+    std::map<std::pair<lanelet::Id, double>, lanelet::ConstLanelets> shoulder_sequence_after;
+    std::map<std::pair<lanelet::Id, double>, lanelet::ConstLanelets> shoulder_sequence_up_to;
+    std::map<lanelet::Id, lanelet::ConstLanelets> lane_changeable_neighbors;
+    std::map<std::tuple<lanelet::Id, bool, bool>, boost::optional<lanelet::ConstLanelet>>
+      right_lanelet;
+    std::map<std::tuple<lanelet::Id, bool, bool>, boost::optional<lanelet::ConstLanelet>>
+      left_lanelet;
+    std::map<lanelet::Id, boost::optional<lanelet::ConstLanelet>> following_shoulder_lanelet;
+    std::map<lanelet::Id, boost::optional<lanelet::ConstLanelet>> previous_shoulder_lanelet;
+    std::map<lanelet::Id, boost::optional<lanelet::ConstLanelet>> right_shoulder_lanelet;
+    std::map<lanelet::Id, boost::optional<lanelet::ConstLanelet>> left_shoulder_lanelet;
+  };
+  std::shared_ptr<QueryCache> query_cache_{std::make_shared<QueryCache>()};
+
+  // memoized routes between two lanelets. they only depend on the map, so unlike the query cache
+  // they are kept across routes (e.g. for rerouting) and replaced only when the map changes.
+  struct RoutingCache
+  {
+    struct Route
+    {
+      lanelet::routing::LaneletPath shortest_path;
+      double length2d;
+    };
+    std::mutex mutex;
+    std::map<std::pair<lanelet::Id, lanelet::Id>, boost::optional<Route>> routes;
+    std::map<std::pair<lanelet::Id, lanelet::Id>, boost::optional<lanelet::routing::LaneletPath>>
+      drivable_lane_paths;
+  };
+  std::shared_ptr<RoutingCache> routing_cache_{std::make_shared<RoutingCache>()};
+
   // non-const methods
   void setLaneletsFromRouteMsg();
+  void resetQueryCache();
 
   // const methods
   // for routing
@@ -449,6 +495,18 @@ private:
   bool findDrivableLanePath(
     const lanelet::ConstLanelet & start_lanelet, const lanelet::ConstLanelet & goal_lanelet,
     lanelet::routing::LaneletPath & drivable_lane_path) const;
+  bool findDrivableLanePathImpl(
+    const lanelet::ConstLanelet & start_lanelet, const lanelet::ConstLanelet & goal_lanelet,
+    lanelet::routing::LaneletPath & drivable_lane_path) const;
+  /**
+   * @brief Gets the shortest path and its length of the route between start and goal lanelets.
+   * The result is memoized until the map changes.
+   * @param start_lanelet start lanelet
+   * @param goal_lanelet goal lanelet
+   * @return the shortest path and its length, or none if there is no route.
+   */
+  boost::optional<RoutingCache::Route> getShortestRoute(
+    const lanelet::ConstLanelet & start_lanelet, const lanelet::ConstLanelet & goal_lanelet) const;
 };
 }  // namespace route_handler
 #endif  // ROUTE_HANDLER__ROUTE_HANDLER_HPP_
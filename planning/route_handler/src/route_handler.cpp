@@ -35,7 +35,9 @@
 
 #include <algorithm>
 #include <limits>
+#include <map>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <unordered_set>
 #include <vector>
@@ -121,6 +123,30 @@ PathWithLaneId removeOverlappingPoints(const PathWithLaneId & input_path)
   return filtered_path;
 }
 
+// the cached queries are keyed by lengths that may vary per call, so each table is bounded
+constexpr size_t max_query_cache_size = 4096;
+
+template <typename Key, typename Value, typename Compute>
+Value memoize(std::mutex & mutex, std::map<Key, Value> & cache, const Key & key, Compute compute)
+{
+  {
+    std::lock_guard<std::mutex> lock(mutex);
+    const auto itr = cache.find(key);
+    if (itr != cache.end()) {
+      return itr->second;
+    }
+  }
+
+  // compute without holding the lock, a concurrent miss on the same key only duplicates the work
+  Value value = compute();
+  std::lock_guard<std::mutex> lock(mutex);
+  if (cache.size() >= max_query_cache_size) {
+    cache.clear();
+  }
+  cache.emplace(key, value);
+  return value;
+}
+
 std::string toString(const geometry_msgs::msg::Pose & pose)
 {
   std::stringstream ss;
@@ -163,6 +189,8 @@ void RouteHandler::setMap(const HADMapBin & map_msg)
   is_handler_ready_ = false;
 
   setLaneletsFromRouteMsg();
+  resetQueryCache();
+  routing_cache_ = std::make_shared<RoutingCache>();
 }
 
 bool RouteHandler::isRouteLooped(const RouteSections & route_sections)
@@ -190,6 +218,7 @@ void RouteHandler::setRoute(const LaneletRoute & route_msg)
     route_ptr_ = std::make_shared<LaneletRoute>(route_msg);
     is_handler_ready_ = false;
     setLaneletsFromRouteMsg();
+    resetQueryCache();
   } else {
     RCLCPP_ERROR(
       logger_,
@@ -299,6 +328,7 @@ void RouteHandler::setRouteLanelets(const lanelet::ConstLanelets & path_lanelets
   for (const auto & id : route_lanelets_id) {
     route_lanelets_.push_back(lanelet_map_ptr_->laneletLayer.get(id));
   }
+  resetQueryCache();
   is_handler_ready_ = true;
 }
 
@@ -309,9 +339,23 @@ void RouteHandler::clearRoute()
   start_lanelets_.clear();
   goal_lanelets_.clear();
   route_ptr_ = nullptr;
+  resetQueryCache();
   is_handler_ready_ = false;
 }
 
+void RouteHandler::resetQueryCache()
+{
+  query_cache_ = std::make_shared<QueryCache>();
+  query_cache_->route_lanelet_ids.reserve(route_lanelets_.size());
+  for (const auto & llt : route_lanelets_) {
+    query_cache_->route_lanelet_ids.insert(llt.id());
+  }
+  query_cache_->shoulder_lanelet_ids.reserve(shoulder_lanelets_.size());
+  for (const auto & llt : shoulder_lanelets_) {
+    query_cache_->shoulder_lanelet_ids.insert(llt.id());
+  }
+}
+
 void RouteHandler::setLaneletsFromRouteMsg()
 {
   if (!route_ptr_ || !is_map_msg_ready_) {
@@ -521,105 +565,114 @@ bool RouteHandler::isDeadEndLanelet(const lanelet::ConstLanelet & lanelet) const
 lanelet::ConstLanelets RouteHandler::getLaneChangeableNeighbors(
   const lanelet::ConstLanelet & lanelet) const
 {
-  return lanelet::utils::query::getLaneChangeableNeighbors(routing_graph_ptr_, lanelet);
+  return memoize(
+    query_cache_->mutex, query_cache_->lane_changeable_neighbors, lanelet.id(), [&]() {
+      return lanelet::utils::query::getLaneChangeableNeighbors(routing_graph_ptr_, lanelet);
+    });
 }
 
 lanelet::ConstLanelets RouteHandler::getLaneletSequenceAfter(
   const lanelet::ConstLanelet & lanelet, const double min_length, const bool only_route_lanes) const
 {
-  lanelet::ConstLanelets lanelet_sequence_forward;
-  if (only_route_lanes && !exists(route_lanelets_, lanelet)) {
-    return lanelet_sequence_forward;
+  if (only_route_lanes && !isRouteLanelet(lanelet)) {
+    return {};
   }
 
-  double length = 0;
-  lanelet::ConstLanelet current_lanelet = lanelet;
-  while (rclcpp::ok() && length < min_length) {
-    lanelet::ConstLanelet next_lanelet;
-    if (!getNextLaneletWithinRoute(current_lanelet, &next_lanelet)) {
-      if (only_route_lanes) {
-        break;
+  const auto key = std::make_tuple(lanelet.id(), min_length, only_route_lanes);
+  return memoize(query_cache_->mutex, query_cache_->sequence_after, key, [&]() {
+    lanelet::ConstLanelets lanelet_sequence_forward;
+    double length = 0;
+    lanelet::ConstLanelet current_lanelet = lanelet;
+    while (rclcpp::ok() && length < min_length) {
+      lanelet::ConstLanelet next_lanelet;
+      if (!getNextLaneletWithinRoute(current_lanelet, &next_lanelet)) {
+        if (only_route_lanes) {
+          break;
+        }
+        const auto next_lanes = getNextLanelets(current_lanelet);
+        if (next_lanes.empty()) {
+          break;
+        }
+        next_lanelet = next_lanes.front();
       }
-      const auto next_lanes = getNextLanelets(current_lanelet);
-      if (next_lanes.empty()) {
+      // loop check
+      if (lanelet.id() == next_lanelet.id()) {
         break;
       }
-      next_lanelet = next_lanes.front();
-    }
-    // loop check
-    if (lanelet.id() == next_lanelet.id()) {
-      break;
+      lanelet_sequence_forward.push_back(next_lanelet);
+      current_lanelet = next_lanelet;
+      length +=
+        static_cast<double>(boost::geometry::length(next_lanelet.centerline().basicLineString()));
     }
-    lanelet_sequence_forward.push_back(next_lanelet);
-    current_lanelet = next_lanelet;
-    length +=
-      static_cast<double>(boost::geometry::length(next_lanelet.centerline().basicLineString()));
-  }
 
-  return lanelet_sequence_forward;
+    return lanelet_sequence_forward;
+  });
 }
 
 lanelet::ConstLanelets RouteHandler::getLaneletSequenceUpTo(
   const lanelet::ConstLanelet & lanelet, const double min_length, const bool only_route_lanes) const
 {
-  lanelet::ConstLanelets lanelet_sequence_backward;
-  if (only_route_lanes && !exists(route_lanelets_, lanelet)) {
-    return lanelet_sequence_backward;
+  if (only_route_lanes && !isRouteLanelet(lanelet)) {
+    return {};
   }
 
-  lanelet::ConstLanelet current_lanelet = lanelet;
-  double length = 0;
-  while (rclcpp::ok() && length < min_length) {
-    lanelet::ConstLanelets candidate_lanelets;
-    if (!getPreviousLaneletsWithinRoute(current_lanelet, &candidate_lanelets)) {
-      if (only_route_lanes) {
+  const auto key = std::make_tuple(lanelet.id(), min_length, only_route_lanes);
+  return memoize(query_cache_->mutex, query_cache_->sequence_up_to, key, [&]() {
+    lanelet::ConstLanelets lanelet_sequence_backward;
+    lanelet::ConstLanelet current_lanelet = lanelet;
+    double length = 0;
+    while (rclcpp::ok() && length < min_length) {
+      lanelet::ConstLanelets candidate_lanelets;
+      if (!getPreviousLaneletsWithinRoute(current_lanelet, &candidate_lanelets)) {
+        if (only_route_lanes) {
+          break;
+        }
+        const auto prev_lanes = getPreviousLanelets(current_lanelet);
+        if (prev_lanes.empty()) {
+          break;
+        }
+        candidate_lanelets = prev_lanes;
+      }
+      // loop check
+      if (std::any_of(
+            candidate_lanelets.begin(), candidate_lanelets.end(),
+            [lanelet](auto & prev_llt) { return lanelet.id() == prev_llt.id(); })) {
         break;
       }
-      const auto prev_lanes = getPreviousLanelets(current_lanelet);
-      if (prev_lanes.empty()) {
+
+      // If lanelet_sequence_backward with input lanelet contains all candidate lanelets,
+      // break the loop.
+      if (std::all_of(
+            candidate_lanelets.begin(), candidate_lanelets.end(),
+            [&lanelet_sequence_backward, &lanelet](const auto & prev_llt) {
+              return std::any_of(
+                lanelet_sequence_backward.begin(), lanelet_sequence_backward.end(),
+                [&prev_llt, &lanelet](const auto & llt) {
+                  return (llt.id() == prev_llt.id() || lanelet.id() == prev_llt.id());
+                });
+            })) {
         break;
       }
-      candidate_lanelets = prev_lanes;
-    }
-    // loop check
-    if (std::any_of(
-          candidate_lanelets.begin(), candidate_lanelets.end(),
-          [lanelet](auto & prev_llt) { return lanelet.id() == prev_llt.id(); })) {
-      break;
-    }
 
-    // If lanelet_sequence_backward with input lanelet contains all candidate lanelets,
-    // break the loop.
-    if (std::all_of(
-          candidate_lanelets.begin(), candidate_lanelets.end(),
-          [lanelet_sequence_backward, lanelet](auto & prev_llt) {
-            return std::any_of(
+      for (const auto & prev_lanelet : candidate_lanelets) {
+        if (std::any_of(
               lanelet_sequence_backward.begin(), lanelet_sequence_backward.end(),
-              [prev_llt, lanelet](auto & llt) {
-                return (llt.id() == prev_llt.id() || lanelet.id() == prev_llt.id());
-              });
-          })) {
-      break;
-    }
-
-    for (const auto & prev_lanelet : candidate_lanelets) {
-      if (std::any_of(
-            lanelet_sequence_backward.begin(), lanelet_sequence_backward.end(),
-            [prev_lanelet, lanelet](auto & llt) {
-              return (llt.id() == prev_lanelet.id() || lanelet.id() == prev_lanelet.id());
-            })) {
-        continue;
+              [&prev_lanelet, &lanelet](const auto & llt) {
+                return (llt.id() == prev_lanelet.id() || lanelet.id() == prev_lanelet.id());
+              })) {
+          continue;
+        }
+        lanelet_sequence_backward.push_back(prev_lanelet);
+        length +=
+          static_cast<double>(boost::geometry::length(prev_lanelet.centerline().basicLineString()));
+        current_lanelet = prev_lanelet;
+        break;
       }
-      lanelet_sequence_backward.push_back(prev_lanelet);
-      length +=
-        static_cast<double>(boost::geometry::length(prev_lanelet.centerline().basicLineString()));
-      current_lanelet = prev_lanelet;
-      break;
     }
-  }
 
-  std::reverse(lanelet_sequence_backward.begin(), lanelet_sequence_backward.end());
-  return lanelet_sequence_backward;
+    std::reverse(lanelet_sequence_backward.begin(), lanelet_sequence_backward.end());
+    return lanelet_sequence_backward;
+  });
 }
 
 lanelet::ConstLanelets RouteHandler::getLaneletSequence(
@@ -633,7 +686,7 @@ lanelet::ConstLanelets RouteHandler::getLaneletSequence(
   }
 
   lanelet::ConstLanelets lanelet_sequence;
-  if (only_route_lanes && !exists(route_lanelets_, lanelet)) {
+  if (only_route_lanes && !isRouteLanelet(lanelet)) {
     return lanelet_sequence;
   }
 
@@ -667,7 +720,7 @@ lanelet::ConstLanelets RouteHandler::getLaneletSequence(
   const double forward_distance, const bool only_route_lanes) const
 {
   lanelet::ConstLanelets lanelet_sequence;
-  if (only_route_lanes && !exists(route_lanelets_, lanelet)) {
+  if (only_route_lanes && !isRouteLanelet(lanelet)) {
     return lanelet_sequence;
   }
 
@@ -699,98 +752,136 @@ lanelet::ConstLanelets RouteHandler::getLaneletSequence(
 bool RouteHandler::getFollowingShoulderLanelet(
   const lanelet::ConstLanelet & lanelet, lanelet::ConstLanelet * following_lanelet) const
 {
-  for (const auto & shoulder_lanelet : shoulder_lanelets_) {
-    if (lanelet::geometry::follows(lanelet, shoulder_lanelet)) {
-      *following_lanelet = shoulder_lanelet;
-      return true;
-    }
+  const auto following_shoulder_lanelet = memoize(
+    query_cache_->mutex, query_cache_->following_shoulder_lanelet, lanelet.id(),
+    [&]() -> boost::optional<lanelet::ConstLanelet> {
+      for (const auto & shoulder_lanelet : shoulder_lanelets_) {
+        if (lanelet::geometry::follows(lanelet, shoulder_lanelet)) {
+          return shoulder_lanelet;
+        }
+      }
+      return boost::none;
+    });
+  if (!following_shoulder_lanelet) {
+    return false;
   }
-  return false;
+  *following_lanelet = following_shoulder_lanelet.get();
+  return true;
 }
 
 bool RouteHandler::getLeftShoulderLanelet(
   const lanelet::ConstLanelet & lanelet, lanelet::ConstLanelet * left_lanelet) const
 {
-  for (const auto & shoulder_lanelet : shoulder_lanelets_) {
-    if (lanelet::geometry::leftOf(shoulder_lanelet, lanelet)) {
-      *left_lanelet = shoulder_lanelet;
-      return true;
-    }
+  const auto left_shoulder_lanelet = memoize(
+    query_cache_->mutex, query_cache_->left_shoulder_lanelet, lanelet.id(),
+    [&]() -> boost::optional<lanelet::ConstLanelet> {
+      for (const auto & shoulder_lanelet : shoulder_lanelets_) {
+        if (lanelet::geometry::leftOf(shoulder_lanelet, lanelet)) {
+          return shoulder_lanelet;
+        }
+      }
+      return boost::none;
+    });
+  if (!left_shoulder_lanelet) {
+    return false;
   }
-  return false;
+  *left_lanelet = left_shoulder_lanelet.get();
+  return true;
 }
 
 bool RouteHandler::getRightShoulderLanelet(
   const lanelet::ConstLanelet & lanelet, lanelet::ConstLanelet * right_lanelet) const
 {
-  for (const auto & shoulder_lanelet : shoulder_lanelets_) {
-    if (lanelet::geometry::rightOf(shoulder_lanelet, lanelet)) {
-      *right_lanelet = shoulder_lanelet;
-      return true;
-    }
+  const auto right_shoulder_lanelet = memoize(
+    query_cache_->mutex, query_cache_->right_shoulder_lanelet, lanelet.id(),
+    [&]() -> boost::optional<lanelet::ConstLanelet> {
+      for (const auto & shoulder_lanelet : shoulder_lanelets_) {
+        if (lanelet::geometry::rightOf(shoulder_lanelet, lanelet)) {
+          return shoulder_lanelet;
+        }
+      }
+      return boost::none;
+    });
+  if (!right_shoulder_lanelet) {
+    return false;
   }
-  return false;
+  *right_lanelet = right_shoulder_lanelet.get();
+  return true;
 }
 
 lanelet::ConstLanelets RouteHandler::getShoulderLaneletSequenceAfter(
   const lanelet::ConstLanelet & lanelet, const double min_length) const
 {
-  lanelet::ConstLanelets lanelet_sequence_forward;
-  if (!exists(shoulder_lanelets_, lanelet)) {
-    return lanelet_sequence_forward;
+  if (!isShoulderLanelet(lanelet)) {
+    return {};
   }
 
-  double length = 0;
-  lanelet::ConstLanelet current_lanelet = lanelet;
-  while (rclcpp::ok() && length < min_length) {
-    lanelet::ConstLanelet next_lanelet;
-    if (!getFollowingShoulderLanelet(current_lanelet, &next_lanelet)) {
-      break;
+  const auto key = std::make_pair(lanelet.id(), min_length);
+  return memoize(query_cache_->mutex, query_cache_->shoulder_sequence_after, key, [&]() {
+    lanelet::ConstLanelets lanelet_sequence_forward;
+    double length = 0;
+    lanelet::ConstLanelet current_lanelet = lanelet;
+    while (rclcpp::ok() && length < min_length) {
+      lanelet::ConstLanelet next_lanelet;
+      if (!getFollowingShoulderLanelet(current_lanelet, &next_lanelet)) {
+        break;
+      }
+      lanelet_sequence_forward.push_back(next_lanelet);
+      current_lanelet = next_lanelet;
+      length +=
+        static_cast<double>(boost::geometry::length(next_lanelet.centerline().basicLineString()));
     }
-    lanelet_sequence_forward.push_back(next_lanelet);
-    current_lanelet = next_lanelet;
-    length +=
-      static_cast<double>(boost::geometry::length(next_lanelet.centerline().basicLineString()));
-  }
 
-  return lanelet_sequence_forward;
+    return lanelet_sequence_forward;
+  });
 }
 
 bool RouteHandler::getPreviousShoulderLanelet(
   const lanelet::ConstLanelet & lanelet, lanelet::ConstLanelet * prev_lanelet) const
 {
-  for (const auto & shoulder_lanelet : shoulder_lanelets_) {
-    if (lanelet::geometry::follows(shoulder_lanelet, lanelet)) {
-      *prev_lanelet = shoulder_lanelet;
-      return true;
-    }
+  const auto previous_shoulder_lanelet = memoize(
+    query_cache_->mutex, query_cache_->previous_shoulder_lanelet, lanelet.id(),
+    [&]() -> boost::optional<lanelet::ConstLanelet> {
+      for (const auto & shoulder_lanelet : shoulder_lanelets_) {
+        if (lanelet::geometry::follows(shoulder_lanelet, lanelet)) {
+          return shoulder_lanelet;
+        }
+      }
+      return boost::none;
+    });
+  if (!previous_shoulder_lanelet) {
+    return false;
   }
-  return false;
+  *prev_lanelet = previous_shoulder_lanelet.get();
+  return true;
 }
 
 lanelet::ConstLanelets RouteHandler::getShoulderLaneletSequenceUpTo(
   const lanelet::ConstLanelet & lanelet, const double min_length) const
 {
-  lanelet::ConstLanelets lanelet_sequence_backward;
-  if (!exists(shoulder_lanelets_, lanelet)) {
-    return lanelet_sequence_backward;
+  if (!isShoulderLanelet(lanelet)) {
+    return {};
   }
 
-  double length = 0;
-  lanelet::ConstLanelet current_lanelet = lanelet;
-  while (rclcpp::ok() && length < min_length) {
-    lanelet::ConstLanelet prev_lanelet;
-    if (!getPreviousShoulderLanelet(current_lanelet, &prev_lanelet)) {
-      break;
-    }
+  const auto key = std::make_pair(lanelet.id(), min_length);
+  return memoize(query_cache_->mutex, query_cache_->shoulder_sequence_up_to, key, [&]() {
+    lanelet::ConstLanelets lanelet_sequence_backward;
+    double length = 0;
+    lanelet::ConstLanelet current_lanelet = lanelet;
+    while (rclcpp::ok() && length < min_length) {
+      lanelet::ConstLanelet prev_lanelet;
+      if (!getPreviousShoulderLanelet(current_lanelet, &prev_lanelet)) {
+        break;
+      }
 
-    lanelet_sequence_backward.insert(lanelet_sequence_backward.begin(), prev_lanelet);
-    current_lanelet = prev_lanelet;
-    length +=
-      static_cast<double>(boost::geometry::length(prev_lanelet.centerline().basicLineString()));
-  }
+      lanelet_sequence_backward.insert(lanelet_sequence_backward.begin(), prev_lanelet);
+      current_lanelet = prev_lanelet;
+      length +=
+        static_cast<double>(boost::geometry::length(prev_lanelet.centerline().basicLineString()));
+    }
 
-  return lanelet_sequence_backward;
+    return lanelet_sequence_backward;
+  });
 }
 
 lanelet::ConstLanelets RouteHandler::getShoulderLaneletSequence(
@@ -798,7 +889,7 @@ lanelet::ConstLanelets RouteHandler::getShoulderLaneletSequence(
   const double forward_distance) const
 {
   lanelet::ConstLanelets lanelet_sequence;
-  if (!exists(shoulder_lanelets_, lanelet)) {
+  if (!isShoulderLanelet(lanelet)) {
     return lanelet_sequence;
   }
 
@@ -860,7 +951,7 @@ bool RouteHandler::getNextLaneletWithinRoute(
 
   const auto following_lanelets = routing_graph_ptr_->following(lanelet);
   for (const auto & llt : following_lanelets) {
-    if (start_lane_id != llt.id() && exists(route_lanelets_, llt)) {
+    if (start_lane_id != llt.id() && isRouteLanelet(llt)) {
       *next_lanelet = llt;
       return true;
     }
@@ -882,7 +973,7 @@ bool RouteHandler::getPreviousLaneletsWithinRoute(
   const auto candidate_lanelets = routing_graph_ptr_->previous(lanelet);
   prev_lanelets->clear();
   for (const auto & llt : candidate_lanelets) {
-    if (exists(route_lanelets_, llt)) {
+    if (isRouteLanelet(llt)) {
       prev_lanelets->push_back(llt);
     }
   }
@@ -906,7 +997,7 @@ bool RouteHandler::getRightLaneletWithinRoute(
   const auto opt_right_lanelet = routing_graph_ptr_->right(lanelet);
   if (!!opt_right_lanelet) {
     *right_lanelet = opt_right_lanelet.get();
-    return exists(route_lanelets_, *right_lanelet);
+    return isRouteLanelet(*right_lanelet);
   }
   return false;
 }
@@ -919,7 +1010,7 @@ bool RouteHandler::getNextLaneletWithinRouteExceptStart(
   }
   const lanelet::ConstLanelets following_lanelets = routing_graph_ptr_->following(lanelet);
   for (const auto & llt : following_lanelets) {
-    if (exists(route_lanelets_, llt) && !exists(start_lanelets_, llt)) {
+    if (isRouteLanelet(llt) && !exists(start_lanelets_, llt)) {
       *next_lanelet = llt;
       return true;
     }
@@ -935,7 +1026,7 @@ bool RouteHandler::getPreviousLaneletWithinRouteExceptGoal(
   }
   const lanelet::ConstLanelets previous_lanelets = routing_graph_ptr_->previous(lanelet);
   for (const auto & llt : previous_lanelets) {
-    if (exists(route_lanelets_, llt) && !(exists(goal_lanelets_, llt))) {
+    if (isRouteLanelet(llt) && !(exists(goal_lanelets_, llt))) {
       *prev_lanelet = llt;
       return true;
     }
@@ -979,70 +1070,75 @@ boost::optional<lanelet::ConstLanelet> RouteHandler::getRightLanelet(
   const lanelet::ConstLanelet & lanelet, const bool enable_same_root,
   const bool get_shoulder_lane) const
 {
-  // right road lanelet of shoulder lanelet
-  if (isShoulderLanelet(lanelet)) {
-    for (const auto & road_lanelet : road_lanelets_) {
-      if (lanelet::geometry::rightOf(road_lanelet, lanelet)) {
-        return road_lanelet;
+  const auto key = std::make_tuple(lanelet.id(), enable_same_root, get_shoulder_lane);
+  return memoize(
+    query_cache_->mutex, query_cache_->right_lanelet, key,
+    [&]() -> boost::optional<lanelet::ConstLanelet> {
+      // right road lanelet of shoulder lanelet
+      if (isShoulderLanelet(lanelet)) {
+        for (const auto & road_lanelet : road_lanelets_) {
+          if (lanelet::geometry::rightOf(road_lanelet, lanelet)) {
+            return road_lanelet;
+          }
+        }
+        return boost::none;
       }
-    }
-    return boost::none;
-  }
 
-  // right shoulder lanelet
-  if (get_shoulder_lane) {
-    lanelet::ConstLanelet right_shoulder_lanelet;
-    if (getRightShoulderLanelet(lanelet, &right_shoulder_lanelet)) {
-      return right_shoulder_lanelet;
-    }
-  }
+      // right shoulder lanelet
+      if (get_shoulder_lane) {
+        lanelet::ConstLanelet right_shoulder_lanelet;
+        if (getRightShoulderLanelet(lanelet, &right_shoulder_lanelet)) {
+          return right_shoulder_lanelet;
+        }
+      }
 
-  // routable lane
-  const auto & right_lane = routing_graph_ptr_->right(lanelet);
-  if (right_lane) {
-    return right_lane;
-  }
+      // routable lane
+      const auto & right_lane = routing_graph_ptr_->right(lanelet);
+      if (right_lane) {
+        return right_lane;
+      }
 
-  // non-routable lane (e.g. lane change infeasible)
-  const auto & adjacent_right_lane = routing_graph_ptr_->adjacentRight(lanelet);
-  if (adjacent_right_lane) {
-    return adjacent_right_lane;
-  }
+      // non-routable lane (e.g. lane change infeasible)
+      const auto & adjacent_right_lane = routing_graph_ptr_->adjacentRight(lanelet);
+      if (adjacent_right_lane) {
+        return adjacent_right_lane;
+      }
 
-  // same root right lanelet
-  if (!enable_same_root) {
-    return adjacent_right_lane;
-  }
+      // same root right lanelet
+      if (!enable_same_root) {
+        return adjacent_right_lane;
+      }
 
-  lanelet::ConstLanelets prev_lanelet;
-  if (!getPreviousLaneletsWithinRoute(lanelet, &prev_lanelet)) {
-    return adjacent_right_lane;
-  }
+      lanelet::ConstLanelets prev_lanelet;
+      if (!getPreviousLaneletsWithinRoute(lanelet, &prev_lanelet)) {
+        return adjacent_right_lane;
+      }
 
-  lanelet::ConstLanelet next_lanelet;
-  if (!getNextLaneletWithinRoute(lanelet, &next_lanelet)) {
-    for (const auto & lane : getNextLanelets(prev_lanelet.front())) {
-      if (lanelet.rightBound().back().id() == lane.leftBound().back().id()) {
-        return lane;
+      lanelet::ConstLanelet next_lanelet;
+      if (!getNextLaneletWithinRoute(lanelet, &next_lanelet)) {
+        for (const auto & lane : getNextLanelets(prev_lanelet.front())) {
+          if (lanelet.rightBound().back().id() == lane.leftBound().back().id()) {
+            return lane;
+          }
+        }
+        return adjacent_right_lane;
       }
-    }
-    return adjacent_right_lane;
-  }
 
-  const auto next_right_lane = getRightLanelet(next_lanelet, false);
-  if (!next_right_lane) {
-    return adjacent_right_lane;
-  }
+      const auto next_right_lane = getRightLanelet(next_lanelet, false);
+      if (!next_right_lane) {
+        return adjacent_right_lane;
+      }
 
-  for (const auto & lane : getNextLanelets(prev_lanelet.front())) {
-    for (const auto & target_lane : getNextLanelets(lane)) {
-      if (next_right_lane.get().id() == target_lane.id()) {
-        return lane;
+      for (const auto & lane : getNextLanelets(prev_lanelet.front())) {
+        for (const auto & target_lane : getNextLanelets(lane)) {
+          if (next_right_lane.get().id() == target_lane.id()) {
+            return lane;
+          }
+        }
       }
-    }
-  }
 
-  return adjacent_right_lane;
+      return adjacent_right_lane;
+    });
 }
 
 bool RouteHandler::getLeftLaneletWithinRoute(
@@ -1051,7 +1147,7 @@ bool RouteHandler::getLeftLaneletWithinRoute(
   const auto opt_left_lanelet = routing_graph_ptr_->left(lanelet);
   if (!!opt_left_lanelet) {
     *left_lanelet = opt_left_lanelet.get();
-    return exists(route_lanelets_, *left_lanelet);
+    return isRouteLanelet(*left_lanelet);
   }
   return false;
 }
@@ -1060,70 +1156,75 @@ boost::optional<lanelet::ConstLanelet> RouteHandler::getLeftLanelet(
   const lanelet::ConstLanelet & lanelet, const bool enable_same_root,
   const bool get_shoulder_lane) const
 {
-  // left road lanelet of shoulder lanelet
-  if (isShoulderLanelet(lanelet)) {
-    for (const auto & road_lanelet : road_lanelets_) {
-      if (lanelet::geometry::leftOf(road_lanelet, lanelet)) {
-        return road_lanelet;
+  const auto key = std::make_tuple(lanelet.id(), enable_same_root, get_shoulder_lane);
+  return memoize(
+    query_cache_->mutex, query_cache_->left_lanelet, key,
+    [&]() -> boost::optional<lanelet::ConstLanelet> {
+      // left road lanelet of shoulder lanelet
+      if (isShoulderLanelet(lanelet)) {
+        for (const auto & road_lanelet : road_lanelets_) {
+          if (lanelet::geometry::leftOf(road_lanelet, lanelet)) {
+            return road_lanelet;
+          }
+        }
+        return boost::none;
       }
-    }
-    return boost::none;
-  }
 
-  // left shoulder lanelet
-  if (get_shoulder_lane) {
-    lanelet::ConstLanelet left_shoulder_lanelet;
-    if (getLeftShoulderLanelet(lanelet, &left_shoulder_lanelet)) {
-      return left_shoulder_lanelet;
-    }
-  }
+      // left shoulder lanelet
+      if (get_shoulder_lane) {
+        lanelet::ConstLanelet left_shoulder_lanelet;
+        if (getLeftShoulderLanelet(lanelet, &left_shoulder_lanelet)) {
+          return left_shoulder_lanelet;
+        }
+      }
 
-  // routable lane
-  const auto & left_lane = routing_graph_ptr_->left(lanelet);
-  if (left_lane) {
-    return left_lane;
-  }
+      // routable lane
+      const auto & left_lane = routing_graph_ptr_->left(lanelet);
+      if (left_lane) {
+        return left_lane;
+      }
 
-  // non-routable lane (e.g. lane change infeasible)
-  const auto & adjacent_left_lane = routing_graph_ptr_->adjacentLeft(lanelet);
-  if (adjacent_left_lane) {
-    return adjacent_left_lane;
-  }
+      // non-routable lane (e.g. lane change infeasible)
+      const auto & adjacent_left_lane = routing_graph_ptr_->adjacentLeft(lanelet);
+      if (adjacent_left_lane) {
+        return adjacent_left_lane;
+      }
 
-  // same root right lanelet
-  if (!enable_same_root) {
-    return adjacent_left_lane;
-  }
+      // same root right lanelet
+      if (!enable_same_root) {
+        return adjacent_left_lane;
+      }
 
-  lanelet::ConstLanelets prev_lanelet;
-  if (!getPreviousLaneletsWithinRoute(lanelet, &prev_lanelet)) {
-    return adjacent_left_lane;
-  }
+      lanelet::ConstLanelets prev_lanelet;
+      if (!getPreviousLaneletsWithinRoute(lanelet, &prev_lanelet)) {
+        return adjacent_left_lane;
+      }
 
-  lanelet::ConstLanelet next_lanelet;
-  if (!getNextLaneletWithinRoute(lanelet, &next_lanelet)) {
-    for (const auto & lane : getNextLanelets(prev_lanelet.front())) {
-      if (lanelet.leftBound().back().id() == lane.rightBound().back().id()) {
-        return lane;
+      lanelet::ConstLanelet next_lanelet;
+      if (!getNextLaneletWithinRoute(lanelet, &next_lanelet)) {
+        for (const auto & lane : getNextLanelets(prev_lanelet.front())) {
+          if (lanelet.leftBound().back().id() == lane.rightBound().back().id()) {
+            return lane;
+          }
+        }
+        return adjacent_left_lane;
       }
-    }
-    return adjacent_left_lane;
-  }
 
-  const auto next_left_lane = getLeftLanelet(next_lanelet, false);
-  if (!next_left_lane) {
-    return adjacent_left_lane;
-  }
+      const auto next_left_lane = getLeftLanelet(next_lanelet, false);
+      if (!next_left_lane) {
+        return adjacent_left_lane;
+      }
 
-  for (const auto & lane : getNextLanelets(prev_lanelet.front())) {
-    for (const auto & target_lane : getNextLanelets(lane)) {
-      if (next_left_lane.get().id() == target_lane.id()) {
-        return lane;
+      for (const auto & lane : getNextLanelets(prev_lanelet.front())) {
+        for (const auto & target_lane : getNextLanelets(lane)) {
+          if (next_left_lane.get().id() == target_lane.id()) {
+            return lane;
+          }
+        }
       }
-    }
-  }
 
-  return adjacent_left_lane;
+      return adjacent_left_lane;
+    });
 }
 
 lanelet::Lanelets RouteHandler::getRightOppositeLanelets(
@@ -1908,12 +2009,12 @@ lanelet::ConstLanelets RouteHandler::getShoulderLanelets() const
 
 bool RouteHandler::isShoulderLanelet(const lanelet::ConstLanelet & lanelet) const
 {
-  return lanelet::utils::contains(shoulder_lanelets_, lanelet);
+  return query_cache_->shoulder_lanelet_ids.count(lanelet.id()) > 0;
 }
 
 bool RouteHandler::isRouteLanelet(const lanelet::ConstLanelet & lanelet) const
 {
-  return lanelet::utils::contains(route_lanelets_, lanelet);
+  return query_cache_->route_lanelet_ids.count(lanelet.id()) > 0;
 }
 
 lanelet::ConstLanelets RouteHandler::getPreviousLaneletSequence(
@@ -1963,7 +2064,7 @@ lanelet::ConstLanelets RouteHandler::getLaneSequenceUpTo(
   const lanelet::ConstLanelet & lanelet) const
 {
   lanelet::ConstLanelets lanelet_sequence_backward;
-  if (!exists(route_lanelets_, lanelet)) {
+  if (!isRouteLanelet(lanelet)) {
     return lanelet_sequence_backward;
   }
 
@@ -1978,7 +2079,7 @@ lanelet::ConstLanelets RouteHandler::getLaneSequenceUpTo(
     // break the loop.
     if (std::all_of(
           candidate_lanelets.begin(), candidate_lanelets.end(),
-          [lanelet_sequence_backward, lanelet](auto & prev_llt) {
+          [&lanelet_sequence_backward, &lanelet](const auto & prev_llt) {
             return std::any_of(
               lanelet_sequence_backward.begin(), lanelet_sequence_backward.end(),
               [prev_llt, lanelet](auto & llt) {
@@ -2018,7 +2119,7 @@ lanelet::ConstLanelets RouteHandler::getLaneSequenceAfter(
   const lanelet::ConstLanelet & lanelet) const
 {
   lanelet::ConstLanelets lane_sequence_forward;
-  if (!exists(route_lanelets_, lanelet)) {
+  if (!isRouteLanelet(lanelet)) {
     return lane_sequence_forward;
   }
   lane_sequence_forward.push_back(lanelet);
@@ -2049,7 +2150,7 @@ lanelet::ConstLanelets RouteHandler::getNeighborsWithinRoute(
     lanelet::utils::query::getAllNeighbors(routing_graph_ptr_, lanelet);
   lanelet::ConstLanelets neighbors_within_route;
   for (const auto & llt : neighbor_lanelets) {
-    if (exists(route_lanelets_, llt)) {
+    if (isRouteLanelet(llt)) {
       neighbors_within_route.push_back(llt);
     }
   }
@@ -2118,7 +2219,6 @@ bool RouteHandler::planPathLaneletsBetweenCheckpoints(
     return false;
   }
 
-  lanelet::Optional<lanelet::routing::Route> optional_route;
   std::vector<lanelet::ConstLanelets> candidate_paths;
   lanelet::routing::LaneletPath shortest_path;
   bool is_route_found = false;
@@ -2142,7 +2242,7 @@ bool RouteHandler::planPathLaneletsBetweenCheckpoints(
       }
     }
 
-    optional_route = routing_graph_ptr_->getRoute(st_llt, goal_lanelet, 0);
+    const auto optional_route = getShortestRoute(st_llt, goal_lanelet);
     if (!optional_route || !is_proper_angle) {
       RCLCPP_ERROR_STREAM(
         logger_, "Failed to find a proper route!"
@@ -2154,9 +2254,9 @@ bool RouteHandler::planPathLaneletsBetweenCheckpoints(
     } else {
       is_route_found = true;
 
-      if (optional_route->length2d() < shortest_path_length2d) {
-        shortest_path_length2d = optional_route->length2d();
-        shortest_path = optional_route->shortestPath();
+      if (optional_route->length2d < shortest_path_length2d) {
+        shortest_path_length2d = optional_route->length2d;
+        shortest_path = optional_route->shortest_path;
         start_lanelet = st_llt;
       }
     }
@@ -2244,11 +2344,36 @@ bool RouteHandler::hasNoDrivableLaneInPath(const lanelet::routing::LaneletPath &
 bool RouteHandler::findDrivableLanePath(
   const lanelet::ConstLanelet & start_lanelet, const lanelet::ConstLanelet & goal_lanelet,
   lanelet::routing::LaneletPath & drivable_lane_path) const
+{
+  const auto key = std::make_pair(start_lanelet.id(), goal_lanelet.id());
+  const auto cached_path = memoize(
+    routing_cache_->mutex, routing_cache_->drivable_lane_paths, key,
+    [&]() -> boost::optional<lanelet::routing::LaneletPath> {
+      lanelet::routing::LaneletPath path;
+      if (!findDrivableLanePathImpl(start_lanelet, goal_lanelet, path)) {
+        return boost::none;
+      }
+      return path;
+    });
+  if (!cached_path) {
+    return false;
+  }
+  drivable_lane_path = *cached_path;
+  return true;
+}
+
+bool RouteHandler::findDrivableLanePathImpl(
+  const lanelet::ConstLanelet & start_lanelet, const lanelet::ConstLanelet & goal_lanelet,
+  lanelet::routing::LaneletPath & drivable_lane_path) const
 {
   double drivable_lane_path_length2d = std::numeric_limits<double>::max();
   bool drivable_lane_path_found = false;
 
   for (const auto & llt : road_lanelets_) {
+    // the route via a no_drivable_lane always includes it, so it is rejected without searching it
+    if (llt.attributeOr("no_drivable_lane", "no") == std::string("yes")) {
+      continue;
+    }
     lanelet::ConstLanelets via_lanelet;
     via_lanelet.push_back(llt);
     const lanelet::Optional<lanelet::routing::Route> optional_route =
@@ -2267,4 +2392,19 @@ bool RouteHandler::findDrivableLanePath(
   return drivable_lane_path_found;
 }
 
+boost::optional<RouteHandler::RoutingCache::Route> RouteHandler::getShortestRoute(
+  const lanelet::ConstLanelet & start_lanelet, const lanelet::ConstLanelet & goal_lanelet) const
+{
+  const auto key = std::make_pair(start_lanelet.id(), goal_lanelet.id());
+  return memoize(
+    routing_cache_->mutex, routing_cache_->routes, key,
+    [&]() -> boost::optional<RoutingCache::Route> {
+      const auto route = routing_graph_ptr_->getRoute(start_lanelet, goal_lanelet, 0);
+      if (!route) {
+        return boost::none;
+      }
+      return RoutingCache::Route{route->shortestPath(), route->length2d()};
+    });
+}
+
 }  // namespace route_handler
@@ -27,8 +27,11 @@
 #include "tier4_rtc_msgs/srv/cooperate_commands.hpp"
 #include <unique_identifier_msgs/msg/uuid.hpp>
 
+#include <cstdint>
+#include <cstring>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
 namespace rtc_interface
@@ -43,6 +46,17 @@ using tier4_rtc_msgs::srv::AutoMode;
 using tier4_rtc_msgs::srv::CooperateCommands;
 using unique_identifier_msgs::msg::UUID;
 
+struct UUIDHash
+{
+  size_t operator()(const UUID::_uuid_type & uuid) const
+  {
+    // The uuids are random, so the half of the bytes is enough for the hash.
+    uint64_t hash;
+    std::memcpy(&hash, uuid.data(), sizeof(hash));
+    return static_cast<size_t>(hash);
+  }
+};
+
 class RTCInterface
 {
 public:
@@ -68,6 +82,8 @@ private:
     const std::vector<CooperateCommand> & commands);
   void updateCooperateCommandStatus(const std::vector<CooperateCommand> & commands);
   void removeStoredCommand(const UUID & uuid);
+  CooperateStatus * findCooperateStatus(const UUID & uuid);
+  const CooperateStatus * findCooperateStatus(const UUID & uuid) const;
   rclcpp::Logger getLogger() const;
   bool isLocked() const;
 
@@ -79,6 +95,9 @@ private:
 
   Module module_;
   CooperateStatusArray registered_status_;
+  // index in registered_status_.statuses for every uuid
+  std::unordered_map<UUID::_uuid_type, size_t, UUIDHash> status_indices_;
+  bool is_empty_status_published_{false};
   std::vector<CooperateCommand> stored_commands_;
   bool is_auto_mode_init_;
   bool is_locked_;
@@ -108,6 +108,16 @@ RTCInterface::RTCInterface(rclcpp::Node * node, const std::string & name, const
 void RTCInterface::publishCooperateStatus(const rclcpp::Time & stamp)
 {
   std::lock_guard<std::mutex> lock(mutex_);
+  // The subscribers keep the latest statuses, so the empty statuses of the inactive modules are
+  // published only once instead of every cycle.
+  if (registered_status_.statuses.empty()) {
+    if (is_empty_status_published_) {
+      return;
+    }
+    is_empty_status_published_ = true;
+  } else {
+    is_empty_status_published_ = false;
+  }
   registered_status_.stamp = stamp;
   pub_statuses_->publish(registered_status_);
 }
@@ -138,10 +148,7 @@ std::vector<CooperateResponse> RTCInterface::validateCooperateCommands(
     response.uuid = command.uuid;
     response.module = command.module;
 
-    const auto itr = std::find_if(
-      registered_status_.statuses.begin(), registered_status_.statuses.end(),
-      [command](auto & s) { return s.uuid == command.uuid; });
-    if (itr != registered_status_.statuses.end()) {
+    if (findCooperateStatus(command.uuid)) {
       response.success = true;
     } else {
       RCLCPP_WARN_STREAM(
@@ -158,14 +165,12 @@ std::vector<CooperateResponse> RTCInterface::validateCooperateCommands(
 void RTCInterface::updateCooperateCommandStatus(const std::vector<CooperateCommand> & commands)
 {
   for (const auto & command : commands) {
-    const auto itr = std::find_if(
-      registered_status_.statuses.begin(), registered_status_.statuses.end(),
-      [command](auto & s) { return s.uuid == command.uuid; });
+    auto * status = findCooperateStatus(command.uuid);
 
     // Update command if the command has been already received
-    if (itr != registered_status_.statuses.end()) {
-      itr->command_status = command.command;
-      itr->auto_mode = false;
+    if (status) {
+      status->command_status = command.command;
+      status->auto_mode = false;
     }
   }
 }
@@ -187,12 +192,10 @@ void RTCInterface::updateCooperateStatus(
 {
   std::lock_guard<std::mutex> lock(mutex_);
   // Find registered status which has same uuid
-  auto itr = std::find_if(
-    registered_status_.statuses.begin(), registered_status_.statuses.end(),
-    [uuid](auto & s) { return s.uuid == uuid; });
+  auto * registered_status = findCooperateStatus(uuid);
 
   // If there is no registered status, add it
-  if (itr == registered_status_.statuses.end()) {
+  if (!registered_status) {
     CooperateStatus status;
     status.stamp = stamp;
     status.uuid = uuid;
@@ -202,15 +205,16 @@ void RTCInterface::updateCooperateStatus(
     status.start_distance = start_distance;
     status.finish_distance = finish_distance;
     status.auto_mode = is_auto_mode_init_;
+    status_indices_.emplace(uuid.uuid, registered_status_.statuses.size());
     registered_status_.statuses.push_back(status);
     return;
   }
 
   // If the registered status is found, update status
-  itr->stamp = stamp;
-  itr->safe = safe;
-  itr->start_distance = start_distance;
-  itr->finish_distance = finish_distance;
+  registered_status->stamp = stamp;
+  registered_status->safe = safe;
+  registered_status->start_distance = start_distance;
+  registered_status->finish_distance = finish_distance;
 }
 
 void RTCInterface::removeCooperateStatus(const UUID & uuid)
@@ -218,12 +222,17 @@ void RTCInterface::removeCooperateStatus(const UUID & uuid)
   std::lock_guard<std::mutex> lock(mutex_);
   removeStoredCommand(uuid);
   // Find registered status which has same uuid and erase it
-  const auto itr = std::find_if(
-    registered_status_.statuses.begin(), registered_status_.statuses.end(),
-    [uuid](auto & s) { return s.uuid == uuid; });
-
-  if (itr != registered_status_.statuses.end()) {
-    registered_status_.statuses.erase(itr);
+  const auto index_itr = status_indices_.find(uuid.uuid);
+
+  if (index_itr != status_indices_.end()) {
+    // keep the order of the statuses, and shift the indices of the following ones
+    auto & statuses = registered_status_.statuses;
+    const auto index = index_itr->second;
+    status_indices_.erase(index_itr);
+    statuses.erase(statuses.begin() + index);
+    for (size_t i = index; i < statuses.size(); ++i) {
+      status_indices_[statuses.at(i).uuid.uuid] = i;
+    }
     return;
   }
 
@@ -248,21 +257,20 @@ void RTCInterface::clearCooperateStatus()
 {
   std::lock_guard<std::mutex> lock(mutex_);
   registered_status_.statuses.clear();
+  status_indices_.clear();
   stored_commands_.clear();
 }
 
 bool RTCInterface::isActivated(const UUID & uuid) const
 {
   std::lock_guard<std::mutex> lock(mutex_);
-  const auto itr = std::find_if(
-    registered_status_.statuses.begin(), registered_status_.statuses.end(),
-    [uuid](auto & s) { return s.uuid == uuid; });
+  const auto * status = findCooperateStatus(uuid);
 
-  if (itr != registered_status_.statuses.end()) {
-    if (itr->auto_mode) {
-      return itr->safe;
+  if (status) {
+    if (status->auto_mode) {
+      return status->safe;
     } else {
-      return itr->command_status.type == Command::ACTIVATE;
+      return status->command_status.type == Command::ACTIVATE;
     }
   }
 
@@ -274,10 +282,7 @@ bool RTCInterface::isActivated(const UUID & uuid) const
 bool RTCInterface::isRegistered(const UUID & uuid) const
 {
   std::lock_guard<std::mutex> lock(mutex_);
-  const auto itr = std::find_if(
-    registered_status_.statuses.begin(), registered_status_.statuses.end(),
-    [uuid](auto & s) { return s.uuid == uuid; });
-  return itr != registered_status_.statuses.end();
+  return findCooperateStatus(uuid) != nullptr;
 }
 
 void RTCInterface::lockCommandUpdate()
@@ -291,6 +296,18 @@ void RTCInterface::unlockCommandUpdate()
   updateCooperateCommandStatus(stored_commands_);
 }
 
+CooperateStatus * RTCInterface::findCooperateStatus(const UUID & uuid)
+{
+  const auto itr = status_indices_.find(uuid.uuid);
+  return itr == status_indices_.end() ? nullptr : &registered_status_.statuses.at(itr->second);
+}
+
+const CooperateStatus * RTCInterface::findCooperateStatus(const UUID & uuid) const
+{
+  const auto itr = status_indices_.find(uuid.uuid);
+  return itr == status_indices_.end() ? nullptr : &registered_status_.statuses.at(itr->second);
+}
+
 rclcpp::Logger RTCInterface::getLogger() const
 {
   return logger_;
@@ -28,6 +28,47 @@
 
 namespace frenet_planner
 {
+namespace
+{
+/// @brief position and left normal of the reference at a frenet arc length
+struct ReferenceFrame
+{
+  double x;
+  double y;
+  double normal_x;
+  double normal_y;
+};
+
+/// @brief same as reference.cartesian(fp) using the reference frame at fp.s
+sampler_common::Point2d toCartesian(const ReferenceFrame & frame, const double d)
+{
+  return {frame.x + d * frame.normal_x, frame.y + d * frame.normal_y};
+}
+
+/// @brief calculate the yaws, lengths, and curvatures of a path from its cartesian points
+void calculateYawsLengthsCurvatures(Path & path)
+{
+  // TODO(Maxime CLEMENT): more precise calculations are proposed in Appendix I of the paper:
+  // Optimal path Generation for Dynamic Street Scenarios in a Frenet Frame (Werling2010)
+  // Calculate cartesian yaw and interval values
+  path.lengths.push_back(0.0);
+  for (auto it = path.points.begin(); it != std::prev(path.points.end()); ++it) {
+    const auto dx = std::next(it)->x() - it->x();
+    const auto dy = std::next(it)->y() - it->y();
+    path.yaws.push_back(std::atan2(dy, dx));
+    path.lengths.push_back(path.lengths.back() + std::hypot(dx, dy));
+  }
+  path.yaws.push_back(path.yaws.back());
+  // Calculate curvatures
+  for (size_t i = 1; i < path.yaws.size(); ++i) {
+    const auto dyaw =
+      autoware::common::helper_functions::wrap_angle(path.yaws[i] - path.yaws[i - 1]);
+    path.curvatures.push_back(dyaw / (path.lengths[i - 1], path.lengths[i]));
+  }
+  path.curvatures.push_back(path.curvatures.back());
+}
+}  // namespace
+
 std::vector<Trajectory> generateTrajectories(
   const sampler_common::transform::Spline2D & reference_spline, const FrenetState & initial_state,
   const SamplingParameters & sampling_parameters)
@@ -71,12 +112,38 @@ std::vector<Path> generatePaths(
   const sampler_common::transform::Spline2D & reference_spline, const FrenetState & initial_state,
   const SamplingParameters & sampling_parameters)
 {
+  // all candidates are sampled on the same arc lengths from the initial state, so the reference
+  // frames are calculated once on the arc lengths of the longest candidate and shared
+  double max_delta_s = 0.0;
+  for (const auto & parameter : sampling_parameters.parameters) {
+    max_delta_s =
+      std::max(max_delta_s, parameter.target_state.position.s - initial_state.position.s);
+  }
+  std::vector<ReferenceFrame> reference_frames;
+  for (double s = sampling_parameters.resolution; s <= max_delta_s;
+       s += sampling_parameters.resolution) {
+    const auto frenet_s = initial_state.position.s + s;
+    const auto heading = reference_spline.yaw(frenet_s);
+    const auto position = reference_spline.cartesian(frenet_s);
+    reference_frames.push_back(
+      {position.x(), position.y(), std::cos(heading + M_PI_2), std::sin(heading + M_PI_2)});
+  }
+
   std::vector<Path> candidates;
   candidates.reserve(sampling_parameters.parameters.size());
-  for (const auto parameter : sampling_parameters.parameters) {
+  for (const auto & parameter : sampling_parameters.parameters) {
     auto candidate =
       generateCandidate(initial_state, parameter.target_state, sampling_parameters.resolution);
-    calculateCartesian(reference_spline, candidate);
+    if (!candidate.frenet_points.empty()) {
+      candidate.points.reserve(candidate.frenet_points.size());
+      candidate.yaws.reserve(candidate.frenet_points.size());
+      candidate.lengths.reserve(candidate.frenet_points.size());
+      candidate.curvatures.reserve(candidate.frenet_points.size());
+      for (size_t i = 0; i < candidate.frenet_points.size(); ++i) {
+        candidate.points.push_back(toCartesian(reference_frames[i], candidate.frenet_points[i].d));
+      }
+      calculateYawsLengthsCurvatures(candidate);
+    }
     candidates.push_back(candidate);
   }
   return candidates;
@@ -154,24 +221,7 @@ void calculateCartesian(const sampler_common::transform::Spline2D & reference, P
     for (const auto & fp : path.frenet_points) {
       path.points.push_back(reference.cartesian(fp));
     }
-    // TODO(Maxime CLEMENT): more precise calculations are proposed in Appendix I of the paper:
-    // Optimal path Generation for Dynamic Street Scenarios in a Frenet Frame (Werling2010)
-    // Calculate cartesian yaw and interval values
-    path.lengths.push_back(0.0);
-    for (auto it = path.points.begin(); it != std::prev(path.points.end()); ++it) {
-      const auto dx = std::next(it)->x() - it->x();
-      const auto dy = std::next(it)->y() - it->y();
-      path.yaws.push_back(std::atan2(dy, dx));
-      path.lengths.push_back(path.lengths.back() + std::hypot(dx, dy));
-    }
-    path.yaws.push_back(path.yaws.back());
-    // Calculate curvatures
-    for (size_t i = 1; i < path.yaws.size(); ++i) {
-      const auto dyaw =
-        autoware::common::helper_functions::wrap_angle(path.yaws[i] - path.yaws[i - 1]);
-      path.curvatures.push_back(dyaw / (path.lengths[i - 1], path.lengths[i]));
-    }
-    path.curvatures.push_back(path.curvatures.back());
+    calculateYawsLengthsCurvatures(path);
   }
 }
 void calculateCartesian(
@@ -46,6 +46,8 @@ struct Parameters
     bool force_zero_heading{};
     bool smooth_reference{};
   } preprocessing{};
+
+  int num_threads{};  // threads evaluating the candidate paths (0: the number of the cores)
 };
 
 #endif  // PATH_SAMPLER__PARAMETERS_HPP_
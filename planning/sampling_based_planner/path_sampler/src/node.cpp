@@ -26,8 +26,14 @@
 
 #include <boost/geometry/algorithms/distance.hpp>
 
+#include <algorithm>
 #include <chrono>
+#include <exception>
 #include <limits>
+#include <memory>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace path_sampler
 {
@@ -55,6 +61,51 @@ bool hasZeroVelocity(const TrajectoryPoint & traj_point)
   constexpr double zero_vel = 0.0001;
   return std::abs(traj_point.longitudinal_velocity_mps) < zero_vel;
 }
+
+// check the hard constraints and calculate the cost of each path, the paths being independent of
+// each other they are evaluated by chunks on num_threads threads (0: the number of the cores)
+std::vector<sampler_common::MultiPoint2d> evaluatePaths(
+  std::vector<sampler_common::Path> & paths, const sampler_common::Constraints & constraints,
+  const sampler_common::transform::Spline2D & reference, const size_t num_threads)
+{
+  const size_t max_threads = num_threads == 0 ? std::thread::hardware_concurrency() : num_threads;
+  const size_t thread_num = std::clamp<size_t>(max_threads, 1, std::max<size_t>(paths.size(), 1));
+  const size_t chunk_size = (paths.size() + thread_num - 1) / thread_num;
+
+  std::vector<sampler_common::MultiPoint2d> footprints(paths.size());
+  const auto evaluate_chunk = [&](const size_t begin) {
+    for (size_t i = begin; i < std::min(begin + chunk_size, paths.size()); ++i) {
+      footprints[i] = sampler_common::constraints::checkHardConstraints(paths[i], constraints);
+      sampler_common::constraints::calculateCost(paths[i], constraints, reference);
+    }
+  };
+
+  std::vector<std::exception_ptr> exceptions(thread_num);
+  std::vector<std::thread> threads;
+  for (size_t t = 1; t < thread_num; ++t) {
+    threads.emplace_back([&, t]() {
+      try {
+        evaluate_chunk(t * chunk_size);
+      } catch (...) {
+        exceptions[t] = std::current_exception();
+      }
+    });
+  }
+  try {
+    evaluate_chunk(0);
+  } catch (...) {
+    exceptions[0] = std::current_exception();
+  }
+  for (auto & thread : threads) {
+    thread.join();
+  }
+  for (const auto & exception : exceptions) {
+    if (exception) {
+      std::rethrow_exception(exception);
+    }
+  }
+  return footprints;
+}
 }  // namespace
 
 PathSampler::PathSampler(const rclcpp::NodeOptions & node_options)
@@ -63,7 +114,11 @@ PathSampler::PathSampler(const rclcpp::NodeOptions & node_options)
   time_keeper_ptr_(std::make_shared<TimeKeeper>())
 {
   // interface publisher
-  traj_pub_ = create_publisher<Trajectory>("~/output/path", 1);
+  // NOTE: the trajectory is handed over to the next planner in the same container with
+  // intra-process communication, which does not serialize nor copy the message
+  rclcpp::PublisherOptions traj_pub_options;
+  traj_pub_options.use_intra_process_comm = rclcpp::IntraProcessSetting::Enable;
+  traj_pub_ = create_publisher<Trajectory>("~/output/path", 1, traj_pub_options);
   virtual_wall_pub_ = create_publisher<MarkerArray>("~/virtual_wall", 1);
 
   // interface subscriber
@@ -116,6 +171,7 @@ PathSampler::PathSampler(const rclcpp::NodeOptions & node_options)
       declare_parameter<bool>("preprocessing.force_zero_initial_heading");
     params_.preprocessing.smooth_reference =
       declare_parameter<bool>("preprocessing.smooth_reference_trajectory");
+    params_.num_threads = declare_parameter<int>("num_threads", 1);
     params_.constraints.ego_footprint = vehicle_info_.createFootprint();
     params_.constraints.ego_width = vehicle_info_.vehicle_width_m;
     params_.constraints.ego_length = vehicle_info_.vehicle_length_m;
@@ -173,6 +229,7 @@ rcl_interfaces::msg::SetParametersResult PathSampler::onParam(
   updateParam(parameters, "sampling.bezier.nb_t", params_.sampling.bezier.nb_t);
   updateParam(parameters, "sampling.bezier.mt_min", params_.sampling.bezier.mt_min);
   updateParam(parameters, "sampling.bezier.mt_max", params_.sampling.bezier.mt_max);
+  updateParam(parameters, "num_threads", params_.num_threads);
   updateParam(
     parameters, "preprocessing.force_zero_initial_deviation",
     params_.preprocessing.force_zero_deviation);
@@ -243,15 +300,13 @@ void PathSampler::onPath(const Path::SharedPtr path_ptr)
   // 3. extend trajectory to connect the optimized trajectory and the following path smoothly
   if (!generated_traj_points.empty()) {
     auto full_traj_points = extendTrajectory(planner_data.traj_points, generated_traj_points);
-    const auto output_traj_msg =
-      trajectory_utils::createTrajectory(path_ptr->header, full_traj_points);
-    traj_pub_->publish(output_traj_msg);
+    auto output_traj_msg = trajectory_utils::createTrajectory(path_ptr->header, full_traj_points);
+    traj_pub_->publish(std::make_unique<Trajectory>(std::move(output_traj_msg)));
   } else {
     auto stopping_traj = trajectory_utils::convertToTrajectoryPoints(planner_data.traj_points);
     for (auto & p : stopping_traj) p.longitudinal_velocity_mps = 0.0;
-    const auto output_traj_msg =
-      trajectory_utils::createTrajectory(path_ptr->header, stopping_traj);
-    traj_pub_->publish(output_traj_msg);
+    auto output_traj_msg = trajectory_utils::createTrajectory(path_ptr->header, stopping_traj);
+    traj_pub_->publish(std::make_unique<Trajectory>(std::move(output_traj_msg)));
   }
 
   time_keeper_ptr_->toc(__func__, "");
@@ -435,13 +490,9 @@ std::vector<TrajectoryPoint> PathSampler::generatePath(const PlannerData & plann
       resetPreviousData();
     }
   }
-  debug_data_.footprints.clear();
-  for (auto & path : candidate_paths) {
-    const auto footprint =
-      sampler_common::constraints::checkHardConstraints(path, params_.constraints);
-    debug_data_.footprints.push_back(footprint);
-    sampler_common::constraints::calculateCost(path, params_.constraints, path_spline);
-  }
+  debug_data_.footprints = evaluatePaths(
+    candidate_paths, params_.constraints, path_spline,
+    static_cast<size_t>(std::max(params_.num_threads, 0)));
   const auto best_path_idx = [](const auto & paths) {
     auto min_cost = std::numeric_limits<double>::max();
     size_t best_path_idx = 0;
@@ -50,6 +50,13 @@ void prepareConstraints(
     drivable_area_polygon.outer().emplace_back(it->x, it->y);
   drivable_area_polygon.outer().push_back(drivable_area_polygon.outer().front());
   constraints.drivable_polygons = {drivable_area_polygon};
+
+  // the polygons are checked against the footprint points of every candidate path
+  constexpr auto grid_resolution = 0.5;  // [m]
+  constraints.obstacle_grid =
+    sampler_common::constraints::PolygonGrid(constraints.obstacle_polygons, grid_resolution);
+  constraints.drivable_grid =
+    sampler_common::constraints::PolygonGrid(constraints.drivable_polygons, grid_resolution);
 }
 
 frenet_planner::SamplingParameters prepareSamplingParameters(
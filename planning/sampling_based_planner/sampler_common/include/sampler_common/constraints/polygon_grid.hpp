@@ -0,0 +1,65 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SAMPLER_COMMON__CONSTRAINTS__POLYGON_GRID_HPP_
+#define SAMPLER_COMMON__CONSTRAINTS__POLYGON_GRID_HPP_
+
+#include "tier4_autoware_utils/geometry/boost_geometry.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace sampler_common::constraints
+{
+/// @brief grid classifying its cells against a set of polygons
+/// @details cells that do not touch the boundary of any polygon are entirely inside or entirely
+/// outside the polygons, so a point in such cell is classified with a single lookup. Only the
+/// points in the cells touching a boundary need an exact point-in-polygon test.
+class PolygonGrid
+{
+public:
+  enum class Cell : uint8_t { Outside, Inside, Boundary };
+
+  PolygonGrid() = default;
+  /// @brief build the grid of the given polygons
+  /// @param polygons polygons to classify the cells against
+  /// @param resolution size of the cells [m]
+  /// @param max_cell_num the grid is left empty if it would need more cells than this
+  PolygonGrid(
+    const tier4_autoware_utils::MultiPolygon2d & polygons, const double resolution,
+    const size_t max_cell_num = 4000000);
+
+  /// @brief true if the grid was not built, in which case it cannot be used
+  [[nodiscard]] bool empty() const { return cells_.empty(); }
+  /// @brief get the classification of the cell containing the given point
+  /// @details points outside of the grid are outside of all polygons
+  [[nodiscard]] Cell getCell(const tier4_autoware_utils::Point2d & p) const;
+
+private:
+  [[nodiscard]] size_t toIndex(const int64_t ix, const int64_t iy) const
+  {
+    return static_cast<size_t>(iy) * width_ + static_cast<size_t>(ix);
+  }
+
+  double resolution_{};
+  double min_x_{};
+  double min_y_{};
+  size_t width_{};
+  size_t height_{};
+  std::vector<Cell> cells_;
+};
+}  // namespace sampler_common::constraints
+
+#endif  // SAMPLER_COMMON__CONSTRAINTS__POLYGON_GRID_HPP_
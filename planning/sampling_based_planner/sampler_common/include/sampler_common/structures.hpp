@@ -15,6 +15,7 @@
 #ifndef SAMPLER_COMMON__STRUCTURES_HPP_
 #define SAMPLER_COMMON__STRUCTURES_HPP_
 
+#include "sampler_common/constraints/polygon_grid.hpp"
 #include "tier4_autoware_utils/geometry/boost_geometry.hpp"
 
 #include <eigen3/Eigen/Core>
@@ -339,6 +340,9 @@ struct Constraints
   MultiPolygon2d obstacle_polygons;
   MultiPolygon2d drivable_polygons;
   std::vector<DynamicObstacle> dynamic_obstacles;
+  // optional grids of the polygons used to skip most point-in-polygon tests (empty: not used)
+  constraints::PolygonGrid obstacle_grid;
+  constraints::PolygonGrid drivable_grid;
 };
 
 struct ReusableTrajectory
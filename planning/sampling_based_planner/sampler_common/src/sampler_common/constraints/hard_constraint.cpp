@@ -38,15 +38,45 @@ bool has_collision(const MultiPoint2d & footprint, const MultiPolygon2d & obstac
   return false;
 }
 
+bool has_collision(
+  const MultiPoint2d & footprint, const MultiPolygon2d & obstacles, const PolygonGrid & grid)
+{
+  if (grid.empty()) return has_collision(footprint, obstacles);
+  for (const auto & p : footprint) {
+    const auto cell = grid.getCell(p);
+    if (cell == PolygonGrid::Cell::Inside) return true;
+    if (cell == PolygonGrid::Cell::Boundary)
+      for (const auto & o : obstacles)
+        if (boost::geometry::within(p, o)) return true;
+  }
+  return false;
+}
+
+bool is_within(
+  const MultiPoint2d & footprint, const MultiPolygon2d & polygons, const PolygonGrid & grid)
+{
+  if (!grid.empty()) {
+    bool is_all_inside = true;
+    for (const auto & p : footprint) {
+      const auto cell = grid.getCell(p);
+      if (cell == PolygonGrid::Cell::Outside) return false;
+      if (cell == PolygonGrid::Cell::Boundary) is_all_inside = false;
+    }
+    if (is_all_inside) return true;
+  }
+  return boost::geometry::within(footprint, polygons);
+}
+
 MultiPoint2d checkHardConstraints(Path & path, const Constraints & constraints)
 {
   const auto footprint = buildFootprintPoints(path, constraints);
   if (!footprint.empty()) {
-    if (!boost::geometry::within(footprint, constraints.drivable_polygons)) {
+    if (!is_within(footprint, constraints.drivable_polygons, constraints.drivable_grid)) {
       path.constraint_results.drivable_area = false;
     }
   }
-  path.constraint_results.collision = !has_collision(footprint, constraints.obstacle_polygons);
+  path.constraint_results.collision =
+    !has_collision(footprint, constraints.obstacle_polygons, constraints.obstacle_grid);
   if (!satisfyMinMax(
         path.curvatures, constraints.hard.min_curvature, constraints.hard.max_curvature)) {
     path.constraint_results.curvature = false;
@@ -0,0 +1,145 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "sampler_common/constraints/polygon_grid.hpp"
+
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+namespace sampler_common::constraints
+{
+namespace
+{
+double squaredDistanceToSegment(
+  const double x, const double y, const tier4_autoware_utils::Point2d & p1,
+  const tier4_autoware_utils::Point2d & p2)
+{
+  const auto dx = p2.x() - p1.x();
+  const auto dy = p2.y() - p1.y();
+  const auto squared_length = dx * dx + dy * dy;
+  const auto ratio =
+    squared_length == 0.0
+      ? 0.0
+      : std::clamp(((x - p1.x()) * dx + (y - p1.y()) * dy) / squared_length, 0.0, 1.0);
+  const auto px = p1.x() + ratio * dx - x;
+  const auto py = p1.y() + ratio * dy - y;
+  return px * px + py * py;
+}
+}  // namespace
+
+PolygonGrid::PolygonGrid(
+  const tier4_autoware_utils::MultiPolygon2d & polygons, const double resolution,
+  const size_t max_cell_num)
+{
+  if (polygons.empty() || !(resolution > 0.0)) return;
+  const auto box = boost::geometry::return_envelope<tier4_autoware_utils::Box2d>(polygons);
+  // one cell of margin so that the cells on the border of the grid are outside of the polygons
+  min_x_ = box.min_corner().x() - resolution;
+  min_y_ = box.min_corner().y() - resolution;
+  const auto width = std::ceil((box.max_corner().x() + resolution - min_x_) / resolution);
+  const auto height = std::ceil((box.max_corner().y() + resolution - min_y_) / resolution);
+  if (!(width * height <= static_cast<double>(max_cell_num))) return;
+  resolution_ = resolution;
+  width_ = static_cast<size_t>(width);
+  height_ = static_cast<size_t>(height);
+
+  // mark the cells touching a polygon boundary: the cell is inside the circle of radius half its
+  // diagonal around its center, so a cell farther than that from all segments does not touch them
+  constexpr auto unknown = static_cast<Cell>(0xff);
+  std::vector<Cell> cells(width_ * height_, unknown);
+  const auto half_diagonal = resolution_ * M_SQRT1_2 * (1.0 + 1e-6);
+  const auto mark_segment = [&](const auto & p1, const auto & p2) {
+    const auto to_cell_index = [&](const double v, const double min, const size_t size) {
+      return std::clamp<int64_t>(
+        static_cast<int64_t>(std::floor((v - min) / resolution_)), 0,
+        static_cast<int64_t>(size) - 1);
+    };
+    const auto ix_begin = to_cell_index(std::min(p1.x(), p2.x()) - resolution_, min_x_, width_);
+    const auto ix_end = to_cell_index(std::max(p1.x(), p2.x()) + resolution_, min_x_, width_);
+    const auto iy_begin = to_cell_index(std::min(p1.y(), p2.y()) - resolution_, min_y_, height_);
+    const auto iy_end = to_cell_index(std::max(p1.y(), p2.y()) + resolution_, min_y_, height_);
+    for (auto iy = iy_begin; iy <= iy_end; ++iy) {
+      const auto y = min_y_ + (static_cast<double>(iy) + 0.5) * resolution_;
+      for (auto ix = ix_begin; ix <= ix_end; ++ix) {
+        const auto x = min_x_ + (static_cast<double>(ix) + 0.5) * resolution_;
+        if (squaredDistanceToSegment(x, y, p1, p2) <= half_diagonal * half_diagonal) {
+          cells[toIndex(ix, iy)] = Cell::Boundary;
+        }
+      }
+    }
+  };
+  const auto mark_ring = [&](const auto & ring) {
+    for (size_t i = 0; i + 1 < ring.size(); ++i) mark_segment(ring[i], ring[i + 1]);
+    // the ring may not be closed
+    if (ring.size() > 1) mark_segment(ring.back(), ring.front());
+  };
+  for (const auto & polygon : polygons) {
+    mark_ring(polygon.outer());
+    for (const auto & inner : polygon.inners()) mark_ring(inner);
+  }
+
+  // the connected cells not touching a boundary are all inside or all outside of the polygons,
+  // which is decided by the center of one of them
+  std::vector<std::pair<int64_t, int64_t>> stack;
+  for (size_t start = 0; start < cells.size(); ++start) {
+    if (cells[start] != unknown) continue;
+    const auto start_ix = static_cast<int64_t>(start % width_);
+    const auto start_iy = static_cast<int64_t>(start / width_);
+    const tier4_autoware_utils::Point2d center(
+      min_x_ + (static_cast<double>(start_ix) + 0.5) * resolution_,
+      min_y_ + (static_cast<double>(start_iy) + 0.5) * resolution_);
+    const auto is_inside = std::any_of(polygons.begin(), polygons.end(), [&](const auto & polygon) {
+      return boost::geometry::within(center, polygon);
+    });
+    const auto status = is_inside ? Cell::Inside : Cell::Outside;
+    cells[start] = status;
+    stack.emplace_back(start_ix, start_iy);
+    while (!stack.empty()) {
+      const auto [ix, iy] = stack.back();
+      stack.pop_back();
+      const auto visit = [&](const int64_t nx, const int64_t ny) {
+        if (
+          nx < 0 || ny < 0 || nx >= static_cast<int64_t>(width_) ||
+          ny >= static_cast<int64_t>(height_))
+          return;
+        auto & cell = cells[toIndex(nx, ny)];
+        if (cell != unknown) return;
+        cell = status;
+        stack.emplace_back(nx, ny);
+      };
+      visit(ix - 1, iy);
+      visit(ix + 1, iy);
+      visit(ix, iy - 1);
+      visit(ix, iy + 1);
+    }
+  }
+  cells_ = std::move(cells);
+}
+
+PolygonGrid::Cell PolygonGrid::getCell(const tier4_autoware_utils::Point2d & p) const
+{
+  if (cells_.empty()) return Cell::Boundary;
+  const auto ix = std::floor((p.x() - min_x_) / resolution_);
+  const auto iy = std::floor((p.y() - min_y_) / resolution_);
+  if (
+    !(ix >= 0.0 && iy >= 0.0 && ix < static_cast<double>(width_) &&
+      iy < static_cast<double>(height_)))
+    return Cell::Outside;
+  return cells_[toIndex(static_cast<int64_t>(ix), static_cast<int64_t>(iy))];
+}
+}  // namespace sampler_common::constraints
@@ -0,0 +1,72 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include <sampler_common/constraints/polygon_grid.hpp>
+
+#include <gtest/gtest.h>
+
+#include <boost/geometry/algorithms/correct.hpp>
+#include <boost/geometry/algorithms/within.hpp>
+
+#include <algorithm>
+#include <random>
+
+TEST(PolygonGrid, classifyPoints)
+{
+  using sampler_common::constraints::PolygonGrid;
+  using tier4_autoware_utils::MultiPolygon2d;
+  using tier4_autoware_utils::Point2d;
+  using tier4_autoware_utils::Polygon2d;
+
+  MultiPolygon2d polygons;
+  // concave polygon with a hole
+  Polygon2d polygon;
+  polygon.outer() = {{0, 0}, {0, 10}, {4, 10}, {4, 4}, {10, 4}, {10, 0}, {0, 0}};
+  polygon.inners().push_back({{1.0, 1.0}, {2.0, 1.0}, {2.0, 2.3}, {1.0, 2.3}, {1.0, 1.0}});
+  boost::geometry::correct(polygon);
+  polygons.push_back(polygon);
+  // rotated square
+  Polygon2d square;
+  square.outer() = {{15, 3}, {18, 6}, {15, 9}, {12, 6}, {15, 3}};
+  boost::geometry::correct(square);
+  polygons.push_back(square);
+
+  const PolygonGrid grid(polygons, 0.5);
+  ASSERT_FALSE(grid.empty());
+
+  std::mt19937 gen(0);
+  std::uniform_real_distribution<double> distr_x(-5.0, 25.0);
+  std::uniform_real_distribution<double> distr_y(-5.0, 15.0);
+  size_t boundary_num = 0;
+  for (size_t i = 0; i < 20000; ++i) {
+    const Point2d p(distr_x(gen), distr_y(gen));
+    const auto is_within = std::any_of(polygons.begin(), polygons.end(), [&](const auto & polygon) {
+      return boost::geometry::within(p, polygon);
+    });
+    const auto cell = grid.getCell(p);
+    if (cell == PolygonGrid::Cell::Inside) {
+      EXPECT_TRUE(is_within);
+    } else if (cell == PolygonGrid::Cell::Outside) {
+      EXPECT_FALSE(is_within);
+    } else {
+      ++boundary_num;
+    }
+  }
+  // most points are classified without testing the polygons
+  EXPECT_LT(boundary_num, 20000UL / 4);
+
+  // empty grids
+  EXPECT_TRUE(PolygonGrid(MultiPolygon2d{}, 0.5).empty());
+  EXPECT_TRUE(PolygonGrid(polygons, 0.5, 10).empty());
+}
@@ -33,6 +33,8 @@
 
 #include <boost/geometry/algorithms/correct.hpp>
 #include <boost/geometry/algorithms/distance.hpp>
+#include <boost/geometry/algorithms/envelope.hpp>
+#include <boost/geometry/index/rtree.hpp>
 
 #include <lanelet2_core/LaneletMap.h>
 #include <lanelet2_core/geometry/Lanelet.h>
@@ -43,12 +45,18 @@
 #include <limits>
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace static_centerline_optimizer
 {
 namespace
 {
+using tier4_autoware_utils::Box2d;
+using tier4_autoware_utils::Segment2d;
+using SegmentRtree =
+  boost::geometry::index::rtree<std::pair<Box2d, Segment2d>, boost::geometry::index::rstar<16>>;
+
 Path convert_to_path(const PathWithLaneId & path_with_lane_id)
 {
   Path path;
@@ -185,6 +193,43 @@ std::vector<unsigned int> check_lanelet_connection(
 
   return unconnected_lane_ids;
 }
+
+SegmentRtree create_segment_rtree(const LineString2d & line)
+{
+  std::vector<std::pair<Box2d, Segment2d>> segments;
+  for (size_t i = 0; i + 1 < line.size(); ++i) {
+    const Segment2d segment(line.at(i), line.at(i + 1));
+    segments.emplace_back(boost::geometry::return_envelope<Box2d>(segment), segment);
+  }
+  if (line.size() == 1) {
+    const Segment2d segment(line.front(), line.front());
+    segments.emplace_back(boost::geometry::return_envelope<Box2d>(segment), segment);
+  }
+  // the packing algorithm is used to build the rtree at once
+  return SegmentRtree(segments.begin(), segments.end());
+}
+
+// same as the distance between the footprint and the whole line whose segments are in the rtree
+double calc_distance(const LinearRing2d & footprint, const SegmentRtree & segment_rtree)
+{
+  double min_dist = std::numeric_limits<double>::max();
+  if (segment_rtree.empty()) {
+    return min_dist;
+  }
+
+  // the segments are visited in ascending order of the distance between the bounding boxes,
+  // which is a lower bound of the distance between the footprint and the segment
+  const auto footprint_box = boost::geometry::return_envelope<Box2d>(footprint);
+  for (auto itr = segment_rtree.qbegin(
+         boost::geometry::index::nearest(footprint_box, segment_rtree.size()));
+       itr != segment_rtree.qend(); ++itr) {
+    if (min_dist < boost::geometry::distance(itr->first, footprint_box)) {
+      break;
+    }
+    min_dist = std::min(min_dist, boost::geometry::distance(footprint, itr->second));
+  }
+  return min_dist;
+}
 }  // namespace
 
 StaticCenterlineOptimizerNode::StaticCenterlineOptimizerNode(
@@ -527,6 +572,11 @@ void StaticCenterlineOptimizerNode::evaluate(
     }
   }
 
+  // index the segments of the bounds, which may cover the whole map, to find the ones close to
+  // each footprint
+  const auto right_bound_rtree = create_segment_rtree(right_bound);
+  const auto left_bound_rtree = create_segment_rtree(left_bound);
+
   // calculate the distance between footprint and right/left bounds
   MarkerArray marker_array;
   double min_dist = std::numeric_limits<double>::max();
@@ -535,8 +585,8 @@ void StaticCenterlineOptimizerNode::evaluate(
 
     const auto footprint_poly = create_vehicle_footprint(traj_point.pose, vehicle_info_);
 
-    const double dist_to_right = boost::geometry::distance(footprint_poly, right_bound);
-    const double dist_to_left = boost::geometry::distance(footprint_poly, left_bound);
+    const double dist_to_right = calc_distance(footprint_poly, right_bound_rtree);
+    const double dist_to_left = calc_distance(footprint_poly, left_bound_rtree);
     const double min_dist_to_bound = std::min(dist_to_right, dist_to_left);
 
     if (min_dist_to_bound < min_dist) {
@@ -68,34 +68,36 @@ Trajectory SuccessiveTrajectoryOptimizer::on_centerline(const Path & path)
   const size_t initial_index = 3;
   std::vector<TrajectoryPoint> whole_optimized_traj_points;
 
+  // the input of the optimization is the same for all the segments except for the ego pose
+  obstacle_avoidance_planner::PlannerData planner_data;
+  planner_data.traj_points = resampled_traj_points;
+  planner_data.left_bound = path.left_bound;
+  planner_data.right_bound = path.right_bound;
+
   for (size_t i = 0; i < path_segment_num; ++i) {
     // calculate initial pose to start optimization
-    const auto initial_pose =
+    planner_data.ego_pose =
       resampled_path.points.at(initial_index + valid_optimized_path_length / resample_interval * i)
         .pose;
 
-    // create planner data
-    obstacle_avoidance_planner::PlannerData planner_data;
-    planner_data.traj_points = resampled_traj_points;
-    planner_data.left_bound = path.left_bound;
-    planner_data.right_bound = path.right_bound;
-    planner_data.ego_pose = initial_pose;
-
     const auto optimized_traj_points = optimizeTrajectory(planner_data);
+    if (optimized_traj_points.empty()) {
+      continue;
+    }
 
+    // cut the whole trajectory just before the first point close to the start of the new segment
     for (size_t j = 0; j < whole_optimized_traj_points.size(); ++j) {
       const double dist = tier4_autoware_utils::calcDistance2d(
         whole_optimized_traj_points.at(j), optimized_traj_points.front());
       if (dist < 0.5) {
-        const std::vector<TrajectoryPoint> extracted_whole_optimized_traj_points{
-          whole_optimized_traj_points.begin(), whole_optimized_traj_points.begin() + j - 1};
-        whole_optimized_traj_points = extracted_whole_optimized_traj_points;
+        whole_optimized_traj_points.resize(j == 0 ? 0 : j - 1);
+        break;
       }
     }
 
-    for (size_t j = 0; j < optimized_traj_points.size(); ++j) {
-      whole_optimized_traj_points.push_back(optimized_traj_points.at(j));
-    }
+    whole_optimized_traj_points.insert(
+      whole_optimized_traj_points.end(), optimized_traj_points.begin(),
+      optimized_traj_points.end());
   }
 
   // resample
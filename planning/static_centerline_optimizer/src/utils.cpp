@@ -105,11 +105,12 @@ void update_centerline(
 {
   // get lanelet as reference to update centerline
   lanelet::Lanelets lanelets_ref;
+  auto & lanelet_layer = route_handler.getLaneletMapPtr()->laneletLayer;
   for (const auto & lanelet : lanelets) {
-    for (auto & lanelet_ref : route_handler.getLaneletMapPtr()->laneletLayer) {
-      if (lanelet_ref.id() == lanelet.id()) {
-        lanelets_ref.push_back(lanelet_ref);
-      }
+    // the layer is looked up by id instead of being scanned for each lanelet of the route
+    const auto lanelet_itr = lanelet_layer.find(lanelet.id());
+    if (lanelet_itr != lanelet_layer.end()) {
+      lanelets_ref.push_back(*lanelet_itr);
     }
   }
 
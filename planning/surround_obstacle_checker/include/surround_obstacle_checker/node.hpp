@@ -33,6 +33,9 @@
 
 #include <boost/optional/optional.hpp>
 
+#include <pcl/point_cloud.h>
+#include <pcl/point_types.h>
+
 #include <tf2/utils.h>
 #include <tf2_ros/buffer.h>
 #include <tf2_ros/transform_listener.h>
@@ -136,6 +139,10 @@ private:
   sensor_msgs::msg::PointCloud2::ConstSharedPtr pointcloud_ptr_;
   PredictedObjects::ConstSharedPtr object_ptr_;
 
+  // pointcloud in base_link, which is kept until the next pointcloud is received
+  mutable sensor_msgs::msg::PointCloud2::ConstSharedPtr transformed_pointcloud_source_ptr_;
+  mutable pcl::PointCloud<pcl::PointXYZ> transformed_pointcloud_;
+
   // State Machine
   State state_ = State::PASS;
   std::shared_ptr<const rclcpp::Time> last_obstacle_found_time_;
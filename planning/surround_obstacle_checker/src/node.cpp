@@ -36,6 +36,7 @@
 #endif
 
 #include <algorithm>
+#include <cmath>
 #include <functional>
 #include <limits>
 #include <memory>
@@ -50,6 +51,7 @@ namespace surround_obstacle_checker
 namespace bg = boost::geometry;
 using Point2d = bg::model::d2::point_xy<double>;
 using Polygon2d = bg::model::polygon<Point2d>;
+using Box2d = bg::model::box<Point2d>;
 using autoware_auto_perception_msgs::msg::ObjectClassification;
 using tier4_autoware_utils::createPoint;
 using tier4_autoware_utils::pose2transform;
@@ -418,36 +420,51 @@ boost::optional<Obstacle> SurroundObstacleCheckerNode::getNearestObstacleByPoint
     return boost::none;
   }
 
-  const auto transform_stamped =
-    getTransform("base_link", pointcloud_ptr_->header.frame_id, pointcloud_ptr_->header.stamp, 0.5);
+  // the pointcloud is transformed once per message since the timer runs faster than the sensor
+  if (transformed_pointcloud_source_ptr_ != pointcloud_ptr_) {
+    const auto transform_stamped = getTransform(
+      "base_link", pointcloud_ptr_->header.frame_id, pointcloud_ptr_->header.stamp, 0.5);
 
-  if (!transform_stamped) {
-    return {};
-  }
+    if (!transform_stamped) {
+      return {};
+    }
 
-  Eigen::Affine3f isometry = tf2::transformToEigen(transform_stamped.get().transform).cast<float>();
-  pcl::PointCloud<pcl::PointXYZ> transformed_pointcloud;
-  pcl::fromROSMsg(*pointcloud_ptr_, transformed_pointcloud);
-  tier4_autoware_utils::transformPointCloud(
-    transformed_pointcloud, transformed_pointcloud, isometry);
+    Eigen::Affine3f isometry =
+      tf2::transformToEigen(transform_stamped.get().transform).cast<float>();
+    pcl::fromROSMsg(*pointcloud_ptr_, transformed_pointcloud_);
+    tier4_autoware_utils::transformPointCloud(
+      transformed_pointcloud_, transformed_pointcloud_, isometry);
+    transformed_pointcloud_source_ptr_ = pointcloud_ptr_;
+  }
 
   const double front_margin = node_param_.pointcloud_surround_check_front_distance;
   const double side_margin = node_param_.pointcloud_surround_check_side_distance;
   const double back_margin = node_param_.pointcloud_surround_check_back_distance;
   const auto ego_polygon = createSelfPolygon(vehicle_info_, front_margin, side_margin, back_margin);
 
+  // the ego polygon is a rectangle aligned with the axes of base_link, so the distance to a point
+  // is calculated with its bounding box
+  const auto ego_box = bg::return_envelope<Box2d>(ego_polygon);
+
   geometry_msgs::msg::Point nearest_point;
   double minimum_distance = std::numeric_limits<double>::max();
   bool was_minimum_distance_updated = false;
-  for (const auto & p : transformed_pointcloud) {
-    Point2d boost_point(p.x, p.y);
-
-    const auto distance_to_object = bg::distance(ego_polygon, boost_point);
+  for (const auto & p : transformed_pointcloud_) {
+    const double dx =
+      std::max({ego_box.min_corner().x() - p.x, 0.0, p.x - ego_box.max_corner().x()});
+    const double dy =
+      std::max({ego_box.min_corner().y() - p.y, 0.0, p.y - ego_box.max_corner().y()});
+    const auto distance_to_object = std::hypot(dx, dy);
 
     if (distance_to_object < minimum_distance) {
       nearest_point = createPoint(p.x, p.y, p.z);
       minimum_distance = distance_to_object;
       was_minimum_distance_updated = true;
+
+      // no point is nearer than the one inside the ego polygon
+      if (minimum_distance <= 0.0) {
+        break;
+      }
     }
   }
 
@@ -504,6 +521,11 @@ boost::optional<Obstacle> SurroundObstacleCheckerNode::getNearestObstacleByDynam
       nearest_point = object_pose.position;
       minimum_distance = distance_to_object;
       was_minimum_distance_updated = true;
+
+      // no object is nearer than the one overlapping the ego polygon
+      if (minimum_distance <= 0.0) {
+        break;
+      }
     }
   }
 
@@ -34,9 +34,11 @@
 #include <tf2_geometry_msgs/tf2_geometry_msgs.hpp>
 #endif
 
+#include <lanelet2_io/Projection.h>
 #include <tf2_ros/transform_broadcaster.h>
 #include <tf2_ros/transform_listener.h>
 
+#include <memory>
 #include <string>
 
 namespace gnss_poser
@@ -89,6 +91,8 @@ private:
   rclcpp::Publisher<tier4_debug_msgs::msg::BoolStamped>::SharedPtr fixed_pub_;
 
   MapProjectorInfo::Message projector_info_;
+  // created once for the projector info, instead of for each fix
+  std::unique_ptr<lanelet::Projector> projector_;
   std::string base_frame_;
   std::string gnss_frame_;
   std::string gnss_base_frame_;
@@ -15,6 +15,7 @@
 #include "gnss_poser/gnss_poser_core.hpp"
 
 #include <geography_utils/height.hpp>
+#include <geography_utils/lanelet2_projector.hpp>
 #include <geography_utils/projection.hpp>
 
 #include <autoware_sensing_msgs/msg/gnss_ins_orientation_stamped.hpp>
@@ -64,6 +65,7 @@ GNSSPoser::GNSSPoser(const rclcpp::NodeOptions & node_options)
 void GNSSPoser::callbackMapProjectorInfo(const MapProjectorInfo::Message::ConstSharedPtr msg)
 {
   projector_info_ = *msg;
+  projector_ = geography_utils::get_lanelet2_projector(projector_info_);
   received_map_projector_info_ = true;
 }
 
@@ -100,7 +102,8 @@ void GNSSPoser::callbackNavSatFix(
   gps_point.latitude = nav_sat_fix_msg_ptr->latitude;
   gps_point.longitude = nav_sat_fix_msg_ptr->longitude;
   gps_point.altitude = nav_sat_fix_msg_ptr->altitude;
-  geometry_msgs::msg::Point position = geography_utils::project_forward(gps_point, projector_info_);
+  geometry_msgs::msg::Point position =
+    geography_utils::project_forward(gps_point, projector_info_, *projector_);
   position.z = geography_utils::convert_height(
     position.z, gps_point.latitude, gps_point.longitude, MapProjectorInfo::Message::WGS84,
     projector_info_.vertical_datum);
@@ -209,18 +212,25 @@ bool GNSSPoser::canGetCovariance(const sensor_msgs::msg::NavSatFix & nav_sat_fix
 geometry_msgs::msg::Point GNSSPoser::getMedianPosition(
   const boost::circular_buffer<geometry_msgs::msg::Point> & position_buffer)
 {
-  auto getMedian = [](std::vector<double> array) {
-    std::sort(std::begin(array), std::end(array));
+  // partial sort, which is linear, instead of sorting all the elements
+  auto getMedian = [](std::vector<double> & array) {
     const size_t median_index = array.size() / 2;
-    double median = (array.size() % 2)
-                      ? (array.at(median_index))
-                      : ((array.at(median_index) + array.at(median_index - 1)) / 2);
-    return median;
+    std::nth_element(array.begin(), array.begin() + median_index, array.end());
+    const double upper_median = array.at(median_index);
+    if (array.size() % 2) {
+      return upper_median;
+    }
+    // the lower median is the largest of the elements before the upper median
+    const double lower_median = *std::max_element(array.begin(), array.begin() + median_index);
+    return (upper_median + lower_median) / 2;
   };
 
   std::vector<double> array_x;
   std::vector<double> array_y;
   std::vector<double> array_z;
+  array_x.reserve(position_buffer.size());
+  array_y.reserve(position_buffer.size());
+  array_z.reserve(position_buffer.size());
   for (const auto & position : position_buffer) {
     array_x.push_back(position.x);
     array_y.push_back(position.y);
@@ -53,12 +53,6 @@
 
 #include <sensor_msgs/image_encodings.hpp>
 
-#if __has_include(<cv_bridge/cv_bridge.hpp>)
-#include <cv_bridge/cv_bridge.hpp>
-#else
-#include <cv_bridge/cv_bridge.h>
-#endif
-
 #include <limits>
 #include <memory>
 #include <string>
@@ -81,32 +75,32 @@ ImageTransportDecompressor::ImageTransportDecompressor(const rclcpp::NodeOptions
 void ImageTransportDecompressor::onCompressedImage(
   const sensor_msgs::msg::CompressedImage::ConstSharedPtr input_compressed_image_msg)
 {
-  cv_bridge::CvImagePtr cv_ptr(new cv_bridge::CvImage);
-  // Copy message header
-  cv_ptr->header = input_compressed_image_msg->header;
+  cv::Mat image;
+  std::string image_encoding;
+  int color_conversion = -1;
 
   // Decode color/mono image
   try {
-    cv_ptr->image = cv::imdecode(cv::Mat(input_compressed_image_msg->data), cv::IMREAD_COLOR);
+    // The buffer is reused while the image size does not change
+    image = cv::imdecode(
+      cv::Mat(input_compressed_image_msg->data), cv::IMREAD_COLOR, &decode_buffer_);
 
     // Assign image encoding string
     const size_t split_pos = input_compressed_image_msg->format.find(';');
     if (split_pos == std::string::npos) {
       // Older version of compressed_image_transport does not signal image format
-      switch (cv_ptr->image.channels()) {
+      switch (image.channels()) {
         case 1:
-          cv_ptr->encoding = sensor_msgs::image_encodings::MONO8;
+          image_encoding = sensor_msgs::image_encodings::MONO8;
           break;
         case 3:
-          cv_ptr->encoding = sensor_msgs::image_encodings::BGR8;
+          image_encoding = sensor_msgs::image_encodings::BGR8;
           break;
         default:
-          RCLCPP_ERROR(
-            get_logger(), "Unsupported number of channels: %i", cv_ptr->image.channels());
+          RCLCPP_ERROR(get_logger(), "Unsupported number of channels: %i", image.channels());
           break;
       }
     } else {
-      std::string image_encoding;
       if (encoding_ == std::string("default")) {
         image_encoding = input_compressed_image_msg->format.substr(0, split_pos);
       } else if (encoding_ == std::string("rgb8")) {
@@ -117,8 +111,6 @@ void ImageTransportDecompressor::onCompressedImage(
         image_encoding = input_compressed_image_msg->format.substr(0, split_pos);
       }
 
-      cv_ptr->encoding = image_encoding;
-
       if (sensor_msgs::image_encodings::isColor(image_encoding)) {
         std::string compressed_encoding = input_compressed_image_msg->format.substr(split_pos);
         bool compressed_bgr_image =
@@ -130,52 +122,79 @@ void ImageTransportDecompressor::onCompressedImage(
           if (
             (image_encoding == sensor_msgs::image_encodings::RGB8) ||
             (image_encoding == sensor_msgs::image_encodings::RGB16)) {
-            cv::cvtColor(cv_ptr->image, cv_ptr->image, CV_BGR2RGB);
+            color_conversion = cv::COLOR_BGR2RGB;
           }
 
           if (
             (image_encoding == sensor_msgs::image_encodings::RGBA8) ||
             (image_encoding == sensor_msgs::image_encodings::RGBA16)) {
-            cv::cvtColor(cv_ptr->image, cv_ptr->image, CV_BGR2RGBA);
+            color_conversion = cv::COLOR_BGR2RGBA;
           }
 
           if (
             (image_encoding == sensor_msgs::image_encodings::BGRA8) ||
             (image_encoding == sensor_msgs::image_encodings::BGRA16)) {
-            cv::cvtColor(cv_ptr->image, cv_ptr->image, CV_BGR2BGRA);
+            color_conversion = cv::COLOR_BGR2BGRA;
           }
         } else {
           // if necessary convert colors from rgb to bgr
           if (
             (image_encoding == sensor_msgs::image_encodings::BGR8) ||
             (image_encoding == sensor_msgs::image_encodings::BGR16)) {
-            cv::cvtColor(cv_ptr->image, cv_ptr->image, CV_RGB2BGR);
+            color_conversion = cv::COLOR_RGB2BGR;
           }
 
           if (
             (image_encoding == sensor_msgs::image_encodings::BGRA8) ||
             (image_encoding == sensor_msgs::image_encodings::BGRA16)) {
-            cv::cvtColor(cv_ptr->image, cv_ptr->image, CV_RGB2BGRA);
+            color_conversion = cv::COLOR_RGB2BGRA;
           }
 
           if (
             (image_encoding == sensor_msgs::image_encodings::RGBA8) ||
             (image_encoding == sensor_msgs::image_encodings::RGBA16)) {
-            cv::cvtColor(cv_ptr->image, cv_ptr->image, CV_RGB2RGBA);
+            color_conversion = cv::COLOR_RGB2RGBA;
           }
         }
       }
     }
   } catch (cv::Exception & e) {
     RCLCPP_ERROR(get_logger(), "%s", e.what());
+    return;
   }
 
-  size_t rows = cv_ptr->image.rows;
-  size_t cols = cv_ptr->image.cols;
+  size_t rows = image.rows;
+  size_t cols = image.cols;
 
   if ((rows > 0) && (cols > 0)) {
+    const bool has_alpha =
+      (color_conversion == cv::COLOR_BGR2RGBA || color_conversion == cv::COLOR_BGR2BGRA ||
+       color_conversion == cv::COLOR_RGB2BGRA || color_conversion == cv::COLOR_RGB2RGBA);
+    const int type = has_alpha ? CV_MAKETYPE(image.depth(), 4) : image.type();
+
+    auto image_ptr = std::make_unique<sensor_msgs::msg::Image>();
+    image_ptr->header = input_compressed_image_msg->header;
+    image_ptr->height = rows;
+    image_ptr->width = cols;
+    image_ptr->encoding = image_encoding;
+    image_ptr->is_bigendian = false;
+    image_ptr->step = cols * CV_ELEM_SIZE(type);
+    image_ptr->data.resize(image_ptr->step * rows);
+
+    // Write the image into the message directly
+    cv::Mat output(rows, cols, type, image_ptr->data.data(), image_ptr->step);
+    try {
+      if (color_conversion < 0) {
+        image.copyTo(output);
+      } else {
+        cv::cvtColor(image, output, color_conversion);
+      }
+    } catch (cv::Exception & e) {
+      RCLCPP_ERROR(get_logger(), "%s", e.what());
+      return;
+    }
+
     // Publish message to user callback
-    auto image_ptr = std::make_unique<sensor_msgs::msg::Image>(*cv_ptr->toImageMsg());
     raw_image_pub_->publish(std::move(image_ptr));
   }
 }
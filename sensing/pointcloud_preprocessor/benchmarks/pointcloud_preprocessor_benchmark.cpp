@@ -0,0 +1,261 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Runs the faster_filter of the preprocessing stages over deterministic 32/64/128-beam spinning
+// LiDAR fixtures, and prints one CSV line per stage and fixture:
+//   stage, beams, points, p50_us, p99_us, mpoints_per_s, allocs_per_call
+// Usage: pointcloud_preprocessor_benchmark [iterations]
+
+#include "autoware_point_types/types.hpp"
+#include "pointcloud_preprocessor/crop_box_filter/crop_box_filter_nodelet.hpp"
+#include "pointcloud_preprocessor/distortion_corrector/velocity_history.hpp"
+#include "pointcloud_preprocessor/downsample_filter/voxel_grid_downsample_filter_nodelet.hpp"
+#include "pointcloud_preprocessor/outlier_filter/ring_outlier_filter_nodelet.hpp"
+
+#include <point_cloud_msg_wrapper/point_cloud_msg_wrapper.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+#include <functional>
+#include <memory>
+#include <new>
+#include <random>
+#include <string>
+#include <vector>
+
+namespace
+{
+std::atomic<std::size_t> g_num_allocations{0};
+}  // namespace
+
+// Count the heap allocations of the whole process, to report the allocations per call
+void * operator new(std::size_t size)
+{
+  g_num_allocations.fetch_add(1, std::memory_order_relaxed);
+  if (void * ptr = std::malloc(size)) {
+    return ptr;
+  }
+  throw std::bad_alloc();
+}
+
+void operator delete(void * ptr) noexcept
+{
+  std::free(ptr);
+}
+
+void operator delete(void * ptr, std::size_t) noexcept
+{
+  std::free(ptr);
+}
+
+namespace
+{
+using autoware_point_types::PointXYZIRADRT;
+using sensor_msgs::msg::PointCloud2;
+
+constexpr int NUM_AZIMUTH_STEPS = 1800;  // 0.2 deg horizontal resolution
+constexpr double SCAN_PERIOD = 0.1;
+constexpr int NUM_WARMUP_ITERATIONS = 5;
+
+/**
+ * A spinning LiDAR in a box-shaped street: ground, two walls and sparse noise returns.
+ * The generator is seeded, so that every run and every stage sees the same points.
+ */
+PointCloud2::SharedPtr makeFixture(const int num_beams)
+{
+  std::mt19937 engine(num_beams);
+  std::normal_distribution<float> range_noise(0.0f, 0.02f);
+  std::uniform_real_distribution<float> uniform(0.0f, 1.0f);
+
+  auto msg = std::make_shared<PointCloud2>();
+  point_cloud_msg_wrapper::PointCloud2Modifier<
+    PointXYZIRADRT, autoware_point_types::PointXYZIRADRTGenerator>
+    modifier{*msg, "base_link"};
+  modifier.reserve(num_beams * NUM_AZIMUTH_STEPS);
+
+  constexpr float sensor_height = 2.0f;
+  constexpr float wall_distance = 8.0f;
+  constexpr float max_range = 120.0f;
+  for (int step = 0; step < NUM_AZIMUTH_STEPS; ++step) {
+    const float azimuth = static_cast<float>(step) * 360.0f / NUM_AZIMUTH_STEPS;
+    const float azimuth_rad = azimuth * static_cast<float>(M_PI) / 180.0f;
+    const double time_stamp = SCAN_PERIOD * step / NUM_AZIMUTH_STEPS;
+    for (int ring = 0; ring < num_beams; ++ring) {
+      const float elevation_rad =
+        (-25.0f + 40.0f * ring / std::max(num_beams - 1, 1)) * static_cast<float>(M_PI) / 180.0f;
+      const float dx = std::cos(elevation_rad) * std::cos(azimuth_rad);
+      const float dy = std::cos(elevation_rad) * std::sin(azimuth_rad);
+      const float dz = std::sin(elevation_rad);
+
+      float distance = max_range;
+      if (dz < 0.0f) distance = std::min(distance, sensor_height / -dz);
+      if (std::abs(dy) > 1e-3f) distance = std::min(distance, wall_distance / std::abs(dy));
+      if (uniform(engine) < 0.02f) distance = 0.5f + uniform(engine) * 5.0f;  // rain, dust...
+      if (distance >= max_range) continue;
+      distance += range_noise(engine);
+
+      PointXYZIRADRT point;
+      point.x = distance * dx;
+      point.y = distance * dy;
+      point.z = distance * dz;
+      point.intensity = uniform(engine) * 255.0f;
+      point.ring = static_cast<uint16_t>(ring);
+      point.azimuth = azimuth * 100.0f;
+      point.distance = distance;
+      point.return_type = autoware_point_types::ReturnType::SINGLE_STRONGEST;
+      point.time_stamp = time_stamp;
+      modifier.push_back(point);
+    }
+  }
+  return msg;
+}
+
+struct Result
+{
+  double p50_us;
+  double p99_us;
+  double mpoints_per_s;
+  double allocations_per_call;
+};
+
+Result measure(const std::function<void()> & run, const std::size_t num_points, int iterations)
+{
+  for (int i = 0; i < NUM_WARMUP_ITERATIONS; ++i) {
+    run();
+  }
+
+  std::vector<double> durations_us;
+  durations_us.reserve(iterations);
+  const std::size_t allocations_before = g_num_allocations.load();
+  for (int i = 0; i < iterations; ++i) {
+    const auto start = std::chrono::steady_clock::now();
+    run();
+    const auto end = std::chrono::steady_clock::now();
+    durations_us.push_back(std::chrono::duration<double, std::micro>(end - start).count());
+  }
+  // the durations vector does not grow, so every allocation comes from run()
+  const std::size_t allocations = g_num_allocations.load() - allocations_before;
+
+  double total_us = 0.0;
+  for (const auto d : durations_us) total_us += d;
+  std::sort(durations_us.begin(), durations_us.end());
+  const auto percentile = [&](double p) {
+    return durations_us[std::min(
+      durations_us.size() - 1, static_cast<std::size_t>(p * durations_us.size()))];
+  };
+  return Result{
+    percentile(0.5), percentile(0.99), num_points * iterations / total_us,
+    static_cast<double>(allocations) / iterations};
+}
+
+rclcpp::NodeOptions stageOptions(std::vector<rclcpp::Parameter> parameters)
+{
+  // fused_stage skips the pub/sub setup, so that process_fused_stage() runs faster_filter alone
+  parameters.emplace_back("fused_stage", true);
+  rclcpp::NodeOptions options;
+  options.parameter_overrides(parameters);
+  return options;
+}
+
+struct Stage
+{
+  std::string name;
+  std::function<std::function<void(const PointCloud2::ConstSharedPtr &)>()> make;
+};
+
+template <class FilterT>
+Stage filterStage(const std::string & name, const std::vector<rclcpp::Parameter> & parameters)
+{
+  return Stage{name, [parameters]() {
+                 auto filter = std::make_shared<FilterT>(stageOptions(parameters));
+                 auto output = std::make_shared<PointCloud2>();
+                 return [filter, output](const PointCloud2::ConstSharedPtr & input) {
+                   filter->process_fused_stage(input, *output);
+                 };
+               }};
+}
+
+Stage velocityLookupStage()
+{
+  // The per-point lookup of the distortion corrector, with IMU and twist at 100 Hz
+  return Stage{"distortion_corrector_velocity_lookup", []() {
+                 auto history = std::make_shared<pointcloud_preprocessor::VelocityHistory>(1.0);
+                 for (int i = 0; i <= 100; ++i) {
+                   history->push(0.01 * i, 10.0f, 0.1f);
+                 }
+                 return [history](const PointCloud2::ConstSharedPtr & input) {
+                   const auto * points =
+                     reinterpret_cast<const PointXYZIRADRT *>(input->data.data());
+                   const std::size_t num_points = input->width * input->height;
+                   float sum = 0.0f;
+                   for (std::size_t i = 0; i < num_points; ++i) {
+                     sum += history->linearX(history->find(0.9 + points[i].time_stamp));
+                   }
+                   volatile float sink = sum;
+                   (void)sink;
+                 };
+               }};
+}
+}  // namespace
+
+int main(int argc, char ** argv)
+{
+  const int iterations = argc > 1 ? std::max(1, std::atoi(argv[1])) : 100;
+  rclcpp::init(1, argv);
+
+  using rclcpp::Parameter;
+  using pointcloud_preprocessor::CropBoxFilterComponent;
+  using pointcloud_preprocessor::RingOutlierFilterComponent;
+  using pointcloud_preprocessor::VoxelGridDownsampleFilterComponent;
+  const std::vector<Parameter> crop_box_parameters = {
+    Parameter("min_x", -5.0), Parameter("max_x", 5.0),   Parameter("min_y", -2.0),
+    Parameter("max_y", 2.0),  Parameter("min_z", -3.0),  Parameter("max_z", 1.0),
+    Parameter("negative", true)};
+  auto crop_box_scalar_parameters = crop_box_parameters;
+  crop_box_scalar_parameters.emplace_back("use_vectorized_kernel", false);
+
+  const std::vector<Stage> stages = {
+    filterStage<CropBoxFilterComponent>("crop_box_scalar", crop_box_scalar_parameters),
+    filterStage<CropBoxFilterComponent>("crop_box_vectorized", crop_box_parameters),
+    filterStage<RingOutlierFilterComponent>("ring_outlier", {}),
+    filterStage<RingOutlierFilterComponent>("ring_outlier_parallel", {Parameter("num_threads", 4)}),
+    filterStage<VoxelGridDownsampleFilterComponent>("voxel_grid", {}),
+#ifdef WITH_CUDA_VOXEL_GRID
+    filterStage<VoxelGridDownsampleFilterComponent>(
+      "voxel_grid_cuda", {Parameter("use_cuda", true)}),
+#endif
+    velocityLookupStage(),
+  };
+
+  std::printf("stage, beams, points, p50_us, p99_us, mpoints_per_s, allocs_per_call\n");
+  for (const int num_beams : {32, 64, 128}) {
+    const PointCloud2::ConstSharedPtr fixture = makeFixture(num_beams);
+    const std::size_t num_points = fixture->width * fixture->height;
+    for (const auto & stage : stages) {
+      const auto run = stage.make();
+      const auto result = measure([&]() { run(fixture); }, num_points, iterations);
+      std::printf(
+        "%s, %d, %zu, %.1f, %.1f, %.2f, %.1f\n", stage.name.c_str(), num_beams, num_points,
+        result.p50_us, result.p99_us, result.mpoints_per_s, result.allocations_per_call);
+    }
+  }
+
+  rclcpp::shutdown();
+  return 0;
+}
@@ -0,0 +1,100 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef POINTCLOUD_PREPROCESSOR__BLOCKAGE_DIAG__BLOCKAGE_BITMAP_HPP_
+#define POINTCLOUD_PREPROCESSOR__BLOCKAGE_DIAG__BLOCKAGE_BITMAP_HPP_
+
+#include <boost/circular_buffer.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace pointcloud_preprocessor
+{
+/**
+ * Binary ring x azimuth image, packed 64 bins per word.
+ * The morphology operations follow cv::erode / cv::dilate with a rectangular kernel centered on
+ * the bin and the default border (outside bins are set for erosion and unset for dilation).
+ */
+class BinaryMask
+{
+public:
+  BinaryMask() = default;
+  BinaryMask(int rows, int cols, bool value = false);
+
+  int rows() const { return rows_; }
+  int cols() const { return cols_; }
+
+  void fill(bool value);
+  void set(int row, int col, bool value);
+  bool test(int row, int col) const;
+
+  /** \brief Number of set bins in rows [row_begin, row_end). */
+  std::size_t count(int row_begin, int row_end) const;
+
+  /** \brief First and last columns having a set bin in rows [row_begin, row_end).
+   * \return false if there is no set bin */
+  bool columnRange(int row_begin, int row_end, int & first_col, int & last_col) const;
+
+  /** \brief Copy of rows [row_begin, row_end). */
+  BinaryMask subRows(int row_begin, int row_end) const;
+
+  void erode(int radius_x, int radius_y);
+  void dilate(int radius_x, int radius_y);
+
+  const std::vector<uint64_t> & words() const { return words_; }
+  std::size_t wordsPerRow() const { return words_per_row_; }
+
+private:
+  uint64_t * row(int r) { return &words_[r * words_per_row_]; }
+  const uint64_t * row(int r) const { return &words_[r * words_per_row_]; }
+  void setPadding(bool value);
+  void morphology(int radius_x, int radius_y, bool is_erosion);
+
+  int rows_{0};
+  int cols_{0};
+  std::size_t words_per_row_{0};
+  std::vector<uint64_t> words_;
+};
+
+/**
+ * Per bin count of the set bins over the last `capacity` pushed masks.
+ * Pushing a mask only visits the bins which differ from the one it evicts, and the number of
+ * bins set in all (or all but one) buffered masks is kept as a running sum.
+ */
+class RollingMaskCounter
+{
+public:
+  explicit RollingMaskCounter(std::size_t capacity = 1);
+
+  void push(const BinaryMask & mask);
+  void clear();
+  std::size_t size() const { return buffer_.size(); }
+
+  /** \brief Number of bins set in at least size() - 1 of the buffered masks (and at least one). */
+  std::size_t persistentCount() const;
+
+private:
+  void updateBin(std::size_t bin, int delta);
+
+  boost::circular_buffer<BinaryMask> buffer_;
+  std::vector<uint16_t> counts_;
+  // number of bins for each count value
+  std::vector<std::size_t> histogram_;
+};
+
+}  // namespace pointcloud_preprocessor
+
+#endif  // POINTCLOUD_PREPROCESSOR__BLOCKAGE_DIAG__BLOCKAGE_BITMAP_HPP_
@@ -15,6 +15,7 @@
 #ifndef POINTCLOUD_PREPROCESSOR__BLOCKAGE_DIAG__BLOCKAGE_DIAG_NODELET_HPP_
 #define POINTCLOUD_PREPROCESSOR__BLOCKAGE_DIAG__BLOCKAGE_DIAG_NODELET_HPP_
 
+#include "pointcloud_preprocessor/blockage_diag/blockage_bitmap.hpp"
 #include "pointcloud_preprocessor/filter.hpp"
 
 #include <diagnostic_updater/diagnostic_updater.hpp>
@@ -64,6 +65,8 @@ protected:
 private:
   void onBlockageChecker(DiagnosticStatusWrapper & stat);
   void dustChecker(DiagnosticStatusWrapper & stat);
+  /** \brief Same diagnostics as filter() on packed bitsets, without the debug images. */
+  void incrementalFilter(const PointCloud2ConstPtr & input, PointCloud2 & output);
   Updater updater_{this};
   int vertical_bins_;
   std::vector<double> angle_range_deg_;
@@ -90,6 +93,13 @@ private:
   int dust_count_threshold_;
   int dust_frame_count_ = 0;
 
+  bool use_incremental_mode_;
+  BinaryMask no_return_mask_;
+  RollingMaskCounter ground_blockage_mask_counter_;
+  RollingMaskCounter ground_dust_mask_counter_;
+  float multi_frame_ground_blockage_ratio_ = -1.0f;
+  float multi_frame_ground_dust_ratio_ = -1.0f;
+
 public:
   PCL_MAKE_ALIGNED_OPERATOR_NEW
   explicit BlockageDiagComponent(const rclcpp::NodeOptions & options);
@@ -0,0 +1,113 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef POINTCLOUD_PREPROCESSOR__CONCATENATE_DATA__DEADLINE_CONCATENATE_NODELET_HPP_
+#define POINTCLOUD_PREPROCESSOR__CONCATENATE_DATA__DEADLINE_CONCATENATE_NODELET_HPP_
+
+#include "pointcloud_preprocessor/distortion_corrector/velocity_history.hpp"
+
+#include <Eigen/Core>
+#include <rclcpp/rclcpp.hpp>
+#include <tier4_autoware_utils/ros/debug_publisher.hpp>
+#include <tier4_autoware_utils/system/stop_watch.hpp>
+
+#include <geometry_msgs/msg/twist_with_covariance_stamped.hpp>
+#include <nav_msgs/msg/odometry.hpp>
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <tf2_ros/buffer.h>
+#include <tf2_ros/transform_listener.h>
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace pointcloud_preprocessor
+{
+/** \brief @b PointCloudConcatenateDeadlineSynchronizerComponent concatenates the pointclouds of
+ * several lidars like PointCloudConcatenateDataSynchronizerComponent, but can be run by a
+ * multi-threaded executor.
+ *
+ * Every input topic owns a slot which its callback fills atomically, without a node-wide lock.
+ * The concatenation runs as soon as all the slots are filled, or when a single deadline derived
+ * from the scan phase offsets of the lidars (`input_offset`) expires.
+ */
+class PointCloudConcatenateDeadlineSynchronizerComponent : public rclcpp::Node
+{
+public:
+  using PointCloud2 = sensor_msgs::msg::PointCloud2;
+
+  explicit PointCloudConcatenateDeadlineSynchronizerComponent(
+    const rclcpp::NodeOptions & node_options);
+
+private:
+  struct InputSlot
+  {
+    std::string topic_name;
+    double offset_sec{0.0};
+    /** \brief Latest cloud of the current cycle, only accessed with std::atomic_* functions. */
+    PointCloud2::ConstSharedPtr cloud;
+  };
+
+  void cloudCallback(const PointCloud2::ConstSharedPtr & input_ptr, size_t slot_index);
+  void twistCallback(const geometry_msgs::msg::TwistWithCovarianceStamped::ConstSharedPtr input);
+  void odomCallback(const nav_msgs::msg::Odometry::ConstSharedPtr input);
+  void onDeadlineTimer();
+
+  /** \brief Concatenate the filled slots and publish, unless another thread is already on it. */
+  void tryPublish();
+
+  /** \brief Ego motion between two stamps, as a matrix mapping points at `new_stamp` to
+   * `old_stamp`. */
+  Eigen::Matrix4f computeTransformToAdjustForOldTimestamp(double old_stamp, double new_stamp);
+
+  bool lookupStaticTransform(const std::string & source_frame, Eigen::Matrix4f & transform);
+
+  std::vector<InputSlot> slots_;
+  std::atomic<size_t> num_filled_slots_{0};
+  /** \brief Deadline of the current cycle in nanoseconds of the node clock, 0 if no cycle. */
+  std::atomic<int64_t> deadline_ns_{0};
+  std::atomic<bool> is_publishing_{false};
+
+  std::vector<rclcpp::Subscription<PointCloud2>::SharedPtr> cloud_subs_;
+  rclcpp::Subscription<geometry_msgs::msg::TwistWithCovarianceStamped>::SharedPtr sub_twist_;
+  rclcpp::Subscription<nav_msgs::msg::Odometry>::SharedPtr sub_odom_;
+  rclcpp::Publisher<PointCloud2>::SharedPtr pub_output_;
+  rclcpp::TimerBase::SharedPtr deadline_timer_;
+
+  rclcpp::CallbackGroup::SharedPtr cloud_callback_group_;
+  rclcpp::CallbackGroup::SharedPtr timer_callback_group_;
+
+  std::string output_frame_;
+  double timeout_sec_;
+
+  std::shared_ptr<tf2_ros::Buffer> tf2_buffer_;
+  std::shared_ptr<tf2_ros::TransformListener> tf2_listener_;
+
+  /** \brief Only guards the twist history, never held while concatenating. */
+  std::mutex twist_mutex_;
+  VelocityHistory twist_history_;
+
+  /** \brief Only accessed by the thread holding `is_publishing_`. */
+  std::vector<PointCloud2::ConstSharedPtr> clouds_to_concatenate_;
+
+  std::unique_ptr<tier4_autoware_utils::StopWatch<std::chrono::milliseconds>> stop_watch_ptr_;
+  std::unique_ptr<tier4_autoware_utils::DebugPublisher> debug_publisher_;
+};
+
+}  // namespace pointcloud_preprocessor
+
+#endif  // POINTCLOUD_PREPROCESSOR__CONCATENATE_DATA__DEADLINE_CONCATENATE_NODELET_HPP_
@@ -53,6 +53,7 @@
 #ifndef POINTCLOUD_PREPROCESSOR__CROP_BOX_FILTER__CROP_BOX_FILTER_NODELET_HPP_
 #define POINTCLOUD_PREPROCESSOR__CROP_BOX_FILTER__CROP_BOX_FILTER_NODELET_HPP_
 
+#include "pointcloud_preprocessor/crop_box_filter/crop_box_kernel.hpp"
 #include "pointcloud_preprocessor/filter.hpp"
 #include "pointcloud_preprocessor/transform_info.hpp"
 
@@ -90,6 +91,9 @@ private:
     bool negative{false};
   } param_;
 
+  /** \brief Use the AVX2/NEON kernel when the CPU supports it. */
+  bool use_vectorized_kernel_{true};
+
   rclcpp::Publisher<geometry_msgs::msg::PolygonStamped>::SharedPtr crop_box_polygon_pub_;
 
   /** \brief Parameter service callback result : needed to be hold */
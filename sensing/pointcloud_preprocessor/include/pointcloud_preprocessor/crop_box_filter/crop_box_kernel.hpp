@@ -0,0 +1,72 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef POINTCLOUD_PREPROCESSOR__CROP_BOX_FILTER__CROP_BOX_KERNEL_HPP_
+#define POINTCLOUD_PREPROCESSOR__CROP_BOX_FILTER__CROP_BOX_KERNEL_HPP_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace pointcloud_preprocessor::crop_box_kernel
+{
+struct Box
+{
+  float min_x;
+  float max_x;
+  float min_y;
+  float max_y;
+  float min_z;
+  float max_z;
+  bool negative;
+};
+
+struct Layout
+{
+  size_t point_step;
+  size_t x_offset;
+  size_t y_offset;
+  size_t z_offset;
+};
+
+struct Result
+{
+  size_t output_size;  // in bytes
+  int skipped_count;   // number of points with non-finite coordinates
+};
+
+/**
+ * Copy the points of `input` which are inside (or outside, if `box.negative`) of the box into
+ * `output`, which must be at least `num_points * layout.point_step` bytes long.
+ * If `transform` is not null, it points to a column-major 4x4 matrix; the box test is done on the
+ * transformed coordinates, which are also written to the output.
+ */
+Result crop_box_scalar(
+  const uint8_t * input, size_t num_points, const Layout & layout, const float * transform,
+  const Box & box, uint8_t * output);
+
+/** \brief Same as crop_box_scalar(), processing 8 points per iteration with AVX2 or NEON. */
+Result crop_box_vectorized(
+  const uint8_t * input, size_t num_points, const Layout & layout, const float * transform,
+  const Box & box, uint8_t * output);
+
+/** \brief True if crop_box_vectorized() can run on this CPU. */
+bool is_vectorized_supported();
+
+/** \brief Dispatch to the vectorized kernel when the CPU supports it, the scalar one otherwise. */
+Result crop_box(
+  const uint8_t * input, size_t num_points, const Layout & layout, const float * transform,
+  const Box & box, uint8_t * output);
+}  // namespace pointcloud_preprocessor::crop_box_kernel
+
+#endif  // POINTCLOUD_PREPROCESSOR__CROP_BOX_FILTER__CROP_BOX_KERNEL_HPP_
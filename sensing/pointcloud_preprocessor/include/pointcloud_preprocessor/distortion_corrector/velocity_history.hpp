@@ -0,0 +1,85 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef POINTCLOUD_PREPROCESSOR__DISTORTION_CORRECTOR__VELOCITY_HISTORY_HPP_
+#define POINTCLOUD_PREPROCESSOR__DISTORTION_CORRECTOR__VELOCITY_HISTORY_HPP_
+
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+
+namespace pointcloud_preprocessor
+{
+/**
+ * Time-ordered history of ego velocities, stored as a structure of arrays so that the binary search
+ * on the stamps only touches the stamps.
+ */
+class VelocityHistory
+{
+public:
+  explicit VelocityHistory(double max_duration = 1.0) : max_duration_(max_duration) {}
+
+  /** \brief Append a sample and drop the samples which are too old or newer than it. */
+  void push(double stamp, float linear_x, float angular_z)
+  {
+    // for replay rosbag
+    while (!stamps_.empty() && stamps_.back() > stamp) {
+      popBack();
+    }
+
+    stamps_.push_back(stamp);
+    linear_x_.push_back(linear_x);
+    angular_z_.push_back(angular_z);
+
+    while (stamps_.front() < stamp - max_duration_) {
+      popFront();
+    }
+  }
+
+  /** \brief Index of the first sample not older than `stamp`, or the last sample if none. */
+  size_t find(double stamp) const
+  {
+    const auto it = std::lower_bound(stamps_.cbegin(), stamps_.cend(), stamp);
+    return it == stamps_.cend() ? stamps_.size() - 1 : std::distance(stamps_.cbegin(), it);
+  }
+
+  bool empty() const { return stamps_.empty(); }
+  size_t size() const { return stamps_.size(); }
+  double stamp(size_t i) const { return stamps_[i]; }
+  float linearX(size_t i) const { return linear_x_[i]; }
+  float angularZ(size_t i) const { return angular_z_[i]; }
+
+private:
+  void popFront()
+  {
+    stamps_.pop_front();
+    linear_x_.pop_front();
+    angular_z_.pop_front();
+  }
+
+  void popBack()
+  {
+    stamps_.pop_back();
+    linear_x_.pop_back();
+    angular_z_.pop_back();
+  }
+
+  double max_duration_;
+  std::deque<double> stamps_;
+  std::deque<float> linear_x_;
+  std::deque<float> angular_z_;
+};
+}  // namespace pointcloud_preprocessor
+
+#endif  // POINTCLOUD_PREPROCESSOR__DISTORTION_CORRECTOR__VELOCITY_HISTORY_HPP_
@@ -0,0 +1,83 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#pragma once
+
+#include "pointcloud_preprocessor/transform_info.hpp"
+
+#include <cuda_utils/cuda_unique_ptr.hpp>
+#include <cuda_utils/stream_unique_ptr.hpp>
+#include <rclcpp/logger.hpp>
+
+#include <sensor_msgs/msg/point_cloud2.hpp>
+
+#include <cuda_runtime_api.h>
+
+#include <cstdint>
+
+namespace pointcloud_preprocessor
+{
+
+/**
+ * Voxel grid downsampling on the GPU, giving the same centroids as
+ * FasterVoxelGridDownsampleFilter.
+ * The voxel keys of the points are sorted on the device, and the points sharing a key are reduced
+ * into their centroid. The centroids stay on the device, so that a consumer also running on the
+ * GPU can use them through device_centroids() without a copy to the host.
+ */
+class CudaVoxelGridDownsampleFilter
+{
+  using PointCloud2 = sensor_msgs::msg::PointCloud2;
+  using PointCloud2ConstPtr = sensor_msgs::msg::PointCloud2::ConstSharedPtr;
+
+public:
+  /** \brief Centroids (x, y, z, 1) of the last filtered pointcloud, in device memory. */
+  struct DeviceCentroids
+  {
+    const float4 * data;
+    std::size_t size;
+    /** \brief The stream the centroids are computed on. Synchronize or wait on it before use. */
+    cudaStream_t stream;
+  };
+
+  CudaVoxelGridDownsampleFilter();
+  void set_voxel_size(float voxel_size_x, float voxel_size_y, float voxel_size_z);
+
+  /** \brief Downsample `input` and copy the centroids to `output` (x, y, z fields). */
+  void filter(
+    const PointCloud2ConstPtr & input, PointCloud2 & output, const TransformInfo & transform_info,
+    const rclcpp::Logger & logger);
+
+  /** \brief Downsample `input`, keeping the result on the device.
+   * The returned buffer is valid until the next call to filter() or filter_on_device(). */
+  DeviceCentroids filter_on_device(
+    const PointCloud2ConstPtr & input, const TransformInfo & transform_info);
+
+private:
+  void reserve(std::size_t num_points, std::size_t point_step);
+
+  float inverse_voxel_size_[3];
+
+  cuda_utils::StreamUniquePtr stream_;
+  std::size_t capacity_points_{0};
+  std::size_t capacity_bytes_{0};
+  cuda_utils::CudaUniquePtr<std::uint8_t[]> d_raw_points_;
+  cuda_utils::CudaUniquePtr<std::uint64_t[]> d_voxel_keys_;
+  cuda_utils::CudaUniquePtr<float4[]> d_points_;
+  cuda_utils::CudaUniquePtr<std::uint64_t[]> d_unique_keys_;
+  cuda_utils::CudaUniquePtr<float4[]> d_centroids_;
+  cuda_utils::CudaUniquePtr<float[]> d_transform_;
+};
+
+}  // namespace pointcloud_preprocessor
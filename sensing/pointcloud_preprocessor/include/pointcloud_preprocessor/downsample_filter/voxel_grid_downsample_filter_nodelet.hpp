@@ -57,10 +57,13 @@
 #include <pcl/filters/voxel_grid.h>
 #include <pcl/search/pcl_search.h>
 
+#include <memory>
 #include <vector>
 
 namespace pointcloud_preprocessor
 {
+class CudaVoxelGridDownsampleFilter;
+
 class VoxelGridDownsampleFilterComponent : public pointcloud_preprocessor::Filter
 {
 protected:
@@ -78,6 +81,10 @@ private:
   float voxel_size_y_;
   float voxel_size_z_;
 
+  /** \brief Run on the GPU. Only used when the package is built with CUDA. */
+  bool use_cuda_;
+  std::shared_ptr<CudaVoxelGridDownsampleFilter> cuda_voxel_filter_;
+
   /** \brief Parameter service callback result : needed to be hold */
   OnSetParametersCallbackHandle::SharedPtr set_param_res_;
 
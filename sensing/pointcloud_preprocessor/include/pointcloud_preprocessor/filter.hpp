@@ -56,6 +56,8 @@
 
 #include <memory>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 // PCL includes
@@ -135,6 +137,15 @@ public:
     const std::string & filter_name = "pointcloud_preprocessor_filter",
     const rclcpp::NodeOptions & options = rclcpp::NodeOptions());
 
+  /** \brief Run this filter as one stage of an in-process chain (see FusedPipelineComponent).
+   * The input transform is resolved against `input_frame` and `faster_filter()` is called directly,
+   * without going through the input subscription or the output publisher.
+   * \param input the input point cloud dataset (typically the previous stage's output).
+   * \param output the resultant filtered PointCloud2. Its buffers are reused when possible.
+   * \return false if the input is invalid or the transform could not be resolved.
+   */
+  bool process_fused_stage(const PointCloud2ConstPtr & input, PointCloud2 & output);
+
 protected:
   /** \brief The input PointCloud2 subscriber. */
   rclcpp::Subscription<PointCloud2>::SharedPtr sub_input_;
@@ -237,6 +248,18 @@ protected:
    * versus an exact one (false by default). */
   bool approximate_sync_ = false;
 
+  /** \brief True if this filter is driven by a fused pipeline through process_fused_stage().
+   * In that case neither the input subscription nor the output publisher is created. */
+  bool fused_stage_ = false;
+
+  /** \brief True if the input transform may be cached by source frame_id.
+   * Only valid when the transform between the input frame and the sensor frames is static. */
+  bool use_transform_cache_ = false;
+
+  /** \brief True if a single output message is kept and published by reference, so that its
+   * buffers are reused instead of allocated for every frame. Disabled with intra-process comms. */
+  bool reuse_output_buffer_ = false;
+
   std::shared_ptr<tf2_ros::Buffer> tf_buffer_;
   std::shared_ptr<tf2_ros::TransformListener> tf_listener_;
 
@@ -293,6 +316,21 @@ private:
 
   bool convert_output_costly(std::unique_ptr<PointCloud2> & output);
 
+  /** \brief The message to fill for the next output: the reused one, or a new one. */
+  std::unique_ptr<PointCloud2> & prepare_output(std::unique_ptr<PointCloud2> & new_output);
+
+  /** \brief Publish the output prepared by prepare_output(). */
+  void publish_output(std::unique_ptr<PointCloud2> & output);
+
+  /** \brief The output message reused when reuse_output_buffer_ is true. */
+  std::unique_ptr<PointCloud2> reused_output_;
+
+  /** \brief Transform matrices cached by "<target_frame>-><source_frame>". */
+  std::unordered_map<
+    std::string, Eigen::Matrix4f, std::hash<std::string>, std::equal_to<std::string>,
+    Eigen::aligned_allocator<std::pair<const std::string, Eigen::Matrix4f>>>
+    transform_cache_;
+
   // TODO(sykwer): Temporary Implementation: Remove this interface when all the filter nodes conform
   // to new API.
   void faster_input_indices_callback(
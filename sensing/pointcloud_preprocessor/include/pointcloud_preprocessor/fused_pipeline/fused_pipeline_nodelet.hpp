@@ -0,0 +1,64 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef POINTCLOUD_PREPROCESSOR__FUSED_PIPELINE__FUSED_PIPELINE_NODELET_HPP_
+#define POINTCLOUD_PREPROCESSOR__FUSED_PIPELINE__FUSED_PIPELINE_NODELET_HPP_
+
+#include "pointcloud_preprocessor/filter.hpp"
+#include "pointcloud_preprocessor/transform_info.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace pointcloud_preprocessor
+{
+/** \brief Runs an ordered chain of filters in-process on a single input subscription.
+ *
+ * Every stage is a regular Filter component created with `fused_stage:=true`, so it has neither
+ * a subscription nor a publisher. The intermediate clouds are kept in two buffers which are
+ * reused across frames, so no serialization or reallocation happens between the stages.
+ */
+class FusedPipelineComponent : public pointcloud_preprocessor::Filter
+{
+protected:
+  void filter(
+    const PointCloud2ConstPtr & input, const IndicesPtr & indices, PointCloud2 & output) override;
+
+  void faster_filter(
+    const PointCloud2ConstPtr & input, const IndicesPtr & indices, PointCloud2 & output,
+    const TransformInfo & transform_info) override;
+
+private:
+  struct Stage
+  {
+    std::string name;
+    std::shared_ptr<Filter> filter;
+  };
+
+  std::vector<Stage> stages_;
+
+  /** \brief Ping-pong buffers holding the intermediate results between stages. */
+  std::shared_ptr<PointCloud2> intermediate_buffers_[2];
+
+  std::shared_ptr<Filter> createStage(
+    const std::string & stage_name, const rclcpp::NodeOptions & options);
+
+public:
+  PCL_MAKE_ALIGNED_OPERATOR_NEW
+  explicit FusedPipelineComponent(const rclcpp::NodeOptions & options);
+};
+}  // namespace pointcloud_preprocessor
+
+#endif  // POINTCLOUD_PREPROCESSOR__FUSED_PIPELINE__FUSED_PIPELINE_NODELET_HPP_
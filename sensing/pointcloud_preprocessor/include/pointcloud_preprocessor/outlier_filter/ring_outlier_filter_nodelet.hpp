@@ -42,10 +42,20 @@ protected:
     const TransformInfo & transform_info);
 
 private:
+  /** \brief Filter `input`, whose fields are accessed through `layout`. */
+  template <class Layout>
+  void filter_with_layout(
+    const Layout & layout, const PointCloud2ConstPtr & input, PointCloud2 & output,
+    const TransformInfo & transform_info);
+
   double distance_ratio_;
   double object_length_threshold_;
   int num_points_threshold_;
   uint16_t max_rings_num_;
+  int num_threads_;
+
+  /** \brief Point indices of each ring, reused between frames when num_threads_ > 1 */
+  std::vector<std::vector<size_t>> ring_point_indices_;
 
   /** \brief Parameter service callback result : needed to be hold */
   OnSetParametersCallbackHandle::SharedPtr set_param_res_;
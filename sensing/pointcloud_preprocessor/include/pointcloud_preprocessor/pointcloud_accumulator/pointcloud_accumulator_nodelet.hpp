@@ -19,6 +19,7 @@
 
 #include <boost/circular_buffer.hpp>
 
+#include <cstdint>
 #include <vector>
 
 namespace pointcloud_preprocessor
@@ -36,8 +37,19 @@ protected:
   rcl_interfaces::msg::SetParametersResult paramCallback(const std::vector<rclcpp::Parameter> & p);
 
 private:
+  /** \brief An input cloud converted to the pcl::PointXYZ layout of the output. */
+  struct AccumulatedCloud
+  {
+    rclcpp::Time stamp;
+    std::vector<uint8_t> data;
+    bool is_dense{true};
+  };
+
+  /** \brief Convert the input into the layout of the output, reusing the memory of data. */
+  static void convertToOutputLayout(const PointCloud2 & input, AccumulatedCloud & cloud);
+
   double accumulation_time_sec_;
-  boost::circular_buffer<PointCloud2ConstPtr> pointcloud_buffer_;
+  boost::circular_buffer<AccumulatedCloud> pointcloud_buffer_;
 
 public:
   PCL_MAKE_ALIGNED_OPERATOR_NEW
@@ -16,6 +16,7 @@
 #define POINTCLOUD_PREPROCESSOR__POLYGON_REMOVER__POLYGON_REMOVER_HPP_
 
 #include "pointcloud_preprocessor/filter.hpp"
+#include "pointcloud_preprocessor/polygon_remover/scanline_polygon.hpp"
 #include "pointcloud_preprocessor/utility/utilities.hpp"
 
 #include <geometry_msgs/msg/polygon_stamped.hpp>
@@ -52,6 +53,7 @@ private:
   bool polygon_is_initialized_;
   bool will_visualize_;
   PolygonCgal polygon_cgal_;
+  ScanlinePolygon scanline_polygon_;
   visualization_msgs::msg::Marker marker_;
 
   rclcpp::Publisher<visualization_msgs::msg::Marker>::SharedPtr pub_marker_ptr_;
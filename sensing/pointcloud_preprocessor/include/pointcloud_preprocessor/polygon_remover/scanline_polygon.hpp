@@ -0,0 +1,65 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef POINTCLOUD_PREPROCESSOR__POLYGON_REMOVER__SCANLINE_POLYGON_HPP_
+#define POINTCLOUD_PREPROCESSOR__POLYGON_REMOVER__SCANLINE_POLYGON_HPP_
+
+#include "pointcloud_preprocessor/utility/utilities.hpp"
+
+#include <cstddef>
+#include <vector>
+
+namespace pointcloud_preprocessor
+{
+/**
+ * Point-in-polygon test with a precomputed scanline edge table of a static polygon.
+ * The polygon is split into horizontal bands at the y of its vertices, and each band keeps the
+ * edges spanning it, so that a point is tested by an even-odd count over the few edges of its band.
+ * The points within a tolerance of an edge or on the y of a vertex are tested by CGAL, so the
+ * result equals CGAL::bounded_side_2() != CGAL::ON_UNBOUNDED_SIDE.
+ */
+class ScanlinePolygon
+{
+public:
+  ScanlinePolygon() = default;
+  explicit ScanlinePolygon(const PolygonCgal & polygon);
+
+  /** \brief true if the point is inside or on the boundary of the polygon */
+  bool contains(double x, double y) const;
+
+private:
+  // x on the edge at y is x0 + (y - y0) * dx_dy
+  struct Edge
+  {
+    double x0;
+    double y0;
+    double dx_dy;
+  };
+
+  bool containsExactly(double x, double y) const;
+
+  PolygonCgal polygon_;
+  double min_x_{0.0};
+  double min_y_{0.0};
+  double max_x_{-1.0};
+  double max_y_{-1.0};
+  // band i covers [band_y_[i], band_y_[i + 1]), and its edges are band_edges_ in
+  // [band_begin_[i], band_begin_[i + 1])
+  std::vector<double> band_y_;
+  std::vector<size_t> band_begin_;
+  std::vector<Edge> band_edges_;
+};
+}  // namespace pointcloud_preprocessor
+
+#endif  // POINTCLOUD_PREPROCESSOR__POLYGON_REMOVER__SCANLINE_POLYGON_HPP_
@@ -15,6 +15,8 @@
 #ifndef POINTCLOUD_PREPROCESSOR__VECTOR_MAP_FILTER__LANELET2_MAP_FILTER_NODELET_HPP_
 #define POINTCLOUD_PREPROCESSOR__VECTOR_MAP_FILTER__LANELET2_MAP_FILTER_NODELET_HPP_
 
+#include "pointcloud_preprocessor/vector_map_filter/polygon_raster.hpp"
+
 #include <lanelet2_extension/utility/message_conversion.hpp>
 #include <lanelet2_extension/utility/query.hpp>
 #include <rclcpp/rclcpp.hpp>
@@ -65,9 +67,13 @@ private:
 
   lanelet::LaneletMapPtr lanelet_map_ptr_;
   lanelet::ConstLanelets road_lanelets_;
+  lanelet::BasicPolygons2d road_polygons_;
+  PolygonRaster road_raster_;
 
   float voxel_size_x_;
   float voxel_size_y_;
+  bool use_polygon_raster_;
+  double polygon_raster_resolution_;
 
   void pointcloudCallback(const PointCloud2ConstPtr msg);
 
@@ -88,6 +94,9 @@ private:
 
   bool pointWithinLanelets(const Point2d & point, const lanelet::ConstLanelets & joint_lanelets);
 
+  pcl::PointCloud<pcl::PointXYZ> getRasterFilteredPointCloud(
+    const pcl::PointCloud<pcl::PointXYZ>::Ptr & cloud) const;
+
   /** \brief Parameter service callback result : needed to be hold */
   OnSetParametersCallbackHandle::SharedPtr set_param_res_;
 
@@ -0,0 +1,83 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef POINTCLOUD_PREPROCESSOR__VECTOR_MAP_FILTER__POLYGON_RASTER_HPP_
+#define POINTCLOUD_PREPROCESSOR__VECTOR_MAP_FILTER__POLYGON_RASTER_HPP_
+
+#include <lanelet2_core/primitives/Polygon.h>
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace pointcloud_preprocessor
+{
+/**
+ * Bitmask raster of the area covered by a set of polygons, stored in tiles of 64 x 64 cells.
+ * A cell is INSIDE when a polygon covers the whole cell, and BOUNDARY when it is not INSIDE and
+ * an edge of a polygon crosses it. Only the points in the BOUNDARY cells need an exact test, and
+ * only against the polygons crossing the cell.
+ */
+class PolygonRaster
+{
+public:
+  enum class CellState : uint8_t { OUTSIDE, INSIDE, BOUNDARY };
+
+  PolygonRaster() = default;
+  PolygonRaster(const lanelet::BasicPolygons2d & polygons, double resolution);
+
+  bool empty() const { return tiles_.empty(); }
+
+  CellState getCellState(double x, double y) const;
+
+  /** \brief Indices of the polygons whose edges cross the cell, empty unless BOUNDARY. */
+  const std::vector<uint32_t> & getBoundaryPolygonIndices(double x, double y) const;
+
+private:
+  static constexpr int TILE_BITS = 6;
+  static constexpr int TILE_SIZE = 1 << TILE_BITS;
+
+  // one word per row of the tile
+  struct Tile
+  {
+    std::array<uint64_t, TILE_SIZE> inside{};
+    std::array<uint64_t, TILE_SIZE> boundary{};
+  };
+
+  bool toCell(double x, double y, int & cell_x, int & cell_y) const;
+  uint64_t toCellKey(const int cell_x, const int cell_y) const
+  {
+    return static_cast<uint64_t>(cell_y) * static_cast<uint64_t>(num_cells_x_) + cell_x;
+  }
+  Tile & getOrCreateTile(int cell_x, int cell_y);
+  const Tile * getTile(int cell_x, int cell_y) const;
+  void addPolygon(const lanelet::BasicPolygon2d & polygon, uint32_t polygon_index);
+
+  double resolution_{1.0};
+  double min_x_{0.0};
+  double min_y_{0.0};
+  int num_cells_x_{0};
+  int num_cells_y_{0};
+  int num_tiles_x_{0};
+  int num_tiles_y_{0};
+  // index in tiles_ for each tile of the bounding box, -1 if no polygon overlaps the tile
+  std::vector<int32_t> tile_indices_;
+  std::vector<Tile> tiles_;
+  std::unordered_map<uint64_t, std::vector<uint32_t>> boundary_polygon_indices_;
+};
+}  // namespace pointcloud_preprocessor
+
+#endif  // POINTCLOUD_PREPROCESSOR__VECTOR_MAP_FILTER__POLYGON_RASTER_HPP_
@@ -17,6 +17,7 @@
 
 #include "pointcloud_preprocessor/filter.hpp"
 #include "pointcloud_preprocessor/utility/utilities.hpp"
+#include "pointcloud_preprocessor/vector_map_filter/polygon_raster.hpp"
 
 #include <lanelet2_extension/utility/message_conversion.hpp>
 #include <lanelet2_extension/utility/query.hpp>
@@ -25,6 +26,7 @@
 #include <lanelet2_core/geometry/Polygon.h>
 
 #include <string>
+#include <vector>
 
 using tier4_autoware_utils::MultiPoint2d;
 
@@ -38,11 +40,15 @@ private:
 
   rclcpp::Subscription<autoware_auto_mapping_msgs::msg::HADMapBin>::SharedPtr map_sub_;
   lanelet::ConstPolygons3d polygon_lanelets_;
+  std::vector<PolygonCgal> cgal_polygons_;
+  PolygonRaster polygon_raster_;
 
   void mapCallback(const autoware_auto_mapping_msgs::msg::HADMapBin::ConstSharedPtr msg);
 
   // parameter
   std::string polygon_type_;
+  bool use_polygon_raster_;
+  double polygon_raster_resolution_;
 
 public:
   PCL_MAKE_ALIGNED_OPERATOR_NEW
@@ -0,0 +1,230 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "pointcloud_preprocessor/blockage_diag/blockage_bitmap.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+namespace
+{
+constexpr std::size_t BITS = 64;
+constexpr uint64_t ALL_SET = ~uint64_t{0};
+
+// out[col] = in[col - shift], bins out of the row read as `fill`
+void shiftRow(
+  const uint64_t * in, uint64_t * out, const std::size_t num_words, const int shift,
+  const bool fill)
+{
+  const uint64_t fill_word = fill ? ALL_SET : 0;
+  const auto word_at = [&](const std::ptrdiff_t i) {
+    return (i < 0 || i >= static_cast<std::ptrdiff_t>(num_words)) ? fill_word : in[i];
+  };
+  const std::size_t abs_shift = std::abs(shift);
+  const auto q = static_cast<std::ptrdiff_t>(abs_shift / BITS);
+  const std::size_t r = abs_shift % BITS;
+  for (std::size_t w = 0; w < num_words; ++w) {
+    const auto i = static_cast<std::ptrdiff_t>(w);
+    if (shift >= 0) {
+      out[w] = r == 0 ? word_at(i - q) : (word_at(i - q) << r) | (word_at(i - q - 1) >> (BITS - r));
+    } else {
+      out[w] = r == 0 ? word_at(i + q) : (word_at(i + q) >> r) | (word_at(i + q + 1) << (BITS - r));
+    }
+  }
+}
+
+int popcount(const uint64_t word)
+{
+  return __builtin_popcountll(word);
+}
+}  // namespace
+
+namespace pointcloud_preprocessor
+{
+BinaryMask::BinaryMask(int rows, int cols, bool value)
+: rows_(rows), cols_(cols), words_per_row_((cols + BITS - 1) / BITS)
+{
+  words_.resize(rows_ * words_per_row_);
+  fill(value);
+}
+
+void BinaryMask::fill(bool value)
+{
+  std::fill(words_.begin(), words_.end(), value ? ALL_SET : 0);
+  setPadding(false);
+}
+
+void BinaryMask::set(int row, int col, bool value)
+{
+  uint64_t & word = words_[row * words_per_row_ + col / BITS];
+  const uint64_t bit = uint64_t{1} << (col % BITS);
+  word = value ? (word | bit) : (word & ~bit);
+}
+
+bool BinaryMask::test(int row, int col) const
+{
+  return (words_[row * words_per_row_ + col / BITS] >> (col % BITS)) & 1U;
+}
+
+std::size_t BinaryMask::count(int row_begin, int row_end) const
+{
+  std::size_t num_set = 0;
+  for (std::size_t i = row_begin * words_per_row_; i < row_end * words_per_row_; ++i) {
+    num_set += popcount(words_[i]);
+  }
+  return num_set;
+}
+
+bool BinaryMask::columnRange(int row_begin, int row_end, int & first_col, int & last_col) const
+{
+  std::vector<uint64_t> columns(words_per_row_, 0);
+  for (int r = row_begin; r < row_end; ++r) {
+    for (std::size_t w = 0; w < words_per_row_; ++w) {
+      columns[w] |= row(r)[w];
+    }
+  }
+  const auto first = std::find_if(columns.begin(), columns.end(), [](auto w) { return w != 0; });
+  if (first == columns.end()) {
+    return false;
+  }
+  const auto last = std::find_if(columns.rbegin(), columns.rend(), [](auto w) { return w != 0; });
+  first_col = (first - columns.begin()) * BITS + __builtin_ctzll(*first);
+  last_col = (columns.rend() - last - 1) * BITS + (BITS - 1 - __builtin_clzll(*last));
+  return true;
+}
+
+BinaryMask BinaryMask::subRows(int row_begin, int row_end) const
+{
+  BinaryMask sub(row_end - row_begin, cols_);
+  std::copy(row(row_begin), row(row_begin) + sub.words_.size(), sub.words_.begin());
+  return sub;
+}
+
+void BinaryMask::erode(int radius_x, int radius_y)
+{
+  morphology(radius_x, radius_y, true);
+}
+
+void BinaryMask::dilate(int radius_x, int radius_y)
+{
+  morphology(radius_x, radius_y, false);
+}
+
+void BinaryMask::setPadding(bool value)
+{
+  const std::size_t used_bits = cols_ % BITS;
+  if (used_bits == 0 || words_per_row_ == 0) {
+    return;
+  }
+  const uint64_t padding = ALL_SET << used_bits;
+  for (int r = 0; r < rows_; ++r) {
+    uint64_t & last_word = row(r)[words_per_row_ - 1];
+    last_word = value ? (last_word | padding) : (last_word & ~padding);
+  }
+}
+
+void BinaryMask::morphology(int radius_x, int radius_y, bool is_erosion)
+{
+  const auto combine = [is_erosion](uint64_t a, uint64_t b) { return is_erosion ? a & b : a | b; };
+
+  // The rectangular kernel is separable: horizontal pass, then vertical pass.
+  // Bins out of the image are neutral for the operation, as for the default border of OpenCV.
+  setPadding(is_erosion);
+  std::vector<uint64_t> src(words_per_row_);
+  std::vector<uint64_t> shifted(words_per_row_);
+  for (int r = 0; r < rows_; ++r) {
+    uint64_t * dst = row(r);
+    std::copy(dst, dst + words_per_row_, src.begin());
+    for (int d = 1; d <= radius_x; ++d) {
+      for (const int shift : {d, -d}) {
+        shiftRow(src.data(), shifted.data(), words_per_row_, shift, is_erosion);
+        for (std::size_t w = 0; w < words_per_row_; ++w) {
+          dst[w] = combine(dst[w], shifted[w]);
+        }
+      }
+    }
+  }
+
+  const std::vector<uint64_t> horizontal = words_;
+  for (int r = 0; r < rows_; ++r) {
+    uint64_t * dst = row(r);
+    for (int k = std::max(0, r - radius_y); k <= std::min(rows_ - 1, r + radius_y); ++k) {
+      const uint64_t * other = &horizontal[k * words_per_row_];
+      for (std::size_t w = 0; w < words_per_row_; ++w) {
+        dst[w] = combine(dst[w], other[w]);
+      }
+    }
+  }
+  setPadding(false);
+}
+
+RollingMaskCounter::RollingMaskCounter(std::size_t capacity)
+: buffer_(std::max<std::size_t>(capacity, 1))
+{
+}
+
+void RollingMaskCounter::clear()
+{
+  buffer_.clear();
+  counts_.clear();
+  histogram_.clear();
+}
+
+void RollingMaskCounter::updateBin(std::size_t bin, int delta)
+{
+  --histogram_[counts_[bin]];
+  counts_[bin] += delta;
+  ++histogram_[counts_[bin]];
+}
+
+void RollingMaskCounter::push(const BinaryMask & mask)
+{
+  if (
+    !buffer_.empty() &&
+    (buffer_.back().rows() != mask.rows() || buffer_.back().cols() != mask.cols())) {
+    clear();
+  }
+  const auto & words = mask.words();
+  if (counts_.empty()) {
+    counts_.assign(words.size() * BITS, 0);
+    histogram_.assign(buffer_.capacity() + 1, 0);
+    histogram_[0] = counts_.size();
+  }
+
+  // Only the bins which differ from the evicted mask change their count
+  const std::vector<uint64_t> * evicted = buffer_.full() ? &buffer_.front().words() : nullptr;
+  for (std::size_t w = 0; w < words.size(); ++w) {
+    uint64_t changed = evicted ? words[w] ^ (*evicted)[w] : words[w];
+    while (changed) {
+      const int bit = __builtin_ctzll(changed);
+      changed &= changed - 1;
+      updateBin(w * BITS + bit, ((words[w] >> bit) & 1U) ? 1 : -1);
+    }
+  }
+  buffer_.push_back(mask);
+}
+
+std::size_t RollingMaskCounter::persistentCount() const
+{
+  if (buffer_.empty()) {
+    return 0;
+  }
+  std::size_t num_persistent = 0;
+  for (std::size_t c = std::max<std::size_t>(buffer_.size() - 1, 1); c <= buffer_.size(); ++c) {
+    num_persistent += histogram_[c];
+  }
+  return num_persistent;
+}
+
+}  // namespace pointcloud_preprocessor
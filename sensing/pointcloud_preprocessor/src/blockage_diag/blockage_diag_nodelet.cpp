@@ -14,11 +14,13 @@
 
 #include "pointcloud_preprocessor/blockage_diag/blockage_diag_nodelet.hpp"
 
+#include "autoware_point_types/field_accessor.hpp"
 #include "autoware_point_types/types.hpp"
 
 #include <boost/circular_buffer.hpp>
 
 #include <algorithm>
+#include <cmath>
 #include <numeric>
 
 namespace pointcloud_preprocessor
@@ -44,7 +46,10 @@ BlockageDiagComponent::BlockageDiagComponent(const rclcpp::NodeOptions & options
     dust_kernel_size_ = declare_parameter<int>("dust_kernel_size");
     dust_buffering_frames_ = declare_parameter<int>("dust_buffering_frames");
     dust_buffering_interval_ = declare_parameter<int>("dust_buffering_interval");
+    use_incremental_mode_ = declare_parameter<bool>("use_incremental_mode", false);
   }
+  ground_blockage_mask_counter_ = RollingMaskCounter(blockage_buffering_frames_);
+  ground_dust_mask_counter_ = RollingMaskCounter(dust_buffering_frames_);
 
   updater_.setHardwareID("blockage_diag");
   updater_.add(
@@ -87,6 +92,10 @@ void BlockageDiagComponent::onBlockageChecker(DiagnosticStatusWrapper & stat)
   stat.add(
     "sky_blockage_range_deg", "[" + std::to_string(sky_blockage_range_deg_[0]) + "," +
                                 std::to_string(sky_blockage_range_deg_[1]) + "]");
+  if (use_incremental_mode_) {
+    stat.add(
+      "multi_frame_ground_blockage_ratio", std::to_string(multi_frame_ground_blockage_ratio_));
+  }
   // TODO(badai-nguyen): consider sky_blockage_ratio_ for DiagnosticsStatus." [todo]
 
   auto level = DiagnosticStatus::OK;
@@ -120,6 +129,9 @@ void BlockageDiagComponent::onBlockageChecker(DiagnosticStatusWrapper & stat)
 void BlockageDiagComponent::dustChecker(diagnostic_updater::DiagnosticStatusWrapper & stat)
 {
   stat.add("ground_dust_ratio", std::to_string(ground_dust_ratio_));
+  if (use_incremental_mode_) {
+    stat.add("multi_frame_ground_dust_ratio", std::to_string(multi_frame_ground_dust_ratio_));
+  }
   auto level = DiagnosticStatus::OK;
   std::string msg;
   if (ground_dust_ratio_ < 0.0f) {
@@ -148,6 +160,10 @@ void BlockageDiagComponent::filter(
   PointCloud2 & output)
 {
   std::scoped_lock lock(mutex_);
+  if (use_incremental_mode_) {
+    incrementalFilter(input, output);
+    return;
+  }
   int vertical_bins = vertical_bins_;
   int ideal_horizontal_bins;
   float distance_coefficient = 327.67f;
@@ -385,6 +401,163 @@ void BlockageDiagComponent::filter(
   pcl::toROSMsg(*pcl_input, output);
   output.header = input->header;
 }
+
+void BlockageDiagComponent::incrementalFilter(
+  const PointCloud2ConstPtr & input, PointCloud2 & output)
+{
+  const int vertical_bins = vertical_bins_;
+  float distance_coefficient = 327.67f;
+  float horizontal_resolution = 0.4f;
+  if (lidar_model_ == "PandarQT") {
+    distance_coefficient = 3276.75f;
+    horizontal_resolution = 0.6f;
+  }
+  const int ideal_horizontal_bins =
+    static_cast<int>((angle_range_deg_[1] - angle_range_deg_[0]) / horizontal_resolution);
+  const int ground_rows = vertical_bins - horizontal_ring_id_;
+
+  const auto ring_field = autoware_point_types::DynamicField<uint16_t>::from_msg(*input, "ring");
+  const auto azimuth_field = autoware_point_types::DynamicField<float>::from_msg(*input, "azimuth");
+  const auto distance_field =
+    autoware_point_types::DynamicField<float>::from_msg(*input, "distance");
+  if (!ring_field || !azimuth_field || !distance_field) {
+    RCLCPP_ERROR(get_logger(), "ring, azimuth or distance field is missing in input point cloud");
+    return;
+  }
+
+  // Bins are set when they have no return, as the depth map of filter() is initialized to 0.
+  // The last point falling in a bin decides its value, as in filter().
+  if (no_return_mask_.rows() != vertical_bins || no_return_mask_.cols() != ideal_horizontal_bins) {
+    no_return_mask_ = BinaryMask(vertical_bins, ideal_horizontal_bins);
+  }
+  no_return_mask_.fill(true);
+  const std::size_t num_points = input->width * input->height;
+  if (num_points == 0) {
+    if (ground_blockage_count_ <= 2 * blockage_count_threshold_) {
+      ground_blockage_count_ += 1;
+    }
+    if (sky_blockage_count_ <= 2 * blockage_count_threshold_) {
+      sky_blockage_count_ += 1;
+    }
+    ground_blockage_range_deg_[0] = angle_range_deg_[0];
+    ground_blockage_range_deg_[1] = angle_range_deg_[1];
+    sky_blockage_range_deg_[0] = angle_range_deg_[0];
+    sky_blockage_range_deg_[1] = angle_range_deg_[1];
+  } else if (lidar_model_ == "Pandar40P" || lidar_model_ == "PandarQT") {
+    const float first_bin_deg = angle_range_deg_[0] - horizontal_resolution / 2;
+    for (std::size_t i = 0; i < num_points; ++i) {
+      const uint8_t * point = &input->data[i * input->point_step];
+      const uint16_t ring = ring_field->read(point);
+      // the bin whose (center - resolution / 2, center + resolution / 2] range holds the azimuth
+      const float azimuth_deg = azimuth_field->read(point) / 100;
+      const int horizontal_bin =
+        static_cast<int>(std::ceil((azimuth_deg - first_bin_deg) / horizontal_resolution)) - 1;
+      if (ring >= vertical_bins || horizontal_bin < 0 || horizontal_bin >= ideal_horizontal_bins) {
+        continue;
+      }
+      const auto depth =
+        static_cast<uint16_t>(UINT16_MAX - distance_coefficient * distance_field->read(point));
+      const bool no_return = cv::saturate_cast<uint8_t>(depth * (1.0f / 300)) <= 1;
+      const int row = lidar_model_ == "Pandar40P" ? ring : vertical_bins - ring - 1;
+      no_return_mask_.set(row, horizontal_bin, no_return);
+    }
+  }
+
+  // blockage: opening of the no return mask
+  BinaryMask blockage_mask = no_return_mask_;
+  blockage_mask.erode(blockage_kernel_, blockage_kernel_);
+  blockage_mask.dilate(blockage_kernel_, blockage_kernel_);
+  ground_blockage_ratio_ =
+    static_cast<float>(blockage_mask.count(horizontal_ring_id_, vertical_bins)) /
+    static_cast<float>(ideal_horizontal_bins * ground_rows);
+  sky_blockage_ratio_ = static_cast<float>(blockage_mask.count(0, horizontal_ring_id_)) /
+                        static_cast<float>(ideal_horizontal_bins * horizontal_ring_id_);
+
+  int first_col = 0;
+  int last_col = -1;
+  if (ground_blockage_ratio_ > blockage_ratio_threshold_) {
+    blockage_mask.columnRange(horizontal_ring_id_, vertical_bins, first_col, last_col);
+    ground_blockage_range_deg_[0] = static_cast<float>(first_col) + angle_range_deg_[0];
+    ground_blockage_range_deg_[1] = static_cast<float>(last_col + 1) + angle_range_deg_[0];
+    if (ground_blockage_count_ <= 2 * blockage_count_threshold_) {
+      ground_blockage_count_ += 1;
+    }
+  } else {
+    ground_blockage_count_ = 0;
+  }
+  if (sky_blockage_ratio_ > blockage_ratio_threshold_) {
+    blockage_mask.columnRange(0, horizontal_ring_id_, first_col, last_col);
+    sky_blockage_range_deg_[0] = static_cast<float>(first_col) + angle_range_deg_[0];
+    sky_blockage_range_deg_[1] = static_cast<float>(last_col + 1) + angle_range_deg_[0];
+    if (sky_blockage_count_ <= 2 * blockage_count_threshold_) {
+      sky_blockage_count_ += 1;
+    }
+  } else {
+    sky_blockage_count_ = 0;
+  }
+
+  // dust: closing of the no return mask of the ground rows
+  BinaryMask dust_mask = no_return_mask_.subRows(horizontal_ring_id_, vertical_bins);
+  dust_mask.dilate(dust_kernel_size_, dust_kernel_size_);
+  dust_mask.erode(dust_kernel_size_, dust_kernel_size_);
+  // as in filter(), the dust count is updated with the ratio of the previous frame
+  if (ground_dust_ratio_ > dust_ratio_threshold_) {
+    if (dust_frame_count_ < 2 * dust_count_threshold_) {
+      dust_frame_count_++;
+    }
+  } else {
+    dust_frame_count_ = 0;
+  }
+  ground_dust_ratio_ = static_cast<float>(dust_mask.count(0, ground_rows)) /
+                       static_cast<float>(ideal_horizontal_bins * ground_rows);
+
+  // multi frame ratios, from the bins persisting over the buffered frames
+  const auto ground_bins = static_cast<float>(ideal_horizontal_bins * ground_rows);
+  if (blockage_buffering_interval_ == 0) {
+    multi_frame_ground_blockage_ratio_ = ground_blockage_ratio_;
+  } else {
+    if (blockage_frame_count_ >= blockage_buffering_interval_) {
+      ground_blockage_mask_counter_.push(
+        blockage_mask.subRows(horizontal_ring_id_, vertical_bins));
+      blockage_frame_count_ = 0;
+    } else {
+      blockage_frame_count_++;
+    }
+    multi_frame_ground_blockage_ratio_ =
+      static_cast<float>(ground_blockage_mask_counter_.persistentCount()) / ground_bins;
+  }
+  if (dust_buffering_interval_ == 0) {
+    multi_frame_ground_dust_ratio_ = ground_dust_ratio_;
+    dust_buffering_frame_counter_ = 0;
+  } else {
+    if (dust_buffering_frame_counter_ >= dust_buffering_interval_) {
+      ground_dust_mask_counter_.push(dust_mask);
+      dust_buffering_frame_counter_ = 0;
+    } else {
+      dust_buffering_frame_counter_++;
+    }
+    multi_frame_ground_dust_ratio_ =
+      static_cast<float>(ground_dust_mask_counter_.persistentCount()) / ground_bins;
+  }
+
+  tier4_debug_msgs::msg::Float32Stamped ground_blockage_ratio_msg;
+  ground_blockage_ratio_msg.data = ground_blockage_ratio_;
+  ground_blockage_ratio_msg.stamp = now();
+  ground_blockage_ratio_pub_->publish(ground_blockage_ratio_msg);
+
+  tier4_debug_msgs::msg::Float32Stamped sky_blockage_ratio_msg;
+  sky_blockage_ratio_msg.data = sky_blockage_ratio_;
+  sky_blockage_ratio_msg.stamp = now();
+  sky_blockage_ratio_pub_->publish(sky_blockage_ratio_msg);
+
+  tier4_debug_msgs::msg::Float32Stamped ground_dust_ratio_msg;
+  ground_dust_ratio_msg.data = ground_dust_ratio_;
+  ground_dust_ratio_msg.stamp = now();
+  ground_dust_ratio_pub_->publish(ground_dust_ratio_msg);
+
+  output = *input;
+}
+
 rcl_interfaces::msg::SetParametersResult BlockageDiagComponent::paramCallback(
   const std::vector<rclcpp::Parameter> & p)
 {
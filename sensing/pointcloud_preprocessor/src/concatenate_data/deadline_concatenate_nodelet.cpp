@@ -0,0 +1,363 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "pointcloud_preprocessor/concatenate_data/deadline_concatenate_nodelet.hpp"
+
+#include <Eigen/Geometry>
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+
+#ifdef ROS_DISTRO_GALACTIC
+#include <tf2_eigen/tf2_eigen.h>
+#else
+#include <tf2_eigen/tf2_eigen.hpp>
+#endif
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace pointcloud_preprocessor
+{
+PointCloudConcatenateDeadlineSynchronizerComponent::
+  PointCloudConcatenateDeadlineSynchronizerComponent(const rclcpp::NodeOptions & node_options)
+: Node("point_cloud_concatenator_deadline_component", node_options)
+{
+  // initialize debug tool
+  {
+    using tier4_autoware_utils::DebugPublisher;
+    using tier4_autoware_utils::StopWatch;
+    stop_watch_ptr_ = std::make_unique<StopWatch<std::chrono::milliseconds>>();
+    debug_publisher_ = std::make_unique<DebugPublisher>(this, "concatenate_data_synchronizer");
+    stop_watch_ptr_->tic("cyclic_time");
+    stop_watch_ptr_->tic("processing_time");
+  }
+
+  // Set parameters
+  output_frame_ = declare_parameter<std::string>("output_frame");
+  const auto input_topics = declare_parameter<std::vector<std::string>>("input_topics");
+  if (input_topics.size() < 2) {
+    throw std::invalid_argument("Need at least two input topics to concatenate");
+  }
+  const auto max_queue_size = static_cast<size_t>(declare_parameter("max_queue_size", 5));
+  timeout_sec_ = declare_parameter("timeout_sec", 0.1);
+  const auto input_offset = declare_parameter("input_offset", std::vector<double>{});
+  if (!input_offset.empty() && input_offset.size() != input_topics.size()) {
+    throw std::invalid_argument("The number of topics does not match the number of offsets");
+  }
+  const auto deadline_check_period_sec = declare_parameter("deadline_check_period_sec", 0.005);
+  const auto input_twist_topic_type = declare_parameter<std::string>("input_twist_topic_type", "twist");
+
+  slots_.resize(input_topics.size());
+  for (size_t i = 0; i < input_topics.size(); ++i) {
+    slots_.at(i).topic_name = input_topics.at(i);
+    slots_.at(i).offset_sec = input_offset.empty() ? 0.0 : input_offset.at(i);
+  }
+  clouds_to_concatenate_.reserve(slots_.size());
+
+  // tf2 listener
+  tf2_buffer_ = std::make_shared<tf2_ros::Buffer>(this->get_clock());
+  tf2_listener_ = std::make_shared<tf2_ros::TransformListener>(*tf2_buffer_);
+
+  // Output Publishers
+  pub_output_ = this->create_publisher<PointCloud2>(
+    "output", rclcpp::SensorDataQoS().keep_last(max_queue_size));
+
+  // Subscribers
+  // The cloud callbacks may run concurrently with each other and with the deadline timer.
+  cloud_callback_group_ = create_callback_group(rclcpp::CallbackGroupType::Reentrant);
+  timer_callback_group_ = create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
+  rclcpp::SubscriptionOptions cloud_sub_options;
+  cloud_sub_options.callback_group = cloud_callback_group_;
+  for (size_t i = 0; i < slots_.size(); ++i) {
+    std::function<void(const PointCloud2::ConstSharedPtr msg)> cb = std::bind(
+      &PointCloudConcatenateDeadlineSynchronizerComponent::cloudCallback, this,
+      std::placeholders::_1, i);
+    cloud_subs_.push_back(create_subscription<PointCloud2>(
+      slots_.at(i).topic_name, rclcpp::SensorDataQoS().keep_last(max_queue_size), cb,
+      cloud_sub_options));
+  }
+
+  if (input_twist_topic_type == "twist") {
+    sub_twist_ = create_subscription<geometry_msgs::msg::TwistWithCovarianceStamped>(
+      "~/input/twist", rclcpp::QoS{100},
+      std::bind(
+        &PointCloudConcatenateDeadlineSynchronizerComponent::twistCallback, this,
+        std::placeholders::_1));
+  } else if (input_twist_topic_type == "odom") {
+    sub_odom_ = create_subscription<nav_msgs::msg::Odometry>(
+      "~/input/odom", rclcpp::QoS{100},
+      std::bind(
+        &PointCloudConcatenateDeadlineSynchronizerComponent::odomCallback, this,
+        std::placeholders::_1));
+  } else {
+    throw std::invalid_argument("input_twist_topic_type is invalid: " + input_twist_topic_type);
+  }
+
+  // Set timer
+  // The period is never changed: the timer only compares the clock with the current deadline.
+  const auto period_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(
+    std::chrono::duration<double>(deadline_check_period_sec));
+  deadline_timer_ = rclcpp::create_timer(
+    this, get_clock(), period_ns,
+    std::bind(&PointCloudConcatenateDeadlineSynchronizerComponent::onDeadlineTimer, this),
+    timer_callback_group_);
+}
+
+void PointCloudConcatenateDeadlineSynchronizerComponent::cloudCallback(
+  const PointCloud2::ConstSharedPtr & input_ptr, size_t slot_index)
+{
+  if (input_ptr->data.empty()) {
+    RCLCPP_WARN_STREAM_THROTTLE(
+      this->get_logger(), *this->get_clock(), 1000, "Empty sensor points!");
+    return;
+  }
+
+  auto & slot = slots_.at(slot_index);
+
+  // A second cloud from the same lidar means the current cycle is over.
+  if (std::atomic_load(&slot.cloud)) {
+    tryPublish();
+  }
+
+  const auto previous_cloud = std::atomic_exchange(&slot.cloud, input_ptr);
+  const size_t num_filled_slots =
+    previous_cloud ? num_filled_slots_.load() : num_filled_slots_.fetch_add(1) + 1;
+
+  // Deadline of the cycle, as expected from the scan phase of the lidar which just arrived
+  const auto deadline =
+    this->now() + rclcpp::Duration::from_seconds(timeout_sec_ - slot.offset_sec);
+  deadline_ns_.store(deadline.nanoseconds());
+
+  if (num_filled_slots >= slots_.size()) {
+    tryPublish();
+  }
+}
+
+void PointCloudConcatenateDeadlineSynchronizerComponent::onDeadlineTimer()
+{
+  const int64_t deadline_ns = deadline_ns_.load();
+  if (deadline_ns != 0 && this->now().nanoseconds() >= deadline_ns) {
+    tryPublish();
+  }
+}
+
+void PointCloudConcatenateDeadlineSynchronizerComponent::tryPublish()
+{
+  bool expected = false;
+  if (!is_publishing_.compare_exchange_strong(expected, true)) {
+    // Another thread is concatenating this cycle
+    return;
+  }
+
+  stop_watch_ptr_->toc("processing_time", true);
+
+  // Step1. take the clouds of this cycle out of the slots
+  clouds_to_concatenate_.clear();
+  for (auto & slot : slots_) {
+    auto cloud = std::atomic_exchange(&slot.cloud, PointCloud2::ConstSharedPtr{});
+    if (cloud) {
+      clouds_to_concatenate_.push_back(std::move(cloud));
+    }
+  }
+  const size_t num_taken_clouds = clouds_to_concatenate_.size();
+  // Clouds of the next cycle may have arrived in the meantime, keep their deadline if so.
+  if (num_filled_slots_.fetch_sub(num_taken_clouds) == num_taken_clouds) {
+    deadline_ns_.store(0);
+  }
+
+  if (clouds_to_concatenate_.empty()) {
+    is_publishing_.store(false);
+    return;
+  }
+
+  // Step2. compute the size of the output so that it is allocated only once
+  auto oldest_cloud = clouds_to_concatenate_.front();
+  size_t num_output_points = 0;
+  for (const auto & cloud : clouds_to_concatenate_) {
+    if (rclcpp::Time(cloud->header.stamp) < rclcpp::Time(oldest_cloud->header.stamp)) {
+      oldest_cloud = cloud;
+    }
+    num_output_points += cloud->width * cloud->height;
+  }
+  const double oldest_stamp = rclcpp::Time(oldest_cloud->header.stamp).seconds();
+
+  auto output = std::make_unique<PointCloud2>();
+  output->header.frame_id = output_frame_;
+  output->header.stamp = oldest_cloud->header.stamp;
+  sensor_msgs::PointCloud2Modifier modifier(*output);
+  modifier.setPointCloud2Fields(
+    4, "x", 1, sensor_msgs::msg::PointField::FLOAT32, "y", 1,
+    sensor_msgs::msg::PointField::FLOAT32, "z", 1, sensor_msgs::msg::PointField::FLOAT32,
+    "intensity", 1, sensor_msgs::msg::PointField::FLOAT32);
+  modifier.resize(num_output_points);
+
+  // Step3. transform each point with a single matrix (sensor -> output frame -> oldest stamp)
+  // and write it straight into the output
+  size_t output_offset = 0;
+  for (const auto & cloud : clouds_to_concatenate_) {
+    Eigen::Matrix4f sensor_to_output;
+    if (!lookupStaticTransform(cloud->header.frame_id, sensor_to_output)) {
+      continue;
+    }
+    const Eigen::Matrix4f transform =
+      computeTransformToAdjustForOldTimestamp(
+        oldest_stamp, rclcpp::Time(cloud->header.stamp).seconds()) *
+      sensor_to_output;
+
+    int x_offset = -1;
+    int y_offset = -1;
+    int z_offset = -1;
+    int intensity_offset = -1;
+    for (const auto & field : cloud->fields) {
+      if (field.name == "x") x_offset = field.offset;
+      if (field.name == "y") y_offset = field.offset;
+      if (field.name == "z") z_offset = field.offset;
+      if (field.name == "intensity" && field.datatype == sensor_msgs::msg::PointField::FLOAT32) {
+        intensity_offset = field.offset;
+      }
+    }
+    if (x_offset < 0 || y_offset < 0 || z_offset < 0) {
+      RCLCPP_WARN_THROTTLE(
+        get_logger(), *get_clock(), 1000, "Cloud from %s has no xyz fields, skipping it.",
+        cloud->header.frame_id.c_str());
+      continue;
+    }
+
+    for (size_t in_offset = 0; in_offset + cloud->point_step <= cloud->data.size();
+         in_offset += cloud->point_step) {
+      const uint8_t * in_point = &cloud->data[in_offset];
+      Eigen::Vector4f point(0.0f, 0.0f, 0.0f, 1.0f);
+      std::memcpy(&point[0], in_point + x_offset, sizeof(float));
+      std::memcpy(&point[1], in_point + y_offset, sizeof(float));
+      std::memcpy(&point[2], in_point + z_offset, sizeof(float));
+      float out_point[4];
+      Eigen::Map<Eigen::Vector3f>(out_point) = (transform * point).head<3>();
+      out_point[3] = 0.0f;
+      if (intensity_offset >= 0) {
+        std::memcpy(&out_point[3], in_point + intensity_offset, sizeof(float));
+      }
+      std::memcpy(&output->data[output_offset], out_point, sizeof(out_point));
+      output_offset += sizeof(out_point);
+    }
+  }
+
+  // Clouds which could not be transformed leave unused room at the end of the output
+  output->data.resize(output_offset);
+  output->width = output_offset / output->point_step;
+  output->row_step = output_offset;
+
+  clouds_to_concatenate_.clear();
+  is_publishing_.store(false);
+
+  if (num_taken_clouds < slots_.size()) {
+    RCLCPP_WARN_THROTTLE(
+      get_logger(), *get_clock(), 1000, "Published with %zu of %zu pointclouds", num_taken_clouds,
+      slots_.size());
+  }
+  pub_output_->publish(std::move(output));
+
+  // add processing time for debug
+  if (debug_publisher_) {
+    const double cyclic_time_ms = stop_watch_ptr_->toc("cyclic_time", true);
+    const double processing_time_ms = stop_watch_ptr_->toc("processing_time", true);
+    debug_publisher_->publish<tier4_debug_msgs::msg::Float64Stamped>(
+      "debug/cyclic_time_ms", cyclic_time_ms);
+    debug_publisher_->publish<tier4_debug_msgs::msg::Float64Stamped>(
+      "debug/processing_time_ms", processing_time_ms);
+  }
+}
+
+bool PointCloudConcatenateDeadlineSynchronizerComponent::lookupStaticTransform(
+  const std::string & source_frame, Eigen::Matrix4f & transform)
+{
+  if (source_frame == output_frame_) {
+    transform = Eigen::Matrix4f::Identity();
+    return true;
+  }
+  try {
+    const auto transform_msg =
+      tf2_buffer_->lookupTransform(output_frame_, source_frame, tf2::TimePointZero);
+    transform = tf2::transformToEigen(transform_msg.transform).matrix().cast<float>();
+  } catch (const tf2::TransformException & ex) {
+    RCLCPP_WARN_THROTTLE(get_logger(), *get_clock(), 1000, "%s", ex.what());
+    return false;
+  }
+  return true;
+}
+
+Eigen::Matrix4f
+PointCloudConcatenateDeadlineSynchronizerComponent::computeTransformToAdjustForOldTimestamp(
+  double old_stamp, double new_stamp)
+{
+  std::lock_guard<std::mutex> lock(twist_mutex_);
+
+  // return identity if no twist is available
+  if (twist_history_.empty() || old_stamp >= new_stamp) {
+    return Eigen::Matrix4f::Identity();
+  }
+
+  const size_t old_index = twist_history_.find(old_stamp);
+  const size_t new_index = twist_history_.find(new_stamp);
+
+  double prev_time = old_stamp;
+  double x = 0.0;
+  double y = 0.0;
+  double yaw = 0.0;
+  for (size_t i = old_index; i <= new_index; ++i) {
+    const double dt = (i != new_index ? twist_history_.stamp(i) : new_stamp) - prev_time;
+    if (std::fabs(dt) > 0.1) {
+      RCLCPP_WARN_STREAM_THROTTLE(
+        get_logger(), *get_clock(), std::chrono::milliseconds(10000).count(),
+        "Time difference is too large. Cloud not interpolate. Please confirm twist topic and "
+        "timestamp");
+      break;
+    }
+
+    const double dis = twist_history_.linearX(i) * dt;
+    yaw += twist_history_.angularZ(i) * dt;
+    x += dis * std::cos(yaw);
+    y += dis * std::sin(yaw);
+    prev_time = twist_history_.stamp(i);
+  }
+
+  Eigen::AngleAxisf rotation_z(yaw, Eigen::Vector3f::UnitZ());
+  Eigen::Translation3f translation(x, y, 0);
+  return (translation * rotation_z).matrix();
+}
+
+void PointCloudConcatenateDeadlineSynchronizerComponent::twistCallback(
+  const geometry_msgs::msg::TwistWithCovarianceStamped::ConstSharedPtr input)
+{
+  std::lock_guard<std::mutex> lock(twist_mutex_);
+  twist_history_.push(
+    rclcpp::Time(input->header.stamp).seconds(), static_cast<float>(input->twist.twist.linear.x),
+    static_cast<float>(input->twist.twist.angular.z));
+}
+
+void PointCloudConcatenateDeadlineSynchronizerComponent::odomCallback(
+  const nav_msgs::msg::Odometry::ConstSharedPtr input)
+{
+  std::lock_guard<std::mutex> lock(twist_mutex_);
+  twist_history_.push(
+    rclcpp::Time(input->header.stamp).seconds(), static_cast<float>(input->twist.twist.linear.x),
+    static_cast<float>(input->twist.twist.angular.z));
+}
+}  // namespace pointcloud_preprocessor
+
+#include <rclcpp_components/register_node_macro.hpp>
+RCLCPP_COMPONENTS_REGISTER_NODE(
+  pointcloud_preprocessor::PointCloudConcatenateDeadlineSynchronizerComponent)
@@ -80,9 +80,14 @@ CropBoxFilterComponent::CropBoxFilterComponent(const rclcpp::NodeOptions & optio
     p.max_y = static_cast<float>(declare_parameter("max_y", 1.0));
     p.max_z = static_cast<float>(declare_parameter("max_z", 1.0));
     p.negative = static_cast<bool>(declare_parameter("negative", false));
+    use_vectorized_kernel_ = static_cast<bool>(declare_parameter("use_vectorized_kernel", true));
+    use_transform_cache_ = static_cast<bool>(declare_parameter("use_transform_cache", false));
     if (tf_input_frame_.empty()) {
       throw std::invalid_argument("Crop box requires non-empty input_frame");
     }
+    if (use_vectorized_kernel_ && !crop_box_kernel::is_vectorized_supported()) {
+      RCLCPP_INFO(get_logger(), "Vectorized crop box kernel is not supported on this CPU");
+    }
   }
 
   // set additional publishers
@@ -123,55 +128,35 @@ void CropBoxFilterComponent::faster_filter(
       get_logger(), *get_clock(), 1000, "Indices are not supported and will be ignored");
   }
 
-  int x_offset = input->fields[pcl::getFieldIndex(*input, "x")].offset;
-  int y_offset = input->fields[pcl::getFieldIndex(*input, "y")].offset;
-  int z_offset = input->fields[pcl::getFieldIndex(*input, "z")].offset;
-
-  output.data.resize(input->data.size());
-  size_t output_size = 0;
-
-  int skipped_count = 0;
+  crop_box_kernel::Layout layout;
+  layout.point_step = input->point_step;
+  layout.x_offset = input->fields[pcl::getFieldIndex(*input, "x")].offset;
+  layout.y_offset = input->fields[pcl::getFieldIndex(*input, "y")].offset;
+  layout.z_offset = input->fields[pcl::getFieldIndex(*input, "z")].offset;
 
-  for (size_t global_offset = 0; global_offset + input->point_step <= input->data.size();
-       global_offset += input->point_step) {
-    Eigen::Vector4f point;
-    std::memcpy(&point[0], &input->data[global_offset + x_offset], sizeof(float));
-    std::memcpy(&point[1], &input->data[global_offset + y_offset], sizeof(float));
-    std::memcpy(&point[2], &input->data[global_offset + z_offset], sizeof(float));
-    point[3] = 1;
+  const crop_box_kernel::Box box{param_.min_x, param_.max_x, param_.min_y, param_.max_y,
+                                 param_.min_z, param_.max_z, param_.negative};
 
-    if (!std::isfinite(point[0]) || !std::isfinite(point[1]) || !std::isfinite(point[2])) {
-      skipped_count++;
-      continue;
-    }
-
-    if (transform_info.need_transform) {
-      point = transform_info.eigen_transform * point;
-    }
+  // Eigen matrices are column-major, which is the layout the kernels expect
+  const float * transform =
+    transform_info.need_transform ? transform_info.eigen_transform.data() : nullptr;
 
-    bool point_is_inside = point[2] > param_.min_z && point[2] < param_.max_z &&
-                           point[1] > param_.min_y && point[1] < param_.max_y &&
-                           point[0] > param_.min_x && point[0] < param_.max_x;
-    if ((!param_.negative && point_is_inside) || (param_.negative && !point_is_inside)) {
-      memcpy(&output.data[output_size], &input->data[global_offset], input->point_step);
-
-      if (transform_info.need_transform) {
-        std::memcpy(&output.data[output_size + x_offset], &point[0], sizeof(float));
-        std::memcpy(&output.data[output_size + y_offset], &point[1], sizeof(float));
-        std::memcpy(&output.data[output_size + z_offset], &point[2], sizeof(float));
-      }
-
-      output_size += input->point_step;
-    }
-  }
-
-  if (skipped_count > 0) {
+  output.data.resize(input->data.size());
+  const size_t num_points = input->point_step ? input->data.size() / input->point_step : 0;
+  const auto result =
+    use_vectorized_kernel_
+      ? crop_box_kernel::crop_box(
+          input->data.data(), num_points, layout, transform, box, output.data.data())
+      : crop_box_kernel::crop_box_scalar(
+          input->data.data(), num_points, layout, transform, box, output.data.data());
+
+  if (result.skipped_count > 0) {
     RCLCPP_WARN_THROTTLE(
       get_logger(), *get_clock(), 1000, "%d points contained NaN values and have been ignored",
-      skipped_count);
+      result.skipped_count);
   }
 
-  output.data.resize(output_size);
+  output.data.resize(result.output_size);
 
   // Note that tf_input_orig_frame_ is the input frame, while tf_input_frame_ is the frame of the
   // crop box
@@ -0,0 +1,335 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "pointcloud_preprocessor/crop_box_filter/crop_box_kernel.hpp"
+
+#include <cmath>
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define CROP_BOX_KERNEL_AVX2
+#include <immintrin.h>
+#elif defined(__ARM_NEON)
+#define CROP_BOX_KERNEL_NEON
+#include <arm_neon.h>
+#endif
+
+namespace pointcloud_preprocessor::crop_box_kernel
+{
+namespace
+{
+constexpr size_t batch_size = 8;
+
+// Transformed coordinates are computed as ((m0 * x + m4 * y) + m8 * z) + m12, which is the order
+// Eigen uses for a column-major Matrix4f times Vector4f. The vectorized kernels use the same order
+// so that points on the box boundary are classified the same way by every kernel.
+inline void transform_point(const float * m, float & x, float & y, float & z)
+{
+  const float tx = m[0] * x + m[4] * y + m[8] * z + m[12];
+  const float ty = m[1] * x + m[5] * y + m[9] * z + m[13];
+  const float tz = m[2] * x + m[6] * y + m[10] * z + m[14];
+  x = tx;
+  y = ty;
+  z = tz;
+}
+
+inline float read_float(const uint8_t * p)
+{
+  float value;
+  std::memcpy(&value, p, sizeof(float));
+  return value;
+}
+
+// Copy the points of a batch selected by `keep_mask` (bit i set: keep point i).
+inline size_t compact_batch(
+  const uint8_t * input, const Layout & layout, const float * transform, uint32_t keep_mask,
+  const float * xs, const float * ys, const float * zs, uint8_t * output)
+{
+  size_t output_size = 0;
+  while (keep_mask) {
+    const int i = __builtin_ctz(keep_mask);
+    keep_mask &= keep_mask - 1;
+
+    uint8_t * out_point = output + output_size;
+    std::memcpy(out_point, input + i * layout.point_step, layout.point_step);
+    if (transform) {
+      std::memcpy(out_point + layout.x_offset, &xs[i], sizeof(float));
+      std::memcpy(out_point + layout.y_offset, &ys[i], sizeof(float));
+      std::memcpy(out_point + layout.z_offset, &zs[i], sizeof(float));
+    }
+    output_size += layout.point_step;
+  }
+  return output_size;
+}
+
+#ifdef CROP_BOX_KERNEL_AVX2
+__attribute__((target("avx2"))) Result crop_box_avx2(
+  const uint8_t * input, size_t num_points, const Layout & layout, const float * transform,
+  const Box & box, uint8_t * output)
+{
+  Result result{0, 0};
+
+  const auto step = static_cast<int>(layout.point_step);
+  const __m256i point_index = _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7);
+  const __m256i byte_offsets = _mm256_mullo_epi32(point_index, _mm256_set1_epi32(step));
+  const __m256i x_index = _mm256_add_epi32(byte_offsets, _mm256_set1_epi32(layout.x_offset));
+  const __m256i y_index = _mm256_add_epi32(byte_offsets, _mm256_set1_epi32(layout.y_offset));
+  const __m256i z_index = _mm256_add_epi32(byte_offsets, _mm256_set1_epi32(layout.z_offset));
+
+  const __m256 abs_mask = _mm256_castsi256_ps(_mm256_set1_epi32(0x7fffffff));
+  const __m256 inf = _mm256_set1_ps(INFINITY);
+  const __m256 min_x = _mm256_set1_ps(box.min_x);
+  const __m256 max_x = _mm256_set1_ps(box.max_x);
+  const __m256 min_y = _mm256_set1_ps(box.min_y);
+  const __m256 max_y = _mm256_set1_ps(box.max_y);
+  const __m256 min_z = _mm256_set1_ps(box.min_z);
+  const __m256 max_z = _mm256_set1_ps(box.max_z);
+
+  __m256 m[16];
+  if (transform) {
+    for (int i = 0; i < 16; ++i) {
+      m[i] = _mm256_set1_ps(transform[i]);
+    }
+  }
+
+  alignas(32) float xs[batch_size];
+  alignas(32) float ys[batch_size];
+  alignas(32) float zs[batch_size];
+
+  size_t i = 0;
+  for (; i + batch_size <= num_points; i += batch_size) {
+    const uint8_t * batch = input + i * layout.point_step;
+    const auto * base = reinterpret_cast<const float *>(batch);
+    __m256 x = _mm256_i32gather_ps(base, x_index, 1);
+    __m256 y = _mm256_i32gather_ps(base, y_index, 1);
+    __m256 z = _mm256_i32gather_ps(base, z_index, 1);
+
+    // |v| < inf is false for both infinities and NaN
+    const __m256 finite = _mm256_and_ps(
+      _mm256_and_ps(
+        _mm256_cmp_ps(_mm256_and_ps(x, abs_mask), inf, _CMP_LT_OQ),
+        _mm256_cmp_ps(_mm256_and_ps(y, abs_mask), inf, _CMP_LT_OQ)),
+      _mm256_cmp_ps(_mm256_and_ps(z, abs_mask), inf, _CMP_LT_OQ));
+    const uint32_t finite_mask = static_cast<uint32_t>(_mm256_movemask_ps(finite));
+    result.skipped_count += static_cast<int>(batch_size) - __builtin_popcount(finite_mask);
+
+    if (transform) {
+      const __m256 tx = _mm256_add_ps(
+        _mm256_add_ps(
+          _mm256_add_ps(_mm256_mul_ps(m[0], x), _mm256_mul_ps(m[4], y)), _mm256_mul_ps(m[8], z)),
+        m[12]);
+      const __m256 ty = _mm256_add_ps(
+        _mm256_add_ps(
+          _mm256_add_ps(_mm256_mul_ps(m[1], x), _mm256_mul_ps(m[5], y)), _mm256_mul_ps(m[9], z)),
+        m[13]);
+      const __m256 tz = _mm256_add_ps(
+        _mm256_add_ps(
+          _mm256_add_ps(_mm256_mul_ps(m[2], x), _mm256_mul_ps(m[6], y)), _mm256_mul_ps(m[10], z)),
+        m[14]);
+      x = tx;
+      y = ty;
+      z = tz;
+    }
+
+    const __m256 inside = _mm256_and_ps(
+      _mm256_and_ps(
+        _mm256_and_ps(_mm256_cmp_ps(x, min_x, _CMP_GT_OQ), _mm256_cmp_ps(x, max_x, _CMP_LT_OQ)),
+        _mm256_and_ps(_mm256_cmp_ps(y, min_y, _CMP_GT_OQ), _mm256_cmp_ps(y, max_y, _CMP_LT_OQ))),
+      _mm256_and_ps(_mm256_cmp_ps(z, min_z, _CMP_GT_OQ), _mm256_cmp_ps(z, max_z, _CMP_LT_OQ)));
+    uint32_t inside_mask = static_cast<uint32_t>(_mm256_movemask_ps(inside));
+    if (box.negative) inside_mask = ~inside_mask & 0xffu;
+
+    const uint32_t keep_mask = inside_mask & finite_mask;
+    if (!keep_mask) continue;
+
+    _mm256_store_ps(xs, x);
+    _mm256_store_ps(ys, y);
+    _mm256_store_ps(zs, z);
+    result.output_size += compact_batch(
+      batch, layout, transform, keep_mask, xs, ys, zs, output + result.output_size);
+  }
+
+  const Result tail = crop_box_scalar(
+    input + i * layout.point_step, num_points - i, layout, transform, box,
+    output + result.output_size);
+  result.output_size += tail.output_size;
+  result.skipped_count += tail.skipped_count;
+  return result;
+}
+#endif  // CROP_BOX_KERNEL_AVX2
+
+#ifdef CROP_BOX_KERNEL_NEON
+inline uint32x4_t is_finite(float32x4_t v)
+{
+  return vcltq_f32(vabsq_f32(v), vdupq_n_f32(INFINITY));
+}
+
+inline float32x4_t transform_lane(
+  const float * m, int row, float32x4_t x, float32x4_t y, float32x4_t z)
+{
+  return vaddq_f32(
+    vaddq_f32(
+      vaddq_f32(vmulq_n_f32(x, m[row]), vmulq_n_f32(y, m[row + 4])), vmulq_n_f32(z, m[row + 8])),
+    vdupq_n_f32(m[row + 12]));
+}
+
+inline uint32_t lane_mask(uint32x4_t v)
+{
+  const uint32_t bits[4] = {1u, 2u, 4u, 8u};
+  return vaddvq_u32(vandq_u32(v, vld1q_u32(bits)));
+}
+
+Result crop_box_neon(
+  const uint8_t * input, size_t num_points, const Layout & layout, const float * transform,
+  const Box & box, uint8_t * output)
+{
+  Result result{0, 0};
+
+  float xs[batch_size];
+  float ys[batch_size];
+  float zs[batch_size];
+
+  size_t i = 0;
+  for (; i + batch_size <= num_points; i += batch_size) {
+    const uint8_t * batch = input + i * layout.point_step;
+    // NEON has no gather, load the coordinates into contiguous lanes first
+    for (size_t j = 0; j < batch_size; ++j) {
+      const uint8_t * p = batch + j * layout.point_step;
+      xs[j] = read_float(p + layout.x_offset);
+      ys[j] = read_float(p + layout.y_offset);
+      zs[j] = read_float(p + layout.z_offset);
+    }
+
+    uint32_t finite_mask = 0;
+    uint32_t inside_mask = 0;
+    for (size_t half = 0; half < batch_size; half += 4) {
+      float32x4_t x = vld1q_f32(xs + half);
+      float32x4_t y = vld1q_f32(ys + half);
+      float32x4_t z = vld1q_f32(zs + half);
+
+      const uint32x4_t finite = vandq_u32(vandq_u32(is_finite(x), is_finite(y)), is_finite(z));
+      finite_mask |= lane_mask(finite) << half;
+
+      if (transform) {
+        const float32x4_t tx = transform_lane(transform, 0, x, y, z);
+        const float32x4_t ty = transform_lane(transform, 1, x, y, z);
+        const float32x4_t tz = transform_lane(transform, 2, x, y, z);
+        x = tx;
+        y = ty;
+        z = tz;
+        vst1q_f32(xs + half, x);
+        vst1q_f32(ys + half, y);
+        vst1q_f32(zs + half, z);
+      }
+
+      const uint32x4_t inside = vandq_u32(
+        vandq_u32(
+          vandq_u32(vcgtq_f32(x, vdupq_n_f32(box.min_x)), vcltq_f32(x, vdupq_n_f32(box.max_x))),
+          vandq_u32(vcgtq_f32(y, vdupq_n_f32(box.min_y)), vcltq_f32(y, vdupq_n_f32(box.max_y)))),
+        vandq_u32(vcgtq_f32(z, vdupq_n_f32(box.min_z)), vcltq_f32(z, vdupq_n_f32(box.max_z))));
+      inside_mask |= lane_mask(inside) << half;
+    }
+    result.skipped_count += static_cast<int>(batch_size) - __builtin_popcount(finite_mask);
+    if (box.negative) inside_mask = ~inside_mask & 0xffu;
+
+    const uint32_t keep_mask = inside_mask & finite_mask;
+    if (!keep_mask) continue;
+
+    result.output_size += compact_batch(
+      batch, layout, transform, keep_mask, xs, ys, zs, output + result.output_size);
+  }
+
+  const Result tail = crop_box_scalar(
+    input + i * layout.point_step, num_points - i, layout, transform, box,
+    output + result.output_size);
+  result.output_size += tail.output_size;
+  result.skipped_count += tail.skipped_count;
+  return result;
+}
+#endif  // CROP_BOX_KERNEL_NEON
+}  // namespace
+
+Result crop_box_scalar(
+  const uint8_t * input, size_t num_points, const Layout & layout, const float * transform,
+  const Box & box, uint8_t * output)
+{
+  Result result{0, 0};
+
+  for (size_t i = 0; i < num_points; ++i) {
+    const uint8_t * in_point = input + i * layout.point_step;
+    float x = read_float(in_point + layout.x_offset);
+    float y = read_float(in_point + layout.y_offset);
+    float z = read_float(in_point + layout.z_offset);
+
+    if (!std::isfinite(x) || !std::isfinite(y) || !std::isfinite(z)) {
+      result.skipped_count++;
+      continue;
+    }
+
+    if (transform) {
+      transform_point(transform, x, y, z);
+    }
+
+    const bool point_is_inside = z > box.min_z && z < box.max_z && y > box.min_y &&
+                                 y < box.max_y && x > box.min_x && x < box.max_x;
+    if (point_is_inside == box.negative) continue;
+
+    uint8_t * out_point = output + result.output_size;
+    std::memcpy(out_point, in_point, layout.point_step);
+    if (transform) {
+      std::memcpy(out_point + layout.x_offset, &x, sizeof(float));
+      std::memcpy(out_point + layout.y_offset, &y, sizeof(float));
+      std::memcpy(out_point + layout.z_offset, &z, sizeof(float));
+    }
+    result.output_size += layout.point_step;
+  }
+
+  return result;
+}
+
+Result crop_box_vectorized(
+  const uint8_t * input, size_t num_points, const Layout & layout, const float * transform,
+  const Box & box, uint8_t * output)
+{
+#if defined(CROP_BOX_KERNEL_AVX2)
+  return crop_box_avx2(input, num_points, layout, transform, box, output);
+#elif defined(CROP_BOX_KERNEL_NEON)
+  return crop_box_neon(input, num_points, layout, transform, box, output);
+#else
+  return crop_box_scalar(input, num_points, layout, transform, box, output);
+#endif
+}
+
+bool is_vectorized_supported()
+{
+#if defined(CROP_BOX_KERNEL_AVX2)
+  static const bool supported = __builtin_cpu_supports("avx2");
+  return supported;
+#elif defined(CROP_BOX_KERNEL_NEON)
+  return true;
+#else
+  return false;
+#endif
+}
+
+Result crop_box(
+  const uint8_t * input, size_t num_points, const Layout & layout, const float * transform,
+  const Box & box, uint8_t * output)
+{
+  if (is_vectorized_supported()) {
+    return crop_box_vectorized(input, num_points, layout, transform, box, output);
+  }
+  return crop_box_scalar(input, num_points, layout, transform, box, output);
+}
+}  // namespace pointcloud_preprocessor::crop_box_kernel
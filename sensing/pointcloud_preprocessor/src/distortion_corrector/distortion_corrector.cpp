@@ -16,7 +16,7 @@
 
 #include "tier4_autoware_utils/math/trigonometry.hpp"
 
-#include <deque>
+#include <limits>
 #include <string>
 #include <utility>
 
@@ -39,6 +39,7 @@ DistortionCorrectorComponent::DistortionCorrectorComponent(const rclcpp::NodeOpt
   // Parameter
   time_stamp_field_name_ = declare_parameter("time_stamp_field_name", "time_stamp");
   use_imu_ = declare_parameter("use_imu", true);
+  block_duration_ = declare_parameter("block_duration", 0.001);
 
   // Publisher
   undistorted_points_pub_ =
@@ -60,22 +61,10 @@ DistortionCorrectorComponent::DistortionCorrectorComponent(const rclcpp::NodeOpt
 void DistortionCorrectorComponent::onTwistWithCovarianceStamped(
   const geometry_msgs::msg::TwistWithCovarianceStamped::ConstSharedPtr twist_msg)
 {
-  geometry_msgs::msg::TwistStamped msg;
-  msg.header = twist_msg->header;
-  msg.twist = twist_msg->twist.twist;
-  twist_queue_.push_back(msg);
-
-  while (!twist_queue_.empty()) {
-    // for replay rosbag
-    if (rclcpp::Time(twist_queue_.front().header.stamp) > rclcpp::Time(twist_msg->header.stamp)) {
-      twist_queue_.pop_front();
-    } else if (  // NOLINT
-      rclcpp::Time(twist_queue_.front().header.stamp) <
-      rclcpp::Time(twist_msg->header.stamp) - rclcpp::Duration::from_seconds(1.0)) {
-      twist_queue_.pop_front();
-    }
-    break;
-  }
+  twist_history_.push(
+    rclcpp::Time(twist_msg->header.stamp).seconds(),
+    static_cast<float>(twist_msg->twist.twist.linear.x),
+    static_cast<float>(twist_msg->twist.twist.angular.z));
 }
 
 void DistortionCorrectorComponent::onImu(const sensor_msgs::msg::Imu::ConstSharedPtr imu_msg)
@@ -95,22 +84,9 @@ void DistortionCorrectorComponent::onImu(const sensor_msgs::msg::Imu::ConstShare
 
   geometry_msgs::msg::Vector3Stamped transformed_angular_velocity;
   tf2::doTransform(angular_velocity, transformed_angular_velocity, *tf_base2imu_ptr);
-  transformed_angular_velocity.header = imu_msg->header;
-  angular_velocity_queue_.push_back(transformed_angular_velocity);
-
-  while (!angular_velocity_queue_.empty()) {
-    // for replay rosbag
-    if (
-      rclcpp::Time(angular_velocity_queue_.front().header.stamp) >
-      rclcpp::Time(imu_msg->header.stamp)) {
-      angular_velocity_queue_.pop_front();
-    } else if (  // NOLINT
-      rclcpp::Time(angular_velocity_queue_.front().header.stamp) <
-      rclcpp::Time(imu_msg->header.stamp) - rclcpp::Duration::from_seconds(1.0)) {
-      angular_velocity_queue_.pop_front();
-    }
-    break;
-  }
+  angular_velocity_history_.push(
+    rclcpp::Time(imu_msg->header.stamp).seconds(), 0.0f,
+    static_cast<float>(transformed_angular_velocity.vector.z));
 }
 
 void DistortionCorrectorComponent::onPointCloud(PointCloud2::UniquePtr points_msg)
@@ -170,10 +146,10 @@ bool DistortionCorrectorComponent::getTransform(
 bool DistortionCorrectorComponent::undistortPointCloud(
   const tf2::Transform & tf2_base_link_to_sensor, PointCloud2 & points)
 {
-  if (points.data.empty() || twist_queue_.empty()) {
+  if (points.data.empty() || twist_history_.empty()) {
     RCLCPP_WARN_STREAM_THROTTLE(
       get_logger(), *get_clock(), 10000 /* ms */,
-      "input_pointcloud->points or twist_queue_ is empty.");
+      "input_pointcloud->points or twist history is empty.");
     return false;
   }
 
@@ -198,30 +174,47 @@ bool DistortionCorrectorComponent::undistortPointCloud(
   float x{0.0f};
   float y{0.0f};
   double prev_time_stamp_sec{*it_time_stamp};
-  const double first_point_time_stamp_sec{*it_time_stamp};
 
-  auto twist_it = std::lower_bound(
-    std::begin(twist_queue_), std::end(twist_queue_), first_point_time_stamp_sec,
-    [](const geometry_msgs::msg::TwistStamped & x, const double t) {
-      return rclcpp::Time(x.header.stamp).seconds() < t;
-    });
-  twist_it = twist_it == std::end(twist_queue_) ? std::end(twist_queue_) - 1 : twist_it;
-
-  decltype(angular_velocity_queue_)::iterator imu_it;
-  if (use_imu_ && !angular_velocity_queue_.empty()) {
-    imu_it = std::lower_bound(
-      std::begin(angular_velocity_queue_), std::end(angular_velocity_queue_),
-      first_point_time_stamp_sec, [](const geometry_msgs::msg::Vector3Stamped & x, const double t) {
-        return rclcpp::Time(x.header.stamp).seconds() < t;
-      });
-    imu_it =
-      imu_it == std::end(angular_velocity_queue_) ? std::end(angular_velocity_queue_) - 1 : imu_it;
-  }
+  const bool use_imu = use_imu_ && !angular_velocity_history_.empty();
 
-  const tf2::Transform tf2_base_link_to_sensor_inv{tf2_base_link_to_sensor.inverse()};
+  // The velocities are looked up once per block of `block_duration_` seconds instead of once per
+  // point, and stay constant within a block. As a pointcloud is processed from its first point,
+  // a pointcloud holding a single lidar packet can be undistorted as soon as it is received.
+  struct BlockVelocity
+  {
+    double end_stamp;
+    float v;
+    float w;
+  };
+  BlockVelocity block{-std::numeric_limits<double>::infinity(), 0.0f, 0.0f};
+  auto lookupBlockVelocity = [&](const double stamp) {
+    const size_t twist_index = twist_history_.find(stamp);
+    const double twist_stamp = twist_history_.stamp(twist_index);
+
+    BlockVelocity block_velocity{stamp + block_duration_, twist_history_.linearX(twist_index),
+                                 twist_history_.angularZ(twist_index)};
+    if (std::abs(stamp - twist_stamp) > 0.1) {
+      RCLCPP_WARN_STREAM_THROTTLE(
+        get_logger(), *get_clock(), 10000 /* ms */,
+        "twist time_stamp is too late. Could not interpolate.");
+      block_velocity.v = 0.0f;
+      block_velocity.w = 0.0f;
+    }
 
-  // For performance, do not instantiate `rclcpp::Time` inside of the for-loop
-  double twist_stamp = rclcpp::Time(twist_it->header.stamp).seconds();
+    if (use_imu) {
+      const size_t imu_index = angular_velocity_history_.find(stamp);
+      if (std::abs(stamp - angular_velocity_history_.stamp(imu_index)) > 0.1) {
+        RCLCPP_WARN_STREAM_THROTTLE(
+          get_logger(), *get_clock(), 10000 /* ms */,
+          "imu time_stamp is too late. Could not interpolate.");
+      } else {
+        block_velocity.w = angular_velocity_history_.angularZ(imu_index);
+      }
+    }
+    return block_velocity;
+  };
+
+  const tf2::Transform tf2_base_link_to_sensor_inv{tf2_base_link_to_sensor.inverse()};
 
   // For performance, instantiate outside of the for-loop
   tf2::Quaternion baselink_quat{};
@@ -233,45 +226,12 @@ bool DistortionCorrectorComponent::undistortPointCloud(
   bool need_transform = points.header.frame_id != base_link_frame_;
 
   for (; it_x != it_x.end(); ++it_x, ++it_y, ++it_z, ++it_time_stamp) {
-    while (twist_it != std::end(twist_queue_) - 1 && *it_time_stamp > twist_stamp) {
-      ++twist_it;
-      twist_stamp = rclcpp::Time(twist_it->header.stamp).seconds();
+    if (*it_time_stamp >= block.end_stamp || *it_time_stamp < prev_time_stamp_sec) {
+      block = lookupBlockVelocity(*it_time_stamp);
     }
 
-    float v{static_cast<float>(twist_it->twist.linear.x)};
-    float w{static_cast<float>(twist_it->twist.angular.z)};
-
-    if (std::abs(*it_time_stamp - twist_stamp) > 0.1) {
-      RCLCPP_WARN_STREAM_THROTTLE(
-        get_logger(), *get_clock(), 10000 /* ms */,
-        "twist time_stamp is too late. Could not interpolate.");
-      v = 0.0f;
-      w = 0.0f;
-    }
-
-    if (use_imu_ && !angular_velocity_queue_.empty()) {
-      // For performance, do not instantiate `rclcpp::Time` inside of the for-loop
-      double imu_stamp = rclcpp::Time(imu_it->header.stamp).seconds();
-
-      for (;
-           (imu_it != std::end(angular_velocity_queue_) - 1 &&
-            *it_time_stamp > rclcpp::Time(imu_it->header.stamp).seconds());
-           ++imu_it) {
-      }
-
-      while (imu_it != std::end(angular_velocity_queue_) - 1 && *it_time_stamp > imu_stamp) {
-        ++imu_it;
-        imu_stamp = rclcpp::Time(imu_it->header.stamp).seconds();
-      }
-
-      if (std::abs(*it_time_stamp - imu_stamp) > 0.1) {
-        RCLCPP_WARN_STREAM_THROTTLE(
-          get_logger(), *get_clock(), 10000 /* ms */,
-          "imu time_stamp is too late. Could not interpolate.");
-      } else {
-        w = static_cast<float>(imu_it->vector.z);
-      }
-    }
+    const float v = block.v;
+    const float w = block.w;
 
     const auto time_offset = static_cast<float>(*it_time_stamp - prev_time_stamp_sec);
 
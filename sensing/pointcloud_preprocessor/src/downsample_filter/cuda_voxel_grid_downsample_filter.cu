@@ -0,0 +1,230 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "pointcloud_preprocessor/downsample_filter/cuda_voxel_grid_downsample_filter.hpp"
+
+#include <cuda_utils/cuda_check_error.hpp>
+#include <rclcpp/logging.hpp>
+
+#include <thrust/device_ptr.h>
+#include <thrust/execution_policy.h>
+#include <thrust/functional.h>
+#include <thrust/reduce.h>
+#include <thrust/sort.h>
+
+#include <cstring>
+#include <limits>
+
+namespace
+{
+constexpr std::size_t THREADS_PER_BLOCK = 256;
+// Each voxel index is biased and packed on 21 bits, which covers +-2^20 voxels along each axis.
+constexpr std::int64_t KEY_BITS = 21;
+constexpr std::int64_t KEY_BIAS = 1 << (KEY_BITS - 1);
+constexpr std::uint64_t KEY_MASK = (1ULL << KEY_BITS) - 1;
+constexpr std::uint64_t INVALID_KEY = std::numeric_limits<std::uint64_t>::max();
+
+std::size_t divup(const std::size_t a, const std::size_t b)
+{
+  return (a + b - 1) / b;
+}
+
+struct Float4Plus
+{
+  __host__ __device__ float4 operator()(const float4 & a, const float4 & b) const
+  {
+    return make_float4(a.x + b.x, a.y + b.y, a.z + b.z, a.w + b.w);
+  }
+};
+
+__global__ void computeVoxelKeys_kernel(
+  const std::uint8_t * raw_points, const std::size_t num_points, const std::size_t point_step,
+  const int x_offset, const int y_offset, const int z_offset, const float inv_voxel_x,
+  const float inv_voxel_y, const float inv_voxel_z, std::uint64_t * keys, float4 * points)
+{
+  const std::size_t idx = blockIdx.x * blockDim.x + threadIdx.x;
+  if (idx >= num_points) return;
+
+  const std::uint8_t * raw_point = raw_points + idx * point_step;
+  float x, y, z;
+  memcpy(&x, raw_point + x_offset, sizeof(float));
+  memcpy(&y, raw_point + y_offset, sizeof(float));
+  memcpy(&z, raw_point + z_offset, sizeof(float));
+
+  if (!isfinite(x) || !isfinite(y) || !isfinite(z)) {
+    keys[idx] = INVALID_KEY;
+    points[idx] = make_float4(0.0f, 0.0f, 0.0f, 0.0f);
+    return;
+  }
+
+  const auto i = static_cast<std::int64_t>(floorf(x * inv_voxel_x)) + KEY_BIAS;
+  const auto j = static_cast<std::int64_t>(floorf(y * inv_voxel_y)) + KEY_BIAS;
+  const auto k = static_cast<std::int64_t>(floorf(z * inv_voxel_z)) + KEY_BIAS;
+  keys[idx] = (static_cast<std::uint64_t>(i) & KEY_MASK) |
+              ((static_cast<std::uint64_t>(j) & KEY_MASK) << KEY_BITS) |
+              ((static_cast<std::uint64_t>(k) & KEY_MASK) << (2 * KEY_BITS));
+  points[idx] = make_float4(x, y, z, 1.0f);
+}
+
+// sums (x, y, z, count) -> transformed centroid (x, y, z, 1)
+__global__ void computeCentroids_kernel(
+  const std::size_t num_voxels, const float * transform, float4 * centroids)
+{
+  const std::size_t idx = blockIdx.x * blockDim.x + threadIdx.x;
+  if (idx >= num_voxels) return;
+
+  const float4 sum = centroids[idx];
+  const float x = sum.x / sum.w;
+  const float y = sum.y / sum.w;
+  const float z = sum.z / sum.w;
+  if (transform == nullptr) {
+    centroids[idx] = make_float4(x, y, z, 1.0f);
+    return;
+  }
+  // column-major 4x4 matrix, as Eigen::Matrix4f
+  centroids[idx] = make_float4(
+    transform[0] * x + transform[4] * y + transform[8] * z + transform[12],
+    transform[1] * x + transform[5] * y + transform[9] * z + transform[13],
+    transform[2] * x + transform[6] * y + transform[10] * z + transform[14], 1.0f);
+}
+}  // namespace
+
+namespace pointcloud_preprocessor
+{
+
+CudaVoxelGridDownsampleFilter::CudaVoxelGridDownsampleFilter()
+: stream_(cuda_utils::makeCudaStream()), d_transform_(cuda_utils::make_unique<float[]>(16))
+{
+  set_voxel_size(1.0f, 1.0f, 1.0f);
+}
+
+void CudaVoxelGridDownsampleFilter::set_voxel_size(
+  float voxel_size_x, float voxel_size_y, float voxel_size_z)
+{
+  inverse_voxel_size_[0] = 1.0f / voxel_size_x;
+  inverse_voxel_size_[1] = 1.0f / voxel_size_y;
+  inverse_voxel_size_[2] = 1.0f / voxel_size_z;
+}
+
+void CudaVoxelGridDownsampleFilter::reserve(std::size_t num_points, std::size_t point_step)
+{
+  // Buffers only grow, so that a steady input size does not allocate on every frame.
+  if (num_points * point_step > capacity_bytes_) {
+    capacity_bytes_ = num_points * point_step;
+    d_raw_points_ = cuda_utils::make_unique<std::uint8_t[]>(capacity_bytes_);
+  }
+  if (num_points > capacity_points_) {
+    capacity_points_ = num_points;
+    d_voxel_keys_ = cuda_utils::make_unique<std::uint64_t[]>(capacity_points_);
+    d_points_ = cuda_utils::make_unique<float4[]>(capacity_points_);
+    d_unique_keys_ = cuda_utils::make_unique<std::uint64_t[]>(capacity_points_);
+    d_centroids_ = cuda_utils::make_unique<float4[]>(capacity_points_);
+  }
+}
+
+CudaVoxelGridDownsampleFilter::DeviceCentroids CudaVoxelGridDownsampleFilter::filter_on_device(
+  const PointCloud2ConstPtr & input, const TransformInfo & transform_info)
+{
+  cudaStream_t stream = *stream_;
+  const std::size_t num_points = input->point_step ? input->data.size() / input->point_step : 0;
+  if (num_points == 0) {
+    return DeviceCentroids{d_centroids_.get(), 0, stream};
+  }
+  reserve(num_points, input->point_step);
+
+  int x_offset = 0, y_offset = 0, z_offset = 0;
+  for (const auto & field : input->fields) {
+    if (field.name == "x") x_offset = field.offset;
+    if (field.name == "y") y_offset = field.offset;
+    if (field.name == "z") z_offset = field.offset;
+  }
+
+  CHECK_CUDA_ERROR(cudaMemcpyAsync(
+    d_raw_points_.get(), input->data.data(), num_points * input->point_step,
+    cudaMemcpyHostToDevice, stream));
+  if (transform_info.need_transform) {
+    CHECK_CUDA_ERROR(cudaMemcpyAsync(
+      d_transform_.get(), transform_info.eigen_transform.data(), 16 * sizeof(float),
+      cudaMemcpyHostToDevice, stream));
+  }
+
+  computeVoxelKeys_kernel<<<divup(num_points, THREADS_PER_BLOCK), THREADS_PER_BLOCK, 0, stream>>>(
+    d_raw_points_.get(), num_points, input->point_step, x_offset, y_offset, z_offset,
+    inverse_voxel_size_[0], inverse_voxel_size_[1], inverse_voxel_size_[2], d_voxel_keys_.get(),
+    d_points_.get());
+
+  // Invalid points get the largest key, so they end up in the last group after sorting
+  thrust::device_ptr<std::uint64_t> keys(d_voxel_keys_.get());
+  thrust::device_ptr<float4> points(d_points_.get());
+  thrust::sort_by_key(thrust::cuda::par.on(stream), keys, keys + num_points, points);
+
+  thrust::device_ptr<std::uint64_t> unique_keys(d_unique_keys_.get());
+  thrust::device_ptr<float4> sums(d_centroids_.get());
+  const auto ends = thrust::reduce_by_key(
+    thrust::cuda::par.on(stream), keys, keys + num_points, points, unique_keys, sums,
+    thrust::equal_to<std::uint64_t>(), Float4Plus());
+  std::size_t num_voxels = ends.first - unique_keys;
+
+  std::uint64_t last_key = 0;
+  CHECK_CUDA_ERROR(cudaMemcpyAsync(
+    &last_key, d_unique_keys_.get() + num_voxels - 1, sizeof(std::uint64_t),
+    cudaMemcpyDeviceToHost, stream));
+  CHECK_CUDA_ERROR(cudaStreamSynchronize(stream));
+  if (last_key == INVALID_KEY) {
+    --num_voxels;
+  }
+
+  if (num_voxels > 0) {
+    computeCentroids_kernel<<<divup(num_voxels, THREADS_PER_BLOCK), THREADS_PER_BLOCK, 0, stream>>>(
+      num_voxels, transform_info.need_transform ? d_transform_.get() : nullptr, d_centroids_.get());
+  }
+  CHECK_CUDA_ERROR(cudaGetLastError());
+
+  return DeviceCentroids{d_centroids_.get(), num_voxels, stream};
+}
+
+void CudaVoxelGridDownsampleFilter::filter(
+  const PointCloud2ConstPtr & input, PointCloud2 & output, const TransformInfo & transform_info,
+  const rclcpp::Logger & logger)
+{
+  const auto centroids = filter_on_device(input, transform_info);
+  RCLCPP_DEBUG(logger, "Downsampled to %zu voxels on GPU", centroids.size);
+
+  // Same layout as pcl::PointXYZ, whose padding holds the 4th (homogeneous) coordinate
+  output.header = input->header;
+  output.height = 1;
+  output.width = centroids.size;
+  output.point_step = sizeof(float4);
+  output.row_step = output.width * output.point_step;
+  output.is_bigendian = input->is_bigendian;
+  output.is_dense = true;  // we filter out invalid points
+  output.fields.resize(3);
+  const char * names[] = {"x", "y", "z"};
+  for (std::size_t i = 0; i < 3; ++i) {
+    output.fields[i].name = names[i];
+    output.fields[i].offset = i * sizeof(float);
+    output.fields[i].datatype = sensor_msgs::msg::PointField::FLOAT32;
+    output.fields[i].count = 1;
+  }
+
+  output.data.resize(output.row_step);
+  if (centroids.size > 0) {
+    CHECK_CUDA_ERROR(cudaMemcpyAsync(
+      output.data.data(), centroids.data, output.row_step, cudaMemcpyDeviceToHost,
+      centroids.stream));
+  }
+  CHECK_CUDA_ERROR(cudaStreamSynchronize(centroids.stream));
+}
+
+}  // namespace pointcloud_preprocessor
@@ -51,6 +51,9 @@
 #include "pointcloud_preprocessor/downsample_filter/voxel_grid_downsample_filter_nodelet.hpp"
 
 #include "pointcloud_preprocessor/downsample_filter/faster_voxel_grid_downsample_filter.hpp"
+#ifdef WITH_CUDA_VOXEL_GRID
+#include "pointcloud_preprocessor/downsample_filter/cuda_voxel_grid_downsample_filter.hpp"
+#endif
 
 #include <pcl/kdtree/kdtree_flann.h>
 #include <pcl/search/kdtree.h>
@@ -69,6 +72,17 @@ VoxelGridDownsampleFilterComponent::VoxelGridDownsampleFilterComponent(
     voxel_size_x_ = static_cast<float>(declare_parameter("voxel_size_x", 0.3));
     voxel_size_y_ = static_cast<float>(declare_parameter("voxel_size_y", 0.3));
     voxel_size_z_ = static_cast<float>(declare_parameter("voxel_size_z", 0.1));
+    use_cuda_ = static_cast<bool>(declare_parameter("use_cuda", false));
+  }
+
+  if (use_cuda_) {
+#ifdef WITH_CUDA_VOXEL_GRID
+    cuda_voxel_filter_ = std::make_shared<CudaVoxelGridDownsampleFilter>();
+#else
+    RCLCPP_WARN(
+      get_logger(), "use_cuda is set but the package is built without CUDA. Running on the CPU.");
+    use_cuda_ = false;
+#endif
   }
 
   using std::placeholders::_1;
@@ -106,6 +120,13 @@ void VoxelGridDownsampleFilterComponent::faster_filter(
   PointCloud2 & output, const TransformInfo & transform_info)
 {
   std::scoped_lock lock(mutex_);
+#ifdef WITH_CUDA_VOXEL_GRID
+  if (cuda_voxel_filter_) {
+    cuda_voxel_filter_->set_voxel_size(voxel_size_x_, voxel_size_y_, voxel_size_z_);
+    cuda_voxel_filter_->filter(input, output, transform_info, this->get_logger());
+    return;
+  }
+#endif
   FasterVoxelGridDownsampleFilter faster_voxel_filter;
   faster_voxel_filter.set_voxel_size(voxel_size_x_, voxel_size_y_, voxel_size_z_);
   faster_voxel_filter.set_field_offsets(input);
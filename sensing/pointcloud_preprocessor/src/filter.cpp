@@ -76,6 +76,14 @@ pointcloud_preprocessor::Filter::Filter(
     use_indices_ = static_cast<bool>(declare_parameter("use_indices", false));
     latched_indices_ = static_cast<bool>(declare_parameter("latched_indices", false));
     approximate_sync_ = static_cast<bool>(declare_parameter("approximate_sync", false));
+    fused_stage_ = static_cast<bool>(declare_parameter("fused_stage", false));
+    reuse_output_buffer_ = static_cast<bool>(declare_parameter("reuse_output_buffer", false));
+    if (reuse_output_buffer_ && options.use_intra_process_comms()) {
+      // publishing by reference would copy the message for the intra-process subscribers
+      RCLCPP_WARN(
+        this->get_logger(), "reuse_output_buffer is ignored with intra-process communication.");
+      reuse_output_buffer_ = false;
+    }
 
     RCLCPP_INFO_STREAM(
       this->get_logger(),
@@ -84,16 +92,19 @@ pointcloud_preprocessor::Filter::Filter(
         << " - approximate_sync : " << (approximate_sync_ ? "true" : "false") << std::endl
         << " - use_indices      : " << (use_indices_ ? "true" : "false") << std::endl
         << " - latched_indices  : " << (latched_indices_ ? "true" : "false") << std::endl
+        << " - fused_stage      : " << (fused_stage_ ? "true" : "false") << std::endl
+        << " - reuse_output_buffer : " << (reuse_output_buffer_ ? "true" : "false") << std::endl
         << " - max_queue_size   : " << max_queue_size_);
   }
 
-  // Set publisher
-  {
+  // A fused stage is fed in-process by its owner, so it neither subscribes nor publishes.
+  if (!fused_stage_) {
+    // Set publisher
     pub_output_ = this->create_publisher<PointCloud2>(
       "output", rclcpp::SensorDataQoS().keep_last(max_queue_size_));
-  }
 
-  subscribe(filter_name);
+    subscribe(filter_name);
+  }
 
   // Set tf_listener, tf_buffer.
   setupTF();
@@ -125,7 +136,7 @@ void pointcloud_preprocessor::Filter::subscribe(const std::string & filter_name)
   // each time a child class supports the faster version.
   // When all the child classes support the faster version, this workaround is deleted.
   std::set<std::string> supported_nodes = {
-    "CropBoxFilter", "RingOutlierFilter", "VoxelGridDownsampleFilter"};
+    "CropBoxFilter", "RingOutlierFilter", "VoxelGridDownsampleFilter", "FusedPipeline"};
   auto callback = supported_nodes.find(filter_name) != supported_nodes.end()
                     ? &Filter::faster_input_indices_callback
                     : &Filter::input_indices_callback;
@@ -180,7 +191,8 @@ void pointcloud_preprocessor::Filter::unsubscribe()
 void pointcloud_preprocessor::Filter::computePublish(
   const PointCloud2ConstPtr & input, const IndicesPtr & indices)
 {
-  auto output = std::make_unique<PointCloud2>();
+  std::unique_ptr<PointCloud2> new_output;
+  auto & output = prepare_output(new_output);
 
   // Call the virtual method in the child
   filter(input, indices, *output);
@@ -190,8 +202,37 @@ void pointcloud_preprocessor::Filter::computePublish(
   // Copy timestamp to keep it
   output->header.stamp = input->header.stamp;
 
-  // Publish a boost shared ptr
-  pub_output_->publish(std::move(output));
+  publish_output(output);
+}
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+std::unique_ptr<sensor_msgs::msg::PointCloud2> & pointcloud_preprocessor::Filter::prepare_output(
+  std::unique_ptr<PointCloud2> & new_output)
+{
+  if (!reuse_output_buffer_) {
+    new_output = std::make_unique<PointCloud2>();
+    return new_output;
+  }
+
+  if (!reused_output_) {
+    reused_output_ = std::make_unique<PointCloud2>();
+  }
+  // Keep the capacity of the data vector, but not the previous frame's points
+  reused_output_->data.clear();
+  reused_output_->fields.clear();
+  reused_output_->width = 0;
+  reused_output_->row_step = 0;
+  return reused_output_;
+}
+
+void pointcloud_preprocessor::Filter::publish_output(std::unique_ptr<PointCloud2> & output)
+{
+  if (reuse_output_buffer_) {
+    // The message is serialized during publish(), so it can be refilled for the next frame
+    pub_output_->publish(*output);
+  } else {
+    pub_output_->publish(std::move(output));
+  }
 }
 
 //////////////////////////////////////////////////////////////////////////////////////////////
@@ -329,6 +370,16 @@ bool pointcloud_preprocessor::Filter::calculate_transform_matrix(
 
   if (target_frame.empty() || from.header.frame_id == target_frame) return true;
 
+  const std::string cache_key = target_frame + "->" + from.header.frame_id;
+  if (use_transform_cache_) {
+    const auto cached_transform = transform_cache_.find(cache_key);
+    if (cached_transform != transform_cache_.end()) {
+      transform_info.eigen_transform = cached_transform->second;
+      transform_info.need_transform = true;
+      return true;
+    }
+  }
+
   RCLCPP_DEBUG(
     this->get_logger(), "[get_transform_matrix] Transforming input dataset from %s to %s.",
     from.header.frame_id.c_str(), target_frame.c_str());
@@ -350,6 +401,10 @@ bool pointcloud_preprocessor::Filter::calculate_transform_matrix(
     return false;
   }
 
+  if (use_transform_cache_) {
+    transform_cache_[cache_key] = transform_info.eigen_transform;
+  }
+
   transform_info.need_transform = true;
   return true;
 }
@@ -447,7 +502,8 @@ void pointcloud_preprocessor::Filter::faster_input_indices_callback(
     vindices.reset(new std::vector<int>(indices->indices));
   }
 
-  auto output = std::make_unique<PointCloud2>();
+  std::unique_ptr<PointCloud2> new_output;
+  auto & output = prepare_output(new_output);
 
   // TODO(sykwer): Change to `filter()` call after when the filter nodes conform to new API.
   faster_filter(cloud, vindices, *output, transform_info);
@@ -455,7 +511,33 @@ void pointcloud_preprocessor::Filter::faster_input_indices_callback(
   if (!convert_output_costly(output)) return;
 
   output->header.stamp = cloud->header.stamp;
-  pub_output_->publish(std::move(output));
+  publish_output(output);
+}
+
+bool pointcloud_preprocessor::Filter::process_fused_stage(
+  const PointCloud2ConstPtr & input, PointCloud2 & output)
+{
+  if (!isValid(input)) {
+    RCLCPP_ERROR(this->get_logger(), "[process_fused_stage] Invalid input!");
+    return false;
+  }
+
+  tf_input_orig_frame_ = input->header.frame_id;
+
+  TransformInfo transform_info;
+  if (!calculate_transform_matrix(tf_input_frame_, *input, transform_info)) return false;
+
+  // The output buffer is recycled between frames. Reset the metadata so that a stage which bails
+  // out early yields an empty cloud rather than the previous frame's points.
+  output.data.clear();
+  output.fields.clear();
+  output.width = 0;
+  output.row_step = 0;
+
+  faster_filter(input, IndicesPtr(), output, transform_info);
+
+  output.header.stamp = input->header.stamp;
+  return true;
 }
 
 // TODO(sykwer): Temporary Implementation: Remove this interface when all the filter nodes conform
@@ -0,0 +1,153 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "pointcloud_preprocessor/fused_pipeline/fused_pipeline_nodelet.hpp"
+
+#include "pointcloud_preprocessor/crop_box_filter/crop_box_filter_nodelet.hpp"
+#include "pointcloud_preprocessor/downsample_filter/voxel_grid_downsample_filter_nodelet.hpp"
+#include "pointcloud_preprocessor/outlier_filter/ring_outlier_filter_nodelet.hpp"
+
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace pointcloud_preprocessor
+{
+FusedPipelineComponent::FusedPipelineComponent(const rclcpp::NodeOptions & options)
+: Filter("FusedPipeline", options)
+{
+  // initialize debug tool
+  {
+    using tier4_autoware_utils::DebugPublisher;
+    using tier4_autoware_utils::StopWatch;
+    stop_watch_ptr_ = std::make_unique<StopWatch<std::chrono::milliseconds>>();
+    debug_publisher_ = std::make_unique<DebugPublisher>(this, "fused_pipeline");
+    stop_watch_ptr_->tic("cyclic_time");
+    stop_watch_ptr_->tic("processing_time");
+  }
+
+  // set initial parameters
+  const auto stage_names = declare_parameter<std::vector<std::string>>("stages");
+  if (stage_names.empty()) {
+    throw std::invalid_argument("Fused pipeline requires at least one stage");
+  }
+
+  for (const auto & stage_name : stage_names) {
+    // Parameters of a stage are given to the fused node as `<stage_name>.<parameter>`.
+    std::vector<rclcpp::Parameter> stage_parameters{rclcpp::Parameter("fused_stage", true)};
+    const std::string prefix = stage_name + ".";
+    for (const auto & parameter : options.parameter_overrides()) {
+      if (parameter.get_name().rfind(prefix, 0) == 0) {
+        stage_parameters.emplace_back(
+          parameter.get_name().substr(prefix.size()), parameter.get_parameter_value());
+      }
+    }
+
+    auto stage_options = rclcpp::NodeOptions()
+                           .context(options.context())
+                           .use_global_arguments(false)
+                           .use_intra_process_comms(options.use_intra_process_comms())
+                           .parameter_overrides(stage_parameters)
+                           .arguments(
+                             {"--ros-args", "-r",
+                              "__node:=" + std::string(get_name()) + "_" + stage_name, "-r",
+                              "__ns:=" + std::string(get_namespace())});
+
+    stages_.push_back(Stage{stage_name, createStage(stage_name, stage_options)});
+    RCLCPP_INFO(get_logger(), "Added fused stage #%zu: %s", stages_.size(), stage_name.c_str());
+  }
+
+  for (auto & buffer : intermediate_buffers_) {
+    buffer = std::make_shared<PointCloud2>();
+  }
+}
+
+std::shared_ptr<Filter> FusedPipelineComponent::createStage(
+  const std::string & stage_name, const rclcpp::NodeOptions & options)
+{
+  // Only filters implementing `faster_filter()` can be fused.
+  if (stage_name == "crop_box_filter") {
+    return std::make_shared<CropBoxFilterComponent>(options);
+  }
+  if (stage_name == "ring_outlier_filter") {
+    return std::make_shared<RingOutlierFilterComponent>(options);
+  }
+  if (stage_name == "voxel_grid_downsample_filter") {
+    return std::make_shared<VoxelGridDownsampleFilterComponent>(options);
+  }
+  throw std::invalid_argument("Unsupported fused stage: " + stage_name);
+}
+
+void FusedPipelineComponent::filter(
+  const PointCloud2ConstPtr & input, const IndicesPtr & indices, PointCloud2 & output)
+{
+  (void)input;
+  (void)indices;
+  (void)output;
+}
+
+void FusedPipelineComponent::faster_filter(
+  const PointCloud2ConstPtr & input, const IndicesPtr & indices, PointCloud2 & output,
+  const TransformInfo & transform_info)
+{
+  std::scoped_lock lock(mutex_);
+  stop_watch_ptr_->toc("processing_time", true);
+
+  if (indices) {
+    RCLCPP_WARN_THROTTLE(
+      get_logger(), *get_clock(), 1000, "Indices are not supported and will be ignored");
+  }
+  if (transform_info.need_transform) {
+    RCLCPP_WARN_THROTTLE(
+      get_logger(), *get_clock(), 1000,
+      "input_frame of the fused pipeline is ignored, set it per stage instead");
+  }
+
+  // Intermediate results alternate between the two buffers, and the last stage writes straight
+  // into the output message.
+  PointCloud2ConstPtr stage_input = input;
+  for (size_t i = 0; i < stages_.size(); ++i) {
+    const bool is_last_stage = i + 1 == stages_.size();
+    PointCloud2 & stage_output = is_last_stage ? output : *intermediate_buffers_[i % 2];
+
+    if (!stages_.at(i).filter->process_fused_stage(stage_input, stage_output)) {
+      RCLCPP_ERROR_THROTTLE(
+        get_logger(), *get_clock(), 1000, "Fused stage %s failed, skipping this frame",
+        stages_.at(i).name.c_str());
+      output.data.clear();
+      output.width = 0;
+      output.row_step = 0;
+      return;
+    }
+
+    if (!is_last_stage) {
+      stage_input = intermediate_buffers_[i % 2];
+    }
+  }
+
+  // add processing time for debug
+  if (debug_publisher_) {
+    const double cyclic_time_ms = stop_watch_ptr_->toc("cyclic_time", true);
+    const double processing_time_ms = stop_watch_ptr_->toc("processing_time", true);
+    debug_publisher_->publish<tier4_debug_msgs::msg::Float64Stamped>(
+      "debug/cyclic_time_ms", cyclic_time_ms);
+    debug_publisher_->publish<tier4_debug_msgs::msg::Float64Stamped>(
+      "debug/processing_time_ms", processing_time_ms);
+  }
+}
+
+}  // namespace pointcloud_preprocessor
+
+#include <rclcpp_components/register_node_macro.hpp>
+RCLCPP_COMPONENTS_REGISTER_NODE(pointcloud_preprocessor::FusedPipelineComponent)
@@ -16,6 +16,8 @@
 
 #include "pointcloud_preprocessor/utility/utilities.hpp"
 
+#include <autoware_point_types/field_accessor.hpp>
+
 #include <range/v3/view/chunk.hpp>
 #include <range/v3/view/transform.hpp>
 #include <range/v3/view/zip.hpp>
@@ -24,8 +26,24 @@
 
 #include <algorithm>
 #include <cstddef>
+#include <string>
 #include <vector>
 
+namespace
+{
+// Fallback layout for inputs which are not PointXYZIRADRT, resolved from the message fields
+struct DynamicInputLayout
+{
+  autoware_point_types::DynamicField<float> x;
+  autoware_point_types::DynamicField<float> y;
+  autoware_point_types::DynamicField<float> z;
+  autoware_point_types::DynamicField<float> intensity;
+  autoware_point_types::DynamicField<uint16_t> ring;
+  autoware_point_types::DynamicField<float> azimuth;
+  autoware_point_types::DynamicField<float> distance;
+};
+}  // namespace
+
 namespace pointcloud_preprocessor
 {
 RingOutlierFilterComponent::RingOutlierFilterComponent(const rclcpp::NodeOptions & options)
@@ -48,6 +66,7 @@ RingOutlierFilterComponent::RingOutlierFilterComponent(const rclcpp::NodeOptions
       static_cast<double>(declare_parameter("object_length_threshold", 0.1));
     num_points_threshold_ = static_cast<int>(declare_parameter("num_points_threshold", 4));
     max_rings_num_ = static_cast<uint16_t>(declare_parameter("max_rings_num", 128));
+    num_threads_ = static_cast<int>(declare_parameter("num_threads", 1));
   }
 
   using std::placeholders::_1;
@@ -55,53 +74,11 @@ RingOutlierFilterComponent::RingOutlierFilterComponent(const rclcpp::NodeOptions
     std::bind(&RingOutlierFilterComponent::paramCallback, this, _1));
 }
 
-// TODO(sykwer): Temporary Implementation: Rename this function to `filter()` when all the filter
-// nodes conform to new API. Then delete the old `filter()` defined below.
-void RingOutlierFilterComponent::faster_filter(
-  const PointCloud2ConstPtr & input, const IndicesPtr & unused_indices, PointCloud2 & output,
+template <class Layout>
+void RingOutlierFilterComponent::filter_with_layout(
+  const Layout & layout, const PointCloud2ConstPtr & input, PointCloud2 & output,
   const TransformInfo & transform_info)
 {
-  std::scoped_lock lock(mutex_);
-  if (unused_indices) {
-    RCLCPP_WARN(get_logger(), "Indices are not supported and will be ignored");
-  }
-  stop_watch_ptr_->toc("processing_time", true);
-
-  // The ring_outlier_filter specifies the expected input point cloud format,
-  // however, we want to verify the input is correct and make failures explicit.
-  auto getFieldOffsetSafely = [=](
-                                const std::string & field_name,
-                                const pcl::PCLPointField::PointFieldTypes expected_type) -> size_t {
-    const auto field_index = pcl::getFieldIndex(*input, field_name);
-    if (field_index == -1) {
-      RCLCPP_ERROR(get_logger(), "Field %s not found in input point cloud", field_name.c_str());
-      return -1UL;
-    }
-
-    auto field = (*input).fields.at(field_index);
-    if (field.datatype != expected_type) {
-      RCLCPP_ERROR(
-        get_logger(), "Field %s has unexpected type %d (expected %d)", field_name.c_str(),
-        field.datatype, expected_type);
-      return -1UL;
-    }
-
-    return static_cast<size_t>(field.offset);
-  };
-
-  // as per the specification of this node, these fields must be present in the input
-  const auto ring_offset = getFieldOffsetSafely("ring", pcl::PCLPointField::UINT16);
-  const auto azimuth_offset = getFieldOffsetSafely("azimuth", pcl::PCLPointField::FLOAT32);
-  const auto distance_offset = getFieldOffsetSafely("distance", pcl::PCLPointField::FLOAT32);
-  const auto intensity_offset = getFieldOffsetSafely("intensity", pcl::PCLPointField::FLOAT32);
-
-  if (
-    ring_offset == -1UL || azimuth_offset == -1UL || distance_offset == -1UL ||
-    intensity_offset == -1UL) {
-    RCLCPP_ERROR(get_logger(), "One or more required fields are missing in input point cloud");
-    return;
-  }
-
   // The initial implementation of ring outlier filter looked like this:
   //   1. Iterate over the input cloud and group point indices by ring
   //   2. For each ring:
@@ -167,7 +144,7 @@ void RingOutlierFilterComponent::faster_filter(
   // tmp vectors to keep track of walk/ring state while processing points in order (cache efficient)
   std::vector<RingWalkInfo> rings;     // info for each LiDAR ring
   std::vector<size_t> points_walk_id;  // for each input point, the walk index associated with it
-  std::vector<bool>
+  std::vector<uint8_t>
     walks_cluster_status;  // for each generated walk, stores whether it is a cluster
 
   size_t latest_walk_id = -1UL;  // ID given to the latest walk created
@@ -181,88 +158,168 @@ void RingOutlierFilterComponent::faster_filter(
 
   int invalid_ring_count = 0;
 
-  // Build walks and classify points
-  for (const auto & [raw_p, point_walk_id] :
-       ranges::views::zip(input->data | ranges::views::chunk(input->point_step), points_walk_id)) {
-    uint16_t ring_idx{};
-    float curr_azimuth{};
-    float curr_distance{};
-    std::memcpy(&ring_idx, &raw_p.data()[ring_offset], sizeof(ring_idx));
-    std::memcpy(&curr_azimuth, &raw_p.data()[azimuth_offset], sizeof(curr_azimuth));
-    std::memcpy(&curr_distance, &raw_p.data()[distance_offset], sizeof(curr_distance));
-
-    if (ring_idx >= max_rings_num_) {
-      // Either the data is corrupted or max_rings_num_ is not set correctly
-      // Note: point_walk_id == -1 so the point will be filtered out
-      ++invalid_ring_count;
-      continue;
+  if (num_threads_ > 1) {
+    // Rings are independent, so they can be processed on separate threads once the points are
+    // grouped by ring. The buckets are kept between frames to avoid reallocating them.
+    const size_t num_points = input->width * input->height;
+    ring_point_indices_.resize(max_rings_num_);
+    for (auto & indices : ring_point_indices_) {
+      indices.clear();
     }
-
-    auto & ring = rings[ring_idx];
-    if (ring.current_walk.id == -1UL) {
-      // first walk ever for this ring. It is both the first and current walk of the ring.
-      ring.first_walk =
-        WalkInfo{++latest_walk_id, 1, curr_distance, curr_azimuth, curr_distance, curr_azimuth};
-      ring.current_walk = ring.first_walk;
-      point_walk_id = latest_walk_id;
-      continue;
+    for (size_t i = 0; i < num_points; ++i) {
+      const uint16_t ring_idx = layout.ring.read(&input->data[i * input->point_step]);
+      if (ring_idx >= max_rings_num_) {
+        ++invalid_ring_count;
+        continue;
+      }
+      ring_point_indices_[ring_idx].push_back(i);
     }
 
-    auto & walk = ring.current_walk;
-    if (isSameWalk(
-          curr_distance, curr_azimuth, walk.last_point_distance, walk.last_point_azimuth)) {
-      // current point is part of previous walk
-      walk.num_points += 1;
-      walk.last_point_distance = curr_distance;
-      walk.last_point_azimuth = curr_azimuth;
-      point_walk_id = walk.id;
-    } else {
-      // previous walk is finished, start a new one
-
-      // check and store whether the previous walks is a cluster
-      if (walk.id >= walks_cluster_status.size()) walks_cluster_status.resize(walk.id + 1, false);
-      walks_cluster_status.at(walk.id) = isCluster(walk);
+    // A walk is identified by the index of its first point, which is unique across rings. Each
+    // ring then only writes its own elements of points_walk_id and walks_cluster_status.
+    walks_cluster_status.resize(num_points, false);
+
+    // The walks are built the same way as the sequential implementation below, so that both give
+    // the same output.
+#ifdef _OPENMP
+#pragma omp parallel for schedule(dynamic) num_threads(num_threads_)
+#endif
+    for (size_t ring_idx = 0; ring_idx < ring_point_indices_.size(); ++ring_idx) {
+      const auto & indices = ring_point_indices_[ring_idx];
+      if (indices.empty()) {
+        continue;
+      }
 
-      ring.current_walk =
-        WalkInfo{++latest_walk_id, 1, curr_distance, curr_azimuth, curr_distance, curr_azimuth};
-      point_walk_id = latest_walk_id;
-    }
-  }
+      const auto * first_point = &input->data[indices.front() * input->point_step];
+      const WalkInfo first_walk{
+        indices.front(),
+        1,
+        layout.distance.read(first_point),
+        layout.azimuth.read(first_point),
+        layout.distance.read(first_point),
+        layout.azimuth.read(first_point)};
+      WalkInfo walk = first_walk;
+      points_walk_id[indices.front()] = walk.id;
+
+      for (size_t i = 1; i < indices.size(); ++i) {
+        const auto * raw_p = &input->data[indices[i] * input->point_step];
+        const float curr_azimuth = layout.azimuth.read(raw_p);
+        const float curr_distance = layout.distance.read(raw_p);
+        if (isSameWalk(
+              curr_distance, curr_azimuth, walk.last_point_distance, walk.last_point_azimuth)) {
+          walk.num_points += 1;
+          walk.last_point_distance = curr_distance;
+          walk.last_point_azimuth = curr_azimuth;
+        } else {
+          walks_cluster_status[walk.id] = isCluster(walk);
+          walk = WalkInfo{indices[i], 1, curr_distance, curr_azimuth, curr_distance, curr_azimuth};
+        }
+        points_walk_id[indices[i]] = walk.id;
+      }
+      walks_cluster_status[walk.id] = isCluster(walk);
 
-  // So far, we have processed ring points as if rings were not circular. Of course, the last and
-  // first points of a ring could totally be part of the same walk. When such thing happens, we need
-  // to merge the two walks
-  for (auto & ring : rings) {
-    if (ring.current_walk.id == -1UL) {
-      continue;
+      // merge the first and last walks of the ring if they are connected
+      if (
+        first_walk.id != walk.id &&
+        isSameWalk(
+          first_walk.first_point_distance, first_walk.first_point_azimuth,
+          walk.last_point_distance, walk.last_point_azimuth)) {
+        WalkInfo merged_first_walk = first_walk;
+        const auto combined_num_points = first_walk.num_points + walk.num_points;
+        merged_first_walk.first_point_distance = walk.first_point_distance;
+        merged_first_walk.first_point_azimuth = walk.first_point_azimuth;
+        merged_first_walk.num_points = combined_num_points;
+        walk.last_point_distance = first_walk.last_point_distance;
+        walk.last_point_azimuth = first_walk.last_point_azimuth;
+        walk.num_points = combined_num_points;
+
+        walks_cluster_status[merged_first_walk.id] = isCluster(merged_first_walk);
+        walks_cluster_status[walk.id] = isCluster(walk);
+      }
     }
+  } else {
+    // Build walks and classify points
+    for (const auto & [raw_p, point_walk_id] : ranges::views::zip(
+           input->data | ranges::views::chunk(input->point_step), points_walk_id)) {
+      const uint16_t ring_idx = layout.ring.read(raw_p.data());
+      const float curr_azimuth = layout.azimuth.read(raw_p.data());
+      const float curr_distance = layout.distance.read(raw_p.data());
+
+      if (ring_idx >= max_rings_num_) {
+        // Either the data is corrupted or max_rings_num_ is not set correctly
+        // Note: point_walk_id == -1 so the point will be filtered out
+        ++invalid_ring_count;
+        continue;
+      }
 
-    const auto & walk = ring.current_walk;
-    if (walk.id >= walks_cluster_status.size()) walks_cluster_status.resize(walk.id + 1, false);
-    walks_cluster_status.at(walk.id) = isCluster(walk);
+      auto & ring = rings[ring_idx];
+      if (ring.current_walk.id == -1UL) {
+        // first walk ever for this ring. It is both the first and current walk of the ring.
+        ring.first_walk =
+          WalkInfo{++latest_walk_id, 1, curr_distance, curr_azimuth, curr_distance, curr_azimuth};
+        ring.current_walk = ring.first_walk;
+        point_walk_id = latest_walk_id;
+        continue;
+      }
 
-    if (ring.first_walk.id == ring.current_walk.id) {
-      continue;
+      auto & walk = ring.current_walk;
+      if (isSameWalk(
+            curr_distance, curr_azimuth, walk.last_point_distance, walk.last_point_azimuth)) {
+        // current point is part of previous walk
+        walk.num_points += 1;
+        walk.last_point_distance = curr_distance;
+        walk.last_point_azimuth = curr_azimuth;
+        point_walk_id = walk.id;
+      } else {
+        // previous walk is finished, start a new one
+
+        // check and store whether the previous walks is a cluster
+        if (walk.id >= walks_cluster_status.size()) {
+          walks_cluster_status.resize(walk.id + 1, false);
+        }
+        walks_cluster_status.at(walk.id) = isCluster(walk);
+
+        ring.current_walk =
+          WalkInfo{++latest_walk_id, 1, curr_distance, curr_azimuth, curr_distance, curr_azimuth};
+        point_walk_id = latest_walk_id;
+      }
     }
 
-    auto & first_walk = ring.first_walk;
-    auto & last_walk = ring.current_walk;
+    // So far, we have processed ring points as if rings were not circular. Of course, the last and
+    // first points of a ring could totally be part of the same walk. When such thing happens, we
+    // need to merge the two walks
+    for (auto & ring : rings) {
+      if (ring.current_walk.id == -1UL) {
+        continue;
+      }
+
+      const auto & walk = ring.current_walk;
+      if (walk.id >= walks_cluster_status.size()) walks_cluster_status.resize(walk.id + 1, false);
+      walks_cluster_status.at(walk.id) = isCluster(walk);
 
-    // check if the two walks are connected
-    if (isSameWalk(
-          first_walk.first_point_distance, first_walk.first_point_azimuth,
-          last_walk.last_point_distance, last_walk.last_point_azimuth)) {
-      // merge
-      auto combined_num_points = first_walk.num_points + last_walk.num_points;
-      first_walk.first_point_distance = last_walk.first_point_distance;
-      first_walk.first_point_azimuth = last_walk.first_point_azimuth;
-      first_walk.num_points = combined_num_points;
-      last_walk.last_point_distance = first_walk.last_point_distance;
-      last_walk.last_point_azimuth = first_walk.last_point_azimuth;
-      last_walk.num_points = combined_num_points;
-
-      walks_cluster_status.at(first_walk.id) = isCluster(first_walk);
-      walks_cluster_status.at(last_walk.id) = isCluster(last_walk);
+      if (ring.first_walk.id == ring.current_walk.id) {
+        continue;
+      }
+
+      auto & first_walk = ring.first_walk;
+      auto & last_walk = ring.current_walk;
+
+      // check if the two walks are connected
+      if (isSameWalk(
+            first_walk.first_point_distance, first_walk.first_point_azimuth,
+            last_walk.last_point_distance, last_walk.last_point_azimuth)) {
+        // merge
+        auto combined_num_points = first_walk.num_points + last_walk.num_points;
+        first_walk.first_point_distance = last_walk.first_point_distance;
+        first_walk.first_point_azimuth = last_walk.first_point_azimuth;
+        first_walk.num_points = combined_num_points;
+        last_walk.last_point_distance = first_walk.last_point_distance;
+        last_walk.last_point_azimuth = first_walk.last_point_azimuth;
+        last_walk.num_points = combined_num_points;
+
+        walks_cluster_status.at(first_walk.id) = isCluster(first_walk);
+        walks_cluster_status.at(last_walk.id) = isCluster(last_walk);
+      }
     }
   }
 
@@ -278,18 +335,15 @@ void RingOutlierFilterComponent::faster_filter(
         continue;
       }
 
-      // assume binary representation of input point is compatible with PointXYZ*
-      PointXYZI out_point;
-      std::memcpy(&out_point, raw_p.data(), sizeof(PointXYZI));
+      PointXYZI out_point{
+        layout.x.read(raw_p.data()), layout.y.read(raw_p.data()), layout.z.read(raw_p.data()),
+        layout.intensity.read(raw_p.data())};
 
       Eigen::Vector4f p(out_point.x, out_point.y, out_point.z, 1);
       p = transform_info.eigen_transform * p;
       out_point.x = p[0];
       out_point.y = p[1];
       out_point.z = p[2];
-      // FIXME(VRichardJP) tmp fix because input data does not have the same layout than PointXYZI
-      std::memcpy(
-        &out_point.intensity, &raw_p.data()[intensity_offset], sizeof(out_point.intensity));
 
       std::memcpy(&output.data[output_size], &out_point, sizeof(PointXYZI));
       output_size += sizeof(PointXYZI);
@@ -302,11 +356,9 @@ void RingOutlierFilterComponent::faster_filter(
         continue;
       }
 
-      PointXYZI out_point;
-      std::memcpy(&out_point, raw_p.data(), sizeof(PointXYZI));
-      // FIXME(VRichardJP) tmp fix because input data does not have the same layout than PointXYZI
-      std::memcpy(
-        &out_point.intensity, &raw_p.data()[intensity_offset], sizeof(out_point.intensity));
+      const PointXYZI out_point{
+        layout.x.read(raw_p.data()), layout.y.read(raw_p.data()), layout.z.read(raw_p.data()),
+        layout.intensity.read(raw_p.data())};
 
       std::memcpy(&output.data[output_size], &out_point, sizeof(PointXYZI));
 
@@ -338,6 +390,54 @@ void RingOutlierFilterComponent::faster_filter(
       invalid_ring_count, max_rings_num_);
   }
 
+}
+
+// TODO(sykwer): Temporary Implementation: Rename this function to `filter()` when all the filter
+// nodes conform to new API. Then delete the old `filter()` defined below.
+void RingOutlierFilterComponent::faster_filter(
+  const PointCloud2ConstPtr & input, const IndicesPtr & unused_indices, PointCloud2 & output,
+  const TransformInfo & transform_info)
+{
+  std::scoped_lock lock(mutex_);
+  if (unused_indices) {
+    RCLCPP_WARN(get_logger(), "Indices are not supported and will be ignored");
+  }
+  stop_watch_ptr_->toc("processing_time", true);
+
+  // The ring_outlier_filter specifies the expected input point cloud format,
+  // however, we want to verify the input is correct and make failures explicit.
+  if (autoware_point_types::PointXYZIRADRTLayout::matches(*input)) {
+    filter_with_layout(autoware_point_types::PointXYZIRADRTLayout{}, input, output, transform_info);
+  } else {
+    auto getFieldSafely = [&](const std::string & field_name, auto type_tag) {
+      using T = decltype(type_tag);
+      const auto field = autoware_point_types::DynamicField<T>::from_msg(*input, field_name);
+      if (!field) {
+        RCLCPP_ERROR(
+          get_logger(), "Field %s not found in input point cloud or has unexpected type",
+          field_name.c_str());
+      }
+      return field;
+    };
+
+    // as per the specification of this node, these fields must be present in the input
+    const auto x = getFieldSafely("x", float{});
+    const auto y = getFieldSafely("y", float{});
+    const auto z = getFieldSafely("z", float{});
+    const auto intensity = getFieldSafely("intensity", float{});
+    const auto ring = getFieldSafely("ring", uint16_t{});
+    const auto azimuth = getFieldSafely("azimuth", float{});
+    const auto distance = getFieldSafely("distance", float{});
+
+    if (!x || !y || !z || !intensity || !ring || !azimuth || !distance) {
+      RCLCPP_ERROR(get_logger(), "One or more required fields are missing in input point cloud");
+      return;
+    }
+
+    const DynamicInputLayout layout{*x, *y, *z, *intensity, *ring, *azimuth, *distance};
+    filter_with_layout(layout, input, output, transform_info);
+  }
+
   // add processing time for debug
   if (debug_publisher_) {
     const double cyclic_time_ms = stop_watch_ptr_->toc("cyclic_time", true);
@@ -375,6 +475,9 @@ rcl_interfaces::msg::SetParametersResult RingOutlierFilterComponent::paramCallba
   if (get_param(p, "num_points_threshold", num_points_threshold_)) {
     RCLCPP_DEBUG(get_logger(), "Setting new num_points_threshold to: %d.", num_points_threshold_);
   }
+  if (get_param(p, "num_threads", num_threads_)) {
+    RCLCPP_DEBUG(get_logger(), "Setting new num_threads to: %d.", num_threads_);
+  }
 
   rcl_interfaces::msg::SetParametersResult result;
   result.successful = true;
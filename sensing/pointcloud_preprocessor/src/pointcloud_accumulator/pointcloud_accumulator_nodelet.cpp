@@ -14,6 +14,10 @@
 
 #include "pointcloud_preprocessor/pointcloud_accumulator/pointcloud_accumulator_nodelet.hpp"
 
+#include <sensor_msgs/point_cloud2_iterator.hpp>
+
+#include <cstring>
+#include <utility>
 #include <vector>
 
 namespace pointcloud_preprocessor
@@ -40,19 +44,86 @@ void PointcloudAccumulatorComponent::filter(
   if (indices) {
     RCLCPP_WARN(get_logger(), "Indices are not supported and will be ignored");
   }
-  pointcloud_buffer_.push_front(input);
-  rclcpp::Time last_time = input->header.stamp;
-  pcl::PointCloud<pcl::PointXYZ> pcl_input;
-  pcl::PointCloud<pcl::PointXYZ> pcl_output;
-  for (size_t i = 0; i < pointcloud_buffer_.size(); i++) {
-    if (accumulation_time_sec_ < (last_time - pointcloud_buffer_.at(i)->header.stamp).seconds()) {
+  if (
+    pcl::getFieldIndex(*input, "x") < 0 || pcl::getFieldIndex(*input, "y") < 0 ||
+    pcl::getFieldIndex(*input, "z") < 0) {
+    RCLCPP_WARN(get_logger(), "The input pointcloud does not have the x, y and z fields.");
+    return;
+  }
+
+  // Only the newest cloud is converted. The input has already been transformed into input_frame
+  // by the Filter, so the buffered clouds are kept in the output layout and are only copied.
+  AccumulatedCloud cloud;
+  if (!pointcloud_buffer_.empty() && pointcloud_buffer_.full()) {
+    cloud.data = std::move(pointcloud_buffer_.back().data);
+  }
+  cloud.stamp = input->header.stamp;
+  convertToOutputLayout(*input, cloud);
+  pointcloud_buffer_.push_front(std::move(cloud));
+
+  const rclcpp::Time last_time = input->header.stamp;
+  size_t num_clouds = 0;
+  size_t data_size = 0;
+  bool is_dense = true;
+  for (const auto & accumulated_cloud : pointcloud_buffer_) {
+    if (accumulation_time_sec_ < (last_time - accumulated_cloud.stamp).seconds()) {
       break;
     }
-    pcl::fromROSMsg(*pointcloud_buffer_.at(i), pcl_input);
-    pcl_output += pcl_input;
+    ++num_clouds;
+    data_size += accumulated_cloud.data.size();
+    is_dense = is_dense && accumulated_cloud.is_dense;
+  }
+
+  pcl::toROSMsg(pcl::PointCloud<pcl::PointXYZ>{}, output);
+  output.data.resize(data_size);
+  size_t offset = 0;
+  for (size_t i = 0; i < num_clouds; ++i) {
+    const auto & data = pointcloud_buffer_.at(i).data;
+    if (!data.empty()) {
+      std::memcpy(output.data.data() + offset, data.data(), data.size());
+    }
+    offset += data.size();
   }
-  pcl::toROSMsg(pcl_output, output);
   output.header = input->header;
+  output.height = 1;
+  output.width = static_cast<uint32_t>(data_size / output.point_step);
+  output.row_step = static_cast<uint32_t>(data_size);
+  output.is_dense = is_dense;
+}
+
+void PointcloudAccumulatorComponent::convertToOutputLayout(
+  const PointCloud2 & input, AccumulatedCloud & cloud)
+{
+  constexpr size_t output_point_step = sizeof(pcl::PointXYZ);
+  const size_t num_points = static_cast<size_t>(input.width) * input.height;
+  cloud.data.resize(num_points * output_point_step);
+  cloud.is_dense = input.is_dense;
+  if (num_points == 0) {
+    return;
+  }
+
+  const int x_index = pcl::getFieldIndex(input, "x");
+  const int y_index = pcl::getFieldIndex(input, "y");
+  const int z_index = pcl::getFieldIndex(input, "z");
+  const bool has_output_layout =
+    input.fields[x_index].offset == 0 && input.fields[y_index].offset == 4 &&
+    input.fields[z_index].offset == 8 && input.point_step == output_point_step &&
+    input.row_step == input.width * input.point_step;
+  if (has_output_layout && input.data.size() >= cloud.data.size()) {
+    std::memcpy(cloud.data.data(), input.data.data(), cloud.data.size());
+    return;
+  }
+
+  sensor_msgs::PointCloud2ConstIterator<float> iter_x(input, "x");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_y(input, "y");
+  sensor_msgs::PointCloud2ConstIterator<float> iter_z(input, "z");
+  for (size_t i = 0; i < num_points && iter_x != iter_x.end(); ++i, ++iter_x, ++iter_y, ++iter_z) {
+    auto * point = reinterpret_cast<pcl::PointXYZ *>(cloud.data.data()) + i;
+    point->x = *iter_x;
+    point->y = *iter_y;
+    point->z = *iter_z;
+    point->data[3] = 1.0f;
+  }
 }
 
 rcl_interfaces::msg::SetParametersResult PointcloudAccumulatorComponent::paramCallback(
@@ -71,6 +71,8 @@ void PolygonRemoverComponent::update_polygon(
   const geometry_msgs::msg::Polygon::ConstSharedPtr & polygon_in)
 {
   pointcloud_preprocessor::utils::to_cgal_polygon(*polygon_in, polygon_cgal_);
+  // the edge table is built once, since the polygon is static
+  scanline_polygon_ = ScanlinePolygon(polygon_cgal_);
   if (will_visualize_) {
     marker_.ns = "";
     marker_.id = 0;
@@ -131,9 +133,19 @@ sensor_msgs::msg::PointCloud2 PolygonRemoverComponent::remove_updated_polygon_fr
     throw std::runtime_error("Polygon is not initialized. Please use `update_polygon` first.");
   }
 
+  pcl::PointCloud<pcl::PointXYZ> pcl_output;
+  pcl_output.reserve(cloud_in->width * cloud_in->height);
+  for (sensor_msgs::PointCloud2ConstIterator<float> iter_x(*cloud_in, "x"), iter_y(*cloud_in, "y"),
+       iter_z(*cloud_in, "z");
+       iter_x != iter_x.end(); ++iter_x, ++iter_y, ++iter_z) {
+    if (!scanline_polygon_.contains(*iter_x, *iter_y)) {
+      pcl_output.emplace_back(*iter_x, *iter_y, *iter_z);
+    }
+  }
+
   PointCloud2 cloud_out;
-  pointcloud_preprocessor::utils::remove_polygon_cgal_from_cloud(
-    *cloud_in, polygon_cgal_, cloud_out);
+  pcl::toROSMsg(pcl_output, cloud_out);
+  cloud_out.header = cloud_in->header;
   return cloud_out;
 }
 }  // namespace pointcloud_preprocessor
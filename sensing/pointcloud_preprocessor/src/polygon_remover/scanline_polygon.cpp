@@ -0,0 +1,93 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "pointcloud_preprocessor/polygon_remover/scanline_polygon.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+// distance from an edge within which the point is tested by CGAL [m]
+constexpr double EDGE_TOLERANCE = 1e-6;
+}  // namespace
+
+namespace pointcloud_preprocessor
+{
+ScanlinePolygon::ScanlinePolygon(const PolygonCgal & polygon) : polygon_(polygon)
+{
+  if (polygon_.empty()) {
+    return;
+  }
+
+  min_x_ = max_x_ = polygon_.front().x();
+  min_y_ = max_y_ = polygon_.front().y();
+  for (const auto & vertex : polygon_) {
+    min_x_ = std::min(min_x_, vertex.x());
+    min_y_ = std::min(min_y_, vertex.y());
+    max_x_ = std::max(max_x_, vertex.x());
+    max_y_ = std::max(max_y_, vertex.y());
+    band_y_.push_back(vertex.y());
+  }
+  std::sort(band_y_.begin(), band_y_.end());
+  band_y_.erase(std::unique(band_y_.begin(), band_y_.end()), band_y_.end());
+
+  band_begin_.reserve(band_y_.size());
+  band_begin_.push_back(0);
+  for (size_t band = 0; band + 1 < band_y_.size(); ++band) {
+    const double band_min_y = band_y_[band];
+    const double band_max_y = band_y_[band + 1];
+    for (size_t i = 0; i < polygon_.size(); ++i) {
+      const auto & p = polygon_[i];
+      const auto & q = polygon_[(i + 1) % polygon_.size()];
+      // horizontal edges never span a band
+      if (std::min(p.y(), q.y()) <= band_min_y && std::max(p.y(), q.y()) >= band_max_y) {
+        band_edges_.push_back({p.x(), p.y(), (q.x() - p.x()) / (q.y() - p.y())});
+      }
+    }
+    band_begin_.push_back(band_edges_.size());
+  }
+}
+
+bool ScanlinePolygon::contains(const double x, const double y) const
+{
+  if (!(x >= min_x_ && x <= max_x_ && y >= min_y_ && y <= max_y_)) {
+    return false;
+  }
+
+  // the last band ends at band_y_.back(), which is on a vertex
+  const auto band =
+    static_cast<size_t>(std::upper_bound(band_y_.begin(), band_y_.end(), y) - band_y_.begin()) - 1;
+  if (y == band_y_[band]) {
+    return containsExactly(x, y);
+  }
+
+  bool is_inside = false;
+  for (size_t i = band_begin_[band]; i < band_begin_[band + 1]; ++i) {
+    const auto & edge = band_edges_[i];
+    const double edge_x = edge.x0 + (y - edge.y0) * edge.dx_dy;
+    if (std::abs(edge_x - x) <= EDGE_TOLERANCE) {
+      return containsExactly(x, y);
+    }
+    is_inside ^= edge_x > x;
+  }
+  return is_inside;
+}
+
+bool ScanlinePolygon::containsExactly(const double x, const double y) const
+{
+  return CGAL::bounded_side_2(polygon_.begin(), polygon_.end(), PointCgal(x, y), K()) !=
+         CGAL::ON_UNBOUNDED_SIDE;
+}
+}  // namespace pointcloud_preprocessor
@@ -41,6 +41,8 @@ Lanelet2MapFilterComponent::Lanelet2MapFilterComponent(const rclcpp::NodeOptions
   {
     voxel_size_x_ = declare_parameter("voxel_size_x", 0.04);
     voxel_size_y_ = declare_parameter("voxel_size_y", 0.04);
+    use_polygon_raster_ = declare_parameter("use_polygon_raster", true);
+    polygon_raster_resolution_ = declare_parameter("polygon_raster_resolution", 0.5);
   }
 
   // Set publisher
@@ -216,6 +218,35 @@ pcl::PointCloud<pcl::PointXYZ> Lanelet2MapFilterComponent::getLaneFilteredPointC
   return filtered_cloud;
 }
 
+pcl::PointCloud<pcl::PointXYZ> Lanelet2MapFilterComponent::getRasterFilteredPointCloud(
+  const pcl::PointCloud<pcl::PointXYZ>::Ptr & cloud) const
+{
+  pcl::PointCloud<pcl::PointXYZ> filtered_cloud;
+  filtered_cloud.header = cloud->header;
+  filtered_cloud.points.reserve(cloud->points.size());
+
+  // Each point is tested by a bit of the raster, and only the points in the cells crossed by the
+  // lanelet bounds are tested against the polygons crossing the cell.
+  for (const auto & p : cloud->points) {
+    const auto state = road_raster_.getCellState(p.x, p.y);
+    if (state == PolygonRaster::CellState::INSIDE) {
+      filtered_cloud.points.push_back(p);
+    } else if (state == PolygonRaster::CellState::BOUNDARY) {
+      const Point2d point(p.x, p.y);
+      for (const auto index : road_raster_.getBoundaryPolygonIndices(p.x, p.y)) {
+        if (boost::geometry::within(point, road_polygons_[index])) {
+          filtered_cloud.points.push_back(p);
+          break;
+        }
+      }
+    }
+  }
+  filtered_cloud.width = filtered_cloud.points.size();
+  filtered_cloud.height = 1;
+
+  return filtered_cloud;
+}
+
 void Lanelet2MapFilterComponent::pointcloudCallback(const PointCloud2ConstPtr cloud_msg)
 {
   if (!lanelet_map_ptr_) {
@@ -236,12 +267,18 @@ void Lanelet2MapFilterComponent::pointcloudCallback(const PointCloud2ConstPtr cl
   if (cloud->points.empty()) {
     return;
   }
-  // calculate convex hull
-  const auto convex_hull = getConvexHull(cloud);
-  // get intersected lanelets
-  lanelet::ConstLanelets intersected_lanelets = getIntersectedLanelets(convex_hull, road_lanelets_);
-  // filter pointcloud by lanelet
-  const auto filtered_cloud = getLaneFilteredPointCloud(intersected_lanelets, cloud);
+  pcl::PointCloud<pcl::PointXYZ> filtered_cloud;
+  if (use_polygon_raster_) {
+    filtered_cloud = getRasterFilteredPointCloud(cloud);
+  } else {
+    // calculate convex hull
+    const auto convex_hull = getConvexHull(cloud);
+    // get intersected lanelets
+    lanelet::ConstLanelets intersected_lanelets =
+      getIntersectedLanelets(convex_hull, road_lanelets_);
+    // filter pointcloud by lanelet
+    filtered_cloud = getLaneFilteredPointCloud(intersected_lanelets, cloud);
+  }
   // transform pointcloud to input frame
   PointCloud2Ptr output_cloud_ptr(new sensor_msgs::msg::PointCloud2);
   pcl::toROSMsg(filtered_cloud, *output_cloud_ptr);
@@ -265,6 +302,15 @@ void Lanelet2MapFilterComponent::mapCallback(
   lanelet::utils::conversion::fromBinMsg(*map_msg, lanelet_map_ptr_);
   const lanelet::ConstLanelets all_lanelets = lanelet::utils::query::laneletLayer(lanelet_map_ptr_);
   road_lanelets_ = lanelet::utils::query::roadLanelets(all_lanelets);
+
+  if (use_polygon_raster_) {
+    road_polygons_.clear();
+    road_polygons_.reserve(road_lanelets_.size());
+    for (const auto & road_lanelet : road_lanelets_) {
+      road_polygons_.push_back(road_lanelet.polygon2d().basicPolygon());
+    }
+    road_raster_ = PolygonRaster(road_polygons_, polygon_raster_resolution_);
+  }
 }
 
 }  // namespace pointcloud_preprocessor
@@ -0,0 +1,243 @@
+// Copyright 2023 TIER IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "pointcloud_preprocessor/vector_map_filter/polygon_raster.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+namespace
+{
+// margin of the cells for the edge crossing test, so that an edge on the border of cells marks both
+constexpr double CELL_MARGIN = 1e-6;
+
+// true if the segment p-q touches the box [min_x, max_x] x [min_y, max_y]
+bool segmentIntersectsBox(
+  const lanelet::BasicPoint2d & p, const lanelet::BasicPoint2d & q, const double min_x,
+  const double min_y, const double max_x, const double max_y)
+{
+  if (
+    std::max(p.x(), q.x()) < min_x || std::min(p.x(), q.x()) > max_x ||
+    std::max(p.y(), q.y()) < min_y || std::min(p.y(), q.y()) > max_y) {
+    return false;
+  }
+  // the box does not touch the segment if all the corners are on the same side of its line
+  const double dx = q.x() - p.x();
+  const double dy = q.y() - p.y();
+  const auto side = [&](const double x, const double y) {
+    return dx * (y - p.y()) - dy * (x - p.x());
+  };
+  const double s0 = side(min_x, min_y);
+  const double s1 = side(max_x, min_y);
+  const double s2 = side(max_x, max_y);
+  const double s3 = side(min_x, max_y);
+  return !((s0 > 0 && s1 > 0 && s2 > 0 && s3 > 0) || (s0 < 0 && s1 < 0 && s2 < 0 && s3 < 0));
+}
+}  // namespace
+
+namespace pointcloud_preprocessor
+{
+PolygonRaster::PolygonRaster(const lanelet::BasicPolygons2d & polygons, const double resolution)
+: resolution_(resolution)
+{
+  if (!(resolution > 0.0)) {
+    throw std::invalid_argument("The resolution of the polygon raster must be positive.");
+  }
+
+  double max_x = std::numeric_limits<double>::lowest();
+  double max_y = std::numeric_limits<double>::lowest();
+  min_x_ = std::numeric_limits<double>::max();
+  min_y_ = std::numeric_limits<double>::max();
+  for (const auto & polygon : polygons) {
+    for (const auto & point : polygon) {
+      min_x_ = std::min(min_x_, point.x());
+      min_y_ = std::min(min_y_, point.y());
+      max_x = std::max(max_x, point.x());
+      max_y = std::max(max_y, point.y());
+    }
+  }
+  if (max_x < min_x_) {
+    min_x_ = 0.0;
+    min_y_ = 0.0;
+    return;
+  }
+
+  num_cells_x_ = static_cast<int>((max_x - min_x_) / resolution_) + 1;
+  num_cells_y_ = static_cast<int>((max_y - min_y_) / resolution_) + 1;
+  num_tiles_x_ = (num_cells_x_ + TILE_SIZE - 1) / TILE_SIZE;
+  num_tiles_y_ = (num_cells_y_ + TILE_SIZE - 1) / TILE_SIZE;
+  tile_indices_.assign(static_cast<size_t>(num_tiles_x_) * num_tiles_y_, -1);
+
+  for (size_t i = 0; i < polygons.size(); ++i) {
+    addPolygon(polygons.at(i), static_cast<uint32_t>(i));
+  }
+}
+
+PolygonRaster::CellState PolygonRaster::getCellState(const double x, const double y) const
+{
+  int cell_x;
+  int cell_y;
+  if (!toCell(x, y, cell_x, cell_y)) {
+    return CellState::OUTSIDE;
+  }
+  const auto * tile = getTile(cell_x, cell_y);
+  if (!tile) {
+    return CellState::OUTSIDE;
+  }
+  const int row = cell_y & (TILE_SIZE - 1);
+  const uint64_t bit = uint64_t{1} << (cell_x & (TILE_SIZE - 1));
+  if (tile->inside[row] & bit) {
+    return CellState::INSIDE;
+  }
+  return (tile->boundary[row] & bit) ? CellState::BOUNDARY : CellState::OUTSIDE;
+}
+
+const std::vector<uint32_t> & PolygonRaster::getBoundaryPolygonIndices(
+  const double x, const double y) const
+{
+  static const std::vector<uint32_t> empty_indices;
+  int cell_x;
+  int cell_y;
+  if (getCellState(x, y) != CellState::BOUNDARY || !toCell(x, y, cell_x, cell_y)) {
+    return empty_indices;
+  }
+  const auto itr = boundary_polygon_indices_.find(toCellKey(cell_x, cell_y));
+  return itr == boundary_polygon_indices_.end() ? empty_indices : itr->second;
+}
+
+bool PolygonRaster::toCell(const double x, const double y, int & cell_x, int & cell_y) const
+{
+  // NaN fails both comparisons
+  const double fx = std::floor((x - min_x_) / resolution_);
+  const double fy = std::floor((y - min_y_) / resolution_);
+  if (!(fx >= 0.0 && fx < num_cells_x_ && fy >= 0.0 && fy < num_cells_y_)) {
+    return false;
+  }
+  cell_x = static_cast<int>(fx);
+  cell_y = static_cast<int>(fy);
+  return true;
+}
+
+PolygonRaster::Tile & PolygonRaster::getOrCreateTile(const int cell_x, const int cell_y)
+{
+  const auto tile_y = static_cast<size_t>(cell_y >> TILE_BITS);
+  auto & index = tile_indices_[tile_y * num_tiles_x_ + (cell_x >> TILE_BITS)];
+  if (index < 0) {
+    index = static_cast<int32_t>(tiles_.size());
+    tiles_.emplace_back();
+  }
+  return tiles_[index];
+}
+
+const PolygonRaster::Tile * PolygonRaster::getTile(const int cell_x, const int cell_y) const
+{
+  const auto tile_y = static_cast<size_t>(cell_y >> TILE_BITS);
+  const auto index = tile_indices_[tile_y * num_tiles_x_ + (cell_x >> TILE_BITS)];
+  return index < 0 ? nullptr : &tiles_[index];
+}
+
+void PolygonRaster::addPolygon(
+  const lanelet::BasicPolygon2d & polygon, const uint32_t polygon_index)
+{
+  if (polygon.size() < 3) {
+    return;
+  }
+
+  const auto toCellX = [&](const double x) {
+    const auto cell_x = static_cast<int>(std::floor((x - min_x_) / resolution_));
+    return std::clamp(cell_x, 0, num_cells_x_ - 1);
+  };
+  const auto toCellY = [&](const double y) {
+    const auto cell_y = static_cast<int>(std::floor((y - min_y_) / resolution_));
+    return std::clamp(cell_y, 0, num_cells_y_ - 1);
+  };
+
+  double min_x = std::numeric_limits<double>::max();
+  double min_y = std::numeric_limits<double>::max();
+  double max_x = std::numeric_limits<double>::lowest();
+  double max_y = std::numeric_limits<double>::lowest();
+  for (const auto & point : polygon) {
+    min_x = std::min(min_x, point.x());
+    min_y = std::min(min_y, point.y());
+    max_x = std::max(max_x, point.x());
+    max_y = std::max(max_y, point.y());
+  }
+  const int begin_x = toCellX(min_x - CELL_MARGIN);
+  const int begin_y = toCellY(min_y - CELL_MARGIN);
+  const int width = toCellX(max_x + CELL_MARGIN) - begin_x + 1;
+  const int height = toCellY(max_y + CELL_MARGIN) - begin_y + 1;
+
+  // cells crossed by the edges, over the bounding box of the polygon
+  std::vector<bool> is_boundary(static_cast<size_t>(width) * height, false);
+  for (size_t i = 0; i < polygon.size(); ++i) {
+    const auto & p = polygon[i];
+    const auto & q = polygon[(i + 1) % polygon.size()];
+    const int edge_begin_x = toCellX(std::min(p.x(), q.x()) - CELL_MARGIN);
+    const int edge_begin_y = toCellY(std::min(p.y(), q.y()) - CELL_MARGIN);
+    const int edge_end_x = toCellX(std::max(p.x(), q.x()) + CELL_MARGIN);
+    const int edge_end_y = toCellY(std::max(p.y(), q.y()) + CELL_MARGIN);
+    for (int cell_y = edge_begin_y; cell_y <= edge_end_y; ++cell_y) {
+      for (int cell_x = edge_begin_x; cell_x <= edge_end_x; ++cell_x) {
+        auto && local_boundary = is_boundary[(cell_y - begin_y) * width + (cell_x - begin_x)];
+        if (local_boundary) {
+          continue;
+        }
+        const double cell_min_x = min_x_ + cell_x * resolution_;
+        const double cell_min_y = min_y_ + cell_y * resolution_;
+        if (!segmentIntersectsBox(
+              p, q, cell_min_x - CELL_MARGIN, cell_min_y - CELL_MARGIN,
+              cell_min_x + resolution_ + CELL_MARGIN, cell_min_y + resolution_ + CELL_MARGIN)) {
+          continue;
+        }
+        local_boundary = true;
+        getOrCreateTile(cell_x, cell_y).boundary[cell_y & (TILE_SIZE - 1)] |=
+          uint64_t{1} << (cell_x & (TILE_SIZE - 1));
+        boundary_polygon_indices_[toCellKey(cell_x, cell_y)].push_back(polygon_index);
+      }
+    }
+  }
+
+  // A cell which no edge crosses is inside the polygon if its center is. The centers inside are
+  // found row by row between the pairs of the crossings of the edges with the row.
+  std::vector<double> crossings;
+  for (int cell_y = begin_y; cell_y < begin_y + height; ++cell_y) {
+    const double center_y = min_y_ + (cell_y + 0.5) * resolution_;
+    crossings.clear();
+    for (size_t i = 0; i < polygon.size(); ++i) {
+      const auto & p = polygon[i];
+      const auto & q = polygon[(i + 1) % polygon.size()];
+      if ((p.y() <= center_y) != (q.y() <= center_y)) {
+        crossings.push_back(p.x() + (center_y - p.y()) * (q.x() - p.x()) / (q.y() - p.y()));
+      }
+    }
+    std::sort(crossings.begin(), crossings.end());
+    for (size_t i = 0; i + 1 < crossings.size(); i += 2) {
+      const int first_x =
+        std::max(begin_x, static_cast<int>(std::ceil((crossings[i] - min_x_) / resolution_ - 0.5)));
+      const int last_x = std::min(
+        begin_x + width - 1,
+        static_cast<int>(std::floor((crossings[i + 1] - min_x_) / resolution_ - 0.5)));
+      for (int cell_x = first_x; cell_x <= last_x; ++cell_x) {
+        if (is_boundary[(cell_y - begin_y) * width + (cell_x - begin_x)]) {
+          continue;
+        }
+        getOrCreateTile(cell_x, cell_y).inside[cell_y & (TILE_SIZE - 1)] |=
+          uint64_t{1} << (cell_x & (TILE_SIZE - 1));
+      }
+    }
+  }
+}
+}  // namespace pointcloud_preprocessor
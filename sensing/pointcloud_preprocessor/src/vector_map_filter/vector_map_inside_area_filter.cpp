@@ -14,6 +14,9 @@
 
 #include "pointcloud_preprocessor/vector_map_filter/vector_map_inside_area_filter.hpp"
 
+#include <algorithm>
+#include <vector>
+
 namespace
 {
 tier4_autoware_utils::Box2d calcBoundingBox(
@@ -58,6 +61,41 @@ pcl::PointCloud<pcl::PointXYZ> removePointsWithinPolygons(
   return filtered_cloud;
 }
 
+pcl::PointCloud<pcl::PointXYZ> removePointsWithinRaster(
+  const pcl::PointCloud<pcl::PointXYZ>::Ptr & cloud_in,
+  const pointcloud_preprocessor::PolygonRaster & raster,
+  const std::vector<PolygonCgal> & cgal_polygons)
+{
+  using CellState = pointcloud_preprocessor::PolygonRaster::CellState;
+
+  pcl::PointCloud<pcl::PointXYZ> filtered_cloud;
+  filtered_cloud.points.reserve(cloud_in->points.size());
+  for (const auto & p : cloud_in->points) {
+    const auto state = raster.getCellState(p.x, p.y);
+    if (state == CellState::INSIDE) {
+      continue;
+    }
+    if (state == CellState::BOUNDARY) {
+      // only the polygons crossing the cell can contain the point
+      const auto & indices = raster.getBoundaryPolygonIndices(p.x, p.y);
+      const auto is_within = std::any_of(indices.begin(), indices.end(), [&](const auto index) {
+        const auto & polygon = cgal_polygons[index];
+        return CGAL::bounded_side_2(
+                 polygon.cbegin(), polygon.cend(), PointCgal(p.x, p.y), K()) ==
+               CGAL::ON_BOUNDED_SIDE;
+      });
+      if (is_within) {
+        continue;
+      }
+    }
+    filtered_cloud.points.push_back(p);
+  }
+  filtered_cloud.width = filtered_cloud.points.size();
+  filtered_cloud.height = 1;
+
+  return filtered_cloud;
+}
+
 }  // anonymous namespace
 
 namespace pointcloud_preprocessor
@@ -68,6 +106,8 @@ VectorMapInsideAreaFilterComponent::VectorMapInsideAreaFilterComponent(
 {
   polygon_type_ =
     static_cast<std::string>(declare_parameter("polygon_type", "no_obstacle_segmentation_area"));
+  use_polygon_raster_ = declare_parameter("use_polygon_raster", true);
+  polygon_raster_resolution_ = declare_parameter("polygon_raster_resolution", 0.5);
 
   using std::placeholders::_1;
   // Set subscriber
@@ -92,14 +132,19 @@ void VectorMapInsideAreaFilterComponent::filter(
   pcl::PointCloud<pcl::PointXYZ>::Ptr pc_input = pcl::make_shared<pcl::PointCloud<pcl::PointXYZ>>();
   pcl::fromROSMsg(*input, *pc_input);
 
-  // calculate bounding box of points
-  const auto bounding_box = calcBoundingBox(pc_input);
+  pcl::PointCloud<pcl::PointXYZ> filtered_pc;
+  if (use_polygon_raster_) {
+    filtered_pc = removePointsWithinRaster(pc_input, polygon_raster_, cgal_polygons_);
+  } else {
+    // calculate bounding box of points
+    const auto bounding_box = calcBoundingBox(pc_input);
 
-  // use only intersected lanelets to reduce calculation cost
-  const auto intersected_lanelets = calcIntersectedPolygons(bounding_box, polygon_lanelets_);
+    // use only intersected lanelets to reduce calculation cost
+    const auto intersected_lanelets = calcIntersectedPolygons(bounding_box, polygon_lanelets_);
 
-  // filter pointcloud by lanelet
-  const auto filtered_pc = removePointsWithinPolygons(pc_input, intersected_lanelets);
+    // filter pointcloud by lanelet
+    filtered_pc = removePointsWithinPolygons(pc_input, intersected_lanelets);
+  }
 
   // convert to ROS message
   pcl::toROSMsg(filtered_pc, output);
@@ -114,6 +159,18 @@ void VectorMapInsideAreaFilterComponent::mapCallback(
   const auto lanelet_map_ptr = std::make_shared<lanelet::LaneletMap>();
   lanelet::utils::conversion::fromBinMsg(*map_msg, lanelet_map_ptr);
   polygon_lanelets_ = lanelet::utils::query::getAllPolygonsByType(lanelet_map_ptr, polygon_type_);
+
+  if (use_polygon_raster_) {
+    lanelet::BasicPolygons2d polygons;
+    cgal_polygons_.clear();
+    for (const auto & polygon : polygon_lanelets_) {
+      polygons.push_back(lanelet::utils::to2D(polygon).basicPolygon());
+      PolygonCgal cgal_polygon;
+      utils::to_cgal_polygon(polygons.back(), cgal_polygon);
+      cgal_polygons_.push_back(cgal_polygon);
+    }
+    polygon_raster_ = PolygonRaster(polygons, polygon_raster_resolution_);
+  }
 }
 
 }  // namespace pointcloud_preprocessor
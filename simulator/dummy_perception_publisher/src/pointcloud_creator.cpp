@@ -44,6 +44,42 @@ pcl::PointXYZ getPointWrtBaseLink(
   return pcl::PointXYZ(p_wrt_base.x(), p_wrt_base.y(), p_wrt_base.z());
 }
 
+// Collect, for each ray of the ego-centric scan, the objects whose bounding circle the ray can
+// intersect, so that the ray is traced only against them. The i-th ray has the angle
+// (i + 1) * horizontal_theta_step.
+std::vector<std::vector<size_t>> getRayCandidateObjectIndices(
+  const std::vector<ObjectInfo> & obj_infos, const tf2::Transform & tf_base_link2map,
+  const size_t n_scan)
+{
+  std::vector<std::vector<size_t>> candidate_indices(n_scan);
+  const auto n_scan_int = static_cast<int>(n_scan);
+  for (size_t idx = 0; idx < obj_infos.size(); ++idx) {
+    const auto & obj_info = obj_infos.at(idx);
+    const auto center = (tf_base_link2map * obj_info.tf_map2moved_object).getOrigin();
+    const double center_dist = std::hypot(center.x(), center.y());
+    const double radius = 0.5 * std::hypot(obj_info.length, obj_info.width);
+    if (center_dist <= radius) {
+      for (auto & indices : candidate_indices) {
+        indices.push_back(idx);
+      }
+      continue;
+    }
+
+    const double center_angle = std::atan2(center.y(), center.x());
+    const double half_angle = std::asin(radius / center_dist);
+    // NOTE: one ray of margin on each side absorbs the rounding of the accumulated scan angle
+    const int min_ray_idx =
+      static_cast<int>(std::floor((center_angle - half_angle) / horizontal_theta_step)) - 2;
+    const int max_ray_idx =
+      static_cast<int>(std::ceil((center_angle + half_angle) / horizontal_theta_step));
+    for (int ray_idx = min_ray_idx; ray_idx <= std::min(max_ray_idx, min_ray_idx + n_scan_int - 1);
+         ++ray_idx) {
+      candidate_indices.at(((ray_idx % n_scan_int) + n_scan_int) % n_scan_int).push_back(idx);
+    }
+  }
+  return candidate_indices;
+}
+
 }  // namespace
 
 void ObjectCentricPointCloudCreator::create_object_pointcloud(
@@ -205,7 +241,6 @@ std::vector<pcl::PointCloud<pcl::PointXYZ>::Ptr> EgoCentricPointCloudCreator::cr
       obj_info.length, obj_info.width, tf_base_link2map * obj_info.tf_map2moved_object);
     sdf_ptrs.push_back(sdf_ptr);
   }
-  const auto composite_sdf = signed_distance_function::CompositeSDF(sdf_ptrs);
 
   std::vector<pcl::PointCloud<pcl::PointXYZ>::Ptr> pointclouds(obj_infos.size());
   for (size_t i = 0; i < obj_infos.size(); ++i) {
@@ -226,15 +261,28 @@ std::vector<pcl::PointCloud<pcl::PointXYZ>::Ptr> EgoCentricPointCloudCreator::cr
 
   double angle = 0.0;
   const auto n_scan = static_cast<size_t>(std::floor(2 * M_PI / horizontal_theta_step));
+  const auto ray_candidate_indices =
+    getRayCandidateObjectIndices(obj_infos, tf_base_link2map, n_scan);
+  std::vector<std::shared_ptr<signed_distance_function::AbstractSignedDistanceFunction>>
+    candidate_sdf_ptrs;
   for (size_t i = 0; i < n_scan; ++i) {
     angle += horizontal_theta_step;
+    const auto & candidate_indices = ray_candidate_indices.at(i);
+    if (candidate_indices.empty()) {
+      continue;
+    }
+    candidate_sdf_ptrs.clear();
+    for (const auto idx : candidate_indices) {
+      candidate_sdf_ptrs.push_back(sdf_ptrs.at(idx));
+    }
+    const auto composite_sdf = signed_distance_function::CompositeSDF(candidate_sdf_ptrs);
     const auto dist = composite_sdf.getSphereTracingDist(0.0, 0.0, angle, visible_range_);
 
     if (std::isfinite(dist)) {
       const auto x_hit = dist * cos(angle);
       const auto y_hit = dist * sin(angle);
-      const auto idx_hit = composite_sdf.nearest_sdf_index(x_hit, y_hit);
-      const auto obj_info_here = obj_infos.at(idx_hit);
+      const auto idx_hit = candidate_indices.at(composite_sdf.nearest_sdf_index(x_hit, y_hit));
+      const auto & obj_info_here = obj_infos.at(idx_hit);
       const auto min_z_here = min_zs.at(idx_hit);
       const auto max_z_here = max_zs.at(idx_hit);
       std::normal_distribution<> x_random(0.0, obj_info_here.std_dev_x);
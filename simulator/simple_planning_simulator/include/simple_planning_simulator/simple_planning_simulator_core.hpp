@@ -159,6 +159,9 @@ private:
 
   uint32_t timer_sampling_time_ms_;        //!< @brief timer sampling time
   rclcpp::TimerBase::SharedPtr on_timer_;  //!< @brief timer for simulation
+  int simulation_substep_num_;             //!< @brief number of model updates per timer tick
+  int publish_decimation_;                 //!< @brief publish outputs every this number of ticks
+  int publish_count_ = 0;                  //!< @brief ticks since the outputs were published
 
   OnSetParametersCallbackHandle::SharedPtr set_param_res_;
   rcl_interfaces::msg::SetParametersResult on_parameter(
@@ -0,0 +1,58 @@
+// Copyright 2023 The Autoware Foundation.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__INPUT_DELAY_BUFFER_HPP_
+#define SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__INPUT_DELAY_BUFFER_HPP_
+
+#include <cstddef>
+#include <vector>
+
+/**
+ * @class InputDelayBuffer
+ * @brief ring buffer delaying an input command by a fixed number of steps
+ */
+class InputDelayBuffer
+{
+public:
+  /**
+   * @brief initialize the buffer with zero inputs
+   * @param [in] delay_steps number of steps by which the input is delayed
+   */
+  void initialize(const size_t delay_steps)
+  {
+    buffer_.assign(delay_steps, 0.0);
+    index_ = 0;
+  }
+
+  /**
+   * @brief push the current input and get the input pushed delay_steps steps before
+   * @param [in] input current input
+   */
+  double pushAndGetDelayed(const double input)
+  {
+    if (buffer_.empty()) {
+      return input;
+    }
+    const double delayed_input = buffer_[index_];
+    buffer_[index_] = input;
+    index_ = (index_ + 1) % buffer_.size();
+    return delayed_input;
+  }
+
+private:
+  std::vector<double> buffer_;
+  size_t index_ = 0;
+};
+
+#endif  // SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__INPUT_DELAY_BUFFER_HPP_
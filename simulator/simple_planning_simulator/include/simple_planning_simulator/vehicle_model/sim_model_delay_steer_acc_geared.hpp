@@ -15,12 +15,12 @@
 #ifndef SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__SIM_MODEL_DELAY_STEER_ACC_GEARED_HPP_
 #define SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__SIM_MODEL_DELAY_STEER_ACC_GEARED_HPP_
 
+#include "simple_planning_simulator/vehicle_model/input_delay_buffer.hpp"
 #include "simple_planning_simulator/vehicle_model/sim_model_interface.hpp"
 
 #include <Eigen/Core>
 #include <Eigen/LU>
 
-#include <deque>
 #include <iostream>
 #include <queue>
 
@@ -74,13 +74,13 @@ private:
   const double steer_rate_lim_;  //!< @brief steering angular velocity limit [rad/s]
   const double wheelbase_;       //!< @brief vehicle wheelbase length [m]
 
-  std::deque<double> acc_input_queue_;    //!< @brief buffer for accel command
-  std::deque<double> steer_input_queue_;  //!< @brief buffer for steering command
-  const double acc_delay_;                //!< @brief time delay for accel command [s]
-  const double acc_time_constant_;        //!< @brief time constant for accel dynamics
-  const double steer_delay_;              //!< @brief time delay for steering command [s]
-  const double steer_time_constant_;      //!< @brief time constant for steering dynamics
-  const double steer_dead_band_;          //!< @brief dead band for steering angle [rad]
+  InputDelayBuffer acc_input_queue_;    //!< @brief buffer for accel command
+  InputDelayBuffer steer_input_queue_;  //!< @brief buffer for steering command
+  const double acc_delay_;              //!< @brief time delay for accel command [s]
+  const double acc_time_constant_;      //!< @brief time constant for accel dynamics
+  const double steer_delay_;            //!< @brief time delay for steering command [s]
+  const double steer_time_constant_;    //!< @brief time constant for steering dynamics
+  const double steer_dead_band_;        //!< @brief dead band for steering angle [rad]
 
   /**
    * @brief set queue buffer for input command
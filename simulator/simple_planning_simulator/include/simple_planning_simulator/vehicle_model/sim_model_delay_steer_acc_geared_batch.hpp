@@ -0,0 +1,164 @@
+// Copyright 2023 The Autoware Foundation.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__SIM_MODEL_DELAY_STEER_ACC_GEARED_BATCH_HPP_
+#define SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__SIM_MODEL_DELAY_STEER_ACC_GEARED_BATCH_HPP_
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+/**
+ * @class SimModelDelaySteerAccGearedBatch
+ * @brief calculate the dynamics of SimModelDelaySteerAccGeared for a batch of vehicles at once
+ * @details The vehicles share the model parameters and the delta time. Each state and input is
+ * stored as an array over the vehicles, so that a step is a sequence of loops over contiguous
+ * arrays which the compiler can vectorize. It does not depend on the node and can be stepped by a
+ * headless runner, e.g. for parameter sweeps.
+ */
+class SimModelDelaySteerAccGearedBatch
+{
+public:
+  /**
+   * @brief states of the vehicles, one array element per vehicle
+   */
+  struct States
+  {
+    std::vector<double> x;      //!< @brief position x [m]
+    std::vector<double> y;      //!< @brief position y [m]
+    std::vector<double> yaw;    //!< @brief yaw angle [rad]
+    std::vector<double> vx;     //!< @brief longitudinal velocity [m/s]
+    std::vector<double> steer;  //!< @brief steering angle [rad]
+    std::vector<double> accx;   //!< @brief longitudinal acceleration [m/ss]
+
+    void resize(const size_t size);
+  };
+
+  /**
+   * @brief constructor
+   * @param [in] vehicle_num number of vehicles
+   * @param [in] vx_lim velocity limit [m/s]
+   * @param [in] steer_lim steering limit [rad]
+   * @param [in] vx_rate_lim acceleration limit [m/ss]
+   * @param [in] steer_rate_lim steering angular velocity limit [rad/ss]
+   * @param [in] wheelbase vehicle wheelbase length [m]
+   * @param [in] dt delta time information to set input buffer for delay
+   * @param [in] acc_delay time delay for accel command [s]
+   * @param [in] acc_time_constant time constant for 1D model of accel dynamics
+   * @param [in] steer_delay time delay for steering command [s]
+   * @param [in] steer_time_constant time constant for 1D model of steering dynamics
+   * @param [in] steer_dead_band dead band for steering angle [rad]
+   */
+  SimModelDelaySteerAccGearedBatch(
+    size_t vehicle_num, double vx_lim, double steer_lim, double vx_rate_lim, double steer_rate_lim,
+    double wheelbase, double dt, double acc_delay, double acc_time_constant, double steer_delay,
+    double steer_time_constant, double steer_dead_band);
+
+  /**
+   * @brief update the states of all the vehicles
+   * @param [in] dt delta time [s]
+   */
+  void update(const double dt);
+
+  /**
+   * @brief get number of vehicles
+   */
+  size_t getVehicleNum() const { return vehicle_num_; }
+
+  /**
+   * @brief get states of the vehicles
+   */
+  const States & getStates() const { return state_; }
+
+  /**
+   * @brief get states of the vehicles to set them
+   */
+  States & getStates() { return state_; }
+
+  /**
+   * @brief set input of a vehicle
+   * @param [in] index index of the vehicle
+   * @param [in] acc_des desired acceleration [m/ss]
+   * @param [in] steer_des desired steering angle [rad]
+   * @param [in] gear gear command defined in autoware_auto_msgs/GearCommand
+   */
+  void setInput(
+    const size_t index, const double acc_des, const double steer_des, const uint8_t gear);
+
+private:
+  const double MIN_TIME_CONSTANT;  //!< @brief minimum time constant
+
+  const size_t vehicle_num_;          //!< @brief number of vehicles
+  const double vx_lim_;               //!< @brief velocity limit [m/s]
+  const double vx_rate_lim_;          //!< @brief acceleration limit [m/ss]
+  const double steer_lim_;            //!< @brief steering limit [rad]
+  const double steer_rate_lim_;       //!< @brief steering angular velocity limit [rad/s]
+  const double wheelbase_;            //!< @brief vehicle wheelbase length [m]
+  const double acc_time_constant_;    //!< @brief time constant for accel dynamics
+  const double steer_time_constant_;  //!< @brief time constant for steering dynamics
+  const double steer_dead_band_;      //!< @brief dead band for steering angle [rad]
+
+  States state_;       //!< @brief states of the vehicles
+  States prev_state_;  //!< @brief states before the update, for the gear
+  States tmp_state_;   //!< @brief intermediate states of the Runge-Kutta method
+  States k_[4];        //!< @brief derivatives of the Runge-Kutta method
+
+  std::vector<double> acc_des_;    //!< @brief desired acceleration of the vehicles
+  std::vector<double> steer_des_;  //!< @brief desired steering angle of the vehicles
+  std::vector<uint8_t> gear_;      //!< @brief gear command of the vehicles
+
+  // ring buffers of the delayed inputs, one row of vehicle_num_ elements per delay step
+  std::vector<double> acc_input_queue_;    //!< @brief buffer for accel command
+  std::vector<double> steer_input_queue_;  //!< @brief buffer for steering command
+  size_t acc_input_queue_index_ = 0;       //!< @brief row of the oldest accel command
+  size_t steer_input_queue_index_ = 0;     //!< @brief row of the oldest steering command
+  std::vector<double> delayed_acc_des_;    //!< @brief delayed desired acceleration
+  std::vector<double> delayed_steer_des_;  //!< @brief delayed desired steering angle
+
+  /**
+   * @brief push the inputs to the delay buffer and get the delayed inputs
+   * @param [in] input inputs of the vehicles
+   * @param [inout] queue ring buffer of the inputs
+   * @param [inout] queue_index row of the oldest inputs in the ring buffer
+   * @param [out] delayed_input delayed inputs of the vehicles
+   */
+  void pushAndGetDelayed(
+    const std::vector<double> & input, std::vector<double> & queue, size_t & queue_index,
+    std::vector<double> & delayed_input) const;
+
+  /**
+   * @brief calculate derivative of states with vehicle model
+   * @param [in] state current states
+   * @param [out] d_state derivative of the states
+   */
+  void calcModel(const States & state, States & d_state) const;
+
+  /**
+   * @brief calculate the intermediate states of the Runge-Kutta method
+   * @param [in] state current states
+   * @param [in] d_state derivative of the states
+   * @param [in] dt delta time [s]
+   * @param [out] next_state states advanced by d_state * dt
+   */
+  void advance(
+    const States & state, const States & d_state, const double dt, States & next_state) const;
+
+  /**
+   * @brief update state considering current gear
+   * @param [in] dt delta time [s]
+   */
+  void updateStateWithGear(const double dt);
+};
+
+#endif  // SIMPLE_PLANNING_SIMULATOR__VEHICLE_MODEL__SIM_MODEL_DELAY_STEER_ACC_GEARED_BATCH_HPP_
@@ -166,6 +166,8 @@ SimplePlanningSimulator::SimplePlanningSimulator(const rclcpp::NodeOptions & opt
     std::bind(&SimplePlanningSimulator::on_parameter, this, _1));
 
   timer_sampling_time_ms_ = static_cast<uint32_t>(declare_parameter("timer_sampling_time_ms", 25));
+  simulation_substep_num_ = std::max(1, declare_parameter("simulation_substep_num", 1));
+  publish_decimation_ = std::max(1, declare_parameter("publish_decimation", 1));
   on_timer_ = rclcpp::create_timer(
     this, get_clock(), std::chrono::milliseconds(timer_sampling_time_ms_),
     std::bind(&SimplePlanningSimulator::on_timer, this));
@@ -230,6 +232,7 @@ void SimplePlanningSimulator::initialize_vehicle_model()
   const double steer_time_delay = declare_parameter("steer_time_delay", 0.24);
   const double steer_time_constant = declare_parameter("steer_time_constant", 0.27);
   const double steer_dead_band = declare_parameter("steer_dead_band", 0.0);
+  const double dt = timer_sampling_time_ms_ / 1000.0 / simulation_substep_num_;
   const auto vehicle_info = vehicle_info_util::VehicleInfoUtil(*this).getVehicleInfo();
   const double wheelbase = vehicle_info.wheel_base_m;
 
@@ -245,18 +248,18 @@ void SimplePlanningSimulator::initialize_vehicle_model()
   } else if (vehicle_model_type_str == "DELAY_STEER_VEL") {
     vehicle_model_type_ = VehicleModelType::DELAY_STEER_VEL;
     vehicle_model_ptr_ = std::make_shared<SimModelDelaySteerVel>(
-      vel_lim, steer_lim, vel_rate_lim, steer_rate_lim, wheelbase, timer_sampling_time_ms_ / 1000.0,
-      vel_time_delay, vel_time_constant, steer_time_delay, steer_time_constant, steer_dead_band);
+      vel_lim, steer_lim, vel_rate_lim, steer_rate_lim, wheelbase, dt, vel_time_delay,
+      vel_time_constant, steer_time_delay, steer_time_constant, steer_dead_band);
   } else if (vehicle_model_type_str == "DELAY_STEER_ACC") {
     vehicle_model_type_ = VehicleModelType::DELAY_STEER_ACC;
     vehicle_model_ptr_ = std::make_shared<SimModelDelaySteerAcc>(
-      vel_lim, steer_lim, vel_rate_lim, steer_rate_lim, wheelbase, timer_sampling_time_ms_ / 1000.0,
-      acc_time_delay, acc_time_constant, steer_time_delay, steer_time_constant, steer_dead_band);
+      vel_lim, steer_lim, vel_rate_lim, steer_rate_lim, wheelbase, dt, acc_time_delay,
+      acc_time_constant, steer_time_delay, steer_time_constant, steer_dead_band);
   } else if (vehicle_model_type_str == "DELAY_STEER_ACC_GEARED") {
     vehicle_model_type_ = VehicleModelType::DELAY_STEER_ACC_GEARED;
     vehicle_model_ptr_ = std::make_shared<SimModelDelaySteerAccGeared>(
-      vel_lim, steer_lim, vel_rate_lim, steer_rate_lim, wheelbase, timer_sampling_time_ms_ / 1000.0,
-      acc_time_delay, acc_time_constant, steer_time_delay, steer_time_constant, steer_dead_band);
+      vel_lim, steer_lim, vel_rate_lim, steer_rate_lim, wheelbase, dt, acc_time_delay,
+      acc_time_constant, steer_time_delay, steer_time_constant, steer_dead_band);
   } else {
     throw std::invalid_argument("Invalid vehicle_model_type: " + vehicle_model_type_str);
   }
@@ -342,11 +345,21 @@ void SimplePlanningSimulator::on_timer()
       set_input(current_manual_ackermann_cmd_, acc_by_slope);
     }
 
+    // NOTE: the input delay buffers of the vehicle model are sized for the sub-step time
     if (simulate_motion_) {
-      vehicle_model_ptr_->update(dt);
+      const double substep_dt = dt / simulation_substep_num_;
+      for (int i = 0; i < simulation_substep_num_; ++i) {
+        vehicle_model_ptr_->update(substep_dt);
+      }
     }
   }
 
+  // skip the outputs of the ticks between the published ones
+  publish_count_ = (publish_count_ + 1) % publish_decimation_;
+  if (publish_count_ != 0) {
+    return;
+  }
+
   // set current state
   current_odometry_ = to_odometry(vehicle_model_ptr_, ego_pitch_angle);
   current_odometry_.pose.pose.position.z = get_z_pose_from_trajectory(
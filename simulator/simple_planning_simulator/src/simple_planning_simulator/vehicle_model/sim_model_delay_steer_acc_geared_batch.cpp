@@ -0,0 +1,218 @@
+// Copyright 2023 The Autoware Foundation.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "simple_planning_simulator/vehicle_model/sim_model_delay_steer_acc_geared_batch.hpp"
+
+#include "autoware_auto_vehicle_msgs/msg/gear_command.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+namespace
+{
+bool isDriveGear(const uint8_t gear)
+{
+  using autoware_auto_vehicle_msgs::msg::GearCommand;
+  return gear == GearCommand::DRIVE || gear == GearCommand::DRIVE_2 ||
+         gear == GearCommand::DRIVE_3 || gear == GearCommand::DRIVE_4 ||
+         gear == GearCommand::DRIVE_5 || gear == GearCommand::DRIVE_6 ||
+         gear == GearCommand::DRIVE_7 || gear == GearCommand::DRIVE_8 ||
+         gear == GearCommand::DRIVE_9 || gear == GearCommand::DRIVE_10 ||
+         gear == GearCommand::DRIVE_11 || gear == GearCommand::DRIVE_12 ||
+         gear == GearCommand::DRIVE_13 || gear == GearCommand::DRIVE_14 ||
+         gear == GearCommand::DRIVE_15 || gear == GearCommand::DRIVE_16 ||
+         gear == GearCommand::DRIVE_17 || gear == GearCommand::DRIVE_18 ||
+         gear == GearCommand::LOW || gear == GearCommand::LOW_2;
+}
+
+bool isReverseGear(const uint8_t gear)
+{
+  using autoware_auto_vehicle_msgs::msg::GearCommand;
+  return gear == GearCommand::REVERSE || gear == GearCommand::REVERSE_2;
+}
+}  // namespace
+
+void SimModelDelaySteerAccGearedBatch::States::resize(const size_t size)
+{
+  x.resize(size, 0.0);
+  y.resize(size, 0.0);
+  yaw.resize(size, 0.0);
+  vx.resize(size, 0.0);
+  steer.resize(size, 0.0);
+  accx.resize(size, 0.0);
+}
+
+SimModelDelaySteerAccGearedBatch::SimModelDelaySteerAccGearedBatch(
+  size_t vehicle_num, double vx_lim, double steer_lim, double vx_rate_lim, double steer_rate_lim,
+  double wheelbase, double dt, double acc_delay, double acc_time_constant, double steer_delay,
+  double steer_time_constant, double steer_dead_band)
+: MIN_TIME_CONSTANT(0.03),
+  vehicle_num_(vehicle_num),
+  vx_lim_(vx_lim),
+  vx_rate_lim_(vx_rate_lim),
+  steer_lim_(steer_lim),
+  steer_rate_lim_(steer_rate_lim),
+  wheelbase_(wheelbase),
+  acc_time_constant_(std::max(acc_time_constant, MIN_TIME_CONSTANT)),
+  steer_time_constant_(std::max(steer_time_constant, MIN_TIME_CONSTANT)),
+  steer_dead_band_(steer_dead_band)
+{
+  state_.resize(vehicle_num_);
+  prev_state_.resize(vehicle_num_);
+  tmp_state_.resize(vehicle_num_);
+  for (auto & k : k_) {
+    k.resize(vehicle_num_);
+  }
+
+  using autoware_auto_vehicle_msgs::msg::GearCommand;
+  acc_des_.resize(vehicle_num_, 0.0);
+  steer_des_.resize(vehicle_num_, 0.0);
+  gear_.resize(vehicle_num_, GearCommand::DRIVE);
+
+  acc_input_queue_.resize(static_cast<size_t>(std::round(acc_delay / dt)) * vehicle_num_, 0.0);
+  steer_input_queue_.resize(static_cast<size_t>(std::round(steer_delay / dt)) * vehicle_num_, 0.0);
+  delayed_acc_des_.resize(vehicle_num_, 0.0);
+  delayed_steer_des_.resize(vehicle_num_, 0.0);
+}
+
+void SimModelDelaySteerAccGearedBatch::setInput(
+  const size_t index, const double acc_des, const double steer_des, const uint8_t gear)
+{
+  acc_des_.at(index) = acc_des;
+  steer_des_.at(index) = steer_des;
+  gear_.at(index) = gear;
+}
+
+void SimModelDelaySteerAccGearedBatch::update(const double dt)
+{
+  pushAndGetDelayed(acc_des_, acc_input_queue_, acc_input_queue_index_, delayed_acc_des_);
+  pushAndGetDelayed(steer_des_, steer_input_queue_, steer_input_queue_index_, delayed_steer_des_);
+
+  prev_state_ = state_;
+
+  // Runge-Kutta method
+  calcModel(state_, k_[0]);
+  advance(state_, k_[0], 0.5 * dt, tmp_state_);
+  calcModel(tmp_state_, k_[1]);
+  advance(state_, k_[1], 0.5 * dt, tmp_state_);
+  calcModel(tmp_state_, k_[2]);
+  advance(state_, k_[2], dt, tmp_state_);
+  calcModel(tmp_state_, k_[3]);
+
+  const auto integrate = [&](std::vector<double> & s, std::vector<double> States::*member) {
+    const auto & k1 = k_[0].*member;
+    const auto & k2 = k_[1].*member;
+    const auto & k3 = k_[2].*member;
+    const auto & k4 = k_[3].*member;
+    for (size_t i = 0; i < vehicle_num_; ++i) {
+      s[i] += 1.0 / 6.0 * (k1[i] + 2.0 * k2[i] + 2.0 * k3[i] + k4[i]) * dt;
+    }
+  };
+  integrate(state_.x, &States::x);
+  integrate(state_.y, &States::y);
+  integrate(state_.yaw, &States::yaw);
+  integrate(state_.vx, &States::vx);
+  integrate(state_.steer, &States::steer);
+  integrate(state_.accx, &States::accx);
+
+  // take velocity limit explicitly
+  for (size_t i = 0; i < vehicle_num_; ++i) {
+    state_.vx[i] = std::max(-vx_lim_, std::min(state_.vx[i], vx_lim_));
+  }
+
+  // consider gear
+  // update position and velocity first, and then acceleration is calculated naturally
+  updateStateWithGear(dt);
+}
+
+void SimModelDelaySteerAccGearedBatch::pushAndGetDelayed(
+  const std::vector<double> & input, std::vector<double> & queue, size_t & queue_index,
+  std::vector<double> & delayed_input) const
+{
+  if (queue.empty()) {
+    delayed_input = input;
+    return;
+  }
+  const auto row = queue.begin() + static_cast<std::ptrdiff_t>(queue_index * vehicle_num_);
+  std::copy(row, row + static_cast<std::ptrdiff_t>(vehicle_num_), delayed_input.begin());
+  std::copy(input.begin(), input.end(), row);
+  queue_index = (queue_index + 1) % (queue.size() / vehicle_num_);
+}
+
+void SimModelDelaySteerAccGearedBatch::calcModel(const States & state, States & d_state) const
+{
+  auto sat = [](double val, double u, double l) { return std::max(std::min(val, u), l); };
+
+  for (size_t i = 0; i < vehicle_num_; ++i) {
+    const double vel = sat(state.vx[i], vx_lim_, -vx_lim_);
+    const double yaw = state.yaw[i];
+    d_state.x[i] = vel * std::cos(yaw);
+    d_state.y[i] = vel * std::sin(yaw);
+    d_state.yaw[i] = vel * std::tan(state.steer[i]) / wheelbase_;
+  }
+
+  for (size_t i = 0; i < vehicle_num_; ++i) {
+    const double acc = sat(state.accx[i], vx_rate_lim_, -vx_rate_lim_);
+    const double acc_des = sat(delayed_acc_des_[i], vx_rate_lim_, -vx_rate_lim_);
+    d_state.vx[i] = acc;
+    d_state.accx[i] = -(acc - acc_des) / acc_time_constant_;
+  }
+
+  for (size_t i = 0; i < vehicle_num_; ++i) {
+    const double steer_des = sat(delayed_steer_des_[i], steer_lim_, -steer_lim_);
+    const double steer_diff = state.steer[i] - steer_des;
+    const double steer_diff_with_dead_band =
+      steer_diff > steer_dead_band_    ? steer_diff - steer_dead_band_
+      : steer_diff < -steer_dead_band_ ? steer_diff + steer_dead_band_
+                                       : 0.0;
+    d_state.steer[i] =
+      sat(-steer_diff_with_dead_band / steer_time_constant_, steer_rate_lim_, -steer_rate_lim_);
+  }
+}
+
+void SimModelDelaySteerAccGearedBatch::advance(
+  const States & state, const States & d_state, const double dt, States & next_state) const
+{
+  const auto advance_member = [&](std::vector<double> States::*member) {
+    const auto & s = state.*member;
+    const auto & d = d_state.*member;
+    auto & next = next_state.*member;
+    for (size_t i = 0; i < vehicle_num_; ++i) {
+      next[i] = s[i] + d[i] * dt;
+    }
+  };
+  advance_member(&States::x);
+  advance_member(&States::y);
+  advance_member(&States::yaw);
+  advance_member(&States::vx);
+  advance_member(&States::steer);
+  advance_member(&States::accx);
+}
+
+void SimModelDelaySteerAccGearedBatch::updateStateWithGear(const double dt)
+{
+  for (size_t i = 0; i < vehicle_num_; ++i) {
+    const uint8_t gear = gear_[i];
+    const bool is_stopped = isDriveGear(gear)     ? state_.vx[i] < 0.0
+                            : isReverseGear(gear) ? state_.vx[i] > 0.0
+                                                  : true;
+    if (is_stopped) {
+      state_.vx[i] = 0.0;
+      state_.x[i] = prev_state_.x[i];
+      state_.y[i] = prev_state_.y[i];
+      state_.yaw[i] = prev_state_.yaw[i];
+      state_.accx[i] = (state_.vx[i] - prev_state_.vx[i]) / std::max(dt, 1.0e-5);
+    }
+  }
+}
@@ -72,12 +72,8 @@ void SimModelDelaySteerVel::update(const double & dt)
 {
   Eigen::VectorXd delayed_input = Eigen::VectorXd::Zero(dim_u_);
 
-  vx_input_queue_.push_back(input_(IDX_U::VX_DES));
-  delayed_input(IDX_U::VX_DES) = vx_input_queue_.front();
-  vx_input_queue_.pop_front();
-  steer_input_queue_.push_back(input_(IDX_U::STEER_DES));
-  delayed_input(IDX_U::STEER_DES) = steer_input_queue_.front();
-  steer_input_queue_.pop_front();
+  delayed_input(IDX_U::VX_DES) = vx_input_queue_.pushAndGetDelayed(input_(IDX_U::VX_DES));
+  delayed_input(IDX_U::STEER_DES) = steer_input_queue_.pushAndGetDelayed(input_(IDX_U::STEER_DES));
   // do not use deadzone_delta_steer (Steer IF does not exist in this model)
   updateRungeKutta(dt, delayed_input);
   current_ax_ = (input_(IDX_U::VX_DES) - prev_vx_) / dt;
@@ -86,14 +82,8 @@ void SimModelDelaySteerVel::update(const double & dt)
 
 void SimModelDelaySteerVel::initializeInputQueue(const double & dt)
 {
-  size_t vx_input_queue_size = static_cast<size_t>(round(vx_delay_ / dt));
-  for (size_t i = 0; i < vx_input_queue_size; i++) {
-    vx_input_queue_.push_back(0.0);
-  }
-  size_t steer_input_queue_size = static_cast<size_t>(round(steer_delay_ / dt));
-  for (size_t i = 0; i < steer_input_queue_size; i++) {
-    steer_input_queue_.push_back(0.0);
-  }
+  vx_input_queue_.initialize(static_cast<size_t>(round(vx_delay_ / dt)));
+  steer_input_queue_.initialize(static_cast<size_t>(round(steer_delay_ / dt)));
 }
 
 Eigen::VectorXd SimModelDelaySteerVel::calcModel(
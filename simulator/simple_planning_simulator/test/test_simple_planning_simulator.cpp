@@ -14,6 +14,8 @@
 
 #include "gtest/gtest.h"
 #include "simple_planning_simulator/simple_planning_simulator_core.hpp"
+#include "simple_planning_simulator/vehicle_model/sim_model_delay_steer_acc_geared.hpp"
+#include "simple_planning_simulator/vehicle_model/sim_model_delay_steer_acc_geared_batch.hpp"
 #include "tf2/utils.h"
 
 #ifdef ROS_DISTRO_GALACTIC
@@ -277,3 +279,44 @@ const std::string VEHICLE_MODEL_LIST[] = {   // NOLINT
 
 INSTANTIATE_TEST_SUITE_P(
   TestForEachVehicleModel, TestSimplePlanningSimulator, ::testing::ValuesIn(VEHICLE_MODEL_LIST));
+
+// The batch model should give the same states as the model of each vehicle.
+TEST(TestSimModelDelaySteerAccGearedBatch, SameAsSingleVehicleModel)
+{
+  constexpr size_t vehicle_num = 4;
+  constexpr double dt = 0.025;
+  const uint8_t gears[vehicle_num] = {
+    GearCommand::DRIVE, GearCommand::REVERSE, GearCommand::DRIVE, GearCommand::PARK};
+  const double acc_des[vehicle_num] = {1.0, 1.0, -2.0, 1.0};
+  const double steer_des[vehicle_num] = {0.2, -0.2, 0.5, 0.0};
+
+  SimModelDelaySteerAccGearedBatch batch_model(
+    vehicle_num, 30.0, 0.6, 30.0, 6.28, 2.79, dt, 0.1, 0.1, 0.1, 0.1, 0.01);
+  std::vector<std::shared_ptr<SimModelInterface>> models;
+  for (size_t i = 0; i < vehicle_num; ++i) {
+    models.push_back(std::make_shared<SimModelDelaySteerAccGeared>(
+      30.0, 0.6, 30.0, 6.28, 2.79, dt, 0.1, 0.1, 0.1, 0.1, 0.01));
+    Eigen::VectorXd input(2);
+    input << acc_des[i], steer_des[i];
+    models.at(i)->setInput(input);
+    models.at(i)->setGear(gears[i]);
+    batch_model.setInput(i, acc_des[i], steer_des[i], gears[i]);
+  }
+
+  for (int step = 0; step < 100; ++step) {
+    batch_model.update(dt);
+    for (const auto & model : models) {
+      model->update(dt);
+    }
+  }
+
+  const auto & states = batch_model.getStates();
+  for (size_t i = 0; i < vehicle_num; ++i) {
+    EXPECT_DOUBLE_EQ(states.x.at(i), models.at(i)->getX());
+    EXPECT_DOUBLE_EQ(states.y.at(i), models.at(i)->getY());
+    EXPECT_DOUBLE_EQ(states.yaw.at(i), models.at(i)->getYaw());
+    EXPECT_DOUBLE_EQ(states.vx.at(i), models.at(i)->getVx());
+    EXPECT_DOUBLE_EQ(states.steer.at(i), models.at(i)->getSteer());
+    EXPECT_DOUBLE_EQ(states.accx.at(i), models.at(i)->getAx());
+  }
+}
@@ -14,6 +14,7 @@
 
 #include "perception.hpp"
 
+#include <utility>
 #include <vector>
 
 namespace default_ad_api
@@ -37,54 +38,76 @@ PerceptionNode::PerceptionNode(const rclcpp::NodeOptions & options) : Node("perc
   const auto adaptor = component_interface_utils::NodeAdaptor(this);
   adaptor.init_pub(pub_object_recognized_);
   adaptor.init_sub(sub_object_recognized_, this, &PerceptionNode::object_recognize);
+
+  // Only the latest objects are converted at the rate of the API, not for every input message.
+  const auto rate = rclcpp::Rate(declare_parameter<double>("update_rate"));
+  timer_ = rclcpp::create_timer(this, get_clock(), rate.period(), [this]() { on_timer(); });
 }
 
 uint8_t PerceptionNode::mapping(
-  std::unordered_map<uint8_t, uint8_t> hash_map, uint8_t input, uint8_t default_value)
+  const std::unordered_map<uint8_t, uint8_t> & hash_map, uint8_t input, uint8_t default_value)
 {
-  if (hash_map.find(input) == hash_map.end()) {
-    return default_value;
-  } else {
-    return hash_map[input];
-  }
+  const auto itr = hash_map.find(input);
+  return itr == hash_map.end() ? default_value : itr->second;
 }
 
 void PerceptionNode::object_recognize(
   const perception_interface::ObjectRecognition::Message::ConstSharedPtr msg)
 {
-  DynamicObjectArray::Message objects;
-  objects.header = msg->header;
-  for (const auto & msg_object : msg->objects) {
+  objects_ = msg;
+}
+
+void PerceptionNode::on_timer()
+{
+  if (!objects_) {
+    return;
+  }
+  const auto msg = std::move(objects_);
+  pub_object_recognized_->publish_with(
+    [&](DynamicObjectArray::Message & objects) { convert_objects(*msg, objects); });
+}
+
+void PerceptionNode::convert_objects(
+  const perception_interface::ObjectRecognition::Message & msg,
+  DynamicObjectArray::Message & objects)
+{
+  // The API lists the objects, the classifications, the paths and their points in the reverse
+  // order of the input.
+  objects.header = msg.header;
+  objects.objects.clear();
+  objects.objects.reserve(msg.objects.size());
+  for (auto msg_object = msg.objects.rbegin(); msg_object != msg.objects.rend(); ++msg_object) {
     DynamicObject object;
-    object.id = msg_object.object_id;
-    object.existence_probability = msg_object.existence_probability;
-    for (const auto & msg_classification : msg_object.classification) {
+    object.id = msg_object->object_id;
+    object.existence_probability = msg_object->existence_probability;
+    const auto & msg_classifications = msg_object->classification;
+    object.classification.reserve(msg_classifications.size());
+    for (auto itr = msg_classifications.rbegin(); itr != msg_classifications.rend(); ++itr) {
       ObjectClassification classification;
-      classification.label = msg_classification.label;
-      classification.probability = msg_classification.probability;
-      object.classification.insert(object.classification.begin(), classification);
+      classification.label = itr->label;
+      classification.probability = itr->probability;
+      object.classification.push_back(classification);
     }
-    object.kinematics.pose = msg_object.kinematics.initial_pose_with_covariance.pose;
-    object.kinematics.twist = msg_object.kinematics.initial_twist_with_covariance.twist;
-    object.kinematics.accel = msg_object.kinematics.initial_acceleration_with_covariance.accel;
-    for (const auto & msg_predicted_path : msg_object.kinematics.predicted_paths) {
+    const auto & msg_kinematics = msg_object->kinematics;
+    object.kinematics.pose = msg_kinematics.initial_pose_with_covariance.pose;
+    object.kinematics.twist = msg_kinematics.initial_twist_with_covariance.twist;
+    object.kinematics.accel = msg_kinematics.initial_acceleration_with_covariance.accel;
+    const auto & msg_predicted_paths = msg_kinematics.predicted_paths;
+    object.kinematics.predicted_paths.reserve(msg_predicted_paths.size());
+    for (auto itr = msg_predicted_paths.rbegin(); itr != msg_predicted_paths.rend(); ++itr) {
       DynamicObjectPath predicted_path;
-      for (const auto & msg_path : msg_predicted_path.path) {
-        predicted_path.path.insert(predicted_path.path.begin(), msg_path);
-      }
-      predicted_path.time_step = msg_predicted_path.time_step;
-      predicted_path.confidence = msg_predicted_path.confidence;
-      object.kinematics.predicted_paths.insert(
-        object.kinematics.predicted_paths.begin(), predicted_path);
+      predicted_path.path.assign(itr->path.rbegin(), itr->path.rend());
+      predicted_path.time_step = itr->time_step;
+      predicted_path.confidence = itr->confidence;
+      object.kinematics.predicted_paths.push_back(std::move(predicted_path));
     }
-    object.shape.type = mapping(shape_type_, msg_object.shape.type, API_Shape::PRISM);
+    object.shape.type = mapping(shape_type_, msg_object->shape.type, API_Shape::PRISM);
     object.shape.dimensions = {
-      msg_object.shape.dimensions.x, msg_object.shape.dimensions.y, msg_object.shape.dimensions.z};
-    object.shape.polygon = msg_object.shape.footprint;
-    objects.objects.insert(objects.objects.begin(), object);
+      msg_object->shape.dimensions.x, msg_object->shape.dimensions.y,
+      msg_object->shape.dimensions.z};
+    object.shape.polygon = msg_object->shape.footprint;
+    objects.objects.push_back(std::move(object));
   }
-
-  pub_object_recognized_->publish(objects);
 }
 
 }  // namespace default_ad_api
@@ -42,9 +42,15 @@ public:
 private:
   Pub<autoware_ad_api::perception::DynamicObjectArray> pub_object_recognized_;
   Sub<perception_interface::ObjectRecognition> sub_object_recognized_;
+  rclcpp::TimerBase::SharedPtr timer_;
+  perception_interface::ObjectRecognition::Message::ConstSharedPtr objects_;
   void object_recognize(const perception_interface::ObjectRecognition::Message::ConstSharedPtr msg);
+  void on_timer();
+  void convert_objects(
+    const perception_interface::ObjectRecognition::Message & msg,
+    autoware_ad_api::perception::DynamicObjectArray::Message & objects);
   uint8_t mapping(
-    std::unordered_map<uint8_t, uint8_t> hash_map, uint8_t input, uint8_t default_value);
+    const std::unordered_map<uint8_t, uint8_t> & hash_map, uint8_t input, uint8_t default_value);
 };
 
 }  // namespace default_ad_api
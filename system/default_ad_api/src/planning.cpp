@@ -18,6 +18,7 @@
 
 #include <memory>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace default_ad_api
@@ -53,6 +54,11 @@ T merge_factors(const rclcpp::Time stamp, const std::vector<typename T::ConstSha
   message.header.stamp = stamp;
   message.header.frame_id = "map";
 
+  size_t size = 0;
+  for (const auto & factor : factors) {
+    size += factor ? factor->factors.size() : 0;
+  }
+  message.factors.reserve(size);
   for (const auto & factor : factors) {
     if (factor) {
       concat(message.factors, factor->factors);
@@ -100,7 +106,7 @@ PlanningNode::PlanningNode(const rclcpp::NodeOptions & options) : Node("planning
   adaptor.init_sub(sub_kinematic_state_, this, &PlanningNode::on_kinematic_state);
   adaptor.init_sub(sub_trajectory_, this, &PlanningNode::on_trajectory);
 
-  const auto rate = rclcpp::Rate(5);
+  const auto rate = rclcpp::Rate(declare_parameter<double>("update_rate"));
   timer_ = rclcpp::create_timer(this, get_clock(), rate.period(), [this]() { on_timer(); });
 }
 
@@ -122,8 +128,9 @@ void PlanningNode::on_kinematic_state(const KinematicState::ConstSharedPtr msg)
 void PlanningNode::on_timer()
 {
   using autoware_adapi_v1_msgs::msg::VelocityFactor;
-  auto velocity = merge_factors<VelocityFactorArray>(now(), velocity_factors_);
-  auto steering = merge_factors<SteeringFactorArray>(now(), steering_factors_);
+  const auto stamp = now();
+  auto velocity = merge_factors<VelocityFactorArray>(stamp, velocity_factors_);
+  auto steering = merge_factors<SteeringFactorArray>(stamp, steering_factors_);
 
   // Set the distance if it is nan.
   if (trajectory_ && kinematic_state_) {
@@ -146,8 +153,8 @@ void PlanningNode::on_timer()
     }
   }
 
-  pub_velocity_factors_->publish(velocity);
-  pub_steering_factors_->publish(steering);
+  pub_velocity_factors_->publish(std::make_unique<VelocityFactorArray>(std::move(velocity)));
+  pub_steering_factors_->publish(std::make_unique<SteeringFactorArray>(std::move(steering)));
 }
 
 }  // namespace default_ad_api
@@ -72,7 +72,7 @@ void RoutingNode::on_state(const State::Message::ConstSharedPtr msg)
 
 void RoutingNode::on_route(const Route::Message::ConstSharedPtr msg)
 {
-  pub_route_->publish(conversion::convert_route(*msg));
+  pub_route_->publish_with([&](auto & route) { route = conversion::convert_route(*msg); });
 }
 
 void RoutingNode::on_clear_route(
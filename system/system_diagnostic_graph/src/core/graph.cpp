@@ -153,6 +153,23 @@ void Graph::init(const std::string & file, const std::string & mode)
     nodes[index]->set_index(index);
   }
 
+  // Create parent indices to propagate status changes, and update all units at the first report.
+  parents_ = std::vector<std::vector<size_t>>(nodes.size());
+  for (const auto & node : nodes) {
+    for (const auto & child : node->children()) {
+      parents_[child->index()].push_back(node->index());
+    }
+  }
+  dirty_ = std::vector<bool>(nodes.size(), true);
+
+  // Create the message with the initial status, which is rewritten for the changed units.
+  message_ = DiagnosticGraph();
+  message_.nodes.resize(nodes.size());
+  for (const auto & node : nodes) {
+    message_.nodes[node->index()].status.name = node->path();
+    message_.nodes[node->index()].status.level = node->level();
+  }
+
   for (const auto & node : nodes) {
     const auto diag = dynamic_cast<DiagUnit *>(node.get());
     if (diag) {
@@ -176,29 +193,42 @@ void Graph::callback(const rclcpp::Time & stamp, const DiagnosticArray & array)
   }
 }
 
-DiagnosticGraph Graph::report(const rclcpp::Time & stamp)
+const DiagnosticGraph & Graph::report(const rclcpp::Time & stamp)
 {
-  for (const auto & node : nodes_) {
-    node->update(stamp);
+  // The diag units are always updated since they depend on the time for the timeout.
+  for (const auto & [name, diag] : diags_) {
+    dirty_[diag->index()] = true;
   }
 
-  DiagnosticGraph message;
-  message.stamp = stamp;
-  message.nodes.reserve(nodes_.size());
+  // Update only the units whose children have changed. Because the units are sorted in
+  // topological order, the parents of a unit are processed after the unit.
   for (const auto & node : nodes_) {
+    const auto index = node->index();
+    if (!dirty_[index]) {
+      continue;
+    }
+    dirty_[index] = false;
+    if (!node->update(stamp)) {
+      continue;
+    }
+    for (const auto & parent : parents_[index]) {
+      dirty_[parent] = true;
+    }
+
     const auto report = node->report();
-    DiagnosticNode temp;
-    temp.status.name = node->path();
+    DiagnosticNode & temp = message_.nodes[index];
     temp.status.level = report.level;
+    temp.links.clear();
     for (const auto & [ref, used] : report.links) {
       DiagnosticLink link;
       link.index = ref->index();
       link.used = used;
       temp.links.push_back(link);
     }
-    message.nodes.push_back(temp);
   }
-  return message;
+
+  message_.stamp = stamp;
+  return message_;
 }
 
 std::vector<BaseUnit *> Graph::nodes() const
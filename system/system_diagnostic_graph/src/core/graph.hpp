@@ -36,7 +36,7 @@ public:
 
   void init(const std::string & file, const std::string & mode = "");
   void callback(const rclcpp::Time & stamp, const DiagnosticArray & array);
-  DiagnosticGraph report(const rclcpp::Time & stamp);
+  const DiagnosticGraph & report(const rclcpp::Time & stamp);
   std::vector<BaseUnit *> nodes() const;
 
   void debug();
@@ -44,6 +44,9 @@ public:
 private:
   std::vector<std::unique_ptr<BaseUnit>> nodes_;
   std::unordered_map<std::string, DiagUnit *> diags_;
+  std::vector<std::vector<size_t>> parents_;
+  std::vector<bool> dirty_;
+  DiagnosticGraph message_;
 };
 
 }  // namespace system_diagnostic_graph
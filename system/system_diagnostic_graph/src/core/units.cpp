@@ -67,14 +67,26 @@ BaseUnit::NodeData BaseUnit::report() const
   return {level_, links_};
 }
 
+bool BaseUnit::set_status(DiagnosticLevel level, LinkList && links)
+{
+  if (level == level_ && links == links_) {
+    return false;
+  }
+  level_ = level;
+  links_ = std::move(links);
+  return true;
+}
+
 void DiagUnit::init(const UnitConfig::SharedPtr & config, const NodeDict &)
 {
   timeout_ = 3.0;  // TODO(Takagi, Isamu): parameterize
   name_ = config->data.take_text("diag");
 }
 
-void DiagUnit::update(const rclcpp::Time & stamp)
+bool DiagUnit::update(const rclcpp::Time & stamp)
 {
+  const auto level = level_;
+
   if (diagnostics_) {
     const auto updated = diagnostics_.value().first;
     const auto elapsed = (stamp - updated).seconds();
@@ -88,6 +100,7 @@ void DiagUnit::update(const rclcpp::Time & stamp)
   } else {
     level_ = DiagnosticStatus::STALE;
   }
+  return level_ != level;
 }
 
 void DiagUnit::callback(const rclcpp::Time & stamp, const DiagnosticStatus & status)
@@ -105,25 +118,26 @@ void AndUnit::init(const UnitConfig::SharedPtr & config, const NodeDict & dict)
   children_ = resolve(dict, config->children);
 }
 
-void AndUnit::update(const rclcpp::Time &)
+bool AndUnit::update(const rclcpp::Time &)
 {
   if (children_.empty()) {
-    return;
+    return false;
   }
 
   bool uses = true;
-  level_ = DiagnosticStatus::OK;
-  links_ = LinkList();
+  DiagnosticLevel level = DiagnosticStatus::OK;
+  LinkList links;
 
   for (const auto & child : children_) {
     const auto status = child->status();
-    level_ = std::max(level_, status.level);
-    merge(links_, status.links, uses);
-    if (short_circuit_ && level_ != DiagnosticStatus::OK) {
+    level = std::max(level, status.level);
+    merge(links, status.links, uses);
+    if (short_circuit_ && level != DiagnosticStatus::OK) {
       uses = false;
     }
   }
-  level_ = std::min(level_, DiagnosticStatus::ERROR);
+  level = std::min(level, DiagnosticStatus::ERROR);
+  return set_status(level, std::move(links));
 }
 
 void OrUnit::init(const UnitConfig::SharedPtr & config, const NodeDict & dict)
@@ -131,21 +145,22 @@ void OrUnit::init(const UnitConfig::SharedPtr & config, const NodeDict & dict)
   children_ = resolve(dict, config->children);
 }
 
-void OrUnit::update(const rclcpp::Time &)
+bool OrUnit::update(const rclcpp::Time &)
 {
   if (children_.empty()) {
-    return;
+    return false;
   }
 
-  level_ = DiagnosticStatus::ERROR;
-  links_ = LinkList();
+  DiagnosticLevel level = DiagnosticStatus::ERROR;
+  LinkList links;
 
   for (const auto & child : children_) {
     const auto status = child->status();
-    level_ = std::min(level_, status.level);
-    merge(links_, status.links, true);
+    level = std::min(level, status.level);
+    merge(links, status.links, true);
   }
-  level_ = std::min(level_, DiagnosticStatus::ERROR);
+  level = std::min(level, DiagnosticStatus::ERROR);
+  return set_status(level, std::move(links));
 }
 
 DebugUnit::DebugUnit(const std::string & path, DiagnosticLevel level) : BaseUnit(path)
@@ -157,8 +172,9 @@ void DebugUnit::init(const UnitConfig::SharedPtr &, const NodeDict &)
 {
 }
 
-void DebugUnit::update(const rclcpp::Time &)
+bool DebugUnit::update(const rclcpp::Time &)
 {
+  return false;
 }
 
 }  // namespace system_diagnostic_graph
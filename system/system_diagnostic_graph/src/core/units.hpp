@@ -49,7 +49,7 @@ public:
   explicit BaseUnit(const std::string & path);
   virtual ~BaseUnit() = default;
   virtual void init(const UnitConfig::SharedPtr & config, const NodeDict & dict) = 0;
-  virtual void update(const rclcpp::Time & stamp) = 0;
+  virtual bool update(const rclcpp::Time & stamp) = 0;  // Returns true if the status changes.
 
   NodeData status() const;
   NodeData report() const;
@@ -62,6 +62,7 @@ public:
   void set_index(const size_t index) { index_ = index; }
 
 protected:
+  bool set_status(DiagnosticLevel level, std::vector<std::pair<const BaseUnit *, bool>> && links);
   DiagnosticLevel level_;
   std::string path_;
   std::vector<BaseUnit *> children_;
@@ -76,7 +77,7 @@ class DiagUnit : public BaseUnit
 public:
   using BaseUnit::BaseUnit;
   void init(const UnitConfig::SharedPtr & config, const NodeDict & dict) override;
-  void update(const rclcpp::Time & stamp) override;
+  bool update(const rclcpp::Time & stamp) override;
 
   std::string name() const { return name_; }
   void callback(const rclcpp::Time & stamp, const DiagnosticStatus & status);
@@ -92,7 +93,7 @@ class AndUnit : public BaseUnit
 public:
   AndUnit(const std::string & path, bool short_circuit);
   void init(const UnitConfig::SharedPtr & config, const NodeDict & dict) override;
-  void update(const rclcpp::Time & stamp) override;
+  bool update(const rclcpp::Time & stamp) override;
 
 private:
   bool short_circuit_;
@@ -103,7 +104,7 @@ class OrUnit : public BaseUnit
 public:
   using BaseUnit::BaseUnit;
   void init(const UnitConfig::SharedPtr & config, const NodeDict & dict) override;
-  void update(const rclcpp::Time & stamp) override;
+  bool update(const rclcpp::Time & stamp) override;
 };
 
 class DebugUnit : public BaseUnit
@@ -111,7 +112,7 @@ class DebugUnit : public BaseUnit
 public:
   DebugUnit(const std::string & path, DiagnosticLevel level);
   void init(const UnitConfig::SharedPtr & config, const NodeDict & dict) override;
-  void update(const rclcpp::Time & stamp) override;
+  bool update(const rclcpp::Time & stamp) override;
 };
 
 }  // namespace system_diagnostic_graph
@@ -19,6 +19,10 @@
 
 #include <filesystem>
 #include <iostream>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
 
 using namespace system_diagnostic_graph;  // NOLINT(build/namespaces)
 
@@ -86,3 +90,73 @@ TEST(ConfigFile, GraphCirculation)
   Graph graph;
   EXPECT_THROW(graph.init(resource("graph-circulation.yaml")), GraphStructure);
 }
+
+DiagnosticArray create_array(const std::vector<std::pair<std::string, DiagnosticLevel>> & diags)
+{
+  DiagnosticArray array;
+  for (const auto & [name, level] : diags) {
+    DiagnosticStatus status;
+    status.name = name;
+    status.level = level;
+    array.status.push_back(status);
+  }
+  return array;
+}
+
+void expect_same_graph(const DiagnosticGraph & graph1, const DiagnosticGraph & graph2)
+{
+  ASSERT_EQ(graph1.nodes.size(), graph2.nodes.size());
+  for (size_t i = 0; i < graph1.nodes.size(); ++i) {
+    EXPECT_EQ(graph1.nodes[i].status.name, graph2.nodes[i].status.name);
+    EXPECT_EQ(graph1.nodes[i].status.level, graph2.nodes[i].status.level);
+    ASSERT_EQ(graph1.nodes[i].links.size(), graph2.nodes[i].links.size());
+    for (size_t j = 0; j < graph1.nodes[i].links.size(); ++j) {
+      EXPECT_EQ(graph1.nodes[i].links[j].index, graph2.nodes[i].links[j].index);
+      EXPECT_EQ(graph1.nodes[i].links[j].used, graph2.nodes[i].links[j].used);
+    }
+  }
+}
+
+DiagnosticLevel find_level(const DiagnosticGraph & graph, const std::string & path)
+{
+  for (const auto & node : graph.nodes) {
+    if (node.status.name == path) {
+      return node.status.level;
+    }
+  }
+  throw std::runtime_error("path not found: " + path);
+}
+
+TEST(GraphReport, IncrementalUpdate)
+{
+  constexpr auto OK = DiagnosticStatus::OK;
+  constexpr auto ERROR = DiagnosticStatus::ERROR;
+  constexpr auto STALE = DiagnosticStatus::STALE;
+  const auto states = std::vector<std::vector<std::pair<std::string, DiagnosticLevel>>>{
+    {{"foo: diag1", OK}, {"foo: diag2", OK}, {"foo: diag3", OK}},
+    {{"foo: diag1", OK}, {"foo: diag2", ERROR}, {"foo: diag3", OK}},
+    {{"foo: diag1", OK}, {"foo: diag2", ERROR}, {"foo: diag3", ERROR}},
+    {{"foo: diag1", ERROR}, {"foo: diag2", OK}, {"foo: diag3", ERROR}},
+    {{"foo: diag1", OK}, {"foo: diag2", OK}, {"foo: diag3", OK}},
+  };
+
+  // The graph updated incrementally is the same as the graph created from the latest state.
+  Graph graph;
+  graph.init(resource("incremental-report.yaml"));
+  for (size_t i = 0; i < states.size(); ++i) {
+    const auto stamp = rclcpp::Time(static_cast<int64_t>(i) * 1000000000, RCL_ROS_TIME);
+    const auto array = create_array(states[i]);
+    Graph expected;
+    expected.init(resource("incremental-report.yaml"));
+    expected.callback(stamp, array);
+    graph.callback(stamp, array);
+    expect_same_graph(graph.report(stamp), expected.report(stamp));
+  }
+
+  // The diag units time out without any status change.
+  const auto timeout = static_cast<int64_t>(states.size() + 5) * 1000000000;
+  const auto message = graph.report(rclcpp::Time(timeout, RCL_ROS_TIME));
+  EXPECT_EQ(find_level(message, "/foo/diag1"), STALE);
+  EXPECT_EQ(find_level(message, "/foo/and"), ERROR);
+  EXPECT_EQ(find_level(message, "/foo/or"), ERROR);
+}
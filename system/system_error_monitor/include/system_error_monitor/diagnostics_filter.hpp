@@ -38,16 +38,12 @@ inline bool isChild(
   const diagnostic_msgs::msg::DiagnosticStatus & child,
   const diagnostic_msgs::msg::DiagnosticStatus & parent)
 {
-  auto name = splitStringByLastSlash(child.name);
-  while (name != "") {
-    if (name == parent.name) {
-      return true;
-    }
-
-    name = splitStringByLastSlash(name);
-  }
-
-  return false;
+  // The parent name is one of the names made by removing the last "/..." from the child name
+  // repeatedly, i.e. a non-empty prefix of the child name followed by a slash.
+  const auto & name = child.name;
+  const auto & prefix = parent.name;
+  return !prefix.empty() && prefix.size() < name.size() && name[prefix.size()] == '/' &&
+         name.compare(0, prefix.size(), prefix) == 0;
 }
 
 inline bool isLeaf(
@@ -84,6 +80,20 @@ inline std::vector<diagnostic_msgs::msg::DiagnosticStatus> extractLeafDiagnostic
   return leaf_diagnostics;
 }
 
+inline std::vector<diagnostic_msgs::msg::DiagnosticStatus> extractChildrenDiagnostics(
+  const diagnostic_msgs::msg::DiagnosticStatus & parent,
+  const std::vector<diagnostic_msgs::msg::DiagnosticStatus> & diagnostics)
+{
+  std::vector<diagnostic_msgs::msg::DiagnosticStatus> children_diagnostics;
+  for (const auto & diag : diagnostics) {
+    if (isChild(diag, parent)) {
+      children_diagnostics.emplace_back(diag);
+    }
+  }
+
+  return children_diagnostics;
+}
+
 inline std::vector<diagnostic_msgs::msg::DiagnosticStatus> extractLeafChildrenDiagnostics(
   const diagnostic_msgs::msg::DiagnosticStatus & parent,
   const std::vector<diagnostic_msgs::msg::DiagnosticStatus> & diagnostics)
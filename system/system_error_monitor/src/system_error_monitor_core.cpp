@@ -337,11 +337,7 @@ void AutowareErrorMonitor::onDiagArray(
   const auto & header = msg->header;
 
   for (const auto & diag : msg->status) {
-    if (diag_buffer_map_.count(diag.name) == 0) {
-      diag_buffer_map_.insert(std::make_pair(diag.name, DiagBuffer{}));
-    }
-
-    auto & diag_buffer = diag_buffer_map_.at(diag.name);
+    auto & diag_buffer = diag_buffer_map_[diag.name];
     diag_buffer.push_back(DiagStamped{header, diag});
 
     while (diag_buffer.size() > diag_buffer_size_) {
@@ -349,6 +345,11 @@ void AutowareErrorMonitor::onDiagArray(
     }
   }
 
+  // Extract leaf diagnostics once per message instead of once per required module
+  if (params_.add_leaf_diagnostics) {
+    leaf_diagnostics_ = diagnostics_filter::extractLeafDiagnostics(msg->status);
+  }
+
   // for Heartbeat
   diag_array_stamp_ = this->now();
 }
@@ -470,11 +471,12 @@ void AutowareErrorMonitor::onTimer()
 boost::optional<DiagStamped> AutowareErrorMonitor::getLatestDiag(
   const std::string & diag_name) const
 {
-  if (diag_buffer_map_.count(diag_name) == 0) {
+  const auto itr = diag_buffer_map_.find(diag_name);
+  if (itr == diag_buffer_map_.end()) {
     return {};
   }
 
-  const auto & diag_buffer = diag_buffer_map_.at(diag_name);
+  const auto & diag_buffer = itr->second;
 
   if (diag_buffer.empty()) {
     return {};
@@ -512,7 +514,7 @@ void AutowareErrorMonitor::appendHazardDiag(
 
   if (params_.add_leaf_diagnostics) {
     for (const auto & diag :
-         diagnostics_filter::extractLeafChildrenDiagnostics(hazard_diag, diag_array_->status)) {
+         diagnostics_filter::extractChildrenDiagnostics(hazard_diag, leaf_diagnostics_)) {
       target_diagnostics_ref.push_back(diag);
     }
   }
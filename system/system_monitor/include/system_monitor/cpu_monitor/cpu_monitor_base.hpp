@@ -20,12 +20,15 @@
 #ifndef SYSTEM_MONITOR__CPU_MONITOR__CPU_MONITOR_BASE_HPP_
 #define SYSTEM_MONITOR__CPU_MONITOR__CPU_MONITOR_BASE_HPP_
 
+#include "system_monitor/proc_file_reader.hpp"
+
 #include <diagnostic_updater/diagnostic_updater.hpp>
 
 #include <tier4_external_api_msgs/msg/cpu_status.hpp>
 #include <tier4_external_api_msgs/msg/cpu_usage.hpp>
 
 #include <climits>
+#include <cstdint>
 #include <map>
 #include <string>
 #include <vector>
@@ -54,6 +57,39 @@ typedef struct cpu_freq_info
   cpu_freq_info(int index, const std::string & path) : index_(index), path_(path) {}
 } cpu_freq_info;
 
+/**
+ * @brief CPU time statistics in /proc/stat
+ */
+typedef struct cpu_stat_info
+{
+  std::string name_;     //!< @brief cpu name, "all" or cpu index
+  uint64_t user_;        //!< @brief time spent in user mode including guest [clock ticks]
+  uint64_t nice_;        //!< @brief time spent in user mode with low priority including guest
+  uint64_t system_;      //!< @brief time spent in system mode
+  uint64_t idle_;        //!< @brief time spent in the idle task
+  uint64_t iowait_;      //!< @brief time waiting for I/O to complete
+  uint64_t irq_;         //!< @brief time servicing interrupts
+  uint64_t softirq_;     //!< @brief time servicing softirqs
+  uint64_t steal_;       //!< @brief stolen time spent in other operating systems
+  uint64_t guest_;       //!< @brief time spent running a virtual CPU for guest
+  uint64_t guest_nice_;  //!< @brief time spent running a niced guest
+
+  cpu_stat_info()
+  : name_(),
+    user_(0),
+    nice_(0),
+    system_(0),
+    idle_(0),
+    iowait_(0),
+    irq_(0),
+    softirq_(0),
+    steal_(0),
+    guest_(0),
+    guest_nice_(0)
+  {
+  }
+} cpu_stat_info;
+
 class CPUMonitorBase : public rclcpp::Node
 {
 public:
@@ -100,9 +136,16 @@ protected:
   virtual void checkUsage(
     diagnostic_updater::DiagnosticStatusWrapper & stat);  // NOLINT(runtime/references)
 
+  /**
+   * @brief read CPU time statistics of all the CPUs and each CPU from /proc/stat
+   * @param [out] cpu_stats CPU time statistics, "all" comes first
+   * @return true if success to read /proc/stat
+   */
+  bool readCpuStats(std::vector<cpu_stat_info> & cpu_stats);
+
   /**
    * @brief convert Cpu Usage To diagnostic Level
-   * @param [cpu_name] mpstat cpu name
+   * @param [cpu_name] cpu name, "all" or cpu index
    * @param [usage] cpu usage value
    * @return DiagStatus::OK or WARN or ERROR
    */
@@ -141,7 +184,9 @@ protected:
   std::vector<cpu_freq_info> freqs_;        //!< @brief CPU list for frequency
   std::vector<int> usage_warn_check_cnt_;   //!< @brief CPU list for usage over warn check counter
   std::vector<int> usage_error_check_cnt_;  //!< @brief CPU list for usage over error check counter
-  bool mpstat_exists_;                      //!< @brief flag if mpstat exists
+
+  ProcFileReader proc_stat_reader_;            //!< @brief reader of /proc/stat
+  std::vector<cpu_stat_info> prev_cpu_stats_;  //!< @brief CPU time statistics at previous check
 
   float usage_warn_;       //!< @brief CPU usage(%) to generate warning
   float usage_error_;      //!< @brief CPU usage(%) to generate error
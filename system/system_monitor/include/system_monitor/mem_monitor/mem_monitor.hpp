@@ -20,6 +20,8 @@
 #ifndef SYSTEM_MONITOR__MEM_MONITOR__MEM_MONITOR_HPP_
 #define SYSTEM_MONITOR__MEM_MONITOR__MEM_MONITOR_HPP_
 
+#include "system_monitor/proc_file_reader.hpp"
+
 #include <diagnostic_updater/diagnostic_updater.hpp>
 
 #include <climits>
@@ -69,7 +71,8 @@ protected:
 
   char hostname_[HOST_NAME_MAX + 1];  //!< @brief host name
 
-  size_t available_size_;  //!< @brief Memory available size to generate error
+  size_t available_size_;          //!< @brief Memory available size to generate error
+  ProcFileReader meminfo_reader_;  //!< @brief reader of /proc/meminfo
 
   /**
    * @brief Memory usage status messages
@@ -0,0 +1,103 @@
+// Copyright 2023 Autoware Foundation
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/**
+ * @file proc_file_reader.hpp
+ * @brief Reader of a file in procfs or sysfs kept open across reads
+ */
+
+#ifndef SYSTEM_MONITOR__PROC_FILE_READER_HPP_
+#define SYSTEM_MONITOR__PROC_FILE_READER_HPP_
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <string>
+
+/**
+ * @brief Reader of a file in procfs or sysfs
+ * @details The file is opened once and read from the beginning at every read, since the contents
+ * of procfs and sysfs are regenerated at the read from offset zero. It saves opening and closing
+ * the file at every cycle of the monitors.
+ */
+class ProcFileReader
+{
+public:
+  /**
+   * @brief constructor
+   * @param [in] path path to the file
+   */
+  explicit ProcFileReader(const std::string & path)
+  : path_(path), fd_(open(path.c_str(), O_RDONLY | O_CLOEXEC))
+  {
+  }
+
+  ProcFileReader(const ProcFileReader &) = delete;
+  ProcFileReader & operator=(const ProcFileReader &) = delete;
+
+  ~ProcFileReader()
+  {
+    if (fd_ >= 0) {
+      close(fd_);
+    }
+  }
+
+  /**
+   * @brief read the whole contents of the file
+   * @param [out] contents contents of the file
+   * @return true if success to read the file, otherwise errno is set
+   */
+  bool read(std::string & contents)
+  {
+    // try to open the file again if it was not available at the construction
+    if (fd_ < 0) {
+      fd_ = open(path_.c_str(), O_RDONLY | O_CLOEXEC);
+      if (fd_ < 0) {
+        return false;
+      }
+    }
+
+    contents.clear();
+    char buffer[4096];
+    off_t offset = 0;
+    while (true) {
+      const ssize_t size = pread(fd_, buffer, sizeof(buffer), offset);
+      if (size < 0) {
+        if (errno == EINTR) {
+          continue;
+        }
+        return false;
+      }
+      if (size == 0) {
+        break;
+      }
+      contents.append(buffer, static_cast<size_t>(size));
+      offset += size;
+    }
+    return true;
+  }
+
+  /**
+   * @brief get path to the file
+   * @return path to the file
+   */
+  const std::string & getPath() const { return path_; }
+
+private:
+  std::string path_;  //!< @brief path to the file
+  int fd_;            //!< @brief file descriptor kept open
+};
+
+#endif  // SYSTEM_MONITOR__PROC_FILE_READER_HPP_
@@ -24,15 +24,17 @@
 
 #include <diagnostic_updater/diagnostic_updater.hpp>
 
-#include <boost/process.hpp>
+#include <sys/types.h>
 
+#include <chrono>
+#include <cstdint>
+#include <map>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <unordered_map>
 #include <vector>
 
-namespace bp = boost::process;
-
 class ProcessMonitor : public rclcpp::Node
 {
 public:
@@ -45,6 +47,34 @@ public:
 protected:
   using DiagStatus = diagnostic_msgs::msg::DiagnosticStatus;
 
+  /**
+   * @brief Struct for storing the fields of /proc/[pid]/stat used to rate processes
+   */
+  struct ProcessStat
+  {
+    pid_t pid;                  //!< @brief process id
+    std::string comm;           //!< @brief program name
+    char state;                 //!< @brief process state
+    uint64_t cpu_ticks;         //!< @brief user and system CPU time [clock ticks]
+    int64_t priority;           //!< @brief scheduling priority
+    int64_t nice;               //!< @brief nice value
+    uint64_t virtual_size_kb;   //!< @brief virtual memory size [KiB]
+    uint64_t resident_size_kb;  //!< @brief resident set size [KiB]
+    double cpu_usage;           //!< @brief CPU usage since the previous sampling [%]
+  };
+
+  /**
+   * @brief Struct for storing the number of tasks in each state
+   */
+  struct TasksSummary
+  {
+    int total = 0;
+    int running = 0;
+    int sleeping = 0;
+    int stopped = 0;
+    int zombie = 0;
+  };
+
   /**
    * @brief monitor processes
    * @param [out] stat diagnostic message passed directly to diagnostic publish calls
@@ -55,38 +85,34 @@ protected:
     diagnostic_updater::DiagnosticStatusWrapper & stat);  // NOLINT(runtime/references)
 
   /**
-   * @brief get task summary
-   * @param [out] stat diagnostic message passed directly to diagnostic publish calls
-   * @param [in] output top command output
-   * @note NOLINT syntax is needed since diagnostic_updater asks for a non-const reference
-   * to pass diagnostic message updated in this function to diagnostic publish calls.
+   * @brief read /proc/[pid]/stat of all processes
+   * @param [out] processes statistics of the processes
+   * @param [out] summary number of tasks in each state
+   * @return true if success to read /proc
    */
-  void getTasksSummary(
-    diagnostic_updater::DiagnosticStatusWrapper & stat,
-    const std::string & output);  // NOLINT(runtime/references)
+  bool readProcessStats(std::vector<ProcessStat> & processes, TasksSummary & summary);
 
   /**
-   * @brief remove header
-   * @param [out] stat diagnostic message passed directly to diagnostic publish calls
-   * @param [in] output top command output
-   * @note NOLINT syntax is needed since diagnostic_updater asks for a non-const reference
-   * to pass diagnostic message updated in this function to diagnostic publish calls.
+   * @brief read /proc/[pid]/stat of a process
+   * @param [in] pid process id
+   * @param [out] process statistics of the process
+   * @return true if success to read the file
    */
-  void removeHeader(
-    diagnostic_updater::DiagnosticStatusWrapper & stat,
-    std::string & output);  // NOLINT(runtime/references)
+  bool readProcessStat(const pid_t pid, ProcessStat & process) const;
 
   /**
-   * @brief get high load processes
-   * @param [in] output top command output
+   * @brief get the process information shown in diagnostics
+   * @param [in] process statistics of the process
+   * @return process information
    */
-  void getHighLoadProcesses(const std::string & output);
+  ProcessInfo getProcessInformation(const ProcessStat & process);
 
   /**
-   * @brief get high memory processes
-   * @param [in] output top command output
+   * @brief get user name from process id
+   * @param [in] pid process id
+   * @return user name, or user id if the name is not found
    */
-  void getHighMemoryProcesses(const std::string & output);
+  std::string getUserName(const pid_t pid);
 
   /**
    * @brief get command line from process id
@@ -97,14 +123,15 @@ protected:
   bool getCommandLineFromPiD(const std::string & pid, std::string & command);
 
   /**
-   * @brief get top-rated processes
-   * @param [in] tasks list of diagnostics tasks for high load procs
-   * @param [in] output top command output
+   * @brief set process information to diagnostics tasks
+   * @param [in] tasks list of diagnostics tasks
+   * @param [in] infos process information ordered by rating
    */
-  void getTopratedProcesses(std::vector<std::shared_ptr<DiagTask>> * tasks, bp::pipe * p);
+  void setProcessInformation(
+    std::vector<std::shared_ptr<DiagTask>> * tasks, const std::vector<ProcessInfo> & infos);
 
   /**
-   * @brief get top-rated processes
+   * @brief set error content to diagnostics tasks
    * @param [in] tasks list of diagnostics tasks for high load procs
    * @param [in] message Diagnostics status message
    * @param [in] error_command Error command
@@ -115,7 +142,7 @@ protected:
     const std::string & error_command, const std::string & content);
 
   /**
-   * @brief timer callback to execute top command
+   * @brief timer callback to sample processes
    */
   void onTimer();
 
@@ -128,12 +155,25 @@ protected:
     load_tasks_;  //!< @brief list of diagnostics tasks for high load procs
   std::vector<std::shared_ptr<DiagTask>>
     memory_tasks_;                      //!< @brief list of diagnostics tasks for high memory procs
-  rclcpp::TimerBase::SharedPtr timer_;  //!< @brief timer to execute top command
-  std::string top_output_;              //!< @brief output from top command
-  bool is_top_error_;                   //!< @brief flag if an top error occurs
-  bool is_pipe2_error_;                 //!< @brief flag if an pipe2 error occurs
-  double elapsed_ms_;                   //!< @brief Execution time of top command
-  std::mutex mutex_;                    //!< @brief mutex for output from top command
+  rclcpp::TimerBase::SharedPtr timer_;  //!< @brief timer to sample processes
+
+  int64_t clock_ticks_per_sec_;  //!< @brief clock ticks per second used in /proc/[pid]/stat
+  int64_t page_size_kb_;         //!< @brief page size [KiB]
+  uint64_t mem_total_kb_;        //!< @brief total memory [KiB]
+  std::unordered_map<pid_t, uint64_t>
+    prev_cpu_ticks_;  //!< @brief CPU time of each process at the previous sampling
+  std::chrono::steady_clock::time_point prev_sample_time_;  //!< @brief time of previous sampling
+  bool is_first_sample_;                                    //!< @brief flag if not sampled yet
+  std::map<uid_t, std::string> user_names_;                 //!< @brief cache of user names
+
+  bool is_sampled_;                             //!< @brief flag if processes are sampled
+  bool is_proc_error_;                          //!< @brief flag if an error reading /proc occurs
+  std::string proc_error_;                      //!< @brief error reading /proc
+  TasksSummary tasks_summary_;                  //!< @brief number of tasks in each state
+  std::vector<ProcessInfo> high_load_infos_;    //!< @brief high load processes
+  std::vector<ProcessInfo> high_memory_infos_;  //!< @brief high memory processes
+  double elapsed_ms_;                           //!< @brief Execution time of sampling
+  std::mutex mutex_;                            //!< @brief mutex for sampled processes
   rclcpp::CallbackGroup::SharedPtr timer_callback_group_;  //!< @brief Callback Group
 };
 
@@ -22,20 +22,17 @@
 #include "system_monitor/system_monitor_utility.hpp"
 
 #include <boost/filesystem.hpp>
-#include <boost/process.hpp>
-#include <boost/property_tree/json_parser.hpp>
-#include <boost/property_tree/ptree.hpp>
 #include <boost/thread.hpp>
 
 #include <fmt/format.h>
 
 #include <algorithm>
 #include <regex>
+#include <sstream>
 #include <string>
+#include <vector>
 
-namespace bp = boost::process;
 namespace fs = boost::filesystem;
-namespace pt = boost::property_tree;
 
 CPUMonitorBase::CPUMonitorBase(const std::string & node_name, const rclcpp::NodeOptions & options)
 : Node(node_name, options),
@@ -44,7 +41,7 @@ CPUMonitorBase::CPUMonitorBase(const std::string & node_name, const rclcpp::Node
   num_cores_(0),
   temps_(),
   freqs_(),
-  mpstat_exists_(false),
+  proc_stat_reader_("/proc/stat"),
   usage_warn_(declare_parameter<float>("usage_warn", 0.96)),
   usage_error_(declare_parameter<float>("usage_error", 0.96)),
   usage_warn_count_(declare_parameter<int>("usage_warn_count", 1)),
@@ -56,9 +53,8 @@ CPUMonitorBase::CPUMonitorBase(const std::string & node_name, const rclcpp::Node
   usage_warn_check_cnt_.resize(num_cores_ + 2);   // 2 = all + dummy
   usage_error_check_cnt_.resize(num_cores_ + 2);  // 2 = all + dummy
 
-  // Check if command exists
-  fs::path p = bp::search_path("mpstat");
-  mpstat_exists_ = (p.empty()) ? false : true;
+  // Read CPU time statistics to calculate CPU usage since then at the first check
+  readCpuStats(prev_cpu_stats_);
 
   updater_.setHardwareID(hostname_);
   updater_.add("CPU Temperature", this, &CPUMonitorBase::checkTemp);
@@ -127,147 +123,75 @@ void CPUMonitorBase::checkUsage(diagnostic_updater::DiagnosticStatusWrapper & st
   tier4_external_api_msgs::msg::CpuUsage cpu_usage;
   using CpuStatus = tier4_external_api_msgs::msg::CpuStatus;
 
-  if (!mpstat_exists_) {
-    stat.summary(DiagStatus::ERROR, "mpstat error");
-    stat.add(
-      "mpstat", "Command 'mpstat' not found, but can be installed with: sudo apt install sysstat");
-    cpu_usage.all.status = CpuStatus::STALE;
-    publishCpuUsage(cpu_usage);
-    return;
-  }
-
-  // Get CPU Usage
-
-  // boost::process create file descriptor without O_CLOEXEC required for multithreading.
-  // So create file descriptor with O_CLOEXEC and pass it to boost::process.
-  int out_fd[2];
-  if (pipe2(out_fd, O_CLOEXEC) != 0) {
-    stat.summary(DiagStatus::ERROR, "pipe2 error");
-    stat.add("pipe2", strerror(errno));
-    cpu_usage.all.status = CpuStatus::STALE;
-    publishCpuUsage(cpu_usage);
-    return;
-  }
-  bp::pipe out_pipe{out_fd[0], out_fd[1]};
-  bp::ipstream is_out{std::move(out_pipe)};
-
-  int err_fd[2];
-  if (pipe2(err_fd, O_CLOEXEC) != 0) {
-    stat.summary(DiagStatus::ERROR, "pipe2 error");
-    stat.add("pipe2", strerror(errno));
-    cpu_usage.all.status = CpuStatus::STALE;
-    publishCpuUsage(cpu_usage);
-    return;
-  }
-  bp::pipe err_pipe{err_fd[0], err_fd[1]};
-  bp::ipstream is_err{std::move(err_pipe)};
-
-  bp::child c("mpstat -P ALL 1 1 -o JSON", bp::std_out > is_out, bp::std_err > is_err);
-  c.wait();
-
-  if (c.exit_code() != 0) {
-    std::ostringstream os;
-    is_err >> os.rdbuf();
-    stat.summary(DiagStatus::ERROR, "mpstat error");
-    stat.add("mpstat", os.str().c_str());
+  std::vector<cpu_stat_info> cpu_stats;
+  if (!readCpuStats(cpu_stats)) {
+    stat.summary(DiagStatus::ERROR, "stat error");
+    stat.add("stat", strerror(errno));
+    std::fill(usage_warn_check_cnt_.begin(), usage_warn_check_cnt_.end(), 0);
+    std::fill(usage_error_check_cnt_.begin(), usage_error_check_cnt_.end(), 0);
     cpu_usage.all.status = CpuStatus::STALE;
     publishCpuUsage(cpu_usage);
     return;
   }
 
-  std::string cpu_name;
-  float usr{0.0};
-  float nice{0.0};
-  float sys{0.0};
-  float iowait{0.0};
-  float idle{0.0};
-  float usage{0.0};
-  float total{0.0};
   int level = DiagStatus::OK;
   int whole_level = DiagStatus::OK;
 
-  pt::ptree pt;
-  try {
-    // Analyze JSON output
-    read_json(is_out, pt);
-
-    for (const pt::ptree::value_type & child1 : pt.get_child("sysstat.hosts")) {
-      const pt::ptree & hosts = child1.second;
-
-      for (const pt::ptree::value_type & child2 : hosts.get_child("statistics")) {
-        const pt::ptree & statistics = child2.second;
-
-        for (const pt::ptree::value_type & child3 : statistics.get_child("cpu-load")) {
-          const pt::ptree & cpu_load = child3.second;
-          bool get_cpu_name = false;
-
-          CpuStatus cpu_status;
-
-          if (boost::optional<std::string> v = cpu_load.get_optional<std::string>("cpu")) {
-            cpu_name = v.get();
-            get_cpu_name = true;
-          }
-          if (boost::optional<float> v = cpu_load.get_optional<float>("usr")) {
-            usr = v.get();
-            cpu_status.usr = usr;
-          }
-          if (boost::optional<float> v = cpu_load.get_optional<float>("nice")) {
-            nice = v.get();
-            cpu_status.nice = nice;
-          }
-          if (boost::optional<float> v = cpu_load.get_optional<float>("sys")) {
-            sys = v.get();
-            cpu_status.sys = sys;
-          }
-          if (boost::optional<float> v = cpu_load.get_optional<float>("idle")) {
-            idle = v.get();
-            cpu_status.idle = idle;
-          }
-
-          total = 100.0 - iowait - idle;
-          usage = total * 1e-2;
-          if (get_cpu_name) {
-            level = CpuUsageToLevel(cpu_name, usage);
-          } else {
-            level = CpuUsageToLevel(std::string("err"), usage);
-          }
-
-          cpu_status.total = total;
-          cpu_status.status = level;
-
-          stat.add(fmt::format("CPU {}: status", cpu_name), load_dict_.at(level));
-          stat.addf(fmt::format("CPU {}: total", cpu_name), "%.2f%%", total);
-          stat.addf(fmt::format("CPU {}: usr", cpu_name), "%.2f%%", usr);
-          stat.addf(fmt::format("CPU {}: nice", cpu_name), "%.2f%%", nice);
-          stat.addf(fmt::format("CPU {}: sys", cpu_name), "%.2f%%", sys);
-          stat.addf(fmt::format("CPU {}: idle", cpu_name), "%.2f%%", idle);
-
-          if (usage_avg_ == true) {
-            if (cpu_name == "all") {
-              whole_level = level;
-            }
-          } else {
-            whole_level = std::max(whole_level, level);
-          }
-
-          if (cpu_name == "all") {
-            cpu_usage.all = cpu_status;
-          } else {
-            cpu_usage.cpus.push_back(cpu_status);
-          }
-        }
+  for (const auto & cpu_stat : cpu_stats) {
+    // CPU usage since the previous check, in the same way as mpstat
+    const auto prev_itr = std::find_if(
+      prev_cpu_stats_.begin(), prev_cpu_stats_.end(),
+      [&cpu_stat](const cpu_stat_info & s) { return s.name_ == cpu_stat.name_; });
+    const cpu_stat_info prev = prev_itr != prev_cpu_stats_.end() ? *prev_itr : cpu_stat_info();
+    const auto diff = [](const uint64_t curr, const uint64_t prev) {
+      return static_cast<float>(curr > prev ? curr - prev : 0);
+    };
+    // guest time is already included in user time
+    const float usr = diff(cpu_stat.user_ - cpu_stat.guest_, prev.user_ - prev.guest_);
+    const float nice = diff(cpu_stat.nice_ - cpu_stat.guest_nice_, prev.nice_ - prev.guest_nice_);
+    const float sys = diff(cpu_stat.system_, prev.system_);
+    const float idle = diff(cpu_stat.idle_, prev.idle_);
+    const float elapsed = usr + nice + sys + idle + diff(cpu_stat.iowait_, prev.iowait_) +
+                          diff(cpu_stat.irq_, prev.irq_) + diff(cpu_stat.softirq_, prev.softirq_) +
+                          diff(cpu_stat.steal_, prev.steal_) + diff(cpu_stat.guest_, prev.guest_) +
+                          diff(cpu_stat.guest_nice_, prev.guest_nice_);
+    // regard the CPU as idle if no time has elapsed
+    const float scale = elapsed > 0.0f ? 100.0f / elapsed : 0.0f;
+
+    CpuStatus cpu_status;
+    cpu_status.usr = usr * scale;
+    cpu_status.nice = nice * scale;
+    cpu_status.sys = sys * scale;
+    cpu_status.idle = elapsed > 0.0f ? idle * scale : 100.0f;
+    cpu_status.total = 100.0f - cpu_status.idle;
+
+    const float usage = cpu_status.total * 1e-2;
+    level = CpuUsageToLevel(cpu_stat.name_, usage);
+    cpu_status.status = level;
+
+    const std::string & cpu_name = cpu_stat.name_;
+    stat.add(fmt::format("CPU {}: status", cpu_name), load_dict_.at(level));
+    stat.addf(fmt::format("CPU {}: total", cpu_name), "%.2f%%", cpu_status.total);
+    stat.addf(fmt::format("CPU {}: usr", cpu_name), "%.2f%%", cpu_status.usr);
+    stat.addf(fmt::format("CPU {}: nice", cpu_name), "%.2f%%", cpu_status.nice);
+    stat.addf(fmt::format("CPU {}: sys", cpu_name), "%.2f%%", cpu_status.sys);
+    stat.addf(fmt::format("CPU {}: idle", cpu_name), "%.2f%%", cpu_status.idle);
+
+    if (usage_avg_ == true) {
+      if (cpu_name == "all") {
+        whole_level = level;
       }
+    } else {
+      whole_level = std::max(whole_level, level);
+    }
+
+    if (cpu_name == "all") {
+      cpu_usage.all = cpu_status;
+    } else {
+      cpu_usage.cpus.push_back(cpu_status);
     }
-  } catch (const std::exception & e) {
-    stat.summary(DiagStatus::ERROR, "mpstat exception");
-    stat.add("mpstat", e.what());
-    std::fill(usage_warn_check_cnt_.begin(), usage_warn_check_cnt_.end(), 0);
-    std::fill(usage_error_check_cnt_.begin(), usage_error_check_cnt_.end(), 0);
-    cpu_usage.all.status = CpuStatus::STALE;
-    cpu_usage.cpus.clear();
-    publishCpuUsage(cpu_usage);
-    return;
   }
+  prev_cpu_stats_ = cpu_stats;
 
   stat.summary(whole_level, load_dict_.at(whole_level));
 
@@ -278,6 +202,43 @@ void CPUMonitorBase::checkUsage(diagnostic_updater::DiagnosticStatusWrapper & st
   SystemMonitorUtility::stopMeasurement(t_start, stat);
 }
 
+bool CPUMonitorBase::readCpuStats(std::vector<cpu_stat_info> & cpu_stats)
+{
+  std::string contents;
+  if (!proc_stat_reader_.read(contents)) {
+    return false;
+  }
+
+  /*
+   Output example of /proc/stat, the cpu lines come first
+
+   cpu  10132153 290696 3084719 46828483 16683 0 25195 0 175628 0
+   cpu0 1393280 32966 572056 13343292 6130 0 17875 0 23933 0
+   ...
+   intr 1462898 ...
+  */
+  cpu_stats.clear();
+  std::istringstream stream(contents);
+  std::string line;
+  while (std::getline(stream, line) && line.compare(0, 3, "cpu") == 0) {
+    std::istringstream line_stream(line);
+    std::string name;
+    cpu_stat_info cpu_stat;
+    // fields which older kernels do not have stay 0
+    line_stream >> name >> cpu_stat.user_ >> cpu_stat.nice_ >> cpu_stat.system_ >>
+      cpu_stat.idle_ >> cpu_stat.iowait_ >> cpu_stat.irq_ >> cpu_stat.softirq_ >> cpu_stat.steal_ >>
+      cpu_stat.guest_ >> cpu_stat.guest_nice_;
+    cpu_stat.name_ = name == "cpu" ? "all" : name.substr(3);
+    cpu_stats.push_back(cpu_stat);
+  }
+
+  if (cpu_stats.empty()) {
+    errno = EINVAL;
+    return false;
+  }
+  return true;
+}
+
 int CPUMonitorBase::CpuUsageToLevel(const std::string & cpu_name, float usage)
 {
   // cpu name to counter index
@@ -289,7 +250,7 @@ int CPUMonitorBase::CpuUsageToLevel(const std::string & cpu_name, float usage)
     }
     idx = num + 1;
   } catch (std::exception &) {
-    if (cpu_name == std::string("all")) {  // mpstat output "all"
+    if (cpu_name == std::string("all")) {  // all the CPUs
       idx = 0;
     } else {
       idx = num_cores_ + 1;
@@ -25,6 +25,8 @@
 
 #include <fmt/format.h>
 
+#include <map>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -33,7 +35,8 @@ namespace bp = boost::process;
 MemMonitor::MemMonitor(const rclcpp::NodeOptions & options)
 : Node("mem_monitor", options),
   updater_(this),
-  available_size_(declare_parameter<int>("available_size", 1024) * 1024 * 1024)
+  available_size_(declare_parameter<int>("available_size", 1024) * 1024 * 1024),
+  meminfo_reader_("/proc/meminfo")
 {
   gethostname(hostname_, sizeof(hostname_));
   updater_.setHardwareID(hostname_);
@@ -56,96 +59,75 @@ void MemMonitor::checkUsage(diagnostic_updater::DiagnosticStatusWrapper & stat)
   const auto t_start = SystemMonitorUtility::startMeasurement();
 
   // Get total amount of free and used memory
-
-  // boost::process create file descriptor without O_CLOEXEC required for multithreading.
-  // So create file descriptor with O_CLOEXEC and pass it to boost::process.
-  int out_fd[2];
-  if (pipe2(out_fd, O_CLOEXEC) != 0) {
-    stat.summary(DiagStatus::ERROR, "pipe2 error");
-    stat.add("pipe2", strerror(errno));
-    return;
-  }
-  bp::pipe out_pipe{out_fd[0], out_fd[1]};
-  bp::ipstream is_out{std::move(out_pipe)};
-
-  int err_fd[2];
-  if (pipe2(err_fd, O_CLOEXEC) != 0) {
-    stat.summary(DiagStatus::ERROR, "pipe2 error");
-    stat.add("pipe2", strerror(errno));
-    return;
-  }
-  bp::pipe err_pipe{err_fd[0], err_fd[1]};
-  bp::ipstream is_err{std::move(err_pipe)};
-
-  bp::child c("free -tb", bp::std_out > is_out, bp::std_err > is_err);
-  c.wait();
-  if (c.exit_code() != 0) {
-    std::ostringstream os;
-    is_err >> os.rdbuf();
-    stat.summary(DiagStatus::ERROR, "free error");
-    stat.add("free", os.str().c_str());
+  std::string contents;
+  if (!meminfo_reader_.read(contents)) {
+    stat.summary(DiagStatus::ERROR, "meminfo error");
+    stat.add("meminfo", strerror(errno));
     return;
   }
 
-  std::string line;
-  int index = 0;
-  std::vector<std::string> list;
-  float usage;
-  size_t mem_total = 0;
-  size_t mem_shared = 0;
-  size_t mem_available = 0;
-  size_t used_plus = 0;
-
   /*
-   Output example of `free -tb`
-
-             list[0]     list[1]     list[2]     list[3]     list[4]     list[5]     list[6]
-   index 0 |               total        used        free      shared  buff/cache   available
-   index 1 | Mem:       32809744    12554780    13090376      292840     7164588    19622092
-   index 2 | Swap:      33554428     1767680    31786748
-   index 3 | Total:     66364172    14322460    44877124
+   Output example of /proc/meminfo
+
+   MemTotal:       32809744 kB
+   MemFree:        13090376 kB
+   MemAvailable:   19622092 kB
+   Buffers:          712384 kB
+   Cached:          6012068 kB
+   ...
   */
-  while (std::getline(is_out, line) && !line.empty()) {
-    // Skip header
-    if (index <= 0) {
-      ++index;
-      continue;
-    }
-
-    boost::split(list, line, boost::is_space(), boost::token_compress_on);
-
-    // Physical memory
-    if (index == 1) {
-      mem_total = std::atoll(list[1].c_str());
-      mem_shared = std::atoll(list[4].c_str());
-      mem_available = std::atoll(list[6].c_str());
-
-      // available divided by total is available memory including calculation for buff/cache,
-      // so the subtraction of this from 1 gives real usage.
-      usage = 1.0f - static_cast<double>(mem_available) / mem_total;
-      stat.addf(fmt::format("{} usage", list[0]), "%.2f%%", usage * 1e+2);
-    }
-
-    stat.add(fmt::format("{} total", list[0]), toHumanReadable(list[1]));
-    stat.add(fmt::format("{} used", list[0]), toHumanReadable(list[2]));
-    stat.add(fmt::format("{} free", list[0]), toHumanReadable(list[3]));
-
-    // Add an additional information for physical memory
-    if (index == 1) {
-      stat.add(fmt::format("{} shared", list[0]), toHumanReadable(list[4]));
-      stat.add(fmt::format("{} buff/cache", list[0]), toHumanReadable(list[5]));
-      stat.add(fmt::format("{} available", list[0]), toHumanReadable(list[6]));
-    } else if (index == 3) {
-      // Total:used + Mem:shared
-      used_plus = std::atoll(list[2].c_str()) + mem_shared;
-      double giga = static_cast<double>(used_plus) / (1024 * 1024 * 1024);
-      stat.add(fmt::format("{} used+", list[0]), fmt::format("{:.1f}{}", giga, "G"));
-    } else {
-      /* nothing */
+  std::map<std::string, size_t> meminfo;
+  std::istringstream stream(contents);
+  std::string line;
+  while (std::getline(stream, line)) {
+    std::istringstream line_stream(line);
+    std::string key;
+    size_t value;
+    if (line_stream >> key >> value) {
+      // remove ':' at the end of the key and convert kB to bytes
+      key.pop_back();
+      meminfo[key] = value * 1024;
     }
-    ++index;
   }
 
+  // Calculate the values in the same way as `free -tb`
+  const size_t mem_total = meminfo["MemTotal"];
+  const size_t mem_free = meminfo["MemFree"];
+  const size_t mem_shared = meminfo["Shmem"];
+  const size_t mem_buff_cache = meminfo["Buffers"] + meminfo["Cached"] + meminfo["SReclaimable"];
+  const size_t mem_available = meminfo.count("MemAvailable") ? meminfo["MemAvailable"] : mem_free;
+  const size_t mem_used = mem_total >= mem_free + mem_buff_cache
+                            ? mem_total - mem_free - mem_buff_cache
+                            : mem_total - mem_free;
+  const size_t swap_total = meminfo["SwapTotal"];
+  const size_t swap_free = meminfo["SwapFree"];
+  const size_t swap_used = swap_total - swap_free;
+
+  // available divided by total is available memory including calculation for buff/cache,
+  // so the subtraction of this from 1 gives real usage.
+  const float usage = mem_total > 0 ? 1.0f - static_cast<double>(mem_available) / mem_total : 0.0f;
+  stat.addf("Mem: usage", "%.2f%%", usage * 1e+2);
+
+  stat.add("Mem: total", toHumanReadable(std::to_string(mem_total)));
+  stat.add("Mem: used", toHumanReadable(std::to_string(mem_used)));
+  stat.add("Mem: free", toHumanReadable(std::to_string(mem_free)));
+  stat.add("Mem: shared", toHumanReadable(std::to_string(mem_shared)));
+  stat.add("Mem: buff/cache", toHumanReadable(std::to_string(mem_buff_cache)));
+  stat.add("Mem: available", toHumanReadable(std::to_string(mem_available)));
+
+  stat.add("Swap: total", toHumanReadable(std::to_string(swap_total)));
+  stat.add("Swap: used", toHumanReadable(std::to_string(swap_used)));
+  stat.add("Swap: free", toHumanReadable(std::to_string(swap_free)));
+
+  stat.add("Total: total", toHumanReadable(std::to_string(mem_total + swap_total)));
+  stat.add("Total: used", toHumanReadable(std::to_string(mem_used + swap_used)));
+  stat.add("Total: free", toHumanReadable(std::to_string(mem_free + swap_free)));
+
+  // Total:used + Mem:shared
+  const size_t used_plus = mem_used + swap_used + mem_shared;
+  const double giga = static_cast<double>(used_plus) / (1024 * 1024 * 1024);
+  stat.add("Total: used+", fmt::format("{:.1f}{}", giga, "G"));
+
   int level;
   if (mem_total > used_plus) {
     level = DiagStatus::OK;
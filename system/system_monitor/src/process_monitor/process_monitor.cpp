@@ -19,14 +19,21 @@
 
 #include "system_monitor/process_monitor/process_monitor.hpp"
 
-#include "system_monitor/system_monitor_utility.hpp"
-
 #include <tier4_autoware_utils/system/stop_watch.hpp>
 
+#include <dirent.h>
 #include <fmt/format.h>
-
+#include <pwd.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <iterator>
 #include <memory>
-#include <regex>
+#include <sstream>
 #include <string>
 #include <vector>
 
@@ -34,8 +41,13 @@ ProcessMonitor::ProcessMonitor(const rclcpp::NodeOptions & options)
 : Node("process_monitor", options),
   updater_(this),
   num_of_procs_(declare_parameter<int>("num_of_procs", 5)),
-  is_top_error_(false),
-  is_pipe2_error_(false)
+  clock_ticks_per_sec_(sysconf(_SC_CLK_TCK)),
+  page_size_kb_(sysconf(_SC_PAGESIZE) / 1024),
+  mem_total_kb_(0),
+  is_first_sample_(true),
+  is_sampled_(false),
+  is_proc_error_(false),
+  elapsed_ms_(0.0)
 {
   using namespace std::literals::chrono_literals;
 
@@ -57,7 +69,20 @@ ProcessMonitor::ProcessMonitor(const rclcpp::NodeOptions & options)
     updater_.add(*task);
   }
 
-  // Start timer to execute top command
+  // Get total memory to calculate memory usage
+  std::ifstream meminfo("/proc/meminfo");
+  std::string line;
+  while (std::getline(meminfo, line)) {
+    std::istringstream stream(line);
+    std::string key;
+    stream >> key;
+    if (key == "MemTotal:") {
+      stream >> mem_total_kb_;
+      break;
+    }
+  }
+
+  // Start timer to sample processes
   timer_callback_group_ = this->create_callback_group(rclcpp::CallbackGroupType::MutuallyExclusive);
   timer_ = rclcpp::create_timer(
     this, get_clock(), 1s, std::bind(&ProcessMonitor::onTimer, this), timer_callback_group_);
@@ -66,352 +91,195 @@ ProcessMonitor::ProcessMonitor(const rclcpp::NodeOptions & options)
 void ProcessMonitor::monitorProcesses(diagnostic_updater::DiagnosticStatusWrapper & stat)
 {
   // thread-safe read
-  std::string str;
-  bool is_top_error;
-  bool is_pipe2_error;
+  bool is_sampled;
+  bool is_proc_error;
+  std::string proc_error;
+  TasksSummary tasks_summary;
+  std::vector<ProcessInfo> high_load_infos;
+  std::vector<ProcessInfo> high_memory_infos;
   double elapsed_ms;
   {
     std::lock_guard<std::mutex> lock(mutex_);
-    str = top_output_;
-    is_top_error = is_top_error_;
-    is_pipe2_error = is_pipe2_error_;
+    is_sampled = is_sampled_;
+    is_proc_error = is_proc_error_;
+    proc_error = proc_error_;
+    tasks_summary = tasks_summary_;
+    high_load_infos = high_load_infos_;
+    high_memory_infos = high_memory_infos_;
     elapsed_ms = elapsed_ms_;
   }
 
-  if (is_pipe2_error) {
-    stat.summary(DiagStatus::ERROR, "pipe2 error");
-    stat.add("pipe2", str);
-    setErrorContent(&load_tasks_, "pipe2 error", "pipe2", str);
-    setErrorContent(&memory_tasks_, "pipe2 error", "pipe2", str);
-    return;
-  }
-  if (is_top_error) {
-    stat.summary(DiagStatus::ERROR, "top error");
-    stat.add("top", str);
-    setErrorContent(&load_tasks_, "top error", "top", str);
-    setErrorContent(&memory_tasks_, "top error", "top", str);
+  if (is_proc_error) {
+    stat.summary(DiagStatus::ERROR, "proc error");
+    stat.add("proc", proc_error);
+    setErrorContent(&load_tasks_, "proc error", "proc", proc_error);
+    setErrorContent(&memory_tasks_, "proc error", "proc", proc_error);
     return;
   }
 
-  // If top still not running
-  if (str.empty()) {
+  // If processes are not sampled twice yet to calculate CPU usage
+  if (!is_sampled) {
     // Send OK tentatively
     stat.summary(DiagStatus::OK, "starting up");
     return;
   }
 
-  // Get task summary
-  getTasksSummary(stat, str);
-  // Remove header
-  removeHeader(stat, str);
-
-  // Get high load processes
-  getHighLoadProcesses(str);
+  stat.add("total", tasks_summary.total);
+  stat.add("running", tasks_summary.running);
+  stat.add("sleeping", tasks_summary.sleeping);
+  stat.add("stopped", tasks_summary.stopped);
+  stat.add("zombie", tasks_summary.zombie);
+  stat.summary(DiagStatus::OK, "OK");
 
-  // Get high memory processes
-  getHighMemoryProcesses(str);
+  setProcessInformation(&load_tasks_, high_load_infos);
+  setProcessInformation(&memory_tasks_, high_memory_infos);
 
   stat.addf("execution time", "%f ms", elapsed_ms);
 }
 
-void ProcessMonitor::getTasksSummary(
-  diagnostic_updater::DiagnosticStatusWrapper & stat, const std::string & output)
+bool ProcessMonitor::readProcessStats(
+  std::vector<ProcessStat> & processes, TasksSummary & summary)
 {
-  // boost::process create file descriptor without O_CLOEXEC required for multithreading.
-  // So create file descriptor with O_CLOEXEC and pass it to boost::process.
-  int p_fd[2];
-  if (pipe2(p_fd, O_CLOEXEC) != 0) {
-    stat.summary(DiagStatus::ERROR, "pipe2 error");
-    stat.add("pipe2", strerror(errno));
-    return;
+  DIR * dir = opendir("/proc");
+  if (dir == nullptr) {
+    return false;
   }
-  bp::pipe p{p_fd[0], p_fd[1]};
 
-  std::string line;
-
-  // Echo output for grep
-  {
-    int out_fd[2];
-    if (pipe2(out_fd, O_CLOEXEC) != 0) {
-      stat.summary(DiagStatus::ERROR, "pipe2 error");
-      stat.add("pipe2", strerror(errno));
-      return;
-    }
-    bp::pipe out_pipe{out_fd[0], out_fd[1]};
-    bp::ipstream is_out{std::move(out_pipe)};
-
-    int err_fd[2];
-    if (pipe2(err_fd, O_CLOEXEC) != 0) {
-      stat.summary(DiagStatus::ERROR, "pipe2 error");
-      stat.add("pipe2", strerror(errno));
-      return;
-    }
-    bp::pipe err_pipe{err_fd[0], err_fd[1]};
-    bp::ipstream is_err{std::move(err_pipe)};
-
-    bp::child c(fmt::format("echo {}", output), bp::std_out > p, bp::std_err > is_err);
-    c.wait();
-    if (c.exit_code() != 0) {
-      std::ostringstream os;
-      is_err >> os.rdbuf();
-      stat.summary(DiagStatus::ERROR, "echo error");
-      stat.add("echo", os.str().c_str());
-      return;
-    }
-  }
-  // Find matching pattern of summary
-  {
-    int out_fd[2];
-    if (pipe2(out_fd, O_CLOEXEC) != 0) {
-      stat.summary(DiagStatus::ERROR, "pipe2 error");
-      stat.add("pipe2", strerror(errno));
-      return;
-    }
-    bp::pipe out_pipe{out_fd[0], out_fd[1]};
-    bp::ipstream is_out{std::move(out_pipe)};
-
-    bp::child c("grep Tasks:", bp::std_out > is_out, bp::std_in < p);
-    c.wait();
-    // no matching line
-    if (c.exit_code() != 0) {
-      stat.summary(DiagStatus::ERROR, "matching pattern not found");
-      stat.add("name", "Tasks:");
-      return;
+  processes.clear();
+  summary = TasksSummary{};
+  while (const auto * entry = readdir(dir)) {
+    // process directories are named by the process id
+    char * end = nullptr;
+    const auto pid = static_cast<pid_t>(std::strtol(entry->d_name, &end, 10));
+    if (end == entry->d_name || *end != '\0') {
+      continue;
     }
 
-    std::getline(is_out, line);
-    std::cmatch match;
-    const std::regex filter(
-      "^Tasks: (\\d+) total,\\s+(\\d+) running,\\s+(\\d+) sleeping,\\s+(\\d+) stopped,\\s+(\\d+) "
-      "zombie");
-
-    if (std::regex_match(line.c_str(), match, filter)) {
-      stat.add("total", match[1].str());
-      stat.add("running", match[2].str());
-      stat.add("sleeping", match[3].str());
-      stat.add("stopped", match[4].str());
-      stat.add("zombie", match[5].str());
-      stat.summary(DiagStatus::OK, "OK");
-    } else {
-      stat.summary(DiagStatus::ERROR, "invalid format");
+    ProcessStat process;
+    // the process may exit while reading /proc
+    if (!readProcessStat(pid, process)) {
+      continue;
     }
-  }
-}
-
-void ProcessMonitor::removeHeader(
-  diagnostic_updater::DiagnosticStatusWrapper & stat, std::string & output)
-{
-  // boost::process create file descriptor without O_CLOEXEC required for multithreading.
-  // So create file descriptor with O_CLOEXEC and pass it to boost::process.
-  int p1_fd[2];
-  if (pipe2(p1_fd, O_CLOEXEC) != 0) {
-    stat.summary(DiagStatus::ERROR, "pipe2 error");
-    stat.add("pipe2", strerror(errno));
-    return;
-  }
-  bp::pipe p1{p1_fd[0], p1_fd[1]};
 
-  int p2_fd[2];
-  if (pipe2(p2_fd, O_CLOEXEC) != 0) {
-    stat.summary(DiagStatus::ERROR, "pipe2 error");
-    stat.add("pipe2", strerror(errno));
-    return;
-  }
-  bp::pipe p2{p2_fd[0], p2_fd[1]};
-
-  std::ostringstream os;
-
-  // Echo output for sed
-  {
-    int err_fd[2];
-    if (pipe2(err_fd, O_CLOEXEC) != 0) {
-      stat.summary(DiagStatus::ERROR, "pipe2 error");
-      stat.add("pipe2", strerror(errno));
-      return;
-    }
-    bp::pipe err_pipe{err_fd[0], err_fd[1]};
-    bp::ipstream is_err{std::move(err_pipe)};
-
-    bp::child c(fmt::format("echo {}", output), bp::std_out > p1, bp::std_err > is_err);
-    c.wait();
-    if (c.exit_code() != 0) {
-      is_err >> os.rdbuf();
-      stat.summary(DiagStatus::ERROR, "echo error");
-      stat.add("echo", os.str().c_str());
-      return;
-    }
-  }
-  // Remove %Cpu section
-  {
-    int err_fd[2];
-    if (pipe2(err_fd, O_CLOEXEC) != 0) {
-      stat.summary(DiagStatus::ERROR, "pipe2 error");
-      stat.add("pipe2", strerror(errno));
-      return;
-    }
-    bp::pipe err_pipe{err_fd[0], err_fd[1]};
-    bp::ipstream is_err{std::move(err_pipe)};
-
-    bp::child c("sed \"/^%Cpu/d\"", bp::std_out > p2, bp::std_err > is_err, bp::std_in < p1);
-    c.wait();
-    // no matching line
-    if (c.exit_code() != 0) {
-      stat.summary(DiagStatus::ERROR, "sed error");
-      stat.add("sed", "Failed to remove header");
-      return;
+    ++summary.total;
+    switch (process.state) {
+      case 'R':
+        ++summary.running;
+        break;
+      case 'S':
+      case 'D':
+      case 'I':
+        ++summary.sleeping;
+        break;
+      case 'T':
+      case 't':
+        ++summary.stopped;
+        break;
+      case 'Z':
+        ++summary.zombie;
+        break;
+      default:
+        break;
     }
+    processes.push_back(process);
   }
-  // Remove header
-  {
-    int out_fd[2];
-    if (pipe2(out_fd, O_CLOEXEC) != 0) {
-      stat.summary(DiagStatus::ERROR, "pipe2 error");
-      stat.add("pipe2", strerror(errno));
-      return;
-    }
-    bp::pipe out_pipe{out_fd[0], out_fd[1]};
-    bp::ipstream is_out{std::move(out_pipe)};
-
-    int err_fd[2];
-    if (pipe2(err_fd, O_CLOEXEC) != 0) {
-      stat.summary(DiagStatus::ERROR, "pipe2 error");
-      stat.add("pipe2", strerror(errno));
-      return;
-    }
-    bp::pipe err_pipe{err_fd[0], err_fd[1]};
-    bp::ipstream is_err{std::move(err_pipe)};
-
-    bp::child c("sed \"1,6d\"", bp::std_out > is_out, bp::std_err > is_err, bp::std_in < p2);
-    c.wait();
-    // no matching line
-    if (c.exit_code() != 0) {
-      stat.summary(DiagStatus::ERROR, "sed error");
-      stat.add("sed", "Failed to remove header");
-      return;
-    }
-    // overwrite
-    is_out >> os.rdbuf();
-    output = os.str();
-  }
+  closedir(dir);
+  return true;
 }
 
-void ProcessMonitor::getHighLoadProcesses(const std::string & output)
+bool ProcessMonitor::readProcessStat(const pid_t pid, ProcessStat & process) const
 {
-  // boost::process create file descriptor without O_CLOEXEC required for multithreading.
-  // So create file descriptor with O_CLOEXEC and pass it to boost::process.
-  int p_fd[2];
-  if (pipe2(p_fd, O_CLOEXEC) != 0) {
-    setErrorContent(&load_tasks_, "pipe2 error", "pipe2", strerror(errno));
-    return;
+  std::ifstream ifs(fmt::format("/proc/{}/stat", pid));
+  std::string line;
+  if (!std::getline(ifs, line)) {
+    return false;
   }
-  bp::pipe p{p_fd[0], p_fd[1]};
-
-  std::ostringstream os;
 
-  // Echo output for sed
-  int out_fd[2];
-  if (pipe2(out_fd, O_CLOEXEC) != 0) {
-    setErrorContent(&load_tasks_, "pipe2 error", "pipe2", strerror(errno));
-    return;
+  // the program name is enclosed in parentheses and may contain spaces and parentheses
+  const auto comm_begin = line.find('(');
+  const auto comm_end = line.rfind(')');
+  if (comm_begin == std::string::npos || comm_end == std::string::npos || comm_end < comm_begin) {
+    return false;
   }
-  bp::pipe out_pipe{out_fd[0], out_fd[1]};
-  bp::ipstream is_out{std::move(out_pipe)};
 
-  int err_fd[2];
-  if (pipe2(err_fd, O_CLOEXEC) != 0) {
-    setErrorContent(&load_tasks_, "pipe2 error", "pipe2", strerror(errno));
-    return;
-  }
-  bp::pipe err_pipe{err_fd[0], err_fd[1]};
-  bp::ipstream is_err{std::move(err_pipe)};
-
-  bp::child c(fmt::format("echo {}", output), bp::std_out > p, bp::std_err > is_err);
-  c.wait();
-  if (c.exit_code() != 0) {
-    is_err >> os.rdbuf();
-    setErrorContent(&load_tasks_, "echo error", "echo", os.str().c_str());
-    return;
+  // fields after the program name, starting from the 3rd field (state), see proc(5)
+  std::istringstream stream(line.substr(comm_end + 1));
+  std::vector<std::string> fields{
+    std::istream_iterator<std::string>(stream), std::istream_iterator<std::string>()};
+  constexpr size_t rss_index = 24 - 3;
+  if (fields.size() <= rss_index) {
+    return false;
   }
 
-  // Get top-rated
-  getTopratedProcesses(&load_tasks_, &p);
+  process.pid = pid;
+  process.comm = line.substr(comm_begin + 1, comm_end - comm_begin - 1);
+  process.state = fields.at(0).front();
+  process.cpu_ticks = std::stoull(fields.at(14 - 3)) + std::stoull(fields.at(15 - 3));
+  process.priority = std::stoll(fields.at(18 - 3));
+  process.nice = std::stoll(fields.at(19 - 3));
+  process.virtual_size_kb = std::stoull(fields.at(23 - 3)) / 1024;
+  process.resident_size_kb = std::stoull(fields.at(rss_index)) * page_size_kb_;
+  process.cpu_usage = 0.0;
+  return true;
 }
 
-void ProcessMonitor::getHighMemoryProcesses(const std::string & output)
+ProcessInfo ProcessMonitor::getProcessInformation(const ProcessStat & process)
 {
-  // boost::process create file descriptor without O_CLOEXEC required for multithreading.
-  // So create file descriptor with O_CLOEXEC and pass it to boost::process.
-  int p1_fd[2];
-  if (pipe2(p1_fd, O_CLOEXEC) != 0) {
-    setErrorContent(&memory_tasks_, "pipe2 error", "pipe2", strerror(errno));
-    return;
-  }
-  bp::pipe p1{p1_fd[0], p1_fd[1]};
+  ProcessInfo info;
+  info.processId = std::to_string(process.pid);
+  info.userName = getUserName(process.pid);
+  // real-time processes are shown as rt in the same way as top
+  info.priority = process.priority == -100 ? "rt" : std::to_string(process.priority);
+  info.niceValue = std::to_string(process.nice);
+  info.virtualImage = std::to_string(process.virtual_size_kb);
+  info.residentSize = std::to_string(process.resident_size_kb);
+
+  std::ifstream statm(fmt::format("/proc/{}/statm", process.pid));
+  uint64_t size_pages = 0;
+  uint64_t resident_pages = 0;
+  uint64_t shared_pages = 0;
+  statm >> size_pages >> resident_pages >> shared_pages;
+  info.sharedMemSize = std::to_string(shared_pages * page_size_kb_);
+
+  info.processStatus = std::string(1, process.state);
+  info.cpuUsage = fmt::format("{:.1f}", process.cpu_usage);
+  info.memoryUsage =
+    mem_total_kb_ == 0
+      ? "0.0"
+      : fmt::format("{:.1f}", 100.0 * process.resident_size_kb / mem_total_kb_);
+
+  // TIME+ in the same format as top, minutes:seconds.hundredths
+  const uint64_t centiseconds = process.cpu_ticks * 100 / clock_ticks_per_sec_;
+  info.cpuTime = fmt::format(
+    "{}:{:02}.{:02}", centiseconds / 6000, (centiseconds / 100) % 60, centiseconds % 100);
+
+  if (!getCommandLineFromPiD(info.processId, info.commandName)) {
+    info.commandName = process.comm;  // if command line is not found, use program name instead
+  }
+  return info;
+}
 
-  int p2_fd[2];
-  if (pipe2(p2_fd, O_CLOEXEC) != 0) {
-    setErrorContent(&memory_tasks_, "pipe2 error", "pipe2", strerror(errno));
-    return;
+std::string ProcessMonitor::getUserName(const pid_t pid)
+{
+  struct stat st;
+  if (::stat(fmt::format("/proc/{}", pid).c_str(), &st) != 0) {
+    return "";
   }
-  bp::pipe p2{p2_fd[0], p2_fd[1]};
 
-  std::ostringstream os;
-
-  // Echo output for sed
-  {
-    int out_fd[2];
-    if (pipe2(out_fd, O_CLOEXEC) != 0) {
-      setErrorContent(&memory_tasks_, "pipe2 error", "pipe2", strerror(errno));
-      return;
-    }
-    bp::pipe out_pipe{out_fd[0], out_fd[1]};
-    bp::ipstream is_out{std::move(out_pipe)};
-
-    int err_fd[2];
-    if (pipe2(err_fd, O_CLOEXEC) != 0) {
-      setErrorContent(&memory_tasks_, "pipe2 error", "pipe2", strerror(errno));
-      return;
-    }
-    bp::pipe err_pipe{err_fd[0], err_fd[1]};
-    bp::ipstream is_err{std::move(err_pipe)};
-
-    bp::child c(fmt::format("echo {}", output), bp::std_out > p1, bp::std_err > is_err);
-    c.wait();
-    if (c.exit_code() != 0) {
-      is_err >> os.rdbuf();
-      setErrorContent(&memory_tasks_, "echo error", "echo", os.str().c_str());
-      return;
-    }
+  const auto itr = user_names_.find(st.st_uid);
+  if (itr != user_names_.end()) {
+    return itr->second;
   }
-  // Sort by memory usage
-  {
-    int out_fd[2];
-    if (pipe2(out_fd, O_CLOEXEC) != 0) {
-      setErrorContent(&memory_tasks_, "pipe2 error", "pipe2", strerror(errno));
-      return;
-    }
-    bp::pipe out_pipe{out_fd[0], out_fd[1]};
-    bp::ipstream is_out{std::move(out_pipe)};
 
-    int err_fd[2];
-    if (pipe2(err_fd, O_CLOEXEC) != 0) {
-      setErrorContent(&memory_tasks_, "pipe2 error", "pipe2", strerror(errno));
-      return;
-    }
-    bp::pipe err_pipe{err_fd[0], err_fd[1]};
-    bp::ipstream is_err{std::move(err_pipe)};
-
-    bp::child c("sort -r -k 10 -n", bp::std_out > p2, bp::std_err > is_err, bp::std_in < p1);
-    c.wait();
-    if (c.exit_code() != 0) {
-      is_err >> os.rdbuf();
-      setErrorContent(&memory_tasks_, "sort error", "sort", os.str().c_str());
-      return;
-    }
+  struct passwd pwd;
+  struct passwd * result = nullptr;
+  std::vector<char> buffer(1024);
+  std::string name = std::to_string(st.st_uid);
+  if (getpwuid_r(st.st_uid, &pwd, buffer.data(), buffer.size(), &result) == 0 && result) {
+    name = pwd.pw_name;
   }
-
-  // Get top-rated
-  getTopratedProcesses(&memory_tasks_, &p2);
+  user_names_.emplace(st.st_uid, name);
+  return name;
 }
 
 bool ProcessMonitor::getCommandLineFromPiD(const std::string & pid, std::string & command)
@@ -435,66 +303,16 @@ bool ProcessMonitor::getCommandLineFromPiD(const std::string & pid, std::string
   }
 }
 
-void ProcessMonitor::getTopratedProcesses(
-  std::vector<std::shared_ptr<DiagTask>> * tasks, bp::pipe * p)
+void ProcessMonitor::setProcessInformation(
+  std::vector<std::shared_ptr<DiagTask>> * tasks, const std::vector<ProcessInfo> & infos)
 {
-  if (tasks == nullptr || p == nullptr) {
-    return;
-  }
-
-  int out_fd[2];
-  if (pipe2(out_fd, O_CLOEXEC) != 0) {
-    setErrorContent(tasks, "pipe2 error", "pipe2", strerror(errno));
-    return;
-  }
-  bp::pipe out_pipe{out_fd[0], out_fd[1]};
-  bp::ipstream is_out{std::move(out_pipe)};
-
-  int err_fd[2];
-  if (pipe2(err_fd, O_CLOEXEC) != 0) {
-    setErrorContent(tasks, "pipe2 error", "pipe2", strerror(errno));
-    return;
-  }
-  bp::pipe err_pipe{err_fd[0], err_fd[1]};
-  bp::ipstream is_err{std::move(err_pipe)};
-
-  std::ostringstream os;
-
-  bp::child c(
-    fmt::format("sed -n \"1,{} p\"", num_of_procs_), bp::std_out > is_out, bp::std_err > is_err,
-    bp::std_in < *p);
-
-  c.wait();
-  // Failed to modify line
-  if (c.exit_code() != 0) {
-    is_err >> os.rdbuf();
-    setErrorContent(tasks, "sed error", "sed", os.str().c_str());
+  if (tasks == nullptr) {
     return;
   }
 
-  std::string line;
-  int index = 0;
-
-  while (std::getline(is_out, line) && !line.empty()) {
-    std::istringstream stream(line);
-
-    ProcessInfo info;
-    stream >> info.processId >> info.userName >> info.priority >> info.niceValue >>
-      info.virtualImage >> info.residentSize >> info.sharedMemSize >> info.processStatus >>
-      info.cpuUsage >> info.memoryUsage >> info.cpuTime;
-
-    std::string program_name;
-    std::getline(stream, program_name);
-
-    bool flag_find_command_line = getCommandLineFromPiD(info.processId, info.commandName);
-
-    if (!flag_find_command_line) {
-      info.commandName = program_name;  // if command line is not found, use program name instead
-    }
-
+  for (size_t index = 0; index < infos.size() && index < tasks->size(); ++index) {
     tasks->at(index)->setDiagnosticsStatus(DiagStatus::OK, "OK");
-    tasks->at(index)->setProcessInformation(info);
-    ++index;
+    tasks->at(index)->setProcessInformation(infos.at(index));
   }
 }
 
@@ -514,53 +332,66 @@ void ProcessMonitor::setErrorContent(
 
 void ProcessMonitor::onTimer()
 {
-  bool is_top_error = false;
-
   // Start to measure elapsed time
   tier4_autoware_utils::StopWatch<std::chrono::milliseconds> stop_watch;
   stop_watch.tic("execution_time");
 
-  int out_fd[2];
-  if (pipe2(out_fd, O_CLOEXEC) != 0) {
-    std::lock_guard<std::mutex> lock(mutex_);
-    top_output_ = std::string(strerror(errno));
-    is_pipe2_error_ = true;
-    return;
-  }
-  bp::pipe out_pipe{out_fd[0], out_fd[1]};
-  bp::ipstream is_out{std::move(out_pipe)};
-
-  int err_fd[2];
-  if (pipe2(err_fd, O_CLOEXEC) != 0) {
+  std::vector<ProcessStat> processes;
+  TasksSummary tasks_summary;
+  if (!readProcessStats(processes, tasks_summary)) {
     std::lock_guard<std::mutex> lock(mutex_);
-    top_output_ = std::string(strerror(errno));
-    is_pipe2_error_ = true;
+    proc_error_ = std::string(strerror(errno));
+    is_proc_error_ = true;
     return;
   }
-  bp::pipe err_pipe{err_fd[0], err_fd[1]};
-  bp::ipstream is_err{std::move(err_pipe)};
-
-  std::ostringstream os;
-
-  // Get processes
-  bp::child c("top -bn1 -o %CPU -w 128", bp::std_out > is_out, bp::std_err > is_err);
-  c.wait();
 
-  if (c.exit_code() != 0) {
-    is_top_error = true;
-    is_err >> os.rdbuf();
-  } else {
-    is_out >> os.rdbuf();
+  // CPU usage is the CPU time spent since the previous sampling, so the first sampling only
+  // records the CPU time
+  const auto sample_time = std::chrono::steady_clock::now();
+  const double elapsed_ticks =
+    std::chrono::duration<double>(sample_time - prev_sample_time_).count() * clock_ticks_per_sec_;
+  std::unordered_map<pid_t, uint64_t> cpu_ticks;
+  cpu_ticks.reserve(processes.size());
+  for (auto & process : processes) {
+    cpu_ticks.emplace(process.pid, process.cpu_ticks);
+    const auto prev = prev_cpu_ticks_.find(process.pid);
+    const uint64_t prev_ticks = prev != prev_cpu_ticks_.end() ? prev->second : 0;
+    if (!is_first_sample_ && elapsed_ticks > 0.0 && process.cpu_ticks >= prev_ticks) {
+      process.cpu_usage = 100.0 * (process.cpu_ticks - prev_ticks) / elapsed_ticks;
+    }
   }
+  prev_cpu_ticks_ = std::move(cpu_ticks);
+  prev_sample_time_ = sample_time;
+  const bool is_sampled = !is_first_sample_;
+  is_first_sample_ = false;
+
+  // Get top-rated processes, only for which the details are read
+  const auto get_toprated = [&](const auto & compare) {
+    const auto num = std::min(processes.size(), static_cast<size_t>(std::max(num_of_procs_, 0)));
+    std::partial_sort(processes.begin(), processes.begin() + num, processes.end(), compare);
+    std::vector<ProcessInfo> infos;
+    for (size_t i = 0; i < num; ++i) {
+      infos.push_back(getProcessInformation(processes.at(i)));
+    }
+    return infos;
+  };
+  auto high_load_infos = get_toprated([](const ProcessStat & a, const ProcessStat & b) {
+    return a.cpu_usage > b.cpu_usage;
+  });
+  auto high_memory_infos = get_toprated([](const ProcessStat & a, const ProcessStat & b) {
+    return a.resident_size_kb > b.resident_size_kb;
+  });
 
   const double elapsed_ms = stop_watch.toc("execution_time");
 
   // thread-safe copy
   {
     std::lock_guard<std::mutex> lock(mutex_);
-    top_output_ = os.str();
-    is_top_error_ = is_top_error;
-    is_pipe2_error_ = false;
+    is_sampled_ = is_sampled;
+    is_proc_error_ = false;
+    tasks_summary_ = tasks_summary;
+    high_load_infos_ = std::move(high_load_infos);
+    high_memory_infos_ = std::move(high_memory_infos);
     elapsed_ms_ = elapsed_ms;
   }
 }
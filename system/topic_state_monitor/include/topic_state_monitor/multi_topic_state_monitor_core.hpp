@@ -0,0 +1,70 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef TOPIC_STATE_MONITOR__MULTI_TOPIC_STATE_MONITOR_CORE_HPP_
+#define TOPIC_STATE_MONITOR__MULTI_TOPIC_STATE_MONITOR_CORE_HPP_
+
+#include "topic_state_monitor/topic_state_monitor.hpp"
+#include "topic_state_monitor/topic_state_monitor_core.hpp"
+
+#include <diagnostic_updater/diagnostic_updater.hpp>
+#include <rclcpp/rclcpp.hpp>
+
+#include <tf2_msgs/msg/tf_message.hpp>
+
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace topic_state_monitor
+{
+class MultiTopicStateMonitorNode : public rclcpp::Node
+{
+public:
+  explicit MultiTopicStateMonitorNode(const rclcpp::NodeOptions & node_options);
+
+private:
+  struct MonitoredTopic
+  {
+    NodeParam node_param;
+    Param param;
+    std::unique_ptr<TopicStateMonitor> topic_state_monitor;
+  };
+
+  // Parameter
+  double update_rate_;
+  MonitoredTopic loadMonitoredTopic(const std::string & name);
+
+  // Core
+  std::vector<std::unique_ptr<MonitoredTopic>> monitored_topics_;
+
+  // Subscriber
+  // The transforms share a subscription for each topic so that the messages are received once.
+  std::vector<rclcpp::GenericSubscription::SharedPtr> sub_topics_;
+  std::map<std::string, rclcpp::Subscription<tf2_msgs::msg::TFMessage>::SharedPtr>
+    sub_transforms_;
+  std::map<std::string, std::vector<MonitoredTopic *>> transform_topics_;
+  void onTransform(const std::string & topic, const tf2_msgs::msg::TFMessage & msg);
+
+  // Timer
+  void onTimer();
+  rclcpp::TimerBase::SharedPtr timer_;
+
+  // Diagnostic Updater
+  diagnostic_updater::Updater updater_;
+};
+}  // namespace topic_state_monitor
+
+#endif  // TOPIC_STATE_MONITOR__MULTI_TOPIC_STATE_MONITOR_CORE_HPP_
@@ -43,6 +43,12 @@ struct NodeParam
   bool is_transform;
 };
 
+// Add the status of the monitored topic to the diagnostics
+void setTopicStatus(
+  rclcpp::Node & node, const NodeParam & node_param, const Param & param,
+  const TopicStateMonitor & topic_state_monitor,
+  diagnostic_updater::DiagnosticStatusWrapper & stat);
+
 class TopicStateMonitorNode : public rclcpp::Node
 {
 public:
@@ -0,0 +1,138 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#include "topic_state_monitor/multi_topic_state_monitor_core.hpp"
+
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace topic_state_monitor
+{
+MultiTopicStateMonitorNode::MultiTopicStateMonitorNode(const rclcpp::NodeOptions & node_options)
+: Node("multi_topic_state_monitor", node_options), updater_(this)
+{
+  // Parameter
+  update_rate_ = declare_parameter("update_rate", 10.0);
+  const auto names = declare_parameter<std::vector<std::string>>("monitored_topics");
+
+  // Diagnostic Updater
+  updater_.setHardwareID("topic_state_monitor");
+
+  for (const auto & name : names) {
+    auto monitored_topic = std::make_unique<MonitoredTopic>(loadMonitoredTopic(name));
+    const auto & node_param = monitored_topic->node_param;
+    const auto topic = monitored_topic.get();
+
+    // Subscriber
+    rclcpp::QoS qos = rclcpp::QoS{1};
+    if (node_param.transient_local) {
+      qos.transient_local();
+    }
+    if (node_param.best_effort) {
+      qos.best_effort();
+    }
+
+    if (node_param.is_transform) {
+      // NOTE: the QoS of the first transform for each topic is used for the subscription
+      if (sub_transforms_.count(node_param.topic) == 0) {
+        sub_transforms_[node_param.topic] = this->create_subscription<tf2_msgs::msg::TFMessage>(
+          node_param.topic, qos,
+          [this, name = node_param.topic](tf2_msgs::msg::TFMessage::ConstSharedPtr msg) {
+            onTransform(name, *msg);
+          });
+      }
+      transform_topics_[node_param.topic].push_back(topic);
+    } else {
+      sub_topics_.push_back(this->create_generic_subscription(
+        node_param.topic, node_param.topic_type, qos,
+        [topic]([[maybe_unused]] std::shared_ptr<rclcpp::SerializedMessage> msg) {
+          topic->topic_state_monitor->update();
+        }));
+    }
+
+    updater_.add(
+      node_param.diag_name, [this, topic](diagnostic_updater::DiagnosticStatusWrapper & stat) {
+        setTopicStatus(*this, topic->node_param, topic->param, *topic->topic_state_monitor, stat);
+      });
+
+    monitored_topics_.push_back(std::move(monitored_topic));
+  }
+
+  // Timer
+  // All the topics are checked by one timer instead of a timer for each topic.
+  const auto period_ns = rclcpp::Rate(update_rate_).period();
+  timer_ = rclcpp::create_timer(
+    this, get_clock(), period_ns, std::bind(&MultiTopicStateMonitorNode::onTimer, this));
+}
+
+MultiTopicStateMonitorNode::MonitoredTopic MultiTopicStateMonitorNode::loadMonitoredTopic(
+  const std::string & name)
+{
+  const auto prefix = name + ".";
+
+  MonitoredTopic monitored_topic;
+  auto & node_param = monitored_topic.node_param;
+  node_param.update_rate = update_rate_;
+  node_param.topic = declare_parameter<std::string>(prefix + "topic");
+  node_param.transient_local = declare_parameter(prefix + "transient_local", false);
+  node_param.best_effort = declare_parameter(prefix + "best_effort", false);
+  node_param.diag_name = declare_parameter<std::string>(prefix + "diag_name");
+  node_param.is_transform = (node_param.topic == "/tf" || node_param.topic == "/tf_static");
+
+  if (node_param.is_transform) {
+    node_param.frame_id = declare_parameter<std::string>(prefix + "frame_id");
+    node_param.child_frame_id = declare_parameter<std::string>(prefix + "child_frame_id");
+  } else {
+    node_param.topic_type = declare_parameter<std::string>(prefix + "topic_type");
+  }
+
+  auto & param = monitored_topic.param;
+  param.warn_rate = declare_parameter(prefix + "warn_rate", 0.5);
+  param.error_rate = declare_parameter(prefix + "error_rate", 0.1);
+  param.timeout = declare_parameter(prefix + "timeout", 1.0);
+  param.window_size = declare_parameter(prefix + "window_size", 10);
+
+  monitored_topic.topic_state_monitor = std::make_unique<TopicStateMonitor>(*this);
+  monitored_topic.topic_state_monitor->setParam(param);
+  return monitored_topic;
+}
+
+void MultiTopicStateMonitorNode::onTransform(
+  const std::string & topic, const tf2_msgs::msg::TFMessage & msg)
+{
+  const auto & monitored_topics = transform_topics_.at(topic);
+  for (const auto & transform : msg.transforms) {
+    for (const auto & monitored_topic : monitored_topics) {
+      const auto & node_param = monitored_topic->node_param;
+      if (
+        transform.header.frame_id == node_param.frame_id &&
+        transform.child_frame_id == node_param.child_frame_id) {
+        monitored_topic->topic_state_monitor->update();
+      }
+    }
+  }
+}
+
+void MultiTopicStateMonitorNode::onTimer()
+{
+  // Publish diagnostics
+  updater_.force_update();
+}
+
+}  // namespace topic_state_monitor
+
+#include <rclcpp_components/register_node_macro.hpp>
+RCLCPP_COMPONENTS_REGISTER_NODE(topic_state_monitor::MultiTopicStateMonitorNode)
@@ -36,6 +36,77 @@ void update_param(
 
 namespace topic_state_monitor
 {
+void setTopicStatus(
+  rclcpp::Node & node, const NodeParam & node_param, const Param & param,
+  const TopicStateMonitor & topic_state_monitor, diagnostic_updater::DiagnosticStatusWrapper & stat)
+{
+  using diagnostic_msgs::msg::DiagnosticStatus;
+
+  // Get information
+  const auto topic_status = topic_state_monitor.getTopicStatus();
+  const auto last_message_time = topic_state_monitor.getLastMessageTime();
+  const auto topic_rate = topic_state_monitor.getTopicRate();
+
+  // Add topic name
+  if (node_param.is_transform) {
+    const auto frame = "(" + node_param.frame_id + " to " + node_param.child_frame_id + ")";
+    stat.addf("topic", "%s %s", node_param.topic.c_str(), frame.c_str());
+  } else {
+    stat.addf("topic", "%s", node_param.topic.c_str());
+  }
+
+  const auto print_warn = [&](const std::string & msg) {
+    RCLCPP_WARN_THROTTLE(node.get_logger(), *node.get_clock(), 3000, "%s", msg.c_str());
+  };
+  const auto print_debug = [&](const std::string & msg) {
+    RCLCPP_DEBUG_THROTTLE(node.get_logger(), *node.get_clock(), 3000, "%s", msg.c_str());
+  };
+
+  // Judge level
+  int8_t level = DiagnosticStatus::OK;
+  if (topic_status == TopicStatus::Ok) {
+    level = DiagnosticStatus::OK;
+    stat.add("status", "OK");
+  } else if (topic_status == TopicStatus::NotReceived) {
+    level = DiagnosticStatus::ERROR;
+    stat.add("status", "NotReceived");
+    print_debug(node_param.topic + " has not received.");
+  } else if (topic_status == TopicStatus::WarnRate) {
+    level = DiagnosticStatus::WARN;
+    stat.add("status", "WarnRate");
+    print_warn(node_param.topic + " topic rate has dropped to the warning level.");
+  } else if (topic_status == TopicStatus::ErrorRate) {
+    level = DiagnosticStatus::ERROR;
+    stat.add("status", "ErrorRate");
+    print_warn(node_param.topic + " topic rate has dropped to the error level.");
+  } else if (topic_status == TopicStatus::Timeout) {
+    level = DiagnosticStatus::ERROR;
+    stat.add("status", "Timeout");
+    print_warn(node_param.topic + " topic is timeout.");
+  }
+
+  // Add key-value
+  stat.addf("warn_rate", "%.2f [Hz]", param.warn_rate);
+  stat.addf("error_rate", "%.2f [Hz]", param.error_rate);
+  stat.addf("timeout", "%.2f [s]", param.timeout);
+  stat.addf("measured_rate", "%.2f [Hz]", topic_rate);
+  stat.addf("now", "%.2f [s]", node.now().seconds());
+  stat.addf("last_message_time", "%.2f [s]", last_message_time.seconds());
+
+  // Create message
+  std::string msg;
+  if (level == DiagnosticStatus::OK) {
+    msg = "OK";
+  } else if (level == DiagnosticStatus::WARN) {
+    msg = "Warn";
+  } else if (level == DiagnosticStatus::ERROR) {
+    msg = "Error";
+  }
+
+  // Add summary
+  stat.summary(level, msg);
+}
+
 TopicStateMonitorNode::TopicStateMonitorNode(const rclcpp::NodeOptions & node_options)
 : Node("topic_state_monitor", node_options), updater_(this)
 {
@@ -136,71 +207,7 @@ void TopicStateMonitorNode::onTimer()
 
 void TopicStateMonitorNode::checkTopicStatus(diagnostic_updater::DiagnosticStatusWrapper & stat)
 {
-  using diagnostic_msgs::msg::DiagnosticStatus;
-
-  // Get information
-  const auto topic_status = topic_state_monitor_->getTopicStatus();
-  const auto last_message_time = topic_state_monitor_->getLastMessageTime();
-  const auto topic_rate = topic_state_monitor_->getTopicRate();
-
-  // Add topic name
-  if (node_param_.is_transform) {
-    const auto frame = "(" + node_param_.frame_id + " to " + node_param_.child_frame_id + ")";
-    stat.addf("topic", "%s %s", node_param_.topic.c_str(), frame.c_str());
-  } else {
-    stat.addf("topic", "%s", node_param_.topic.c_str());
-  }
-
-  const auto print_warn = [&](const std::string & msg) {
-    RCLCPP_WARN_THROTTLE(get_logger(), *get_clock(), 3000, "%s", msg.c_str());
-  };
-  const auto print_debug = [&](const std::string & msg) {
-    RCLCPP_DEBUG_THROTTLE(get_logger(), *get_clock(), 3000, "%s", msg.c_str());
-  };
-
-  // Judge level
-  int8_t level = DiagnosticStatus::OK;
-  if (topic_status == TopicStatus::Ok) {
-    level = DiagnosticStatus::OK;
-    stat.add("status", "OK");
-  } else if (topic_status == TopicStatus::NotReceived) {
-    level = DiagnosticStatus::ERROR;
-    stat.add("status", "NotReceived");
-    print_debug(node_param_.topic + " has not received.");
-  } else if (topic_status == TopicStatus::WarnRate) {
-    level = DiagnosticStatus::WARN;
-    stat.add("status", "WarnRate");
-    print_warn(node_param_.topic + " topic rate has dropped to the warning level.");
-  } else if (topic_status == TopicStatus::ErrorRate) {
-    level = DiagnosticStatus::ERROR;
-    stat.add("status", "ErrorRate");
-    print_warn(node_param_.topic + " topic rate has dropped to the error level.");
-  } else if (topic_status == TopicStatus::Timeout) {
-    level = DiagnosticStatus::ERROR;
-    stat.add("status", "Timeout");
-    print_warn(node_param_.topic + " topic is timeout.");
-  }
-
-  // Add key-value
-  stat.addf("warn_rate", "%.2f [Hz]", param_.warn_rate);
-  stat.addf("error_rate", "%.2f [Hz]", param_.error_rate);
-  stat.addf("timeout", "%.2f [s]", param_.timeout);
-  stat.addf("measured_rate", "%.2f [Hz]", topic_rate);
-  stat.addf("now", "%.2f [s]", this->now().seconds());
-  stat.addf("last_message_time", "%.2f [s]", last_message_time.seconds());
-
-  // Create message
-  std::string msg;
-  if (level == DiagnosticStatus::OK) {
-    msg = "OK";
-  } else if (level == DiagnosticStatus::WARN) {
-    msg = "Warn";
-  } else if (level == DiagnosticStatus::ERROR) {
-    msg = "Error";
-  }
-
-  // Add summary
-  stat.summary(level, msg);
+  setTopicStatus(*this, node_param_, param_, *topic_state_monitor_, stat);
 }
 
 }  // namespace topic_state_monitor
@@ -46,6 +46,7 @@
 #include "tier4_vehicle_msgs/srv/update_accel_brake_map.hpp"
 #include "visualization_msgs/msg/marker_array.hpp"
 
+#include <deque>
 #include <fstream>
 #include <iomanip>
 #include <memory>
@@ -85,6 +86,25 @@ struct DataStamped
 };
 using DataStampedPtr = std::shared_ptr<DataStamped>;
 
+// queue of the latest values which keeps their sum to get the average in constant time
+struct AverageQueue
+{
+  std::deque<double> values;
+  double sum = 0.0;
+
+  void push(const double value, const std::size_t max_size)
+  {
+    values.push_back(value);
+    sum += value;
+    while (values.size() > max_size) {
+      sum -= values.front();
+      values.pop_front();
+    }
+  }
+  double getAverage() const { return values.empty() ? 0.0 : sum / values.size(); }
+  std::size_t size() const { return values.size(); }
+};
+
 class AccelBrakeMapCalibrator : public rclcpp::Node
 {
 private:
@@ -121,9 +141,9 @@ private:
   void initOutputCSVTimer(double period_s);
 
   TwistStamped::ConstSharedPtr twist_ptr_;
-  std::vector<std::shared_ptr<TwistStamped>> twist_vec_;
-  std::vector<DataStampedPtr> accel_pedal_vec_;  // for delayed pedal
-  std::vector<DataStampedPtr> brake_pedal_vec_;  // for delayed pedal
+  std::deque<std::shared_ptr<TwistStamped>> twist_vec_;
+  std::deque<DataStampedPtr> accel_pedal_vec_;  // for delayed pedal
+  std::deque<DataStampedPtr> brake_pedal_vec_;  // for delayed pedal
   SteeringReport::ConstSharedPtr steer_ptr_;
   DataStampedPtr accel_pedal_ptr_;
   DataStampedPtr brake_pedal_ptr_;
@@ -181,12 +201,12 @@ private:
   // for evaluation
   AccelMap new_accel_map_;
   BrakeMap new_brake_map_;
-  std::vector<double> part_original_accel_mse_que_;
-  std::vector<double> full_original_accel_mse_que_;
-  // std::vector<double> full_original_accel_esm_que_;
-  std::vector<double> full_original_accel_l1_que_;
-  std::vector<double> full_original_accel_sq_l1_que_;
-  std::vector<double> new_accel_mse_que_;
+  AverageQueue part_original_accel_mse_que_;
+  AverageQueue full_original_accel_mse_que_;
+  // AverageQueue full_original_accel_esm_que_;
+  AverageQueue full_original_accel_l1_que_;
+  AverageQueue full_original_accel_sq_l1_que_;
+  AverageQueue new_accel_mse_que_;
   std::size_t full_mse_que_size_ = 100000;
   std::size_t part_mse_que_size_ = 3000;
   double full_original_accel_rmse_ = 0.0;
@@ -202,7 +222,11 @@ private:
   Map update_brake_map_value_;
   Map accel_offset_covariance_value_;
   Map brake_offset_covariance_value_;
-  std::vector<Map> map_value_data_;
+  // statistics of the measured acceleration on each cell of the unified pedal index and the
+  // velocity index, stored in row-major order
+  std::vector<std::size_t> map_data_count_;
+  std::vector<double> map_data_sum_;
+  std::vector<double> map_data_squared_sum_;
   std::vector<double> accel_vel_index_;
   std::vector<double> brake_vel_index_;
   std::vector<double> accel_pedal_index_;
@@ -292,14 +316,12 @@ private:
     const TwistStamped::ConstSharedPtr & data, const std::size_t max_size,
     std::queue<TwistStamped::ConstSharedPtr> * que);
   template <class T>
-  void pushDataToVec(const T data, const std::size_t max_size, std::vector<T> * vec);
+  void pushDataToVec(const T data, const std::size_t max_size, std::deque<T> * vec);
   template <class T>
   T getNearestTimeDataFromVec(
-    const T base_data, const double back_time, const std::vector<T> & vec);
+    const T base_data, const double back_time, const std::deque<T> & vec);
   DataStampedPtr getNearestTimeDataFromVec(
-    DataStampedPtr base_data, const double back_time, const std::vector<DataStampedPtr> & vec);
-  double getAverage(const std::vector<double> & vec);
-  double getStandardDeviation(const std::vector<double> & vec);
+    DataStampedPtr base_data, const double back_time, const std::deque<DataStampedPtr> & vec);
   bool isTimeout(const builtin_interfaces::msg::Time & stamp, const double timeout_sec);
   bool isTimeout(const DataStampedPtr & data_stamped, const double timeout_sec);
 
@@ -19,6 +19,8 @@
 #include "rclcpp/logging.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <deque>
 #include <limits>
 #include <memory>
 #include <queue>
@@ -159,10 +161,11 @@ AccelBrakeMapCalibrator::AccelBrakeMapCalibrator(const rclcpp::NodeOptions & nod
   for (auto & m : brake_offset_covariance_value_) {
     m.resize(brake_map_value_.at(0).size(), covariance_);
   }
-  map_value_data_.resize(accel_map_value_.size() + brake_map_value_.size() - 1);
-  for (auto & m : map_value_data_) {
-    m.resize(accel_map_value_.at(0).size());
-  }
+  const auto map_data_size =
+    (accel_map_value_.size() + brake_map_value_.size() - 1) * accel_map_value_.at(0).size();
+  map_data_count_.resize(map_data_size, 0);
+  map_data_sum_.resize(map_data_size, 0.0);
+  map_data_squared_sum_.resize(map_data_size, 0.0);
 
   std::copy(accel_map_value_.begin(), accel_map_value_.end(), update_accel_map_value_.begin());
   std::copy(brake_map_value_.begin(), brake_map_value_.end(), update_brake_map_value_.begin());
@@ -842,12 +845,13 @@ void AccelBrakeMapCalibrator::executeUpdate(
   }
 
   // add accel data to map
-  accel_mode ? map_value_data_.at(getUnifiedIndexFromAccelBrakeIndex(true, accel_pedal_index))
-                 .at(accel_vel_index)
-                 .emplace_back(measured_acc)
-             : map_value_data_.at(getUnifiedIndexFromAccelBrakeIndex(false, brake_pedal_index))
-                 .at(brake_vel_index)
-                 .emplace_back(measured_acc);
+  const int unified_pedal_index = getUnifiedIndexFromAccelBrakeIndex(
+    accel_mode, accel_mode ? accel_pedal_index : brake_pedal_index);
+  const int vel_index = accel_mode ? accel_vel_index : brake_vel_index;
+  const auto map_data_idx = unified_pedal_index * accel_map_value_.at(0).size() + vel_index;
+  map_data_count_.at(map_data_idx)++;
+  map_data_sum_.at(map_data_idx) += measured_acc;
+  map_data_squared_sum_.at(map_data_idx) += measured_acc * measured_acc;
 }
 
 bool AccelBrakeMapCalibrator::updateFourCellAroundOffset(
@@ -859,14 +863,14 @@ bool AccelBrakeMapCalibrator::updateFourCellAroundOffset(
     accel_map_value_.size(), std::vector<double>(accel_map_value_.at(0).size(), map_offset_));
   static Map brake_map_offset_vec_(
     brake_map_value_.size(), std::vector<double>(accel_map_value_.at(0).size(), map_offset_));
-  static std::vector<std::vector<Eigen::MatrixXd>> accel_covariance_mat_(
-    accel_map_value_.size() - 1,
-    std::vector<Eigen::MatrixXd>(
-      accel_map_value_.at(0).size() - 1, Eigen::MatrixXd::Identity(4, 4) * covariance_));
-  static std::vector<std::vector<Eigen::MatrixXd>> brake_covariance_mat_(
-    brake_map_value_.size() - 1,
-    std::vector<Eigen::MatrixXd>(
-      accel_map_value_.at(0).size() - 1, Eigen::MatrixXd::Identity(4, 4) * covariance_));
+  // covariance of the four cells around each cell, stored in row-major order
+  const std::size_t covariance_mat_width = accel_map_value_.at(0).size() - 1;
+  static std::vector<Eigen::Matrix4d> accel_covariance_mat_(
+    (accel_map_value_.size() - 1) * covariance_mat_width,
+    Eigen::Matrix4d::Identity() * covariance_);
+  static std::vector<Eigen::Matrix4d> brake_covariance_mat_(
+    (brake_map_value_.size() - 1) * covariance_mat_width,
+    Eigen::Matrix4d::Identity() * covariance_);
 
   auto & update_map_value = accel_mode ? update_accel_map_value_ : update_brake_map_value_;
   auto & offset_covariance_value =
@@ -896,25 +900,25 @@ bool AccelBrakeMapCalibrator::updateFourCellAroundOffset(
   const double yh = vel_index_.at(vel_index + 1);
   const double ry = (twist_ptr_->twist.linear.x - yl) / (yh - yl);
 
-  Eigen::Vector4d phi(4);
+  Eigen::Vector4d phi;
   phi << (1 - rx) * (1 - ry), rx * (1 - ry), (1 - rx) * ry, rx * ry;
 
-  Eigen::Vector4d theta(4);
+  Eigen::Vector4d theta;
   theta << zll, zhl, zlh, zhh;
 
-  Eigen::Vector4d weighted_sum(4);
+  Eigen::Vector4d weighted_sum;
   weighted_sum << data_weighted_num(pedal_index + 0, vel_index + 0),
     data_weighted_num(pedal_index + 1, vel_index + 0),
     data_weighted_num(pedal_index + 0, vel_index + 1),
     data_weighted_num(pedal_index + 1, vel_index + 1);
 
-  Eigen::Vector4d sigma(4);
+  Eigen::Vector4d sigma;
   sigma << data_covariance_mat(pedal_index + 0, vel_index + 0),
     data_covariance_mat(pedal_index + 1, vel_index + 0),
     data_covariance_mat(pedal_index + 0, vel_index + 1),
     data_covariance_mat(pedal_index + 1, vel_index + 1);
 
-  Eigen::Vector4d mean(4);
+  Eigen::Vector4d mean;
   mean << data_mean_mat(pedal_index + 0, vel_index + 0),
     data_mean_mat(pedal_index + 1, vel_index + 0), data_mean_mat(pedal_index + 0, vel_index + 1),
     data_mean_mat(pedal_index + 1, vel_index + 1);
@@ -924,19 +928,20 @@ bool AccelBrakeMapCalibrator::updateFourCellAroundOffset(
   const int ped_idx_l = pedal_index + 0;
   const int ped_idx_h = pedal_index + 1;
 
-  Eigen::VectorXd map_offset(4);
+  Eigen::Vector4d map_offset;
   map_offset(0) = map_offset_vec.at(ped_idx_l).at(vel_idx_l);
   map_offset(1) = map_offset_vec.at(ped_idx_h).at(vel_idx_l);
   map_offset(2) = map_offset_vec.at(ped_idx_l).at(vel_idx_h);
   map_offset(3) = map_offset_vec.at(ped_idx_h).at(vel_idx_h);
 
-  Eigen::VectorXd updated_map_offset(4);
+  Eigen::Vector4d updated_map_offset;
 
-  Eigen::MatrixXd covariance = covariance_mat.at(ped_idx_l).at(vel_idx_l);
+  auto & covariance_mat_cell = covariance_mat.at(ped_idx_l * covariance_mat_width + vel_idx_l);
+  Eigen::Matrix4d covariance = covariance_mat_cell;
 
   /* calculate adaptive map offset */
-  Eigen::MatrixXd G(4, 4);
-  Eigen::RowVectorXd phiT(4);
+  Eigen::Vector4d G;
+  Eigen::RowVector4d phiT;
   phiT = phi.transpose();
   double rk = phiT * covariance * phi;
 
@@ -979,7 +984,7 @@ bool AccelBrakeMapCalibrator::updateFourCellAroundOffset(
   data_mean_mat(ped_idx_l, vel_idx_h) = mean(2);
   data_mean_mat(ped_idx_h, vel_idx_h) = mean(3);
 
-  covariance_mat.at(ped_idx_l).at(vel_idx_l) = covariance;
+  covariance_mat_cell = covariance;
 
   update_map_value.at(pedal_index + 0).at(vel_index + 0) =
     map_value.at(pedal_index + 0).at(vel_index + 0) + map_offset(0);
@@ -1126,20 +1131,20 @@ void AccelBrakeMapCalibrator::executeEvaluation()
   const double full_orig_accel_sq_error = calculateAccelSquaredError(
     delayed_accel_pedal_ptr_->data, delayed_brake_pedal_ptr_->data, twist_ptr_->twist.linear.x,
     accel_map_, brake_map_);
-  pushDataToVec(full_orig_accel_sq_error, full_mse_que_size_, &full_original_accel_mse_que_);
-  full_original_accel_rmse_ = getAverage(full_original_accel_mse_que_);
+  full_original_accel_mse_que_.push(full_orig_accel_sq_error, full_mse_que_size_);
+  full_original_accel_rmse_ = full_original_accel_mse_que_.getAverage();
   // std::cerr << "rmse : " << sqrt(full_original_accel_rmse_) << std::endl;
 
   const double full_orig_accel_l1_error = calculateAccelErrorL1Norm(
     delayed_accel_pedal_ptr_->data, delayed_brake_pedal_ptr_->data, twist_ptr_->twist.linear.x,
     accel_map_, brake_map_);
   const double full_orig_accel_sq_l1_error = full_orig_accel_l1_error * full_orig_accel_l1_error;
-  pushDataToVec(full_orig_accel_l1_error, full_mse_que_size_, &full_original_accel_l1_que_);
-  pushDataToVec(full_orig_accel_sq_l1_error, full_mse_que_size_, &full_original_accel_sq_l1_que_);
-  full_original_accel_error_l1norm_ = getAverage(full_original_accel_l1_que_);
+  full_original_accel_l1_que_.push(full_orig_accel_l1_error, full_mse_que_size_);
+  full_original_accel_sq_l1_que_.push(full_orig_accel_sq_l1_error, full_mse_que_size_);
+  full_original_accel_error_l1norm_ = full_original_accel_l1_que_.getAverage();
 
   /*calculate l1norm_covariance*/
-  // const double full_original_accel_error_sql1_ = getAverage(full_original_accel_sq_l1_que_);
+  // const double full_original_accel_error_sql1_ = full_original_accel_sq_l1_que_.getAverage();
   // std::cerr << "error_l1norm : " << full_original_accel_error_l1norm_ << std::endl;
   // std::cerr << "error_l1_cov : " <<
   // full_original_accel_error_sql1_-full_original_accel_error_l1norm_*full_original_accel_error_l1norm_
@@ -1148,14 +1153,14 @@ void AccelBrakeMapCalibrator::executeEvaluation()
   const double part_orig_accel_sq_error = calculateAccelSquaredError(
     delayed_accel_pedal_ptr_->data, delayed_brake_pedal_ptr_->data, twist_ptr_->twist.linear.x,
     accel_map_, brake_map_);
-  pushDataToVec(part_orig_accel_sq_error, part_mse_que_size_, &part_original_accel_mse_que_);
-  part_original_accel_rmse_ = getAverage(part_original_accel_mse_que_);
+  part_original_accel_mse_que_.push(part_orig_accel_sq_error, part_mse_que_size_);
+  part_original_accel_rmse_ = part_original_accel_mse_que_.getAverage();
 
   const double new_accel_sq_error = calculateAccelSquaredError(
     delayed_accel_pedal_ptr_->data, delayed_brake_pedal_ptr_->data, twist_ptr_->twist.linear.x,
     new_accel_map_, new_brake_map_);
-  pushDataToVec(new_accel_sq_error, part_mse_que_size_, &new_accel_mse_que_);
-  new_accel_rmse_ = getAverage(new_accel_mse_que_);
+  new_accel_mse_que_.push(new_accel_sq_error, part_mse_que_size_);
+  new_accel_rmse_ = new_accel_mse_que_.getAverage();
 }
 
 double AccelBrakeMapCalibrator::calculateEstimatedAcc(
@@ -1206,17 +1211,17 @@ void AccelBrakeMapCalibrator::pushDataToQue(
 
 template <class T>
 void AccelBrakeMapCalibrator::pushDataToVec(
-  const T data, const std::size_t max_size, std::vector<T> * vec)
+  const T data, const std::size_t max_size, std::deque<T> * vec)
 {
   vec->emplace_back(data);
   while (vec->size() > max_size) {
-    vec->erase(vec->begin());
+    vec->pop_front();
   }
 }
 
 template <class T>
 T AccelBrakeMapCalibrator::getNearestTimeDataFromVec(
-  const T base_data, const double back_time, const std::vector<T> & vec)
+  const T base_data, const double back_time, const std::deque<T> & vec)
 {
   double nearest_time = std::numeric_limits<double>::max();
   const double target_time = rclcpp::Time(base_data->header.stamp).seconds() - back_time;
@@ -1233,7 +1238,7 @@ T AccelBrakeMapCalibrator::getNearestTimeDataFromVec(
 }
 
 DataStampedPtr AccelBrakeMapCalibrator::getNearestTimeDataFromVec(
-  DataStampedPtr base_data, const double back_time, const std::vector<DataStampedPtr> & vec)
+  DataStampedPtr base_data, const double back_time, const std::deque<DataStampedPtr> & vec)
 {
   double nearest_time = std::numeric_limits<double>::max();
   const double target_time = base_data->data_time.seconds() - back_time;
@@ -1249,34 +1254,6 @@ DataStampedPtr AccelBrakeMapCalibrator::getNearestTimeDataFromVec(
   return nearest_time_data;
 }
 
-double AccelBrakeMapCalibrator::getAverage(const std::vector<double> & vec)
-{
-  if (vec.empty()) {
-    return 0.0;
-  }
-
-  double sum = 0.0;
-  for (const auto num : vec) {
-    sum += num;
-  }
-  return sum / vec.size();
-}
-
-double AccelBrakeMapCalibrator::getStandardDeviation(const std::vector<double> & vec)
-{
-  if (vec.empty()) {
-    return 0.0;
-  }
-
-  const double ave = getAverage(vec);
-
-  double sum = 0.0;
-  for (const auto num : vec) {
-    sum += std::pow(num - ave, 2);
-  }
-  return std::sqrt(sum / vec.size());
-}
-
 bool AccelBrakeMapCalibrator::isTimeout(
   const builtin_interfaces::msg::Time & stamp, const double timeout_sec)
 {
@@ -1486,26 +1463,28 @@ void AccelBrakeMapCalibrator::publishCountMap()
 
   for (int i = 0; i < h; i++) {
     for (int j = 0; j < w; j++) {
-      const auto data_vec = map_value_data_.at(i).at(j);
-      if (data_vec.empty()) {
+      const auto data_count = map_data_count_.at(i * w + j);
+      if (data_count == 0) {
         // input *UNKNOWN* value
         count_map.at(i * w + j) = -1;
         ave_map.at(i * w + j) = -1;
       } else {
         const auto count_rate =
-          MAX_OCC_VALUE * (static_cast<double>(data_vec.size()) / max_data_count_);
+          MAX_OCC_VALUE * (static_cast<double>(data_count) / max_data_count_);
         count_map.at(i * w + j) = static_cast<int8_t>(
           std::max(std::min(static_cast<int>(MAX_OCC_VALUE), static_cast<int>(count_rate)), 0));
+        const double average = map_data_sum_.at(i * w + j) / data_count;
         // calculate average
         {
-          const double average = getAverage(data_vec);
           int8_t int_average = static_cast<uint8_t>(
             MAX_OCC_VALUE * ((average - min_accel_) / (max_accel_ - min_accel_)));
           ave_map.at(i * w + j) = std::max(std::min(MAX_OCC_VALUE, int_average), (int8_t)0);
         }
         // calculate standard deviation
         {
-          const double std_dev = getStandardDeviation(data_vec);
+          const double variance =
+            map_data_squared_sum_.at(i * w + j) / data_count - average * average;
+          const double std_dev = std::sqrt(std::max(variance, 0.0));
           const double max_std_dev = 0.2;
           const double min_std_dev = 0.0;
           int8_t int_std_dev = static_cast<uint8_t>(
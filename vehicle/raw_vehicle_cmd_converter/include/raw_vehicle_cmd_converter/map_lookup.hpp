@@ -0,0 +1,78 @@
+// Copyright 2023 Tier IV, Inc.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS,
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+#ifndef RAW_VEHICLE_CMD_CONVERTER__MAP_LOOKUP_HPP_
+#define RAW_VEHICLE_CMD_CONVERTER__MAP_LOOKUP_HPP_
+
+#include "interpolation/linear_interpolation.hpp"
+
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace raw_vehicle_cmd_converter
+{
+/**
+ * @brief segment [index, index + 1] of the keys of a map and the ratio of a key in it
+ */
+struct MapSegment
+{
+  size_t index;
+  double ratio;
+};
+
+/**
+ * @brief find the segment of the ascending keys containing the key by binary search. The segment
+ * and the ratio are the same as the ones used by interpolation::lerp, so that a map is looked up
+ * without copying its rows or columns.
+ * @param get_key function returning the key at an index
+ * @param size number of the keys
+ * @param key key in the range of the keys
+ */
+template <class KeyFunction>
+MapSegment findMapSegment(const KeyFunction & get_key, const size_t size, const double key)
+{
+  if (size < 2) {
+    throw std::invalid_argument(
+      "The size of points is less than 2. base_keys.size() = " + std::to_string(size));
+  }
+
+  // first segment whose end is not less than the key
+  size_t low = 0;
+  size_t high = size - 2;
+  while (low < high) {
+    const size_t mid = (low + high) / 2;
+    if (get_key(mid + 1) < key) {
+      low = mid + 1;
+    } else {
+      high = mid;
+    }
+  }
+  const double ratio = (key - get_key(low)) / (get_key(low + 1) - get_key(low));
+  return MapSegment{low, ratio};
+}
+
+inline MapSegment findMapSegment(const std::vector<double> & keys, const double key)
+{
+  return findMapSegment([&](const size_t i) { return keys[i]; }, keys.size(), key);
+}
+
+inline double interpolateMapSegment(const std::vector<double> & values, const MapSegment & segment)
+{
+  return interpolation::lerp(
+    values.at(segment.index), values.at(segment.index + 1), segment.ratio);
+}
+}  // namespace raw_vehicle_cmd_converter
+
+#endif  // RAW_VEHICLE_CMD_CONVERTER__MAP_LOOKUP_HPP_
@@ -20,6 +20,7 @@
 #include "raw_vehicle_cmd_converter/pid.hpp"
 #include "raw_vehicle_cmd_converter/steer_map.hpp"
 #include "tier4_autoware_utils/ros/logger_level_configure.hpp"
+#include "tier4_autoware_utils/ros/realtime_configure.hpp"
 
 #include <rclcpp/rclcpp.hpp>
 
@@ -118,6 +119,7 @@ public:
   DebugValues debug_steer_;
 
   std::unique_ptr<tier4_autoware_utils::LoggerLevelConfigure> logger_configure_;
+  std::unique_ptr<tier4_autoware_utils::RealtimeConfigure> realtime_configure_;
 };
 }  // namespace raw_vehicle_cmd_converter
 
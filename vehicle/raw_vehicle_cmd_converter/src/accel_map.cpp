@@ -15,6 +15,7 @@
 #include "raw_vehicle_cmd_converter/accel_map.hpp"
 
 #include "interpolation/linear_interpolation.hpp"
+#include "raw_vehicle_cmd_converter/map_lookup.hpp"
 
 #include <algorithm>
 #include <chrono>
@@ -46,40 +47,42 @@ bool AccelMap::readAccelMapFromCSV(const std::string & csv_path, const bool vali
 
 bool AccelMap::getThrottle(const double acc, double vel, double & throttle) const
 {
-  std::vector<double> interpolated_acc_vec;
   const double clamped_vel = CSVLoader::clampValue(vel, vel_index_, "throttle: vel");
   // (throttle, vel, acc) map => (throttle, acc) map by fixing vel
-  for (std::vector<double> accelerations : accel_map_) {
-    interpolated_acc_vec.push_back(interpolation::lerp(vel_index_, accelerations, clamped_vel));
-  }
+  const auto vel_segment = findMapSegment(vel_index_, clamped_vel);
+  const auto get_interpolated_acc = [&](const size_t throttle_idx) {
+    return interpolateMapSegment(accel_map_.at(throttle_idx), vel_segment);
+  };
   // calculate throttle
   // When the desired acceleration is smaller than the throttle area, return false => brake sequence
   // When the desired acceleration is greater than the throttle area, return max throttle
-  if (acc < interpolated_acc_vec.front()) {
+  if (acc < get_interpolated_acc(0)) {
     return false;
-  } else if (interpolated_acc_vec.back() < acc) {
+  } else if (get_interpolated_acc(accel_map_.size() - 1) < acc) {
     throttle = throttle_index_.back();
     return true;
   }
-  throttle = interpolation::lerp(interpolated_acc_vec, throttle_index_, acc);
+  const auto acc_segment = findMapSegment(get_interpolated_acc, accel_map_.size(), acc);
+  throttle = interpolateMapSegment(throttle_index_, acc_segment);
   return true;
 }
 
 bool AccelMap::getAcceleration(const double throttle, const double vel, double & acc) const
 {
-  std::vector<double> interpolated_acc_vec;
   const double clamped_vel = CSVLoader::clampValue(vel, vel_index_, "throttle: vel");
 
   // (throttle, vel, acc) map => (throttle, acc) map by fixing vel
-  for (const auto & acc_vec : accel_map_) {
-    interpolated_acc_vec.push_back(interpolation::lerp(vel_index_, acc_vec, clamped_vel));
-  }
+  const auto vel_segment = findMapSegment(vel_index_, clamped_vel);
 
   // calculate throttle
   // When the desired acceleration is smaller than the throttle area, return min acc
   // When the desired acceleration is greater than the throttle area, return max acc
   const double clamped_throttle = CSVLoader::clampValue(throttle, throttle_index_, "throttle: acc");
-  acc = interpolation::lerp(throttle_index_, interpolated_acc_vec, clamped_throttle);
+  const auto throttle_segment = findMapSegment(throttle_index_, clamped_throttle);
+  acc = interpolation::lerp(
+    interpolateMapSegment(accel_map_.at(throttle_segment.index), vel_segment),
+    interpolateMapSegment(accel_map_.at(throttle_segment.index + 1), vel_segment),
+    throttle_segment.ratio);
 
   return true;
 }
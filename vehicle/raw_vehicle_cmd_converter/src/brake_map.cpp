@@ -15,6 +15,7 @@
 #include "raw_vehicle_cmd_converter/brake_map.hpp"
 
 #include "interpolation/linear_interpolation.hpp"
+#include "raw_vehicle_cmd_converter/map_lookup.hpp"
 
 #include <algorithm>
 #include <string>
@@ -46,51 +47,57 @@ bool BrakeMap::readBrakeMapFromCSV(const std::string & csv_path, const bool vali
 
 bool BrakeMap::getBrake(const double acc, const double vel, double & brake)
 {
-  std::vector<double> interpolated_acc_vec;
   const double clamped_vel = CSVLoader::clampValue(vel, vel_index_, "brake: vel");
 
   // (throttle, vel, acc) map => (throttle, acc) map by fixing vel
-  for (std::vector<double> accelerations : brake_map_) {
-    interpolated_acc_vec.push_back(interpolation::lerp(vel_index_, accelerations, clamped_vel));
-  }
+  const auto vel_segment = findMapSegment(vel_index_, clamped_vel);
+  const auto get_interpolated_acc = [&](const size_t brake_idx) {
+    return interpolateMapSegment(brake_map_.at(brake_idx), vel_segment);
+  };
 
   // calculate brake
   // When the desired acceleration is smaller than the brake area, return max brake on the map
   // When the desired acceleration is greater than the brake area, return min brake on the map
-  if (acc < interpolated_acc_vec.back()) {
+  const double min_acc = get_interpolated_acc(brake_map_.size() - 1);
+  if (acc < min_acc) {
     RCLCPP_WARN_SKIPFIRST_THROTTLE(
       logger_, clock_, 1000,
       "Exceeding the acc range. Desired acc: %f < min acc on map: %f. return max "
       "value.",
-      acc, interpolated_acc_vec.back());
+      acc, min_acc);
     brake = brake_index_.back();
     return true;
-  } else if (interpolated_acc_vec.front() < acc) {
+  } else if (get_interpolated_acc(0) < acc) {
     brake = brake_index_.front();
     return true;
   }
 
-  std::reverse(std::begin(interpolated_acc_vec), std::end(interpolated_acc_vec));
-  brake = interpolation::lerp(interpolated_acc_vec, brake_index_rev_, acc);
+  // the accelerations decrease with the brake, so they are searched in the reverse order
+  const auto get_reversed_interpolated_acc = [&](const size_t reversed_brake_idx) {
+    return get_interpolated_acc(brake_map_.size() - 1 - reversed_brake_idx);
+  };
+  const auto acc_segment = findMapSegment(get_reversed_interpolated_acc, brake_map_.size(), acc);
+  brake = interpolateMapSegment(brake_index_rev_, acc_segment);
 
   return true;
 }
 
 bool BrakeMap::getAcceleration(const double brake, const double vel, double & acc) const
 {
-  std::vector<double> interpolated_acc_vec;
   const double clamped_vel = CSVLoader::clampValue(vel, vel_index_, "brake: vel");
 
   // (throttle, vel, acc) map => (throttle, acc) map by fixing vel
-  for (const auto & acc_vec : brake_map_) {
-    interpolated_acc_vec.push_back(interpolation::lerp(vel_index_, acc_vec, clamped_vel));
-  }
+  const auto vel_segment = findMapSegment(vel_index_, clamped_vel);
 
   // calculate brake
   // When the desired acceleration is smaller than the brake area, return min acc
   // When the desired acceleration is greater than the brake area, return min acc
   const double clamped_brake = CSVLoader::clampValue(brake, brake_index_, "brake: acc");
-  acc = interpolation::lerp(brake_index_, interpolated_acc_vec, clamped_brake);
+  const auto brake_segment = findMapSegment(brake_index_, clamped_brake);
+  acc = interpolation::lerp(
+    interpolateMapSegment(brake_map_.at(brake_segment.index), vel_segment),
+    interpolateMapSegment(brake_map_.at(brake_segment.index + 1), vel_segment),
+    brake_segment.ratio);
 
   return true;
 }
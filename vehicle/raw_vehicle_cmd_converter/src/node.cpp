@@ -86,6 +86,7 @@ RawVehicleCommandConverterNode::RawVehicleCommandConverterNode(
     "/vehicle/raw_vehicle_cmd_converter/debug/steer_pid", 1);
 
   logger_configure_ = std::make_unique<tier4_autoware_utils::LoggerLevelConfigure>(this);
+  realtime_configure_ = std::make_unique<tier4_autoware_utils::RealtimeConfigure>(this);
 }
 
 void RawVehicleCommandConverterNode::publishActuationCmd()
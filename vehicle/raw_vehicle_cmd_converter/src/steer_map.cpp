@@ -15,6 +15,7 @@
 #include "raw_vehicle_cmd_converter/steer_map.hpp"
 
 #include "interpolation/linear_interpolation.hpp"
+#include "raw_vehicle_cmd_converter/map_lookup.hpp"
 
 #include <string>
 #include <vector>
@@ -44,13 +45,18 @@ bool SteerMap::readSteerMapFromCSV(const std::string & csv_path, const bool vali
 void SteerMap::getSteer(const double steer_rate, const double steer, double & output) const
 {
   const double clamped_steer = CSVLoader::clampValue(steer, steer_index_, "steer: steer");
-  std::vector<double> steer_rate_interp = {};
-  for (const auto & steer_rate_vec : steer_map_) {
-    steer_rate_interp.push_back(interpolation::lerp(steer_index_, steer_rate_vec, clamped_steer));
-  }
-
-  const double clamped_steer_rate =
-    CSVLoader::clampValue(steer_rate, steer_rate_interp, "steer: steer_rate");
-  output = interpolation::lerp(steer_rate_interp, output_index_, clamped_steer_rate);
+  const auto steer_segment = findMapSegment(steer_index_, clamped_steer);
+  const auto get_steer_rate_interp = [&](const size_t output_idx) {
+    return interpolateMapSegment(steer_map_.at(output_idx), steer_segment);
+  };
+
+  // the interpolated steer rates increase with the output, so the first and the last ones are the
+  // range of the steer rate
+  const double clamped_steer_rate = CSVLoader::clampValue(
+    steer_rate, get_steer_rate_interp(0), get_steer_rate_interp(steer_map_.size() - 1),
+    "steer: steer_rate");
+  const auto steer_rate_segment =
+    findMapSegment(get_steer_rate_interp, steer_map_.size(), clamped_steer_rate);
+  output = interpolateMapSegment(output_index_, steer_rate_segment);
 }
 }  // namespace raw_vehicle_cmd_converter